@@ -0,0 +1,480 @@
+// codecbenchmark.m.cpp                                               -*-C++-*-
+
+// ----------------------------------------------------------------------------
+// This program compares the 'balber', 'baljsn', and 'balxml' codecs on the
+// same 'bdlat' types, those of 'balb_testmessages'.  For each codec and each
+// message of a fixed corpus (see 'Corpus' below), the program:
+//
+//: 1 Encodes the message once, decodes the result, and verifies that the
+//:   decoded value equals the message (the program fails otherwise).
+//:
+//: 2 Times repeated encodings of the message into a buffer reserved
+//:   beforehand, and repeated decodings of the encoded message into newly
+//:   created objects.  Each measurement processes about the number of
+//:   megabytes (of encoded data) given on the command line (by default 16).
+//:
+//: 3 Counts the allocations made by a few more encodings and decodings, with
+//:   a 'bslma::TestAllocator' installed as the default allocator (which is
+//:   slow, hence this separate, untimed, step).  Note that the objects into
+//:   which messages are decoded are created using the default allocator, so
+//:   that their allocations are counted, as are those of the codec objects,
+//:   which are created for each message as in typical client code.
+//
+// The results are written to standard output as comma-separated values, one
+// line per codec, message, and operation, preceded by a header line:
+//..
+//  codec,message,operation,bytes,iterations,seconds,mbPerSecond,
+//                                   messagesPerSecond,allocationsPerMessage
+//..
+// (on one line), where 'bytes' is the size of the encoded message and
+// megabytes are of 1024 * 1024 bytes.  For example:
+//..
+//  $ ./codecbenchmark.m 64 > results.csv
+//..
+// See 'README.md' for how to build the program.
+// ----------------------------------------------------------------------------
+
+#include <balb_testmessages.h>
+
+#include <balber_berdecoder.h>
+#include <balber_berdecoderoptions.h>
+#include <balber_berencoder.h>
+#include <balber_berencoderoptions.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+#include <baljsn_encoder.h>
+#include <baljsn_encoderoptions.h>
+
+#include <balxml_decoder.h>
+#include <balxml_decoderoptions.h>
+#include <balxml_encoder.h>
+#include <balxml_encoderoptions.h>
+#include <balxml_errorinfo.h>
+#include <balxml_minireader.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_datetimetz.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+enum {
+    k_DEFAULT_MEGABYTES  = 16,  // default data processed by each measurement
+
+    k_NUM_COUNTED_CALLS  = 8,   // calls made to count allocations
+
+    k_DEEP_NESTING       = 7    // pairs of nested choices of the "deep"
+                                // message; note that 'balber' and 'baljsn'
+                                // decode to a default maximum depth of 32,
+                                // and that 'balber' counts two levels per
+                                // choice
+};
+
+                              // ===============
+                              // struct BerCodec
+                              // ===============
+
+struct BerCodec {
+    // This 'struct' encodes and decodes messages in BER.
+
+    static const char *name()
+    {
+        return "ber";
+    }
+
+    template <class TYPE>
+    static int encode(bsl::streambuf *streamBuf, const TYPE& message)
+    {
+        balber::BerEncoderOptions options;
+        balber::BerEncoder        encoder(&options);
+
+        return encoder.encode(streamBuf, message);
+    }
+
+    template <class TYPE>
+    static int decode(const char *data, bsl::size_t length, TYPE *message)
+    {
+        balber::BerDecoderOptions options;
+        balber::BerDecoder        decoder(&options);
+
+        return decoder.decode(data, length, message);
+    }
+};
+
+                              // ================
+                              // struct JsonCodec
+                              // ================
+
+struct JsonCodec {
+    // This 'struct' encodes and decodes messages in JSON.
+
+    static const char *name()
+    {
+        return "json";
+    }
+
+    template <class TYPE>
+    static int encode(bsl::streambuf *streamBuf, const TYPE& message)
+    {
+        baljsn::EncoderOptions options;
+        baljsn::Encoder        encoder;
+
+        return encoder.encode(streamBuf, message, options);
+    }
+
+    template <class TYPE>
+    static int decode(const char *data, bsl::size_t length, TYPE *message)
+    {
+        baljsn::DecoderOptions     options;
+        baljsn::Decoder            decoder;
+        bdlsb::FixedMemInStreamBuf streamBuf(data, length);
+
+        return decoder.decode(&streamBuf, message, options);
+    }
+};
+
+                              // ===============
+                              // struct XmlCodec
+                              // ===============
+
+struct XmlCodec {
+    // This 'struct' encodes and decodes messages in XML.
+
+    static const char *name()
+    {
+        return "xml";
+    }
+
+    template <class TYPE>
+    static int encode(bsl::streambuf *streamBuf, const TYPE& message)
+    {
+        balxml::EncoderOptions options;
+        balxml::Encoder        encoder(&options);
+
+        return encoder.encode(streamBuf, message);
+    }
+
+    template <class TYPE>
+    static int decode(const char *data, bsl::size_t length, TYPE *message)
+    {
+        balxml::DecoderOptions options;
+        balxml::MiniReader     reader;
+        balxml::ErrorInfo      errorInfo;
+        balxml::Decoder        decoder(&options, &reader, &errorInfo);
+
+        return decoder.decode(data, length, message);
+    }
+};
+
+                                // ============
+                                // class Corpus
+                                // ============
+
+class Corpus {
+    // This class holds the messages on which the codecs are compared:
+    //
+    //: small:        a 'balb::SimpleRequest' having two short fields
+    //:
+    //: wide:         a 'balb::Sequence4' having each of its 19 elements set
+    //:
+    //: deep:         a 'balb::Choice1' nesting 'k_DEEP_NESTING' pairs of
+    //:               choices
+    //:
+    //: arrayHeavy:   a 'balb::Sequence4' having 2000 'int' and 2000 'double'
+    //:               array elements
+    //:
+    //: stringHeavy:  a 'balb::Sequence3' having 200 strings of 80 characters,
+    //:               some of which must be escaped in JSON and XML
+
+    // DATA
+    balb::SimpleRequest d_small;
+    balb::Sequence4     d_wide;
+    balb::Choice1       d_deep;
+    balb::Sequence4     d_arrayHeavy;
+    balb::Sequence3     d_stringHeavy;
+
+  public:
+    // CREATORS
+    Corpus();
+        // Create the corpus.
+
+    // ACCESSORS
+    const balb::SimpleRequest& small() const { return d_small; }
+    const balb::Sequence4& wide() const { return d_wide; }
+    const balb::Choice1& deep() const { return d_deep; }
+    const balb::Sequence4& arrayHeavy() const { return d_arrayHeavy; }
+    const balb::Sequence3& stringHeavy() const { return d_stringHeavy; }
+};
+
+Corpus::Corpus()
+{
+    const bdlt::DatetimeTz TIME(bdlt::Datetime(2016, 3, 14, 15, 9, 26, 535),
+                                -300);
+
+    d_small.data()           = "GetQuote IBM";
+    d_small.responseLength() = 256;
+
+    balb::Sequence3 sequence3;
+    sequence3.element1().push_back(balb::Enumerated::e_LONDON);
+    sequence3.element2().push_back("element");
+    sequence3.element3().makeValue(true);
+
+    bsl::vector<char> bytes;
+    bytes.push_back('\x01');
+    bytes.push_back('\xff');
+
+    d_wide.element1().push_back(sequence3);
+    d_wide.element2().resize(1);
+    d_wide.element2().back().makeSelection1(-7);
+    d_wide.element3().makeValue(bytes);
+    d_wide.element4().makeValue(123456);
+    d_wide.element5().makeValue(TIME);
+    d_wide.element6().makeValue(balb::CustomString("custom"));
+    d_wide.element7().makeValue(balb::Enumerated::e_NEW_JERSEY);
+    d_wide.element8()  = true;
+    d_wide.element9()  = "The quick brown fox";
+    d_wide.element10() = 3.25;
+    d_wide.element11() = bytes;
+    d_wide.element12() = -42;
+    d_wide.element13() = balb::Enumerated::e_NEW_YORK;
+    d_wide.element14().push_back(false);
+    d_wide.element15().push_back(-0.5);
+    d_wide.element16().push_back(bytes);
+    d_wide.element17().push_back(2147483647);
+    d_wide.element18().push_back(TIME);
+    d_wide.element19().push_back(balb::CustomString("string"));
+
+    balb::Choice1 *choice = &d_deep;
+    for (int i = 0; i < k_DEEP_NESTING; ++i) {
+        choice = &choice->makeSelection4().makeSelection3();
+    }
+    choice->makeSelection1(1);
+
+    for (int i = 0; i < 2000; ++i) {
+        d_arrayHeavy.element17().push_back(i * 7919 - 1000000);
+        d_arrayHeavy.element15().push_back(i * 0.375 - 100);
+    }
+
+    for (int i = 0; i < 200; ++i) {
+        bsl::string text("Lorem ipsum dolor sit amet, consectetur adipiscing "
+                         "elit, sed do eiusmod tempora.");
+        if (0 == i % 10) {
+            text[11] = '&';
+            text[26] = '"';
+        }
+        d_stringHeavy.element2().push_back(text);
+    }
+    d_stringHeavy.element4().makeValue("Ut enim ad minim veniam");
+}
+
+                           // ======================
+                           // struct BenchmarkResult
+                           // ======================
+
+struct BenchmarkResult {
+    // This 'struct' holds the results of measuring one operation.
+
+    bsls::Types::Int64 d_iterations;      // calls timed
+    double             d_seconds;         // time taken by the timed calls
+    double             d_allocations;     // allocations per message
+};
+
+void printResult(const char             *codec,
+                 const char             *message,
+                 const char             *operation,
+                 bsl::size_t             bytes,
+                 const BenchmarkResult&  result)
+    // Print to 'stdout' the specified 'result' of measuring the specified
+    // 'operation' of the specified 'codec' on the specified 'message' whose
+    // encoding has the specified 'bytes', in the format described at the top
+    // of this file.
+{
+    const double megabytes = static_cast<double>(bytes)
+                           * static_cast<double>(result.d_iterations)
+                           / (1024 * 1024);
+    const double seconds   = result.d_seconds > 0 ? result.d_seconds : 1e-9;
+
+    bsl::printf("%s,%s,%s,%u,%lld,%.6f,%.3f,%.1f,%.2f\n",
+                codec,
+                message,
+                operation,
+                static_cast<unsigned int>(bytes),
+                result.d_iterations,
+                result.d_seconds,
+                megabytes / seconds,
+                static_cast<double>(result.d_iterations) / seconds,
+                result.d_allocations);
+}
+
+template <class CODEC, class TYPE>
+int runBenchmark(const char *messageName, const TYPE& message, int megabytes)
+    // Measure the encoding and decoding of the specified 'message' having the
+    // specified 'messageName' by the (template parameter) 'CODEC', with each
+    // measurement processing about the specified 'megabytes' of encoded data,
+    // and print the results.  Return 0 on success, and a non-zero value (after
+    // printing a message to 'stderr') if 'message' cannot be encoded, or does
+    // not decode to a value equal to 'message'.
+{
+    bdlsb::MemOutStreamBuf encoded;
+    if (0 != CODEC::encode(&encoded, message)) {
+        bsl::fprintf(stderr,
+                     "%s: cannot encode '%s'\n",
+                     CODEC::name(),
+                     messageName);
+        return -1;                                                    // RETURN
+    }
+
+    const char        *data   = encoded.data();
+    const bsl::size_t  length = encoded.length();
+
+    {
+        TYPE decoded;
+        if (0 != CODEC::decode(data, length, &decoded)
+         || !(decoded == message)) {
+            bsl::fprintf(stderr,
+                         "%s: '%s' does not round-trip\n",
+                         CODEC::name(),
+                         messageName);
+            return -1;                                                // RETURN
+        }
+    }
+
+    bsls::Types::Int64 iterations = static_cast<bsls::Types::Int64>(
+                                         1024.0 * 1024 * megabytes / length);
+    if (iterations < 1) {
+        iterations = 1;
+    }
+
+    BenchmarkResult encodeResult = { iterations, 0, 0 };
+    BenchmarkResult decodeResult = { iterations, 0, 0 };
+
+    bdlsb::MemOutStreamBuf output;
+    output.reserveCapacity(length);
+
+    bsls::Stopwatch stopwatch;
+
+    stopwatch.start(true);
+    for (bsls::Types::Int64 i = 0; i < iterations; ++i) {
+        output.pubseekpos(0);
+        CODEC::encode(&output, message);
+    }
+    stopwatch.stop();
+    encodeResult.d_seconds = stopwatch.accumulatedWallTime();
+
+    stopwatch.reset();
+    stopwatch.start(true);
+    for (bsls::Types::Int64 i = 0; i < iterations; ++i) {
+        TYPE decoded;
+        CODEC::decode(data, length, &decoded);
+    }
+    stopwatch.stop();
+    decodeResult.d_seconds = stopwatch.accumulatedWallTime();
+
+    bslma::TestAllocator         testAllocator("benchmark");
+    bslma::DefaultAllocatorGuard guard(&testAllocator);
+
+    bsls::Types::Int64 numAllocations = testAllocator.numAllocations();
+    for (int i = 0; i < k_NUM_COUNTED_CALLS; ++i) {
+        output.pubseekpos(0);
+        CODEC::encode(&output, message);
+    }
+    encodeResult.d_allocations =
+                static_cast<double>(testAllocator.numAllocations()
+                                                            - numAllocations)
+              / k_NUM_COUNTED_CALLS;
+
+    numAllocations = testAllocator.numAllocations();
+    for (int i = 0; i < k_NUM_COUNTED_CALLS; ++i) {
+        TYPE decoded;
+        CODEC::decode(data, length, &decoded);
+    }
+    decodeResult.d_allocations =
+                static_cast<double>(testAllocator.numAllocations()
+                                                            - numAllocations)
+              / k_NUM_COUNTED_CALLS;
+
+    printResult(CODEC::name(), messageName, "encode", length, encodeResult);
+    printResult(CODEC::name(), messageName, "decode", length, decodeResult);
+    bsl::fflush(stdout);
+
+    return 0;
+}
+
+template <class CODEC>
+int runCodec(const Corpus& corpus, int megabytes)
+    // Measure the (template parameter) 'CODEC' on each message of the
+    // specified 'corpus', with each measurement processing about the
+    // specified 'megabytes' of encoded data, and print the results.  Return 0
+    // on success, and a non-zero value otherwise.
+{
+    int rc = 0;
+
+    rc |= runBenchmark<CODEC>("small",       corpus.small(),       megabytes);
+    rc |= runBenchmark<CODEC>("wide",        corpus.wide(),        megabytes);
+    rc |= runBenchmark<CODEC>("deep",        corpus.deep(),        megabytes);
+    rc |= runBenchmark<CODEC>("arrayHeavy",  corpus.arrayHeavy(),  megabytes);
+    rc |= runBenchmark<CODEC>("stringHeavy", corpus.stringHeavy(), megabytes);
+
+    return rc;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int megabytes = argc > 1 ? bsl::atoi(argv[1]) : k_DEFAULT_MEGABYTES;
+
+    if (megabytes <= 0) {
+        bsl::fprintf(stderr, "usage: %s [megabytesPerMeasurement]\n", argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    const Corpus corpus;
+
+    bsl::printf("codec,message,operation,bytes,iterations,seconds,"
+                "mbPerSecond,messagesPerSecond,allocationsPerMessage\n");
+
+    int rc = 0;
+
+    rc |= runCodec<BerCodec>(corpus, megabytes);
+    rc |= runCodec<JsonCodec>(corpus, megabytes);
+    rc |= runCodec<XmlCodec>(corpus, megabytes);
+
+    return 0 == rc ? 0 : 1;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
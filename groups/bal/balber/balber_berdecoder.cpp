@@ -13,7 +13,6 @@
 BSLS_IDENT_RCSID(balber_berdecoder_cpp,"$Id$ $CSID$")
 
 #include <balber_berencoder.h>          // for testing only
-#include <bdlsb_fixedmeminstreambuf.h>  // for testing only
 #include <bdlsb_memoutstreambuf.h>      // for testing only
 
 namespace BloombergLP {
@@ -40,6 +39,8 @@ BerDecoder::BerDecoder(const BerDecoderOptions *options,
 , d_logStream                (0)
 , d_severity                 (e_BER_SUCCESS)
 , d_streamBuf                (0)
+, d_memStreamBuf_p           (0)
+, d_memEnd_p                 (0)
 , d_currentDepth             (0)
 , d_numUnknownElementsSkipped(0)
 , d_topNode                  (0)
@@ -209,6 +210,43 @@ int BerDecoder_Node::decode(bsl::vector<char> *variable,
     return this->decodeArray(variable);
 }
 
+int BerDecoder_Node::decode(bslstl::StringRef *variable,
+                            bdlat_TypeCategory::Simple)
+{
+    if (d_tagType != BerConstants::e_PRIMITIVE) {
+        return logError("Expected PRIMITIVE tag type for 'StringRef'");
+                                                                      // RETURN
+    }
+
+    if (0 == d_decoder->d_memStreamBuf_p) {
+        return logError("'StringRef' can be decoded only from contiguous "
+                        "input");                                     // RETURN
+    }
+
+    if (d_expectedLength < 0) {
+        return logError("'StringRef' with indefinite length is not "
+                        "supported");                                 // RETURN
+    }
+
+    // Bind 'variable' to the value in the input buffer, then skip the value.
+
+    const bsl::size_t available = d_decoder->d_memStreamBuf_p->length();
+
+    if (static_cast<bsl::size_t>(d_expectedLength) > available) {
+        return logError("Stream error while reading 'StringRef'");    // RETURN
+    }
+
+    variable->assign(d_decoder->d_memEnd_p - available, d_expectedLength);
+
+    d_decoder->d_streamBuf->pubseekoff(d_expectedLength,
+                                       bsl::ios_base::cur,
+                                       bsl::ios_base::in);
+
+    d_consumedBodyBytes = d_expectedLength;
+
+    return BerDecoder::e_BER_SUCCESS;
+}
+
 int BerDecoder_Node::readTagHeader()
 {
     if (d_decoder->maxDepthExceeded()) {
@@ -26,13 +26,31 @@ BSLS_IDENT("$Id: $")
 // that contains a parameterized 'decode' function.  The 'decode' function
 // decodes data read from a specified stream and loads the corresponding object
 // to an object of the parameterized type.  The 'decode' method is overloaded
-// for two types of input streams:
+// for several types of input:
 //: o 'bsl::streambuf'
 //: o 'bsl::istream'
+//: o 'bdlsb::FixedMemInStreamBuf'
+//: o a contiguous buffer, specified by its address and length
 //
 // This class decodes objects based on the X.690 BER specification and is
 // restricted to types supported by the 'bdlat' framework.
 //
+///Decoding from Contiguous Memory
+///-------------------------------
+// When the input is a 'bdlsb::FixedMemInStreamBuf' (or a buffer specified by
+// its address and length, which the decoder wraps in one), the whole encoding
+// is known to reside in contiguous memory, and the decoder can decode string
+// values "in situ": a 'bslstl::StringRef' attribute or array element is bound
+// to the characters of the value *within the input buffer*, with no copy and
+// no memory allocation, after checking that the value lies within the buffer.
+// Such a decoded object therefore refers to the input buffer, which must
+// outlive the object's use.  'bslstl::StringRef' values can be decoded only
+// from contiguous memory: decoding them from any other 'bsl::streambuf' fails.
+// Note that a 'bslstl::StringRef' is encoded exactly like a 'bsl::string'
+// having the same formatting mode (see 'balber_beruniversaltagnumber'), so a
+// type holding 'bsl::string' values may be encoded and then decoded into a
+// "view" type holding 'bslstl::StringRef' values in their place.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -157,6 +175,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_variant.h>
 #endif
 
+#ifndef INCLUDED_BDLSB_FIXEDMEMINSTREAMBUF
+#include <bdlsb_fixedmeminstreambuf.h>
+#endif
+
 #ifndef INCLUDED_BDLSB_MEMOUTSTREAMBUF
 #include <bdlsb_memoutstreambuf.h>
 #endif
@@ -169,6 +191,14 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
 #ifndef INCLUDED_BSL_ISTREAM
 #include <bsl_istream.h>
 #endif
@@ -262,6 +292,14 @@ class BerDecoder {
 
     ErrorSeverity                    d_severity;     // error severity level
     bsl::streambuf                  *d_streamBuf;    // held, not owned
+
+    bdlsb::FixedMemInStreamBuf      *d_memStreamBuf_p;
+                                                     // 'd_streamBuf', if the
+                                                     // input is contiguous,
+                                                     // and 0 otherwise
+
+    const char                      *d_memEnd_p;     // end of contiguous
+                                                     // input, if any
     int                              d_currentDepth; // current depth
 
     int                              d_numUnknownElementsSkipped;
@@ -314,6 +352,24 @@ class BerDecoder {
         // 'streamBuf' and load the result into the specified 'variable'.
         // Return 0 on success, and a non-zero value otherwise.
 
+    template <typename TYPE>
+    int decode(bdlsb::FixedMemInStreamBuf *streamBuf, TYPE *variable);
+        // Decode an object of parameterized 'TYPE' from the specified
+        // 'streamBuf', whose input is contiguous in memory, and load the
+        // result into the specified 'variable'.  Return 0 on success, and a
+        // non-zero value otherwise.  Each 'bslstl::StringRef' within
+        // 'variable' is bound to the characters of its value in the buffer of
+        // 'streamBuf' (see {Decoding from Contiguous Memory}).
+
+    template <typename TYPE>
+    int decode(const char *buffer, bsl::size_t length, TYPE *variable);
+        // Decode an object of parameterized 'TYPE' from the specified
+        // 'buffer' of the specified 'length' and load the result into the
+        // specified 'variable'.  Return 0 on success, and a non-zero value
+        // otherwise.  Each 'bslstl::StringRef' within 'variable' is bound to
+        // the characters of its value in 'buffer' (see {Decoding from
+        // Contiguous Memory}).
+
     template <typename TYPE>
     int decode(bsl::istream& stream, TYPE *variable);
         // Decode an object of parameterized 'TYPE' from the specified 'stream'
@@ -385,6 +441,7 @@ class BerDecoder_Node {
   private:
     // PRIVATE MANIPULATORS
     int decode(bsl::vector<char> *variable, bdlat_TypeCategory::Array);
+    int decode(bslstl::StringRef *variable, bdlat_TypeCategory::Simple);
     template <typename TYPE>
     int decode(TYPE *variable, bdlat_TypeCategory::Array);
     template <typename TYPE>
@@ -676,6 +733,37 @@ int BerDecoder::decode(bsl::istream& stream, TYPE *variable)
     return 0;
 }
 
+template <typename TYPE>
+int BerDecoder::decode(bdlsb::FixedMemInStreamBuf *streamBuf, TYPE *variable)
+{
+    BSLS_ASSERT(0 == d_memStreamBuf_p);
+
+    const bsl::streamoff position = streamBuf->pubseekoff(0,
+                                                          bsl::ios_base::cur,
+                                                          bsl::ios_base::in);
+
+    d_memStreamBuf_p = streamBuf;
+    d_memEnd_p       = streamBuf->data() + position + streamBuf->length();
+
+    const int rc = this->decode(static_cast<bsl::streambuf *>(streamBuf),
+                                variable);
+
+    d_memStreamBuf_p = 0;
+    d_memEnd_p       = 0;
+    return rc;
+}
+
+template <typename TYPE>
+inline
+int BerDecoder::decode(const char  *buffer,
+                       bsl::size_t  length,
+                       TYPE        *variable)
+{
+    bdlsb::FixedMemInStreamBuf streamBuf(buffer, length);
+
+    return this->decode(&streamBuf, variable);
+}
+
 template <typename TYPE>
 int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
 {
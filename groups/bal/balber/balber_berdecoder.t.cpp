@@ -40,8 +40,11 @@
 
 #include <bsl_iostream.h>
 #include <bsl_iomanip.h>
+#include <bsl_sstream.h>
 
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 
 #include <bsl_fstream.h>
 
@@ -9605,6 +9608,202 @@ bsl::ostream& TimingRequest::print(
 
 // ************************ END OF GENERATED CODE **************************
 
+// ============================================================================
+//                       STRING SEQUENCE TYPE FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace BloombergLP {
+namespace test {
+
+                          // ========================
+                          // class StringList<STRING>
+                          // ========================
+
+template <class STRING>
+class StringList {
+    // This class is a "sequence" type having a 'name' attribute of the
+    // (template parameter) type 'STRING' and a 'values' attribute that is an
+    // array of 'STRING' objects.  'StringList<bsl::string>' and
+    // 'StringList<bslstl::StringRef>' have the same BER encoding.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_NUM_ATTRIBUTES      = 2,
+        k_ATTRIBUTE_ID_NAME   = 0,
+        k_ATTRIBUTE_ID_VALUES = 1
+    };
+
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+  private:
+    // DATA
+    STRING              d_name;
+    bsl::vector<STRING> d_values;
+
+  public:
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(StringList, bdlat_TypeTraitBasicSequence);
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+        // Return attribute information for the attribute indicated by the
+        // specified 'id' if the attribute exists, and 0 otherwise.
+    {
+        return 0 <= id && id < k_NUM_ATTRIBUTES ? &ATTRIBUTE_INFO_ARRAY[id]
+                                                : 0;
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+        // Return attribute information for the attribute indicated by the
+        // specified 'name' of the specified 'nameLength' if the attribute
+        // exists, and 0 otherwise.
+    {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& info = ATTRIBUTE_INFO_ARRAY[i];
+            if (nameLength == info.d_nameLength
+             && 0 == bsl::memcmp(name, info.d_name_p, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    StringList()
+        // Create an object having an empty 'name' and no 'values'.
+    {
+    }
+
+    // MANIPULATORS
+    void reset()
+        // Reset this object to its default-constructed value.
+    {
+        d_name = STRING();
+        d_values.clear();
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'id', and return the value it returns, or -1 if there is
+        // no such attribute.
+    {
+        switch (id) {
+          case k_ATTRIBUTE_ID_NAME: {
+            return manipulator(&d_name, ATTRIBUTE_INFO_ARRAY[id]);    // RETURN
+          }
+          case k_ATTRIBUTE_ID_VALUES: {
+            return manipulator(&d_values, ATTRIBUTE_INFO_ARRAY[id]);  // RETURN
+          }
+        }
+        return -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'name' of the specified 'nameLength', and return the
+        // value it returns, or -1 if there is no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? manipulateAttribute(manipulator, info->d_id) : -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator)
+        // Invoke the specified 'manipulator' on each attribute until it
+        // returns non-zero, and return the last value it returned.
+    {
+        const int rc = manipulateAttribute(manipulator, k_ATTRIBUTE_ID_NAME);
+        return rc ? rc
+                  : manipulateAttribute(manipulator, k_ATTRIBUTE_ID_VALUES);
+    }
+
+    STRING& name()
+        // Return a reference to the modifiable 'name' attribute.
+    {
+        return d_name;
+    }
+
+    bsl::vector<STRING>& values()
+        // Return a reference to the modifiable 'values' attribute.
+    {
+        return d_values;
+    }
+
+    // ACCESSORS
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const
+        // Invoke the specified 'accessor' on the attribute having the
+        // specified 'id', and return the value it returns, or -1 if there is
+        // no such attribute.
+    {
+        switch (id) {
+          case k_ATTRIBUTE_ID_NAME: {
+            return accessor(d_name, ATTRIBUTE_INFO_ARRAY[id]);        // RETURN
+          }
+          case k_ATTRIBUTE_ID_VALUES: {
+            return accessor(d_values, ATTRIBUTE_INFO_ARRAY[id]);      // RETURN
+          }
+        }
+        return -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char *name,
+                        int         nameLength) const
+        // Invoke the specified 'accessor' on the attribute having the
+        // specified 'name' of the specified 'nameLength', and return the
+        // value it returns, or -1 if there is no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? accessAttribute(accessor, info->d_id) : -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const
+        // Invoke the specified 'accessor' on each attribute until it returns
+        // non-zero, and return the last value it returned.
+    {
+        const int rc = accessAttribute(accessor, k_ATTRIBUTE_ID_NAME);
+        return rc ? rc : accessAttribute(accessor, k_ATTRIBUTE_ID_VALUES);
+    }
+
+    const STRING& name() const
+        // Return a reference to the non-modifiable 'name' attribute.
+    {
+        return d_name;
+    }
+
+    const bsl::vector<STRING>& values() const
+        // Return a reference to the non-modifiable 'values' attribute.
+    {
+        return d_values;
+    }
+};
+
+template <class STRING>
+const char StringList<STRING>::CLASS_NAME[] = "StringList";
+
+template <class STRING>
+const bdlat_AttributeInfo StringList<STRING>::ATTRIBUTE_INFO_ARRAY[] = {
+    { 0, "name",   4, "", bdlat_FormattingMode::e_TEXT },
+    { 1, "values", 6, "", bdlat_FormattingMode::e_TEXT }
+};
+
+}  // close namespace test
+}  // close enterprise namespace
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -10076,7 +10275,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -10094,6 +10293,160 @@ int main(int argc, char *argv[])
 
         if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING FROM CONTIGUOUS MEMORY
+        //
+        // Concerns:
+        //: 1 A 'bslstl::StringRef' decoded from a 'FixedMemInStreamBuf', or
+        //:   from a buffer and length, refers to the characters of its value
+        //:   within the input buffer.
+        //:
+        //: 2 'bslstl::StringRef' elements of arrays are bound in the same way,
+        //:   and the stream is positioned after each value.
+        //:
+        //: 3 A value extending past the end of the input is not bound.
+        //:
+        //: 4 Decoding a 'bslstl::StringRef' from any other 'bsl::streambuf'
+        //:   fails.
+        //:
+        //: 5 A 'bslstl::StringRef' is encoded as a 'bsl::string'.
+        //:
+        //: 6 The decoder can be reused after decoding from contiguous memory.
+        //
+        // Plan:
+        //: 1 Encode 'bsl::string' values, and sequences and arrays of them,
+        //:   decode them into 'bslstl::StringRef' objects from contiguous
+        //:   memory, and verify the address, length, and value of each.
+        //:   (C-1..2, 6)
+        //:
+        //: 2 Decode truncated encodings and verify that decoding fails.  (C-3)
+        //:
+        //: 3 Decode from a 'bsl::stringbuf' and verify that decoding fails.
+        //:   (C-4)
+        //:
+        //: 4 Encode sequences of 'bslstl::StringRef' and 'bsl::string'
+        //:   having the same values and verify that the encodings are the
+        //:   same.
+        //:   (C-5)
+        //
+        // Testing:
+        //   int decode(bdlsb::FixedMemInStreamBuf *streamBuf, TYPE *v);
+        //   int decode(const char *buffer, bsl::size_t length, TYPE *v);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING DECODING FROM CONTIGUOUS MEMORY"
+                               << "\n======================================="
+                               << bsl::endl;
+
+        static const char *VALUES[] = {
+            "",
+            "a",
+            "hello world",
+            "The quick brown fox jumped over the lazy dog.  The quick brown "
+            "fox jumped over the lazy dog.  The quick brown fox jumped over "
+            "the lazy dog."
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        if (verbose) bsl::cout << "\nDecoding single values" << bsl::endl;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const bsl::string VALUE(VALUES[i]);
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERTV(i, 0 == encoder.encode(&osb, VALUE));
+
+            const char        *BEGIN  = osb.data();
+            const bsl::size_t  LENGTH = osb.length();
+            const char        *END    = BEGIN + LENGTH;
+
+            {
+                bdlsb::FixedMemInStreamBuf isb(BEGIN, LENGTH);
+                bslstl::StringRef          value("garbage");
+
+                ASSERTV(i, 0 == decoder.decode(&isb, &value));
+                ASSERTV(i, VALUE == value);
+                ASSERTV(i, END   == value.end());
+                ASSERTV(i, 0     == isb.length());
+            }
+            {
+                bslstl::StringRef value("garbage");
+
+                ASSERTV(i, 0 == decoder.decode(BEGIN, LENGTH, &value));
+                ASSERTV(i, VALUE == value);
+                ASSERTV(i, END   == value.end());
+            }
+            {
+                // A truncated value is not bound.
+
+                bslstl::StringRef value;
+
+                ASSERTV(i, 0 != decoder.decode(BEGIN, LENGTH - 1, &value));
+            }
+            {
+                // Other stream buffers are rejected.
+
+                bsl::stringbuf    sb(bsl::string(BEGIN, LENGTH));
+                bslstl::StringRef value;
+
+                ASSERTV(i, 0 != decoder.decode(&sb, &value));
+            }
+        }
+
+        if (verbose) bsl::cout << "\nDecoding sequences and arrays"
+                               << bsl::endl;
+
+        for (int n = 0; n <= NUM_VALUES; ++n) {
+            test::StringList<bsl::string>       strings;
+            test::StringList<bslstl::StringRef> refs;
+
+            strings.name() = VALUES[n % NUM_VALUES];
+            refs.name()    = VALUES[n % NUM_VALUES];
+            for (int i = 0; i < n; ++i) {
+                strings.values().push_back(VALUES[i]);
+                refs.values().push_back(VALUES[i]);
+            }
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERTV(n, 0 == encoder.encode(&osb, strings));
+
+            // A 'StringRef' is encoded as a 'string'.
+
+            bdlsb::MemOutStreamBuf refOsb;
+            ASSERTV(n, 0 == encoder.encode(&refOsb, refs));
+            ASSERTV(n, osb.length() == refOsb.length());
+            ASSERTV(n, 0 == bsl::memcmp(osb.data(),
+                                        refOsb.data(),
+                                        osb.length()));
+
+            const char *BEGIN = osb.data();
+            const char *END   = BEGIN + osb.length();
+
+            test::StringList<bslstl::StringRef> value;
+
+            ASSERTV(n, 0 == decoder.decode(BEGIN, osb.length(), &value));
+            ASSERTV(n, refs.name()   == value.name());
+            ASSERTV(n, refs.values() == value.values());
+            ASSERTV(n, BEGIN <  value.name().begin());
+            ASSERTV(n, END   >= value.name().end());
+
+            const bsl::vector<bslstl::StringRef>& VALUES_REF = value.values();
+            for (int i = 0; i < static_cast<int>(VALUES_REF.size()); ++i) {
+                ASSERTV(n, i, value.name().end() < VALUES_REF[i].begin());
+                ASSERTV(n, i, END                >= VALUES_REF[i].end());
+            }
+            for (int i = 1; i < static_cast<int>(VALUES_REF.size()); ++i) {
+                ASSERTV(n, i, VALUES_REF[i - 1].end() < VALUES_REF[i].begin());
+            }
+
+            // A truncated encoding is rejected.
+
+            ASSERTV(n, 0 != decoder.decode(BEGIN, osb.length() - 1, &value));
+        }
+
+        if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TESTING decoding for date/time components using a variant
@@ -14274,7 +14627,124 @@ int main(int argc, char *argv[])
                   << elapsed          << " seconds, "
                   << (reps / elapsed) << " reps/sec" << bsl::endl;
 
+        // Measure decoding times of an encoding having definite lengths:
+        balber::BerEncoderOptions options;
+        options.setEncodeDefiniteLengths(true);
+
+        osb.pubseekpos(0);
+        {
+            balber::BerEncoder encoder(&options);
+            ASSERT(0 == encoder.encode(&osb, request));
+        }
+
+        isb.pubsetbuf(osb.data(), osb.length());
+        inRequests = new test::TimingRequest[reps];
+        stopwatch.reset();
+        stopwatch.start();
+        for (int i = 0; i < reps; ++i) {
+            isb.pubseekpos(0);
+            balber::BerDecoder decoder;  // Typical usage: single-use object
+            decoder.decode(&isb, &inRequests[i]);
+        }
+        stopwatch.stop();
+
+        ASSERT(inRequests[reps - 1] == request);
+        elapsed = stopwatch.elapsedTime();
+        ASSERT(elapsed > 0);
         delete[] inRequests;
+
+        bsl::cout << "    balber::BerDecoder (definite lengths): "
+                  << elapsed          << " seconds, "
+                  << (reps / elapsed) << " reps/sec, "
+                  << osb.length()     << " bytes" << bsl::endl;
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DECODING STRINGS FROM CONTIGUOUS MEMORY
+        //   Compare the time to decode messages of about 2KB and 20KB holding
+        //   string values from a generic 'bsl::streambuf' and from contiguous
+        //   memory, into 'bsl::string' and 'bslstl::StringRef' objects.
+        //
+        //   Usage: balber_berdecoder.t -2 [reps]
+        // --------------------------------------------------------------------
+
+        const int reps = argc > 2 ? bsl::atoi(argv[2]) : 20000;
+
+        static const int NUM_VALUES[] = { 40, 400 };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            test::StringList<bsl::string> message;
+            message.name() = "The name of a message that has many strings.";
+            for (int i = 0; i < NUM_VALUES[ti]; ++i) {
+                char buffer[64];
+                bsl::sprintf(buffer,
+                             "value %05d of the message, padded to 40 chars",
+                             i);
+                message.values().push_back(bsl::string(buffer, 40));
+            }
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == encoder.encode(&osb, message));
+
+            const double megabytes = static_cast<double>(osb.length())
+                                   * reps / (1024 * 1024);
+
+            bsl::cout << osb.length() << " bytes, "
+                      << NUM_VALUES[ti] << " strings" << bsl::endl;
+
+            bdlsb::FixedMemInStreamBuf isb(osb.data(), osb.length());
+
+            bsls::Stopwatch stopwatch;
+
+            {
+                test::StringList<bsl::string> value;
+
+                stopwatch.reset();
+                stopwatch.start();
+                for (int i = 0; i < reps; ++i) {
+                    isb.pubseekpos(0);
+                    bsl::streambuf *sb = &isb;
+                    ASSERT(0 == decoder.decode(sb, &value));
+                }
+                stopwatch.stop();
+
+                bsl::cout << "    'bsl::string',       'bsl::streambuf': "
+                          << megabytes / stopwatch.elapsedTime() << " MB/s"
+                          << bsl::endl;
+            }
+            {
+                test::StringList<bsl::string> value;
+
+                stopwatch.reset();
+                stopwatch.start();
+                for (int i = 0; i < reps; ++i) {
+                    ASSERT(0 == decoder.decode(osb.data(),
+                                               osb.length(),
+                                               &value));
+                }
+                stopwatch.stop();
+
+                bsl::cout << "    'bsl::string',       contiguous:       "
+                          << megabytes / stopwatch.elapsedTime() << " MB/s"
+                          << bsl::endl;
+            }
+            {
+                test::StringList<bslstl::StringRef> value;
+
+                stopwatch.reset();
+                stopwatch.start();
+                for (int i = 0; i < reps; ++i) {
+                    ASSERT(0 == decoder.decode(osb.data(),
+                                               osb.length(),
+                                               &value));
+                }
+                stopwatch.stop();
+
+                bsl::cout << "    'bslstl::StringRef', contiguous:       "
+                          << megabytes / stopwatch.elapsedTime() << " MB/s"
+                          << bsl::endl;
+            }
+        }
       } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
@@ -26,6 +26,50 @@ balber::BerEncoder::MemOutStream::~MemOutStream()
 {
 }
 
+                // -------------------------------------------
+                // class balber::BerEncoder::CountingStreamBuf
+                // -------------------------------------------
+
+// PROTECTED MANIPULATORS
+balber::BerEncoder::CountingStreamBuf::int_type
+balber::BerEncoder::CountingStreamBuf::overflow(int_type character)
+{
+    d_numDiscarded += pptr() - pbase();
+    setp(d_buffer, d_buffer + sizeof d_buffer);
+
+    if (traits_type::eq_int_type(character, traits_type::eof())) {
+        return traits_type::not_eof(character);                       // RETURN
+    }
+
+    ++d_numDiscarded;
+    return character;
+}
+
+bsl::streamsize
+balber::BerEncoder::CountingStreamBuf::xsputn(const char      *,
+                                              bsl::streamsize  numCharacters)
+{
+    d_numDiscarded += numCharacters;
+    return numCharacters;
+}
+
+// CREATORS
+balber::BerEncoder::CountingStreamBuf::CountingStreamBuf()
+: d_numDiscarded(0)
+{
+    setp(d_buffer, d_buffer + sizeof d_buffer);
+}
+
+balber::BerEncoder::CountingStreamBuf::~CountingStreamBuf()
+{
+}
+
+// ACCESSORS
+int balber::BerEncoder::CountingStreamBuf::length() const
+{
+    return static_cast<int>(d_numDiscarded + (pptr() - pbase()));
+}
+
 namespace balber {
 
                               // ----------------
@@ -41,6 +85,9 @@ BerEncoder::BerEncoder(const BerEncoderOptions *options,
 , d_severity     (e_BER_SUCCESS)
 , d_streamBuf    (0)
 , d_currentDepth (0)
+, d_lengthMode   (e_INDEFINITE_LENGTHS)
+, d_lengths      (d_allocator)
+, d_nextLength   (0)
 {
 }
 
@@ -122,6 +169,51 @@ BerEncoder::logMsg(const char             *msg,
     return d_severity;
 }
 
+int BerEncoder::putContentsLength(int *element)
+{
+    switch (d_lengthMode) {
+      case e_MEASURE_LENGTHS: {
+        // The contents of the element begin here; its length octets are
+        // counted by 'putContentsEnd', once the length is known.
+
+        *element = static_cast<int>(d_lengths.size());
+        d_lengths.push_back(
+                   static_cast<CountingStreamBuf *>(d_streamBuf)->length());
+        return 0;                                                     // RETURN
+      }
+      case e_DEFINITE_LENGTHS: {
+        BSLS_ASSERT(d_nextLength < d_lengths.size());
+
+        *element = 0;
+        return BerUtil::putLength(d_streamBuf,
+                                  d_lengths[d_nextLength++]);         // RETURN
+      }
+      default: {
+        *element = 0;
+        return BerUtil::putIndefiniteLengthOctet(d_streamBuf);        // RETURN
+      }
+    }
+}
+
+int BerEncoder::putContentsEnd(int element)
+{
+    switch (d_lengthMode) {
+      case e_MEASURE_LENGTHS: {
+        int& length = d_lengths[element];
+
+        length = static_cast<CountingStreamBuf *>(d_streamBuf)->length()
+               - length;
+        return BerUtil::putLength(d_streamBuf, length);               // RETURN
+      }
+      case e_DEFINITE_LENGTHS: {
+        return 0;                                                     // RETURN
+      }
+      default: {
+        return BerUtil::putEndOfContentOctets(d_streamBuf);           // RETURN
+      }
+    }
+}
+
 int BerEncoder::encodeImpl(const bsl::vector<char>&  value,
                            BerConstants::TagClass    tagClass,
                            int                       tagNumber,
@@ -33,6 +33,25 @@ BSLS_IDENT("$Id: $")
 // This component encodes objects based on the X.690 BER specification.  It can
 // only be used with types supported by the 'bdlat' framework.
 //
+///Length Encoding of Constructed Elements
+///---------------------------------------
+// By default, the encoder writes each constructed element (a sequence, choice,
+// array, or nillable value) with the indefinite form of length octets, and
+// terminates its contents with end-of-contents octets, so that the element is
+// written in a single pass without knowing its length in advance.  If the
+// 'encodeDefiniteLengths' option is set, the encoder instead writes the
+// definite form of length octets for every element, as the Distinguished
+// Encoding Rules require.  The encoder then encodes the object in two passes:
+// the first pass discards its output, recording the length of the contents of
+// each constructed element, in the order in which the elements begin; the
+// second pass writes the encoding, taking the length of each element from the
+// record.  Neither pass buffers or copies the contents of an element, so the
+// second pass writes every octet exactly once, directly to the output stream
+// buffer.  The definite form is usually smaller (the length octets of an
+// element shorter than 128 octets take 1 octet, whereas the indefinite form
+// takes 3) and lets the receiver skip an element without parsing it, at the
+// cost of formatting each value twice.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -321,6 +340,56 @@ class BerEncoder {
             // characters appended to the stream, if any.
     };
 
+    class CountingStreamBuf : public bsl::streambuf {
+        // This class provides a stream buffer that discards the characters
+        // written to it, counting them.  Single characters are written to a
+        // small scratch buffer, so that 'sputc' does not call a virtual
+        // function for each character.
+
+        // DATA
+        char            d_buffer[256];  // scratch put area
+        bsl::streamsize d_numDiscarded; // characters discarded from the put
+                                        // area or passed to 'xsputn'
+
+        // NOT IMPLEMENTED
+        CountingStreamBuf(const CountingStreamBuf&);             // = delete;
+        CountingStreamBuf& operator=(const CountingStreamBuf&);  // = delete;
+
+      protected:
+        // PROTECTED MANIPULATORS
+        virtual int_type overflow(int_type character);
+            // Discard the characters in the put area and the specified
+            // 'character', if it is not end-of-file, and return a value other
+            // than end-of-file.
+
+        virtual bsl::streamsize xsputn(const char      *characters,
+                                       bsl::streamsize  numCharacters);
+            // Discard the specified 'numCharacters' 'characters', and return
+            // 'numCharacters'.
+
+      public:
+        // CREATORS
+        CountingStreamBuf();
+            // Create a stream buffer to which no characters have been
+            // written.
+
+        virtual ~CountingStreamBuf();
+            // Destroy this object.
+
+        // ACCESSORS
+        int length() const;
+            // Return the number of characters written to this stream buffer.
+    };
+
+    enum LengthMode {
+        // This enumeration defines how the length octets of constructed
+        // elements are written.
+
+        e_INDEFINITE_LENGTHS,  // indefinite form
+        e_MEASURE_LENGTHS,     // first pass of the definite form
+        e_DEFINITE_LENGTHS     // second pass of the definite form
+    };
+
   public:
     // PUBLIC TYPES
     enum ErrorSeverity {
@@ -346,6 +415,17 @@ class BerEncoder {
     bsl::streambuf                   *d_streamBuf;      // held, not owned
     int                               d_currentDepth;   // current depth
 
+    LengthMode                        d_lengthMode;     // how lengths of
+                                                        // constructed elements
+                                                        // are written
+
+    bsl::vector<int>                  d_lengths;
+        // contents lengths of the constructed elements of the object being
+        // encoded with definite lengths, in the order the elements begin
+
+    bsl::size_t                       d_nextLength;
+        // index in 'd_lengths' of the next element written by the second pass
+
     // NOT IMPLEMENTED
     BerEncoder(const BerEncoder&);             // = delete;
     BerEncoder& operator=(const BerEncoder&);  // = delete;
@@ -369,6 +449,26 @@ class BerEncoder {
         // Return the stream for logging.  Note the if stream has not been
         // created yet, it will be created during this call.
 
+    int putContentsLength(int *element);
+        // Write the length octets of the constructed element whose identifier
+        // octets were just written, as indicated by the current length mode,
+        // and load into the specified 'element' a value to be passed to
+        // 'putContentsEnd' once the contents of the element are written.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    int putContentsEnd(int element);
+        // Complete the constructed element indicated by the specified
+        // 'element', as loaded by 'putContentsLength', whose contents were
+        // just written: write end-of-contents octets for the indefinite form,
+        // or record the length of the contents during the first pass of the
+        // definite form.  Return 0 on success, and a non-zero value otherwise.
+
+    template <typename TYPE>
+    int encodeWithDefiniteLengths(const TYPE& value);
+        // Encode the specified 'value' to 'd_streamBuf' using the definite
+        // form of length octets for each constructed element, in two passes.
+        // Return 0 on success, and a non-zero value otherwise.
+
     int encodeImpl(const bsl::vector<char>&  value,
                    BerConstants::TagClass    tagClass,
                    int                       tagNumber,
@@ -745,6 +845,9 @@ int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
         rc = visitor(value);
         d_options = 0;
     }
+    else if (d_options->encodeDefiniteLengths()) {
+        rc = encodeWithDefiniteLengths(value);
+    }
     else {
         BerEncoder_UniversalElementVisitor visitor(
                                               this,
@@ -774,6 +877,46 @@ int BerEncoder::encode(bsl::ostream& stream, const TYPE& value)
 }
 
 // PRIVATE MANIPULATORS
+template <typename TYPE>
+int BerEncoder::encodeWithDefiniteLengths(const TYPE& value)
+{
+    bsl::streambuf *streamBuf = d_streamBuf;
+    int             rc;
+
+    // First pass: record the length of each constructed element.
+
+    d_lengths.clear();
+    {
+        CountingStreamBuf counter;
+
+        d_streamBuf  = &counter;
+        d_lengthMode = e_MEASURE_LENGTHS;
+
+        BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+        rc = visitor(value);
+    }
+
+    // Second pass: write the encoding.
+
+    d_streamBuf = streamBuf;
+    if (0 == rc) {
+        d_lengthMode = e_DEFINITE_LENGTHS;
+        d_nextLength = 0;
+
+        BerEncoder_UniversalElementVisitor visitor(
+                                              this,
+                                              bdlat_FormattingMode::e_DEFAULT);
+        rc = visitor(value);
+
+        BSLS_ASSERT(0 != rc || d_lengths.size() == d_nextLength);
+    }
+
+    d_lengthMode = e_INDEFINITE_LENGTHS;
+    return rc;
+}
+
 template <typename TYPE>
 int BerEncoder::encodeImpl(const TYPE&                value,
                            BerConstants::TagClass     tagClass,
@@ -785,17 +928,19 @@ int BerEncoder::encodeImpl(const TYPE&                value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
+    int element;
     int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+    if (rc | putContentsLength(&element)) {
         return k_FAILURE;                                             // RETURN
     }
 
     const bool isUntagged = formattingMode
                           & bdlat_FormattingMode::e_UNTAGGED;
 
+    int innerElement = 0;
     if (!isUntagged) {
         // According to X.694 (clause 20.4), an XML choice (not anonymous)
         // element is encoded as a sequence with 1 element.
@@ -804,7 +949,7 @@ int BerEncoder::encodeImpl(const TYPE&                value,
                                           BerConstants::e_CONTEXT_SPECIFIC,
                                           tagType,
                                           0);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | putContentsLength(&innerElement)) {
             return k_FAILURE;
         }
     }
@@ -827,10 +972,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // Don't waste time checking the result of this call -- the only thing
         // that can go wrong is eof, which will happen again when we call it
         // again below.
-        BerUtil::putEndOfContentOctets(d_streamBuf);
+        putContentsEnd(innerElement);
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return putContentsEnd(element);
 }
 
 template <typename TYPE>
@@ -848,11 +993,12 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
 
         // nillable is encoded in BER as a sequence with one optional element
 
+        int element;
         int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                               tagClass,
                                               BerConstants::e_CONSTRUCTED,
                                               tagNumber);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        if (rc | putContentsLength(&element)) {
             return k_FAILURE;
         }
 
@@ -870,7 +1016,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
             }
         } // end of bdlat_NullableValueFunctions::isNull(...)
 
-        return BerUtil::putEndOfContentOctets(d_streamBuf);
+        return putContentsEnd(element);
     } // end of isNillable
 
     if (!bdlat_NullableValueFunctions::isNull(value)) {
@@ -940,17 +1086,18 @@ int BerEncoder::encodeImpl(const TYPE&                  value,
 {
     BerEncoder_Visitor visitor(this);
 
+    int element;
     int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                           tagClass,
                                           BerConstants::e_CONSTRUCTED,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= putContentsLength(&element);
     if (rc) {
         return rc;
     }
 
     rc = bdlat_SequenceFunctions::accessAttributes(value, visitor);
-    rc |= BerUtil::putEndOfContentOctets(d_streamBuf);
+    rc |= putContentsEnd(element);
 
     return rc;
 }
@@ -1008,11 +1155,12 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
+    int element;
     int rc = BerUtil::putIdentifierOctets(d_streamBuf,
                                           tagClass,
                                           tagType,
                                           tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    rc |= putContentsLength(&element);
     if (rc) {
         return k_FAILURE;                                             // RETURN
     }
@@ -1031,7 +1179,7 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
         }
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return putContentsEnd(element);
 }
 
 template <typename TYPE>
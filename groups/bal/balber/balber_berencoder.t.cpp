@@ -18,6 +18,7 @@
 #include <bdlat_valuetypefunctions.h>
 #include <bdlat_sequencefunctions.h>
 
+#include <bdlsb_fixedmemoutstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 
@@ -207,6 +208,129 @@ void printDiagnostic(balber::BerEncoder & encoder)
     }
 }
 
+template <class TYPE>
+int encodeToString(bsl::string        *result,
+                   balber::BerEncoder *encoder,
+                   const TYPE&         value)
+    // Load into the specified 'result' the encoding of the specified 'value'
+    // by the specified 'encoder'.  Return the value returned by 'encode'.
+{
+    bdlsb::MemOutStreamBuf osb;
+
+    const int rc = encoder->encode(&osb, value);
+    result->assign(osb.data(), osb.length());
+    return rc;
+}
+
+int stripElement(bsl::string  *result,
+                 int          *numIndefinite,
+                 const char  **position,
+                 const char   *end)
+    // Append to the specified 'result' the identifier octets and contents
+    // octets, but not the length octets or end-of-contents octets, of the BER
+    // element at the specified '*position' and preceding the specified 'end',
+    // recursively for the elements of a constructed element, which are
+    // delimited by '{' and '}' in 'result'; increment the specified
+    // 'numIndefinite' for each element encoded with the indefinite form of
+    // length octets; and advance '*position' to the end of the element.
+    // Return 0 on success, and a non-zero value if the element is not valid.
+{
+    const char *p = *position;
+
+    if (p == end) {
+        return -1;                                                    // RETURN
+    }
+
+    const bool constructed = *p & 0x20;
+    bool       moreOctets  = 0x1f == (*p & 0x1f);
+
+    result->push_back(*p++);
+    while (moreOctets) {
+        if (p == end) {
+            return -1;                                                // RETURN
+        }
+        moreOctets = *p & 0x80;
+        result->push_back(*p++);
+    }
+
+    if (p == end) {
+        return -1;                                                    // RETURN
+    }
+
+    const unsigned char lengthOctet = *p++;
+
+    if (0x80 == lengthOctet) {
+        if (!constructed) {
+            return -1;                                                // RETURN
+        }
+        ++*numIndefinite;
+
+        result->push_back('{');
+        while (end - p < 2 || 0 != p[0] || 0 != p[1]) {
+            if (stripElement(result, numIndefinite, &p, end)) {
+                return -1;                                            // RETURN
+            }
+        }
+        result->push_back('}');
+
+        *position = p + 2;
+        return 0;                                                     // RETURN
+    }
+
+    int length = lengthOctet;
+    if (lengthOctet & 0x80) {
+        const int numOctets = lengthOctet & 0x7f;
+        if (end - p < numOctets || numOctets > 3) {
+            return -1;                                                // RETURN
+        }
+        length = 0;
+        for (int i = 0; i < numOctets; ++i) {
+            length = length * 256 + static_cast<unsigned char>(*p++);
+        }
+    }
+
+    if (end - p < length) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *contentsEnd = p + length;
+    if (constructed) {
+        result->push_back('{');
+        while (p != contentsEnd) {
+            if (stripElement(result, numIndefinite, &p, contentsEnd)) {
+                return -1;                                            // RETURN
+            }
+        }
+        result->push_back('}');
+    }
+    else {
+        result->append(p, contentsEnd);
+    }
+
+    *position = contentsEnd;
+    return 0;
+}
+
+int stripLengths(bsl::string *result,
+                 int         *numIndefinite,
+                 const char  *data,
+                 int          length)
+    // Load into the specified 'result' the identifier octets and contents
+    // octets of the single BER element in the specified 'data' having the
+    // specified 'length', as described for 'stripElement', and load into the
+    // specified 'numIndefinite' the number of elements encoded with the
+    // indefinite form of length octets.  Return 0 on success, and a non-zero
+    // value if 'data' does not hold exactly one valid element.
+{
+    const char *position = data;
+
+    result->clear();
+    *numIndefinite = 0;
+
+    return stripElement(result, numIndefinite, &position, data + length)
+        || position != data + length;
+}
+
 // ============================================================================
 //                     GLOBAL HELPER CLASSES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -9367,7 +9491,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -9391,6 +9515,212 @@ int main(int argc, char *argv[])
         usageExample();
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'encodeDefiniteLengths' OPTION
+        //
+        // Concerns:
+        //: 1 If the 'encodeDefiniteLengths' option is set, every constructed
+        //:   element is encoded with the definite form of length octets, and
+        //:   no end-of-contents octets are written.
+        //:
+        //: 2 The length of each element is the length of its contents,
+        //:   including lengths of 128 octets or more.
+        //:
+        //: 3 The identifier and contents octets of each element are the same
+        //:   as those written with the indefinite form, for sequences,
+        //:   choices (tagged or not), arrays (empty or not), and nullable and
+        //:   nillable values.
+        //:
+        //: 4 An encoder may encode several objects, and an encoder that
+        //:   failed to write the second pass encodes the next object
+        //:   correctly.
+        //
+        // Plan:
+        //: 1 Encode a set of objects, with and without the option set.
+        //:   Parse each encoding, verifying that each element is well formed,
+        //:   and strip its length and end-of-contents octets.  Verify that
+        //:   the encodings written with the option have no element of
+        //:   indefinite length, and strip to the same octets as the encodings
+        //:   written without it.  (C-1..3)
+        //:
+        //: 2 Encode each object twice with the same encoder, and verify that
+        //:   the encodings are equal.  (C-4)
+        //:
+        //: 3 Encode an object to a stream buffer too small to hold it, then
+        //:   encode it to a large enough stream buffer with the same encoder,
+        //:   and verify the encoding.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: 'encodeDefiniteLengths' option
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING 'encodeDefiniteLengths' OPTION"
+                               << "\n======================================"
+                               << bsl::endl;
+
+        balber::BerEncoderOptions indefiniteOptions;
+        balber::BerEncoderOptions definiteOptions;
+        indefiniteOptions.setEncodeEmptyArrays(true);
+        definiteOptions.setEncodeEmptyArrays(true);
+        definiteOptions.setEncodeDefiniteLengths(true);
+
+        ASSERT(!indefiniteOptions.encodeDefiniteLengths());
+        ASSERT( definiteOptions.encodeDefiniteLengths());
+
+        test::BasicRecord basicRec;
+        basicRec.i1() = 11;
+        basicRec.i2() = 22;
+        basicRec.dt() = bdlt::DatetimeTz(
+                                  bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                                 bdlt::Time(16, 30)), 0);
+        basicRec.s()  = "The quick brown fox jumped over the lazy dog.";
+
+        enum { k_NUM_REQUESTS = 5 };
+        const int ARRAY_SIZES[k_NUM_REQUESTS] = { 0, 1, 2, 10, 1000 };
+
+        bsl::vector<test::TimingRequest> requests(k_NUM_REQUESTS + 2);
+        requests[0].makeSqrt().value() = 3.1415927;
+        requests[1].makeBasic(basicRec);
+        for (int i = 0; i < k_NUM_REQUESTS; ++i) {
+            test::BigRecord& bigRec = requests[i + 2].makeBig();
+            bigRec.name() = "This record is so big, it has its own gravity.";
+            bigRec.array().assign(ARRAY_SIZES[i], basicRec);
+        }
+
+        test::MyChoice choice;
+        choice.makeSelection2("selection");
+
+        test::MySequenceWithAnonymousChoice anonymousChoice;
+        anonymousChoice.attribute1() = 7;
+        anonymousChoice.choice().makeMyChoice2("untagged");
+        anonymousChoice.attribute2() = "attribute";
+
+        test::MySequenceWithNullable nullable;
+        nullable.attribute1() = 5;
+        test::MySequenceWithNullable nonNull(nullable);
+        nonNull.attribute2().makeValue("value");
+
+        test::MySequenceWithNillable nillable;
+        nillable.attribute1() = 5;
+        nillable.attribute2() = "attribute";
+        test::MySequenceWithNillable nonNil(nillable);
+        nonNil.myNillable().makeValue("value");
+
+        test::MySequenceWithArray emptyArray;
+        emptyArray.attribute1() = 3;
+        test::MySequenceWithArray array(emptyArray);
+        array.attribute2().assign(300, bsl::string("element"));
+
+        bsl::vector<bsl::string> indefiniteEncodings;
+        bsl::vector<bsl::string> definiteEncodings;
+
+        for (int mode = 0; mode < 2; ++mode) {
+            balber::BerEncoder testEncoder(mode ? &definiteOptions
+                                                : &indefiniteOptions);
+
+            bsl::vector<bsl::string>& encodings = mode ? definiteEncodings
+                                                       : indefiniteEncodings;
+
+            for (int pass = 0; pass < 2; ++pass) {
+                // Encode each object twice with the same encoder.
+
+                bsl::vector<bsl::string> results(requests.size() + 8);
+
+                int n = 0;
+                for (int i = 0; i < static_cast<int>(requests.size()); ++i) {
+                    ASSERTV(mode, i, 0 == encodeToString(&results[n++],
+                                                         &testEncoder,
+                                                         requests[i]));
+                }
+                ASSERT(0 == encodeToString(&results[n++],
+                                           &testEncoder,
+                                           choice));
+                ASSERT(0 == encodeToString(&results[n++],
+                                           &testEncoder,
+                                           anonymousChoice));
+                ASSERT(0 == encodeToString(&results[n++],
+                                           &testEncoder,
+                                           nullable));
+                ASSERT(0 == encodeToString(&results[n++],
+                                           &testEncoder,
+                                           nonNull));
+                ASSERT(0 == encodeToString(&results[n++],
+                                           &testEncoder,
+                                           nillable));
+                ASSERT(0 == encodeToString(&results[n++],
+                                           &testEncoder,
+                                           nonNil));
+                ASSERT(0 == encodeToString(&results[n++],
+                                           &testEncoder,
+                                           emptyArray));
+                ASSERT(0 == encodeToString(&results[n++],
+                                           &testEncoder,
+                                           array));
+                printDiagnostic(testEncoder);
+
+                if (0 == pass) {
+                    encodings = results;
+                }
+                else {
+                    ASSERTV(mode, encodings == results);
+                }
+            }
+        }
+
+        ASSERT(indefiniteEncodings.size() == definiteEncodings.size());
+
+        for (int i = 0; i < static_cast<int>(definiteEncodings.size()); ++i) {
+            const bsl::string& INDEFINITE = indefiniteEncodings[i];
+            const bsl::string& DEFINITE   = definiteEncodings[i];
+
+            const int INDEFINITE_LENGTH =
+                                       static_cast<int>(INDEFINITE.length());
+            const int DEFINITE_LENGTH   = static_cast<int>(DEFINITE.length());
+
+            if (veryVerbose) {
+                P_(i) P_(INDEFINITE_LENGTH) P(DEFINITE_LENGTH)
+                printBuffer(DEFINITE.data(), DEFINITE_LENGTH);
+            }
+
+            bsl::string indefiniteStripped;
+            bsl::string definiteStripped;
+            int         numIndefinite;
+
+            ASSERTV(i, 0 == stripLengths(&indefiniteStripped,
+                                         &numIndefinite,
+                                         INDEFINITE.data(),
+                                         INDEFINITE_LENGTH));
+            ASSERTV(i, numIndefinite, 0 < numIndefinite);
+
+            ASSERTV(i, 0 == stripLengths(&definiteStripped,
+                                         &numIndefinite,
+                                         DEFINITE.data(),
+                                         DEFINITE_LENGTH));
+            ASSERTV(i, numIndefinite, 0 == numIndefinite);
+
+            ASSERTV(i, indefiniteStripped == definiteStripped);
+            ASSERTV(i, DEFINITE_LENGTH <= INDEFINITE_LENGTH);
+        }
+
+        if (verbose) bsl::cout << "\nTesting failure of the second pass."
+                               << bsl::endl;
+        {
+            balber::BerEncoder testEncoder(&definiteOptions);
+
+            const bsl::string& EXPECTED = definiteEncodings[3];
+
+            char                        buffer[16];
+            bdlsb::FixedMemOutStreamBuf fosb(buffer, sizeof buffer);
+
+            ASSERT(EXPECTED.length() > sizeof buffer);
+            ASSERT(0 != testEncoder.encode(&fosb, requests[3]));
+
+            bsl::string result;
+            ASSERT(0 == encodeToString(&result, &testEncoder, requests[3]));
+            ASSERT(EXPECTED == result);
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING 'encode' for date/time components
@@ -12067,6 +12397,29 @@ int main(int argc, char *argv[])
                   << elapsed          << " seconds, "
                   << (reps / elapsed) << " reps/sec, "
                   << osb.length()     << " bytes" << bsl::endl;
+
+        // Measure ber encoding times with definite lengths:
+        balber::BerEncoderOptions options;
+        options.setEncodeDefiniteLengths(true);
+
+        stopwatch.reset();
+        stopwatch.start();
+        for (int i = 0; i < reps; ++i) {
+            osb.pubseekpos(0);
+            balber::BerEncoder encoder(&options);
+            encoder.encode(&osb, request);
+        }
+        stopwatch.stop();
+
+        ASSERT(minOutputSize     <= (int)osb.length());
+        ASSERT((int)osb.length() <= MAX_BUF_SIZE);
+        elapsed = stopwatch.elapsedTime();
+        ASSERT(elapsed > 0);
+
+        bsl::cout << "    balber::BerEncoder (definite lengths): "
+                  << elapsed          << " seconds, "
+                  << (reps / elapsed) << " reps/sec, "
+                  << osb.length()     << " bytes" << bsl::endl;
       } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
@@ -42,6 +42,8 @@ const bool balber::BerEncoderOptions::
               DEFAULT_INITIALIZER_ENCODE_EMPTY_ARRAYS                  = true;
 const bool balber::BerEncoderOptions::
               DEFAULT_INITIALIZER_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY = false;
+const bool balber::BerEncoderOptions::
+              DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTHS              = false;
 const bdlat_AttributeInfo balber::BerEncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
     {
         e_ATTRIBUTE_ID_TRACE_LEVEL,
@@ -70,6 +72,13 @@ const bdlat_AttributeInfo balber::BerEncoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
         sizeof("EncodeDateAndTimeTypesAsBinary") - 1,
         "",
         bdlat_FormattingMode::e_TEXT
+    },
+    {
+        e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTHS,
+        "EncodeDefiniteLengths",
+        sizeof("EncodeDefiniteLengths") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
     }
 };
 
@@ -148,6 +157,32 @@ const bdlat_AttributeInfo *BerEncoderOptions::lookupAttributeInfo(
                                     e_ATTRIBUTE_INDEX_BDE_VERSION_CONFORMANCE];
                                                                       // RETURN
             }
+            if (name[0]=='E'
+             && name[1]=='n'
+             && name[2]=='c'
+             && name[3]=='o'
+             && name[4]=='d'
+             && name[5]=='e'
+             && name[6]=='D'
+             && name[7]=='e'
+             && name[8]=='f'
+             && name[9]=='i'
+             && name[10]=='n'
+             && name[11]=='i'
+             && name[12]=='t'
+             && name[13]=='e'
+             && name[14]=='L'
+             && name[15]=='e'
+             && name[16]=='n'
+             && name[17]=='g'
+             && name[18]=='t'
+             && name[19]=='h'
+             && name[20]=='s')
+            {
+                return &ATTRIBUTE_INFO_ARRAY[
+                                    e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTHS];
+                                                                      // RETURN
+            }
         } break;
         case 30: {
             if (name[0]=='E'
@@ -203,6 +238,9 @@ const bdlat_AttributeInfo *BerEncoderOptions::lookupAttributeInfo(int id)
       case e_ATTRIBUTE_ID_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY:
         return &ATTRIBUTE_INFO_ARRAY[
                        e_ATTRIBUTE_INDEX_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY];
+      case e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTHS:
+        return &ATTRIBUTE_INFO_ARRAY[
+                                    e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTHS];
       default:
         return 0;
     }
@@ -216,6 +254,7 @@ BerEncoderOptions::BerEncoderOptions()
 , d_encodeEmptyArrays(DEFAULT_INITIALIZER_ENCODE_EMPTY_ARRAYS)
 , d_encodeDateAndTimeTypesAsBinary(
                       DEFAULT_INITIALIZER_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY)
+, d_encodeDefiniteLengths(DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTHS)
 {
 }
 
@@ -224,6 +263,7 @@ BerEncoderOptions::BerEncoderOptions(const BerEncoderOptions& original)
 , d_bdeVersionConformance(original.d_bdeVersionConformance)
 , d_encodeEmptyArrays(original.d_encodeEmptyArrays)
 , d_encodeDateAndTimeTypesAsBinary(original.d_encodeDateAndTimeTypesAsBinary)
+, d_encodeDefiniteLengths(original.d_encodeDefiniteLengths)
 {
 }
 
@@ -242,6 +282,7 @@ BerEncoderOptions::operator=(const BerEncoderOptions& rhs)
         d_encodeEmptyArrays              = rhs.d_encodeEmptyArrays;
         d_encodeDateAndTimeTypesAsBinary =
                                           rhs.d_encodeDateAndTimeTypesAsBinary;
+        d_encodeDefiniteLengths          = rhs.d_encodeDefiniteLengths;
     }
     return *this;
 }
@@ -253,6 +294,7 @@ void BerEncoderOptions::reset()
     d_encodeEmptyArrays     = DEFAULT_INITIALIZER_ENCODE_EMPTY_ARRAYS;
     d_encodeDateAndTimeTypesAsBinary =
                       DEFAULT_INITIALIZER_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY;
+    d_encodeDefiniteLengths = DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTHS;
 }
 
 // ACCESSORS
@@ -304,6 +346,13 @@ bsl::ostream& BerEncoderOptions::print(
                                   -levelPlus1,
                                   spacesPerLevel);
 
+        bdlb::Print::indent(stream, levelPlus1, spacesPerLevel);
+        stream << "EncodeDefiniteLengths = ";
+        bdlb::PrintMethods::print(stream,
+                                  d_encodeDefiniteLengths,
+                                  -levelPlus1,
+                                  spacesPerLevel);
+
         bdlb::Print::indent(stream, level, spacesPerLevel);
         stream << "]\n";
     }
@@ -336,6 +385,12 @@ bsl::ostream& BerEncoderOptions::print(
                                   -levelPlus1,
                                   spacesPerLevel);
 
+        stream << ' ';
+        stream << "EncodeDefiniteLengths = ";
+        bdlb::PrintMethods::print(stream, d_encodeDefiniteLengths,
+                                  -levelPlus1,
+                                  spacesPerLevel);
+
         stream << " ]";
     }
 
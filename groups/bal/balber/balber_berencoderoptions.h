@@ -103,6 +103,13 @@ class BerEncoderOptions {
         // encoded as binary integers.  By default these types are encoded as
         // strings in the ISO 8601 format.
 
+    bool d_encodeDefiniteLengths;
+        // This option allows users to control if constructed elements (i.e.,
+        // sequences, choices, arrays, and nillable values) are encoded with
+        // the definite form of length octets, rather than the indefinite form
+        // followed by end-of-contents octets.  By default the indefinite form
+        // is used.
+
   public:
     // TYPES
     enum {
@@ -110,10 +117,11 @@ class BerEncoderOptions {
       , e_ATTRIBUTE_ID_BDE_VERSION_CONFORMANCE              = 1
       , e_ATTRIBUTE_ID_ENCODE_EMPTY_ARRAYS                  = 2
       , e_ATTRIBUTE_ID_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY = 3
+      , e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTHS              = 4
     };
 
     enum {
-        k_NUM_ATTRIBUTES = 4
+        k_NUM_ATTRIBUTES = 5
     };
 
     enum {
@@ -121,6 +129,7 @@ class BerEncoderOptions {
       , e_ATTRIBUTE_INDEX_BDE_VERSION_CONFORMANCE              = 1
       , e_ATTRIBUTE_INDEX_ENCODE_EMPTY_ARRAYS                  = 2
       , e_ATTRIBUTE_INDEX_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY = 3
+      , e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTHS              = 4
     };
 
     // CONSTANTS
@@ -129,6 +138,7 @@ class BerEncoderOptions {
     static const int  DEFAULT_INITIALIZER_BDE_VERSION_CONFORMANCE;
     static const bool DEFAULT_INITIALIZER_ENCODE_EMPTY_ARRAYS;
     static const bool DEFAULT_INITIALIZER_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY;
+    static const bool DEFAULT_INITIALIZER_ENCODE_DEFINITE_LENGTHS;
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -236,6 +246,15 @@ class BerEncoderOptions {
         // incompatible with the string encoding format and must be used after
         // ensuring that the ber decoder can decode the binary format.
 
+    void setEncodeDefiniteLengths(bool value);
+        // Set the 'EncodeDefiniteLengths' attribute of this object to the
+        // specified 'value'.  If this option is set to 'true' then the length
+        // of each constructed element is computed before the element is
+        // written, and is encoded in the definite form (as required by the
+        // Distinguished Encoding Rules), as opposed to the indefinite form
+        // terminated by end-of-contents octets.  Note that 'BerDecoder'
+        // decodes both forms.
+
     // ACCESSORS
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
@@ -306,6 +325,10 @@ class BerEncoderOptions {
     bool encodeDateAndTimeTypesAsBinary() const;
         // Return a reference to the non-modifiable
         // 'EncodeDateAndTimeTypesAsBinary' attribute of this object.
+
+    bool encodeDefiniteLengths() const;
+        // Return a reference to the non-modifiable 'EncodeDefiniteLengths'
+        // attribute of this object.
 };
 
 // FREE OPERATORS
@@ -369,6 +392,9 @@ STREAM& BerEncoderOptions::bdexStreamIn(STREAM& stream, int version)
                                               stream,
                                               d_encodeDateAndTimeTypesAsBinary,
                                               1);
+            bslx::InStreamFunctions::bdexStreamIn(stream,
+                                                  d_encodeDefiniteLengths,
+                                                  1);
           } break;
           default: {
             stream.invalidate();
@@ -410,6 +436,13 @@ int BerEncoderOptions::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;                                                   // RETURN
     }
 
+    ret = manipulator(
+              &d_encodeDefiniteLengths,
+              ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTHS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -440,6 +473,11 @@ int BerEncoderOptions::manipulateAttribute(MANIPULATOR& manipulator, int id)
                       ATTRIBUTE_INFO_ARRAY[
                       e_ATTRIBUTE_INDEX_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY]);
       } break;
+      case e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTHS: {
+        return manipulator(
+              &d_encodeDefiniteLengths,
+              ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTHS]);
+      } break;
       default:
         return k_NOT_FOUND;
     }
@@ -485,6 +523,12 @@ void BerEncoderOptions::setEncodeDateAndTimeTypesAsBinary(bool value)
     d_encodeDateAndTimeTypesAsBinary = value;
 }
 
+inline
+void BerEncoderOptions::setEncodeDefiniteLengths(bool value)
+{
+    d_encodeDefiniteLengths = value;
+}
+
 // ACCESSORS
 template <class STREAM>
 STREAM& BerEncoderOptions::bdexStreamOut(STREAM& stream, int version) const
@@ -504,6 +548,9 @@ STREAM& BerEncoderOptions::bdexStreamOut(STREAM& stream, int version) const
                                               stream,
                                               d_encodeDateAndTimeTypesAsBinary,
                                               1);
+        bslx::OutStreamFunctions::bdexStreamOut(stream,
+                                                d_encodeDefiniteLengths,
+                                                1);
       } break;
       default: {
         stream.invalidate();
@@ -544,6 +591,13 @@ int BerEncoderOptions::accessAttributes(ACCESSOR& accessor) const
         return ret;                                                   // RETURN
     }
 
+    ret = accessor(d_encodeDefiniteLengths,
+                   ATTRIBUTE_INFO_ARRAY[
+                                   e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTHS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -573,6 +627,11 @@ int BerEncoderOptions::accessAttribute(ACCESSOR& accessor, int id) const
                       ATTRIBUTE_INFO_ARRAY[
                       e_ATTRIBUTE_INDEX_ENCODE_DATE_AND_TIME_TYPES_AS_BINARY]);
       } break;
+      case e_ATTRIBUTE_ID_ENCODE_DEFINITE_LENGTHS: {
+        return accessor(d_encodeDefiniteLengths,
+                        ATTRIBUTE_INFO_ARRAY[
+                                   e_ATTRIBUTE_INDEX_ENCODE_DEFINITE_LENGTHS]);
+      } break;
       default:
         return k_NOT_FOUND;
     }
@@ -617,6 +676,12 @@ bool BerEncoderOptions::encodeDateAndTimeTypesAsBinary() const
 {
     return d_encodeDateAndTimeTypesAsBinary;
 }
+
+inline
+bool BerEncoderOptions::encodeDefiniteLengths() const
+{
+    return d_encodeDefiniteLengths;
+}
 }  // close package namespace
 
 
@@ -630,7 +695,9 @@ bool balber::operator==(const BerEncoderOptions& lhs,
          && lhs.bdeVersionConformance()          == rhs.bdeVersionConformance()
          && lhs.encodeEmptyArrays()              == rhs.encodeEmptyArrays()
          && lhs.encodeDateAndTimeTypesAsBinary() ==
-                                          rhs.encodeDateAndTimeTypesAsBinary();
+                                          rhs.encodeDateAndTimeTypesAsBinary()
+         && lhs.encodeDefiniteLengths()          ==
+                                          rhs.encodeDefiniteLengths();
 }
 
 inline
@@ -641,7 +708,9 @@ bool balber::operator!=(const BerEncoderOptions& lhs,
          || lhs.bdeVersionConformance()          != rhs.bdeVersionConformance()
          || lhs.encodeEmptyArrays()              != rhs.encodeEmptyArrays()
          || lhs.encodeDateAndTimeTypesAsBinary() !=
-                                          rhs.encodeDateAndTimeTypesAsBinary();
+                                          rhs.encodeDateAndTimeTypesAsBinary()
+         || lhs.encodeDefiniteLengths()          !=
+                                          rhs.encodeDefiniteLengths();
 }
 
 inline
@@ -58,6 +58,14 @@ BSLS_IDENT("$Id: $")
 //                                     TEXT             e_BER_UTF8_STRING
 //                                     BASE64           e_BER_OCTET_STRING
 //                                     HEX              e_BER_OCTET_STRING
+//  bsl::basic_inplace_string<char, N> DEFAULT          e_BER_UTF8_STRING
+//                                     TEXT             e_BER_UTF8_STRING
+//                                     BASE64           e_BER_OCTET_STRING
+//                                     HEX              e_BER_OCTET_STRING
+//  bslstl::StringRef                  DEFAULT          e_BER_UTF8_STRING
+//                                     TEXT             e_BER_UTF8_STRING
+//                                     BASE64           e_BER_OCTET_STRING
+//                                     HEX              e_BER_OCTET_STRING
 //  bdlt::Date                         DEFAULT          e_BER_VISIBLE_STRING
 //  bdlt::DateTz                       DEFAULT          e_BER_VISIBLE_STRING
 //  bdlt::Datetime                     DEFAULT          e_BER_VISIBLE_STRING
@@ -142,6 +150,14 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_variant.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_INPLACESTRING
+#include <bslstl_inplacestring.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -296,6 +312,10 @@ class BerUniversalTagNumber_Imp {
     TagVal select(const float&             object, bdlat_TypeCategory::Simple);
     TagVal select(const double&            object, bdlat_TypeCategory::Simple);
     TagVal select(const bsl::string&       object, bdlat_TypeCategory::Simple);
+    template <bsl::size_t CAPACITY>
+    TagVal select(const bsl::basic_inplace_string<char, CAPACITY>&
+                                           object, bdlat_TypeCategory::Simple);
+    TagVal select(const bslstl::StringRef& object, bdlat_TypeCategory::Simple);
     TagVal select(const bdlt::Date&        object, bdlat_TypeCategory::Simple);
     TagVal select(const bdlt::DateTz&      object, bdlat_TypeCategory::Simple);
     TagVal select(const bdlt::Datetime&    object, bdlat_TypeCategory::Simple);
@@ -678,6 +698,42 @@ BerUniversalTagNumber_Imp::select(const bsl::string&        ,
     return BerUniversalTagNumber::e_BER_UTF8_STRING;
 }
 
+template <bsl::size_t CAPACITY>
+inline
+BerUniversalTagNumber::Value
+BerUniversalTagNumber_Imp::select(
+                              const bsl::basic_inplace_string<char, CAPACITY>&,
+                              bdlat_TypeCategory::Simple)
+{
+    if (FMode::e_BASE64 == (d_formattingMode & FMode::e_TYPE_MASK)
+     || FMode::e_HEX    == (d_formattingMode & FMode::e_TYPE_MASK)) {
+        return BerUniversalTagNumber::e_BER_OCTET_STRING;
+    }
+
+    BSLS_ASSERT_SAFE(
+          FMode::e_DEFAULT == (d_formattingMode & FMode::e_TYPE_MASK)
+       || FMode::e_TEXT    == (d_formattingMode & FMode::e_TYPE_MASK));
+
+    return BerUniversalTagNumber::e_BER_UTF8_STRING;
+}
+
+inline
+BerUniversalTagNumber::Value
+BerUniversalTagNumber_Imp::select(const bslstl::StringRef&  ,
+                                  bdlat_TypeCategory::Simple)
+{
+    if (FMode::e_BASE64 == (d_formattingMode & FMode::e_TYPE_MASK)
+     || FMode::e_HEX    == (d_formattingMode & FMode::e_TYPE_MASK)) {
+        return BerUniversalTagNumber::e_BER_OCTET_STRING;
+    }
+
+    BSLS_ASSERT_SAFE(
+          FMode::e_DEFAULT == (d_formattingMode & FMode::e_TYPE_MASK)
+       || FMode::e_TEXT    == (d_formattingMode & FMode::e_TYPE_MASK));
+
+    return BerUniversalTagNumber::e_BER_UTF8_STRING;
+}
+
 inline
 BerUniversalTagNumber::Value
 BerUniversalTagNumber_Imp::select(const bdlt::Date&          ,
@@ -2188,6 +2188,8 @@ int main(int argc, char *argv[])
         typedef bsls::Types::Int64 int64;
         typedef bsls::Types::Uint64 uint64;
         typedef bsl::vector<char> vectorChar;
+        typedef bsl::basic_inplace_string<char, 32> inplaceString;
+        typedef bslstl::StringRef stringRef;
         typedef test::CustomizedString CustString;
         typedef test::MyEnumeration::Value MyEnum;
         typedef bdlb::Variant2<bdlt::Date, bdlt::DateTz>       DateVariant;
@@ -2334,6 +2336,38 @@ int main(int argc, char *argv[])
                                  FM::e_HEX,
                                  Class::e_BER_OCTET_STRING,
                                  &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(inplaceString,
+                                 FM::e_DEFAULT,
+                                 Class::e_BER_UTF8_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(inplaceString,
+                                 FM::e_TEXT,
+                                 Class::e_BER_UTF8_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(inplaceString,
+                                 FM::e_BASE64,
+                                 Class::e_BER_OCTET_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(inplaceString,
+                                 FM::e_HEX,
+                                 Class::e_BER_OCTET_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(stringRef,
+                                 FM::e_DEFAULT,
+                                 Class::e_BER_UTF8_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(stringRef,
+                                 FM::e_TEXT,
+                                 Class::e_BER_UTF8_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(stringRef,
+                                 FM::e_BASE64,
+                                 Class::e_BER_OCTET_STRING,
+                                 &otherTag);
+        TEST_SELECT_WITH_ALT_TAG(stringRef,
+                                 FM::e_HEX,
+                                 Class::e_BER_OCTET_STRING,
+                                 &otherTag);
         TEST_SELECT_WITH_ALT_TAG(vectorChar,
                                  FM::e_DEFAULT,
                                  Class::e_BER_OCTET_STRING,
@@ -25,7 +25,10 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides utility functions for encoding and
 // decoding of primitive BER constructs, such as tag identifier octets, length
 // octets, fundamental C++ types.  The encoding and decoding of 'bsl::string'
-// and BDE date/time types is also implemented.
+// and BDE date/time types is also implemented.  A
+// 'bsl::basic_inplace_string<char, N>' is encoded exactly like a
+// 'bsl::string'; decoding into it fails if the encoded value is longer than
+// 'N' characters.
 //
 // These utility functions operate on 'bsl::streambuf' for buffer management.
 //
@@ -126,6 +129,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_INPLACESTRING
+#include <bslstl_inplacestring.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -383,6 +390,11 @@ struct BerUtil_Imp {
     static int getValue(bsl::streambuf               *streamBuf,
                         bslstl::StringRef            *value,
                         int                           length);
+    template <bsl::size_t CAPACITY>
+    static int getValue(
+                      bsl::streambuf                            *streamBuf,
+                      bsl::basic_inplace_string<char, CAPACITY> *value,
+                      int                                        length);
     static int getValue(bsl::streambuf               *streamBuf,
                         bdlt::Date                   *value,
                         int                           length);
@@ -499,6 +511,11 @@ struct BerUtil_Imp {
     static int putValue(bsl::streambuf          *streamBuf,
                         const bslstl::StringRef& value,
                         const BerEncoderOptions *options);
+    template <bsl::size_t CAPACITY>
+    static int putValue(
+                    bsl::streambuf                                  *streamBuf,
+                    const bsl::basic_inplace_string<char, CAPACITY>& value,
+                    const BerEncoderOptions                         *options);
     static int putValue(bsl::streambuf          *streamBuf,
                         const bdlt::Date&        value,
                         const BerEncoderOptions *options);
@@ -1130,6 +1147,41 @@ int BerUtil_Imp::putValue(bsl::streambuf           *streamBuf,
                           static_cast<int>(value.length()));
 }
 
+template <bsl::size_t CAPACITY>
+inline
+int BerUtil_Imp::putValue(
+                    bsl::streambuf                                  *streamBuf,
+                    const bsl::basic_inplace_string<char, CAPACITY>& value,
+                    const BerEncoderOptions                         *)
+{
+    return putStringValue(streamBuf,
+                          value.data(),
+                          static_cast<int>(value.length()));
+}
+
+template <bsl::size_t CAPACITY>
+int BerUtil_Imp::getValue(
+                      bsl::streambuf                            *streamBuf,
+                      bsl::basic_inplace_string<char, CAPACITY> *value,
+                      int                                        length)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    if (length < 0 || static_cast<bsl::size_t>(length) > CAPACITY) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    value->resize(length);
+    if (0 == length) {
+        return k_SUCCESS;                                             // RETURN
+    }
+
+    const int bytesConsumed = static_cast<int>(
+                                      streamBuf->sgetn(&(*value)[0], length));
+
+    return length == bytesConsumed ? k_SUCCESS : k_FAILURE;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 #endif
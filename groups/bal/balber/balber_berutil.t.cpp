@@ -4476,6 +4476,8 @@ int main(int argc, char *argv[])
         // Plan:
         //
         // Testing:
+        //   putValue(bsl::streambuf *, const bsl::basic_inplace_string&, ...);
+        //   getValue(bsl::streambuf *, bsl::basic_inplace_string *, int);
         // --------------------------------------------------------------------
 
         if (verbose) bsl::cout << "\nTESTING 'putValue', 'getValue' for string"
@@ -4536,6 +4538,34 @@ int main(int argc, char *argv[])
                 LOOP2_ASSERT(VAL, val, VAL == val);
                 LOOP3_ASSERT(LINE, LEN, numBytesConsumed,
                              LEN == numBytesConsumed);
+
+                // A 'bsl::basic_inplace_string' is encoded exactly like a
+                // 'bsl::string', and fails to decode a value longer than its
+                // capacity.
+
+                typedef bsl::basic_inplace_string<char, 16> InplaceString;
+
+                const bool FITS = VAL.size() <= 16;
+
+                bdlsb::FixedMemInStreamBuf isb2(osb.data(), osb.length());
+                InplaceString inplaceVal("x");
+                numBytesConsumed = 0;
+                LOOP_ASSERT(LINE, FITS == (SUCCESS == Util::getValue(
+                                                        &isb2,
+                                                        &inplaceVal,
+                                                        &numBytesConsumed)));
+                if (!FITS) {
+                    continue;
+                }
+                LOOP_ASSERT(LINE, 0 == isb2.length());
+                LOOP2_ASSERT(VAL, inplaceVal, VAL.c_str() == inplaceVal);
+                LOOP3_ASSERT(LINE, LEN, numBytesConsumed,
+                             LEN == numBytesConsumed);
+
+                bdlsb::MemOutStreamBuf osb2;
+                LOOP_ASSERT(LINE, 0 == Util::putValue(&osb2, inplaceVal));
+                LOOP_ASSERT(LINE, LEN == (int)osb2.length());
+                LOOP_ASSERT(LINE, 0   == compareBuffers(osb2.data(), EXP));
             }
         }
       } break;
@@ -16,26 +16,25 @@ namespace baljsn {
 // PRIVATE MANIPULATORS
 int Decoder::skipUnknownElement(const bslstl::StringRef& elementName)
 {
-    int rc = d_tokenizer.advanceToNextToken();
+    int rc = d_tokenizer_p->advanceToNextToken();
     if (rc) {
         d_logStream << "Error advancing to token after '"
                     << elementName << "'\n";
         return -1;                                                    // RETURN
     }
 
-    if (Tokenizer::e_ELEMENT_VALUE == d_tokenizer.tokenType()) {
+    if (Tokenizer::e_ELEMENT_VALUE == d_tokenizer_p->tokenType()) {
         // 'elementName' is a simple type.  Extract its value and return.
 
         bslstl::StringRef tmp;
-        rc = d_tokenizer.value(&tmp);
+        rc = d_tokenizer_p->value(&tmp);
         if (rc) {
             d_logStream << "Error reading attribute value for "
                         << elementName << "'\n";
         }
         return rc;                                                    // RETURN
     }
-    else if (Tokenizer::e_START_OBJECT ==
-                                                     d_tokenizer.tokenType()) {
+    else if (Tokenizer::e_START_OBJECT == d_tokenizer_p->tokenType()) {
         // 'elementName' is a sequence or choice.  Descend into the element and
         // skip all its sub-elements.
 
@@ -50,18 +49,18 @@ int Decoder::skipUnknownElement(const bslstl::StringRef& elementName)
             // Use 'skippingDepth' to keep track of how we have descended and
             // when to return.
 
-            int rc = d_tokenizer.advanceToNextToken();
+            int rc = d_tokenizer_p->advanceToNextToken();
             if (rc) {
                 d_logStream << "Error reading unknown element '"
                             << elementName << "' or after that element\n";
                 return -1;                                            // RETURN
             }
 
-            switch (d_tokenizer.tokenType()) {
+            switch (d_tokenizer_p->tokenType()) {
               case Tokenizer::e_ELEMENT_NAME:
               case Tokenizer::e_ELEMENT_VALUE: {    // FALL THROUGH
                 bslstl::StringRef tmp;
-                rc = d_tokenizer.value(&tmp);
+                rc = d_tokenizer_p->value(&tmp);
                 if (rc) {
                     d_logStream << "Error reading attribute name after '{'\n";
                     return -1;                                        // RETURN
@@ -87,7 +86,7 @@ int Decoder::skipUnknownElement(const bslstl::StringRef& elementName)
             }
         }
     }
-    else if (Tokenizer::e_START_ARRAY == d_tokenizer.tokenType()) {
+    else if (Tokenizer::e_START_ARRAY == d_tokenizer_p->tokenType()) {
         // 'elementName' is an array.  Descend into the array element till we
         // encounter the matching end array token (']').
 
@@ -96,18 +95,18 @@ int Decoder::skipUnknownElement(const bslstl::StringRef& elementName)
             // Use 'skippingDepth' to keep track of how we have descended and
             // when to return.
 
-            int rc = d_tokenizer.advanceToNextToken();
+            int rc = d_tokenizer_p->advanceToNextToken();
             if (rc) {
                 d_logStream << "Error reading unknown element '"
                             << elementName << "' or after that element\n";
                 return -1;                                            // RETURN
             }
 
-            switch (d_tokenizer.tokenType()) {
+            switch (d_tokenizer_p->tokenType()) {
               case Tokenizer::e_ELEMENT_NAME:
               case Tokenizer::e_ELEMENT_VALUE: {    // FALL THROUGH
                 bslstl::StringRef tmp;
-                rc = d_tokenizer.value(&tmp);
+                rc = d_tokenizer_p->value(&tmp);
                 if (rc) {
                     d_logStream << "Error reading attribute name after '{'\n";
                     return -1;                                        // RETURN
@@ -17,11 +17,17 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
+// from a specified stream.  There are three overloaded versions of this
 // function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads the value at the current token of a 'baljsn::Tokenizer'
+//
+// The last of these decodes a single value from the middle of a JSON document
+// (e.g., one element of an array), leaving the tokenizer on the last token of
+// that value, so that a document can be decoded piecewise (see
+// 'baljsn_streamreader').
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -227,6 +233,8 @@ class Decoder {
     // DATA
     bsl::ostringstream  d_logStream;            // stream to record errors
     Tokenizer    d_tokenizer;            // JSON tokenizer
+    Tokenizer          *d_tokenizer_p;          // tokenizer being read (held,
+                                                // not owned)
     bsl::string         d_elementName;          // current element name
     int                 d_currentDepth;         // current decoding depth
     int                 d_maxDepth;             // max decoding depth
@@ -312,6 +320,20 @@ class Decoder {
         // attempt to update the input position of 'stream' to the last
         // unprocessed byte.
 
+    template <class TYPE>
+    int decode(Tokenizer             *tokenizer,
+               TYPE                  *value,
+               const DecoderOptions&  options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON value beginning at the current token of the specified
+        // 'tokenizer', using the specified 'options', and leave 'tokenizer' on
+        // the last token of that value.  'TYPE' shall be a 'bdeat'-compatible
+        // type.  Return 0 on success, and a non-zero value otherwise.  The
+        // behavior is undefined unless the current token of 'tokenizer' is
+        // the first token of a value (i.e., '{', '[', or a simple value).
+        // Note that the decoding depth is counted from the decoded value,
+        // rather than from the start of the document.
+
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
         // Decode an object of (template parameter) 'TYPE' from the specified
@@ -401,6 +423,38 @@ struct Decoder_DecodeImpProxy {
         // and a non-zero value otherwise.
 };
 
+                       // ============================
+                       // class Decoder_TokenizerGuard
+                       // ============================
+
+class Decoder_TokenizerGuard {
+    // This component-private class implements a guard that sets a tokenizer
+    // pointer to a specified tokenizer and, on destruction, restores the
+    // value that pointer had on construction, so that a 'Decoder' reading a
+    // tokenizer supplied by the caller reverts to its own tokenizer even if
+    // an exception is thrown.
+
+    // DATA
+    Tokenizer **d_tokenizer_pp;  // address of the guarded pointer
+    Tokenizer  *d_previous_p;    // value to restore (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    Decoder_TokenizerGuard(const Decoder_TokenizerGuard&);
+    Decoder_TokenizerGuard& operator=(const Decoder_TokenizerGuard&);
+
+  public:
+    // CREATORS
+    Decoder_TokenizerGuard(Tokenizer **tokenizerPointer, Tokenizer *tokenizer);
+        // Create a guard that sets the pointer at the specified
+        // 'tokenizerPointer' address to the specified 'tokenizer', and
+        // restores its current value on destruction.
+
+    ~Decoder_TokenizerGuard();
+        // Restore the pointer guarded by this object to the value it had when
+        // this object was created, and destroy this object.
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -465,22 +519,21 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
             return -1;                                                // RETURN
         }
 
-        if (Tokenizer::e_START_OBJECT != d_tokenizer.tokenType()) {
+        if (Tokenizer::e_START_OBJECT != d_tokenizer_p->tokenType()) {
             d_logStream << "Could not decode sequence, missing starting '{'\n";
             return -1;                                                // RETURN
         }
 
-        int rc = d_tokenizer.advanceToNextToken();
+        int rc = d_tokenizer_p->advanceToNextToken();
         if (rc) {
             d_logStream << "Could not decode sequence, "
                         << "error reading token after '{'\n";
             return -1;                                                // RETURN
         }
 
-        while (Tokenizer::e_ELEMENT_NAME ==
-                                                     d_tokenizer.tokenType()) {
+        while (Tokenizer::e_ELEMENT_NAME == d_tokenizer_p->tokenType()) {
             bslstl::StringRef elementName;
-            rc = d_tokenizer.value(&elementName);
+            rc = d_tokenizer_p->value(&elementName);
             if (rc) {
                 d_logStream << "Error reading attribute name after '{'\n";
                 return -1;                                            // RETURN
@@ -492,7 +545,7 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
                                      static_cast<int>(elementName.length()))) {
                 d_elementName = elementName;
 
-                rc = d_tokenizer.advanceToNextToken();
+                rc = d_tokenizer_p->advanceToNextToken();
                 if (rc) {
                     d_logStream << "Error reading value for attribute '"
                                 << d_elementName << "' \n";
@@ -528,7 +581,7 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
                 }
             }
 
-            rc = d_tokenizer.advanceToNextToken();
+            rc = d_tokenizer_p->advanceToNextToken();
             if (rc) {
                 d_logStream << "Could not decode sequence, error reading token"
                             << " after value for attribute '"
@@ -537,7 +590,7 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
             }
         }
 
-        if (Tokenizer::e_END_OBJECT != d_tokenizer.tokenType()) {
+        if (Tokenizer::e_END_OBJECT != d_tokenizer_p->tokenType()) {
             d_logStream << "Could not decode sequence, "
                         << "missing terminator '}' or seperator ','\n";
             return -1;                                                // RETURN
@@ -606,21 +659,21 @@ int Decoder::decodeImp(TYPE                       *value,
             return -1;                                                // RETURN
         }
 
-        if (Tokenizer::e_START_OBJECT != d_tokenizer.tokenType()) {
+        if (Tokenizer::e_START_OBJECT != d_tokenizer_p->tokenType()) {
             d_logStream << "Could not decode choice, missing starting {\n";
             return -1;                                                // RETURN
         }
 
-        int rc = d_tokenizer.advanceToNextToken();
+        int rc = d_tokenizer_p->advanceToNextToken();
         if (rc) {
             d_logStream << "Could not decode choice, "
                         << "error reading token after {\n";
             return -1;                                                // RETURN
         }
 
-        if (Tokenizer::e_ELEMENT_NAME == d_tokenizer.tokenType()) {
+        if (Tokenizer::e_ELEMENT_NAME == d_tokenizer_p->tokenType()) {
             bslstl::StringRef selectionName;
-            rc = d_tokenizer.value(&selectionName);
+            rc = d_tokenizer_p->value(&selectionName);
             if (rc) {
                 d_logStream << "Error reading selection name after '{'\n";
                 return -1;                                            // RETURN
@@ -639,7 +692,7 @@ int Decoder::decodeImp(TYPE                       *value,
                     return -1;                                        // RETURN
                 }
 
-                rc = d_tokenizer.advanceToNextToken();
+                rc = d_tokenizer_p->advanceToNextToken();
                 if (rc) {
                     d_logStream << "Could not decode choice, "
                                 << "error reading value \n";
@@ -672,7 +725,7 @@ int Decoder::decodeImp(TYPE                       *value,
                 }
             }
 
-            rc = d_tokenizer.advanceToNextToken();
+            rc = d_tokenizer_p->advanceToNextToken();
             if (rc) {
                 d_logStream << "Could not decode choice, error reading "
                             << "token after value for selection \n";
@@ -680,7 +733,7 @@ int Decoder::decodeImp(TYPE                       *value,
             }
         }
 
-        if (Tokenizer::e_END_OBJECT != d_tokenizer.tokenType()) {
+        if (Tokenizer::e_END_OBJECT != d_tokenizer_p->tokenType()) {
             d_logStream << "Could not decode choice, "
                         << "missing terminator '}'\n";
             return -1;                                                // RETURN
@@ -698,13 +751,13 @@ int Decoder::decodeImp(TYPE *value,
 {
     enum { k_MIN_ENUM_STRING_LENGTH = 2 };
 
-    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer.tokenType()) {
+    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer_p->tokenType()) {
         d_logStream << "Enumeration element value was not found\n";
         return -1;                                                    // RETURN
     }
 
     bslstl::StringRef dataValue;
-    int rc = d_tokenizer.value(&dataValue);
+    int rc = d_tokenizer_p->value(&dataValue);
     if (rc
      || dataValue.length() <= k_MIN_ENUM_STRING_LENGTH
      || '"'                != dataValue[0]
@@ -730,13 +783,13 @@ int Decoder::decodeImp(TYPE *value,
                               int,
                               bdlat_TypeCategory::CustomizedType)
 {
-    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer.tokenType()) {
+    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer_p->tokenType()) {
         d_logStream << "Customized element value was not found\n";
         return -1;                                                    // RETURN
     }
 
     bslstl::StringRef dataValue;
-    int rc = d_tokenizer.value(&dataValue);
+    int rc = d_tokenizer_p->value(&dataValue);
     if (rc) {
         d_logStream << "Error reading customized type value\n";
         return -1;                                                    // RETURN
@@ -767,13 +820,13 @@ int Decoder::decodeImp(TYPE *value,
                               int,
                               bdlat_TypeCategory::Simple)
 {
-    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer.tokenType()) {
+    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer_p->tokenType()) {
         d_logStream << "Simple element value was not found\n";
         return -1;                                                    // RETURN
     }
 
     bslstl::StringRef dataValue;
-    int rc = d_tokenizer.value(&dataValue);
+    int rc = d_tokenizer_p->value(&dataValue);
     if (rc) {
         d_logStream << "Error reading simple value\n";
         return -1;                                                    // RETURN
@@ -787,14 +840,14 @@ int Decoder::decodeImp(bsl::vector<char> *value,
                               int,
                               bdlat_TypeCategory::Array)
 {
-    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer.tokenType()) {
+    if (Tokenizer::e_ELEMENT_VALUE != d_tokenizer_p->tokenType()) {
         d_logStream << "Could not decode vector<char> "
                     << "expected as an element value\n";
         return -1;                                                    // RETURN
     }
 
     bslstl::StringRef dataValue;
-    int rc = d_tokenizer.value(&dataValue);
+    int rc = d_tokenizer_p->value(&dataValue);
 
     if (rc) {
         d_logStream << "Error reading customized type element value\n";
@@ -809,21 +862,20 @@ int Decoder::decodeImp(TYPE                      *value,
                        int                        mode,
                        bdlat_TypeCategory::Array)
 {
-    if (Tokenizer::e_START_ARRAY != d_tokenizer.tokenType()) {
+    if (Tokenizer::e_START_ARRAY != d_tokenizer_p->tokenType()) {
         d_logStream << "Could not decode vector, missing start token: '['\n";
         return -1;                                                    // RETURN
     }
 
-    int rc = d_tokenizer.advanceToNextToken();
+    int rc = d_tokenizer_p->advanceToNextToken();
     if (rc) {
         return rc;                                                    // RETURN
     }
 
     int i = 0;
-    while (Tokenizer::e_END_ARRAY != d_tokenizer.tokenType()) {
-        if (Tokenizer::e_ELEMENT_VALUE == d_tokenizer.tokenType()
-         || Tokenizer::e_START_OBJECT  ==
-                                                     d_tokenizer.tokenType()) {
+    while (Tokenizer::e_END_ARRAY != d_tokenizer_p->tokenType()) {
+        if (Tokenizer::e_ELEMENT_VALUE == d_tokenizer_p->tokenType()
+         || Tokenizer::e_START_OBJECT  == d_tokenizer_p->tokenType()) {
             ++i;
             bdlat_ArrayFunctions::resize(value, i);
 
@@ -836,7 +888,7 @@ int Decoder::decodeImp(TYPE                      *value,
                 return -1;                                            // RETURN
             }
 
-            rc = d_tokenizer.advanceToNextToken();
+            rc = d_tokenizer_p->advanceToNextToken();
             if (rc) {
                 d_logStream << "Error reading token after value of element '"
                             << i - 1 << "'\n";
@@ -849,7 +901,7 @@ int Decoder::decodeImp(TYPE                      *value,
         }
     }
 
-    if (Tokenizer::e_END_ARRAY != d_tokenizer.tokenType()) {
+    if (Tokenizer::e_END_ARRAY != d_tokenizer_p->tokenType()) {
         d_logStream << "Could not decode vector, missing end token: ']'\n";
         return -1;                                                    // RETURN
     }
@@ -864,9 +916,9 @@ int Decoder::decodeImp(TYPE                              *value,
 {
     enum { k_NULL_VALUE_LENGTH = 4 };
 
-    if (Tokenizer::e_ELEMENT_VALUE == d_tokenizer.tokenType()) {
+    if (Tokenizer::e_ELEMENT_VALUE == d_tokenizer_p->tokenType()) {
         bslstl::StringRef dataValue;
-        const int rc = d_tokenizer.value(&dataValue);
+        const int rc = d_tokenizer_p->value(&dataValue);
         if (rc) {
             return rc;                                                // RETURN
         }
@@ -900,6 +952,7 @@ inline
 Decoder::Decoder(bslma::Allocator *basicAllocator)
 : d_logStream(basicAllocator)
 , d_tokenizer(basicAllocator)
+, d_tokenizer_p(&d_tokenizer)
 , d_elementName(basicAllocator)
 , d_currentDepth(0)
 , d_maxDepth(0)
@@ -971,6 +1024,30 @@ int Decoder::decode(bsl::istream&          stream,
     return 0;
 }
 
+template <class TYPE>
+int Decoder::decode(Tokenizer             *tokenizer,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(tokenizer);
+    BSLS_ASSERT(value);
+
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type TypeCategory;
+
+    bdlat_ValueTypeFunctions::reset(value);
+
+    d_logStream.clear();
+    d_logStream.str("");
+
+    d_currentDepth        = 0;
+    d_maxDepth            = options.maxDepth();
+    d_skipUnknownElements = options.skipUnknownElements();
+
+    Decoder_TokenizerGuard guard(&d_tokenizer_p, tokenizer);
+
+    return decodeImp(value, 0, TypeCategory());
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
@@ -1036,6 +1113,29 @@ int Decoder_DecodeImpProxy::operator()(TYPE         *object,
     return d_decoder_p->decodeImp(object, d_mode, category);
 }
 
+                       // ----------------------------
+                       // class Decoder_TokenizerGuard
+                       // ----------------------------
+
+// CREATORS
+inline
+Decoder_TokenizerGuard::Decoder_TokenizerGuard(Tokenizer **tokenizerPointer,
+                                               Tokenizer  *tokenizer)
+: d_tokenizer_pp(tokenizerPointer)
+, d_previous_p(*tokenizerPointer)
+{
+    BSLS_ASSERT_SAFE(tokenizerPointer);
+    BSLS_ASSERT_SAFE(tokenizer);
+
+    *d_tokenizer_pp = tokenizer;
+}
+
+inline
+Decoder_TokenizerGuard::~Decoder_TokenizerGuard()
+{
+    *d_tokenizer_pp = d_previous_p;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
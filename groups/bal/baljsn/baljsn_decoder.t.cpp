@@ -6,6 +6,7 @@
 #include <bsl_string.h>
 #include <bsl_vector.h>
 #include <bdlat_attributeinfo.h>
+#include <bdlat_attributenameindex.h>
 #include <bdlat_choicefunctions.h>
 #include <bdlat_enumeratorinfo.h>
 #include <bdlat_selectioninfo.h>
@@ -25,6 +26,8 @@
 
 #include <bslmt_threadutil.h>
 
+#include <bsls_stopwatch.h>
+
 // These header are for testing only and the hierarchy level of 'baljsn' was
 // increase because of them.  They should be remove when possible.
 #include <balb_testmessages.h>
@@ -33,6 +36,7 @@
 #include <balxml_minireader.h>
 #include <balxml_errorinfo.h>
 
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
@@ -66,14 +70,16 @@ using bsl::endl;
 // MANIPULATORS
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
+// [ 7] int decode(Tokenizer *tokenizer, TYPE *v, options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
+// [-1] PERFORMANCE: DECODING WIDE SEQUENCES
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -36915,6 +36921,242 @@ bsl::ostream& operator<<(bsl::ostream&            stream,
 }  // close namespace test
 }  // close enterprise namespace
 
+// ============================================================================
+//                     WIDE SEQUENCE TYPE FOR BENCHMARKING
+// ----------------------------------------------------------------------------
+
+namespace BloombergLP {
+namespace test {
+
+                          // ======================
+                          // class WideRecord<TAG>
+                          // ======================
+
+template <int TAG>
+class WideRecord {
+    // This class is a "sequence" type having 'k_NUM_ATTRIBUTES' 'int'
+    // attributes, whose member functions find an attribute by name by
+    // comparing the name with each attribute name in turn.  'WideRecord<1>'
+    // has the 'bdlat_UsesAttributeNameIndex' trait, and 'WideRecord<0>' does
+    // not.
+
+  public:
+    // CONSTANTS
+    enum { k_NUM_ATTRIBUTES = 64 };
+
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+  private:
+    // DATA
+    int d_values[k_NUM_ATTRIBUTES];
+
+  public:
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(WideRecord, bdlat_TypeTraitBasicSequence);
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+        // Return attribute information for the attribute indicated by the
+        // specified 'id' if the attribute exists, and 0 otherwise.
+    {
+        return 0 <= id && id < k_NUM_ATTRIBUTES ? &ATTRIBUTE_INFO_ARRAY[id]
+                                                : 0;
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+        // Return attribute information for the attribute indicated by the
+        // specified 'name' of the specified 'nameLength' if the attribute
+        // exists, and 0 otherwise.
+    {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& info = ATTRIBUTE_INFO_ARRAY[i];
+            if (nameLength == info.d_nameLength
+             && 0 == bsl::memcmp(name, info.d_name_p, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    WideRecord()
+        // Create an object having all attributes 0.
+    {
+        reset();
+    }
+
+    // MANIPULATORS
+    void reset()
+        // Set all attributes of this object to 0.
+    {
+        bsl::memset(d_values, 0, sizeof d_values);
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'id', and return the value it returns, or -1 if there is
+        // no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(id);
+        return info ? manipulator(&d_values[id], *info) : -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'name' of the specified 'nameLength', and return the
+        // value it returns, or -1 if there is no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? manipulator(&d_values[info->d_id], *info) : -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttributes(MANIPULATOR& manipulator)
+        // Invoke the specified 'manipulator' on each attribute until it
+        // returns non-zero, and return the last value it returned.
+    {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            const int rc = manipulator(&d_values[i], ATTRIBUTE_INFO_ARRAY[i]);
+            if (rc) {
+                return rc;                                            // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // ACCESSORS
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR& accessor, int id) const
+        // Invoke the specified 'accessor' on the attribute having the
+        // specified 'id', and return the value it returns, or -1 if there is
+        // no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(id);
+        return info ? accessor(d_values[id], *info) : -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttribute(ACCESSOR&   accessor,
+                        const char *name,
+                        int         nameLength) const
+        // Invoke the specified 'accessor' on the attribute having the
+        // specified 'name' of the specified 'nameLength', and return the
+        // value it returns, or -1 if there is no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        return info ? accessor(d_values[info->d_id], *info) : -1;
+    }
+
+    template <class ACCESSOR>
+    int accessAttributes(ACCESSOR& accessor) const
+        // Invoke the specified 'accessor' on each attribute until it returns
+        // non-zero, and return the last value it returned.
+    {
+        for (int i = 0; i < k_NUM_ATTRIBUTES; ++i) {
+            const int rc = accessor(d_values[i], ATTRIBUTE_INFO_ARRAY[i]);
+            if (rc) {
+                return rc;                                            // RETURN
+            }
+        }
+        return 0;
+    }
+
+    int value(int id) const
+        // Return the value of the attribute having the specified 'id'.
+    {
+        return d_values[id];
+    }
+};
+
+template <int TAG>
+const char WideRecord<TAG>::CLASS_NAME[] = "WideRecord";
+
+template <int TAG>
+const bdlat_AttributeInfo WideRecord<TAG>::ATTRIBUTE_INFO_ARRAY[] = {
+    {  0, "id",             2, "", bdlat_FormattingMode::e_DEC },
+    {  1, "name",           4, "", bdlat_FormattingMode::e_DEC },
+    {  2, "description",   11, "", bdlat_FormattingMode::e_DEC },
+    {  3, "status",         6, "", bdlat_FormattingMode::e_DEC },
+    {  4, "priority",       8, "", bdlat_FormattingMode::e_DEC },
+    {  5, "owner",          5, "", bdlat_FormattingMode::e_DEC },
+    {  6, "created",        7, "", bdlat_FormattingMode::e_DEC },
+    {  7, "modified",       8, "", bdlat_FormattingMode::e_DEC },
+    {  8, "version",        7, "", bdlat_FormattingMode::e_DEC },
+    {  9, "category",       8, "", bdlat_FormattingMode::e_DEC },
+    { 10, "tags",           4, "", bdlat_FormattingMode::e_DEC },
+    { 11, "price",          5, "", bdlat_FormattingMode::e_DEC },
+    { 12, "quantity",       8, "", bdlat_FormattingMode::e_DEC },
+    { 13, "currency",       8, "", bdlat_FormattingMode::e_DEC },
+    { 14, "discount",       8, "", bdlat_FormattingMode::e_DEC },
+    { 15, "tax",            3, "", bdlat_FormattingMode::e_DEC },
+    { 16, "total",          5, "", bdlat_FormattingMode::e_DEC },
+    { 17, "weight",         6, "", bdlat_FormattingMode::e_DEC },
+    { 18, "height",         6, "", bdlat_FormattingMode::e_DEC },
+    { 19, "width",          5, "", bdlat_FormattingMode::e_DEC },
+    { 20, "depth",          5, "", bdlat_FormattingMode::e_DEC },
+    { 21, "color",          5, "", bdlat_FormattingMode::e_DEC },
+    { 22, "size",           4, "", bdlat_FormattingMode::e_DEC },
+    { 23, "material",       8, "", bdlat_FormattingMode::e_DEC },
+    { 24, "brand",          5, "", bdlat_FormattingMode::e_DEC },
+    { 25, "model",          5, "", bdlat_FormattingMode::e_DEC },
+    { 26, "serialNumber",  12, "", bdlat_FormattingMode::e_DEC },
+    { 27, "sku",            3, "", bdlat_FormattingMode::e_DEC },
+    { 28, "barcode",        7, "", bdlat_FormattingMode::e_DEC },
+    { 29, "location",       8, "", bdlat_FormattingMode::e_DEC },
+    { 30, "warehouse",      9, "", bdlat_FormattingMode::e_DEC },
+    { 31, "shelf",          5, "", bdlat_FormattingMode::e_DEC },
+    { 32, "supplier",       8, "", bdlat_FormattingMode::e_DEC },
+    { 33, "contactEmail",  12, "", bdlat_FormattingMode::e_DEC },
+    { 34, "contactPhone",  12, "", bdlat_FormattingMode::e_DEC },
+    { 35, "street",         6, "", bdlat_FormattingMode::e_DEC },
+    { 36, "city",           4, "", bdlat_FormattingMode::e_DEC },
+    { 37, "state",          5, "", bdlat_FormattingMode::e_DEC },
+    { 38, "zip",            3, "", bdlat_FormattingMode::e_DEC },
+    { 39, "country",        7, "", bdlat_FormattingMode::e_DEC },
+    { 40, "region",         6, "", bdlat_FormattingMode::e_DEC },
+    { 41, "latitude",       8, "", bdlat_FormattingMode::e_DEC },
+    { 42, "longitude",      9, "", bdlat_FormattingMode::e_DEC },
+    { 43, "timezone",       8, "", bdlat_FormattingMode::e_DEC },
+    { 44, "language",       8, "", bdlat_FormattingMode::e_DEC },
+    { 45, "rating",         6, "", bdlat_FormattingMode::e_DEC },
+    { 46, "reviews",        7, "", bdlat_FormattingMode::e_DEC },
+    { 47, "views",          5, "", bdlat_FormattingMode::e_DEC },
+    { 48, "likes",          5, "", bdlat_FormattingMode::e_DEC },
+    { 49, "shares",         6, "", bdlat_FormattingMode::e_DEC },
+    { 50, "comments",       8, "", bdlat_FormattingMode::e_DEC },
+    { 51, "parentId",       8, "", bdlat_FormattingMode::e_DEC },
+    { 52, "childCount",    10, "", bdlat_FormattingMode::e_DEC },
+    { 53, "sortOrder",      9, "", bdlat_FormattingMode::e_DEC },
+    { 54, "flags",          5, "", bdlat_FormattingMode::e_DEC },
+    { 55, "isActive",       8, "", bdlat_FormattingMode::e_DEC },
+    { 56, "isDeleted",      9, "", bdlat_FormattingMode::e_DEC },
+    { 57, "createdBy",      9, "", bdlat_FormattingMode::e_DEC },
+    { 58, "modifiedBy",    10, "", bdlat_FormattingMode::e_DEC },
+    { 59, "approvedBy",    10, "", bdlat_FormattingMode::e_DEC },
+    { 60, "approvedAt",    10, "", bdlat_FormattingMode::e_DEC },
+    { 61, "expiresAt",      9, "", bdlat_FormattingMode::e_DEC },
+    { 62, "notes",          5, "", bdlat_FormattingMode::e_DEC },
+    { 63, "checksum",       8, "", bdlat_FormattingMode::e_DEC },
+};
+
+}  // close namespace test
+
+template <>
+struct bdlat_UsesAttributeNameIndex<test::WideRecord<1> > : bsl::true_type {
+};
+
+}  // close enterprise namespace
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -36929,7 +37171,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -37036,6 +37278,139 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 //..
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING FROM A TOKENIZER
+        //
+        // Concerns:
+        //: 1 'decode' reads, from the supplied tokenizer, exactly the tokens
+        //:   of the value beginning at the current token, and leaves the
+        //:   tokenizer on the last token of that value.
+        //:
+        //: 2 'decode' honors the supplied options.
+        //:
+        //: 3 'decode' returns a non-zero value, and logs a message, on error.
+        //:
+        //: 4 Decoding from a tokenizer does not affect later decoding from a
+        //:   stream buffer with the same decoder.
+        //
+        // Plan:
+        //: 1 Create a tokenizer on a JSON array of 'test::Employee' objects,
+        //:   advance it to the first token of each element in turn, decode
+        //:   the element, and verify the decoded value and the token on which
+        //:   the tokenizer is left.  (C-1)
+        //:
+        //: 2 Decode an element having an unknown attribute, with and without
+        //:   the 'skipUnknownElements' option, and verify the result.
+        //:   (C-2..3)
+        //:
+        //: 3 Decode an object from a stream buffer with the decoder used in
+        //:   P-1 and P-2.  (C-4)
+        //
+        // Testing:
+        //   int decode(Tokenizer *tokenizer, TYPE *v, options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING FROM A TOKENIZER" << endl
+                          << "=================================" << endl;
+
+        typedef baljsn::Tokenizer Tokenizer;
+
+        const char INPUT[] =
+                 "[{\"name\":\"Bob\",\"age\":21},"
+                 "{\"name\":\"Ann\",\"homeAddress\":{\"city\":\"Paris\"},"
+                 "\"age\":35},"
+                 "{\"name\":\"Tom\",\"unknown\":[1,2],\"age\":40}]";
+
+        const char *NAMES[] = { "Bob", "Ann", "Tom" };
+        const int   AGES[]  = {    21,    35,    40 };
+
+        baljsn::DecoderOptions options;
+        baljsn::Decoder        decoder;
+
+        bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof(INPUT) - 1);
+
+        Tokenizer tokenizer;
+        tokenizer.reset(&isb);
+
+        ASSERT(0 == tokenizer.advanceToNextToken());
+        ASSERT(Tokenizer::e_START_ARRAY == tokenizer.tokenType());
+
+        for (int i = 0; i < 3; ++i) {
+            if (veryVerbose) { T_ P(i) }
+
+            ASSERTV(i, 0 == tokenizer.advanceToNextToken());
+            ASSERTV(i, Tokenizer::e_START_OBJECT == tokenizer.tokenType());
+
+            test::Employee employee;
+            employee.name() = "Old";
+
+            options.setSkipUnknownElements(2 != i);
+
+            const int rc = decoder.decode(&tokenizer, &employee, options);
+            if (2 == i) {
+                // Unknown elements are not skipped.
+
+                ASSERTV(i, rc, 0 != rc);
+                ASSERTV(i, !decoder.loggedMessages().empty());
+                break;
+            }
+
+            ASSERTV(i, rc, 0 == rc);
+            ASSERTV(i, decoder.loggedMessages(),
+                    decoder.loggedMessages().empty());
+            ASSERTV(i, Tokenizer::e_END_OBJECT == tokenizer.tokenType());
+            ASSERTV(i, employee.name(), NAMES[i] == employee.name());
+            ASSERTV(i, employee.age(),  AGES[i]  == employee.age());
+            ASSERTV(i, employee.homeAddress().city(),
+                    (1 == i ? "Paris" : "") == employee.homeAddress().city());
+        }
+
+        // Decode the last element again, skipping the unknown element.
+
+        {
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof(INPUT) - 1);
+            tokenizer.reset(&isb);
+
+            for (int i = 0; i < 2; ++i) {
+                ASSERTV(i, 0 == tokenizer.advanceToNextToken());
+            }
+
+            test::Employee employee;
+            options.setSkipUnknownElements(true);
+
+            ASSERT(0 == decoder.decode(&tokenizer, &employee, options));
+            ASSERT(Tokenizer::e_END_OBJECT == tokenizer.tokenType());
+            ASSERT("Bob" == employee.name());
+            ASSERT(0 == tokenizer.advanceToNextToken());
+
+            ASSERT(0 == decoder.decode(&tokenizer, &employee, options));
+            ASSERT(0 == tokenizer.advanceToNextToken());
+
+            ASSERT(0 == decoder.decode(&tokenizer, &employee, options));
+            ASSERT(Tokenizer::e_END_OBJECT == tokenizer.tokenType());
+            ASSERT("Tom" == employee.name());
+            ASSERT(40    == employee.age());
+
+            ASSERT(0 == tokenizer.advanceToNextToken());
+            ASSERT(Tokenizer::e_END_ARRAY == tokenizer.tokenType());
+        }
+
+        // Decode from a stream buffer with the same decoder.
+
+        {
+            const char INPUT[] = "{\"name\":\"Sue\",\"age\":50}";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof(INPUT) - 1);
+
+            test::Employee employee;
+
+            ASSERT(0 == decoder.decode(&isb, &employee, options));
+            ASSERT("Sue" == employee.name());
+            ASSERT(50    == employee.age());
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING DECODING OF 'hexBinary' CUSTOMIZED TYPE
@@ -39108,6 +39483,84 @@ int main(int argc, char *argv[])
             ASSERT(21            == bob.age());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DECODING WIDE SEQUENCES
+        //
+        // Concerns:
+        //: 1 Looking attribute names up in a 'bdlat_AttributeNameIndex'
+        //:   speeds up decoding sequences having many attributes.
+        //
+        // Plan:
+        //: 1 Decode, many times, a document setting every attribute of a
+        //:   sequence type having 64 attributes, for the type with and without
+        //:   the 'bdlat_UsesAttributeNameIndex' trait, and report the time
+        //:   taken by each.
+        //
+        // Testing:
+        //   PERFORMANCE: DECODING WIDE SEQUENCES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: DECODING WIDE SEQUENCES" << endl
+                          << "====================================" << endl;
+
+        typedef test::WideRecord<0> Plain;
+        typedef test::WideRecord<1> Indexed;
+
+        const int NUM_ATTRIBUTES = Plain::k_NUM_ATTRIBUTES;
+        const int NUM_ITERATIONS = 20000;
+
+        // Set the attributes in reverse order, so that a search starting from
+        // the first attribute does as much work as possible.
+
+        bsl::string document("{");
+        for (int i = NUM_ATTRIBUTES - 1; 0 <= i; --i) {
+            const bdlat_AttributeInfo& info = Plain::ATTRIBUTE_INFO_ARRAY[i];
+            char buffer[64];
+            bsl::sprintf(buffer, "\"%s\":%d", info.d_name_p, i + 1);
+            document += buffer;
+            document += i ? "," : "}";
+        }
+
+        baljsn::DecoderOptions options;
+        baljsn::Decoder        decoder;
+
+        Plain   plain;
+        Indexed indexed;
+
+        bsls::Stopwatch sw;
+
+        sw.start(true);
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            bdlsb::FixedMemInStreamBuf isb(document.data(), document.size());
+            ASSERT(0 == decoder.decode(&isb, &plain, options));
+        }
+        sw.stop();
+        const double PLAIN_TIME = sw.accumulatedUserTime();
+
+        sw.reset();
+        sw.start(true);
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            bdlsb::FixedMemInStreamBuf isb(document.data(), document.size());
+            ASSERT(0 == decoder.decode(&isb, &indexed, options));
+        }
+        sw.stop();
+        const double INDEXED_TIME = sw.accumulatedUserTime();
+
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            LOOP_ASSERT(i, i + 1 == plain.value(i));
+            LOOP_ASSERT(i, i + 1 == indexed.value(i));
+        }
+
+        const double MB = static_cast<double>(document.size())
+                                          * NUM_ITERATIONS / (1024.0 * 1024.0);
+
+        cout << "without index: " << PLAIN_TIME   << "s ("
+             << MB / PLAIN_TIME   << " MB/s)\n"
+             << "with index:    " << INDEXED_TIME << "s ("
+             << MB / INDEXED_TIME << " MB/s)\n";
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
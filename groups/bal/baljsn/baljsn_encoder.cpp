@@ -6,7 +6,34 @@ BSLS_IDENT_RCSID(baljsn_encoder_cpp,"$Id$ $CSID$")
 
 #include <bdlde_base64encoder.h>
 
+#include <bsl_algorithm.h>
+
 namespace BloombergLP {
+namespace {
+
+void writeIndentation(bsl::streambuf *streamBuf,
+                      int             indentLevel,
+                      int             spacesPerLevel)
+    // Write to the specified 'streamBuf' the number of spaces equal to the
+    // product of the specified 'indentLevel' and the absolute value of the
+    // specified 'spacesPerLevel', or none if that product is negative, as
+    // 'bdlb::Print::indent' would.
+{
+    static const char SPACES[] = "                                "
+                                 "                                ";
+    enum { k_NUM_SPACES = sizeof SPACES - 1 };
+
+    int numSpaces = indentLevel * (spacesPerLevel < 0 ? -spacesPerLevel
+                                                      : spacesPerLevel);
+    while (numSpaces > 0) {
+        const int n = bsl::min<int>(numSpaces, k_NUM_SPACES);
+        streamBuf->sputn(SPACES, n);
+        numSpaces -= n;
+    }
+}
+
+}  // close unnamed namespace
+
 namespace baljsn {
 
                           // -----------------------
@@ -17,6 +44,7 @@ namespace baljsn {
 Encoder_Formatter::Encoder_Formatter(bsl::ostream&         stream,
                                      const EncoderOptions& options)
 : d_outputStream(stream)
+, d_streamBuf_p(stream.rdbuf())
 , d_isArrayElement(false)
 {
     if (EncoderOptions::e_PRETTY == options.encodingStyle()) {
@@ -36,10 +64,10 @@ void Encoder_Formatter::openObject()
 {
     indent();
 
-    d_outputStream << '{';
+    d_streamBuf_p->sputc('{');
 
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        d_streamBuf_p->sputc('\n');
     }
 
     ++d_indentLevel;
@@ -50,19 +78,19 @@ void Encoder_Formatter::closeObject()
     --d_indentLevel;
 
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
-        bdlb::Print::indent(d_outputStream, d_indentLevel, d_spacesPerLevel);
+        d_streamBuf_p->sputc('\n');
+        writeIndentation(d_streamBuf_p, d_indentLevel, d_spacesPerLevel);
     }
 
-    d_outputStream << '}';
+    d_streamBuf_p->sputc('}');
 }
 
 void Encoder_Formatter::openArray(bool formatAsEmptyArrayFlag)
 {
-    d_outputStream << '[';
+    d_streamBuf_p->sputc('[');
 
     if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
-        d_outputStream << '\n';
+        d_streamBuf_p->sputc('\n');
     }
 
     ++d_indentLevel;
@@ -73,11 +101,11 @@ void Encoder_Formatter::closeArray(bool formatAsEmptyArrayFlag)
     --d_indentLevel;
 
     if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
-        d_outputStream << '\n';
-        bdlb::Print::indent(d_outputStream, d_indentLevel, d_spacesPerLevel);
+        d_streamBuf_p->sputc('\n');
+        writeIndentation(d_streamBuf_p, d_indentLevel, d_spacesPerLevel);
     }
 
-    d_outputStream << ']';
+    d_streamBuf_p->sputc(']');
 
 }
 
@@ -85,9 +113,7 @@ void Encoder_Formatter::indent()
 {
     if (d_usePrettyStyle) {
         if (d_isArrayElement) {
-            bdlb::Print::indent(d_outputStream,
-                               d_indentLevel,
-                               d_spacesPerLevel);
+            writeIndentation(d_streamBuf_p, d_indentLevel, d_spacesPerLevel);
         }
     }
 }
@@ -95,7 +121,7 @@ void Encoder_Formatter::indent()
 int Encoder_Formatter::openElement(const bsl::string& name)
 {
     if (d_usePrettyStyle) {
-        bdlb::Print::indent(d_outputStream, d_indentLevel, d_spacesPerLevel);
+        writeIndentation(d_streamBuf_p, d_indentLevel, d_spacesPerLevel);
     }
 
     const int rc = PrintUtil::printValue(d_outputStream, name);
@@ -104,10 +130,10 @@ int Encoder_Formatter::openElement(const bsl::string& name)
     }
 
     if (d_usePrettyStyle) {
-        d_outputStream << " : ";
+        d_streamBuf_p->sputn(" : ", 3);
     }
     else {
-        d_outputStream << ':';
+        d_streamBuf_p->sputc(':');
     }
 
     return 0;
@@ -115,23 +141,23 @@ int Encoder_Formatter::openElement(const bsl::string& name)
 
 void Encoder_Formatter::closeElement()
 {
-    d_outputStream << ',';
+    d_streamBuf_p->sputc(',');
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        d_streamBuf_p->sputc('\n');
     }
 }
 
 void Encoder_Formatter::openDocument()
 {
     if (d_usePrettyStyle) {
-        bdlb::Print::indent(d_outputStream, d_indentLevel, d_spacesPerLevel);
+        writeIndentation(d_streamBuf_p, d_indentLevel, d_spacesPerLevel);
     }
 }
 
 void Encoder_Formatter::closeDocument()
 {
     if (d_usePrettyStyle) {
-        d_outputStream << '\n';
+        d_streamBuf_p->sputc('\n');
     }
 }
 
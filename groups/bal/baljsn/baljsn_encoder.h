@@ -23,6 +23,12 @@ BSLS_IDENT("$Id: $")
 //: o one that writes to a 'bsl::streambuf'
 //: o one that writes to an 'bsl::ostream'
 //
+// Punctuation, indentation, and most values are written to the output
+// 'bsl::streambuf' with no per-token 'bsl::ostream' formatting, so encoding is
+// fastest into a buffer that grows in place, such as a
+// 'bdlsb::MemOutStreamBuf' or a 'btlb::OutBlobStreamBuf' (which appends to a
+// 'btlb::Blob').
+//
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
 // manipulating struct-like and union-like objects.  In particular, types
@@ -337,11 +343,14 @@ class Encoder_Formatter {
     // component.
 
     // DATA
-    bsl::ostream& d_outputStream;     // stream for output (held, not owned)
-    bool          d_usePrettyStyle;   // encoding style
-    int           d_indentLevel;      // initial indent level
-    int           d_spacesPerLevel;   // spaces per level
-    bool          d_isArrayElement;   // is current element part of an array
+    bsl::ostream&   d_outputStream;   // stream for output (held, not owned)
+    bsl::streambuf *d_streamBuf_p;    // buffer of 'd_outputStream', to which
+                                      // punctuation and indentation are
+                                      // written directly (held, not owned)
+    bool            d_usePrettyStyle; // encoding style
+    int             d_indentLevel;    // initial indent level
+    int             d_spacesPerLevel; // spaces per level
+    bool            d_isArrayElement; // is current element part of an array
 
   public:
     // CREATORS
@@ -904,7 +913,7 @@ int Encoder_EncodeImpl::encodeImp(const TYPE&                       value,
 {
     if (bdlat_NullableValueFunctions::isNull(value)) {
         d_formatter.indent();
-        d_outputStream << "null";
+        d_outputStream.rdbuf()->sputn("null", 4);
         return 0;                                                     // RETURN
     }
 
@@ -45,6 +45,8 @@
 
 #include <bslmf_assert.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bsl_climits.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
@@ -88,6 +90,7 @@ using bsl::endl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [14] USAGE EXAMPLE
+// [-1] PERFORMANCE OF ENCODING
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -32545,6 +32548,67 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF ENCODING
+        //
+        // Concerns:
+        //: 1 Encoding large 'bdeat' sequences is efficient in both the
+        //:   compact and the pretty style.
+        //
+        // Plan:
+        //: 1 Build a 'bsl::vector' holding many copies of the
+        //:   'balb::FeatureTestMessage' test objects (a 'bdeat' array of
+        //:   choices of sequences having strings, numbers, dates, nullable
+        //:   values and arrays), encode it repeatedly into a
+        //:   'bdlsb::MemOutStreamBuf' in each style, and report the
+        //:   throughput using 'bsls::Stopwatch'.
+        //
+        // Testing:
+        //   PERFORMANCE OF ENCODING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE OF ENCODING"
+                          << "\n=======================" << endl;
+
+        bsl::vector<bsl::pair<int, balb::FeatureTestMessage> > testObjects;
+        constructFeatureTestMessage(&testObjects);
+
+        bsl::vector<balb::FeatureTestMessage> messages;
+        for (int i = 0; i < 200; ++i) {
+            for (int j = 0; j < static_cast<int>(testObjects.size()); ++j) {
+                messages.push_back(testObjects[j].second);
+            }
+        }
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 10;
+
+        for (int style = 0; style < 2; ++style) {
+            Options options;
+            if (style) {
+                options.setEncodingStyle(Options::e_PRETTY);
+                options.setSpacesPerLevel(4);
+            }
+
+            baljsn::Encoder encoder;
+            bsls::Stopwatch sw;
+            bsl::size_t     numBytes = 0;
+
+            sw.start(true);
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                bdlsb::MemOutStreamBuf osb;
+                ASSERT(0 == encoder.encode(&osb, messages, options));
+                numBytes += osb.length();
+            }
+            sw.stop();
+
+            cout << (style ? "pretty:  " : "compact: ")
+                 << numBytes / NUM_ITERATIONS << " bytes, "
+                 << static_cast<double>(numBytes)
+                                / (1024 * 1024 * sw.accumulatedUserTime())
+                 << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bdlde_charconvertutf32.h>
 
 #include <bdlb_chartype.h>
+#include <bdlb_floatconvertutil.h>
 
 #include <bsls_alignedbuffer.h>
 #include <bsls_assert.h>
@@ -68,6 +69,20 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
 
     ++iter;
     while (iter < end) {
+        // Append the longest run of characters needing no unescaping with a
+        // single call, so that strings without escapes are copied in bulk.
+
+        const char *run = iter;
+        while (iter < end && '\\' != *iter && '"' != *iter) {
+            ++iter;
+        }
+        if (run != iter) {
+            value->append(run, iter);
+            if (iter >= end) {
+                break;
+            }
+        }
+
         if ('\\' == *iter) {
             ++iter;
             if (iter >= end) {
@@ -152,11 +167,8 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
               } break;
             }
         }
-        else if ('"' == *iter) {
-            return 0;                                                 // RETURN
-        }
         else {
-            *value += *iter;
+            return 0;                                                 // RETURN
         }
         ++iter;
     }
@@ -173,6 +185,23 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return -1;                                                    // RETURN
     }
 
+    // Most numbers are converted by 'bdlb::FloatConvertUtil'; zeros (which
+    // may result from underflow), overflows, and anything not consumed
+    // entirely are left to 'strtod', which diagnoses them.
+
+    double            tmp       = 0;
+    const bsl::size_t numParsed = bdlb::FloatConvertUtil::parse(&tmp,
+                                                                data.begin(),
+                                                                data.end());
+    if (numParsed == data.length()
+     && bsl::isdigit(static_cast<unsigned char>(data[numParsed - 1]))
+     &&  0        != tmp
+     &&  HUGE_VAL != tmp
+     && -HUGE_VAL != tmp) {
+        *value = tmp;
+        return 0;                                                     // RETURN
+    }
+
     const int k_MAX_STRING_LENGTH = 63;
     char      buffer[k_MAX_STRING_LENGTH + 1];
 
@@ -182,9 +211,9 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
                                                   data.length(),
                                                   &allocator);
 
-    char   *endPtr = 0;
-    errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
+    char *endPtr = 0;
+    errno        = 0;
+    tmp          = bsl::strtod(dataString.c_str(), &endPtr);
 
     if (endPtr    != dataString.end()
      || (0        == tmp && 0 != errno)
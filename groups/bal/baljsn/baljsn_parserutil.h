@@ -33,6 +33,8 @@ BSLS_IDENT("$Id: $")
 //  double               number
 //  char *               string
 //  bsl::string          string
+//  bsl::basic_inplace_string<char, N>
+//                       string     fails if longer than 'N' characters
 //  bdlt::Date            string     ISO 8601 format
 //  bdlt::DateTz          string     ISO 8601 format
 //  bdlt::Time            string     ISO 8601 format
@@ -93,6 +95,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_iso8601util.h>
 #endif
 
+#ifndef INCLUDED_BDLMA_LOCALSEQUENTIALALLOCATOR
+#include <bdlma_localsequentialallocator.h>
+#endif
+
 #ifndef INCLUDED_BSL_LIMITS
 #include <bsl_limits.h>
 #endif
@@ -109,6 +115,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_vector.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_INPLACESTRING
+#include <bslstl_inplacestring.h>
+#endif
+
 #ifndef INCLUDED_BSLS_TYPES
 #include <bsls_types.h>
 #endif
@@ -176,6 +186,9 @@ struct ParserUtil {
     static int getValue(float               *value, bslstl::StringRef data);
     static int getValue(double              *value, bslstl::StringRef data);
     static int getValue(bsl::string         *value, bslstl::StringRef data);
+    template <bsl::size_t CAPACITY>
+    static int getValue(bsl::basic_inplace_string<char, CAPACITY> *value,
+                        bslstl::StringRef                          data);
     static int getValue(bdlt::Date           *value, bslstl::StringRef data);
     static int getValue(bdlt::Datetime       *value, bslstl::StringRef data);
     static int getValue(bdlt::DatetimeTz     *value, bslstl::StringRef data);
@@ -185,7 +198,9 @@ struct ParserUtil {
     static int getValue(bsl::vector<char>   *value, bslstl::StringRef data);
         // Load into the specified 'value' the characters read from the
         // specified 'data'.  Return 0 on success or a non-zero value on
-        // failure.
+        // failure.  Note that decoding into a
+        // 'bsl::basic_inplace_string<char, CAPACITY>' fails (leaving 'value'
+        // unchanged) if the decoded string is longer than 'CAPACITY'.
 };
 
 // ============================================================================
@@ -355,6 +370,25 @@ int ParserUtil::getValue(bsl::string *value, bslstl::StringRef data)
     return getString(value, data);
 }
 
+template <bsl::size_t CAPACITY>
+int ParserUtil::getValue(bsl::basic_inplace_string<char, CAPACITY> *value,
+                         bslstl::StringRef                          data)
+{
+    // Decode into a string whose buffer is local, so that values within the
+    // capacity of 'value' are decoded without allocating memory.
+
+    bdlma::LocalSequentialAllocator<CAPACITY + 1> allocator;
+    bsl::string                                   decoded(&allocator);
+    decoded.reserve(CAPACITY);
+
+    if (0 != getString(&decoded, data) || decoded.length() > CAPACITY) {
+        return -1;                                                    // RETURN
+    }
+
+    value->assign(decoded.data(), decoded.length());
+    return 0;
+}
+
 inline
 int ParserUtil::getValue(bdlt::Date *value, bslstl::StringRef data)
 {
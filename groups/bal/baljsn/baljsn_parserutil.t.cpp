@@ -1,6 +1,8 @@
 // baljsn_parserutil.t.cpp                                            -*-C++-*-
 #include <baljsn_parserutil.h>
 
+#include <baljsn_printutil.h>
+
 #include <bslim_testutil.h>
 
 #include <bdlt_date.h>
@@ -18,6 +20,8 @@
 #include <bsl_string.h>
 #include <bsl_cstring.h>
 
+#include <bslstl_inplacestring.h>
+
 #include <bdlb_printmethods.h>
 
 #include <bdlsb_memoutstreambuf.h>
@@ -72,9 +76,10 @@ using bsl::endl;
 // [18] static int getValue(bdlt::Datetime       *v, bslstl::StringRef s);
 // [19] static int getValue(bdlt::DatetimeTz     *v, bslstl::StringRef s);
 // [20] static int getValue(vector<char>        *v, bslstl::StringRef s);
+// [21] static int getValue(basic_inplace_string *v, bslstl::StringRef s);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [21] USAGE EXAMPLE
+// [22] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -168,7 +173,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 21: {
+      case 22: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -234,6 +239,118 @@ int main(int argc, char *argv[])
     ASSERT(21                      == employee.d_age);
 //..
       } break;
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING 'getValue' for in-place string values
+        //
+        // Concerns:
+        //: 1 Strings are decoded as for 'bsl::string', including escaped
+        //:   characters.
+        //:
+        //: 2 Decoding fails, and the passed in variable is unmodified, if the
+        //:   decoded string is longer than the capacity of the variable, or
+        //:   if the data is not valid.
+        //:
+        //: 3 No memory is allocated when decoding a string that fits.
+        //:
+        //: 4 Strings printed by 'baljsn::PrintUtil' are decoded back to the
+        //:   same value.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, decode strings into an
+        //:   in-place string of capacity 4 having a sentinel value, and
+        //:   verify the return code and the value.  Verify that the default
+        //:   allocator is not used.  (C-1..3)
+        //:
+        //: 2 Print in-place strings of every length up to their capacity,
+        //:   having characters that need escaping at various positions, using
+        //:   'baljsn::PrintUtil', decode the output, and verify that the
+        //:   value is unchanged.  (C-4)
+        //
+        // Testing:
+        //   static int getValue(basic_inplace_string *v, bslstl::StringRef s);
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING 'getValue' for in-place string"
+                               << "\n======================================"
+                               << bsl::endl;
+        {
+            typedef bsl::basic_inplace_string<char, 4> Type;
+
+            const Type ERROR_VALUE = "XXX";
+
+            static const struct {
+                int         d_line;    // line number
+                const char *d_input_p; // input on the stream
+                const char *d_exp_p;   // expected value
+                bool        d_isValid; // isValid flag
+            } DATA[] = {
+                //line    input                 exp           isValid
+                //----    -----                 ---           -------
+                {  L_,    "\"\"",               "",            true   },
+                {  L_,    "\"A\"",              "A",           true   },
+                {  L_,    "\"ABCD\"",           "ABCD",        true   },
+                {  L_,    "\"\\n\\t\"",         "\n\t",        true   },
+                {  L_,    "\"A\\u0800\"",       "A\xE0\xA0\x80", true   },
+
+                {  L_,    "\"ABCDE\"",          "XXX",         false  },
+                {  L_,    "\"AB\\u0800\"",      "XXX",         false  },
+                {  L_,    "\"\\U000G\"",        "XXX",         false  },
+                {  L_,    "ABC",                "XXX",         false  },
+                {  L_,    "",                   "XXX",         false  },
+            };
+            const int NUM_DATA = sizeof(DATA) / sizeof(*DATA);
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int   LINE     = DATA[i].d_line;
+                const char *INPUT    = DATA[i].d_input_p;
+                const Type  EXP      = DATA[i].d_exp_p;
+                const bool  IS_VALID = DATA[i].d_isValid;
+                      Type  value    = ERROR_VALUE;
+
+                bslma::TestAllocator         da(veryVeryVerbose);
+                bslma::DefaultAllocatorGuard guard(&da);
+
+                const int rc = Util::getValue(&value, StringRef(INPUT));
+                if (IS_VALID) {
+                    LOOP2_ASSERT(LINE, rc, 0 == rc);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, rc);
+                }
+                LOOP3_ASSERT(LINE, EXP, value, EXP == value);
+                LOOP_ASSERT(LINE, 0 == da.numBlocksTotal());
+            }
+        }
+
+        if (verbose) cout << "Round trip through 'baljsn::PrintUtil'" << endl;
+        {
+            typedef bsl::basic_inplace_string<char, 40> Type;
+
+            const char SPECIAL[] = { '"', '\\', '/', '\n', '\x01', 'a' };
+            const int  NUM_SPECIAL = sizeof SPECIAL;
+
+            for (int len = 0; len <= 40; ++len) {
+                for (int s = 0; s < NUM_SPECIAL; ++s) {
+                    Type value(len, 'x');
+                    for (int pos = s; pos < len; pos += NUM_SPECIAL) {
+                        value[pos] = SPECIAL[s];
+                    }
+
+                    bsl::ostringstream oss;
+                    ASSERTV(len, s, 0 == baljsn::PrintUtil::printValue(oss,
+                                                                      value));
+
+                    const bsl::string encoded = oss.str();
+                    Type              decoded("sentinel");
+
+                    ASSERTV(len, s, encoded, 0 == Util::getValue(&decoded,
+                                                                 encoded));
+                    ASSERTV(len, s, encoded, value == decoded);
+                }
+            }
+        }
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // TESTING 'getValue' for vector<char> values
@@ -1959,6 +2076,10 @@ int main(int argc, char *argv[])
         //: 2 The passed in variable is unmodified if the data is not valid.
         //:
         //: 3 The return code is 0 on success and non-zero on failure.
+        //:
+        //: 4 Values are parsed exactly, including those having more
+        //:   significant digits than a 'double' holds, and values that
+        //:   overflow or underflow are not valid.
         //
         // Plan:
         //: 1 Using the table-driven technique, specify a set of distinct
@@ -2057,6 +2178,21 @@ int main(int argc, char *argv[])
                 {  L_,    "1e-1",                    0.1,       true    },
                 {  L_,    "1E-1",                    0.1,       true    },
 
+                {  L_,    "0.30000000000000004",
+                                     0.30000000000000004,       true    },
+                {  L_,    "1.7976931348623157e308",
+                                                 DBL_MAX,       true    },
+                {  L_,    "2.2250738585072014e-308",
+                                                 DBL_MIN,       true    },
+                {  L_,    "12345678901234567890123",
+                                                 1.2345678901234568e22,
+                                                                true    },
+                {  L_,    "0e10",                      0,       true    },
+
+                {  L_,  "1e400",      ERROR_VALUE,   false   },
+                {  L_,  "-1e400",     ERROR_VALUE,   false   },
+                {  L_,  "1e-400",     ERROR_VALUE,   false   },
+                {  L_,  "1.",         ERROR_VALUE,   false   },
                 {  L_,  "-",          ERROR_VALUE,   false   },
                 {  L_,  ".5",         ERROR_VALUE,   false   },
                 {  L_,  "-.5",        ERROR_VALUE,   false   },
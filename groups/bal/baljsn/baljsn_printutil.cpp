@@ -6,46 +6,39 @@ BSLS_IDENT_RCSID(baljsn_printutil_cpp,"$Id$ $CSID$")
 
 #include <bdlde_base64encoder.h>
 #include <bdlde_utf8util.h>
-#include <bsl_sstream.h>
+
+#include <bsl_cstring.h>
 
 namespace BloombergLP {
 namespace {
 
-char getEscapeChar(char value)
-    // Return the JSON escape character for the specified 'value' if 'value'
-    // needs to be escaped, and '\0' otherwise.
-{
-    switch (value) {
-      case '"':                                                 // FALL THROUGH
-      case '\\':                                                // FALL THROUGH
-      case '/': {
-        return value;                                                 // RETURN
-      }
-      case '\b': {
-        return 'b';                                                   // RETURN
-      }
-      case '\f': {
-        return 'f';                                                   // RETURN
-      }
-      case '\n': {
-        return 'n';                                                   // RETURN
-      }
-      case '\r': {
-        return 'r';                                                   // RETURN
-      }
-      case '\t': {
-        return 't';                                                   // RETURN
-      }
-      default: {
-        if (0 <= value && value < 32) {
-            // control characters
-
-            return 'u';                                               // RETURN
-        }
-      }
-    }
-    return 0;
-}
+const char ESCAPE_TABLE[256] = {
+    // The JSON escape character for each character value that needs to be
+    // escaped (i.e., 'u' for control characters without a short escape), and
+    // 0 for each character value that is written as is.
+
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',   // 00-07
+    'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',   // 08-0F
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',   // 10-17
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',   // 18-1F
+      0,   0, '"',   0,   0,   0,   0,   0,   // 20-27
+      0,   0,   0,   0,   0,   0,   0, '/',   // 28-2F
+      0,   0,   0,   0,   0,   0,   0,   0,   // 30-37
+      0,   0,   0,   0,   0,   0,   0,   0,   // 38-3F
+      0,   0,   0,   0,   0,   0,   0,   0,   // 40-47
+      0,   0,   0,   0,   0,   0,   0,   0,   // 48-4F
+      0,   0,   0,   0,   0,   0,   0,   0,   // 50-57
+      0,   0,   0,   0,'\\',   0,   0,   0,   // 58-5F
+      // All remaining values are 0.
+};
+
+enum {
+    k_STRING_BUFFER_SIZE = 256,  // size of buffer accumulating the output of
+                                 // 'printString'
+
+    k_ESCAPE_ROOM        = 7     // longest escape sequence, plus the closing
+                                 // quote
+};
 
 }  // close unnamed namespace
 
@@ -64,34 +57,58 @@ int PrintUtil::printString(bsl::ostream&            stream,
         return -1;                                                    // RETURN
     }
 
-    stream << '"';
+    // Accumulate the output in 'buffer', copying each run of characters that
+    // need no escaping with a single 'memcpy', so that a typical string is
+    // written with a single call to 'write'.  Runs too long for 'buffer' are
+    // written directly.
 
-    for (bslstl::StringRef::const_iterator it = value.begin();
-         it != value.end();
-         ++it) {
-        bsl::string str;
+    char        buffer[k_STRING_BUFFER_SIZE];
+    char       *out = buffer;
+    const char *it  = value.data();
+    const char *end = it + value.length();
 
-        char ch = getEscapeChar(*it);
-        if (0 != ch) {
-            str += '\\';
-            str += ch;
-            if ('u' == ch) {
-                bsl::ostringstream oss;
+    *out++ = '"';
 
-                oss << "00"
-                    << bsl::hex << bsl::setfill('0') << bsl::setw(2)
-                    << (static_cast<unsigned int>(*it) & 0xff);
-                str += oss.str();
+    while (true) {
+        const char *run = it;
+        while (it != end
+            && 0 == ESCAPE_TABLE[static_cast<unsigned char>(*it)]) {
+            ++it;
+        }
+
+        // Keep 'k_ESCAPE_ROOM' bytes free for an escape sequence and the
+        // closing quote.
+
+        if (it - run > buffer + k_STRING_BUFFER_SIZE - k_ESCAPE_ROOM - out) {
+            stream.write(buffer, out - buffer);
+            out = buffer;
+            if (it - run > k_STRING_BUFFER_SIZE - k_ESCAPE_ROOM) {
+                stream.write(run, it - run);
+                run = it;
             }
         }
-        else {
-            str += *it;
+        bsl::memcpy(out, run, it - run);
+        out += it - run;
+
+        if (it == end) {
+            break;
         }
 
-        stream << str;
+        const unsigned char ch     = static_cast<unsigned char>(*it++);
+        const char          escape = ESCAPE_TABLE[ch];
+
+        *out++ = '\\';
+        *out++ = escape;
+        if ('u' == escape) {
+            *out++ = '0';
+            *out++ = '0';
+            *out++ = "0123456789abcdef"[ch >> 4];
+            *out++ = "0123456789abcdef"[ch & 0xf];
+        }
     }
 
-    stream << '"';
+    *out++ = '"';
+    stream.write(buffer, out - buffer);
     return 0;
 }
 }  // close package namespace
@@ -32,6 +32,8 @@ BSLS_IDENT("$Id: $")
 //  double               number
 //  char *               string
 //  bsl::string          string
+//  bsl::basic_inplace_string<char, N>
+//                       string
 //  bdlt::Date           string     ISO 8601 format
 //  bdlt::DateTz         string     ISO 8601 format
 //  bdlt::Time           string     ISO 8601 format
@@ -39,6 +41,10 @@ BSLS_IDENT("$Id: $")
 //  bdlt::Datetime       string     ISO 8601 format
 //  bdlt::DatetimeTz     string     ISO 8601 format
 //..
+// A 'float' or 'double' value is encoded using the fewest significant digits
+// that convert back to exactly the same value (see 'bdlb_floatconvertutil'),
+// so that encoding and decoding a value loses no information.  Infinite and
+// NaN values cannot be encoded.
 //
 ///Usage
 ///-----
@@ -108,6 +114,18 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_float.h>
 #endif
 
+#ifndef INCLUDED_BDLB_FLOATCONVERTUTIL
+#include <bdlb_floatconvertutil.h>
+#endif
+
+#ifndef INCLUDED_BDLB_INTEGERFORMATUTIL
+#include <bdlb_integerformatutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_INPLACESTRING
+#include <bslstl_inplacestring.h>
+#endif
+
 #ifndef INCLUDED_BSLS_TYPES
 #include <bsls_types.h>
 #endif
@@ -149,10 +167,19 @@ struct PrintUtil {
         // Encode the specified 'value' into JSON using ISO 8601 format and
         // output the result to the specified 'stream'.
 
+    template <class TYPE>
+    static void printInteger(bsl::ostream& stream, TYPE value);
+        // Output to the specified 'stream' the decimal representation of the
+        // specified integral 'value'.  Note that, unlike 'operator<<', this
+        // function ignores the formatting flags of 'stream'.
+
     template <class TYPE>
     static int printFloatingPoint(bsl::ostream& stream, TYPE value);
-        // Encode the specified floating point 'value' into JSON and output the
-        // result to the specified 'stream'.
+        // Encode the specified floating point 'value' into JSON, using the
+        // fewest significant digits that convert back to 'value', and output
+        // the result to the specified 'stream'.  Return 0 on success, and a
+        // non-zero value, with no effect on 'stream', if 'value' is infinite
+        // or NaN.
 
     static int printString(bsl::ostream&            stream,
                            const bslstl::StringRef& value);
@@ -175,6 +202,10 @@ struct PrintUtil {
     static int printValue(bsl::ostream& stream, double                  value);
     static int printValue(bsl::ostream& stream, const char             *value);
     static int printValue(bsl::ostream& stream, const bsl::string&      value);
+    template <bsl::size_t CAPACITY>
+    static int printValue(
+                     bsl::ostream&                                    stream,
+                     const bsl::basic_inplace_string<char, CAPACITY>& value);
     static int printValue(bsl::ostream& stream, const bdlt::Time&       value);
     static int printValue(bsl::ostream& stream, const bdlt::Date&       value);
     static int printValue(bsl::ostream& stream, const bdlt::Datetime&   value);
@@ -199,9 +230,27 @@ template <class TYPE>
 inline
 int PrintUtil::printDateAndTime(bsl::ostream& stream, const TYPE& value)
 {
-    char buffer[bdlt::Iso8601Util::k_MAX_STRLEN + 1];
-    bdlt::Iso8601Util::generate(buffer, sizeof buffer, value);
-    return printValue(stream, buffer);
+    // ISO 8601 text never needs escaping, so write it, quoted, directly.
+
+    char      buffer[bdlt::Iso8601Util::k_MAX_STRLEN + 3];
+    const int length = bdlt::Iso8601Util::generate(
+                                           buffer + 1,
+                                           bdlt::Iso8601Util::k_MAX_STRLEN + 1,
+                                           value);
+    buffer[0]          = '"';
+    buffer[length + 1] = '"';
+    stream.write(buffer, length + 2);
+    return 0;
+}
+
+template <class TYPE>
+inline
+void PrintUtil::printInteger(bsl::ostream& stream, TYPE value)
+{
+    char      buffer[bdlb::IntegerFormatUtil::k_MAX_DECIMAL_LENGTH];
+    const int length = bdlb::IntegerFormatUtil::formatDecimal(buffer, value);
+
+    stream.write(buffer, length);
 }
 
 template <class TYPE>
@@ -213,15 +262,13 @@ int PrintUtil::printFloatingPoint(bsl::ostream& stream, TYPE value)
         return -1;                                                    // RETURN
     }
 
-    bsl::streamsize         prec  = stream.precision();
-    bsl::ios_base::fmtflags flags = stream.flags();
-
-    stream.precision(bsl::numeric_limits<TYPE>::digits10);
+    char      buffer[bdlb::FloatConvertUtil::k_MAX_SHORTEST_LENGTH];
+    const int length = bdlb::FloatConvertUtil::formatShortest(
+                                      buffer,
+                                      value,
+                                      bsl::numeric_limits<TYPE>::digits10);
 
-    stream << value;
-
-    stream.precision(prec);
-    stream.flags(flags);
+    stream.write(buffer, length);
     return 0;
 }
 
@@ -235,49 +282,49 @@ int PrintUtil::printValue(bsl::ostream& stream, bool value)
 inline
 int PrintUtil::printValue(bsl::ostream& stream, short value)
 {
-    stream << value;
+    printInteger(stream, value);
     return 0;
 }
 
 inline
 int PrintUtil::printValue(bsl::ostream& stream, int value)
 {
-    stream << value;
+    printInteger(stream, value);
     return 0;
 }
 
 inline
 int PrintUtil::printValue(bsl::ostream& stream, bsls::Types::Int64 value)
 {
-    stream << value;
+    printInteger(stream, value);
     return 0;
 }
 
 inline
 int PrintUtil::printValue(bsl::ostream& stream, unsigned char value)
 {
-    stream << static_cast<int>(value);
+    printInteger(stream, value);
     return 0;
 }
 
 inline
 int PrintUtil::printValue(bsl::ostream& stream, unsigned short value)
 {
-    stream << value;
+    printInteger(stream, value);
     return 0;
 }
 
 inline
 int PrintUtil::printValue(bsl::ostream& stream, unsigned int value)
 {
-    stream << value;
+    printInteger(stream, value);
     return 0;
 }
 
 inline
 int PrintUtil::printValue(bsl::ostream& stream, bsls::Types::Uint64 value)
 {
-    stream << value;
+    printInteger(stream, value);
     return 0;
 }
 
@@ -304,7 +351,7 @@ int PrintUtil::printValue(bsl::ostream& stream, char value)
 {
     signed char tmp(value);  // Note that 'char' is unsigned on IBM.
 
-    stream << static_cast<int>(tmp);
+    printInteger(stream, tmp);
     return 0;
 }
 
@@ -314,6 +361,16 @@ int PrintUtil::printValue(bsl::ostream& stream, const bsl::string& value)
     return printString(stream, value);
 }
 
+template <bsl::size_t CAPACITY>
+inline
+int PrintUtil::printValue(
+                      bsl::ostream&                                    stream,
+                      const bsl::basic_inplace_string<char, CAPACITY>& value)
+{
+    return printString(stream,
+                       bslstl::StringRef(value.data(), value.length()));
+}
+
 inline
 int PrintUtil::printValue(bsl::ostream& stream, const bdlt::Time& value)
 {
@@ -6,6 +6,8 @@
 #include <bsl_sstream.h>
 #include <bsl_string.h>
 
+#include <bslstl_inplacestring.h>
+
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 #include <bdlt_date.h>
@@ -13,7 +15,9 @@
 #include <bdlt_datetime.h>
 #include <bdlt_datetimetz.h>
 
+#include <bsl_cfloat.h>
 #include <bsl_climits.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
 
@@ -52,6 +56,7 @@ using bsl::endl;
 // [ 4] static int printValue(bsl::ostream& s, double                  v);
 // [ 3] static int printValue(bsl::ostream& s, const char             *v);
 // [ 3] static int printValue(bsl::ostream& s, const bsl::string&      v);
+// [ 3] static int printValue(ostream& s, const basic_inplace_string& v);
 // [ 5] static int printValue(bsl::ostream& s, const bdlt::Time&        v);
 // [ 5] static int printValue(bsl::ostream& s, const bdlt::Date&        v);
 // [ 5] static int printValue(bsl::ostream& s, const bdlt::Datetime&    v);
@@ -157,6 +162,38 @@ void testNumber()
     }
 }
 
+bsl::string escapeOneByOne(const bsl::string& value)
+    // Return the JSON string literal for the specified 'value', computed one
+    // character at a time.
+{
+    bsl::string result("\"");
+    for (bsl::size_t i = 0; i < value.length(); ++i) {
+        const char ch = value[i];
+        switch (ch) {
+          case '"':  result += "\\\""; break;
+          case '\\': result += "\\\\"; break;
+          case '/':  result += "\\/";  break;
+          case '\b': result += "\\b";  break;
+          case '\f': result += "\\f";  break;
+          case '\n': result += "\\n";  break;
+          case '\r': result += "\\r";  break;
+          case '\t': result += "\\t";  break;
+          default: {
+            if (0 <= ch && ch < 32) {
+                char buffer[8];
+                sprintf(buffer, "\\u%04x", static_cast<int>(ch));
+                result += buffer;
+            }
+            else {
+                result += ch;
+            }
+          }
+        }
+    }
+    result += '"';
+    return result;
+}
+
 int main(int argc, char *argv[])
 {
     int test = argc > 1 ? atoi(argv[1]) : 0;
@@ -471,6 +508,12 @@ int main(int argc, char *argv[])
         //: 2 Encoded numbers used default format.
         //:
         //: 3 Encoding 'unsigned char' prints a number instead of string.
+        //:
+        //: 4 Encoded floating point numbers have the fewest significant digits
+        //:   that convert back to the encoded value, even if more than
+        //:   'digits10' digits are needed.
+        //:
+        //: 5 Integers having any number of digits are encoded correctly.
         //
         // Plan:
         //: 1 Use the table-driven technique:
@@ -479,6 +522,10 @@ int main(int argc, char *argv[])
         //:     the precision of the output.
         //:
         //:   2 Encode each value and verify the output is as expected.
+        //:
+        //: 2 Encode powers of ten, and their neighbors, having every number
+        //:   of digits, and compare the output with that of 'operator<<'.
+        //:   (C-5)
         //
         // Testing:
         //  static int printValue(bsl::ostream& s, char                    v);
@@ -514,15 +561,13 @@ int main(int argc, char *argv[])
                 { L_,           10.0f,  "10" },
                 { L_,           -1.5f,  "-1.5" },
                 { L_,         -1.5e1f,  "-15" },
-#if defined(BSLS_PLATFORM_OS_WINDOWS)
-                { L_,   -1.23456e-20f,  "-1.23456e-020" },
-                { L_,    1.23456e-20f,  "1.23456e-020" },
-#else
                 { L_,   -1.23456e-20f,  "-1.23456e-20" },
                 { L_,    1.23456e-20f,  "1.23456e-20" },
-#endif
                 { L_,         1.0e-1f,  "0.1" },
-                { L_,       0.123456f,  "0.123456" }
+                { L_,       0.123456f,  "0.123456" },
+                { L_,     1.0f / 3.0f,  "0.33333334" },
+                { L_,      1234567.0f,  "1.234567e+06" },
+                { L_,         FLT_MAX,  "3.4028235e+38" }
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -585,7 +630,11 @@ int main(int argc, char *argv[])
                 { L_,           3.14e300,  "3.14e+300" },
                 { L_,             1.0e-1,  "0.1" },
                 { L_,          2.23e-308,  "2.23e-308" },
-                { L_,   0.12345678912345,  "0.12345678912345" }
+                { L_,   0.12345678912345,  "0.12345678912345" },
+                { L_,          0.1 + 0.2,  "0.30000000000000004" },
+                { L_,          1.0 / 3.0,  "0.3333333333333333" },
+                { L_,            DBL_MAX,  "1.7976931348623157e+308" },
+                { L_,            DBL_MIN,  "2.2250738585072014e-308" }
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -638,6 +687,46 @@ int main(int argc, char *argv[])
             testNumber<unsigned int>();
             testNumber<Uint64>();
         }
+
+        if (verbose) cout << "Encode integers of every length" << endl;
+        {
+            Uint64 power = 1;
+            for (int digits = 1; digits <= 20; ++digits) {
+                for (int delta = -1; delta <= 1; ++delta) {
+                    const Uint64 VALUE = power + delta;
+
+                    bsl::ostringstream exp;
+                    exp << VALUE;
+
+                    bsl::ostringstream oss;
+                    ASSERTV(VALUE, 0 == Obj::printValue(oss, VALUE));
+                    ASSERTV(VALUE, exp.str(), oss.str(),
+                            exp.str() == oss.str());
+
+                    if (digits < 19) {
+                        const Int64 NEGATIVE = -static_cast<Int64>(VALUE);
+
+                        bsl::ostringstream expNegative;
+                        expNegative << NEGATIVE;
+
+                        bsl::ostringstream ossNegative;
+                        ASSERTV(NEGATIVE,
+                                0 == Obj::printValue(ossNegative, NEGATIVE));
+                        ASSERTV(NEGATIVE, expNegative.str(), ossNegative.str(),
+                                expNegative.str() == ossNegative.str());
+                    }
+                }
+                if (digits < 20) {
+                    power *= 10;
+                }
+            }
+
+            bsl::ostringstream oss;
+            ASSERT(0 == Obj::printValue(
+                                    oss,
+                                    bsl::numeric_limits<Uint64>::max()));
+            ASSERTV(oss.str(), "18446744073709551615" == oss.str());
+        }
       } break;
       case 3: {
         // --------------------------------------------------------------------
@@ -651,6 +740,9 @@ int main(int argc, char *argv[])
         //: 3 Control characters are encoded as hex.
         //:
         //: 4 Invalid UTF-8 strings are rejected.
+        //:
+        //: 5 Strings longer than the internal buffer used for escaping, and
+        //:   escaped characters at any position, are encoded correctly.
         //
         // Plan:
         //: 1 Using the table-driven technique:
@@ -660,11 +752,16 @@ int main(int argc, char *argv[])
         //:
         //:   2 Encode the value and verify the results.
         //:
-        //: 2 Repeat for strings and Customized type.
+        //: 2 Repeat for strings, in-place strings, and Customized type.
+        //:
+        //: 3 Encode strings of many lengths having escaped characters at many
+        //:   positions, and compare the results with those of a simple
+        //:   character-by-character implementation.  (C-5)
         //
         // Testing:
         //  static int printValue(bsl::ostream& s, const char             *v);
         //  static int printValue(bsl::ostream& s, const bsl::string&      v);
+        //  static int printValue(ostream& s, const basic_inplace_string& v);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -729,9 +826,51 @@ int main(int argc, char *argv[])
                     bsl::string result = oss.str();
                     ASSERTV(LINE, result, EXP, result == EXP);
                 }
+
+                if (veryVeryVerbose) cout << "Test 'inplace_string'" << endl;
+                {
+                    typedef bsl::basic_inplace_string<char, 64> InplaceString;
+
+                    bsl::ostringstream oss;
+                    ASSERTV(LINE, 0 == Obj::printValue(oss,
+                                                       InplaceString(VALUE)));
+
+                    bsl::string result = oss.str();
+                    ASSERTV(LINE, result, EXP, result == EXP);
+                }
             }
         }
 
+        if (verbose) cout << "Encode long strings" << endl;
+        {
+            // Place escaped characters at every position of strings of
+            // lengths around the size of the buffer used by 'printString'.
+
+            const char ESCAPED[] = { '"', '\x01', '\n', '/' };
+
+            for (int len = 0; len < 600; len += (len < 240 ? 37 : 1)) {
+                for (int pos = 0; pos <= len; pos += 1 + len / 16) {
+                    for (int e = 0; e < 4; ++e) {
+                        bsl::string value(len, 'x');
+                        for (int i = pos; i < len; i += 255) {
+                            value[i] = ESCAPED[e];
+                        }
+
+                        const bsl::string EXP = escapeOneByOne(value);
+
+                        bsl::ostringstream oss;
+                        ASSERTV(len, pos, 0 == Obj::printValue(oss, value));
+                        ASSERTV(len, pos, e, EXP == oss.str());
+                    }
+                }
+            }
+
+            bsl::string value(2000, '\t');
+            bsl::ostringstream oss;
+            ASSERT(0 == Obj::printValue(oss, value));
+            ASSERT(escapeOneByOne(value) == oss.str());
+        }
+
         if (verbose) cout << "Encode invalid UTF-8 string" << endl;
         {
             const struct {
@@ -766,6 +905,15 @@ int main(int argc, char *argv[])
                     ASSERTV(LINE, 0 != Obj::printValue(oss,
                                                        bsl::string(VALUE)));
                 }
+
+                if (veryVeryVerbose) cout << "Test 'inplace_string'" << endl;
+                {
+                    typedef bsl::basic_inplace_string<char, 8> InplaceString;
+
+                    bsl::ostringstream oss;
+                    ASSERTV(LINE, 0 != Obj::printValue(oss,
+                                                       InplaceString(VALUE)));
+                }
             }
         }
       } break;
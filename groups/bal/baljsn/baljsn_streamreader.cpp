@@ -0,0 +1,119 @@
+// baljsn_streamreader.cpp                                            -*-C++-*-
+#include <baljsn_streamreader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_streamreader_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace baljsn {
+
+                             // ------------------
+                             // class StreamReader
+                             // ------------------
+
+// CREATORS
+StreamReader::StreamReader(bslma::Allocator *basicAllocator)
+: d_tokenizer(basicAllocator)
+, d_decoder(basicAllocator)
+, d_options()
+, d_depth(0)
+, d_isAtEndOfArray(false)
+{
+    d_tokenizer.setAllowStandAloneValues(false);
+}
+
+StreamReader::StreamReader(const DecoderOptions&  options,
+                           bslma::Allocator      *basicAllocator)
+: d_tokenizer(basicAllocator)
+, d_decoder(basicAllocator)
+, d_options(options)
+, d_depth(0)
+, d_isAtEndOfArray(false)
+{
+    d_tokenizer.setAllowStandAloneValues(false);
+}
+
+// MANIPULATORS
+void StreamReader::reset(bsl::streambuf *streamBuf)
+{
+    BSLS_ASSERT(streamBuf);
+
+    d_tokenizer.reset(streamBuf);
+    d_depth          = 0;
+    d_isAtEndOfArray = false;
+}
+
+int StreamReader::advanceToNextToken()
+{
+    if (0 == d_depth
+     && (Tokenizer::e_END_OBJECT == d_tokenizer.tokenType()
+      || Tokenizer::e_END_ARRAY  == d_tokenizer.tokenType())) {
+        // The current token ends the document.  Do not read past it, so that
+        // the stream buffer may hold other data following the document.
+
+        return 1;                                                     // RETURN
+    }
+
+    if (0 != d_tokenizer.advanceToNextToken()) {
+        return -1;                                                    // RETURN
+    }
+
+    d_isAtEndOfArray = false;
+    updateDepth();
+    return 0;
+}
+
+int StreamReader::skipValue()
+{
+    Tokenizer::TokenType endTokenType;
+
+    switch (d_tokenizer.tokenType()) {
+      case Tokenizer::e_ELEMENT_VALUE: {
+        return 0;                                                     // RETURN
+      }
+      case Tokenizer::e_START_OBJECT: {
+        endTokenType = Tokenizer::e_END_OBJECT;
+      } break;
+      case Tokenizer::e_START_ARRAY: {
+        endTokenType = Tokenizer::e_END_ARRAY;
+      } break;
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+
+    // Read tokens until the one ending the object or array begun by the
+    // current token, i.e., until the depth returns to that of the token
+    // preceding the current one.  Note that the tokenizer verifies the order
+    // of the tokens, but not that each object or array is ended by a token of
+    // the matching kind, which we verify only for the value being skipped.
+
+    const int depth = d_depth - 1;
+    do {
+        if (0 != d_tokenizer.advanceToNextToken()) {
+            return -1;                                                // RETURN
+        }
+        updateDepth();
+    } while (d_depth != depth);
+
+    return endTokenType == d_tokenizer.tokenType() ? 0 : -1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
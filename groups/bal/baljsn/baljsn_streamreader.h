@@ -0,0 +1,416 @@
+// baljsn_streamreader.h                                              -*-C++-*-
+#ifndef INCLUDED_BALJSN_STREAMREADER
+#define INCLUDED_BALJSN_STREAMREADER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a pull reader for decoding JSON documents piecewise.
+//
+//@CLASSES:
+//  baljsn::StreamReader: reader of JSON tokens and 'bdeat'-compatible values
+//
+//@SEE_ALSO: baljsn_decoder, baljsn_tokenizer
+//
+//@DESCRIPTION: This component provides a class, 'baljsn::StreamReader', that
+// reads a JSON document from a 'bsl::streambuf' one token at a time, and that
+// can decode any value in the document into a 'bdeat'-compatible object (see
+// the 'bdlat' package), instead of decoding the whole document into a single
+// object as 'baljsn::Decoder' does.  In particular, the 'decodeNextElement'
+// function decodes the elements of an array one at a time into the same
+// object, so that an array of any length can be processed with memory
+// proportional to the size of one element.
+//
+// The reader is a "pull" reader: the client calls 'advanceToNextToken' to move
+// to the next token of the document, and inspects the current token with the
+// 'tokenType', 'value', and 'depth' accessors.  When the current token is the
+// first token of a value (i.e., '{', '[', or a simple value), the client may
+// instead decode the value with 'decodeValue', or skip it with 'skipValue';
+// both leave the reader on the last token of the value.  The client may mix
+// these operations freely, e.g., to find an array nested in an object, then
+// decode its elements.
+//
+// The reader reads from the stream buffer in blocks of a fixed size, and holds
+// neither the document nor a stack of the enclosing objects and arrays, so it
+// uses the same amount of memory for a document of any size, excluding the
+// memory used by the objects into which it decodes values.
+//
+///Return Values
+///-------------
+// The functions of this component that read from the document return 0 on
+// success, a positive value if the end of the document or array being read
+// has been reached, and a negative value if the input is not valid JSON or
+// cannot be decoded into the given object.  The reader is left in an
+// unspecified (but valid) state after a negative value is returned, and must
+// be 'reset' before reading another document.  Messages describing decoding
+// errors are available from 'loggedMessages'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Processing a Large Array One Element at a Time
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a JSON document, possibly far larger than the memory we may
+// use, holding an array of requests nested within an object:
+//..
+//  const char INPUT[] =
+//      "{\n"
+//      "  \"source\": \"snapshot\",\n"
+//      "  \"requests\": [\n"
+//      "    { \"data\": \"first\",  \"responseLength\": 1 },\n"
+//      "    { \"data\": \"second\", \"responseLength\": 2 },\n"
+//      "    { \"data\": \"third\",  \"responseLength\": 3 }\n"
+//      "  ]\n"
+//      "}";
+//
+//  bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+//..
+// and that 'balb::SimpleRequest' is a 'bas_codegen.pl'-generated type having
+// a 'data' string attribute and a 'responseLength' integer attribute.
+//
+// First, we create a reader of the document:
+//..
+//  baljsn::StreamReader reader;
+//  reader.reset(&isb);
+//..
+// Next, we read the tokens of the document until we find the array named
+// "requests", skipping the value of any other member of the outer object:
+//..
+//  int rc = reader.advanceToNextToken();
+//  assert(0 == rc);
+//  assert(baljsn::Tokenizer::e_START_OBJECT == reader.tokenType());
+//
+//  bslstl::StringRef name;
+//  while (0 == (rc = reader.advanceToNextToken())
+//      && baljsn::Tokenizer::e_ELEMENT_NAME == reader.tokenType()) {
+//      rc = reader.value(&name);
+//      assert(0 == rc);
+//
+//      rc = reader.advanceToNextToken();
+//      assert(0 == rc);
+//
+//      if ("requests" == name) {
+//          break;
+//      }
+//
+//      rc = reader.skipValue();
+//      assert(0 == rc);
+//  }
+//  assert(baljsn::Tokenizer::e_START_ARRAY == reader.tokenType());
+//  assert(2                                == reader.depth());
+//..
+// Then, we decode the elements of the array one at a time into the same
+// object, processing each element before decoding the next one.  Here we just
+// total the requested lengths; a real application might instead give a copy
+// of each element to a thread pool (e.g., a 'bdlmt::ThreadPool'):
+//..
+//  balb::SimpleRequest request;
+//  int                 numRequests = 0;
+//  int                 totalLength = 0;
+//
+//  while (0 == (rc = reader.decodeNextElement(&request))) {
+//      ++numRequests;
+//      totalLength += request.responseLength();
+//  }
+//..
+// Now, we verify that the loop ended at the end of the array, rather than
+// because of an error, and that every element was processed:
+//..
+//  assert(0 < rc);
+//  assert(baljsn::Tokenizer::e_END_ARRAY == reader.tokenType());
+//  assert(3                              == numRequests);
+//  assert(6                              == totalLength);
+//  assert("third"                        == request.data());
+//..
+// Finally, we read the end of the outer object, and verify that the document
+// is complete:
+//..
+//  rc = reader.advanceToNextToken();
+//  assert(0 == rc);
+//  assert(baljsn::Tokenizer::e_END_OBJECT == reader.tokenType());
+//  assert(0                               == reader.depth());
+//
+//  rc = reader.advanceToNextToken();
+//  assert(0 < rc);
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALJSN_DECODER
+#include <baljsn_decoder.h>
+#endif
+
+#ifndef INCLUDED_BALJSN_DECODEROPTIONS
+#include <baljsn_decoderoptions.h>
+#endif
+
+#ifndef INCLUDED_BALJSN_TOKENIZER
+#include <baljsn_tokenizer.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSL_STREAMBUF
+#include <bsl_streambuf.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+namespace BloombergLP {
+namespace baljsn {
+
+                             // ==================
+                             // class StreamReader
+                             // ==================
+
+class StreamReader {
+    // This class provides a mechanism for reading a JSON document from a
+    // 'bsl::streambuf' one token at a time, and for decoding any value in the
+    // document into a 'bdeat'-compatible object.  See the component-level
+    // documentation for details.
+
+    // DATA
+    Tokenizer      d_tokenizer;  // JSON tokenizer
+    Decoder        d_decoder;    // decoder of values
+    DecoderOptions d_options;    // options used to decode values
+    int            d_depth;      // number of objects and arrays entered and
+                                 // not yet exited
+
+    bool           d_isAtEndOfArray;
+                                 // 'true' if the last call to
+                                 // 'decodeNextElement' reached the end of the
+                                 // array, and this reader has not moved since
+
+    // PRIVATE MANIPULATORS
+    void updateDepth();
+        // Update the depth of this reader for the current token, which was
+        // just read.
+
+    // NOT IMPLEMENTED
+    StreamReader(const StreamReader&);
+    StreamReader& operator=(const StreamReader&);
+
+  public:
+    // CREATORS
+    explicit StreamReader(bslma::Allocator *basicAllocator = 0);
+    explicit StreamReader(const DecoderOptions&  options,
+                          bslma::Allocator      *basicAllocator = 0);
+        // Create a reader that is not reading a document.  Optionally specify
+        // 'options' with which to decode values; if 'options' is not
+        // specified, default-constructed options are used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  Note that 'options.maxDepth()' limits the depth of each
+        // decoded value, counted from that value, and does not limit the
+        // depth of tokens read with 'advanceToNextToken'.
+
+    //! ~StreamReader() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset(bsl::streambuf *streamBuf);
+        // Reset this reader to read a JSON document from the specified
+        // 'streamBuf'.  Note that the reader is not on a valid token until
+        // 'advanceToNextToken' is called.
+
+    int advanceToNextToken();
+        // Move to the next token of the document.  Return 0 on success, a
+        // positive value, with no effect, if the current token ends the
+        // document, and a negative value otherwise.  Note that the document
+        // ends with the token ending its outermost object or array, and that
+        // each call to this function invalidates the string references
+        // returned by 'value' for prior tokens.
+
+    template <class TYPE>
+    int decodeValue(TYPE *value);
+        // Decode into the specified 'value', of the (template parameter)
+        // 'TYPE', the JSON value beginning at the current token, and leave
+        // this reader on the last token of that value.  'TYPE' shall be a
+        // 'bdeat'-compatible type.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless the current token is
+        // the first token of a value (i.e., its type is 'e_START_OBJECT',
+        // 'e_START_ARRAY', or 'e_ELEMENT_VALUE').
+
+    template <class TYPE>
+    int decodeNextElement(TYPE *element);
+        // Move to the next element of the array being read and decode it into
+        // the specified 'element', of the (template parameter) 'TYPE', leaving
+        // this reader on the last token of the element.  If the array has no
+        // more elements, move to the token ending the array, if this reader
+        // is not already on it, and leave 'element' unchanged.  'TYPE' shall
+        // be a 'bdeat'-compatible type.  Return 0 if an element was decoded,
+        // a positive value if the end of the array was reached (by this call
+        // or by a previous call that returned a positive value, this reader
+        // not having moved since), and a negative value otherwise.  The
+        // behavior is undefined unless the current token begins an array
+        // (i.e., its type is 'e_START_ARRAY'), is the last token of an element
+        // of an array, or is the token ending an array reached by the
+        // previous call to this function.
+
+    int skipValue();
+        // Skip the JSON value beginning at the current token, and leave this
+        // reader on the last token of that value.  Return 0 on success, and a
+        // non-zero value otherwise.  The behavior is undefined unless the
+        // current token is the first token of a value.
+
+    // ACCESSORS
+    int depth() const;
+        // Return the number of objects and arrays that contain the current
+        // token, including the object or array begun by the current token,
+        // if any, and excluding the object or array ended by the current
+        // token, if any.
+
+    bsl::string loggedMessages() const;
+        // Return a string containing any error messages that were logged
+        // during the last call to 'decodeValue' or 'decodeNextElement'.
+
+    Tokenizer::TokenType tokenType() const;
+        // Return the type of the current token.
+
+    int value(bslstl::StringRef *data) const;
+        // Load into the specified 'data' the text of the current token if its
+        // type is 'e_ELEMENT_NAME' or 'e_ELEMENT_VALUE', and leave 'data'
+        // unmodified otherwise.  Return 0 on success, and a non-zero value
+        // otherwise.  Note that the text of a string value includes its
+        // quotes and escape sequences (see 'baljsn_parserutil').
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class StreamReader
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+inline
+void StreamReader::updateDepth()
+{
+    switch (d_tokenizer.tokenType()) {
+      case Tokenizer::e_START_OBJECT:
+      case Tokenizer::e_START_ARRAY: {
+        ++d_depth;
+      } break;
+      case Tokenizer::e_END_OBJECT:
+      case Tokenizer::e_END_ARRAY: {
+        --d_depth;
+      } break;
+      default: {
+      } break;
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+int StreamReader::decodeValue(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    const Tokenizer::TokenType tokenType = d_tokenizer.tokenType();
+
+    const int rc = d_decoder.decode(&d_tokenizer, value, d_options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // The decoder leaves the tokenizer on the last token of the value, which
+    // ends the object or array begun by the first token of the value, if any.
+
+    if (Tokenizer::e_START_OBJECT == tokenType
+     || Tokenizer::e_START_ARRAY  == tokenType) {
+        --d_depth;
+    }
+    return 0;
+}
+
+template <class TYPE>
+int StreamReader::decodeNextElement(TYPE *element)
+{
+    BSLS_ASSERT(element);
+
+    if (d_isAtEndOfArray) {
+        // A previous call reached the end of the array.
+
+        return 1;                                                     // RETURN
+    }
+
+    const int rc = advanceToNextToken();
+    if (0 != rc) {
+        return -1;                                                    // RETURN
+    }
+
+    switch (d_tokenizer.tokenType()) {
+      case Tokenizer::e_START_OBJECT:
+      case Tokenizer::e_START_ARRAY:
+      case Tokenizer::e_ELEMENT_VALUE: {
+        return 0 == decodeValue(element) ? 0 : -1;                    // RETURN
+      }
+      case Tokenizer::e_END_ARRAY: {
+        d_isAtEndOfArray = true;
+        return 1;                                                     // RETURN
+      }
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+}
+
+// ACCESSORS
+inline
+int StreamReader::depth() const
+{
+    return d_depth;
+}
+
+inline
+bsl::string StreamReader::loggedMessages() const
+{
+    return d_decoder.loggedMessages();
+}
+
+inline
+Tokenizer::TokenType StreamReader::tokenType() const
+{
+    return d_tokenizer.tokenType();
+}
+
+inline
+int StreamReader::value(bslstl::StringRef *data) const
+{
+    return d_tokenizer.value(data);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1211 @@
+// baljsn_streamreader.t.cpp                                          -*-C++-*-
+#include <baljsn_streamreader.h>
+
+#include <balb_testmessages.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>        // for testing only
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test implements a reader that moves through a JSON
+// document one token at a time, keeping track of the depth of the current
+// token, and that decodes or skips whole values using 'baljsn::Decoder' and
+// 'baljsn::Tokenizer'.  We verify the sequence of tokens and depths read from
+// a set of documents, that 'skipValue' and 'decodeValue' leave the reader on
+// the last token of a value, and that 'decodeNextElement' decodes the
+// elements of an array one at a time.  Finally, we verify that reading an
+// array uses the same amount of memory whatever the number of its elements.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] baljsn::StreamReader(bslma::Allocator *bA = 0);
+// [ 4] baljsn::StreamReader(const DecoderOptions& o, Allocator *bA);
+// [ 2] ~baljsn::StreamReader();
+//
+// MANIPULATORS
+// [ 2] void reset(bsl::streambuf *streamBuf);
+// [ 2] int advanceToNextToken();
+// [ 4] int decodeValue(TYPE *value);
+// [ 4] int decodeNextElement(TYPE *element);
+// [ 3] int skipValue();
+//
+// ACCESSORS
+// [ 2] int depth() const;
+// [ 4] bsl::string loggedMessages() const;
+// [ 2] Tokenizer::TokenType tokenType() const;
+// [ 2] int value(bslstl::StringRef *data) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: READING AN ARRAY USES CONSTANT MEMORY
+// [ 6] CONCERN: 'decodeNextElement' KEEPS REPORTING THE END OF AN ARRAY
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: DECODING A LARGE ARRAY
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::StreamReader Obj;
+typedef baljsn::Tokenizer    Tokenizer;
+
+char tokenCode(Tokenizer::TokenType tokenType)
+    // Return the character identifying the specified 'tokenType' in the
+    // token strings of the tables of this test driver.
+{
+    switch (tokenType) {
+      case Tokenizer::e_BEGIN:         return 'B';                    // RETURN
+      case Tokenizer::e_ELEMENT_NAME:  return 'n';                    // RETURN
+      case Tokenizer::e_START_OBJECT:  return '{';                    // RETURN
+      case Tokenizer::e_END_OBJECT:    return '}';                    // RETURN
+      case Tokenizer::e_START_ARRAY:   return '[';                    // RETURN
+      case Tokenizer::e_END_ARRAY:     return ']';                    // RETURN
+      case Tokenizer::e_ELEMENT_VALUE: return 'v';                    // RETURN
+      case Tokenizer::e_ERROR:         return 'E';                    // RETURN
+    }
+    return '?';
+}
+
+int readTokens(bsl::string *tokens, bsl::string *depths, Obj *reader)
+    // Read the tokens of the document being read by the specified 'reader'
+    // until 'advanceToNextToken' returns a non-zero value, appending to the
+    // specified 'tokens' the code of each token read (see 'tokenCode') and to
+    // the specified 'depths' the depth of each token read, and return the
+    // value last returned by 'advanceToNextToken'.
+{
+    int rc;
+    while (0 == (rc = reader->advanceToNextToken())) {
+        tokens->push_back(tokenCode(reader->tokenType()));
+        depths->push_back(static_cast<char>('0' + reader->depth()));
+    }
+    return rc;
+}
+
+                        // =============================
+                        // class GeneratedArrayStreamBuf
+                        // =============================
+
+class GeneratedArrayStreamBuf : public bsl::streambuf {
+    // This class provides an input stream buffer holding a JSON array of a
+    // specified number of 'balb::SimpleRequest' objects, that generates the
+    // text of each element when it is read, so that the array is never held
+    // in memory.  The 'responseLength' of element 'i' is 'i % 1000'.
+
+    // DATA
+    char d_buffer[128];    // text of the current element
+    int  d_numElements;    // number of elements of the array
+    int  d_next;           // index of the next element to generate, or
+                           // 'd_numElements + 1' after the end of the array
+
+  protected:
+    // PROTECTED MANIPULATORS
+    virtual int_type underflow()
+        // Generate the text following the text already read, if any, and
+        // return its first character, or end-of-file if the array has been
+        // read.
+    {
+        int length;
+
+        if (d_next < d_numElements) {
+            length = bsl::sprintf(
+                            d_buffer,
+                            "%c{\"data\":\"element\",\"responseLength\":%d}",
+                            0 == d_next ? '[' : ',',
+                            d_next % 1000);
+            ++d_next;
+        }
+        else if (d_next == d_numElements) {
+            length = bsl::sprintf(d_buffer, "%s", d_numElements ? "]" : "[]");
+            ++d_next;
+        }
+        else {
+            return traits_type::eof();                                // RETURN
+        }
+
+        setg(d_buffer, d_buffer, d_buffer + length);
+        return traits_type::to_int_type(d_buffer[0]);
+    }
+
+  public:
+    // CREATORS
+    explicit GeneratedArrayStreamBuf(int numElements)
+        // Create a stream buffer holding an array of the specified
+        // 'numElements' elements.
+    : d_numElements(numElements)
+    , d_next(0)
+    {
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Processing a Large Array One Element at a Time
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a JSON document, possibly far larger than the memory we may
+// use, holding an array of requests nested within an object:
+//..
+    const char INPUT[] =
+        "{\n"
+        "  \"source\": \"snapshot\",\n"
+        "  \"requests\": [\n"
+        "    { \"data\": \"first\",  \"responseLength\": 1 },\n"
+        "    { \"data\": \"second\", \"responseLength\": 2 },\n"
+        "    { \"data\": \"third\",  \"responseLength\": 3 }\n"
+        "  ]\n"
+        "}";
+
+    bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+//..
+// and that 'balb::SimpleRequest' is a 'bas_codegen.pl'-generated type having
+// a 'data' string attribute and a 'responseLength' integer attribute.
+//
+// First, we create a reader of the document:
+//..
+    baljsn::StreamReader reader;
+    reader.reset(&isb);
+//..
+// Next, we read the tokens of the document until we find the array named
+// "requests", skipping the value of any other member of the outer object:
+//..
+    int rc = reader.advanceToNextToken();
+    ASSERT(0 == rc);
+    ASSERT(baljsn::Tokenizer::e_START_OBJECT == reader.tokenType());
+
+    bslstl::StringRef name;
+    while (0 == (rc = reader.advanceToNextToken())
+        && baljsn::Tokenizer::e_ELEMENT_NAME == reader.tokenType()) {
+        rc = reader.value(&name);
+        ASSERT(0 == rc);
+
+        rc = reader.advanceToNextToken();
+        ASSERT(0 == rc);
+
+        if ("requests" == name) {
+            break;
+        }
+
+        rc = reader.skipValue();
+        ASSERT(0 == rc);
+    }
+    ASSERT(baljsn::Tokenizer::e_START_ARRAY == reader.tokenType());
+    ASSERT(2                                == reader.depth());
+//..
+// Then, we decode the elements of the array one at a time into the same
+// object, processing each element before decoding the next one.  Here we just
+// total the requested lengths; a real application might instead give a copy
+// of each element to a thread pool (e.g., a 'bdlmt::ThreadPool'):
+//..
+    balb::SimpleRequest request;
+    int                 numRequests = 0;
+    int                 totalLength = 0;
+
+    while (0 == (rc = reader.decodeNextElement(&request))) {
+        ++numRequests;
+        totalLength += request.responseLength();
+    }
+//..
+// Now, we verify that the loop ended at the end of the array, rather than
+// because of an error, and that every element was processed:
+//..
+    ASSERT(0 < rc);
+    ASSERT(baljsn::Tokenizer::e_END_ARRAY == reader.tokenType());
+    ASSERT(3                              == numRequests);
+    ASSERT(6                              == totalLength);
+    ASSERT("third"                        == request.data());
+//..
+// Finally, we read the end of the outer object, and verify that the document
+// is complete:
+//..
+    rc = reader.advanceToNextToken();
+    ASSERT(0 == rc);
+    ASSERT(baljsn::Tokenizer::e_END_OBJECT == reader.tokenType());
+    ASSERT(0                               == reader.depth());
+
+    rc = reader.advanceToNextToken();
+    ASSERT(0 < rc);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'decodeNextElement' KEEPS REPORTING THE END OF AN ARRAY
+        //
+        // Concerns:
+        //: 1 Once 'decodeNextElement' has returned a positive value, calling
+        //:   it again returns a positive value, and has no effect on the
+        //:   reader or on the element, whether the array is the outermost
+        //:   value of the document or is nested in an object.
+        //:
+        //: 2 A token ending an array that is an element of the array being
+        //:   read is not mistaken for the end of the array being read.
+        //:
+        //: 3 After the reader moves past the end of an array, or is reset,
+        //:   'decodeNextElement' reads the elements of the next array.
+        //
+        // Plan:
+        //: 1 Read each element of an outermost array, and of an array nested
+        //:   in an object, then call 'decodeNextElement' several more times,
+        //:   verifying the returned value, the token and depth of the reader,
+        //:   and the element.  (C-1)
+        //:
+        //: 2 Read the elements of an array of arrays, and verify that each
+        //:   element is decoded.  (C-2)
+        //:
+        //: 3 Read the elements of a second array following the first in the
+        //:   same document, and of an array in a document read after a
+        //:   'reset'.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: 'decodeNextElement' KEEPS REPORTING THE END OF AN ARRAY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: 'decodeNextElement' KEEPS REPORTING THE"
+                          << " END OF AN ARRAY" << endl
+                          << "================================================"
+                          << "================" << endl;
+
+        if (verbose) cout << "\nOutermost array." << endl;
+        {
+            const char INPUT[] = "[1, 2]";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            ASSERT(0 == mX.advanceToNextToken());
+
+            int element = 0;
+            ASSERT(0 == mX.decodeNextElement(&element));
+            ASSERT(0 == mX.decodeNextElement(&element));
+            ASSERT(2 == element);
+
+            for (int i = 0; i < 3; ++i) {
+                if (veryVerbose) { T_ P(i) }
+
+                ASSERTV(i, 0 < mX.decodeNextElement(&element));
+                ASSERTV(i, Tokenizer::e_END_ARRAY == X.tokenType());
+                ASSERTV(i, 0                      == X.depth());
+                ASSERTV(i, 2                      == element);
+            }
+
+            ASSERT(0 < mX.advanceToNextToken());
+        }
+
+        if (verbose) cout << "\nArrays nested in an object." << endl;
+        {
+            const char INPUT[] = "{\"first\": [1], \"second\": [3, 4]}";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            ASSERT(0                         == mX.advanceToNextToken());
+            ASSERT(0                         == mX.advanceToNextToken());
+            ASSERT(0                         == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_START_ARRAY  == X.tokenType());
+
+            int element = 0;
+            ASSERT(0 == mX.decodeNextElement(&element));
+            ASSERT(1 == element);
+
+            for (int i = 0; i < 3; ++i) {
+                if (veryVerbose) { T_ P(i) }
+
+                ASSERTV(i, 0 < mX.decodeNextElement(&element));
+                ASSERTV(i, Tokenizer::e_END_ARRAY == X.tokenType());
+                ASSERTV(i, 1                      == X.depth());
+                ASSERTV(i, 1                      == element);
+            }
+
+            ASSERT(0                         == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_ELEMENT_NAME == X.tokenType());
+            ASSERT(0                         == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_START_ARRAY  == X.tokenType());
+
+            ASSERT(0 == mX.decodeNextElement(&element));
+            ASSERT(3 == element);
+            ASSERT(0 == mX.decodeNextElement(&element));
+            ASSERT(4 == element);
+            ASSERT(0 <  mX.decodeNextElement(&element));
+            ASSERT(0 <  mX.decodeNextElement(&element));
+            ASSERT(Tokenizer::e_END_ARRAY == X.tokenType());
+
+            ASSERT(0                         == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_END_OBJECT   == X.tokenType());
+            ASSERT(0                         == X.depth());
+        }
+
+        if (verbose) cout << "\nArray of arrays." << endl;
+        {
+            const char INPUT[] = "[[1, 2], [], [3]]";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            ASSERT(0 == mX.advanceToNextToken());
+
+            bsl::vector<int> element;
+
+            ASSERT(0                      == mX.decodeNextElement(&element));
+            ASSERT(Tokenizer::e_END_ARRAY == X.tokenType());
+            ASSERT(1                      == X.depth());
+            ASSERT(2                      == element.size());
+
+            ASSERT(0                      == mX.decodeNextElement(&element));
+            ASSERT(Tokenizer::e_END_ARRAY == X.tokenType());
+            ASSERT(element.empty());
+
+            ASSERT(0                      == mX.decodeNextElement(&element));
+            ASSERT(1                      == element.size());
+            ASSERT(3                      == element[0]);
+
+            ASSERT(0                      <  mX.decodeNextElement(&element));
+            ASSERT(0                      == X.depth());
+            ASSERT(0                      <  mX.decodeNextElement(&element));
+            ASSERT(1                      == element.size());
+        }
+
+        if (verbose) cout << "\nReading after a reset." << endl;
+        {
+            const char INPUT1[] = "[]";
+            const char INPUT2[] = "[5]";
+
+            bdlsb::FixedMemInStreamBuf isb1(INPUT1, sizeof INPUT1 - 1);
+            bdlsb::FixedMemInStreamBuf isb2(INPUT2, sizeof INPUT2 - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb1);
+
+            ASSERT(0 == mX.advanceToNextToken());
+
+            int element = 0;
+            ASSERT(0 <  mX.decodeNextElement(&element));
+
+            mX.reset(&isb2);
+
+            ASSERT(0                       == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_START_ARRAY == X.tokenType());
+            ASSERT(0                       == mX.decodeNextElement(&element));
+            ASSERT(5                       == element);
+            ASSERT(0                       <  mX.decodeNextElement(&element));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: READING AN ARRAY USES CONSTANT MEMORY
+        //
+        // Concerns:
+        //: 1 The memory used to decode the elements of an array one at a time
+        //:   does not depend on the number of elements.
+        //:
+        //: 2 Every element of a long array is decoded.
+        //
+        // Plan:
+        //: 1 Using a stream buffer that generates the text of an array as it
+        //:   is read, decode arrays of increasing lengths, one element at a
+        //:   time, with a reader and an element using a test allocator.
+        //:   Verify that the maximum number of bytes in use is the same for
+        //:   every length, and that the sum of an attribute of the elements
+        //:   is as expected.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: READING AN ARRAY USES CONSTANT MEMORY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: READING AN ARRAY USES CONSTANT MEMORY"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int NUM_ELEMENTS[] = { 1, 10, 1000, 100000 };
+        const int NUM_LENGTHS    = sizeof NUM_ELEMENTS / sizeof *NUM_ELEMENTS;
+
+        bsls::Types::Int64 expectedMaxBytes = 0;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int N = NUM_ELEMENTS[ti];
+
+            bslma::TestAllocator ta("test", veryVeryVerbose);
+
+            {
+                GeneratedArrayStreamBuf sb(N);
+
+                Obj                 mX(&ta);
+                balb::SimpleRequest element(&ta);
+
+                mX.reset(&sb);
+                ASSERTV(N, 0 == mX.advanceToNextToken());
+                ASSERTV(N, Tokenizer::e_START_ARRAY == mX.tokenType());
+
+                bsls::Types::Int64 total = 0;
+                int                count = 0;
+                int                rc;
+                while (0 == (rc = mX.decodeNextElement(&element))) {
+                    ASSERTV(N, count, "element" == element.data());
+                    total += element.responseLength();
+                    ++count;
+                }
+
+                ASSERTV(N, rc, 0 < rc);
+                ASSERTV(N, count, N == count);
+                ASSERTV(N, 0 < mX.advanceToNextToken());
+
+                bsls::Types::Int64 expectedTotal = 0;
+                for (int i = 0; i < N; ++i) {
+                    expectedTotal += i % 1000;
+                }
+                ASSERTV(N, total, expectedTotal, expectedTotal == total);
+            }
+
+            if (veryVerbose) {
+                P_(N) P(ta.numBytesMax())
+            }
+
+            if (0 == ti) {
+                expectedMaxBytes = ta.numBytesMax();
+            }
+            else {
+                ASSERTV(N, expectedMaxBytes, ta.numBytesMax(),
+                        expectedMaxBytes == ta.numBytesMax());
+            }
+            ASSERTV(N, 0 == ta.numBytesInUse());
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'decodeValue' AND 'decodeNextElement'
+        //
+        // Concerns:
+        //: 1 'decodeValue' decodes the value beginning at the current token,
+        //:   whether an object, an array, or a simple value, and leaves the
+        //:   reader on the last token of the value, at the depth preceding
+        //:   the value.
+        //:
+        //: 2 'decodeNextElement' decodes the next element of the array being
+        //:   read, resetting the element before decoding it, and returns a
+        //:   positive value, leaving the element unchanged, at the end of the
+        //:   array.
+        //:
+        //: 3 The elements of an array need not be objects.
+        //:
+        //: 4 The document may continue after the array.
+        //:
+        //: 5 The options supplied at construction are used to decode values.
+        //:
+        //: 6 Errors are reported with a negative value.
+        //
+        // Plan:
+        //: 1 Decode the elements of arrays of objects and of numbers, and
+        //:   values nested in objects, verifying the decoded values and the
+        //:   token and depth of the reader after each step.  (C-1..4)
+        //:
+        //: 2 Decode an object having an unknown element with readers created
+        //:   with and without options that disallow unknown elements.  (C-5)
+        //:
+        //: 3 Decode invalid elements and verify the results.  (C-6)
+        //
+        // Testing:
+        //   baljsn::StreamReader(const DecoderOptions& o, Allocator *bA);
+        //   int decodeValue(TYPE *value);
+        //   int decodeNextElement(TYPE *element);
+        //   bsl::string loggedMessages() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'decodeValue' AND 'decodeNextElement'"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        if (verbose) cout << "\nDecoding an array of objects." << endl;
+        {
+            const char INPUT[] = "[{\"data\":\"a\",\"responseLength\":1},"
+                                 " {\"data\":\"b\"},"
+                                 " {\"responseLength\":3}]";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(1 == X.depth());
+
+            balb::SimpleRequest element;
+
+            ASSERT(0                       == mX.decodeNextElement(&element));
+            ASSERT(Tokenizer::e_END_OBJECT == X.tokenType());
+            ASSERT(1                       == X.depth());
+            ASSERT("a"                     == element.data());
+            ASSERT(1                       == element.responseLength());
+
+            ASSERT(0                       == mX.decodeNextElement(&element));
+            ASSERT("b"                     == element.data());
+            ASSERT(0                       == element.responseLength());
+
+            ASSERT(0                       == mX.decodeNextElement(&element));
+            ASSERT(""                      == element.data());
+            ASSERT(3                       == element.responseLength());
+
+            ASSERT(0                       <  mX.decodeNextElement(&element));
+            ASSERT(Tokenizer::e_END_ARRAY  == X.tokenType());
+            ASSERT(0                       == X.depth());
+            ASSERT(3                       == element.responseLength());
+
+            ASSERT(0                       <  mX.advanceToNextToken());
+        }
+
+        if (verbose) cout << "\nDecoding an empty array." << endl;
+        {
+            const char INPUT[] = "[ ]";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            ASSERT(0 == mX.advanceToNextToken());
+
+            balb::SimpleRequest element;
+            element.responseLength() = 7;
+
+            ASSERT(0                      <  mX.decodeNextElement(&element));
+            ASSERT(Tokenizer::e_END_ARRAY == X.tokenType());
+            ASSERT(0                      == X.depth());
+            ASSERT(7                      == element.responseLength());
+        }
+
+        if (verbose) cout << "\nDecoding an array of numbers." << endl;
+        {
+            const char INPUT[] = "{\"numbers\":[1, 2, 3, 4],\"next\":5}";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(2 == X.depth());
+
+            int element;
+            int total = 0;
+            int rc;
+            while (0 == (rc = mX.decodeNextElement(&element))) {
+                ASSERT(Tokenizer::e_ELEMENT_VALUE == X.tokenType());
+                ASSERT(2                          == X.depth());
+                total += element;
+            }
+            ASSERTV(rc, 0 < rc);
+            ASSERTV(total, 10 == total);
+            ASSERT(1 == X.depth());
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_ELEMENT_NAME == X.tokenType());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.decodeValue(&element));
+            ASSERT(5 == element);
+            ASSERT(1 == X.depth());
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_END_OBJECT == X.tokenType());
+            ASSERT(0 == X.depth());
+        }
+
+        if (verbose) cout << "\nDecoding whole objects and arrays." << endl;
+        {
+            const char INPUT[] = "{\"one\":{\"data\":\"a\","
+                                 "\"responseLength\":1},"
+                                 " \"all\":[{\"data\":\"b\"},"
+                                 " {\"data\":\"c\"}]}";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_START_OBJECT == X.tokenType());
+            ASSERT(2                         == X.depth());
+
+            balb::SimpleRequest one;
+            ASSERT(0                         == mX.decodeValue(&one));
+            ASSERT(Tokenizer::e_END_OBJECT   == X.tokenType());
+            ASSERT(1                         == X.depth());
+            ASSERT("a"                       == one.data());
+            ASSERT(1                         == one.responseLength());
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_START_ARRAY  == X.tokenType());
+
+            bsl::vector<balb::SimpleRequest> all;
+            ASSERT(0                         == mX.decodeValue(&all));
+            ASSERT(Tokenizer::e_END_ARRAY    == X.tokenType());
+            ASSERT(1                         == X.depth());
+            ASSERT(2                         == all.size());
+            ASSERT("c"                       == all[1].data());
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Tokenizer::e_END_OBJECT   == X.tokenType());
+            ASSERT(0                         == X.depth());
+            ASSERT(0 <  mX.advanceToNextToken());
+        }
+
+        if (verbose) cout << "\nTesting options." << endl;
+        {
+            const char INPUT[] = "[{\"data\":\"a\",\"unknown\":1}]";
+
+            baljsn::DecoderOptions options;
+            options.setSkipUnknownElements(false);
+
+            for (int ti = 0; ti < 2; ++ti) {
+                bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+                Obj mA;
+                Obj mB(options);
+                Obj& mX = ti ? mB : mA;  const Obj& X = mX;
+
+                mX.reset(&isb);
+                ASSERT(0 == mX.advanceToNextToken());
+
+                balb::SimpleRequest element;
+                const int           rc = mX.decodeNextElement(&element);
+                if (ti) {
+                    ASSERTV(rc, 0 > rc);
+                    ASSERTV(X.loggedMessages(), !X.loggedMessages().empty());
+                }
+                else {
+                    ASSERTV(rc, 0 == rc);
+                    ASSERTV(element.data(), "a" == element.data());
+                    ASSERTV(X.loggedMessages(), X.loggedMessages().empty());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting errors." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_input_p;   // array to decode
+                int         d_numValid;  // number of valid elements
+            } DATA[] = {
+                //LINE  INPUT                                        VALID
+                //----  -------------------------------------------  -----
+                { L_,   "[{\"responseLength\":\"x\"}]",                  0 },
+                { L_,   "[{\"data\":\"a\"},{\"data\":1]",                1 },
+                { L_,   "[{\"data\":\"a\"} {\"data\":\"b\"}]",           1 },
+                { L_,   "[{\"data\":\"a\"},",                            1 },
+                { L_,   "[{\"data\":\"a\"}",                             1 },
+                { L_,   "[\"data\"]",                                    0 },
+                { L_,   "[[{\"data\":\"a\"}]]",                          0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE      = DATA[ti].d_line;
+                const char *INPUT     = DATA[ti].d_input_p;
+                const int   NUM_VALID = DATA[ti].d_numValid;
+
+                if (veryVerbose) { P_(LINE) P(INPUT) }
+
+                bdlsb::FixedMemInStreamBuf isb(INPUT, bsl::strlen(INPUT));
+
+                Obj mX;
+                mX.reset(&isb);
+                ASSERTV(LINE, 0 == mX.advanceToNextToken());
+
+                balb::SimpleRequest element;
+                int                 count = 0;
+                int                 rc;
+                while (0 == (rc = mX.decodeNextElement(&element))) {
+                    ++count;
+                }
+                ASSERTV(LINE, rc, 0 > rc);
+                ASSERTV(LINE, count, NUM_VALID == count);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'skipValue'
+        //
+        // Concerns:
+        //: 1 'skipValue' skips a simple value, an object, or an array,
+        //:   however deeply nested, and leaves the reader on the last token of
+        //:   the value, at the depth preceding the value.
+        //:
+        //: 2 'skipValue' fails if the current token does not begin a value,
+        //:   or if the value is not valid JSON.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, skip the value of the first
+        //:   member of an object, and verify the return value, the depth, and
+        //:   that the next token is the name of the second member.  (C-1..2)
+        //:
+        //: 2 Call 'skipValue' on the name of a member, and verify that it
+        //:   fails.  (C-2)
+        //
+        // Testing:
+        //   int skipValue();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'skipValue'" << endl
+                          << "===================" << endl;
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_value_p;  // value to skip
+            bool        d_isValid;  // whether 'value' is valid
+        } DATA[] = {
+            //LINE  VALUE                                          VALID
+            //----  ---------------------------------------------  -----
+            { L_,   "1",                                            true },
+            { L_,   "\"string\"",                                   true },
+            { L_,   "{}",                                           true },
+            { L_,   "[]",                                           true },
+            { L_,   "{\"a\":1}",                                    true },
+            { L_,   "[1,2,3]",                                      true },
+            { L_,   "{\"a\":{\"b\":[{\"c\":[]},{}]},\"d\":[]}",     true },
+            { L_,   "[{\"a\":[{},{}]},{\"b\":{\"c\":{}}}]",         true },
+            { L_,   "{\"a\":}",                                    false },
+            { L_,   "{\"a\":1]",                                   false },
+            { L_,   "[1,2}",                                       false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *VALUE    = DATA[ti].d_value_p;
+            const bool  IS_VALID = DATA[ti].d_isValid;
+
+            const bsl::string INPUT = bsl::string("{\"skip\":")
+                                    + VALUE
+                                    + ",\"next\":true}";
+
+            if (veryVerbose) { P_(LINE) P(INPUT) }
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT.data(), INPUT.length());
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            ASSERTV(LINE, 0 == mX.advanceToNextToken());
+            ASSERTV(LINE, 0 == mX.advanceToNextToken());
+            ASSERTV(LINE, 0 == mX.advanceToNextToken());
+
+            const int rc = mX.skipValue();
+            if (!IS_VALID) {
+                ASSERTV(LINE, rc, 0 != rc);
+                continue;
+            }
+            ASSERTV(LINE, rc, 0 == rc);
+            ASSERTV(LINE, X.depth(), 1 == X.depth());
+
+            ASSERTV(LINE, 0 == mX.advanceToNextToken());
+            ASSERTV(LINE, X.tokenType(),
+                    Tokenizer::e_ELEMENT_NAME == X.tokenType());
+
+            bslstl::StringRef name;
+            ASSERTV(LINE, 0 == X.value(&name));
+            ASSERTV(LINE, name, "next" == name);
+
+            ASSERTV(LINE, 0 != mX.skipValue());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'advanceToNextToken' AND 'depth'
+        //
+        // Concerns:
+        //: 1 'advanceToNextToken' moves to each token of a document in turn.
+        //:
+        //: 2 'depth' counts the objects and arrays containing the current
+        //:   token, including one begun by the token and excluding one ended
+        //:   by it.
+        //:
+        //: 3 'advanceToNextToken' returns a positive value, with no effect,
+        //:   after the end of the document, and does not read past the end of
+        //:   the document.
+        //:
+        //: 4 'advanceToNextToken' returns a negative value if the document is
+        //:   not valid JSON, or is a stand-alone simple value.
+        //:
+        //: 5 'reset' allows a reader to read another document.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, read the tokens of a set of
+        //:   documents, with the same reader, and verify the sequence of
+        //:   token types and depths read, and the final return value.  Verify
+        //:   that calling 'advanceToNextToken' again after the end of the
+        //:   document still returns a positive value.  (C-1..5)
+        //:
+        //: 2 Read a document followed by invalid JSON text.  (C-3)
+        //
+        // Testing:
+        //   baljsn::StreamReader(bslma::Allocator *bA = 0);
+        //   ~baljsn::StreamReader();
+        //   void reset(bsl::streambuf *streamBuf);
+        //   int advanceToNextToken();
+        //   int depth() const;
+        //   Tokenizer::TokenType tokenType() const;
+        //   int value(bslstl::StringRef *data) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'advanceToNextToken' AND 'depth'"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_input_p;   // document
+            const char *d_tokens_p;  // expected tokens (see 'tokenCode')
+            const char *d_depths_p;  // expected depths
+            bool        d_isValid;   // whether the document is valid
+        } DATA[] = {
+  //LINE INPUT               TOKENS           DEPTHS           VALID
+  //---- ------------------- ---------------- ---------------- -----
+  { L_,  "{}",               "{}",            "10",             true },
+  { L_,  "[]",               "[]",            "10",             true },
+  { L_,  " { \"a\" : 1 } ",  "{nv}",          "1110",           true },
+  { L_,  "[1,\"2\"]",         "[vv]",          "1110",           true },
+  { L_,  "[{},{}]",          "[{}{}]",        "121210",         true },
+  { L_,  "[[],[1]]",         "[[][v]]",       "1212210",        true },
+  { L_,  "{\"a\":[{\"b\":2}],\"c\":{}}",
+                             "{n[{nv}]n{}}",  "112333211210",   true },
+  { L_,  "{} trailing",      "{}",            "10",             true },
+  { L_,  "[] ]",             "[]",            "10",             true },
+  { L_,  "",                 "",              "",              false },
+  { L_,  "1",                "",              "",              false },
+  { L_,  "{\"a\" 1}",        "{n",            "11",            false },
+  { L_,  "{]",               "{",             "1",             false },
+  { L_,  "[1,",              "[v",            "11",            false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        Obj mX;  const Obj& X = mX;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *INPUT    = DATA[ti].d_input_p;
+            const char *TOKENS   = DATA[ti].d_tokens_p;
+            const char *DEPTHS   = DATA[ti].d_depths_p;
+            const bool  IS_VALID = DATA[ti].d_isValid;
+
+            if (veryVerbose) { P_(LINE) P(INPUT) }
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, bsl::strlen(INPUT));
+
+            mX.reset(&isb);
+            ASSERTV(LINE, 0 == X.depth());
+
+            bsl::string tokens;
+            bsl::string depths;
+
+            const int rc = readTokens(&tokens, &depths, &mX);
+
+            ASSERTV(LINE, TOKENS, tokens, TOKENS == tokens);
+            ASSERTV(LINE, DEPTHS, depths, DEPTHS == depths);
+
+            if (IS_VALID) {
+                ASSERTV(LINE, rc, 0 < rc);
+                ASSERTV(LINE, 0 < mX.advanceToNextToken());
+                ASSERTV(LINE, 0 == X.depth());
+            }
+            else {
+                ASSERTV(LINE, rc, 0 > rc);
+            }
+        }
+
+        if (verbose) cout << "\nTesting values." << endl;
+        {
+            const char INPUT[] = "{\"name\":\"value\"}";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            mX.reset(&isb);
+
+            bslstl::StringRef data("unchanged");
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 != X.value(&data));
+            ASSERT("unchanged" == data);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == X.value(&data));
+            ASSERT("name" == data);
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == X.value(&data));
+            ASSERT("\"value\"" == data);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Read a small document, decoding an element of an array and
+        //:   skipping another.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char INPUT[] = "[{\"data\":\"a\",\"responseLength\":1},{}]";
+
+        bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0                         == X.depth());
+        ASSERT(Tokenizer::e_BEGIN        == X.tokenType());
+
+        mX.reset(&isb);
+        ASSERT(0                         == mX.advanceToNextToken());
+        ASSERT(Tokenizer::e_START_ARRAY  == X.tokenType());
+        ASSERT(1                         == X.depth());
+
+        balb::SimpleRequest element;
+        ASSERT(0                         == mX.decodeNextElement(&element));
+        ASSERT(1                         == element.responseLength());
+
+        ASSERT(0                         == mX.advanceToNextToken());
+        ASSERT(Tokenizer::e_START_OBJECT == X.tokenType());
+        ASSERT(0                         == mX.skipValue());
+        ASSERT(Tokenizer::e_END_OBJECT   == X.tokenType());
+
+        ASSERT(0                         == mX.advanceToNextToken());
+        ASSERT(Tokenizer::e_END_ARRAY    == X.tokenType());
+        ASSERT(0                         == X.depth());
+        ASSERT(0                         <  mX.advanceToNextToken());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DECODING A LARGE ARRAY
+        //
+        // Concerns:
+        //: 1 Decoding the elements of an array one at a time is as fast as
+        //:   decoding the whole array, and uses far less memory.
+        //
+        // Plan:
+        //: 1 Decode a generated array of objects into a 'bsl::vector' with
+        //:   'baljsn::Decoder', then one element at a time with a reader, and
+        //:   report the time taken and the maximum memory used by each.
+        //
+        // Testing:
+        //   PERFORMANCE: DECODING A LARGE ARRAY
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: DECODING A LARGE ARRAY" << endl
+             << "===================================" << endl;
+
+        const int N = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bsls::Stopwatch timer;
+
+        {
+            bslma::TestAllocator ta("whole", veryVeryVerbose);
+
+            GeneratedArrayStreamBuf          sb(N);
+            baljsn::Decoder                  decoder(&ta);
+            bsl::vector<balb::SimpleRequest> array(&ta);
+            baljsn::DecoderOptions           options;
+
+            timer.reset();
+            timer.start();
+            ASSERT(0 == decoder.decode(&sb, &array, options));
+            timer.stop();
+
+            ASSERT(N == static_cast<int>(array.size()));
+
+            cout << "Decoder, whole array:        " << N << " elements, "
+                 << timer.elapsedTime() << " s, "
+                 << ta.numBytesMax() << " bytes max" << endl;
+        }
+
+        {
+            bslma::TestAllocator ta("elements", veryVeryVerbose);
+
+            GeneratedArrayStreamBuf sb(N);
+            Obj                     reader(&ta);
+            balb::SimpleRequest     element(&ta);
+
+            int count = 0;
+
+            timer.reset();
+            timer.start();
+            reader.reset(&sb);
+            ASSERT(0 == reader.advanceToNextToken());
+            while (0 == reader.decodeNextElement(&element)) {
+                ++count;
+            }
+            timer.stop();
+
+            ASSERT(N == count);
+
+            cout << "StreamReader, per element:   " << N << " elements, "
+                 << timer.elapsedTime() << " s, "
+                 << ta.numBytesMax() << " bytes max" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,12 +4,23 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
 
-#include <bsl_cstring.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_CLANG) || defined(BSLS_PLATFORM_CMP_GNU))
+#define BALJSN_TOKENIZER_SSE2 1
+#endif
+
+#ifdef BALJSN_TOKENIZER_SSE2
+#include <emmintrin.h>
+#endif
+
 #include <baljsn_parserutil.h>                 // for testing only
 
 // IMPLEMENTATION NOTES
@@ -56,8 +67,181 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+// The tokenizer spends most of its time looking for the next character of
+// one of three classes: the first non-whitespace character before a token,
+// the whitespace or token character ending a non-string value, and the '"'
+// or '\\' character that may end a string value.  The following functions
+// find such characters a block of 16 bytes at a time using SSE2 (which every
+// x86-64 processor supports), and one byte at a time using a table lookup
+// for the remaining bytes and on other platforms.
+
+enum CharClass {
+    // This 'enum' lists the bits of the entries of 'charClassTable'.
+
+    k_WHITESPACE = 1,  // ' ', '\t', '\n', '\v', '\f', '\r'
+    k_VALUE_END  = 2,  // whitespace, '{', '}', '[', ']', ':', ',', '\0'
+    k_STRING_END = 4   // '"', '\\'
+};
+
+static const unsigned char charClassTable[256] = {
+    // This table holds, for each character, the bitwise OR of the
+    // 'CharClass' values to which the character belongs.  Note that a '\0'
+    // character also ends a non-string value.
+
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0,  // 00
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 10
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,  // 20
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,  // 30
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 40
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 2, 0, 0,  // 50
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 60
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,  // 70
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 80
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 90
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // a0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // b0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // c0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // d0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // e0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // f0
+};
+
+static inline
+const char *findCharClassScalar(const char *begin,
+                                const char *end,
+                                int         charClass,
+                                bool        isInClass)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that belongs to the specified 'charClass' if the
+    // specified 'isInClass' is 'true', and that does not belong to
+    // 'charClass' otherwise, or 'end' if there is no such character.
+{
+    for (; begin < end; ++begin) {
+        const bool isMember = 0 != (charClassTable[
+                                         static_cast<unsigned char>(*begin)]
+                                                                  & charClass);
+        if (isMember == isInClass) {
+            break;
+        }
+    }
+    return begin;
+}
+
+#ifdef BALJSN_TOKENIZER_SSE2
+
+enum { k_BLOCK_SIZE = 16 };
+
+static inline
+__m128i loadBlock(const char *address)
+    // Return the 'k_BLOCK_SIZE' bytes at the specified 'address', which need
+    // not be aligned.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(address));
+}
+
+static inline
+int firstSetBit(int mask)
+    // Return the index of the lowest-order set bit of the specified non-zero
+    // 'mask'.
+{
+    return bdlb::BitUtil::numTrailingUnsetBits(
+                                             static_cast<bsl::uint32_t>(mask));
+}
+
+static inline
+__m128i whitespaceMask(__m128i block)
+    // Return a mask having all bits set in each byte of the specified 'block'
+    // that is a whitespace character, and no bits set in the other bytes.
+{
+    // Map the range '[0x09, 0x0d]' ('\t' through '\r') onto the lowest five
+    // signed 8-bit values, so that a single signed comparison identifies it.
+
+    const __m128i shifted = _mm_add_epi8(block, _mm_set1_epi8(0x80 - 0x09));
+    const __m128i control = _mm_cmplt_epi8(
+                             shifted,
+                             _mm_set1_epi8(static_cast<char>(0x80 + 0x0d
+                                                                - 0x09 + 1)));
+    return _mm_or_si128(control, _mm_cmpeq_epi8(block, _mm_set1_epi8(' ')));
+}
+
+static inline
+__m128i valueEndMask(__m128i block)
+    // Return a mask having all bits set in each byte of the specified 'block'
+    // that is in the 'k_VALUE_END' class, and no bits set in the other bytes.
+{
+    // Setting bit 5 maps '[' and ']' onto '{' and '}' respectively.
+
+    const __m128i folded   = _mm_or_si128(block, _mm_set1_epi8(0x20));
+    const __m128i brackets = _mm_or_si128(
+                                 _mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                                 _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')));
+    const __m128i separators = _mm_or_si128(
+                                   _mm_cmpeq_epi8(block, _mm_set1_epi8(':')),
+                                   _mm_cmpeq_epi8(block, _mm_set1_epi8(',')));
+    const __m128i nul = _mm_cmpeq_epi8(block, _mm_setzero_si128());
+
+    return _mm_or_si128(_mm_or_si128(whitespaceMask(block), brackets),
+                        _mm_or_si128(separators, nul));
+}
+
+static inline
+__m128i stringEndMask(__m128i block)
+    // Return a mask having all bits set in each byte of the specified 'block'
+    // that is a '"' or a '\\' character, and no bits set in the other bytes.
+{
+    return _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('"')),
+                        _mm_cmpeq_epi8(block, _mm_set1_epi8('\\')));
+}
+
+#endif
+
+const char *findNonWhitespace(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is not a whitespace character, or 'end' if there is
+    // no such character.
+{
+#ifdef BALJSN_TOKENIZER_SSE2
+    for (; end - begin >= k_BLOCK_SIZE; begin += k_BLOCK_SIZE) {
+        const int found = ~_mm_movemask_epi8(whitespaceMask(loadBlock(begin)))
+                        & 0xffff;
+        if (found) {
+            return begin + firstSetBit(found);                        // RETURN
+        }
+    }
+#endif
+    return findCharClassScalar(begin, end, k_WHITESPACE, false);
+}
+
+const char *findValueEnd(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is in the 'k_VALUE_END' class, or 'end' if there is
+    // no such character.
+{
+#ifdef BALJSN_TOKENIZER_SSE2
+    for (; end - begin >= k_BLOCK_SIZE; begin += k_BLOCK_SIZE) {
+        const int found = _mm_movemask_epi8(valueEndMask(loadBlock(begin)));
+        if (found) {
+            return begin + firstSetBit(found);                        // RETURN
+        }
+    }
+#endif
+    return findCharClassScalar(begin, end, k_VALUE_END, true);
+}
+
+const char *findStringEnd(const char *begin, const char *end)
+    // Return the address of the first '"' or '\\' character in the specified
+    // range '[begin, end)', or 'end' if there is no such character.
+{
+#ifdef BALJSN_TOKENIZER_SSE2
+    for (; end - begin >= k_BLOCK_SIZE; begin += k_BLOCK_SIZE) {
+        const int found = _mm_movemask_epi8(stringEndMask(loadBlock(begin)));
+        if (found) {
+            return begin + firstSetBit(found);                        // RETURN
+        }
+    }
+#endif
+    return findCharClassScalar(begin, end, k_STRING_END, true);
+}
 
 }  // close unnamed namespace
 
@@ -112,11 +296,14 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
-            break;
+        if (d_cursor < d_stringBuffer.length()) {
+            const char *begin = d_stringBuffer.data();
+            const char *end   = begin + d_stringBuffer.length();
+            const char *pos   = findNonWhitespace(begin + d_cursor, end);
+            if (pos != end) {
+                d_cursor = pos - begin;
+                break;
+            }
         }
 
         const int numRead = reloadStringBuffer();
@@ -129,55 +316,65 @@ int Tokenizer::skipWhitespace()
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime     = true;
+    bool escapePending = false;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
-
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
-            }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
-            }
+        if (escapePending) {
+            // The last character of the previous contents of the buffer was
+            // a '\\' and the character it escapes has now been loaded.
 
             ++d_valueIter;
+            escapePending = false;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        const char *begin = d_stringBuffer.data();
+        const char *end   = begin + d_stringBuffer.length();
+        const char *pos   = begin + d_valueIter;
 
-            // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
-            // current sequence of characters being processed to the front of
-            // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.
+        while (pos < end) {
+            pos = findStringEnd(pos, end);
+            if (pos == end) {
+                break;
+            }
 
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
-                if (0 == numRead) {
-                    return -1;                                        // RETURN
-                }
+            if ('"' == *pos) {
+                d_valueIter = pos - begin;
+                d_valueEnd  = d_valueIter;
+                return 0;                                             // RETURN
+            }
+
+            // Skip the '\\' and the character it escapes.
 
-                firstTime = false;
+            if (pos + 1 == end) {
+                escapePending = true;
+                pos           = end;
+                break;
             }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
-                }
+            pos += 2;
+        }
+
+        d_valueIter = end - begin;
+
+        // There isn't enough room in the internal buffer to hold the value.
+        // If this is the first time through the loop, we move the current
+        // sequence of characters being processed to the front of the
+        // internal buffer, otherwise we must expand the internal buffer to
+        // hold additional characters.
+
+        if (firstTime) {
+            const int numRead = moveValueCharsToStartAndReloadBuffer();
+            if (0 == numRead) {
+                return -1;                                            // RETURN
             }
+
+            firstTime = false;
         }
         else {
-            if ('\\' == previousChar) {
-                ++d_valueIter;
-                previousChar = 0;
-                continue;
+            const int rc = expandBufferForLargeValue();
+            if (rc) {
+                return rc;                                            // RETURN
             }
-            d_valueEnd = d_valueIter;
-            return 0;                                                 // RETURN
         }
     }
     return 0;
@@ -188,39 +385,38 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
+        const char *begin = d_stringBuffer.data();
+        const char *end   = begin + d_stringBuffer.length();
+        const char *pos   = findValueEnd(begin + d_valueIter, end);
+
+        if (pos != end) {
+            d_valueIter = pos - begin;
+            d_valueEnd  = d_valueIter;
+            return 0;                                                 // RETURN
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        d_valueIter = end - begin;
 
-            // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
-            // current sequence of characters being processed to the front of
-            // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.
+        // There isn't enough room in the internal buffer to hold the value.
+        // If this is the first time through the loop, we move the current
+        // sequence of characters being processed to the front of the
+        // internal buffer, otherwise we must expand the internal buffer to
+        // hold additional characters.
 
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
+        if (firstTime) {
+            const int numRead = moveValueCharsToStartAndReloadBuffer();
 
-                if (0 == numRead) {
-                    d_valueEnd = d_valueIter;
-                    return 0;                                         // RETURN
-                }
-                firstTime = false;
-            }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
-                }
+            if (0 == numRead) {
+                d_valueEnd = d_valueIter;
+                return 0;                                             // RETURN
             }
+            firstTime = false;
         }
         else {
-            d_valueEnd = d_valueIter;
-            return 0;                                                 // RETURN
+            const int rc = expandBufferForLargeValue();
+            if (rc) {
+                return rc;                                            // RETURN
+            }
         }
     }
     return 0;
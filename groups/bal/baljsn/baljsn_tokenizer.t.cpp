@@ -15,6 +15,8 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_stopwatch.h>
+
 #include <bdlsb_memoutstreambuf.h>            // for testing only
 #include <bdlsb_fixedmemoutstreambuf.h>       // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>        // for testing only
@@ -57,7 +59,9 @@ using bsl::endl;
 // [ 3] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [14] USAGE EXAMPLE
+// [14] BLOCK-WISE SCANNING
+// [15] USAGE EXAMPLE
+// [-1] PERFORMANCE: TOKENIZING A LARGE DOCUMENT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -192,7 +196,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -314,6 +318,163 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // BLOCK-WISE SCANNING
+        //
+        // Concerns:
+        //: 1 Whitespace, string values, and non-string values are delimited
+        //:   correctly wherever the delimiting character falls relative to
+        //:   the blocks of characters examined at a time.
+        //:
+        //: 2 An escaped '"' or '\\' does not end a string value, wherever it
+        //:   falls relative to those blocks.
+        //:
+        //: 3 An escape sequence split by a reload of the internal buffer from
+        //:   the 'streambuf' is handled correctly.
+        //:
+        //: 4 A '\0' character ends a non-string value.
+        //
+        // Plan:
+        //: 1 For every combination of a number of leading whitespace
+        //:   characters, a string length, and a position within the string,
+        //:   tokenize an array holding a string value having an escape
+        //:   sequence at that position followed by a number of that length,
+        //:   and verify the tokens and values.  (C-1..2)
+        //:
+        //: 2 Tokenize arrays holding a string value having an escape sequence
+        //:   preceded by enough whitespace that the '\\' character is near
+        //:   the last character of the first read from the 'streambuf', and
+        //:   verify the value.  (C-3)
+        //:
+        //: 3 Tokenize a number followed by a '\0' character and verify the
+        //:   value.  (C-4)
+        //
+        // Testing:
+        //   BLOCK-WISE SCANNING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BLOCK-WISE SCANNING" << endl
+                          << "===================" << endl;
+
+        const char *const ESCAPES[] = { "\\\"", "\\\\", "\\n" };
+        const int NUM_ESCAPES = sizeof ESCAPES / sizeof *ESCAPES;
+
+        if (verbose) cout << "\nVarying positions within blocks." << endl;
+
+        for (int ws = 0; ws < 40; ws += 3) {
+            for (int len = 0; len < 70; ++len) {
+                for (int pos = 0; pos <= len; ++pos) {
+                    const char *const ESCAPE =
+                                           ESCAPES[(ws + pos) % NUM_ESCAPES];
+
+                    bsl::string str(len, 'a');
+                    str.insert(pos, ESCAPE);
+                    str = '"' + str + '"';
+
+                    const bsl::string number(len + 1, '7');
+
+                    bsl::string input(ws, ' ');
+                    input += '[';
+                    input += str;
+                    input += bsl::string(ws % 5, '\t');
+                    input += ',';
+                    input += number;
+                    input += ']';
+
+                    bdlsb::FixedMemInStreamBuf isb(input.data(),
+                                                   input.length());
+
+                    Obj mX;  const Obj& X = mX;
+                    mX.reset(&isb);
+
+                    bslstl::StringRef value;
+
+                    ASSERTV(ws, len, pos, 0 == mX.advanceToNextToken());
+                    ASSERTV(ws, len, pos,
+                            Obj::e_START_ARRAY == X.tokenType());
+
+                    ASSERTV(ws, len, pos, 0 == mX.advanceToNextToken());
+                    ASSERTV(ws, len, pos,
+                            Obj::e_ELEMENT_VALUE == X.tokenType());
+                    ASSERTV(ws, len, pos, 0 == X.value(&value));
+                    ASSERTV(ws, len, pos, value, str, str == value);
+
+                    ASSERTV(ws, len, pos, 0 == mX.advanceToNextToken());
+                    ASSERTV(ws, len, pos,
+                            Obj::e_ELEMENT_VALUE == X.tokenType());
+                    ASSERTV(ws, len, pos, 0 == X.value(&value));
+                    ASSERTV(ws, len, pos, value, number, number == value);
+
+                    ASSERTV(ws, len, pos, 0 == mX.advanceToNextToken());
+                    ASSERTV(ws, len, pos, Obj::e_END_ARRAY == X.tokenType());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nEscapes split by a buffer reload." << endl;
+
+        // The tokenizer reads at most 8191 characters from the 'streambuf' at
+        // a time.
+
+        const int k_READ_SIZE = 8191;
+
+        for (int offset = -4; offset <= 4; ++offset) {
+            for (int ei = 0; ei < NUM_ESCAPES; ++ei) {
+                const char *const ESCAPE = ESCAPES[ei];
+
+                const bsl::string str = "\"abc" + bsl::string(ESCAPE)
+                                                                   + "def\"";
+
+                // The '\\' follows the whitespace, '[', and '"abc', so this
+                // places it at index 'k_READ_SIZE - 1 + offset'.
+
+                const int ws = k_READ_SIZE - 1 + offset - 5;
+
+                bsl::string input(ws, ' ');
+                input += '[';
+                input += str;
+                input += ']';
+
+                bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+                Obj mX;  const Obj& X = mX;
+                mX.reset(&isb);
+
+                bslstl::StringRef value;
+
+                ASSERTV(offset, ei, 0 == mX.advanceToNextToken());
+                ASSERTV(offset, ei, Obj::e_START_ARRAY == X.tokenType());
+
+                ASSERTV(offset, ei, 0 == mX.advanceToNextToken());
+                ASSERTV(offset, ei, Obj::e_ELEMENT_VALUE == X.tokenType());
+                ASSERTV(offset, ei, 0 == X.value(&value));
+                ASSERTV(offset, ei, value, str, str == value);
+
+                ASSERTV(offset, ei, 0 == mX.advanceToNextToken());
+                ASSERTV(offset, ei, Obj::e_END_ARRAY == X.tokenType());
+            }
+        }
+
+        if (verbose) cout << "\nA '\\0' ends a number." << endl;
+        {
+            const char INPUT[] = "[12345678901234567890\0]";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            bslstl::StringRef value;
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_VALUE == X.tokenType());
+            ASSERT(0 == X.value(&value));
+            ASSERTV(value, "12345678901234567890" == value);
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING 'setAllowStandAloneValues' and 'allowStandAloneValues'
@@ -6086,6 +6247,71 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TOKENIZING A LARGE DOCUMENT
+        //
+        // Concerns:
+        //: 1 Tokenizing a large document is fast.
+        //
+        // Plan:
+        //: 1 Tokenize a generated document holding objects with string,
+        //:   number, and nested array values several times, and report the
+        //:   throughput.
+        //
+        // Testing:
+        //   PERFORMANCE: TOKENIZING A LARGE DOCUMENT
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: TOKENIZING A LARGE DOCUMENT" << endl
+             << "========================================" << endl;
+
+        const int NUM_RECORDS    = argc > 2 ? atoi(argv[2]) : 20000;
+        const int NUM_ITERATIONS = 10;
+
+        bsl::string input = "[\n";
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            bsl::ostringstream oss;
+            oss << (i ? ",\n" : "")
+                << "    {\n"
+                << "        \"name\"        : \"Record number " << i
+                << "\",\n"
+                << "        \"description\" : \"A record with a "
+                << "\\\"quoted\\\" word and a fairly long description "
+                << "text\",\n"
+                << "        \"price\"       : " << i * 1.25 << ",\n"
+                << "        \"quantities\"  : [ 1, 22, 333, 4444 ],\n"
+                << "        \"active\"      : true\n"
+                << "    }";
+            input += oss.str();
+        }
+        input += "\n]\n";
+
+        bsls::Stopwatch timer;
+        timer.start();
+
+        Int64 numTokens = 0;
+        for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+            bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+            Obj mX;
+            mX.reset(&isb);
+            while (0 == mX.advanceToNextToken()) {
+                ++numTokens;
+            }
+        }
+
+        timer.stop();
+
+        const double seconds = timer.elapsedTime();
+        const double mbytes  = static_cast<double>(input.length())
+                             * NUM_ITERATIONS / (1024 * 1024);
+
+        cout << "Bytes: "      << input.length()
+             << ", tokens: "   << numTokens / NUM_ITERATIONS
+             << ", MB/s: "     << mbytes / seconds << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,451 @@
+// balst_guardfaultreportutil.cpp                                     -*-C++-*-
+#include <balst_guardfaultreportutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_guardfaultreportutil_cpp,"$Id$ $CSID$")
+
+#include <balst_stackaddressutil.h>
+#include <balst_stacktrace.h>
+#include <balst_stacktraceutil.h>
+
+#include <bdlb_integerformatutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'bsl::abort'
+#include <bsl_iostream.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <errno.h>           // 'errno', 'EINTR'
+#include <signal.h>          // 'sigaction'
+#include <unistd.h>          // 'write'
+#else
+#include <io.h>              // '_write'
+#endif
+
+///Implementation Notes
+///--------------------
+// At most one fault handler is installed at any time.  The allocator whose
+// faults it reports is held in an atomic pointer, which is cleared (by
+// swapping) by whichever of the handler and 'uninstallFaultHandler' first
+// runs, so that the previous handlers are restored exactly once.
+//
+// The handler runs while the process is faulting, possibly with the heap or
+// a stream locked by the faulting thread, so it must not allocate, lock, or
+// use streams.  'describeAddress' only reads the slots of the allocator, and
+// 'printRawReport' formats the report into a buffer on the stack and writes
+// it with 'write'.  Resolving the return addresses into symbols (which opens
+// files and allocates) is left to a tool run afterwards.
+
+namespace BloombergLP {
+namespace {
+
+typedef bdlma::SamplingGuardingAllocator Allocator;
+
+                          // ===================
+                          // class RawTextWriter
+                          // ===================
+
+class RawTextWriter {
+    // This class accumulates text in a fixed-size buffer and writes it to a
+    // file descriptor, using only async-signal-safe operations.
+
+    // DATA
+    char d_buffer[256];     // text not yet written
+    int  d_length;          // number of characters in 'd_buffer'
+    int  d_fileDescriptor;  // destination of the text
+
+  private:
+    // NOT IMPLEMENTED
+    RawTextWriter(const RawTextWriter&);
+    RawTextWriter& operator=(const RawTextWriter&);
+
+  public:
+    // CREATORS
+    explicit RawTextWriter(int fileDescriptor);
+        // Create a writer of text to the specified 'fileDescriptor'.
+
+    ~RawTextWriter();
+        // Write the accumulated text, and destroy this object.
+
+    // MANIPULATORS
+    void flush();
+        // Write the accumulated text, ignoring errors.
+
+    void writeAddress(const void *address);
+        // Append the specified 'address' in hexadecimal, preceded by "0x".
+
+    void writeDecimal(bsls::Types::Uint64 value);
+        // Append the specified 'value' in decimal.
+
+    void writeString(const char *string);
+        // Append the specified null-terminated 'string'.
+};
+
+                          // -------------------
+                          // class RawTextWriter
+                          // -------------------
+
+// CREATORS
+RawTextWriter::RawTextWriter(int fileDescriptor)
+: d_length(0)
+, d_fileDescriptor(fileDescriptor)
+{
+}
+
+RawTextWriter::~RawTextWriter()
+{
+    flush();
+}
+
+// MANIPULATORS
+void RawTextWriter::flush()
+{
+    const char *text      = d_buffer;
+    int         remaining = d_length;
+
+    while (0 < remaining) {
+#ifdef BSLS_PLATFORM_OS_UNIX
+        const int n = static_cast<int>(write(d_fileDescriptor,
+                                             text,
+                                             remaining));
+        if (n < 0 && EINTR == errno) {
+            continue;
+        }
+#else
+        const int n = _write(d_fileDescriptor, text, remaining);
+#endif
+        if (n <= 0) {
+            break;
+        }
+        text      += n;
+        remaining -= n;
+    }
+    d_length = 0;
+}
+
+void RawTextWriter::writeAddress(const void *address)
+{
+    char                digits[2 * sizeof address];
+    int                 numDigits = 0;
+    bsls::Types::Uint64 value     = reinterpret_cast<bsls::Types::UintPtr>(
+                                                                     address);
+    do {
+        digits[numDigits++] = "0123456789abcdef"[value % 16];
+        value /= 16;
+    } while (value);
+
+    char text[2 + sizeof digits + 1] = { '0', 'x' };
+    for (int i = 0; i < numDigits; ++i) {
+        text[2 + i] = digits[numDigits - 1 - i];
+    }
+    text[2 + numDigits] = '\0';
+
+    writeString(text);
+}
+
+void RawTextWriter::writeDecimal(bsls::Types::Uint64 value)
+{
+    char text[bdlb::IntegerFormatUtil::k_MAX_DECIMAL_LENGTH + 1];
+    text[bdlb::IntegerFormatUtil::formatDecimal(text, value)] = '\0';
+
+    writeString(text);
+}
+
+void RawTextWriter::writeString(const char *string)
+{
+    for (; *string; ++string) {
+        if (static_cast<int>(sizeof d_buffer) == d_length) {
+            flush();
+        }
+        d_buffer[d_length++] = *string;
+    }
+}
+
+void printRawStack(RawTextWriter      *writer,
+                   const char         *title,
+                   void * const        addresses[],
+                   int                 numAddresses)
+    // Write, with the specified 'writer', the specified 'title' followed by
+    // the specified 'addresses' of length 'numAddresses', one per line.
+{
+    writer->writeString(title);
+    writer->writeString(" (unresolved):\n");
+
+    if (0 == numAddresses) {
+        writer->writeString("(not recorded)\n");
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < numAddresses; ++i) {
+        writer->writeString("(");
+        writer->writeDecimal(i);
+        writer->writeString("): ");
+        writer->writeAddress(addresses[i]);
+        writer->writeString("\n");
+    }
+}
+
+bsls::AtomicPointer<Allocator> s_faultAllocator_p(0);
+    // allocator whose faults are reported by the installed handler, or 0 if
+    // no handler is installed
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+
+struct sigaction s_previousSegvAction;  // handler replaced for 'SIGSEGV'
+struct sigaction s_previousBusAction;   // handler replaced for 'SIGBUS'
+
+void restorePreviousHandlers()
+    // Reinstall the handlers that were replaced by 'installFaultHandler'.  A
+    // previous handler ignoring a signal is replaced by the default action,
+    // so that the fault is not retried indefinitely.
+{
+    if (SIG_IGN == s_previousSegvAction.sa_handler) {
+        s_previousSegvAction.sa_handler = SIG_DFL;
+    }
+    if (SIG_IGN == s_previousBusAction.sa_handler) {
+        s_previousBusAction.sa_handler = SIG_DFL;
+    }
+
+    sigaction(SIGSEGV, &s_previousSegvAction, 0);
+    sigaction(SIGBUS,  &s_previousBusAction,  0);
+}
+
+extern "C"
+void balst_GuardFaultReportUtil_handleFault(int, siginfo_t *info, void *)
+    // Report the memory error indicated by the specified 'info' to 'stderr'
+    // (without resolving stacks), if it occurred within the slots of
+    // 's_faultAllocator_p', and restore the previous handlers, so that the
+    // faulting instruction is handled by them when it is retried.
+{
+    Allocator *allocator = s_faultAllocator_p.swap(0);
+
+    if (!allocator) {
+        // The handler has been uninstalled concurrently.
+
+        return;                                                       // RETURN
+    }
+
+    restorePreviousHandlers();
+
+    balst::GuardFaultReportUtil::BlockInfo blockInfo;
+    if (0 == allocator->describeAddress(&blockInfo, info->si_addr)) {
+        balst::GuardFaultReportUtil::printRawReport(STDERR_FILENO, blockInfo);
+    }
+}
+
+#endif
+
+void printStack(bsl::ostream&       stream,
+                const char         *title,
+                const void * const  addresses[],
+                int                 numAddresses)
+    // Write to the specified 'stream' the specified 'title' followed by the
+    // resolved stack trace of the specified 'addresses' of length
+    // 'numAddresses'.
+{
+    stream << title << ":\n";
+
+    if (0 == numAddresses) {
+        stream << "(not recorded)\n";
+        return;                                                       // RETURN
+    }
+
+    balst::StackTrace st;  // uses a heap bypass allocator
+
+    if (0 != balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                                                              &st,
+                                                              addresses,
+                                                              numAddresses)) {
+        stream << "(internal error resolving stack)\n";
+        return;                                                       // RETURN
+    }
+
+    balst::StackTraceUtil::printFormatted(stream, st);
+}
+
+}  // close unnamed namespace
+
+namespace balst {
+
+                        // ---------------------------
+                        // struct GuardFaultReportUtil
+                        // ---------------------------
+
+// CLASS METHODS
+int GuardFaultReportUtil::collectStack(void **buffer, int maxFrames)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= maxFrames);
+
+    enum {
+        k_IGNORE_FRAMES = StackAddressUtil::k_IGNORE_FRAMES + 1,
+                                       // frames of 'getStackAddresses' and
+                                       // of this function
+
+        k_MAX_FRAMES    = Allocator::k_MAX_STACK_FRAMES + k_IGNORE_FRAMES
+    };
+
+    void *addresses[k_MAX_FRAMES];
+
+    const int numWanted = maxFrames < Allocator::k_MAX_STACK_FRAMES
+                        ? maxFrames + k_IGNORE_FRAMES
+                        : static_cast<int>(k_MAX_FRAMES);
+
+    const int numAddresses = StackAddressUtil::getStackAddresses(addresses,
+                                                                 numWanted);
+    if (numAddresses <= k_IGNORE_FRAMES) {
+        return 0;                                                     // RETURN
+    }
+
+    const int numFrames = numAddresses - k_IGNORE_FRAMES;
+    for (int i = 0; i < numFrames; ++i) {
+        buffer[i] = addresses[i + k_IGNORE_FRAMES];
+    }
+    return numFrames;
+}
+
+void GuardFaultReportUtil::enableStackCollection(Allocator *allocator)
+{
+    BSLS_ASSERT(allocator);
+
+    allocator->setStackCollector(&collectStack);
+}
+
+int GuardFaultReportUtil::installFaultHandler(Allocator *allocator)
+{
+    BSLS_ASSERT(allocator);
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+    if (0 != s_faultAllocator_p.testAndSwap(0, allocator)) {
+        return -1;                                                    // RETURN
+    }
+
+    struct sigaction action;
+    action.sa_sigaction = &balst_GuardFaultReportUtil_handleFault;
+    action.sa_flags     = SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+
+    if (0 != sigaction(SIGSEGV, &action, &s_previousSegvAction)) {
+        s_faultAllocator_p = 0;
+        return -1;                                                    // RETURN
+    }
+    if (0 != sigaction(SIGBUS, &action, &s_previousBusAction)) {
+        sigaction(SIGSEGV, &s_previousSegvAction, 0);
+        s_faultAllocator_p = 0;
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+#else
+    (void)allocator;
+
+    return -1;
+#endif
+}
+
+void GuardFaultReportUtil::printRawReport(int              fileDescriptor,
+                                          const BlockInfo& info)
+{
+    RawTextWriter writer(fileDescriptor);
+
+    writer.writeString("bdlma::SamplingGuardingAllocator: ");
+    writer.writeString(Allocator::errorKindDescription(info.d_errorKind));
+    writer.writeString(" at ");
+    writer.writeAddress(info.d_accessAddress);
+    writer.writeString("\n");
+
+    if (0 == info.d_blockAddress) {
+        writer.writeString("no affected block\n");
+        return;                                                       // RETURN
+    }
+
+    writer.writeString("block ");
+    writer.writeAddress(info.d_blockAddress);
+    writer.writeString(" of ");
+    writer.writeDecimal(info.d_blockSize);
+    writer.writeString(info.d_isFreed ? " bytes, freed\n"
+                                      : " bytes, in use\n");
+
+    printRawStack(&writer,
+                  "Allocation stack",
+                  info.d_allocationStack,
+                  info.d_numAllocationFrames);
+
+    if (info.d_isFreed) {
+        printRawStack(&writer,
+                      "Deallocation stack",
+                      info.d_deallocationStack,
+                      info.d_numDeallocationFrames);
+    }
+}
+
+bsl::ostream& GuardFaultReportUtil::printReport(bsl::ostream&    stream,
+                                                const BlockInfo& info)
+{
+    stream << "bdlma::SamplingGuardingAllocator: "
+           << Allocator::errorKindDescription(info.d_errorKind)
+           << " at " << info.d_accessAddress << '\n';
+
+    if (0 == info.d_blockAddress) {
+        stream << "no affected block\n";
+        return stream;                                                // RETURN
+    }
+
+    stream << "block " << info.d_blockAddress
+           << " of " << info.d_blockSize << " bytes, "
+           << (info.d_isFreed ? "freed" : "in use") << '\n';
+
+    printStack(stream,
+               "Allocation stack",
+               info.d_allocationStack,
+               info.d_numAllocationFrames);
+
+    if (info.d_isFreed) {
+        printStack(stream,
+                   "Deallocation stack",
+                   info.d_deallocationStack,
+                   info.d_numDeallocationFrames);
+    }
+
+    return stream;
+}
+
+void GuardFaultReportUtil::reportAndAbort(const BlockInfo& info)
+{
+    printReport(bsl::cerr, info);
+    bsl::cerr << bsl::flush;
+
+    bsl::abort();
+}
+
+void GuardFaultReportUtil::uninstallFaultHandler()
+{
+#ifdef BSLS_PLATFORM_OS_UNIX
+    if (s_faultAllocator_p.swap(0)) {
+        restorePreviousHandlers();
+    }
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
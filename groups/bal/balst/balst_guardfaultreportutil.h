@@ -0,0 +1,212 @@
+// balst_guardfaultreportutil.h                                       -*-C++-*-
+#ifndef INCLUDED_BALST_GUARDFAULTREPORTUTIL
+#define INCLUDED_BALST_GUARDFAULTREPORTUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide stack-trace reports for sampled guarded memory errors.
+//
+//@CLASSES:
+//  balst::GuardFaultReportUtil: namespace for guarded-error reporting
+//
+//@SEE_ALSO: bdlma_samplingguardingallocator, balst_stacktraceutil
+//
+//@DESCRIPTION: This component provides a namespace 'struct',
+// 'balst::GuardFaultReportUtil', containing functions that report the memory
+// errors detected by a 'bdlma::SamplingGuardingAllocator' together with the
+// resolved stack traces of the allocation and the deallocation of the
+// affected block.
+//
+// 'bdlma::SamplingGuardingAllocator' records the stacks of its sampled blocks
+// using a stack collector function that must be supplied by its client.
+// 'enableStackCollection' installs 'collectStack', which obtains the return
+// addresses of the current thread using
+// 'balst::StackAddressUtil::getStackAddresses'.  The addresses are resolved
+// into function names (and, where available, source files and line numbers)
+// only when an error is reported, so collecting stacks costs little more than
+// walking the stack, and is done only for sampled allocations.
+//
+// 'printReport' writes to a stream a human-readable description of an error,
+// and 'reportAndAbort', suitable for use as the error callback of the
+// allocator, writes that description to 'stderr' and aborts the process.
+// 'printRawReport' writes to a file descriptor a similar description in which
+// the stacks are left unresolved, using only async-signal-safe operations.
+//
+///Fault Handler
+///-------------
+// Overflows, underflows, and uses after free of sampled blocks cause a memory
+// protection fault at the point of the erroneous access.
+// 'installFaultHandler' installs (on Unix platforms) a handler for 'SIGSEGV'
+// and 'SIGBUS' that, if the faulting address is within the slots of the
+// allocator, writes a report of the error to 'stderr' (as by
+// 'printRawReport').  In all cases, the handler then restores the handlers
+// that were installed before it and returns, so that the faulting instruction
+// faults again and is handled as if 'installFaultHandler' had not been called
+// (e.g., the process terminates and dumps core).
+//
+// Resolving stack traces allocates memory and reads files, which is not
+// async-signal-safe, and the faulting thread may hold a lock on the heap or on
+// 'stderr'.  The handler therefore writes, with 'write', only the return
+// addresses of the stacks.  These can be resolved into function names and
+// source lines after the fact, e.g., by passing them (relative to the load
+// address of the module containing them) to 'addr2line', or by a debugger
+// attached to the resulting core file.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reporting Errors of a Sampling Guarding Allocator
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server is occasionally affected by a heap corruption that we
+// cannot reproduce, and that we want to identify the code responsible for it
+// in production.
+//
+// First, we create a sampling guarding allocator that guards one in 1000 of
+// the allocations made through it, and install it as the default allocator:
+//..
+//  bdlma::SamplingGuardingAllocator allocator(64, 1000);
+//  bslma::DefaultAllocatorGuard     guard(&allocator);
+//..
+// Then, we enable the collection of stacks for sampled blocks, and the
+// reporting of invalid deallocations, which by default only print a short
+// description before aborting the process:
+//..
+//  balst::GuardFaultReportUtil::enableStackCollection(&allocator);
+//  allocator.setErrorCallback(&balst::GuardFaultReportUtil::reportAndAbort);
+//..
+// Next, we install a fault handler reporting faults within the slots of the
+// allocator:
+//..
+//  int rc = balst::GuardFaultReportUtil::installFaultHandler(&allocator);
+//..
+// Note that 'installFaultHandler' fails on platforms where it is not
+// supported, in which case faults are not reported, but are still detected.
+//
+// Now, the server runs at almost full speed.  If one of the sampled blocks is
+// overrun, a report like the following is printed to 'stderr' before the
+// process terminates:
+//..
+//  bdlma::SamplingGuardingAllocator: buffer overflow at 0x7f7c6d3a4000
+//  block 0x7f7c6d3a3f90 of 100 bytes, in use
+//  Allocation stack (unresolved):
+//  (0): 0x4a3b2d
+//  (1): 0x41c09a
+//  ...
+//..
+// Note that the addresses are those of the allocating code; they must be
+// resolved into symbols by an external tool (see {Fault Handler}).
+// Finally, we uninstall the handler before 'allocator' is destroyed:
+//..
+//  if (0 == rc) {
+//      balst::GuardFaultReportUtil::uninstallFaultHandler();
+//  }
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_SAMPLINGGUARDINGALLOCATOR
+#include <bdlma_samplingguardingallocator.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+namespace BloombergLP {
+namespace balst {
+
+                        // ===========================
+                        // struct GuardFaultReportUtil
+                        // ===========================
+
+struct GuardFaultReportUtil {
+    // This 'struct' provides a namespace for functions that report the memory
+    // errors detected by a 'bdlma::SamplingGuardingAllocator'.
+
+    // TYPES
+    typedef bdlma::SamplingGuardingAllocator::BlockInfo BlockInfo;
+        // 'BlockInfo' is an alias for the description of a memory error.
+
+    // CLASS METHODS
+    static int collectStack(void **buffer, int maxFrames);
+        // Load into the specified 'buffer' at most the specified 'maxFrames'
+        // return addresses of the stack of the calling thread, excluding the
+        // frames of this function, ordered from the most recent call, and
+        // return the number of addresses loaded.  The behavior is undefined
+        // unless '0 <= maxFrames' and 'buffer' has room for at least
+        // 'maxFrames' addresses.  Note that this function has the signature
+        // of a 'bdlma::SamplingGuardingAllocator::StackCollector'.
+
+    static void enableStackCollection(
+                                  bdlma::SamplingGuardingAllocator *allocator);
+        // Record the allocation and deallocation stacks of the blocks sampled
+        // by the specified 'allocator' using 'collectStack'.
+
+    static int installFaultHandler(
+                                  bdlma::SamplingGuardingAllocator *allocator);
+        // Install a handler for memory protection faults that reports the
+        // errors causing faults within the slots of the specified
+        // 'allocator' (see {Fault Handler}).  Return 0 on success, and a
+        // non-zero value (with no effect) if fault handlers are not supported
+        // on this platform or a handler is already installed by this
+        // function.  The behavior is undefined unless 'allocator' outlives
+        // the handler (i.e., until the handler is invoked or
+        // 'uninstallFaultHandler' is called).  Note that this function does
+        // not enable the collection of stacks by 'allocator'.
+
+    static void printRawReport(int fileDescriptor, const BlockInfo& info);
+        // Write to the specified 'fileDescriptor' a multi-line description of
+        // the memory error described by the specified 'info', including the
+        // unresolved return addresses of the allocation and deallocation
+        // stacks of the affected block, using only async-signal-safe
+        // operations.  Errors writing to 'fileDescriptor' are ignored.  Note
+        // that this function can be called from a signal handler, and that
+        // the format is not fully specified, and can change without notice.
+
+    static bsl::ostream& printReport(bsl::ostream&    stream,
+                                     const BlockInfo& info);
+        // Write to the specified 'stream' a multi-line, human-readable
+        // description of the memory error described by the specified 'info',
+        // including the resolved allocation and deallocation stacks of the
+        // affected block, and return 'stream'.  Note that the format is not
+        // fully specified, and can change without notice.
+
+    static void reportAndAbort(const BlockInfo& info);
+        // Write to 'stderr' a description of the memory error described by
+        // the specified 'info' (as by 'printReport') and abort the process.
+        // Note that this function has the signature of a
+        // 'bdlma::SamplingGuardingAllocator::ErrorCallback'.
+
+    static void uninstallFaultHandler();
+        // Restore the fault handlers that were installed before the last
+        // successful call to 'installFaultHandler'.  This function has no
+        // effect if the handler installed by 'installFaultHandler' has been
+        // invoked or uninstalled, or has never been installed.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,880 @@
+// balst_guardfaultreportutil.t.cpp                                   -*-C++-*-
+#include <balst_guardfaultreportutil.h>
+
+#include <bdlma_samplingguardingallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+  #include <signal.h>    // 'sigaction', 'SIGSEGV', 'SIGABRT'
+  #include <sys/wait.h>  // 'waitpid', 'WIFSIGNALED', 'WTERMSIG'
+  #include <unistd.h>    // 'fork', 'pipe', 'dup2', 'read', '_exit'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'balst::GuardFaultReportUtil' is a utility that collects and prints the
+// stacks of the blocks of a 'bdlma::SamplingGuardingAllocator', and reports
+// the memory errors it detects.  We verify that stacks are collected and
+// recorded by the allocator, that reports contain the expected description of
+// each kind of error, and, on Unix platforms, in child processes, that the
+// fault handler and the error callback report errors and terminate the
+// process.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int collectStack(void **buffer, int maxFrames);
+// [ 2] void enableStackCollection(SamplingGuardingAllocator *allocator);
+// [ 4] int installFaultHandler(SamplingGuardingAllocator *allocator);
+// [ 6] void printRawReport(int fileDescriptor, const BlockInfo& info);
+// [ 3] bsl::ostream& printReport(bsl::ostream&, const BlockInfo&);
+// [ 5] void reportAndAbort(const BlockInfo& info);
+// [ 4] void uninstallFaultHandler();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::GuardFaultReportUtil      Util;
+typedef bdlma::SamplingGuardingAllocator SGA;
+typedef Util::BlockInfo                  BlockInfo;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static bool contains(const bsl::string& string, const char *substring)
+    // Return 'true' if the specified 'string' contains the specified
+    // 'substring', and 'false' otherwise.
+{
+    return bsl::string::npos != string.find(substring);
+}
+
+static void recordDoubleFree(SGA *allocator)
+    // Allocate a sampled block from the specified 'allocator', and deallocate
+    // it twice.  The behavior is undefined unless 'allocator' samples every
+    // allocation and has a free slot.
+{
+    void *p = allocator->allocate(10);
+    ASSERT(allocator->isGuardedAddress(p));
+    allocator->deallocate(p);
+    allocator->deallocate(p);
+}
+
+enum { k_MAX_HELPER_SIZE = 256 };  // upper bound on the size (in bytes) of
+                                   // the code of 'collectStackHelper'
+
+static int collectStackHelper(void **buffer, int maxFrames)
+    // Return 'Util::collectStack(buffer, maxFrames)' for the specified
+    // 'buffer' and 'maxFrames'.
+{
+    // The result is stored in a 'volatile' variable, so that the call is not
+    // optimized into a tail call.
+
+    volatile int numFrames = Util::collectStack(buffer, maxFrames);
+    return numFrames;
+}
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+
+typedef void (*ChildFunction)(SGA *allocator);
+
+static int runInChild(bsl::string   *output,
+                      ChildFunction  function,
+                      SGA           *allocator)
+    // Invoke the specified 'function' with the specified 'allocator' in a
+    // child process, load into the specified 'output' what the child process
+    // writes to 'stderr', and return the status of the child process as
+    // obtained by 'waitpid'.
+{
+    int fds[2];
+    ASSERT(0 == pipe(fds));
+
+    cout.flush();
+    const pid_t pid = fork();
+    if (0 == pid) {
+        close(fds[0]);
+        dup2(fds[1], 2);
+        function(allocator);
+        _exit(0);
+    }
+    ASSERT(0 < pid);
+    close(fds[1]);
+
+    output->clear();
+    char buffer[512];
+    ssize_t n;
+    while (0 < (n = read(fds[0], buffer, sizeof buffer))) {
+        output->append(buffer, n);
+    }
+    close(fds[0]);
+
+    int status = 0;
+    ASSERT(pid == waitpid(pid, &status, 0));
+
+    if (veryVerbose) {
+        cout << "Child output:\n" << *output << endl;
+    }
+    return status;
+}
+
+static bsl::string printRawToString(const BlockInfo& info)
+    // Return what 'Util::printRawReport' writes for the specified 'info'.
+{
+    int fds[2];
+    ASSERT(0 == pipe(fds));
+
+    Util::printRawReport(fds[1], info);
+    close(fds[1]);
+
+    bsl::string output;
+    char        buffer[512];
+    ssize_t     n;
+    while (0 < (n = read(fds[0], buffer, sizeof buffer))) {
+        output.append(buffer, n);
+    }
+    close(fds[0]);
+
+    return output;
+}
+
+static void overflowWithHandler(SGA *allocator)
+    // Install the fault handler for the specified 'allocator', allocate a
+    // sampled block from it, and overflow the block.
+{
+    Util::enableStackCollection(allocator);
+    ASSERT(0 == Util::installFaultHandler(allocator));
+
+    char *p = static_cast<char *>(allocator->allocate(64));
+    ASSERT(allocator->isGuardedAddress(p));
+
+    static_cast<volatile char *>(p)[64] = 1;
+}
+
+static void useAfterFreeWithHandler(SGA *allocator)
+    // Install the fault handler for the specified 'allocator', allocate a
+    // sampled block from it, deallocate the block, and read from it.
+{
+    Util::enableStackCollection(allocator);
+    ASSERT(0 == Util::installFaultHandler(allocator));
+
+    char *p = static_cast<char *>(allocator->allocate(64));
+    allocator->deallocate(p);
+
+    volatile char c = static_cast<volatile char *>(p)[0];
+    (void)c;
+}
+
+static void unrelatedFaultWithHandler(SGA *allocator)
+    // Install the fault handler for the specified 'allocator', and write to
+    // an invalid address outside of its slots.
+{
+    ASSERT(0 == Util::installFaultHandler(allocator));
+
+    static_cast<volatile char *>(0)[0] = 1;
+}
+
+static void doubleFreeWithCallback(SGA *allocator)
+    // Install 'reportAndAbort' as the error callback of the specified
+    // 'allocator', and deallocate a sampled block twice.
+{
+    Util::enableStackCollection(allocator);
+    allocator->setErrorCallback(&Util::reportAndAbort);
+
+    recordDoubleFree(allocator);
+}
+
+#endif
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reporting Errors of a Sampling Guarding Allocator
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server is occasionally affected by a heap corruption that we
+// cannot reproduce, and that we want to identify the code responsible for it
+// in production.
+//
+// First, we create a sampling guarding allocator that guards one in 1000 of
+// the allocations made through it, and install it as the default allocator:
+//..
+    bdlma::SamplingGuardingAllocator allocator(64, 1000);
+    bslma::DefaultAllocatorGuard     guard(&allocator);
+//..
+// Then, we enable the collection of stacks for sampled blocks, and the
+// reporting of invalid deallocations, which by default only print a short
+// description before aborting the process:
+//..
+    balst::GuardFaultReportUtil::enableStackCollection(&allocator);
+    allocator.setErrorCallback(&balst::GuardFaultReportUtil::reportAndAbort);
+//..
+// Next, we install a fault handler reporting faults within the slots of the
+// allocator:
+//..
+    int rc = balst::GuardFaultReportUtil::installFaultHandler(&allocator);
+//..
+// Note that 'installFaultHandler' fails on platforms where it is not
+// supported, in which case faults are not reported, but are still detected.
+//
+// Now, the server runs at almost full speed.  If one of the sampled blocks is
+// overrun, a report like the following is printed to 'stderr' before the
+// process terminates:
+//..
+//  bdlma::SamplingGuardingAllocator: buffer overflow at 0x7f7c6d3a4000
+//  block 0x7f7c6d3a3f90 of 100 bytes, in use
+//  Allocation stack (unresolved):
+//  (0): 0x4a3b2d
+//  (1): 0x41c09a
+//  ...
+//..
+// Note that the addresses are those of the allocating code; they must be
+// resolved into symbols by an external tool (see {Fault Handler}).
+// Finally, we uninstall the handler before 'allocator' is destroyed:
+//..
+    if (0 == rc) {
+        balst::GuardFaultReportUtil::uninstallFaultHandler();
+    }
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'printRawReport'
+        //
+        // Concerns:
+        //: 1 The report describes the kind of error, the access address, and
+        //:   the affected block, if any, with addresses in hexadecimal.
+        //:
+        //: 2 The return addresses of the allocation stack are written, one
+        //:   per line, and those of the deallocation stack are written only
+        //:   if the block has been deallocated.
+        //:
+        //: 3 Stacks that were not recorded are reported as such.
+        //:
+        //: 4 Reports longer than the internal buffer are written completely.
+        //
+        // Plan:
+        //: 1 On Unix platforms, write to a pipe the reports of hand-crafted
+        //:   descriptions of errors, and compare them with the expected text.
+        //:   (C-1..3)
+        //:
+        //: 2 Write the report of a description having the maximum number of
+        //:   frames in both stacks, and verify that each frame is written.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void printRawReport(int fileDescriptor, const BlockInfo& info);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'printRawReport'" << endl
+                          << "================" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        BlockInfo info;
+        bsl::memset(&info, 0, sizeof info);
+
+        info.d_errorKind           = SGA::e_BUFFER_OVERFLOW;
+        info.d_accessAddress       = reinterpret_cast<void *>(0x1000);
+        info.d_blockAddress        = reinterpret_cast<void *>(0xf9c);
+        info.d_blockSize           = 100;
+        info.d_isFreed             = false;
+        info.d_allocationStack[0]  = reinterpret_cast<void *>(0x401a2b);
+        info.d_allocationStack[1]  = reinterpret_cast<void *>(0xabc);
+        info.d_numAllocationFrames = 2;
+
+        bsl::string output = printRawToString(info);
+        if (veryVerbose) cout << output << endl;
+
+        ASSERTV(output, output ==
+                    "bdlma::SamplingGuardingAllocator: buffer overflow at "
+                    "0x1000\n"
+                    "block 0xf9c of 100 bytes, in use\n"
+                    "Allocation stack (unresolved):\n"
+                    "(0): 0x401a2b\n"
+                    "(1): 0xabc\n");
+
+        info.d_errorKind     = SGA::e_USE_AFTER_FREE;
+        info.d_accessAddress = reinterpret_cast<void *>(0xfa0);
+        info.d_isFreed       = true;
+
+        output = printRawToString(info);
+        if (veryVerbose) cout << output << endl;
+
+        ASSERTV(output, output ==
+                    "bdlma::SamplingGuardingAllocator: use after free at "
+                    "0xfa0\n"
+                    "block 0xf9c of 100 bytes, freed\n"
+                    "Allocation stack (unresolved):\n"
+                    "(0): 0x401a2b\n"
+                    "(1): 0xabc\n"
+                    "Deallocation stack (unresolved):\n"
+                    "(not recorded)\n");
+
+        info.d_errorKind    = SGA::e_INVALID_FREE;
+        info.d_blockAddress = 0;
+
+        output = printRawToString(info);
+        if (veryVerbose) cout << output << endl;
+
+        ASSERTV(output, output ==
+                    "bdlma::SamplingGuardingAllocator: invalid free at "
+                    "0xfa0\n"
+                    "no affected block\n");
+
+        if (verbose) cout << "\tWriting long reports." << endl;
+        {
+            enum { k_MAX = SGA::k_MAX_STACK_FRAMES };
+
+            info.d_blockAddress          = reinterpret_cast<void *>(0xf9c);
+            info.d_numAllocationFrames   = k_MAX;
+            info.d_numDeallocationFrames = k_MAX;
+            for (int i = 0; i < k_MAX; ++i) {
+                info.d_allocationStack[i]   =
+                               reinterpret_cast<void *>(0x7f0000000000 + i);
+                info.d_deallocationStack[i] =
+                               reinterpret_cast<void *>(0x7f0000100000 + i);
+            }
+
+            output = printRawToString(info);
+            if (veryVerbose) cout << output << endl;
+
+            bsl::ostringstream expected;
+            expected << "bdlma::SamplingGuardingAllocator: invalid free at "
+                     << "0xfa0\n"
+                     << "block 0xf9c of 100 bytes, freed\n"
+                     << "Allocation stack (unresolved):\n";
+            for (int i = 0; i < k_MAX; ++i) {
+                expected << "(" << i << "): 0x" << bsl::hex
+                         << 0x7f0000000000 + i << bsl::dec << "\n";
+            }
+            expected << "Deallocation stack (unresolved):\n";
+            for (int i = 0; i < k_MAX; ++i) {
+                expected << "(" << i << "): 0x" << bsl::hex
+                         << 0x7f0000100000 + i << bsl::dec << "\n";
+            }
+
+            ASSERTV(output, expected.str(), expected.str() == output);
+        }
+#endif
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'reportAndAbort'
+        //
+        // Concerns:
+        //: 1 'reportAndAbort' writes a report of the error to 'stderr', and
+        //:   aborts the process.
+        //
+        // Plan:
+        //: 1 On Unix platforms, in a child process, install 'reportAndAbort'
+        //:   as the error callback of an allocator, and deallocate a sampled
+        //:   block twice.  Verify that the child process is aborted, and that
+        //:   it reported the double free.  (C-1)
+        //
+        // Testing:
+        //   void reportAndAbort(const BlockInfo& info);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'reportAndAbort'" << endl
+                          << "================" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        SGA allocator(4, 1, &ta);
+
+        bsl::string output;
+        const int   status = runInChild(&output,
+                                        &doubleFreeWithCallback,
+                                        &allocator);
+
+        ASSERT(WIFSIGNALED(status));
+        ASSERT(SIGABRT == WTERMSIG(status));
+        ASSERT(contains(output, "double free"));
+        ASSERT(contains(output, "Allocation stack"));
+        ASSERT(contains(output, "Deallocation stack"));
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FAULT HANDLER
+        //
+        // Concerns:
+        //: 1 On Unix platforms, 'installFaultHandler' succeeds, and fails if
+        //:   a handler is already installed.
+        //:
+        //: 2 'uninstallFaultHandler' restores the previous handler, and
+        //:   allows a handler to be installed again.
+        //:
+        //: 3 When a fault occurs within the slots of the allocator, the
+        //:   handler reports it, and the process is then terminated by the
+        //:   signal.
+        //:
+        //: 4 When a fault occurs outside of the slots of the allocator, the
+        //:   handler does not report it, and the process is terminated.
+        //:
+        //: 5 On other platforms, 'installFaultHandler' fails.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Install and uninstall handlers, and verify the return codes and
+        //:   the handler installed for 'SIGSEGV'.  (C-1..2, 5)
+        //:
+        //: 2 In child processes, install the handler, overflow a sampled
+        //:   block, read a deallocated sampled block, and write to a null
+        //:   pointer, and verify the output and the termination of the child
+        //:   process.  (C-3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-6)
+        //
+        // Testing:
+        //   int installFaultHandler(SamplingGuardingAllocator *allocator);
+        //   void uninstallFaultHandler();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FAULT HANDLER" << endl
+                          << "=============" << endl;
+
+        SGA allocator(4, 1, &ta);
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        if (verbose) cout << "\tInstalling and uninstalling." << endl;
+        {
+            struct sigaction before;
+            ASSERT(0 == sigaction(SIGSEGV, 0, &before));
+
+            ASSERT(0 == Util::installFaultHandler(&allocator));
+            ASSERT(0 != Util::installFaultHandler(&allocator));
+
+            struct sigaction during;
+            ASSERT(0 == sigaction(SIGSEGV, 0, &during));
+            ASSERT(during.sa_flags & SA_SIGINFO);
+
+            Util::uninstallFaultHandler();
+
+            struct sigaction after;
+            ASSERT(0 == sigaction(SIGSEGV, 0, &after));
+            ASSERT(before.sa_handler == after.sa_handler);
+
+            Util::uninstallFaultHandler();  // no effect
+
+            ASSERT(0 == Util::installFaultHandler(&allocator));
+            Util::uninstallFaultHandler();
+        }
+
+        if (verbose) cout << "\tReporting faults." << endl;
+        {
+            bsl::string output;
+
+            int status = runInChild(&output, &overflowWithHandler, &allocator);
+            ASSERT(WIFSIGNALED(status));
+            ASSERT(contains(output, "buffer overflow"));
+            ASSERT(contains(output, "in use"));
+            ASSERT(contains(output,
+                            "Allocation stack (unresolved):\n(0): 0x"));
+            ASSERT(!contains(output, "Deallocation stack"));
+
+            status = runInChild(&output, &useAfterFreeWithHandler, &allocator);
+            ASSERT(WIFSIGNALED(status));
+            ASSERT(contains(output, "use after free"));
+            ASSERT(contains(output,
+                            "Deallocation stack (unresolved):\n(0): 0x"));
+
+            status = runInChild(&output,
+                                &unrelatedFaultWithHandler,
+                                &allocator);
+            ASSERT(WIFSIGNALED(status));
+            ASSERT(output.empty());
+        }
+#else
+        ASSERT(0 != Util::installFaultHandler(&allocator));
+        Util::uninstallFaultHandler();
+#endif
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Util::installFaultHandler(0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'printReport'
+        //
+        // Concerns:
+        //: 1 The report describes the kind of error, the access address, and
+        //:   the affected block, if any.
+        //:
+        //: 2 The allocation stack is printed, and the deallocation stack is
+        //:   printed only if the block has been deallocated.
+        //:
+        //: 3 Stacks that were not recorded are reported as such.
+        //:
+        //: 4 The specified stream is returned.
+        //
+        // Plan:
+        //: 1 Obtain descriptions of errors from an allocator with and without
+        //:   stack collection, print them, and verify that the output
+        //:   contains the expected descriptions.  (C-1..4)
+        //
+        // Testing:
+        //   bsl::ostream& printReport(bsl::ostream&, const BlockInfo&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'printReport'" << endl
+                          << "=============" << endl;
+
+        SGA allocator(4, 1, &ta);
+        Util::enableStackCollection(&allocator);
+
+        char *p = static_cast<char *>(allocator.allocate(100));
+        ASSERT(allocator.isGuardedAddress(p));
+
+        BlockInfo info;
+
+        {
+            ASSERT(0 == allocator.describeAddress(&info, p + 100));
+
+            bsl::ostringstream oss;
+            ASSERT(&oss == &Util::printReport(oss, info));
+
+            const bsl::string s = oss.str();
+            if (veryVerbose) cout << s << endl;
+
+            ASSERT(contains(s, "buffer overflow"));
+            ASSERT(contains(s, "100 bytes, in use"));
+            ASSERT(contains(s, "Allocation stack:\n"));
+            ASSERT(!contains(s, "Deallocation stack"));
+            ASSERT(!contains(s, "(not recorded)"));
+        }
+
+        allocator.deallocate(p);
+
+        {
+            ASSERT(0 == allocator.describeAddress(&info, p + 1));
+
+            bsl::ostringstream oss;
+            Util::printReport(oss, info);
+
+            const bsl::string s = oss.str();
+            if (veryVerbose) cout << s << endl;
+
+            ASSERT(contains(s, "use after free"));
+            ASSERT(contains(s, "freed"));
+            ASSERT(contains(s, "Allocation stack:\n"));
+            ASSERT(contains(s, "Deallocation stack:\n"));
+        }
+
+        allocator.setStackCollector(0);
+
+        p = static_cast<char *>(allocator.allocate(8));
+
+        {
+            ASSERT(0 == allocator.describeAddress(&info, p - 1));
+
+            bsl::ostringstream oss;
+            Util::printReport(oss, info);
+
+            const bsl::string s = oss.str();
+            if (veryVerbose) cout << s << endl;
+
+            ASSERT(contains(s, "buffer underflow"));
+            ASSERT(contains(s, "(not recorded)"));
+        }
+
+        allocator.deallocate(p);
+
+        {
+            int dummy;
+            ASSERT(0 != allocator.describeAddress(&info, &dummy));
+
+            info.d_errorKind    = SGA::e_INVALID_FREE;
+            info.d_blockAddress = 0;
+
+            bsl::ostringstream oss;
+            Util::printReport(oss, info);
+
+            const bsl::string s = oss.str();
+            if (veryVerbose) cout << s << endl;
+
+            ASSERT(contains(s, "invalid free"));
+            ASSERT(contains(s, "no affected block"));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // STACK COLLECTION
+        //
+        // Concerns:
+        //: 1 'collectStack' loads at most the specified number of frames.
+        //:
+        //: 2 'collectStack' omits its own frames, so that the first frame is
+        //:   in its caller.
+        //:
+        //: 3 'enableStackCollection' causes the allocator to record the
+        //:   stacks of sampled blocks.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Call 'collectStack' with various maximum numbers of frames, and
+        //:   verify the number of frames returned.  (C-1)
+        //:
+        //: 2 Verify that the first frame returned by 'collectStack', when
+        //:   called from a helper function, is within that function.  (C-2)
+        //:
+        //: 3 Enable stack collection on an allocator, and verify that the
+        //:   stacks of sampled blocks are recorded.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   int collectStack(void **buffer, int maxFrames);
+        //   void enableStackCollection(SamplingGuardingAllocator *allocator);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STACK COLLECTION" << endl
+                          << "================" << endl;
+
+        enum { k_MAX = SGA::k_MAX_STACK_FRAMES };
+
+        void *buffer[k_MAX + 1];
+
+        for (int maxFrames = 0; maxFrames <= k_MAX; ++maxFrames) {
+            bsl::memset(buffer, 0, sizeof buffer);
+
+            const int n = Util::collectStack(buffer, maxFrames);
+            LOOP_ASSERT(maxFrames, 0 <= n);
+            LOOP_ASSERT(maxFrames, n <= maxFrames);
+            LOOP_ASSERT(maxFrames, 0 == buffer[maxFrames]);
+            LOOP_ASSERT(maxFrames, 0 == maxFrames || 0 < n);
+        }
+
+        {
+            // 'collectStackHelper' is called through a pointer, so that it is
+            // not inlined.
+
+            int (*volatile helper)(void **, int) = &collectStackHelper;
+
+            const int n = helper(buffer, k_MAX);
+            ASSERT(0 < n);
+
+            const char *begin = reinterpret_cast<const char *>(
+                                                        &collectStackHelper);
+            const char *frame = static_cast<const char *>(buffer[0]);
+
+            if (veryVerbose) { P_(buffer[0]) P(static_cast<const void *>(
+                                                                     begin)) }
+
+            ASSERT(begin < frame);
+            ASSERT(frame < begin + k_MAX_HELPER_SIZE);
+        }
+
+        {
+            SGA allocator(2, 1, &ta);
+            Util::enableStackCollection(&allocator);
+
+            void *p = allocator.allocate(8);
+            allocator.deallocate(p);
+
+            BlockInfo info;
+            ASSERT(0 == allocator.describeAddress(&info, p));
+            ASSERT(0 < info.d_numAllocationFrames);
+            ASSERT(0 < info.d_numDeallocationFrames);
+            ASSERT(k_MAX >= info.d_numAllocationFrames);
+            ASSERT(k_MAX >= info.d_numDeallocationFrames);
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Util::collectStack(0, 1));
+            ASSERT_FAIL(Util::collectStack(buffer, -1));
+            ASSERT_PASS(Util::collectStack(buffer, 1));
+            ASSERT_FAIL(Util::enableStackCollection(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Enable stack collection on an allocator, overflow a sampled
+        //:   block (without accessing it), and print the report.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        SGA allocator(2, 1, &ta);
+        Util::enableStackCollection(&allocator);
+
+        char *p = static_cast<char *>(allocator.allocate(10));
+
+        BlockInfo info;
+        ASSERT(0 == allocator.describeAddress(&info, p + 16));
+        ASSERT(SGA::e_BUFFER_OVERFLOW == info.d_errorKind);
+
+        bsl::ostringstream oss;
+        Util::printReport(oss, info);
+        if (verbose) cout << oss.str() << endl;
+
+        ASSERT(contains(oss.str(), "buffer overflow"));
+
+        allocator.deallocate(p);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -44,6 +44,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_objectbuffer.h>
+#include <bsls_stopwatch.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -10905,6 +10906,108 @@ int main(int argc, char *argv[])
              T_ P(result.str())
          }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ENCODING LARGE SEQUENCES
+        //
+        // Concerns:
+        //: 1 Encoding large sequences, having many elements, attributes,
+        //:   strings needing escapes, and integers, is fast in both the
+        //:   compact and the pretty encoding styles.
+        //
+        // Plan:
+        //: 1 Encode, into a 'bdlsb::MemOutStreamBuf', the number of
+        //:   'test::Employee' and 'test::MySequenceWithAttributes' objects
+        //:   optionally given as the second argument (100000 by default), and
+        //:   a 'test::MySequenceWithArrays' object having arrays of ten times
+        //:   that many integers and characters, in each encoding style, and
+        //:   report the throughput.
+        //
+        // Testing:
+        //   PERFORMANCE: ENCODING LARGE SEQUENCES
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE: ENCODING LARGE SEQUENCES"
+             << "\n=====================================" << endl;
+
+        const int N = argc > 2 ? atoi(argv[2]) : 100000;
+
+        test::Employee employee;
+        employee.name()                 = "Smith & Sons <Holdings>";
+        employee.homeAddress().street() = "731 Lexington Avenue";
+        employee.homeAddress().city()   = "New York";
+        employee.homeAddress().state()  = "New York";
+        employee.age()                  = 123456;
+
+        test::MySequenceWithAttributes withAttributes;
+        withAttributes.attribute1() = -98765;
+        withAttributes.attribute2().makeValue("an \"attribute\" value");
+        withAttributes.element1()   = 42;
+        withAttributes.element2()   = "an element value";
+
+        test::MySequenceWithArrays withArrays;
+        for (int i = 0; i < 10 * N; ++i) {
+            withArrays.attribute1().push_back(i * 7919);
+            withArrays.attribute4().push_back(static_cast<char>('a' + i % 26));
+            withArrays.attribute7().push_back(-i);
+        }
+
+        static const struct {
+            const char                  *d_name;
+            balxml::EncodingStyle::Value d_style;
+        } STYLES[] = {
+            { "compact", balxml::EncodingStyle::e_COMPACT },
+            { "pretty",  balxml::EncodingStyle::e_PRETTY  },
+        };
+
+        for (int si = 0; si < 2; ++si) {
+            balxml::EncoderOptions options;
+            options.setEncodingStyle(STYLES[si].d_style);
+
+            balxml::Encoder        encoder(&options, 0, 0);
+            bdlsb::MemOutStreamBuf output;
+
+            for (int ti = 0; ti < 3; ++ti) {
+                output.reset();
+
+                bsls::Stopwatch timer;
+                timer.start();
+
+                int rc = 0;
+                switch (ti) {
+                  case 0: {
+                    for (int i = 0; i < N; ++i) {
+                        rc |= encoder.encode(&output, employee);
+                    }
+                  } break;
+                  case 1: {
+                    for (int i = 0; i < N; ++i) {
+                        rc |= encoder.encode(&output, withAttributes);
+                    }
+                  } break;
+                  default: {
+                    rc |= encoder.encode(&output, withArrays);
+                  } break;
+                }
+
+                timer.stop();
+
+                static const char *const NAMES[] = {
+                    "Employee", "MySequenceWithAttributes",
+                    "MySequenceWithArrays"
+                };
+
+                ASSERTV(STYLES[si].d_name, ti, rc, 0 == rc);
+
+                cout << STYLES[si].d_name << ", " << NAMES[ti] << ": "
+                     << output.length() << " bytes in "
+                     << timer.elapsedTime() << " s ("
+                     << output.length() / timer.elapsedTime()
+                                                               / (1024 * 1024)
+                     << " MB/s)" << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
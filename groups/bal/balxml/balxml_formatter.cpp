@@ -63,6 +63,8 @@ Formatter::Formatter(bsl::streambuf   *output,
 , d_state(e_AT_START)
 , d_isFirstData(true)
 , d_isFirstDataAtLine(true)
+, d_valueStreamBuf(basic_allocator)
+, d_valueStream_p(0)
 {
     if (d_wrapColumn < 0) {
         // In compact mode, we don't use the 'd_elementNesting' stack.  In
@@ -87,6 +89,8 @@ Formatter::Formatter(bsl::ostream&     output,
 , d_state(e_AT_START)
 , d_isFirstData(true)
 , d_isFirstDataAtLine(true)
+, d_valueStreamBuf(basic_allocator)
+, d_valueStream_p(0)
 {
     if (d_wrapColumn < 0) {
         // In compact mode, we don't use the 'd_elementNesting' stack.  In
@@ -104,7 +108,7 @@ void Formatter::indent()
     }
 
     if (0 != d_column) {
-        d_outputStream << '\n';
+        d_outputStream.put('\n');
     }
 
     bdlb::Print::indent(d_outputStream, d_indentLevel, d_spacesPerLevel);
@@ -126,10 +130,13 @@ void Formatter::doAddAttribute(const bslstl::StringRef& name,
         --attrLen;
     }
     else {
-        d_outputStream << ' ';
+        d_outputStream.put(' ');
     }
 
-    d_outputStream << name << "=\"" << value << '"';
+    d_outputStream.write(name.data(), name.length());
+    d_outputStream.write("=\"", 2);
+    d_outputStream.write(value.data(), value.length());
+    d_outputStream.put('"');
     d_column += attrLen;
 }
 
@@ -173,12 +180,12 @@ void Formatter::doAddData(const bslstl::StringRef& value, bool addSpace)
           // false
 
         if (addSpace && !d_isFirstDataAtLine) {
-            d_outputStream << ' ';
+            d_outputStream.put(' ');
             ++d_column;
         }
     } // End if (do wrapping)
 
-    d_outputStream << value;
+    d_outputStream.write(value.data(), valueLen);
     d_column += valueLen;
     d_isFirstData = false;
     d_isFirstDataAtLine = false;
@@ -194,7 +201,8 @@ void Formatter::openElement(const bslstl::StringRef& name,
     closeTagIfOpen();
 
     indent();
-    d_outputStream << '<' << name;
+    d_outputStream.put('<');
+    d_outputStream.write(name.data(), name.length());
     d_column += 1 + name.length();
 
     if (d_wrapColumn >= 0) {
@@ -218,7 +226,7 @@ void Formatter::closeElement(const bslstl::StringRef& name)
 
     if (e_IN_TAG == d_state) {
         // Empty element (may have attributes but no data).
-        d_outputStream << "/>";
+        d_outputStream.write("/>", 2);
         d_column += 2;
     }
     else {
@@ -228,7 +236,9 @@ void Formatter::closeElement(const bslstl::StringRef& name)
             // Indent this line.
             indent();
         }
-        d_outputStream << "</" << name << '>';
+        d_outputStream.write("</", 2);
+        d_outputStream.write(name.data(), name.length());
+        d_outputStream.put('>');
         d_column += 3 + name.length();
     }
 
@@ -241,7 +251,7 @@ void Formatter::closeElement(const bslstl::StringRef& name)
     }
     else {
         // Non-compact mode: Add newline at end of element.
-        d_outputStream << '\n';
+        d_outputStream.put('\n');
         d_column = 0;
         d_isFirstDataAtLine = true;
 
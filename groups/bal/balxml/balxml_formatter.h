@@ -209,14 +209,14 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_formattingmode.h>
 #endif
 
-#ifndef INCLUDED_BDLMA_BUFFEREDSEQUENTIALALLOCATOR
-#include <bdlma_bufferedsequentialallocator.h>
-#endif
-
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
 #ifndef INCLUDED_BSLS_TYPES
 #include <bsls_types.h>
 #endif
@@ -359,6 +359,21 @@ class Formatter {
                             // first data on a line.  This is meaningful only
                             // to addListData when it's called more than once
                             // between its enclosing tags.
+    bdlsb::MemOutStreamBuf  d_valueStreamBuf;
+                            // buffer into which the values of attributes
+                            // and data are formatted before being written,
+                            // when wrapping lines; reused, so that its
+                            // memory is allocated only by the first (and the
+                            // longest) values
+    bsls::ObjectBuffer<bsl::ostream>
+                            d_valueStreamArea;
+                            // placeholder for the stream formatting into
+                            // 'd_valueStreamBuf'
+    bsl::ostream           *d_valueStream_p;
+                            // if not zero, the stream formatting into
+                            // 'd_valueStreamBuf', created at the moment of
+                            // first formatting a value, which must be
+                            // destroyed
 
     // NOT IMPLEMENTED
     Formatter(const Formatter&);
@@ -382,6 +397,13 @@ class Formatter {
         // current element is opened with 'BAEXML_WORDWRAP_INDENT' or
         // 'BAEXML_NEWLINE_INDENT'.
 
+    template <class TYPE>
+    int formatValue(const TYPE& value, int formattingMode);
+        // Format the specified 'value' using the specified 'formattingMode'
+        // into 'd_valueStreamBuf', replacing its contents.  Return 0 on
+        // success, and set the failbit of the output stream and return a
+        // non-zero value otherwise.
+
     void closeTagIfOpen();
         // Write '>' to stream to complete a just opened tag.  If the opening
         // tag was already completed with '>', do nothing.
@@ -599,11 +621,31 @@ balxml::Formatter::WhitespaceType balxml::Formatter::ElemContext::ws() const
 
 namespace balxml {
 // PRIVATE MANIPULATORS
+template <class TYPE>
+int Formatter::formatValue(const TYPE& value, int formattingMode)
+{
+    if (!d_valueStream_p) {
+        d_valueStream_p = new (d_valueStreamArea.buffer())
+                                               bsl::ostream(&d_valueStreamBuf);
+    }
+    else {
+        d_valueStream_p->clear();
+        d_valueStreamBuf.pubseekpos(0);
+    }
+
+    TypesPrintUtil::print(*d_valueStream_p, value, formattingMode);
+    if (!d_valueStream_p->good()) {
+        d_outputStream.setstate(bsl::ios_base::failbit);
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
 inline
 void Formatter::closeTagIfOpen()
 {
     if (e_IN_TAG == d_state) {
-        d_outputStream << '>';
+        d_outputStream.put('>');
         ++d_column;
         d_state = e_BETWEEN_TAGS;
     }
@@ -613,6 +655,10 @@ void Formatter::closeTagIfOpen()
 inline
 Formatter::~Formatter()
 {
+    if (d_valueStream_p) {
+        typedef bsl::ostream OStream;
+        d_valueStream_p->~OStream();
+    }
 }
 
 // MANIPULATORS
@@ -623,29 +669,21 @@ void Formatter::addAttribute(const bslstl::StringRef& name,
 {
     if (d_wrapColumn > 0) {
         // Format attribute into string, to allow for intelligent line-wrapping
-        const int BAEXML_FORMATTER_BUF_SIZE = 256;
-        char      buffer[BAEXML_FORMATTER_BUF_SIZE];
-
-        bdlma::BufferedSequentialAllocator allocator(
-                                                    buffer,
-                                                    BAEXML_FORMATTER_BUF_SIZE);
-
-        bdlsb::MemOutStreamBuf sb(&allocator);
-        bsl::ostream ss(&sb);
-
-        TypesPrintUtil::print(ss, value, formattingMode);
-        if (!ss.good()) {
-            d_outputStream.setstate(bsl::ios_base::failbit);
+        if (0 != formatValue(value, formattingMode)) {
             return;                                                   // RETURN
         }
 
-        doAddAttribute(name, bslstl::StringRef(sb.data(), (int)sb.length()));
+        doAddAttribute(name,
+                       bslstl::StringRef(d_valueStreamBuf.data(),
+                                         (int)d_valueStreamBuf.length()));
     }
     else {
         // Blast attribute to stream without line-wrapping
-        d_outputStream << ' ' << name << "=\"";
+        d_outputStream.put(' ');
+        d_outputStream.write(name.data(), name.length());
+        d_outputStream.write("=\"", 2);
         TypesPrintUtil::print(d_outputStream, value, formattingMode);
-        d_outputStream << '"';
+        d_outputStream.put('"');
         d_column += name.length() + 4;  // Minimum output if value is empty
     }
 }
@@ -656,22 +694,13 @@ void Formatter::addData(const TYPE& value, int formattingMode)
     closeTagIfOpen();
     if (d_wrapColumn > 0) {
         // Format data into string, to allow for intelligent line-wrapping
-        const int BAEXML_FORMATTER_BUF_SIZE = 256;
-        char      buffer[BAEXML_FORMATTER_BUF_SIZE];
-
-        bdlma::BufferedSequentialAllocator
-                                  allocator(buffer, BAEXML_FORMATTER_BUF_SIZE);
-
-        bdlsb::MemOutStreamBuf sb(&allocator);
-        bsl::ostream ss(&sb);
-
-        TypesPrintUtil::print(ss, value, formattingMode);
-        if (!ss.good()) {
-            d_outputStream.setstate(bsl::ios_base::failbit);
+        if (0 != formatValue(value, formattingMode)) {
             return;                                                   // RETURN
         }
 
-        doAddData(bslstl::StringRef(sb.data(), (int)sb.length()), false);
+        doAddData(bslstl::StringRef(d_valueStreamBuf.data(),
+                                    (int)d_valueStreamBuf.length()),
+                  false);
     }
     else {
         // Blast data to stream without line-wrapping
@@ -688,27 +717,18 @@ void Formatter::addListData(const TYPE& value, int formattingMode)
     closeTagIfOpen();
     if (d_wrapColumn > 0) {
         // Format data into string, to allow for intelligent line-wrapping
-        const int BAEXML_FORMATTER_BUF_SIZE = 256;
-        char      buffer[BAEXML_FORMATTER_BUF_SIZE];
-
-        bdlma::BufferedSequentialAllocator
-                                  allocator(buffer, BAEXML_FORMATTER_BUF_SIZE);
-
-        bdlsb::MemOutStreamBuf sb(&allocator);
-        bsl::ostream ss(&sb);
-
-        TypesPrintUtil::print(ss, value, formattingMode);
-        if (!ss.good()) {
-            d_outputStream.setstate(bsl::ios_base::failbit);
+        if (0 != formatValue(value, formattingMode)) {
             return;                                                   // RETURN
         }
 
-        doAddData(bslstl::StringRef(sb.data(), (int)sb.length()), true);
+        doAddData(bslstl::StringRef(d_valueStreamBuf.data(),
+                                    (int)d_valueStreamBuf.length()),
+                  true);
     }
     else {
         // Blast data to stream without line-wrapping
         if (!d_isFirstData) {
-            d_outputStream << ' ';
+            d_outputStream.put(' ');
         }
         TypesPrintUtil::print(d_outputStream, value, formattingMode);
         d_column += 1; // Assume value is not empty
@@ -733,9 +753,9 @@ void Formatter::addBlankLine()
 {
     closeTagIfOpen();
     if (d_column > 0) {
-        d_outputStream << '\n';
+        d_outputStream.put('\n');
     }
-    d_outputStream << '\n';
+    d_outputStream.put('\n');
     d_column = 0;
 }
 
@@ -743,7 +763,7 @@ inline
 void Formatter::addNewline()
 {
     closeTagIfOpen();
-    d_outputStream << '\n';
+    d_outputStream.put('\n');
     d_column = 0;
 }
 
@@ -15,10 +15,12 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 #include <balxml_errorinfo.h>
 
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>  // for swap
 #include <bsl_cctype.h>
 #include <bsl_climits.h>
+#include <bsl_cstring.h>
 
 // IMPLEMENTATION NOTES
 // --------------------
@@ -108,6 +110,71 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 
 namespace {
 
+typedef BloombergLP::bsls::Types::Uint64 Word;
+
+const Word k_BLANKS = (Word(1) << ' ')
+                    | (Word(1) << '\t')
+                    | (Word(1) << '\r');
+    // Set of the characters skipped by 'skipSpaces', as a bit mask indexed by
+    // character value.
+
+const Word k_SPACES_OR_NUL = k_BLANKS
+                           | (Word(1) << '\n')
+                           | (Word(1) << '\0');
+    // Set of the characters that end a name, as a bit mask indexed by
+    // character value.
+
+inline
+bool isInSet(char ch, Word set)
+    // Return 'true' if the specified 'ch' is in the specified 'set' of
+    // characters, all of whose values are less than 64, and 'false'
+    // otherwise.
+{
+    const unsigned char uch = static_cast<unsigned char>(ch);
+    return uch < 64 && 0 != ((set >> uch) & 1);
+}
+
+inline
+Word hasZeroByte(Word word)
+    // Return a non-zero value if any byte of the specified 'word' is zero, and
+    // 0 otherwise.
+{
+    return (word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL;
+}
+
+inline
+char *findSymbolOrNewLine(char *begin, const char *end, char symbol)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is the specified 'symbol', '\n', or '\0', or 'end'
+    // if there is no such character.  Note that the characters are examined
+    // eight at a time, which makes scanning long text and attribute values
+    // several times faster than examining them one at a time.
+{
+    const Word symbols  = 0x0101010101010101ULL
+                                          * static_cast<unsigned char>(symbol);
+    const Word newLines = 0x0101010101010101ULL * '\n';
+
+    while (end - begin >= static_cast<int>(sizeof(Word))) {
+        Word word;
+        bsl::memcpy(&word, begin, sizeof word);
+
+        if (hasZeroByte(word)
+          | hasZeroByte(word ^ symbols)
+          | hasZeroByte(word ^ newLines)) {
+            break;
+        }
+        begin += sizeof word;
+    }
+
+    while (begin != end
+        && symbol != *begin
+        && '\n'   != *begin
+        && '\0'   != *begin) {
+        ++begin;
+    }
+    return begin;
+}
+
 inline
 const char* nonNullStr(const char *s)
     // Return the specified 's' if 's' != 0, or "" otherwise.  Never returns a
@@ -403,6 +470,9 @@ MiniReader::MiniReader(bslma::Allocator *basicAllocator)
 , d_ownNamespaces   (basicAllocator)
 , d_ownPrefixes     (&d_ownNamespaces, basicAllocator)
 , d_prefixes        (&d_ownPrefixes)
+, d_cachedPrefix    (0)
+, d_cachedNamespaceId(-1)
+, d_cachedNamespaceUri(0)
 , d_currentNode     (basicAllocator)
 , d_activeNodesCount(0)
 , d_activeNodes     (basicAllocator)  // always push dummy node
@@ -438,6 +508,9 @@ MiniReader::MiniReader(int bufSize, bslma::Allocator *basicAllocator)
 , d_ownNamespaces   (basicAllocator)
 , d_ownPrefixes     (&d_ownNamespaces, basicAllocator)
 , d_prefixes        (&d_ownPrefixes)
+, d_cachedPrefix    (0)
+, d_cachedNamespaceId(-1)
+, d_cachedNamespaceUri(0)
 , d_currentNode     (basicAllocator)
 , d_activeNodesCount(0)
 , d_activeNodes     (basicAllocator)  // always push dummy node
@@ -544,6 +617,7 @@ void MiniReader::setPrefixStack(PrefixStack *prefixes)
     if (d_prefixes == 0) {
         d_prefixes = &d_ownPrefixes;
     }
+    clearPrefixCache();
 }
 
 void MiniReader::close()
@@ -568,6 +642,7 @@ int MiniReader::doOpen(const char *url, const char *encoding)
 
     d_ownPrefixes.reset();
     d_ownNamespaces.reset();
+    clearPrefixCache();
 
     // clear input source
     d_parseBuf.resize(d_readSize);
@@ -917,8 +992,9 @@ MiniReader::skipSpaces()
     while (1) {
 
         // skip SPACE, TAB, CR chars
-        size_t len = bsl::strspn(d_scanPtr, "\r\t ");
-        d_scanPtr +=len;
+        while (isInSet(*d_scanPtr, k_BLANKS)) {
+            ++d_scanPtr;
+        }
 
         if (checkForNewLine()) {
             ++d_scanPtr;          //skip NL
@@ -939,12 +1015,9 @@ MiniReader::skipSpaces()
 int
 MiniReader::scanForSymbol(char symbol)
 {
-    char strSet [] = { symbol, '\n', '\0' };
-
     while (1) {
         // find 'symbol' or NL
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = findSymbolOrNewLine(d_scanPtr, d_endPtr, symbol);
 
         if (symbol == *d_scanPtr) {
             return symbol;                                            // RETURN
@@ -970,12 +1043,12 @@ MiniReader::scanForSymbol(char symbol)
 int
 MiniReader::scanForSymbolOrSpace(char symbol)
 {
-    char strSet[] = { symbol, '\n', '\r', '\t', ' ', '\0' };
-
     while (1) {
         // find 'symbol' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        while (symbol != *d_scanPtr
+            && !isInSet(*d_scanPtr, k_SPACES_OR_NUL)) {
+            ++d_scanPtr;
+        }
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -991,14 +1064,13 @@ MiniReader::scanForSymbolOrSpace(char symbol)
 int
 MiniReader::scanForSymbolOrSpace(char symbol1, char symbol2)
 {
-    char strSet [] = {
-        symbol1, symbol2,  '\n', '\r', '\t', ' ', '\0'
-    };
-
     while (1) {
         // find 'symbol1' or 'symbol2' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        while (symbol1 != *d_scanPtr
+            && symbol2 != *d_scanPtr
+            && !isInSet(*d_scanPtr, k_SPACES_OR_NUL)) {
+            ++d_scanPtr;
+        }
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1065,14 +1137,21 @@ MiniReader::preAdvance()
       case e_NODE_TYPE_END_ELEMENT: {
         BSLS_ASSERT(d_activeNodesCount > 0);
 
-        d_prefixes->popPrefixes(d_activeNodes[d_activeNodesCount-1].second);
+        if (d_activeNodes[d_activeNodesCount-1].second) {
+            d_prefixes->popPrefixes(
+                                 d_activeNodes[d_activeNodesCount-1].second);
+            clearPrefixCache();
+        }
         if (--d_activeNodesCount == 0) {        // pop END_ELEMENT
             d_flags |= FLG_ROOT_CLOSED;
         }
       } break;
       case e_NODE_TYPE_ELEMENT: {
         if (isEmptyElement()) {
-            d_prefixes->popPrefixes(currentNode().d_namespaceCount);
+            if (currentNode().d_namespaceCount) {
+                d_prefixes->popPrefixes(currentNode().d_namespaceCount);
+                clearPrefixCache();
+            }
             if (0 == d_activeNodesCount) {
                 d_flags |= FLG_ROOT_CLOSED;
             }
@@ -1464,17 +1543,14 @@ MiniReader::updateElementInfo()
     if (colon == 0) {
         //only localName
         node.d_localName = node.d_qualifiedName;
-        node.d_namespaceId = d_prefixes->lookupNamespaceId("");
+        resolvePrefix(&node.d_namespaceId, &node.d_namespaceUri, "");
     } else {
         //  prefix:localName
         node.d_localName = colon + 1;
-        *colon = 0;   // temporary set terminating zero
-        node.d_namespaceId = d_prefixes->lookupNamespaceId(
-                                                         node.d_qualifiedName);
-
-        node.d_prefix = d_prefixes->lookupNamespacePrefix(
-                                                         node.d_qualifiedName);
-        *colon =':';  // restore
+        node.d_prefix = resolvePrefix(
+                           &node.d_namespaceId,
+                           &node.d_namespaceUri,
+                           bslstl::StringRef(node.d_qualifiedName, colon));
         if (node.d_namespaceId == -1) {
 
             // prepare a message
@@ -1498,12 +1574,37 @@ MiniReader::updateElementInfo()
            setError(ErrorInfo::e_WARNING, msg);
         }
     }
-    node.d_namespaceUri =
-        d_prefixes->lookupNamespaceUri(node.d_namespaceId);
 
     return 0;
 }
 
+const char *
+MiniReader::resolvePrefix(int                      *namespaceId,
+                          const char              **namespaceUri,
+                          const bslstl::StringRef&  prefix)
+{
+    if (d_cachedPrefix && prefix == d_cachedPrefix) {
+        *namespaceId  = d_cachedNamespaceId;
+        *namespaceUri = d_cachedNamespaceUri;
+        return d_cachedPrefix;                                        // RETURN
+    }
+
+    const char *result = d_prefixes->lookupNamespacePrefix(prefix);
+    *namespaceId       = d_prefixes->lookupNamespaceId(prefix);
+    *namespaceUri      = d_prefixes->lookupNamespaceUri(*namespaceId);
+
+    if (prefix == result) {
+        // 'prefix' is bound (or is the empty default prefix), so 'result' is
+        // held by the prefix stack, or is a string literal, until the stack is
+        // next modified.
+
+        d_cachedPrefix       = result;
+        d_cachedNamespaceId  = *namespaceId;
+        d_cachedNamespaceUri = *namespaceUri;
+    }
+    return result;
+}
+
 int
 MiniReader::scanAttributes()
 {
@@ -1616,13 +1717,17 @@ MiniReader::updateAttributes()
         const char *colon = attr.prefix();
 
         if (*colon == ':')  {                 // prefix:localName
-            *const_cast<char *>(colon) = 0;       // replace ':' with 0
+            const bslstl::StringRef qPrefix(qName, colon);
 
-            prefix = d_prefixes->lookupNamespacePrefix(qName);
+            prefix = resolvePrefix(&namespaceId, &namespaceUri, qPrefix);
 
-            *const_cast<char *>(colon) = ':';     // restore original ':'
+            if (0 == *prefix && !qPrefix.isEmpty()) {
+                // The prefix is not bound, so resolve the attribute as if it
+                // were unprefixed.
+
+                resolvePrefix(&namespaceId, &namespaceUri, prefix);
+            }
 
-            namespaceId = d_prefixes->lookupNamespaceId(prefix);
             if (namespaceId < 0) {
 
                 bsl::string msg("Prefix is not defined: '");
@@ -1645,8 +1750,6 @@ MiniReader::updateAttributes()
                 // issue warning and continue
                 setError(ErrorInfo::e_WARNING, msg);
             }
-
-            namespaceUri = d_prefixes->lookupNamespaceUri(namespaceId);
         }
 
         attr.reset(d_prefixes,
@@ -1705,6 +1808,7 @@ MiniReader::addAttribute()
         namespaceId = d_prefixes->lookupNamespaceId(prefix);
 
         d_prefixes->pushPrefix(localName, d_attrValPtr);
+        clearPrefixCache();
     }
     else if (flags & Attribute::k_ATTR_IS_XSIDECL) {
 
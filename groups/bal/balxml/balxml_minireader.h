@@ -289,6 +289,10 @@ BSLS_IDENT("$Id: $")
 #include <bslma_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
 #ifndef INCLUDED_BSL_FSTREAM
 #include <bsl_fstream.h>
 #endif
@@ -423,6 +427,16 @@ class MiniReader :  public Reader {
     PrefixStack               d_ownPrefixes;
     PrefixStack              *d_prefixes;
 
+    const char               *d_cachedPrefix;       // prefix last resolved,
+                                                    // as held by the prefix
+                                                    // stack, or 0 if none
+
+    int                       d_cachedNamespaceId;  // namespace ID of
+                                                    // 'd_cachedPrefix'
+
+    const char               *d_cachedNamespaceUri; // namespace URI of
+                                                    // 'd_cachedPrefix'
+
     Node                      d_currentNode;
     size_t                    d_activeNodesCount;  // active nodes count
     ElementVector             d_activeNodes;       // active nodes stack
@@ -468,6 +482,21 @@ class MiniReader :  public Reader {
     int   updateElementInfo();
     int   updateAttributes();
 
+    const char *resolvePrefix(int                      *namespaceId,
+                              const char              **namespaceUri,
+                              const bslstl::StringRef&  prefix);
+        // Load into the specified 'namespaceId' and 'namespaceUri' the ID and
+        // URI of the namespace to which the specified 'prefix' is bound by the
+        // prefix stack, and return the prefix string held by the prefix
+        // stack, or "" if 'prefix' is not bound.  The result of the last
+        // resolution is cached until the prefix stack is next modified, so
+        // that the prefix of consecutive elements and attributes is searched
+        // for in the prefix stack only once.
+
+    void  clearPrefixCache();
+        // Discard the result of the last resolution by 'resolvePrefix'.  This
+        // method must be called whenever the prefix stack is modified.
+
     // LOW LEVEL PARSING PRIMITIVES
     const char *rebasePointer(const char *ptr, const char *newBase);
     void  rebasePointers(const char *newBase, size_t newLength);
@@ -885,6 +914,12 @@ int MiniReader::getCharAndSet(char ch)
     return rc;
 }
 
+inline
+void MiniReader::clearPrefixCache()
+{
+    d_cachedPrefix = 0;
+}
+
 inline
 const char *MiniReader::rebasePointer(const char *ptr, const char *newBase)
 {
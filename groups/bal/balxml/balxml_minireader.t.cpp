@@ -16,6 +16,9 @@
 #include <bslma_testallocator.h>
 #include <bslma_testallocatorexception.h>
 
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>      // sprintf()
 #include <bsl_cstring.h>     // strlen()
 #include <bsl_cstdlib.h>     // atoi()
 #include <bsl_iostream.h>
@@ -739,7 +742,7 @@ int main(int argc, char *argv[])
     switch (test)
     {
       case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -780,6 +783,204 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING NAMESPACE RESOLUTION AND SCANNING
+        //
+        // Concerns:
+        //: 1 The namespace of each element and attribute is resolved against
+        //:   the prefixes in scope at that element, including after prefixes
+        //:   are declared, redeclared, and go out of scope.
+        //:
+        //: 2 Names, attribute values, and text are scanned correctly wherever
+        //:   they fall relative to the boundaries of the input buffer.
+        //
+        // Plan:
+        //: 1 Read a document declaring, redeclaring, and undeclaring prefixes
+        //:   and the default namespace, and verify the name and namespace of
+        //:   each element and of its prefixed attribute, the value of each
+        //:   attribute, and the value of each text node.  (C-1)
+        //:
+        //: 2 Repeat P-1, with the smallest buffer size, preceding the document
+        //:   with comments of various lengths, so that every construct of the
+        //:   document straddles a buffer boundary for some length.  (C-2)
+        //
+        // Testing:
+        //   NAMESPACE RESOLUTION AND SCANNING
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << "\nTESTING NAMESPACE RESOLUTION AND SCANNING"
+                               << "\n========================================="
+                               << bsl::endl;
+
+        const bsl::string LONG_TEXT(1500, 'x');
+
+        const bsl::string DOC =
+            "<a:root xmlns:a='urn:a' xmlns=\"urn:d\" a:x='1' y='2'>\n"
+            "  <e1 a:p='v&amp;w'/>\n"
+            "  <a:e2 xmlns:a='urn:a2'>\n"
+            "    <a:e3\ta:q = \"3\" />\n"
+            "    <e4 xmlns='urn:d2'><b:e5 xmlns:b='urn:b'>t &lt; u"
+            + LONG_TEXT +
+            "</b:e5></e4>\n"
+            "    <e6\r\n/>\n"
+            "  </a:e2 >\n"
+            "  <a:e7 a:r='4'>" + LONG_TEXT + "&#65;</a:e7>\n"
+            "  <e8/>\n"
+            "</a:root>\n";
+
+        const bsl::string TEXT1 = "t < u" + LONG_TEXT;
+        const bsl::string TEXT2 = LONG_TEXT + "A";
+
+        typedef balxml::Reader Reader;
+
+        static const struct {
+            int               d_line;      // source line number
+
+            Reader::NodeType  d_type;      // expected node type
+
+            const char       *d_name;      // expected node name, or value
+                                           // of text node
+
+            const char       *d_uri;       // expected namespace URI
+
+            const char       *d_attrName;  // name of prefixed attribute, if
+                                           // any
+
+            const char       *d_attrUri;   // expected URI of attribute
+
+            const char       *d_attrValue; // expected value of attribute
+        } DATA[] = {
+            //LINE TYPE                         NAME       URI
+            //---- ---------------------------- ---------- --------
+            //     ATTR    ATTR URI  ATTR VALUE
+            //     ------- --------- ----------
+
+            { L_, Reader::e_NODE_TYPE_ELEMENT,     "a:root", "urn:a",
+                   "a:x",  "urn:a",  "1"                             },
+            { L_, Reader::e_NODE_TYPE_ELEMENT,     "e1",     "urn:d",
+                   "a:p",  "urn:a",  "v&w"                           },
+            { L_, Reader::e_NODE_TYPE_ELEMENT,     "a:e2",   "urn:a2",
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_ELEMENT,     "a:e3",   "urn:a2",
+                   "a:q",  "urn:a2", "3"                             },
+            { L_, Reader::e_NODE_TYPE_ELEMENT,     "e4",     "urn:d2",
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_ELEMENT,     "b:e5",   "urn:b",
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_TEXT,        0,        0,
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_END_ELEMENT, "b:e5",   "urn:b",
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_END_ELEMENT, "e4",     "urn:d2",
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_ELEMENT,     "e6",     "urn:d",
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_END_ELEMENT, "a:e2",   "urn:a2",
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_ELEMENT,     "a:e7",   "urn:a",
+                   "a:r",  "urn:a",  "4"                             },
+            { L_, Reader::e_NODE_TYPE_TEXT,        0,        0,
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_END_ELEMENT, "a:e7",   "urn:a",
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_ELEMENT,     "e8",     "urn:d",
+                   0,      0,        0                               },
+            { L_, Reader::e_NODE_TYPE_END_ELEMENT, "a:root", "urn:a",
+                   0,      0,        0                               },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const int PADS[] = {
+            0, 1, 2, 3, 5, 7, 8, 9, 15, 16, 17, 100, 500, 977, 1000, 1001,
+            1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012,
+            1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+            1024, 1025, 1500, 2000
+        };
+        const int NUM_PADS = sizeof PADS / sizeof *PADS;
+
+        for (int p = 0; p < NUM_PADS * 2; ++p) {
+            const int  PAD       = PADS[p % NUM_PADS];
+            const bool SMALL_BUF = p >= NUM_PADS;
+
+            if (veryVerbose) { T_ P_(PAD) P(SMALL_BUF) }
+
+            const bsl::string INPUT = "<!--" + bsl::string(PAD, '-') + "-->"
+                                    + DOC;
+
+            balxml::NamespaceRegistry namespaces;
+            balxml::PrefixStack       prefixes(&namespaces);
+
+            Obj reader(SMALL_BUF ? 1024 : 8 * 1024);
+            reader.setPrefixStack(&prefixes);
+
+            ASSERTV(PAD, 0 == reader.open(INPUT.data(), INPUT.size()));
+
+            int textNode = 0;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                int rc;
+                do {
+                    rc = reader.advanceToNextNode();
+                } while (0 == rc
+                      && (Reader::e_NODE_TYPE_WHITESPACE == reader.nodeType()
+                       || Reader::e_NODE_TYPE_COMMENT == reader.nodeType()));
+
+                ASSERTV(LINE, PAD, rc, 0 == rc);
+                if (0 != rc) {
+                    break;
+                }
+
+                ASSERTV(LINE, PAD, reader.nodeType(),
+                        DATA[ti].d_type == reader.nodeType());
+
+                if (Reader::e_NODE_TYPE_TEXT == DATA[ti].d_type) {
+                    const bsl::string& TEXT = textNode++ ? TEXT2 : TEXT1;
+                    ASSERTV(LINE, PAD, TEXT == reader.nodeValue());
+                    continue;
+                }
+
+                ASSERTV(LINE, PAD, reader.nodeName(),
+                        0 == bsl::strcmp(DATA[ti].d_name, reader.nodeName()));
+                ASSERTV(LINE, PAD, reader.nodeNamespaceUri(),
+                        0 == bsl::strcmp(DATA[ti].d_uri,
+                                         reader.nodeNamespaceUri()));
+                ASSERTV(LINE, PAD, reader.nodeNamespaceId(),
+                        namespaces.lookup(DATA[ti].d_uri) ==
+                                                    reader.nodeNamespaceId());
+
+                if (DATA[ti].d_attrName) {
+                    ElementAttribute attr;
+                    ASSERTV(LINE, PAD,
+                            0 == reader.lookupAttribute(&attr,
+                                                        DATA[ti].d_attrName));
+                    ASSERTV(LINE, PAD, attr.namespaceUri(),
+                            0 == bsl::strcmp(DATA[ti].d_attrUri,
+                                             attr.namespaceUri()));
+                    ASSERTV(LINE, PAD, attr.value(),
+                            0 == bsl::strcmp(DATA[ti].d_attrValue,
+                                             attr.value()));
+                }
+            }
+
+            ASSERTV(PAD, 0 == reader.numAttributes() ||
+                         Reader::e_NODE_TYPE_END_ELEMENT ==
+                                                           reader.nodeType());
+
+            int rc;
+            do {
+                rc = reader.advanceToNextNode();
+            } while (0 == rc
+                  && Reader::e_NODE_TYPE_WHITESPACE == reader.nodeType());
+
+            ASSERTV(PAD, rc, 1 == rc);
+            ASSERTV(PAD, 0 == prefixes.numPrefixes());
+
+            reader.close();
+        }
+      } break;
+
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'xsi:nil' attribute
@@ -2345,6 +2546,97 @@ int main(int argc, char *argv[])
         reader.close();
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: READING A LARGE DOCUMENT
+        //
+        // Concerns:
+        //: 1 Reading a large document having many namespace-qualified elements
+        //:   and attributes, entity references, and long text is fast.
+        //
+        // Plan:
+        //: 1 Generate a document of the size (in megabytes) optionally given
+        //:   as the second argument (50 by default), resembling a reference
+        //:   data file, and time reading all of its nodes and attributes.
+        //
+        // Testing:
+        //   PERFORMANCE: READING A LARGE DOCUMENT
+        // --------------------------------------------------------------------
+
+        bsl::cout << "\nPERFORMANCE: READING A LARGE DOCUMENT"
+                  << "\n=====================================" << bsl::endl;
+
+        const int MEGABYTES = argc > 2 ? bsl::atoi(argv[2]) : 50;
+        if (MEGABYTES <= 0) {
+            break;
+        }
+
+        bsl::string doc;
+        doc.reserve(MEGABYTES * 1024 * 1024 + 1024);
+        doc = "<?xml version='1.0' encoding='UTF-8'?>\n"
+              "<ref:data xmlns:ref='urn:refdata' xmlns='urn:refdata:fields'\n"
+              "          xmlns:xsi='http://www.w3.org/2001/XMLSchema-instance'>"
+              "\n";
+
+        for (int i = 0; doc.size() < MEGABYTES * 1024u * 1024u; ++i) {
+            char id[16];
+            bsl::sprintf(id, "%d", i);
+
+            doc += "  <ref:record ref:id='";
+            doc += id;
+            doc += "' status='active' type='equity'>\n"
+                   "    <name>Smith &amp; Sons Holdings ";
+            doc += id;
+            doc += "</name>\n"
+                   "    <ticker>SSH";
+            doc += id;
+            doc += "</ticker>\n"
+                   "    <price currency='USD' ref:source='composite'>123.45"
+                   "</price>\n"
+                   "    <listed/>\n"
+                   "    <notes xsi:nil='true'/>\n"
+                   "    <description>A reasonably long description of the "
+                   "instrument, of the kind found in reference data, giving "
+                   "its issuer, its market, and the terms on which it "
+                   "trades.</description>\n"
+                   "  </ref:record>\n";
+        }
+        doc += "</ref:data>\n";
+
+        balxml::NamespaceRegistry namespaces;
+        balxml::PrefixStack       prefixes(&namespaces);
+
+        Obj reader;
+        reader.setPrefixStack(&prefixes);
+
+        bsls::Stopwatch timer;
+        timer.start();
+
+        ASSERT(0 == reader.open(doc.data(), doc.size()));
+
+        int numNodes      = 0;
+        int numAttributes = 0;
+        int rc;
+        while (0 == (rc = reader.advanceToNextNode())) {
+            ++numNodes;
+            for (int i = 0; i < reader.numAttributes(); ++i) {
+                ElementAttribute attr;
+                reader.lookupAttribute(&attr, i);
+                numAttributes += 0 != attr.namespaceUri();
+            }
+        }
+        reader.close();
+
+        timer.stop();
+
+        ASSERTV(rc, 1 == rc);
+
+        bsl::cout << "Read " << doc.size() << " bytes, " << numNodes
+                  << " nodes, " << numAttributes << " attributes in "
+                  << timer.elapsedTime() << " s ("
+                  << doc.size() / timer.elapsedTime() / (1024 * 1024)
+                  << " MB/s)" << bsl::endl;
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -17,6 +17,8 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 #include <balxml_base64parser.h>
 #include <balxml_hexparser.h>
 
+#include <bdlb_floatconvertutil.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bsl_climits.h>
@@ -170,6 +172,25 @@ int parseDouble(double     *result,
         return BAEXML_FAILURE;                                        // RETURN
     }
 
+    // Convert numbers in plain decimal or exponential notation without
+    // copying; anything else (e.g., INF, NaN, or leading whitespace) is left
+    // to 'parseDoubleImpl'.
+
+    const bsl::size_t numParsed = bdlb::FloatConvertUtil::parse(
+                                                         result,
+                                                         input,
+                                                         input + inputLength);
+    if (static_cast<int>(numParsed) == inputLength
+     && (!formatDecimal || !bsl::memchr(input, 'e', inputLength))
+     && (!formatDecimal || !bsl::memchr(input, 'E', inputLength))) {
+        // Overflow is an error; underflow is OK (very small number).
+
+        return *result ==  bsl::numeric_limits<double>::infinity()
+            || *result == -bsl::numeric_limits<double>::infinity()
+               ? BAEXML_FAILURE
+               : BAEXML_SUCCESS;                                      // RETURN
+    }
+
     if (inputLength < BUFLEN) {
         // Use a fixed-length buffer for efficiency.
         char  buffer[BUFLEN];
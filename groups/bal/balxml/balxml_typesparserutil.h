@@ -55,6 +55,7 @@ BSLS_IDENT("$Id: $")
 //      float                               DEFAULT, DEC
 //      double                              DEFAULT, DEC
 //      bsl::string                         DEFAULT, TEXT, BASE64, HEX
+//      bsl::basic_inplace_string<char, N>  DEFAULT, TEXT, BASE64, HEX
 //      bdlt::Date                           DEFAULT
 //      bdlt::DateTz                         DEFAULT
 //      bdlt::Datetime                       DEFAULT
@@ -85,12 +86,15 @@ BSLS_IDENT("$Id: $")
 //      [unsigned] long                     DEC
 //      bsls::Types::[Uint64|Int64]         DEC
 //      bsl::string                         TEXT
+//      bsl::basic_inplace_string<char, N>  TEXT
 //      bsl::vector<char>                   BASE64
 //
 //      'bdeat' Type Category               Default Formatting Mode
 //      ---------------------               -----------------------
 //      Enumeration                         TEXT
 //..
+// Parsing into a 'bsl::basic_inplace_string<char, N>' fails, leaving it
+// unchanged, if the parsed value is longer than 'N' characters.
 //
 ///Usage
 ///-----
@@ -176,6 +180,14 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_timetz.h>
 #endif
 
+#ifndef INCLUDED_BDLMA_LOCALSEQUENTIALALLOCATOR
+#include <bdlma_localsequentialallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_INPLACESTRING
+#include <bslstl_inplacestring.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -297,6 +309,12 @@ struct TypesParserUtil_Imp {
                            const char                 *input,
                            int                         inputLength,
                            bdlat_TypeCategory::Simple);
+    template <bsl::size_t CAPACITY>
+    static int parseBase64(
+                        bsl::basic_inplace_string<char, CAPACITY> *result,
+                        const char                                *input,
+                        int                                        inputLength,
+                        bdlat_TypeCategory::Simple);
     static int parseBase64(bsl::vector<char>         *result,
                            const char                *input,
                            int                        inputLength,
@@ -446,6 +464,12 @@ struct TypesParserUtil_Imp {
                             const char                 *input,
                             int                         inputLength,
                             bdlat_TypeCategory::Simple);
+    template <bsl::size_t CAPACITY>
+    static int parseDefault(
+                        bsl::basic_inplace_string<char, CAPACITY> *result,
+                        const char                                *input,
+                        int                                        inputLength,
+                        bdlat_TypeCategory::Simple);
     static int parseDefault(bdlt::Date                 *result,
                             const char                 *input,
                             int                         inputLength,
@@ -492,6 +516,12 @@ struct TypesParserUtil_Imp {
                         const char                 *input,
                         int                         inputLength,
                         bdlat_TypeCategory::Simple);
+    template <bsl::size_t CAPACITY>
+    static int parseHex(
+                        bsl::basic_inplace_string<char, CAPACITY> *result,
+                        const char                                *input,
+                        int                                        inputLength,
+                        bdlat_TypeCategory::Simple);
     static int parseHex(bsl::vector<char>         *result,
                         const char                *input,
                         int                        inputLength,
@@ -553,6 +583,12 @@ struct TypesParserUtil_Imp {
                          const char                 *input,
                          int                         inputLength,
                          bdlat_TypeCategory::Simple);
+    template <bsl::size_t CAPACITY>
+    static int parseText(
+                        bsl::basic_inplace_string<char, CAPACITY> *result,
+                        const char                                *input,
+                        int                                        inputLength,
+                        bdlat_TypeCategory::Simple);
     static int parseText(bsl::vector<char>         *result,
                          const char                *input,
                          int                        inputLength,
@@ -949,6 +985,35 @@ int TypesParserUtil_Imp::parseBase64(TYPE *, const char *, int, ANY_CATEGORY)
     return k_FAILURE;
 }
 
+template <bsl::size_t CAPACITY>
+int TypesParserUtil_Imp::parseBase64(
+                        bsl::basic_inplace_string<char, CAPACITY> *result,
+                        const char                                *input,
+                        int                                        inputLength,
+                        bdlat_TypeCategory::Simple)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    // Decode into a string whose buffer is local, so that values within the
+    // capacity of 'result' are decoded without allocating memory.
+
+    bdlma::LocalSequentialAllocator<CAPACITY + 1> allocator;
+    bsl::string                                   decoded(&allocator);
+    decoded.reserve(CAPACITY);
+
+    if (0 != parseBase64(&decoded,
+                         input,
+                         inputLength,
+                         bdlat_TypeCategory::Simple())
+     || CAPACITY < decoded.length()) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    result->assign(decoded.data(), decoded.length());
+
+    return k_SUCCESS;
+}
+
 // DECIMAL FUNCTIONS
 
 template <class TYPE>
@@ -1183,6 +1248,20 @@ int TypesParserUtil_Imp::parseDefault(bsl::string                *result,
                      bdlat_TypeCategory::Simple());
 }
 
+template <bsl::size_t CAPACITY>
+inline
+int TypesParserUtil_Imp::parseDefault(
+                        bsl::basic_inplace_string<char, CAPACITY> *result,
+                        const char                                *input,
+                        int                                        inputLength,
+                        bdlat_TypeCategory::Simple)
+{
+    return parseText(result,
+                     input,
+                     inputLength,
+                     bdlat_TypeCategory::Simple());
+}
+
 inline
 int TypesParserUtil_Imp::parseDefault(bdlt::Date                 *result,
                                       const char                 *input,
@@ -1277,6 +1356,35 @@ int TypesParserUtil_Imp::parseHex(TYPE *, const char *, int, ANY_CATEGORY)
     return k_FAILURE;
 }
 
+template <bsl::size_t CAPACITY>
+int TypesParserUtil_Imp::parseHex(
+                        bsl::basic_inplace_string<char, CAPACITY> *result,
+                        const char                                *input,
+                        int                                        inputLength,
+                        bdlat_TypeCategory::Simple)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    // Decode into a string whose buffer is local, so that values within the
+    // capacity of 'result' are decoded without allocating memory.
+
+    bdlma::LocalSequentialAllocator<CAPACITY + 1> allocator;
+    bsl::string                                   decoded(&allocator);
+    decoded.reserve(CAPACITY);
+
+    if (0 != parseHex(&decoded,
+                      input,
+                      inputLength,
+                      bdlat_TypeCategory::Simple())
+     || CAPACITY < decoded.length()) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    result->assign(decoded.data(), decoded.length());
+
+    return k_SUCCESS;
+}
+
 // LIST FUNCTIONS
 
 template <class TYPE>
@@ -1388,6 +1496,25 @@ int TypesParserUtil_Imp::parseText(TYPE *, const char *, int, ANY_CATEGORY)
     return k_FAILURE;
 }
 
+template <bsl::size_t CAPACITY>
+inline
+int TypesParserUtil_Imp::parseText(
+                        bsl::basic_inplace_string<char, CAPACITY> *result,
+                        const char                                *input,
+                        int                                        inputLength,
+                        bdlat_TypeCategory::Simple)
+{
+    enum { k_SUCCESS = 0, k_FAILURE = -1 };
+
+    if (CAPACITY < static_cast<bsl::size_t>(inputLength)) {
+        return k_FAILURE;                                             // RETURN
+    }
+
+    result->assign(input, inputLength);
+
+    return k_SUCCESS;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
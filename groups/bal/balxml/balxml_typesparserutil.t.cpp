@@ -37,6 +37,10 @@
 #include <bslalg_typetraits.h>
 
 #include <bslma_allocator.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslstl_inplacestring.h>
 
 #include <bsls_assert.h>
 #include <bsls_types.h>
@@ -1244,7 +1248,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1260,6 +1264,124 @@ int main(int argc, char *argv[])
 
         if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING 'bsl::basic_inplace_string'
+        //
+        // Concerns:
+        //: 1 Values printed by 'balxml::TypesPrintUtil' from an in-place
+        //:   string are parsed back to the same value, in every supported
+        //:   formatting mode.
+        //:
+        //: 2 No memory is allocated when parsing a value that fits.
+        //:
+        //: 3 Parsing a value longer than the capacity of the in-place string
+        //:   fails and leaves the string unchanged.
+        //
+        // Plan:
+        //: 1 For a set of values and each of the 'DEFAULT', 'TEXT',
+        //:   'BASE64', and 'HEX' formatting modes, print the value using
+        //:   'balxml::TypesPrintUtil', parse the output into an in-place
+        //:   string, and verify the value.  Verify that the default allocator
+        //:   is not used by 'parse'.  (C-1..2)
+        //:
+        //: 2 Parse values one character longer than the capacity in each
+        //:   formatting mode, and verify that parsing fails and the result is
+        //:   unchanged.  (C-3)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting 'bsl::basic_inplace_string'"
+                          << "\n===================================" << endl;
+
+        typedef bsl::basic_inplace_string<char, 16> Type;
+        typedef bdlat_FormattingMode                Mode;
+
+        static const int MODES[] = {
+            Mode::e_DEFAULT,
+            Mode::e_TEXT,
+            Mode::e_BASE64,
+            Mode::e_HEX,
+        };
+        const int NUM_MODES = sizeof MODES / sizeof *MODES;
+
+        if (verbose) cout << "\nRound trip." << endl;
+        {
+            static const char *const DATA[] = {
+                "",
+                "a",
+                "ab",
+                "abc",
+                "abcd",
+                "a b c",
+                "\xc2\xa9 2026",
+                "0123456789abcdef",
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                for (int j = 0; j < NUM_MODES; ++j) {
+                    const Type X(DATA[i]);
+                    const int  MODE = MODES[j];
+
+                    bsl::stringstream ss;
+                    balxml::TypesPrintUtil::print(ss, X, MODE);
+                    LOOP2_ASSERT(i, MODE, ss.good());
+
+                    const bsl::string TEXT = ss.str();
+
+                    if (veryVerbose) { T_ P_(i) P_(MODE) P(TEXT) }
+
+                    bslma::TestAllocator         da(veryVeryVerbose);
+                    bslma::DefaultAllocatorGuard guard(&da);
+
+                    Type mY("sentinel");  const Type& Y = mY;
+
+                    const int rc = Util::parse(&mY,
+                                               TEXT.data(),
+                                               static_cast<int>(TEXT.length()),
+                                               MODE);
+
+                    LOOP3_ASSERT(i, MODE, rc, 0 == rc);
+                    LOOP3_ASSERT(i, MODE, Y, X == Y);
+                    LOOP2_ASSERT(i, MODE, 0 == da.numBlocksTotal());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nValues longer than the capacity." << endl;
+        {
+            static const struct {
+                int         d_lineNum;
+                int         d_mode;
+                const char *d_input;
+            } DATA[] = {
+                //line  mode                    input
+                //----  ----                    -----
+                { L_,   Mode::e_DEFAULT,        "0123456789abcdefg"          },
+                { L_,   Mode::e_TEXT,           "0123456789abcdefg"          },
+                { L_,   Mode::e_BASE64,         "MDEyMzQ1Njc4OWFiY2RlZmc="   },
+                { L_,   Mode::e_HEX,
+                                        "3031323334353637383961626364656667" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int   LINE  = DATA[i].d_lineNum;
+                const int   MODE  = DATA[i].d_mode;
+                const char *INPUT = DATA[i].d_input;
+
+                Type mX("sentinel");  const Type& X = mX;
+
+                const int LENGTH = static_cast<int>(bsl::strlen(INPUT));
+                const int rc     = Util::parse(&mX, INPUT, LENGTH, MODE);
+
+                LOOP2_ASSERT(LINE, rc, 0 != rc);
+                LOOP2_ASSERT(LINE, X, "sentinel" == X);
+            }
+        }
+
+        if (verbose) cout << "\nEnd of Test." << endl;
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING 'parse' FUNCTION
@@ -70,6 +70,7 @@ BSLS_IDENT("$Id: $")
 //      float                               DEFAULT
 //      double                              DEFAULT
 //      bsl::string                         DEFAULT, TEXT, BASE64, HEX
+//      bsl::basic_inplace_string<char, N>  DEFAULT, TEXT, BASE64, HEX
 //      bdlt::Date                           DEFAULT
 //      bdlt::DateTz                         DEFAULT
 //      bdlt::Datetime                       DEFAULT
@@ -99,6 +100,7 @@ BSLS_IDENT("$Id: $")
 //      [unsigned] long                     DEC
 //      bsls::Types::[Uint64|Int64]         DEC
 //      bsl::string                         TEXT
+//      bsl::basic_inplace_string<char, N>  TEXT
 //      bsl::vector<char>                   BASE64
 //
 //      'bdeat' Type Category               Default Formatting Mode
@@ -236,6 +238,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_timetz.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_INPLACESTRING
+#include <bslstl_inplacestring.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -248,6 +254,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_float.h>
 #endif
 
+#ifndef INCLUDED_BDLB_INTEGERFORMATUTIL
+#include <bdlb_integerformatutil.h>
+#endif
+
 #ifndef INCLUDED_BSL_IOMANIP
 #include <bsl_iomanip.h>
 #endif
@@ -392,11 +402,26 @@ struct TypesPrintUtil_Imp {
                                    const bslstl::StringRef&    object,
                                    const EncoderOptions       *encoderOptions,
                                    bdlat_TypeCategory::Simple);
+    template <bsl::size_t CAPACITY>
+    static bsl::ostream& printBase64(
+               bsl::ostream&                                    stream,
+               const bsl::basic_inplace_string<char, CAPACITY>& object,
+               const EncoderOptions                            *encoderOptions,
+               bdlat_TypeCategory::Simple);
     static bsl::ostream& printBase64(bsl::ostream&              stream,
                                      const bsl::vector<char>&   object,
                                      const EncoderOptions      *encoderOptions,
                                      bdlat_TypeCategory::Array);
 
+    // INTEGER FUNCTIONS
+    template <class TYPE>
+    static bsl::ostream& printInteger(bsl::ostream& stream, TYPE object);
+        // Output to the specified 'stream' the decimal representation of the
+        // specified integral 'object', and return 'stream'.  Note that, unlike
+        // 'operator<<', this function formats the digits in a local buffer,
+        // writes them with a single call to 'write', and ignores the
+        // formatting flags of 'stream'.
+
     // DECIMAL FUNCTIONS
     template <class TYPE>
     static bsl::ostream& printDecimal(
@@ -601,6 +626,12 @@ struct TypesPrintUtil_Imp {
                                     const bslstl::StringRef&    object,
                                     const EncoderOptions       *encoderOptions,
                                     bdlat_TypeCategory::Simple);
+    template <bsl::size_t CAPACITY>
+    static bsl::ostream& printDefault(
+               bsl::ostream&                                    stream,
+               const bsl::basic_inplace_string<char, CAPACITY>& object,
+               const EncoderOptions                            *encoderOptions,
+               bdlat_TypeCategory::Simple);
     static bsl::ostream& printDefault(
                                     bsl::ostream&               stream,
                                     const bdlt::Date&           object,
@@ -659,6 +690,12 @@ struct TypesPrintUtil_Imp {
                                   const bslstl::StringRef&    object,
                                   const EncoderOptions       *encoderOptions,
                                   bdlat_TypeCategory::Simple);
+    template <bsl::size_t CAPACITY>
+    static bsl::ostream& printHex(
+               bsl::ostream&                                    stream,
+               const bsl::basic_inplace_string<char, CAPACITY>& object,
+               const EncoderOptions                            *encoderOptions,
+               bdlat_TypeCategory::Simple);
     static bsl::ostream& printHex(bsl::ostream&              stream,
                                   const bsl::vector<char>&   object,
                                   const EncoderOptions      *encoderOptions,
@@ -732,6 +769,12 @@ struct TypesPrintUtil_Imp {
                                    const bslstl::StringRef&    object,
                                    const EncoderOptions       *encoderOptions,
                                    bdlat_TypeCategory::Simple);
+    template <bsl::size_t CAPACITY>
+    static bsl::ostream& printText(
+               bsl::ostream&                                    stream,
+               const bsl::basic_inplace_string<char, CAPACITY>& object,
+               const EncoderOptions                            *encoderOptions,
+               bdlat_TypeCategory::Simple);
     static bsl::ostream& printText(bsl::ostream&              stream,
                                    const bsl::vector<char>&   object,
                                    const EncoderOptions      *encoderOptions,
@@ -1176,6 +1219,36 @@ bsl::ostream& TypesPrintUtil_Imp::printBase64(bsl::ostream&         stream,
     return stream;
 }
 
+template <bsl::size_t CAPACITY>
+inline
+bsl::ostream& TypesPrintUtil_Imp::printBase64(
+               bsl::ostream&                                    stream,
+               const bsl::basic_inplace_string<char, CAPACITY>& object,
+               const EncoderOptions                            *encoderOptions,
+               bdlat_TypeCategory::Simple)
+{
+    const bslstl::StringRef string(object.data(),
+                                   static_cast<int>(object.length()));
+
+    return printBase64(stream,
+                       string,
+                       encoderOptions,
+                       bdlat_TypeCategory::Simple());
+}
+
+// INTEGER FUNCTIONS
+
+template <class TYPE>
+inline
+bsl::ostream& TypesPrintUtil_Imp::printInteger(bsl::ostream& stream,
+                                               TYPE          object)
+{
+    char      buffer[bdlb::IntegerFormatUtil::k_MAX_DECIMAL_LENGTH];
+    const int length = bdlb::IntegerFormatUtil::formatDecimal(buffer, object);
+
+    return stream.write(buffer, length);
+}
+
 // DECIMAL FUNCTIONS
 
 template <class TYPE>
@@ -1243,7 +1316,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << (object ? 1 : 0);
+    return printInteger(stream, object ? 1 : 0);
 }
 
 inline
@@ -1255,7 +1328,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
 {
     signed char temp(object);  // Note that 'char' is unsigned on IBM.
 
-    return stream << int(temp);
+    return printInteger(stream, temp);
 }
 
 inline
@@ -1265,7 +1338,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1275,7 +1348,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1285,7 +1358,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1295,7 +1368,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1305,8 +1378,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    unsigned short us = object;
-    return stream << us;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1316,7 +1388,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1326,7 +1398,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1336,7 +1408,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 inline
@@ -1346,7 +1418,7 @@ bsl::ostream& TypesPrintUtil_Imp::printDecimal(
                                             const EncoderOptions       *,
                                             bdlat_TypeCategory::Simple)
 {
-    return stream << object;
+    return printInteger(stream, object);
 }
 
 // DEFAULT FUNCTIONS
@@ -1589,6 +1661,23 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
                      bdlat_TypeCategory::Simple());
 }
 
+template <bsl::size_t CAPACITY>
+inline
+bsl::ostream& TypesPrintUtil_Imp::printDefault(
+               bsl::ostream&                                    stream,
+               const bsl::basic_inplace_string<char, CAPACITY>& object,
+               const EncoderOptions                            *encoderOptions,
+               bdlat_TypeCategory::Simple)
+{
+    const bslstl::StringRef string(object.data(),
+                                   static_cast<int>(object.length()));
+
+    return printText(stream,
+                     string,
+                     encoderOptions,
+                     bdlat_TypeCategory::Simple());
+}
+
 inline
 bsl::ostream& TypesPrintUtil_Imp::printDefault(
                                             bsl::ostream&               stream,
@@ -1694,6 +1783,23 @@ bsl::ostream& TypesPrintUtil_Imp::printHex(bsl::ostream&         stream,
     return stream;
 }
 
+template <bsl::size_t CAPACITY>
+inline
+bsl::ostream& TypesPrintUtil_Imp::printHex(
+               bsl::ostream&                                    stream,
+               const bsl::basic_inplace_string<char, CAPACITY>& object,
+               const EncoderOptions                            *encoderOptions,
+               bdlat_TypeCategory::Simple)
+{
+    const bslstl::StringRef string(object.data(),
+                                   static_cast<int>(object.length()));
+
+    return printHex(stream,
+                    string,
+                    encoderOptions,
+                    bdlat_TypeCategory::Simple());
+}
+
 // LIST FUNCTIONS
 
 template <class TYPE>
@@ -1805,6 +1911,23 @@ bsl::ostream& TypesPrintUtil_Imp::printText(bsl::ostream&         stream,
     return stream;
 }
 
+template <bsl::size_t CAPACITY>
+inline
+bsl::ostream& TypesPrintUtil_Imp::printText(
+               bsl::ostream&                                    stream,
+               const bsl::basic_inplace_string<char, CAPACITY>& object,
+               const EncoderOptions                            *encoderOptions,
+               bdlat_TypeCategory::Simple)
+{
+    const bslstl::StringRef string(object.data(),
+                                   static_cast<int>(object.length()));
+
+    return printText(stream,
+                     string,
+                     encoderOptions,
+                     bdlat_TypeCategory::Simple());
+}
+
 inline
 bsl::ostream& TypesPrintUtil_Imp::printText(bsl::ostream&               stream,
                                             const bool&                 object,
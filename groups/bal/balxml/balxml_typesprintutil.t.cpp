@@ -38,6 +38,8 @@
 
 #include <bslma_allocator.h>
 
+#include <bslstl_inplacestring.h>
+
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
@@ -1001,7 +1003,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1019,6 +1021,69 @@ int main(int argc, char *argv[])
 
         if (verbose) cout << "\nEnd of Test." << endl;
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING 'bsl::basic_inplace_string'
+        //
+        // Concerns:
+        //: 1 An in-place string is printed exactly as a 'bsl::string' having
+        //:   the same value, in every supported formatting mode.
+        //:
+        //: 2 Invalid UTF-8 text sets the 'failbit' of the stream, as for
+        //:   'bsl::string'.
+        //
+        // Plan:
+        //: 1 For a set of values and each of the 'DEFAULT', 'TEXT',
+        //:   'BASE64', and 'HEX' formatting modes, print the value as an
+        //:   in-place string and as a 'bsl::string', and compare the outputs
+        //:   and the states of the streams.  (C-1..2)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting 'bsl::basic_inplace_string'"
+                          << "\n===================================" << endl;
+
+        typedef bsl::basic_inplace_string<char, 16> Type;
+
+        static const char *const DATA[] = {
+            "",
+            "a",
+            "abcd",
+            "<a & b>",
+            "\xc2\xa9 2026",
+            "0123456789abcdef",
+            "\x80",
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const int MODES[] = {
+            bdlat_FormattingMode::e_DEFAULT,
+            bdlat_FormattingMode::e_TEXT,
+            bdlat_FormattingMode::e_BASE64,
+            bdlat_FormattingMode::e_HEX,
+        };
+        const int NUM_MODES = sizeof MODES / sizeof *MODES;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            for (int j = 0; j < NUM_MODES; ++j) {
+                const Type        X(DATA[i]);
+                const bsl::string EXP_VALUE(DATA[i]);
+                const int         MODE = MODES[j];
+
+                bsl::stringstream ss;
+                bsl::stringstream expSs;
+
+                Util::print(ss, X, MODE);
+                Util::print(expSs, EXP_VALUE, MODE);
+
+                if (veryVerbose) { T_ P_(i) P_(MODE) P(ss.str()) }
+
+                LOOP3_ASSERT(i, MODE, ss.str(), expSs.str() == ss.str());
+                LOOP2_ASSERT(i, MODE, expSs.fail() == ss.fail());
+            }
+        }
+
+        if (verbose) cout << "\nEnd of Test." << endl;
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING 'print' FUNCTION
@@ -1397,9 +1462,22 @@ int main(int argc, char *argv[])
                 //----    -----            ------
                 { L_,     -2147483647-1,   "-2147483648"   },
                 { L_,     -2147483647,     "-2147483647"   },
+                { L_,     -1000,           "-1000"         },
+                { L_,     -100,            "-100"          },
+                { L_,     -99,             "-99"           },
+                { L_,     -10,             "-10"           },
+                { L_,     -9,              "-9"            },
                 { L_,     -1,              "-1"            },
                 { L_,     0,               "0"             },
                 { L_,     1,               "1"             },
+                { L_,     9,               "9"             },
+                { L_,     10,              "10"            },
+                { L_,     99,              "99"            },
+                { L_,     100,             "100"           },
+                { L_,     101,             "101"           },
+                { L_,     999,             "999"           },
+                { L_,     1000,            "1000"          },
+                { L_,     1000000007,      "1000000007"    },
                 { L_,     2147483646,      "2147483646"    },
                 { L_,     2147483647,      "2147483647"    },
             };
@@ -1628,12 +1706,6 @@ int main(int argc, char *argv[])
         {
             typedef float Type;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define ZERO   "0"
-#else
-#define ZERO
-#endif
-
             static const struct {
                 int         d_lineNum;
                 Type        d_input;
@@ -1644,12 +1716,14 @@ int main(int argc, char *argv[])
                 { L_,     -1.0f,          "-1"                            },
                 { L_,     -0.1f,          "-0.1"                          },
                 { L_,     -0.1234567f,    "-0.1234567"                    },
-                { L_,     -1.234567e-35,  "-1.234567e-" ZERO "35"         },
+                { L_,     -1.234567e-35,  "-1.234567e-35"                 },
                 { L_,     0.0f,           "0"                             },
                 { L_,     0.1f,           "0.1"                           },
                 { L_,     1.0f,           "1"                             },
                 { L_,     1234567.0f,     "1234567"                       },
-                { L_,     1.234567e35,    "1.234567e+" ZERO "35"          },
+                { L_,     1.234567e35,    "1.234567e+35"                  },
+                { L_,     1.0f / 3.0f,    "0.33333334"                    },
+                { L_,     16777216.0f,    "1.6777216e+07"                 },
                 { L_,     bsl::numeric_limits<float>::infinity(),
                                           "+INF"                          },
                 { L_,    -bsl::numeric_limits<float>::infinity(),
@@ -1657,7 +1731,6 @@ int main(int argc, char *argv[])
                 { L_,     bsl::numeric_limits<float>::signaling_NaN(),
                                           "NaN"                           },
             };
-#undef ZERO
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
             for (int i = 0; i < NUM_DATA; ++i) {
@@ -1693,6 +1766,8 @@ int main(int argc, char *argv[])
                 { L_,     1.0,        "1"              },
                 { L_,123456789012345.0, "123456789012345"},
                 { L_,1.23456789012345e105,"1.23456789012345e+105"  },
+                { L_,     0.1 + 0.2,  "0.30000000000000004"  },
+                { L_,     1.0 / 3.0,  "0.3333333333333333"   },
                 { L_,  bsl::numeric_limits<double>::infinity(), "+INF"},
                 { L_, -bsl::numeric_limits<double>::infinity(), "-INF"},
                 { L_,  bsl::numeric_limits<double>::signaling_NaN(), "NaN"},
@@ -43,7 +43,8 @@ BSLS_IDENT("$Id: $")
 // The 'ElementType' meta-function contains a typedef 'Type' that specifies the
 // type of element stored in the parameterized "array" type.
 //
-// This component specializes all of these functions for 'bsl::vector<TYPE>'.
+// This component specializes all of these functions for 'bsl::vector<TYPE>'
+// and 'bsl::small_vector<TYPE, N>'.
 //
 // Custom types can be plugged into the 'bdlat' framework.  This is done by
 // overloading the 'bdlat_array*' functions inside the namespace of the plugged
@@ -289,6 +290,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_metaint.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#include <bslstl_smallvector.h>
+#endif
+
 #ifndef INCLUDED_BSL_CSTDDEF
 #include <bsl_cstddef.h>
 #endif
@@ -309,7 +314,8 @@ namespace BloombergLP {
 
 namespace bdlat_ArrayFunctions {
     // This 'namespace' provides functions that expose "array" behavior for
-    // "array" types.  Specializations are provided for 'bsl::vector<TYPE>'.
+    // "array" types.  Specializations are provided for 'bsl::vector<TYPE>'
+    // and 'bsl::small_vector<TYPE, N>'.
     // See the component-level documentation for more information.
 
     // META-FUNCTIONS
@@ -434,6 +440,46 @@ namespace bdlat_ArrayFunctions {
     template <class TYPE, class ALLOC>
     bsl::size_t bdlat_arraySize(const bsl::vector<TYPE, ALLOC>& array);
 
+}  // close namespace bdlat_ArrayFunctions
+
+                     // =================================
+                     // bsl::small_vector specializations
+                     // =================================
+
+namespace bdlat_ArrayFunctions {
+
+    // META-FUNCTIONS
+    template <class TYPE, bsl::size_t N, class ALLOC>
+    struct IsArray<bsl::small_vector<TYPE, N, ALLOC> > : bslmf::MetaInt<1> {
+    };
+
+    template <class TYPE, bsl::size_t N, class ALLOC>
+    struct ElementType<bsl::small_vector<TYPE, N, ALLOC> > {
+        typedef TYPE Type;
+    };
+
+    // MANIPULATORS
+    template <class TYPE, bsl::size_t N, class ALLOC, class MANIPULATOR>
+    int bdlat_arrayManipulateElement(
+                                bsl::small_vector<TYPE, N, ALLOC> *array,
+                                MANIPULATOR&                       manipulator,
+                                int                                index);
+
+    template <class TYPE, bsl::size_t N, class ALLOC>
+    void bdlat_arrayResize(bsl::small_vector<TYPE, N, ALLOC> *array,
+                           int                                newSize);
+
+    // ACCESSORS
+    template <class TYPE, bsl::size_t N, class ALLOC, class ACCESSOR>
+    int bdlat_arrayAccessElement(
+                             const bsl::small_vector<TYPE, N, ALLOC>& array,
+                             ACCESSOR&                                accessor,
+                             int                                      index);
+
+    template <class TYPE, bsl::size_t N, class ALLOC>
+    bsl::size_t bdlat_arraySize(
+                              const bsl::small_vector<TYPE, N, ALLOC>& array);
+
 }  // close namespace bdlat_ArrayFunctions
 
 // ============================================================================
@@ -526,6 +572,52 @@ bsl::size_t bdlat_ArrayFunctions::bdlat_arraySize(
     return array.size();
 }
 
+                     // ---------------------------------
+                     // bsl::small_vector specializations
+                     // ---------------------------------
+
+// MANIPULATORS
+
+template <class TYPE, bsl::size_t N, class ALLOC, class MANIPULATOR>
+inline
+int bdlat_ArrayFunctions::bdlat_arrayManipulateElement(
+                                bsl::small_vector<TYPE, N, ALLOC> *array,
+                                MANIPULATOR&                       manipulator,
+                                int                                index)
+{
+    TYPE& element = (*array)[index];
+    return manipulator(&element);
+}
+
+template <class TYPE, bsl::size_t N, class ALLOC>
+inline
+void bdlat_ArrayFunctions::bdlat_arrayResize(
+                                    bsl::small_vector<TYPE, N, ALLOC> *array,
+                                    int                                newSize)
+{
+    array->resize(newSize);
+}
+
+// ACCESSORS
+
+template <class TYPE, bsl::size_t N, class ALLOC, class ACCESSOR>
+inline
+int bdlat_ArrayFunctions::bdlat_arrayAccessElement(
+                             const bsl::small_vector<TYPE, N, ALLOC>& array,
+                             ACCESSOR&                                accessor,
+                             int                                      index)
+{
+    return accessor(array[index]);
+}
+
+template <class TYPE, bsl::size_t N, class ALLOC>
+inline
+bsl::size_t bdlat_ArrayFunctions::bdlat_arraySize(
+                                const bsl::small_vector<TYPE, N, ALLOC>& array)
+{
+    return array.size();
+}
+
 }  // close enterprise namespace
 
 #endif
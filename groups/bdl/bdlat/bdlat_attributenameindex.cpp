@@ -0,0 +1,71 @@
+// bdlat_attributenameindex.cpp                                       -*-C++-*-
+#include <bdlat_attributenameindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_attributenameindex_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+
+                       // ------------------------------
+                       // class bdlat_AttributeNameIndex
+                       // ------------------------------
+
+// CREATORS
+bdlat_AttributeNameIndex::bdlat_AttributeNameIndex(
+                                 const bdlat_AttributeInfo *attributes,
+                                 int                        numAttributes,
+                                 bslma::Allocator          *basicAllocator)
+: d_slots(basicAllocator)
+, d_mask(0)
+, d_attributes_p(attributes)
+, d_numAttributes(numAttributes)
+{
+    BSLS_ASSERT(attributes || 0 == numAttributes);
+    BSLS_ASSERT(0 <= numAttributes);
+    BSLS_ASSERT(numAttributes < 0x10000);
+
+    // Use at least twice as many slots as attributes, so that probe sequences
+    // are short and a lookup of a name that is not indexed reaches an empty
+    // slot quickly.
+
+    unsigned int numSlots = 8;
+    while (numSlots < 2 * static_cast<unsigned int>(numAttributes)) {
+        numSlots *= 2;
+    }
+    d_slots.resize(numSlots, 0);
+    d_mask = numSlots - 1;
+
+    for (int i = 0; i < numAttributes; ++i) {
+        const bdlat_AttributeInfo& info = attributes[i];
+
+        BSLS_ASSERT(0 == lookup(info.d_name_p, info.d_nameLength));
+
+        const unsigned int h = hash(info.d_name_p, info.d_nameLength);
+
+        unsigned int slot = h & d_mask;
+        while (d_slots[slot]) {
+            slot = (slot + 1) & d_mask;
+        }
+        d_slots[slot] = (h & 0xffff0000U) | static_cast<unsigned int>(i + 1);
+    }
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
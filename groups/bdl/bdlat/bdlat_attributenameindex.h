@@ -0,0 +1,317 @@
+// bdlat_attributenameindex.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+#define INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a hash index from attribute names to attribute information.
+//
+//@CLASSES:
+//  bdlat_AttributeNameIndex: index of 'bdlat_AttributeInfo' objects by name
+//  bdlat_UsesAttributeNameIndex: trait: sequence publishes a name index
+//
+//@SEE_ALSO: bdlat_attributeinfo, bdlat_sequencefunctions
+//
+//@DESCRIPTION: This component provides a class, 'bdlat_AttributeNameIndex',
+// that finds, in constant time, the 'bdlat_AttributeInfo' object having a
+// given name in an array of such objects, such as the 'ATTRIBUTE_INFO_ARRAY'
+// of a generated "sequence" type.  The index is an open-addressing hash table,
+// built once, holding for each attribute its position in the array and some
+// bits of the hash of its name; a lookup therefore hashes the name once and
+// usually compares it with a single candidate.  Note that this is faster than
+// the nested 'switch' on the name length and characters of a generated
+// 'lookupAttributeInfo' function when a type has many attributes, and much
+// faster than a chain of string comparisons.
+//
+// This component also provides a trait, 'bdlat_UsesAttributeNameIndex', with
+// which a "sequence" type having 'bdlat_TypeTraitBasicSequence' publishes
+// that the functions of 'bdlat_SequenceFunctions' that take an attribute name
+// may look the name up in the index of its 'ATTRIBUTE_INFO_ARRAY' (returned
+// by 'bdlat_AttributeNameIndex::forType'), and then access or manipulate the
+// attribute by its id, instead of calling the corresponding member functions
+// of the type that take a name.  A type may declare the trait only if those
+// member functions find exactly the attributes of 'ATTRIBUTE_INFO_ARRAY'
+// having the given name (i.e., they are case-sensitive and accept no
+// aliases), as they do for types generated by 'bas_codegen.pl'.  The decoders
+// of the 'balxml' and 'baljsn' packages look up each element name they read
+// through 'bdlat_SequenceFunctions', and so benefit from the index with no
+// change.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up Attributes by Name
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an array describing the attributes of a sequence:
+//..
+//  const bdlat_AttributeInfo ATTRIBUTES[] = {
+//      { 10, "name",   4, "", bdlat_FormattingMode::e_TEXT },
+//      { 20, "age",    3, "", bdlat_FormattingMode::e_DEC  },
+//      { 30, "salary", 6, "", bdlat_FormattingMode::e_DEC  },
+//  };
+//..
+// First, we index the array:
+//..
+//  bdlat_AttributeNameIndex index(ATTRIBUTES, 3);
+//..
+// Then, we look attributes up by name:
+//..
+//  const bdlat_AttributeInfo *info = index.lookup("salary", 6);
+//  assert(&ATTRIBUTES[2] == info);
+//  assert(30             == info->id());
+//..
+// Finally, we verify that looking up a name that is not in the array fails:
+//..
+//  assert(0 == index.lookup("Salary", 6));
+//  assert(0 == index.lookup("sal",    3));
+//..
+//
+///Example 2: Publishing an Index for a Sequence Type
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a code generator emits a sequence type, 'mine::WideRecord', having
+// several hundred attributes.  To have 'bdlat_SequenceFunctions' look names
+// up in an index, the generator declares the trait in the class definition:
+//..
+//  class WideRecord {
+//      // ...
+//    public:
+//      // TRAITS
+//      BSLMF_NESTED_TRAIT_DECLARATION(WideRecord,
+//                                     bdlat_UsesAttributeNameIndex);
+//      // ...
+//  };
+//..
+// Then, 'bdlat_SequenceFunctions::manipulateAttribute' and the other
+// functions taking an attribute name use the index returned by
+// 'bdlat_AttributeNameIndex::forType<mine::WideRecord>()', which is built
+// from 'WideRecord::ATTRIBUTE_INFO_ARRAY' on first use.
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLAT_ATTRIBUTEINFO
+#include <bdlat_attributeinfo.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_NEWDELETEALLOCATOR
+#include <bslma_newdeleteallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_DETECTNESTEDTRAIT
+#include <bslmf_detectnestedtrait.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_ONCE
+#include <bslmt_once.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+
+                    // ===================================
+                    // struct bdlat_UsesAttributeNameIndex
+                    // ===================================
+
+template <class TYPE>
+struct bdlat_UsesAttributeNameIndex
+: bslmf::DetectNestedTrait<TYPE, bdlat_UsesAttributeNameIndex>::type {
+    // This 'struct' template implements a meta-function to determine whether
+    // the (template parameter) 'TYPE', which must have the
+    // 'bdlat_TypeTraitBasicSequence' trait, publishes that its attributes may
+    // be looked up by name in 'bdlat_AttributeNameIndex::forType<TYPE>()' (see
+    // the component-level documentation).  This trait is declared using
+    // 'BSLMF_NESTED_TRAIT_DECLARATION', or by specializing this 'struct'.
+};
+
+                       // ==============================
+                       // class bdlat_AttributeNameIndex
+                       // ==============================
+
+class bdlat_AttributeNameIndex {
+    // This class provides an index, built at construction, from the names of
+    // the elements of an array of 'bdlat_AttributeInfo' objects to those
+    // elements.  The array is held, not owned, and must outlive the index.
+
+    // DATA
+    bsl::vector<unsigned int>  d_slots;         // hash table; each nonzero
+                                                // slot holds, in its low 16
+                                                // bits, 1 plus the position of
+                                                // an attribute and, in its
+                                                // high 16 bits, the high bits
+                                                // of the hash of its name
+
+    unsigned int               d_mask;          // number of slots minus 1
+
+    const bdlat_AttributeInfo *d_attributes_p;  // indexed array (held, not
+                                                // owned)
+
+    int                        d_numAttributes; // length of indexed array
+
+    // PRIVATE CLASS METHODS
+    static unsigned int hash(const char *name, int nameLength);
+        // Return the hash of the specified 'name' having the specified
+        // 'nameLength'.
+
+    // NOT IMPLEMENTED
+    bdlat_AttributeNameIndex(const bdlat_AttributeNameIndex&);
+    bdlat_AttributeNameIndex& operator=(const bdlat_AttributeNameIndex&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(bdlat_AttributeNameIndex,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    template <class TYPE>
+    static const bdlat_AttributeNameIndex& forType();
+        // Return a reference providing non-modifiable access to the index of
+        // 'TYPE::ATTRIBUTE_INFO_ARRAY', having 'TYPE::k_NUM_ATTRIBUTES'
+        // elements, for the (template parameter) 'TYPE', creating the index
+        // on the first call for 'TYPE'.  This function is thread-safe.  The
+        // index is never destroyed.
+
+    // CREATORS
+    bdlat_AttributeNameIndex(const bdlat_AttributeInfo *attributes,
+                             int                        numAttributes,
+                             bslma::Allocator          *basicAllocator = 0);
+        // Create an index of the specified 'attributes' array having the
+        // specified 'numAttributes' elements.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= numAttributes < 65536', the names of the
+        // elements of 'attributes' are distinct, and 'attributes' outlives
+        // this object.
+
+    //! ~bdlat_AttributeNameIndex() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    const bdlat_AttributeInfo *lookup(const char *name, int nameLength) const;
+        // Return the address of the element of the indexed array whose name
+        // is the specified 'name' having the specified 'nameLength', or 0 if
+        // there is no such element.  The behavior is undefined unless
+        // '0 <= nameLength' and 'name' refers to at least 'nameLength'
+        // characters.
+
+    int numAttributes() const;
+        // Return the number of elements of the indexed array.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // ------------------------------
+                       // class bdlat_AttributeNameIndex
+                       // ------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+unsigned int bdlat_AttributeNameIndex::hash(const char *name, int nameLength)
+{
+    // 32-bit FNV-1a, followed by a final mix so that both the low bits (the
+    // slot) and the high bits (the tag) depend on every character.
+
+    unsigned int result = 2166136261U;
+    for (int i = 0; i < nameLength; ++i) {
+        result = (result ^ static_cast<unsigned char>(name[i])) * 16777619U;
+    }
+    result ^= result >> 15;
+    result *= 0x2c1b3c6dU;
+    result ^= result >> 12;
+    return result;
+}
+
+// CLASS METHODS
+template <class TYPE>
+const bdlat_AttributeNameIndex& bdlat_AttributeNameIndex::forType()
+{
+    static bsls::ObjectBuffer<bdlat_AttributeNameIndex> index;
+
+    BSLMT_ONCE_DO {
+        new (index.buffer()) bdlat_AttributeNameIndex(
+                                 TYPE::ATTRIBUTE_INFO_ARRAY,
+                                 TYPE::k_NUM_ATTRIBUTES,
+                                 &bslma::NewDeleteAllocator::singleton());
+    }
+    return index.object();
+}
+
+// ACCESSORS
+inline
+const bdlat_AttributeInfo *bdlat_AttributeNameIndex::lookup(
+                                                  const char *name,
+                                                  int         nameLength) const
+{
+    const unsigned int h   = hash(name, nameLength);
+    const unsigned int tag = h >> 16;
+
+    for (unsigned int i = h & d_mask; ; i = (i + 1) & d_mask) {
+        const unsigned int slot = d_slots[i];
+        if (0 == slot) {
+            return 0;                                                 // RETURN
+        }
+        if (tag == slot >> 16) {
+            const bdlat_AttributeInfo& info =
+                                         d_attributes_p[(slot & 0xffff) - 1];
+            if (nameLength == info.d_nameLength
+             && 0 == bsl::memcmp(name, info.d_name_p, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+    }
+}
+
+inline
+int bdlat_AttributeNameIndex::numAttributes() const
+{
+    return d_numAttributes;
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,527 @@
+// bdlat_attributenameindex.t.cpp                                     -*-C++-*-
+
+#include <bdlat_attributenameindex.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlat_formattingmode.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>     // 'bsl::atoi'
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test is an index, built at construction, of an array of
+// 'bdlat_AttributeInfo' objects by name.  Lookups are verified to find every
+// indexed name, and to fail for names differing from indexed names in length,
+// case, or a single character, for small arrays and for arrays large enough
+// that many names share hash slots.  'forType' is verified to return, on each
+// call, the same index of the array of the type.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] const bdlat_AttributeNameIndex& forType<TYPE>();
+//
+// CREATORS
+// [ 2] bdlat_AttributeNameIndex(const Info *, int, Allocator * = 0);
+//
+// ACCESSORS
+// [ 2] const bdlat_AttributeInfo *lookup(const char *, int) const;
+// [ 2] int numAttributes() const;
+//
+// TRAITS
+// [ 4] bdlat_UsesAttributeNameIndex
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] MANY ATTRIBUTES
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlat_AttributeNameIndex Obj;
+typedef bdlat_AttributeInfo      Info;
+
+const Info ATTRIBUTES[] = {
+    { 1, "a",       1, "", bdlat_FormattingMode::e_DEFAULT },
+    { 2, "b",       1, "", bdlat_FormattingMode::e_DEFAULT },
+    { 3, "ab",      2, "", bdlat_FormattingMode::e_DEFAULT },
+    { 4, "ba",      2, "", bdlat_FormattingMode::e_DEFAULT },
+    { 5, "name",    4, "", bdlat_FormattingMode::e_DEFAULT },
+    { 6, "Name",    4, "", bdlat_FormattingMode::e_DEFAULT },
+    { 7, "names",   5, "", bdlat_FormattingMode::e_DEFAULT },
+    { 8, "address", 7, "", bdlat_FormattingMode::e_DEFAULT },
+    { 9, "",        0, "", bdlat_FormattingMode::e_DEFAULT },
+};
+const int NUM_ATTRIBUTES = sizeof ATTRIBUTES / sizeof *ATTRIBUTES;
+
+//=============================================================================
+//                       CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace test {
+
+struct Plain {
+    // This 'struct' has an array of attribute information, but does not
+    // declare the 'bdlat_UsesAttributeNameIndex' trait.
+
+    enum { k_NUM_ATTRIBUTES = 2 };
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+};
+
+const bdlat_AttributeInfo Plain::ATTRIBUTE_INFO_ARRAY[] = {
+    { 1, "first",  5, "", bdlat_FormattingMode::e_DEFAULT },
+    { 2, "second", 6, "", bdlat_FormattingMode::e_DEFAULT },
+};
+
+struct Indexed {
+    // This 'struct' has an array of attribute information, and declares the
+    // 'bdlat_UsesAttributeNameIndex' trait.
+
+    enum { k_NUM_ATTRIBUTES = 3 };
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+    BSLMF_NESTED_TRAIT_DECLARATION(Indexed, bdlat_UsesAttributeNameIndex);
+};
+
+const bdlat_AttributeInfo Indexed::ATTRIBUTE_INFO_ARRAY[] = {
+    { 10, "x", 1, "", bdlat_FormattingMode::e_DEFAULT },
+    { 20, "y", 1, "", bdlat_FormattingMode::e_DEFAULT },
+    { 30, "z", 1, "", bdlat_FormattingMode::e_DEFAULT },
+};
+
+struct Specialized {
+    // This 'struct' is declared to have the 'bdlat_UsesAttributeNameIndex'
+    // trait by specialization.
+};
+
+}  // close namespace test
+
+namespace BloombergLP {
+
+template <>
+struct bdlat_UsesAttributeNameIndex<test::Specialized> : bsl::true_type {
+};
+
+}  // close enterprise namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up Attributes by Name
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an array describing the attributes of a sequence:
+//..
+    const bdlat_AttributeInfo ATTRIBUTES[] = {
+        { 10, "name",   4, "", bdlat_FormattingMode::e_TEXT },
+        { 20, "age",    3, "", bdlat_FormattingMode::e_DEC  },
+        { 30, "salary", 6, "", bdlat_FormattingMode::e_DEC  },
+    };
+//..
+// First, we index the array:
+//..
+    bdlat_AttributeNameIndex index(ATTRIBUTES, 3);
+//..
+// Then, we look attributes up by name:
+//..
+    const bdlat_AttributeInfo *info = index.lookup("salary", 6);
+    ASSERT(&ATTRIBUTES[2] == info);
+    ASSERT(30             == info->id());
+//..
+// Finally, we verify that looking up a name that is not in the array fails:
+//..
+    ASSERT(0 == index.lookup("Salary", 6));
+    ASSERT(0 == index.lookup("sal",    3));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'forType' AND TRAIT
+        //
+        // Concerns:
+        //: 1 'forType<TYPE>' returns an index of 'TYPE::ATTRIBUTE_INFO_ARRAY'
+        //:   having 'TYPE::k_NUM_ATTRIBUTES' elements.
+        //:
+        //: 2 Every call to 'forType<TYPE>' returns the same object.
+        //:
+        //: 3 'forType' uses neither the default nor the global allocator.
+        //:
+        //: 4 'bdlat_UsesAttributeNameIndex' is true for types declaring it
+        //:   with 'BSLMF_NESTED_TRAIT_DECLARATION' or by specialization, and
+        //:   false otherwise.
+        //
+        // Plan:
+        //: 1 Call 'forType' twice for each of two types, and look up each
+        //:   attribute name of each type in the result.  (C-1..3)
+        //:
+        //: 2 Evaluate the trait for types declaring it in each way, and for
+        //:   types not declaring it.  (C-4)
+        //
+        // Testing:
+        //   const bdlat_AttributeNameIndex& forType<TYPE>();
+        //   bdlat_UsesAttributeNameIndex
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'forType' AND TRAIT" << endl
+                          << "===================" << endl;
+
+        ASSERT( bdlat_UsesAttributeNameIndex<test::Indexed>::value);
+        ASSERT( bdlat_UsesAttributeNameIndex<test::Specialized>::value);
+        ASSERT(!bdlat_UsesAttributeNameIndex<test::Plain>::value);
+        ASSERT(!bdlat_UsesAttributeNameIndex<int>::value);
+
+        const Obj& X = Obj::forType<test::Indexed>();
+        const Obj& Y = Obj::forType<test::Plain>();
+
+        ASSERT(&X == &Obj::forType<test::Indexed>());
+        ASSERT(&Y == &Obj::forType<test::Plain>());
+        ASSERT(&X != &Y);
+
+        ASSERT(3 == X.numAttributes());
+        ASSERT(2 == Y.numAttributes());
+
+        ASSERT(&test::Indexed::ATTRIBUTE_INFO_ARRAY[1] == X.lookup("y", 1));
+        ASSERT(&test::Indexed::ATTRIBUTE_INFO_ARRAY[2] == X.lookup("z", 1));
+        ASSERT(0 == X.lookup("first", 5));
+        ASSERT(&test::Plain::ATTRIBUTE_INFO_ARRAY[1] == Y.lookup("second", 6));
+        ASSERT(0 == Y.lookup("x", 1));
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANY ATTRIBUTES
+        //
+        // Concerns:
+        //: 1 Lookups find every name, and only those names, when the index
+        //:   holds enough names that many share a hash slot, including names
+        //:   that differ only in their last character, and names that are
+        //:   prefixes of other names.
+        //
+        // Plan:
+        //: 1 For several numbers of attributes up to 2000, index names of the
+        //:   forms "fieldNNNN" and "fieldNNNN_", and look up each name, and
+        //:   names formed from each name by changing, removing, or adding a
+        //:   character.  (C-1)
+        //
+        // Testing:
+        //   MANY ATTRIBUTES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANY ATTRIBUTES" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        static const int SIZES[] = { 1, 7, 8, 100, 257, 2000 };
+
+        for (int s = 0; s < static_cast<int>(sizeof SIZES / sizeof *SIZES);
+                                                                         ++s) {
+            const int N = SIZES[s];
+
+            if (veryVerbose) { P(N) }
+
+            bsl::vector<bsl::string> names;
+            for (int i = 0; names.size() < static_cast<bsl::size_t>(N); ++i) {
+                char buffer[32];
+                bsl::sprintf(buffer, "field%04d", i);
+                names.push_back(buffer);
+                if (names.size() < static_cast<bsl::size_t>(N)) {
+                    names.push_back(bsl::string(buffer) + "_");
+                }
+            }
+
+            bsl::vector<Info> infos(N);
+            for (int i = 0; i < N; ++i) {
+                infos[i].d_id             = 1000 + i;
+                infos[i].d_name_p         = names[i].c_str();
+                infos[i].d_nameLength     =
+                                          static_cast<int>(names[i].size());
+                infos[i].d_annotation_p   = "";
+                infos[i].d_formattingMode = bdlat_FormattingMode::e_DEFAULT;
+            }
+
+            const Obj X(infos.data(), N, &oa);
+            ASSERT(N == X.numAttributes());
+
+            for (int i = 0; i < N; ++i) {
+                const bsl::string& NAME   = names[i];
+                const int          LENGTH = static_cast<int>(NAME.size());
+
+                LOOP2_ASSERT(N, NAME, &infos[i] == X.lookup(NAME.data(),
+                                                            LENGTH));
+
+                bsl::string changed(NAME);
+                changed[LENGTH - 1] = 'x';
+                LOOP2_ASSERT(N, NAME, 0 == X.lookup(changed.data(), LENGTH));
+
+                LOOP2_ASSERT(N, NAME, 0 == X.lookup(NAME.data(), LENGTH - 1)
+                                   || NAME[LENGTH - 1] == '_');
+
+                bsl::string longer(NAME + "0");
+                LOOP2_ASSERT(N, NAME, 0 == X.lookup(longer.data(),
+                                                    LENGTH + 1));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'lookup' returns the address of the element of the indexed array
+        //:   having the given name, comparing names case-sensitively and by
+        //:   their full length, and 0 if there is no such element.
+        //:
+        //: 2 The empty name may be indexed, and found.
+        //:
+        //: 3 'numAttributes' returns the number of elements indexed.
+        //:
+        //: 4 An index of no attributes finds no name.
+        //:
+        //: 5 Memory is supplied by the allocator given to the constructor, or
+        //:   else by the default allocator, and is released on destruction.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Index each prefix of an array of names chosen to differ in case
+        //:   and length, and look up each name of the array.  (C-1..3, 5)
+        //:
+        //: 2 Index an empty array.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments, including duplicate names.
+        //:   (C-6)
+        //
+        // Testing:
+        //   bdlat_AttributeNameIndex(const Info *, int, Allocator * = 0);
+        //   const bdlat_AttributeInfo *lookup(const char *, int) const;
+        //   int numAttributes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTOR AND ACCESSORS" << endl
+                          << "==================" << endl;
+
+        for (int n = 0; n <= NUM_ATTRIBUTES; ++n) {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                const Obj X(ATTRIBUTES, n, &oa);
+
+                LOOP_ASSERT(n, n == X.numAttributes());
+                LOOP_ASSERT(n, 0 <  oa.numBlocksInUse());
+
+                for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+                    const Info& INFO = ATTRIBUTES[i];
+                    const Info *EXP  = i < n ? &INFO : 0;
+
+                    LOOP2_ASSERT(n, i, EXP == X.lookup(INFO.d_name_p,
+                                                       INFO.d_nameLength));
+                }
+
+                LOOP_ASSERT(n, 0 == X.lookup("NAME",     4));
+                LOOP_ASSERT(n, 0 == X.lookup("nam",      3));
+                LOOP_ASSERT(n, 0 == X.lookup("name ",    5));
+                LOOP_ASSERT(n, 0 == X.lookup("addresses", 9));
+                LOOP_ASSERT(n, 0 == X.lookup("c",        1));
+            }
+            LOOP_ASSERT(n, 0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\tDefault allocator." << endl;
+        {
+            const Obj X(ATTRIBUTES, NUM_ATTRIBUTES);
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+            ASSERT(&ATTRIBUTES[7] == X.lookup("address", 7));
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Info DUPLICATES[] = {
+                { 1, "a", 1, "", bdlat_FormattingMode::e_DEFAULT },
+                { 2, "a", 1, "", bdlat_FormattingMode::e_DEFAULT },
+            };
+
+            ASSERT_PASS(Obj(ATTRIBUTES, 0));
+            ASSERT_PASS(Obj(0, 0));
+            ASSERT_FAIL(Obj(0, 1));
+            ASSERT_FAIL(Obj(ATTRIBUTES, -1));
+            ASSERT_PASS(Obj(DUPLICATES, 1));
+            ASSERT_FAIL(Obj(DUPLICATES, 2));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Index a few attributes and look up a few names.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const Obj X(ATTRIBUTES, 3);
+
+        ASSERT(3 == X.numAttributes());
+        ASSERT(&ATTRIBUTES[0] == X.lookup("a",  1));
+        ASSERT(&ATTRIBUTES[2] == X.lookup("ab", 2));
+        ASSERT(&ATTRIBUTES[1] == X.lookup("b",  1));
+        ASSERT(0              == X.lookup("ba", 2));
+        ASSERT(0              == X.lookup("c",  1));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
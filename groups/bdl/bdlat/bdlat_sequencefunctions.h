@@ -20,7 +20,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlat_SequenceFunctions: namespace for calling sequence functions
 //
-//@SEE_ALSO: bdlat_attributeinfo
+//@SEE_ALSO: bdlat_attributeinfo, bdlat_attributenameindex
 //
 //@DESCRIPTION: The 'bdlat_SequenceFunctions' 'namespace' provided in this
 // component defines parameterized functions that expose "sequence" behavior
@@ -42,7 +42,11 @@ BSLS_IDENT("$Id: $")
 // behavior through the 'bdlat_SequenceFunctions' 'namespace'.
 //
 // This component specializes all of these functions for types that have the
-// 'bdlat_TypeTraitBasicSequence' trait.
+// 'bdlat_TypeTraitBasicSequence' trait.  For such a type that also has the
+// 'bdlat_UsesAttributeNameIndex' trait, the functions taking an attribute
+// name look the name up in the hash index returned by
+// 'bdlat_AttributeNameIndex::forType' and then call the member functions of
+// the type taking an attribute id (see 'bdlat_attributenameindex').
 //
 // Types that do not have the 'bdlat_TypeTraitBasicSequence' trait can be
 // plugged into the 'bdlat' framework.  This is done by overloading the
@@ -590,6 +594,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_bdeatoverrides.h>
 #endif
 
+#ifndef INCLUDED_BDLAT_ATTRIBUTENAMEINDEX
+#include <bdlat_attributenameindex.h>
+#endif
+
 #ifndef INCLUDED_BDLAT_TYPETRAITS
 #include <bdlat_typetraits.h>
 #endif
@@ -764,6 +772,58 @@ namespace bdlat_SequenceFunctions {
 
 }  // close namespace bdlat_SequenceFunctions
 
+// ---- Anything below this line is implementation specific.  Do not use.  ----
+
+                     // ==================================
+                     // struct bdlat_SequenceFunctions_Imp
+                     // ==================================
+
+struct bdlat_SequenceFunctions_Imp {
+    // This 'struct' implements the default functions that take an attribute
+    // name, calling the corresponding member function of a generated type
+    // ('bslmf::MetaInt<0>') or, for a type having the
+    // 'bdlat_UsesAttributeNameIndex' trait, looking the name up in the index
+    // of the type and calling the member function taking an attribute id
+    // ('bslmf::MetaInt<1>').
+
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE               *object,
+                                   MANIPULATOR&        manipulator,
+                                   const char         *attributeName,
+                                   int                 attributeNameLength,
+                                   bslmf::MetaInt<0>);
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE               *object,
+                                   MANIPULATOR&        manipulator,
+                                   const char         *attributeName,
+                                   int                 attributeNameLength,
+                                   bslmf::MetaInt<1>);
+
+    template <class TYPE, class ACCESSOR>
+    static int accessAttribute(const TYPE&        object,
+                               ACCESSOR&          accessor,
+                               const char        *attributeName,
+                               int                attributeNameLength,
+                               bslmf::MetaInt<0>);
+    template <class TYPE, class ACCESSOR>
+    static int accessAttribute(const TYPE&        object,
+                               ACCESSOR&          accessor,
+                               const char        *attributeName,
+                               int                attributeNameLength,
+                               bslmf::MetaInt<1>);
+
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&        object,
+                             const char        *attributeName,
+                             int                attributeNameLength,
+                             bslmf::MetaInt<0>);
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&        object,
+                             const char        *attributeName,
+                             int                attributeNameLength,
+                             bslmf::MetaInt<1>);
+};
+
 // ============================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -925,9 +985,12 @@ int bdlat_SequenceFunctions::bdlat_sequenceManipulateAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return object->manipulateAttribute(manipulator,
-                                       attributeName,
-                                       attributeNameLength);
+    return bdlat_SequenceFunctions_Imp::manipulateAttribute(
+                  object,
+                  manipulator,
+                  attributeName,
+                  attributeNameLength,
+                  bslmf::MetaInt<bdlat_UsesAttributeNameIndex<TYPE>::value>());
 }
 
 template <class TYPE, class MANIPULATOR>
@@ -968,9 +1031,12 @@ int bdlat_SequenceFunctions::bdlat_sequenceAccessAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return object.accessAttribute(accessor,
-                                  attributeName,
-                                  attributeNameLength);
+    return bdlat_SequenceFunctions_Imp::accessAttribute(
+                  object,
+                  accessor,
+                  attributeName,
+                  attributeNameLength,
+                  bslmf::MetaInt<bdlat_UsesAttributeNameIndex<TYPE>::value>());
 }
 
 template <class TYPE, class ACCESSOR>
@@ -1012,7 +1078,11 @@ bool bdlat_SequenceFunctions::bdlat_sequenceHasAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
+    return bdlat_SequenceFunctions_Imp::hasAttribute(
+                  object,
+                  attributeName,
+                  attributeNameLength,
+                  bslmf::MetaInt<bdlat_UsesAttributeNameIndex<TYPE>::value>());
 }
 
 template <class TYPE>
@@ -1026,6 +1096,100 @@ bool bdlat_SequenceFunctions::bdlat_sequenceHasAttribute(
 
     return 0 != object.lookupAttributeInfo(attributeId);
 }
+
+                     // ----------------------------------
+                     // struct bdlat_SequenceFunctions_Imp
+                     // ----------------------------------
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_SequenceFunctions_Imp::manipulateAttribute(
+                                      TYPE               *object,
+                                      MANIPULATOR&        manipulator,
+                                      const char         *attributeName,
+                                      int                 attributeNameLength,
+                                      bslmf::MetaInt<0>)
+{
+    return object->manipulateAttribute(manipulator,
+                                       attributeName,
+                                       attributeNameLength);
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_SequenceFunctions_Imp::manipulateAttribute(
+                                      TYPE               *object,
+                                      MANIPULATOR&        manipulator,
+                                      const char         *attributeName,
+                                      int                 attributeNameLength,
+                                      bslmf::MetaInt<1>)
+{
+    const bdlat_AttributeInfo *info =
+                         bdlat_AttributeNameIndex::forType<TYPE>().lookup(
+                                                         attributeName,
+                                                         attributeNameLength);
+    if (0 == info) {
+        return -1;                                                    // RETURN
+    }
+    return object->manipulateAttribute(manipulator, info->d_id);
+}
+
+template <class TYPE, class ACCESSOR>
+inline
+int bdlat_SequenceFunctions_Imp::accessAttribute(
+                                      const TYPE&        object,
+                                      ACCESSOR&          accessor,
+                                      const char        *attributeName,
+                                      int                attributeNameLength,
+                                      bslmf::MetaInt<0>)
+{
+    return object.accessAttribute(accessor,
+                                  attributeName,
+                                  attributeNameLength);
+}
+
+template <class TYPE, class ACCESSOR>
+inline
+int bdlat_SequenceFunctions_Imp::accessAttribute(
+                                      const TYPE&        object,
+                                      ACCESSOR&          accessor,
+                                      const char        *attributeName,
+                                      int                attributeNameLength,
+                                      bslmf::MetaInt<1>)
+{
+    const bdlat_AttributeInfo *info =
+                         bdlat_AttributeNameIndex::forType<TYPE>().lookup(
+                                                         attributeName,
+                                                         attributeNameLength);
+    if (0 == info) {
+        return -1;                                                    // RETURN
+    }
+    return object.accessAttribute(accessor, info->d_id);
+}
+
+template <class TYPE>
+inline
+bool bdlat_SequenceFunctions_Imp::hasAttribute(
+                                      const TYPE&        object,
+                                      const char        *attributeName,
+                                      int                attributeNameLength,
+                                      bslmf::MetaInt<0>)
+{
+    return 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
+}
+
+template <class TYPE>
+inline
+bool bdlat_SequenceFunctions_Imp::hasAttribute(
+                                      const TYPE&        ,
+                                      const char        *attributeName,
+                                      int                attributeNameLength,
+                                      bslmf::MetaInt<1>)
+{
+    return 0 != bdlat_AttributeNameIndex::forType<TYPE>().lookup(
+                                                         attributeName,
+                                                         attributeNameLength);
+}
 #ifdef BSLS_PLATFORM_CMP_MSVC
 #pragma warning( pop )
 #endif
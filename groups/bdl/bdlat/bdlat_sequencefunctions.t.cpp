@@ -13,6 +13,7 @@
 #include <bslim_testutil.h>
 
 #include <bdlat_attributeinfo.h>
+#include <bdlat_attributenameindex.h>
 #include <bdlat_formattingmode.h>
 #include <bdlat_typetraits.h>
 
@@ -45,6 +46,7 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // [ 1] METHOD FORWARDING TEST
 // [ 2] INFO ACCESS TEST
+// [ 3] NAME INDEX DISPATCH TEST
 // [ 4] USAGE EXAMPLE
 
 // ============================================================================
@@ -314,6 +316,83 @@ const bdlat_AttributeInfo *Point::lookupAttributeInfo(int id)
     }
 }
 
+class IndexedPoint {
+    // This class is a "sequence" type, having the same attributes as 'Point',
+    // that declares the 'bdlat_UsesAttributeNameIndex' trait.  Its member
+    // functions taking an attribute name must not be called, and those taking
+    // an attribute id record that id in 'globalFlag'.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_NUM_ATTRIBUTES = 2 // the number of attributes in this class
+    };
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+        // attribute info for each attribute
+
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(IndexedPoint, bdlat_TypeTraitBasicSequence);
+    BSLMF_NESTED_TRAIT_DECLARATION(IndexedPoint,
+                                   bdlat_UsesAttributeNameIndex);
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+        // Return attribute information for the attribute indicated by the
+        // specified 'id' if the attribute exists, and 0 otherwise.
+    {
+        return 1 <= id && id <= k_NUM_ATTRIBUTES
+               ? &ATTRIBUTE_INFO_ARRAY[id - 1]
+               : 0;
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(const char *, int)
+        // Set 'globalFlag' to -1 and return 0.
+    {
+        globalFlag = -1;
+        return 0;
+    }
+
+    // MANIPULATORS
+    template<class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&, const char *, int)
+        // Set 'globalFlag' to -1 and return -1.
+    {
+        globalFlag = -1;
+        return globalFlag;
+    }
+
+    template<class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&, int id)
+        // Set 'globalFlag' to the specified 'id' and return it.
+    {
+        globalFlag = id;
+        return globalFlag;
+    }
+
+    // ACCESSORS
+    template<class ACCESSOR>
+    int accessAttribute(ACCESSOR&, const char *, int) const
+        // Set 'globalFlag' to -1 and return -1.
+    {
+        globalFlag = -1;
+        return globalFlag;
+    }
+
+    template<class ACCESSOR>
+    int accessAttribute(ACCESSOR&, int id) const
+        // Set 'globalFlag' to 10 plus the specified 'id' and return it.
+    {
+        globalFlag = 10 + id;
+        return globalFlag;
+    }
+};
+
+const bdlat_AttributeInfo IndexedPoint::ATTRIBUTE_INFO_ARRAY[] = {
+    {1, "X", sizeof("X") - 1, "X coordinate"},
+    {2, "Y", sizeof("Y") - 1, "Y coordinate"}
+};
+
 }  // close namespace geom
 
 // ============================================================================
@@ -769,7 +848,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -796,6 +875,75 @@ int main(int argc, char *argv[])
                     "age: 25\n"
                     "salary: 12345.00\n" == ss.str());
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // NAME INDEX DISPATCH TEST
+        //
+        // Concerns:
+        //: 1 For a type having the 'bdlat_UsesAttributeNameIndex' trait, the
+        //:   functions taking an attribute name call the member functions
+        //:   taking the id of the attribute having that name, and never the
+        //:   member functions taking a name.
+        //:
+        //: 2 Those functions return non-zero, without calling any member
+        //:   function, for a name that is not an attribute name.
+        //
+        // Plan:
+        //: 1 Call each function with each attribute name of a type recording
+        //:   the member function called, and with names that are not
+        //:   attribute names.  (C-1..2)
+        //
+        // Testing:
+        //   int manipulateAttribute(TYPE *, MANIP&, const char *, int);
+        //   int accessAttribute(const TYPE&, ACCESSOR&, const char *, int);
+        //   bool hasAttribute(const TYPE&, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "NAME INDEX DISPATCH TEST" << endl
+                          << "========================" << endl;
+
+        ASSERT( bdlat_UsesAttributeNameIndex<geom::IndexedPoint>::value);
+        ASSERT(!bdlat_UsesAttributeNameIndex<geom::Point>::value);
+
+        geom::IndexedPoint mP;  const geom::IndexedPoint& P = mP;
+        int                dummyVisitor;
+
+        globalFlag = 0;
+        ASSERT(2 == Obj::manipulateAttribute(&mP, dummyVisitor, "Y", 1));
+        ASSERT(2 == globalFlag);
+
+        globalFlag = 0;
+        ASSERT(1 == Obj::manipulateAttribute(&mP, dummyVisitor, "X", 1));
+        ASSERT(1 == globalFlag);
+
+        globalFlag = 0;
+        ASSERT(12 == Obj::accessAttribute(P, dummyVisitor, "Y", 1));
+        ASSERT(12 == globalFlag);
+
+        globalFlag = 0;
+        ASSERT(Obj::hasAttribute(P, "X", 1));
+        ASSERT(Obj::hasAttribute(P, "Y", 1));
+        ASSERT(0 == globalFlag);
+
+        static const char *const MISSES[] = { "", "x", "Z", "XY", "X " };
+        for (int i = 0; i < 5; ++i) {
+            const char *NAME   = MISSES[i];
+            const int   LENGTH = static_cast<int>(bsl::strlen(NAME));
+
+            globalFlag = 0;
+            LOOP_ASSERT(NAME, 0 != Obj::manipulateAttribute(&mP,
+                                                            dummyVisitor,
+                                                            NAME,
+                                                            LENGTH));
+            LOOP_ASSERT(NAME, 0 != Obj::accessAttribute(P,
+                                                        dummyVisitor,
+                                                        NAME,
+                                                        LENGTH));
+            LOOP_ASSERT(NAME, !Obj::hasAttribute(P, NAME, LENGTH));
+            LOOP_ASSERT(NAME, 0 == globalFlag);
+        }
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // TESTING META-FUNCTIONS
@@ -40,6 +40,8 @@ BSLS_IDENT("$Id: $")
 //      o any type with the 'bdlat_TypeTraitBasicCustomizedType' trait
 //      o types instantiated from the 'bdlb::NullableValue' template
 //      o types instantiated from the 'bsl::vector' template
+//      o types instantiated from the 'bsl::small_vector' template
+//      o types instantiated from the 'bsl::basic_inplace_string' template
 //      o types instantiated from the 'bsl::basic_string' template
 //..
 // Third-party types may overload the 'bdlat_valueTypeReset' function to
@@ -124,6 +126,14 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_isconvertible.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_INPLACESTRING
+#include <bslstl_inplacestring.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#include <bslstl_smallvector.h>
+#endif
+
 #ifndef INCLUDED_BSL_STRING
 #include <bsl_string.h>
 #endif
@@ -269,9 +279,16 @@ struct bdlat_ValueTypeFunctions_Imp {
     template <class TYPE, class ALLOC>
     static void reset(bsl::vector<TYPE, ALLOC> *object);
 
+    template <class TYPE, bsl::size_t N, class ALLOC>
+    static void reset(bsl::small_vector<TYPE, N, ALLOC> *object);
+
     template <class CHAR_T, class CHAR_TRAITS, class ALLOC>
     static void reset(bsl::basic_string<CHAR_T, CHAR_TRAITS, ALLOC> *object);
 
+    template <class CHAR_T, bsl::size_t N, class CHAR_TRAITS>
+    static void reset(
+                   bsl::basic_inplace_string<CHAR_T, N, CHAR_TRAITS> *object);
+
     template <class TYPE>
     static void reset(TYPE *object, UseResetMethod);
 
@@ -545,6 +562,14 @@ void bdlat_ValueTypeFunctions_Imp::reset(bsl::vector<TYPE, ALLOC> *object)
     object->clear();
 }
 
+template <class TYPE, bsl::size_t N, class ALLOC>
+inline
+void bdlat_ValueTypeFunctions_Imp::reset(
+                                     bsl::small_vector<TYPE, N, ALLOC> *object)
+{
+    object->clear();
+}
+
 template <class CHAR_T, class CHAR_TRAITS, class ALLOC>
 inline
 void bdlat_ValueTypeFunctions_Imp::reset(
@@ -553,6 +578,14 @@ void bdlat_ValueTypeFunctions_Imp::reset(
     object->erase();
 }
 
+template <class CHAR_T, bsl::size_t N, class CHAR_TRAITS>
+inline
+void bdlat_ValueTypeFunctions_Imp::reset(
+                     bsl::basic_inplace_string<CHAR_T, N, CHAR_TRAITS> *object)
+{
+    object->clear();
+}
+
 template <class TYPE>
 inline
 void bdlat_ValueTypeFunctions_Imp::reset(TYPE *object, UseResetMethod)
@@ -409,6 +409,15 @@ int main(int argc, char *argv[])
             ASSERT(0 == X.size());
         }
 
+        {
+            typedef bsl::basic_inplace_string<char, 8> InplaceString;
+
+            InplaceString mX("foo");  const InplaceString& X = mX;
+            ASSERT(0 != X.size());
+            bdlat_ValueTypeFunctions::reset(&mX);
+            ASSERT(0 == X.size());
+        }
+
         {
             geom::Sequence_Point mX;  const geom::Sequence_Point& X = mX;
             mX.x() = 77;
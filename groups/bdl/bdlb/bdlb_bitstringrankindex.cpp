@@ -0,0 +1,276 @@
+// bdlb_bitstringrankindex.cpp                                        -*-C++-*-
+#include <bdlb_bitstringrankindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlb_bitstringrankindex_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitmaskutil.h>
+#include <bdlb_bitutil.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_c_limits.h>    // 'CHAR_BIT'
+
+using namespace BloombergLP;
+using bsl::size_t;
+using bsl::uint64_t;
+
+namespace {
+
+typedef bdlb::BitStringRankIndex Index;
+
+enum {
+    k_BITS_PER_UINT64 = Index::k_BITS_PER_UINT64,
+    k_WORDS_PER_BLOCK = Index::k_WORDS_PER_BLOCK,
+    k_BITS_PER_BLOCK  = Index::k_BITS_PER_BLOCK,
+    k_SUB_COUNT_BITS  = 9,      // bits per sub-count field
+    k_SUB_COUNT_MASK  = 0x1ff   // mask of the low-order sub-count field
+};
+
+BSLMF_ASSERT(sizeof(uint64_t) * CHAR_BIT == k_BITS_PER_UINT64);
+BSLMF_ASSERT((k_WORDS_PER_BLOCK - 1) * k_BITS_PER_UINT64
+                                                   < (1 << k_SUB_COUNT_BITS));
+BSLMF_ASSERT((k_WORDS_PER_BLOCK - 1) * k_SUB_COUNT_BITS <= k_BITS_PER_UINT64);
+
+inline
+size_t subCount1(uint64_t subCounts, int word)
+    // Return the number of 1 bits preceding the specified 'word' of a block
+    // within the block, given the specified 'subCounts' of the block.  The
+    // behavior is undefined unless '0 <= word < k_WORDS_PER_BLOCK'.
+{
+    return word ? static_cast<size_t>(
+                          (subCounts >> (k_SUB_COUNT_BITS * (word - 1)))
+                                                            & k_SUB_COUNT_MASK)
+                : 0;
+}
+
+int selectInWord(uint64_t word, size_t rank)
+    // Return the index of the set bit of the specified 'word' that is
+    // preceded by the specified 'rank' set bits.  The behavior is undefined
+    // unless 'rank < BitUtil::numBitsSet(word)'.
+{
+    // Skip whole bytes, then clear the lowest set bits of the byte found.
+
+    int index = 0;
+    int count = bdlb::BitUtil::numBitsSet(word & 0xff);
+    while (rank >= static_cast<size_t>(count)) {
+        rank  -= count;
+        index += 8;
+        count  = bdlb::BitUtil::numBitsSet((word >> index) & 0xff);
+    }
+
+    uint64_t byte = word >> index;
+    for (; rank > 0; --rank) {
+        byte &= byte - 1;
+    }
+    return index + bdlb::BitUtil::numTrailingUnsetBits(byte);
+}
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlb {
+
+                         // ------------------------
+                         // class BitStringRankIndex
+                         // ------------------------
+
+// PRIVATE ACCESSORS
+size_t BitStringRankIndex::findBlock(size_t rank, bool value) const
+{
+    // Find the last block preceded by at most 'rank' bits having 'value'.
+    // Note that 'd_counts' holds the counts of 1 bits; the number of 0 bits
+    // preceding block 'b' is 'b * k_BITS_PER_BLOCK' minus that count.
+
+    size_t lo = 0;
+    size_t hi = d_counts.size() / 2;
+    while (hi - lo > 1) {
+        const size_t mid       = lo + (hi - lo) / 2;
+        const size_t preceding = value
+                        ? static_cast<size_t>(d_counts[2 * mid])
+                        : mid * k_BITS_PER_BLOCK
+                                     - static_cast<size_t>(d_counts[2 * mid]);
+        if (preceding <= rank) {
+            lo = mid;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// CREATORS
+BitStringRankIndex::BitStringRankIndex(bslma::Allocator *basicAllocator)
+: d_counts(basicAllocator)
+, d_bitString_p(0)
+, d_length(0)
+, d_num1(0)
+{
+}
+
+BitStringRankIndex::BitStringRankIndex(const uint64_t   *bitString,
+                                       size_t            length,
+                                       bslma::Allocator *basicAllocator)
+: d_counts(basicAllocator)
+, d_bitString_p(0)
+, d_length(0)
+, d_num1(0)
+{
+    reset(bitString, length);
+}
+
+BitStringRankIndex::BitStringRankIndex(
+                                    const BitStringRankIndex&  original,
+                                    bslma::Allocator          *basicAllocator)
+: d_counts(original.d_counts, basicAllocator)
+, d_bitString_p(original.d_bitString_p)
+, d_length(original.d_length)
+, d_num1(original.d_num1)
+{
+}
+
+BitStringRankIndex::~BitStringRankIndex()
+{
+}
+
+// MANIPULATORS
+BitStringRankIndex& BitStringRankIndex::operator=(
+                                                const BitStringRankIndex& rhs)
+{
+    d_counts      = rhs.d_counts;
+    d_bitString_p = rhs.d_bitString_p;
+    d_length      = rhs.d_length;
+    d_num1        = rhs.d_num1;
+
+    return *this;
+}
+
+void BitStringRankIndex::reset()
+{
+    d_counts.clear();
+    d_bitString_p = 0;
+    d_length      = 0;
+    d_num1        = 0;
+}
+
+void BitStringRankIndex::reset(const uint64_t *bitString, size_t length)
+{
+    BSLS_ASSERT(bitString || 0 == length);
+
+    // Allocate one block more than the number of complete blocks, so that
+    // 'rank1(length)' reads a valid block when 'length' is a multiple of
+    // 'k_BITS_PER_BLOCK'.
+
+    const size_t numWords  = (length + k_BITS_PER_UINT64 - 1)
+                                                          / k_BITS_PER_UINT64;
+    const size_t numBlocks = length ? numWords / k_WORDS_PER_BLOCK + 1 : 0;
+
+    d_counts.resize(2 * numBlocks);
+
+    const int lastBits = static_cast<int>(length % k_BITS_PER_UINT64);
+
+    size_t total = 0;
+    for (size_t block = 0; block < numBlocks; ++block) {
+        uint64_t subCounts = 0;
+        size_t   sub       = 0;
+
+        d_counts[2 * block] = total;
+
+        const size_t begin = block * k_WORDS_PER_BLOCK;
+        for (int ii = 0; ii < k_WORDS_PER_BLOCK; ++ii) {
+            if (ii) {
+                subCounts |= static_cast<uint64_t>(sub)
+                                           << (k_SUB_COUNT_BITS * (ii - 1));
+            }
+
+            const size_t word = begin + ii;
+            if (word < numWords) {
+                uint64_t value = bitString[word];
+                if (word + 1 == numWords && lastBits) {
+                    value &= BitMaskUtil::lt64(lastBits);
+                }
+                sub += BitUtil::numBitsSet(value);
+            }
+        }
+
+        d_counts[2 * block + 1] = subCounts;
+        total += sub;
+    }
+
+    d_bitString_p = bitString;
+    d_length      = length;
+    d_num1        = total;
+}
+
+// ACCESSORS
+size_t BitStringRankIndex::select0(size_t rank) const
+{
+    BSLS_ASSERT(rank < num0());
+
+    const size_t   block     = findBlock(rank, false);
+    const uint64_t subCounts = d_counts[2 * block + 1];
+
+    rank -= block * k_BITS_PER_BLOCK
+                                    - static_cast<size_t>(d_counts[2 * block]);
+
+    // Find the last word of the block preceded (within the block) by at most
+    // 'rank' 0 bits.
+
+    int word = 0;
+    while (word + 1 < k_WORDS_PER_BLOCK
+        && (word + 1) * k_BITS_PER_UINT64 - subCount1(subCounts, word + 1)
+                                                                    <= rank) {
+        ++word;
+    }
+    rank -= word * k_BITS_PER_UINT64 - subCount1(subCounts, word);
+
+    const size_t index = block * k_WORDS_PER_BLOCK + word;
+    return index * k_BITS_PER_UINT64 + selectInWord(~d_bitString_p[index],
+                                                    rank);
+}
+
+size_t BitStringRankIndex::select1(size_t rank) const
+{
+    BSLS_ASSERT(rank < num1());
+
+    const size_t   block     = findBlock(rank, true);
+    const uint64_t subCounts = d_counts[2 * block + 1];
+
+    rank -= static_cast<size_t>(d_counts[2 * block]);
+
+    // Find the last word of the block preceded (within the block) by at most
+    // 'rank' 1 bits.
+
+    int word = 0;
+    while (word + 1 < k_WORDS_PER_BLOCK
+        && subCount1(subCounts, word + 1) <= rank) {
+        ++word;
+    }
+    rank -= subCount1(subCounts, word);
+
+    const size_t index = block * k_WORDS_PER_BLOCK + word;
+    return index * k_BITS_PER_UINT64 + selectInWord(d_bitString_p[index],
+                                                    rank);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,370 @@
+// bdlb_bitstringrankindex.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLB_BITSTRINGRANKINDEX
+#define INCLUDED_BDLB_BITSTRINGRANKINDEX
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide constant-time rank queries on an unchanging bit string.
+//
+//@CLASSES:
+//  bdlb::BitStringRankIndex: index answering rank and select queries
+//
+//@SEE_ALSO: bdlb_bitstringutil, bdlc_bitarray
+//
+//@DESCRIPTION: This component provides a mechanism class,
+// 'bdlb::BitStringRankIndex', that indexes a bit string (a sequence of bits
+// stored in an array of 'uint64_t', as described in 'bdlb_bitstringutil') so
+// that two kinds of queries can be answered quickly:
+//
+//: o *rank*: the number of 1 (or 0) bits preceding a given index of the bit
+//:   string, answered in constant time by 'rank1' (or 'rank0').
+//:
+//: o *select*: the index of the 1 (or 0) bit having a given rank, i.e., the
+//:   index 'i' such that the bit at 'i' is 1 (or 0) and is preceded by
+//:   exactly the given number of 1 (or 0) bits, answered in time logarithmic
+//:   in the length of the bit string by 'select1' (or 'select0').
+//
+// 'bdlb::BitStringUtil::num1' answers the same question as 'rank1' in time
+// linear in the number of bits counted; an index is worthwhile when many such
+// queries are made on a long bit string that does not change.
+//
+///Indexed Bit String
+///------------------
+// A 'bdlb::BitStringRankIndex' does not own, or copy, the bit string it
+// indexes: it holds the address of the bit string, which must remain valid,
+// and must not be modified, for as long as the index is used.  After the bit
+// string is modified, the index must be rebuilt by calling 'reset' before it
+// is used again.  Bits of the bit string beyond its indexed length are never
+// counted, and may have any value.
+//
+///Space and Time Requirements
+///---------------------------
+// The index divides the bit string into blocks of 512 bits (eight 'uint64_t'
+// words), and records, for each block, the number of 1 bits preceding the
+// block and the number of 1 bits preceding each of its words within the
+// block.  This occupies two 'uint64_t' values per block, i.e., 25% of the
+// size of the indexed bit string, and is computed by 'reset' in time linear
+// in the length of the bit string.  'rank1' then reads one of these counts
+// and counts the bits of at most one word of the bit string.  'select1'
+// performs a binary search over the blocks, followed by a search over the
+// words of the block found and the bytes of the word found.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting and Finding Business Days
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a bit string indicating, for each day of a period, if
+// the day is a business day, and we are frequently asked how many business
+// days precede a given day, and which day is the 'n'th business day of the
+// period.
+//
+// First, we create a bit string of 91 days, all business days except for
+// weekends (the first day of the period is a Monday):
+//..
+//  enum { k_NUM_DAYS = 91 };
+//
+//  bsl::uint64_t businessDays[2] = { 0 };
+//  for (int day = 0; day < k_NUM_DAYS; ++day) {
+//      if (day % 7 < 5) {
+//          businessDays[day / 64] |= 1ULL << (day % 64);
+//      }
+//  }
+//..
+// Then, we index the bit string:
+//..
+//  bdlb::BitStringRankIndex index(businessDays, k_NUM_DAYS);
+//
+//  assert(65 == index.num1());
+//..
+// Now, we can count the business days preceding a day, in constant time:
+//..
+//  assert( 0 == index.rank1(0));      // before the first Monday
+//  assert( 5 == index.rank1(5));      // before the first Saturday
+//  assert( 5 == index.rank1(7));      // before the second Monday
+//  assert(10 == index.rank1(14));     // before the third Monday
+//..
+// Finally, we can find the day that is the 'n'th business day of the period,
+// counting from 0, and the 'n'th non-business day:
+//..
+//  assert( 0 == index.select1(0));    // first Monday
+//  assert( 7 == index.select1(5));    // second Monday
+//  assert(10 == index.select1(8));    // second Thursday
+//  assert( 5 == index.select0(0));    // first Saturday
+//  assert(13 == index.select0(3));    // second Sunday
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITMASKUTIL
+#include <bdlb_bitmaskutil.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDINT
+#include <bsl_cstdint.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+                         // ========================
+                         // class BitStringRankIndex
+                         // ========================
+
+class BitStringRankIndex {
+    // This mechanism class indexes an unchanging bit string to answer rank
+    // queries (the number of 1 or 0 bits preceding an index) in constant
+    // time, and select queries (the index of the 1 or 0 bit of a given rank)
+    // in logarithmic time.  The indexed bit string is held, not owned, and
+    // must neither be modified nor destroyed while the index is used (see
+    // {Indexed Bit String}).
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_BITS_PER_UINT64 = 64,  // bits used to represent a 'uint64_t'
+        k_WORDS_PER_BLOCK =  8,  // words of the bit string per block
+        k_BITS_PER_BLOCK  = k_BITS_PER_UINT64 * k_WORDS_PER_BLOCK
+    };
+
+  private:
+    // DATA
+    bsl::vector<bsl::uint64_t>  d_counts;       // for each block, the number
+                                                // of 1 bits preceding it, and
+                                                // the numbers of 1 bits
+                                                // preceding its words 1 to 7
+                                                // within it, in 9-bit fields
+
+    const bsl::uint64_t        *d_bitString_p;  // indexed bit string (held,
+                                                // not owned)
+
+    bsl::size_t                 d_length;       // number of indexed bits
+
+    bsl::size_t                 d_num1;         // number of 1 bits among the
+                                                // indexed bits
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findBlock(bsl::size_t rank, bool value) const;
+        // Return the index of the block containing the bit whose value is
+        // the specified 'value' and that is preceded by the specified 'rank'
+        // bits having the value 'value'.  The behavior is undefined unless
+        // such a bit exists among the indexed bits.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BitStringRankIndex,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BitStringRankIndex(bslma::Allocator *basicAllocator = 0);
+        // Create an index of an empty bit string.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    BitStringRankIndex(const bsl::uint64_t *bitString,
+                       bsl::size_t          length,
+                       bslma::Allocator    *basicAllocator = 0);
+        // Create an index of the specified 'length' low-order bits of the
+        // specified 'bitString'.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'bitString' has a length of at least 'length'.  Note that
+        // 'bitString' must remain valid and unmodified while this index is
+        // used.
+
+    BitStringRankIndex(const BitStringRankIndex&  original,
+                       bslma::Allocator          *basicAllocator = 0);
+        // Create an index of the same bit string as the specified 'original'
+        // index.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    ~BitStringRankIndex();
+        // Destroy this object.
+
+    // MANIPULATORS
+    BitStringRankIndex& operator=(const BitStringRankIndex& rhs);
+        // Make this object index the same bit string as the specified 'rhs'
+        // index, and return a reference providing modifiable access to this
+        // object.
+
+    void reset();
+        // Make this object an index of an empty bit string.
+
+    void reset(const bsl::uint64_t *bitString, bsl::size_t length);
+        // Make this object an index of the specified 'length' low-order bits
+        // of the specified 'bitString'.  The behavior is undefined unless
+        // 'bitString' has a length of at least 'length'.  Note that this
+        // method must be called again after the bits of 'bitString' are
+        // modified.
+
+    // ACCESSORS
+    const bsl::uint64_t *bitString() const;
+        // Return the address of the indexed bit string, or 0 if this object
+        // indexes an empty bit string and was not created or reset with the
+        // address of a bit string.
+
+    bsl::size_t length() const;
+        // Return the number of indexed bits.
+
+    bsl::size_t num0() const;
+        // Return the number of 0 bits among the indexed bits.
+
+    bsl::size_t num1() const;
+        // Return the number of 1 bits among the indexed bits.
+
+    bsl::size_t rank0(bsl::size_t index) const;
+        // Return the number of 0 bits of the indexed bit string at indices
+        // less than the specified 'index'.  The behavior is undefined unless
+        // 'index <= length()'.
+
+    bsl::size_t rank1(bsl::size_t index) const;
+        // Return the number of 1 bits of the indexed bit string at indices
+        // less than the specified 'index'.  The behavior is undefined unless
+        // 'index <= length()'.
+
+    bsl::size_t select0(bsl::size_t rank) const;
+        // Return the index of the 0 bit of the indexed bit string that is
+        // preceded by the specified 'rank' 0 bits.  The behavior is undefined
+        // unless 'rank < num0()'.
+
+    bsl::size_t select1(bsl::size_t rank) const;
+        // Return the index of the 1 bit of the indexed bit string that is
+        // preceded by the specified 'rank' 1 bits.  The behavior is undefined
+        // unless 'rank < num1()'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class BitStringRankIndex
+                         // ------------------------
+
+// ACCESSORS
+inline
+const bsl::uint64_t *BitStringRankIndex::bitString() const
+{
+    return d_bitString_p;
+}
+
+inline
+bsl::size_t BitStringRankIndex::length() const
+{
+    return d_length;
+}
+
+inline
+bsl::size_t BitStringRankIndex::num0() const
+{
+    return d_length - d_num1;
+}
+
+inline
+bsl::size_t BitStringRankIndex::num1() const
+{
+    return d_num1;
+}
+
+inline
+bsl::size_t BitStringRankIndex::rank0(bsl::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index <= d_length);
+
+    return index - rank1(index);
+}
+
+inline
+bsl::size_t BitStringRankIndex::rank1(bsl::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index <= d_length);
+
+    if (0 == index) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t word  = index / k_BITS_PER_UINT64;
+    const bsl::size_t block = word  / k_WORDS_PER_BLOCK;
+    const int         sub   = static_cast<int>(word  % k_WORDS_PER_BLOCK);
+    const int         pos   = static_cast<int>(index % k_BITS_PER_UINT64);
+
+    bsl::size_t ret = static_cast<bsl::size_t>(d_counts[2 * block]);
+    if (sub) {
+        ret += static_cast<bsl::size_t>(
+                         (d_counts[2 * block + 1] >> (9 * (sub - 1))) & 0x1ff);
+    }
+    if (pos) {
+        ret += BitUtil::numBitsSet(d_bitString_p[word] &
+                                   BitMaskUtil::lt64(pos));
+    }
+    return ret;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *BitStringRankIndex::allocator() const
+{
+    return d_counts.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
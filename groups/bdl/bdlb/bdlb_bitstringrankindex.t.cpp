@@ -0,0 +1,769 @@
+// bdlb_bitstringrankindex.t.cpp                                      -*-C++-*-
+
+#include <bdlb_bitstringrankindex.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>     // 'bsl::atoi'
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test is a mechanism indexing a bit string that it does
+// not own.  The rank and select accessors are verified against oracles that
+// examine the bit string one bit at a time, for bit strings of many lengths,
+// including lengths that are and are not multiples of the word and block
+// sizes, and for patterns of bits including runs of 0s and 1s spanning whole
+// blocks.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit BitStringRankIndex(bslma::Allocator *ba = 0);
+// [ 2] BitStringRankIndex(const U64 *bitString, St len, Alloc *ba = 0);
+// [ 2] BitStringRankIndex(const BitStringRankIndex& o, Alloc *ba = 0);
+// [ 2] ~BitStringRankIndex();
+//
+// MANIPULATORS
+// [ 2] BitStringRankIndex& operator=(const BitStringRankIndex& rhs);
+// [ 2] void reset();
+// [ 2] void reset(const U64 *bitString, St length);
+//
+// ACCESSORS
+// [ 2] const uint64_t *bitString() const;
+// [ 2] St length() const;
+// [ 3] St num0() const;
+// [ 3] St num1() const;
+// [ 3] St rank0(St index) const;
+// [ 3] St rank1(St index) const;
+// [ 4] St select0(St rank) const;
+// [ 4] St select1(St rank) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE OF RANK QUERIES
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static int verbose = 0;
+static int veryVerbose = 0;
+static int veryVeryVerbose = 0;
+
+typedef bdlb::BitStringRankIndex Obj;
+typedef bsl::uint64_t            uint64_t;
+typedef bsl::size_t              size_t;
+
+enum { k_BITS_PER_UINT64 = Obj::k_BITS_PER_UINT64,
+       k_BITS_PER_BLOCK  = Obj::k_BITS_PER_BLOCK };
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+void fillWithGarbage(uint64_t *array, size_t numWords)
+    // Fill the specified 'array' of the specified 'numWords' with
+    // pseudo-random numbers.
+{
+    static uint64_t seed = 0x0123456789abcdefULL;
+
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        uint64_t firstWord;
+
+        seed      = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+        firstWord = seed;
+        seed      = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+
+        array[ii] = (firstWord & (~0ULL << 32)) | (seed >> 32);
+    }
+}
+
+static
+void fillWithPattern(uint64_t *array, size_t numWords, int pattern)
+    // Fill the specified 'array' of the specified 'numWords' with the bits
+    // identified by the specified 'pattern': 0 - all 0s, 1 - all 1s,
+    // 2 - garbage, 3 - sparse garbage (about one bit in 16 is 1), 4 - dense
+    // garbage (about one bit in 16 is 0), 5 - runs of 0s and 1s, each
+    // spanning 1 to 3 blocks.  The behavior is undefined unless
+    // '0 <= pattern < 6'.
+{
+    switch (pattern) {
+      case 0: {
+        bsl::fill(array, array + numWords, 0ULL);
+      } break;
+      case 1: {
+        bsl::fill(array, array + numWords, ~0ULL);
+      } break;
+      case 2: {
+        fillWithGarbage(array, numWords);
+      } break;
+      case 3:
+      case 4: {
+        bsl::vector<uint64_t> tmp(4 * numWords + 1);
+
+        fillWithGarbage(tmp.data(), tmp.size());
+        for (size_t ii = 0; ii < numWords; ++ii) {
+            array[ii] = tmp[4 * ii]     & tmp[4 * ii + 1]
+                      & tmp[4 * ii + 2] & tmp[4 * ii + 3];
+            if (4 == pattern) {
+                array[ii] = ~array[ii];
+            }
+        }
+      } break;
+      case 5: {
+        uint64_t value = 0;
+        size_t   ii    = 0;
+        while (ii < numWords) {
+            uint64_t runLength;
+            fillWithGarbage(&runLength, 1);
+            runLength = 8 * (1 + runLength % 3);
+
+            for (; runLength > 0 && ii < numWords; --runLength, ++ii) {
+                array[ii] = value;
+            }
+            value = ~value;
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "unknown pattern");
+      }
+    }
+}
+
+static inline
+bool bit(const uint64_t *bitString, size_t index)
+    // Return the value of the bit at the specified 'index' in the specified
+    // 'bitString'.
+{
+    return bitString[index / k_BITS_PER_UINT64]
+                                  & (1ULL << (index % k_BITS_PER_UINT64));
+}
+
+static
+size_t selectOracle(const uint64_t *bitString,
+                    size_t          length,
+                    size_t          rank,
+                    bool            value)
+    // Return the index of the bit having the specified 'value' in the
+    // specified 'length' low-order bits of the specified 'bitString' that is
+    // preceded by the specified 'rank' bits having 'value', or 'length' if
+    // there is no such bit.
+{
+    for (size_t ii = 0; ii < length; ++ii) {
+        if (bit(bitString, ii) == value) {
+            if (0 == rank) {
+                return ii;                                            // RETURN
+            }
+            --rank;
+        }
+    }
+    return length;
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+// BDE_VERIFY pragma: -FD01  // Function declaration without contract
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting and Finding Business Days
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a bit string indicating, for each day of a period, if
+// the day is a business day, and we are frequently asked how many business
+// days precede a given day, and which day is the 'n'th business day of the
+// period.
+//
+// First, we create a bit string of 91 days, all business days except for
+// weekends (the first day of the period is a Monday):
+//..
+  enum { k_NUM_DAYS = 91 };
+
+  bsl::uint64_t businessDays[2] = { 0 };
+  for (int day = 0; day < k_NUM_DAYS; ++day) {
+      if (day % 7 < 5) {
+          businessDays[day / 64] |= 1ULL << (day % 64);
+      }
+  }
+//..
+// Then, we index the bit string:
+//..
+  bdlb::BitStringRankIndex index(businessDays, k_NUM_DAYS);
+
+  ASSERT(65 == index.num1());
+//..
+// Now, we can count the business days preceding a day, in constant time:
+//..
+  ASSERT( 0 == index.rank1(0));      // before the first Monday
+  ASSERT( 5 == index.rank1(5));      // before the first Saturday
+  ASSERT( 5 == index.rank1(7));      // before the second Monday
+  ASSERT(10 == index.rank1(14));     // before the third Monday
+//..
+// Finally, we can find the day that is the 'n'th business day of the period,
+// counting from 0, and the 'n'th non-business day:
+//..
+  ASSERT( 0 == index.select1(0));    // first Monday
+  ASSERT( 7 == index.select1(5));    // second Monday
+  ASSERT(10 == index.select1(8));    // second Thursday
+  ASSERT( 5 == index.select0(0));    // first Saturday
+  ASSERT(13 == index.select0(3));    // second Sunday
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'select0' AND 'select1'
+        //
+        // Concerns:
+        //: 1 'select1(r)' returns the index of the 1 bit preceded by 'r' 1
+        //:   bits, for every 'r < num1()', and similarly for 'select0'.
+        //:
+        //: 2 The bits beyond the indexed length do not affect the results.
+        //:
+        //: 3 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a table of lengths and each of several patterns of bits,
+        //:   fill a bit string having additional garbage bits beyond the
+        //:   length, index it, and compare the results of 'select0' and
+        //:   'select1' for every valid rank with those of an oracle, and
+        //:   verify that 'rank0' ('rank1') of the result is the argument.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-3)
+        //
+        // Testing:
+        //   St select0(St rank) const;
+        //   St select1(St rank) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'select0' AND 'select1'\n"
+                             "===============================\n";
+
+        static const size_t LENGTHS[] = { 1, 2, 63, 64, 65, 511, 512, 513,
+                                          1023, 1024, 1025, 3000, 4096,
+                                          5000 };
+        enum { k_NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        for (int li = 0; li < k_NUM_LENGTHS; ++li) {
+            const size_t LENGTH    = LENGTHS[li];
+            const size_t NUM_WORDS = LENGTH / k_BITS_PER_UINT64 + 1;
+
+            for (int pattern = 0; pattern < 6; ++pattern) {
+                bsl::vector<uint64_t> bits(NUM_WORDS);
+                fillWithPattern(bits.data(), NUM_WORDS, pattern);
+
+                const Obj X(bits.data(), LENGTH);
+
+                // Verify against the oracle by walking the bits once.
+
+                size_t num[2] = { 0, 0 };
+                for (size_t ii = 0; ii < LENGTH; ++ii) {
+                    const bool   VALUE = bit(bits.data(), ii);
+                    const size_t R     = num[VALUE]++;
+
+                    if (VALUE) {
+                        ASSERTV(LENGTH, pattern, R, ii, ii == X.select1(R));
+                    }
+                    else {
+                        ASSERTV(LENGTH, pattern, R, ii, ii == X.select0(R));
+                    }
+                }
+                ASSERTV(LENGTH, pattern, num[0] == X.num0());
+                ASSERTV(LENGTH, pattern, num[1] == X.num1());
+
+                if (num[1]) {
+                    const size_t R = num[1] - 1;
+                    ASSERTV(LENGTH, pattern,
+                            selectOracle(bits.data(), LENGTH, R, true) ==
+                                                              X.select1(R));
+                    ASSERTV(LENGTH, pattern, R == X.rank1(X.select1(R)));
+                }
+                if (num[0]) {
+                    const size_t R = num[0] - 1;
+                    ASSERTV(LENGTH, pattern,
+                            selectOracle(bits.data(), LENGTH, R, false) ==
+                                                              X.select0(R));
+                    ASSERTV(LENGTH, pattern, R == X.rank0(X.select0(R)));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            uint64_t bits[2] = { 0x5ULL, 0 };
+
+            const Obj X(bits, 70);
+
+            ASSERT_PASS(X.select1(1));
+            ASSERT_FAIL(X.select1(2));
+            ASSERT_PASS(X.select0(67));
+            ASSERT_FAIL(X.select0(68));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'num0', 'num1', 'rank0', AND 'rank1'
+        //
+        // Concerns:
+        //: 1 'rank1(i)' returns the number of 1 bits at indices less than 'i',
+        //:   for every 'i <= length()', and similarly for 'rank0'.
+        //:
+        //: 2 'num1' and 'num0' return the number of 1 and 0 bits.
+        //:
+        //: 3 The bits beyond the indexed length do not affect the results.
+        //:
+        //: 4 Resetting the index after modifying the bit string reflects the
+        //:   modification.
+        //:
+        //: 5 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a table of lengths and each of several patterns of bits,
+        //:   fill a bit string having additional garbage bits beyond the
+        //:   length, index it, and compare the results of 'rank0' and 'rank1'
+        //:   for every index with a running count.  (C-1..3)
+        //:
+        //: 2 Toggle a bit of the bit string, reset the index, and verify the
+        //:   ranks change accordingly.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-5)
+        //
+        // Testing:
+        //   St num0() const;
+        //   St num1() const;
+        //   St rank0(St index) const;
+        //   St rank1(St index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'num0', 'num1', 'rank0', AND 'rank1'\n"
+                             "=============================================\n";
+
+        static const size_t LENGTHS[] = { 0, 1, 2, 63, 64, 65, 511, 512, 513,
+                                          1023, 1024, 1025, 3000, 4096,
+                                          5000 };
+        enum { k_NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        for (int li = 0; li < k_NUM_LENGTHS; ++li) {
+            const size_t LENGTH    = LENGTHS[li];
+            const size_t NUM_WORDS = LENGTH / k_BITS_PER_UINT64 + 1;
+
+            for (int pattern = 0; pattern < 6; ++pattern) {
+                bsl::vector<uint64_t> bits(NUM_WORDS);
+                fillWithPattern(bits.data(), NUM_WORDS, pattern);
+
+                Obj mX(bits.data(), LENGTH);  const Obj& X = mX;
+
+                size_t count = 0;
+                for (size_t ii = 0; ii <= LENGTH; ++ii) {
+                    ASSERTV(LENGTH, pattern, ii, count == X.rank1(ii));
+                    ASSERTV(LENGTH, pattern, ii, ii - count == X.rank0(ii));
+
+                    if (ii < LENGTH) {
+                        count += bit(bits.data(), ii);
+                    }
+                }
+                ASSERTV(LENGTH, pattern, count == X.num1());
+                ASSERTV(LENGTH, pattern, LENGTH - count == X.num0());
+
+                if (LENGTH) {
+                    const size_t INDEX = LENGTH / 2;
+                    const bool   VALUE = bit(bits.data(), INDEX);
+
+                    bits[INDEX / k_BITS_PER_UINT64] ^=
+                                         1ULL << (INDEX % k_BITS_PER_UINT64);
+                    mX.reset(bits.data(), LENGTH);
+
+                    const size_t EXP = VALUE ? count - 1 : count + 1;
+
+                    ASSERTV(LENGTH, pattern, EXP == X.num1());
+                    ASSERTV(LENGTH, pattern, EXP == X.rank1(LENGTH));
+                    ASSERTV(LENGTH, pattern,
+                            X.rank1(INDEX) + !VALUE == X.rank1(INDEX + 1));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            uint64_t bits[2] = { 0x5ULL, 0 };
+
+            const Obj X(bits, 70);
+
+            ASSERT_SAFE_PASS(X.rank1(70));
+            ASSERT_SAFE_FAIL(X.rank1(71));
+            ASSERT_SAFE_PASS(X.rank0(70));
+            ASSERT_SAFE_FAIL(X.rank0(71));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'reset', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed index, or an index that is 'reset', indexes
+        //:   an empty bit string, and does not allocate memory.
+        //:
+        //: 2 An index created from, or reset to, a bit string refers to that
+        //:   bit string and length, and allocates its counts from the
+        //:   allocator supplied at construction (or the default allocator).
+        //:
+        //: 3 A copy, or an assigned-to object, indexes the same bit string
+        //:   and returns the same results, using its own allocator.
+        //:
+        //: 4 The class has the 'bslma::UsesBslmaAllocator' trait.
+        //
+        // Plan:
+        //: 1 Create objects with and without an allocator, and verify the
+        //:   accessors and the use of the allocators.  (C-1..2)
+        //:
+        //: 2 Copy and assign the objects, and verify their accessors.  (C-3)
+        //:
+        //: 3 Verify the trait.  (C-4)
+        //
+        // Testing:
+        //   explicit BitStringRankIndex(bslma::Allocator *ba = 0);
+        //   BitStringRankIndex(const U64 *bitString, St len, Alloc *ba = 0);
+        //   BitStringRankIndex(const BitStringRankIndex& o, Alloc *ba = 0);
+        //   ~BitStringRankIndex();
+        //   BitStringRankIndex& operator=(const BitStringRankIndex& rhs);
+        //   void reset();
+        //   void reset(const U64 *bitString, St length);
+        //   const uint64_t *bitString() const;
+        //   St length() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CREATORS, 'reset', AND BASIC ACCESSORS\n"
+                             "======================================\n";
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        bslma::TestAllocator sa("supplied", veryVeryVerbose);
+
+        enum { k_NUM_WORDS = 20 };
+
+        uint64_t bits[k_NUM_WORDS];
+        fillWithGarbage(bits, k_NUM_WORDS);
+
+        const size_t LENGTH = k_NUM_WORDS * k_BITS_PER_UINT64 - 5;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.bitString());
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.num1());
+            ASSERT(0 == X.rank1(0));
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+            mX.reset(bits, LENGTH);
+
+            ASSERT(bits   == X.bitString());
+            ASSERT(LENGTH == X.length());
+            ASSERT(0 <  defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        {
+            Obj mX(bits, LENGTH, &sa);  const Obj& X = mX;
+
+            ASSERT(bits   == X.bitString());
+            ASSERT(LENGTH == X.length());
+            ASSERT(&sa    == X.allocator());
+            ASSERT(0 <  sa.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            const Obj Y(X);
+
+            ASSERT(bits              == Y.bitString());
+            ASSERT(LENGTH            == Y.length());
+            ASSERT(X.num1()          == Y.num1());
+            ASSERT(X.rank1(LENGTH/3) == Y.rank1(LENGTH/3));
+            ASSERT(&defaultAllocator == Y.allocator());
+
+            Obj mZ(&sa);  const Obj& Z = mZ;
+
+            mZ = Y;
+
+            ASSERT(bits              == Z.bitString());
+            ASSERT(LENGTH            == Z.length());
+            ASSERT(X.num1()          == Z.num1());
+            ASSERT(X.select1(7)      == Z.select1(7));
+            ASSERT(&sa               == Z.allocator());
+
+            mX.reset();
+
+            ASSERT(0 == X.bitString());
+            ASSERT(0 == X.length());
+            ASSERT(0 == X.num0());
+            ASSERT(0 == X.num1());
+            ASSERT(0 == X.rank0(0));
+
+            mX.reset(bits, 0);
+
+            ASSERT(bits == X.bitString());
+            ASSERT(0    == X.length());
+            ASSERT(0    == X.rank1(0));
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Index a small bit string and perform a few queries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        uint64_t bits[3] = { 0xF0ULL, 0, 0x1ULL };
+
+        const Obj X(bits, 3 * k_BITS_PER_UINT64);
+
+        ASSERT(  5 == X.num1());
+        ASSERT(  0 == X.rank1(4));
+        ASSERT(  2 == X.rank1(6));
+        ASSERT(  4 == X.rank1(128));
+        ASSERT(  5 == X.rank1(129));
+        ASSERT(  4 == X.rank0(4));
+        ASSERT(  4 == X.select1(0));
+        ASSERT(128 == X.select1(4));
+        ASSERT(  8 == X.select0(4));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF RANK QUERIES
+        //
+        // Concerns:
+        //: 1 'rank1' on a long bit string is much faster than counting the
+        //:   preceding bits, and 'select1' is fast.
+        //
+        // Plan:
+        //: 1 Index a bit string of 2^27 bits, and time 'rank1' and 'select1'
+        //:   at pseudo-random positions, and counting the preceding bits one
+        //:   word at a time at fewer positions, and report the average time
+        //:   per query using 'bsls::Stopwatch'.
+        //
+        // Testing:
+        //   PERFORMANCE OF RANK QUERIES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE OF RANK QUERIES\n"
+                             "===========================\n";
+
+        enum { k_NUM_WORDS   = 1 << 21,
+               k_NUM_QUERIES = 1 << 20,
+               k_NUM_SCANS   = 1 << 6 };
+
+        const size_t LENGTH = static_cast<size_t>(k_NUM_WORDS)
+                                                          * k_BITS_PER_UINT64;
+
+        bsl::vector<uint64_t> bits(k_NUM_WORDS);
+        fillWithGarbage(bits.data(), k_NUM_WORDS);
+
+        bsls::Stopwatch sw;
+
+        sw.start(true);
+        const Obj X(bits.data(), LENGTH);
+        sw.stop();
+        const double BUILD_TIME = sw.accumulatedUserTime();
+
+        bsl::vector<uint64_t> positions(k_NUM_QUERIES);
+        fillWithGarbage(positions.data(), k_NUM_QUERIES);
+
+        size_t sum = 0;
+
+        sw.reset();
+        sw.start(true);
+        for (int ii = 0; ii < k_NUM_QUERIES; ++ii) {
+            sum += X.rank1(static_cast<size_t>(positions[ii] % LENGTH));
+        }
+        sw.stop();
+        const double RANK_TIME = sw.accumulatedUserTime() / k_NUM_QUERIES;
+
+        sw.reset();
+        sw.start(true);
+        for (int ii = 0; ii < k_NUM_QUERIES; ++ii) {
+            sum += X.select1(static_cast<size_t>(positions[ii] % X.num1()));
+        }
+        sw.stop();
+        const double SELECT_TIME = sw.accumulatedUserTime() / k_NUM_QUERIES;
+
+        sw.reset();
+        sw.start(true);
+        for (int ii = 0; ii < k_NUM_SCANS; ++ii) {
+            const size_t END = static_cast<size_t>(positions[ii]
+                                                               % k_NUM_WORDS);
+            for (size_t jj = 0; jj < END; ++jj) {
+                sum += bdlb::BitUtil::numBitsSet(bits[jj]);
+            }
+        }
+        sw.stop();
+        const double SCAN_TIME = sw.accumulatedUserTime() / k_NUM_SCANS;
+
+        cout << "build: " << BUILD_TIME
+             << "  rank1: " << RANK_TIME
+             << "  select1: " << SELECT_TIME
+             << "  scan: " << SCAN_TIME
+             << "  (" << sum << ")\n";
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,6 +12,8 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 
 #include <bsls_alignmentfromtype.h>
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -22,6 +24,16 @@ BSLS_IDENT_RCSID(bdlb_bitstringutil_cpp,"$Id$ $CSID$")
 
 #include <bsl_c_limits.h>    // 'CHAR_BIT'
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+#define BDLB_BITSTRINGUTIL_X86_KERNELS 1
+#endif
+
+#ifdef BDLB_BITSTRINGUTIL_X86_KERNELS
+#include <immintrin.h>
+#endif
+
 using namespace BloombergLP;
 using bsl::size_t;
 using bsl::uint64_t;
@@ -1028,6 +1040,456 @@ bsl::ostream& newlineAndIndent(bsl::ostream& stream,
     return stream;
 }
 
+namespace {
+
+                        // ===================
+                        // struct WordKernels
+                        // ===================
+
+// The bulk operations of 'BitStringUtil' spend most of their time in loops
+// over whole words of a bit string (counting their bits, applying a boolean
+// operation to them, or scanning for the first word that is not all 0s or all
+// 1s).  These loops are implemented by the "kernels" below, which come in
+// several versions: a portable version, a version using the 'POPCNT'
+// instruction (bit counting only), and a version processing four words at a
+// time with AVX2 instructions.  The best version supported by the executing
+// CPU is selected on first use and recorded in 'g_wordKernels_p'.  The
+// 'POPCNT' and AVX2 versions are compiled (using the 'target' attribute)
+// only by GCC and Clang targeting x86-64, so that the component as a whole
+// does not require these instructions.
+
+typedef void BooleanKernel(uint64_t       *dstWords,
+                           const uint64_t *srcWords,
+                           size_t          numWords);
+    // Apply a boolean operation to each element of the specified 'dstWords'
+    // and the element of the specified 'srcWords' at the same index, and
+    // assign the result to that element of 'dstWords', for the specified
+    // 'numWords' elements.  The behavior is undefined unless 'dstWords' and
+    // 'srcWords' are either the same array or do not overlap.
+
+struct WordKernels {
+    // This 'struct' holds pointers to one version of each kernel.  In each
+    // kernel, 'words' (or 'dstWords' and 'srcWords') is an array of
+    // 'numWords' words.
+
+    typedef bdlb::BitStringUtil_Dispatch::Kernels Kernels;
+
+    // DATA
+    Kernels   d_kernels;   // version of the kernels held by this object
+
+    size_t  (*d_numBitsSet)(const uint64_t *words, size_t numWords);
+        // Return the number of bits set in 'words'.
+
+    size_t  (*d_findFirstNotEqual)(const uint64_t *words,
+                                   size_t          numWords,
+                                   uint64_t        value);
+        // Return the index of the first element of 'words' not equal to
+        // 'value', or 'numWords' if there is no such element.
+
+    size_t  (*d_findLastNotEqual)(const uint64_t *words,
+                                  size_t          numWords,
+                                  uint64_t        value);
+        // Return the index of the last element of 'words' not equal to
+        // 'value', or 'numWords' if there is no such element.
+
+    BooleanKernel *d_andEqual;
+    BooleanKernel *d_minusEqual;
+    BooleanKernel *d_orEqual;
+    BooleanKernel *d_xorEqual;
+};
+
+                        // portable kernels
+
+static
+size_t portableNumBitsSet(const uint64_t *words, size_t numWords)
+{
+    size_t result = 0;
+    size_t ii     = 0;
+    for (; ii + 4 <= numWords; ii += 4) {
+        result += BitUtil::numBitsSet(words[ii]);
+        result += BitUtil::numBitsSet(words[ii + 1]);
+        result += BitUtil::numBitsSet(words[ii + 2]);
+        result += BitUtil::numBitsSet(words[ii + 3]);
+    }
+    for (; ii < numWords; ++ii) {
+        result += BitUtil::numBitsSet(words[ii]);
+    }
+    return result;
+}
+
+static
+size_t portableFindFirstNotEqual(const uint64_t *words,
+                                 size_t          numWords,
+                                 uint64_t        value)
+{
+    size_t ii = 0;
+    while (ii < numWords && value == words[ii]) {
+        ++ii;
+    }
+    return ii;
+}
+
+static
+size_t portableFindLastNotEqual(const uint64_t *words,
+                                size_t          numWords,
+                                uint64_t        value)
+{
+    for (size_t ii = numWords; ii > 0; --ii) {
+        if (value != words[ii - 1]) {
+            return ii - 1;                                            // RETURN
+        }
+    }
+    return numWords;
+}
+
+static
+void portableAndEqual(uint64_t       *dstWords,
+                      const uint64_t *srcWords,
+                      size_t          numWords)
+{
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        dstWords[ii] &= srcWords[ii];
+    }
+}
+
+static
+void portableMinusEqual(uint64_t       *dstWords,
+                        const uint64_t *srcWords,
+                        size_t          numWords)
+{
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        dstWords[ii] &= ~srcWords[ii];
+    }
+}
+
+static
+void portableOrEqual(uint64_t       *dstWords,
+                     const uint64_t *srcWords,
+                     size_t          numWords)
+{
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        dstWords[ii] |= srcWords[ii];
+    }
+}
+
+static
+void portableXorEqual(uint64_t       *dstWords,
+                      const uint64_t *srcWords,
+                      size_t          numWords)
+{
+    for (size_t ii = 0; ii < numWords; ++ii) {
+        dstWords[ii] ^= srcWords[ii];
+    }
+}
+
+static const WordKernels k_PORTABLE_KERNELS = {
+    bdlb::BitStringUtil_Dispatch::e_PORTABLE,
+    &portableNumBitsSet,
+    &portableFindFirstNotEqual,
+    &portableFindLastNotEqual,
+    &portableAndEqual,
+    &portableMinusEqual,
+    &portableOrEqual,
+    &portableXorEqual
+};
+
+#ifdef BDLB_BITSTRINGUTIL_X86_KERNELS
+
+                        // 'POPCNT' kernels
+
+__attribute__((target("popcnt")))
+static
+size_t popcntNumBitsSet(const uint64_t *words, size_t numWords)
+{
+    // Use four accumulators to break the dependency between consecutive
+    // additions.
+
+    size_t result0 = 0, result1 = 0, result2 = 0, result3 = 0;
+    size_t ii      = 0;
+    for (; ii + 4 <= numWords; ii += 4) {
+        result0 += __builtin_popcountll(words[ii]);
+        result1 += __builtin_popcountll(words[ii + 1]);
+        result2 += __builtin_popcountll(words[ii + 2]);
+        result3 += __builtin_popcountll(words[ii + 3]);
+    }
+    for (; ii < numWords; ++ii) {
+        result0 += __builtin_popcountll(words[ii]);
+    }
+    return result0 + result1 + result2 + result3;
+}
+
+static const WordKernels k_POPCNT_KERNELS = {
+    bdlb::BitStringUtil_Dispatch::e_POPCNT,
+    &popcntNumBitsSet,
+    &portableFindFirstNotEqual,
+    &portableFindLastNotEqual,
+    &portableAndEqual,
+    &portableMinusEqual,
+    &portableOrEqual,
+    &portableXorEqual
+};
+
+                        // AVX2 kernels
+
+__attribute__((target("avx2,popcnt")))
+static
+size_t avx2NumBitsSet(const uint64_t *words, size_t numWords)
+{
+    // Count the bits of each nibble of four words at a time by looking up the
+    // nibble in a 16-entry table (using 'vpshufb'), then sum the counts of
+    // the bytes of each word (using 'vpsadbw').
+
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibbles = _mm256_set1_epi8(0x0f);
+    const __m256i zero       = _mm256_setzero_si256();
+
+    __m256i sums = zero;
+    size_t  ii   = 0;
+    for (; ii + 4 <= numWords; ii += 4) {
+        const __m256i v  = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(words + ii));
+        const __m256i lo = _mm256_and_si256(v, lowNibbles);
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4),
+                                            lowNibbles);
+        const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(table, lo),
+                                               _mm256_shuffle_epi8(table, hi));
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(counts, zero));
+    }
+
+    size_t result = static_cast<size_t>(_mm256_extract_epi64(sums, 0))
+                  + static_cast<size_t>(_mm256_extract_epi64(sums, 1))
+                  + static_cast<size_t>(_mm256_extract_epi64(sums, 2))
+                  + static_cast<size_t>(_mm256_extract_epi64(sums, 3));
+    for (; ii < numWords; ++ii) {
+        result += __builtin_popcountll(words[ii]);
+    }
+    return result;
+}
+
+__attribute__((target("avx2")))
+static
+size_t avx2FindFirstNotEqual(const uint64_t *words,
+                             size_t          numWords,
+                             uint64_t        value)
+{
+    const __m256i pattern = _mm256_set1_epi64x(static_cast<long long>(value));
+
+    size_t ii = 0;
+    for (; ii + 4 <= numWords; ii += 4) {
+        const __m256i v = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(words + ii));
+        if (-1 != _mm256_movemask_epi8(_mm256_cmpeq_epi64(v, pattern))) {
+            break;
+        }
+    }
+    return ii + portableFindFirstNotEqual(words + ii, numWords - ii, value);
+}
+
+__attribute__((target("avx2")))
+static
+size_t avx2FindLastNotEqual(const uint64_t *words,
+                            size_t          numWords,
+                            uint64_t        value)
+{
+    const __m256i pattern = _mm256_set1_epi64x(static_cast<long long>(value));
+
+    size_t ii = numWords;
+    for (; ii >= 4; ii -= 4) {
+        const __m256i v = _mm256_loadu_si256(
+                            reinterpret_cast<const __m256i *>(words + ii - 4));
+        if (-1 != _mm256_movemask_epi8(_mm256_cmpeq_epi64(v, pattern))) {
+            break;
+        }
+    }
+
+    // Words at and after 'ii' are all equal to 'value'.
+
+    const size_t result = portableFindLastNotEqual(words, ii, value);
+    return result == ii ? numWords : result;
+}
+
+#define BDLB_BITSTRINGUTIL_AVX2_BOOLEAN_KERNEL(NAME, VECTOR_OP, WORD_OP)      \
+__attribute__((target("avx2")))                                               \
+static                                                                        \
+void NAME(uint64_t *dstWords, const uint64_t *srcWords, size_t numWords)      \
+{                                                                             \
+    size_t ii = 0;                                                            \
+    for (; ii + 4 <= numWords; ii += 4) {                                     \
+        __m256i *dst = reinterpret_cast<__m256i *>(dstWords + ii);            \
+        const __m256i d = _mm256_loadu_si256(dst);                            \
+        const __m256i s = _mm256_loadu_si256(                                 \
+                           reinterpret_cast<const __m256i *>(srcWords + ii)); \
+        _mm256_storeu_si256(dst, VECTOR_OP);                                  \
+    }                                                                         \
+    for (; ii < numWords; ++ii) {                                             \
+        dstWords[ii] WORD_OP;                                                 \
+    }                                                                         \
+}
+
+BDLB_BITSTRINGUTIL_AVX2_BOOLEAN_KERNEL(avx2AndEqual,
+                                       _mm256_and_si256(d, s),
+                                       &= srcWords[ii])
+BDLB_BITSTRINGUTIL_AVX2_BOOLEAN_KERNEL(avx2MinusEqual,
+                                       _mm256_andnot_si256(s, d),
+                                       &= ~srcWords[ii])
+BDLB_BITSTRINGUTIL_AVX2_BOOLEAN_KERNEL(avx2OrEqual,
+                                       _mm256_or_si256(d, s),
+                                       |= srcWords[ii])
+BDLB_BITSTRINGUTIL_AVX2_BOOLEAN_KERNEL(avx2XorEqual,
+                                       _mm256_xor_si256(d, s),
+                                       ^= srcWords[ii])
+
+#undef BDLB_BITSTRINGUTIL_AVX2_BOOLEAN_KERNEL
+
+static const WordKernels k_AVX2_KERNELS = {
+    bdlb::BitStringUtil_Dispatch::e_AVX2,
+    &avx2NumBitsSet,
+    &avx2FindFirstNotEqual,
+    &avx2FindLastNotEqual,
+    &avx2AndEqual,
+    &avx2MinusEqual,
+    &avx2OrEqual,
+    &avx2XorEqual
+};
+
+#endif  // BDLB_BITSTRINGUTIL_X86_KERNELS
+
+static
+const WordKernels *kernelsFor(bdlb::BitStringUtil_Dispatch::Kernels kernels)
+    // Return the address of the kernels of the specified 'kernels' version.
+    // The behavior is undefined unless 'kernels' is supported by this build.
+{
+    switch (kernels) {
+#ifdef BDLB_BITSTRINGUTIL_X86_KERNELS
+      case bdlb::BitStringUtil_Dispatch::e_AVX2: {
+        return &k_AVX2_KERNELS;                                       // RETURN
+      }
+      case bdlb::BitStringUtil_Dispatch::e_POPCNT: {
+        return &k_POPCNT_KERNELS;                                     // RETURN
+      }
+#endif
+      default: {
+        return &k_PORTABLE_KERNELS;                                   // RETURN
+      }
+    }
+}
+
+bsls::AtomicOperations::AtomicTypes::Pointer g_wordKernels_p = { 0 };
+    // address of the selected kernels, or 0 if they have not been selected
+
+static inline
+const WordKernels& wordKernels()
+    // Return a reference providing non-modifiable access to the selected
+    // kernels, selecting the best kernels supported by the executing CPU if
+    // none have been selected.  Note that concurrent first calls may each
+    // select the kernels, but they select the same kernels.
+{
+    const void *kernels =
+                     bsls::AtomicOperations::getPtrAcquire(&g_wordKernels_p);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == kernels)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        kernels = kernelsFor(bdlb::BitStringUtil_Dispatch::bestSupported());
+        bsls::AtomicOperations::setPtrRelease(&g_wordKernels_p,
+                                              const_cast<void *>(kernels));
+    }
+    return *static_cast<const WordKernels *>(kernels);
+}
+
+// Kernels are invoked only on runs of at least 'k_MIN_KERNEL_WORDS' words;
+// shorter runs, which are typical of small bit strings, are handled inline to
+// avoid the cost of an indirect call.
+
+enum { k_MIN_KERNEL_WORDS = 8 };
+
+static inline
+size_t numBitsSetInWords(const uint64_t *words, size_t numWords)
+    // Return the number of bits set in the specified array of 'numWords'
+    // 'words'.
+{
+    if (numWords < k_MIN_KERNEL_WORDS) {
+        size_t result = 0;
+        for (size_t ii = 0; ii < numWords; ++ii) {
+            result += BitUtil::numBitsSet(words[ii]);
+        }
+        return result;                                                // RETURN
+    }
+    return wordKernels().d_numBitsSet(words, numWords);
+}
+
+static inline
+size_t findFirstWordNotEqual(const uint64_t *words,
+                             size_t          numWords,
+                             uint64_t        value)
+    // Return the index of the first element of the specified array of
+    // 'numWords' 'words' that is not equal to the specified 'value', or
+    // 'numWords' if there is no such element.
+{
+    if (numWords < k_MIN_KERNEL_WORDS) {
+        return portableFindFirstNotEqual(words, numWords, value);     // RETURN
+    }
+    return wordKernels().d_findFirstNotEqual(words, numWords, value);
+}
+
+static inline
+size_t findLastWordNotEqual(const uint64_t *words,
+                            size_t          numWords,
+                            uint64_t        value)
+    // Return the index of the last element of the specified array of
+    // 'numWords' 'words' that is not equal to the specified 'value', or
+    // 'numWords' if there is no such element.
+{
+    if (numWords < k_MIN_KERNEL_WORDS) {
+        return portableFindLastNotEqual(words, numWords, value);      // RETURN
+    }
+    return wordKernels().d_findLastNotEqual(words, numWords, value);
+}
+
+static inline
+void applyToWholeWords(BooleanKernel * WordKernels::*kernel,
+                       uint64_t                     *dstBitString,
+                       size_t                       *dstIndex,
+                       const uint64_t               *srcBitString,
+                       size_t                       *srcIndex,
+                       size_t                       *numBits)
+    // Apply the specified 'kernel' of the selected kernels to the whole words
+    // of the specified 'dstBitString' and 'srcBitString' holding the bits in
+    // the ranges of the specified '*numBits' bits beginning at the specified
+    // '*dstIndex' and '*srcIndex', respectively, and advance '*dstIndex' and
+    // '*srcIndex' (and reduce '*numBits') past the processed bits, if
+    // '*dstIndex' and '*srcIndex' are multiples of 'k_BITS_PER_UINT64', the
+    // ranges span at least 'k_MIN_KERNEL_WORDS' words, and the words holding
+    // the two ranges are either the same words or do not overlap.  Otherwise,
+    // this function has no effect.  Note that, in either case, the remaining
+    // bits must then be processed by the caller.
+{
+    if ((*dstIndex | *srcIndex) % k_BITS_PER_UINT64
+     || *numBits < k_MIN_KERNEL_WORDS * k_BITS_PER_UINT64) {
+        return;                                                       // RETURN
+    }
+
+    uint64_t       *dst      = dstBitString + *dstIndex / k_BITS_PER_UINT64;
+    const uint64_t *src      = srcBitString + *srcIndex / k_BITS_PER_UINT64;
+    const size_t    numWords = *numBits / k_BITS_PER_UINT64;
+    const size_t    span     = (*numBits + k_BITS_PER_UINT64 - 1)
+                                                         / k_BITS_PER_UINT64;
+
+    if (dst != src && dst < src + span && src < dst + span) {
+        return;                                                       // RETURN
+    }
+
+    (wordKernels().*kernel)(dst, src, numWords);
+
+    *dstIndex += numWords * k_BITS_PER_UINT64;
+    *srcIndex += numWords * k_BITS_PER_UINT64;
+    *numBits  -= numWords * k_BITS_PER_UINT64;
+}
+
+}  // close unnamed namespace
+
 namespace BloombergLP {
 namespace bdlb {
 
@@ -1221,6 +1683,13 @@ void BitStringUtil::andEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
+    applyToWholeWords(&WordKernels::d_andEqual,
+                      dstBitString,
+                      &dstIndex,
+                      srcBitString,
+                      &srcIndex,
+                      &numBits);
+
     Mover<Imp::andEqBits, Imp::andEqWord>::move(dstBitString,
                                                 dstIndex,
                                                 srcBitString,
@@ -1237,6 +1706,13 @@ void BitStringUtil::minusEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
+    applyToWholeWords(&WordKernels::d_minusEqual,
+                      dstBitString,
+                      &dstIndex,
+                      srcBitString,
+                      &srcIndex,
+                      &numBits);
+
     Mover<Imp::minusEqBits, Imp::minusEqWord>::move(dstBitString,
                                                     dstIndex,
                                                     srcBitString,
@@ -1253,6 +1729,13 @@ void BitStringUtil::orEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
+    applyToWholeWords(&WordKernels::d_orEqual,
+                      dstBitString,
+                      &dstIndex,
+                      srcBitString,
+                      &srcIndex,
+                      &numBits);
+
     Mover<Imp::orEqBits, Imp::orEqWord>::move(dstBitString,
                                               dstIndex,
                                               srcBitString,
@@ -1269,6 +1752,13 @@ void BitStringUtil::xorEqual(uint64_t       *dstBitString,
     BSLS_ASSERT(dstBitString);
     BSLS_ASSERT(srcBitString);
 
+    applyToWholeWords(&WordKernels::d_xorEqual,
+                      dstBitString,
+                      &dstIndex,
+                      srcBitString,
+                      &srcIndex,
+                      &numBits);
+
     Mover<Imp::xorEqBits, Imp::xorEqWord>::move(dstBitString,
                                                 dstIndex,
                                                 srcBitString,
@@ -1771,16 +2261,15 @@ size_t BitStringUtil::find0AtMaxIndex(const uint64_t *bitString, size_t length)
 
     uint64_t     value    = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; true; value = ~bitString[--ii]) {
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+    if (value) {
+        return lastWord * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
                                                                       // RETURN
-        }
-
-        if (0 == ii) {
-            return k_INVALID_INDEX;                                   // RETURN
-        }
     }
+
+    const size_t ii = findLastWordNotEqual(bitString, lastWord, ~0ULL);
+    return ii < lastWord
+           ? ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(~bitString[ii])
+           : k_INVALID_INDEX;
 }
 
 size_t BitStringUtil::find0AtMaxIndex(const uint64_t *bitString,
@@ -1800,11 +2289,26 @@ size_t BitStringUtil::find0AtMaxIndex(const uint64_t *bitString,
 
     uint64_t     value     = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; ii > beginWord; value = ~bitString[--ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+            return lastWord * k_BITS_PER_UINT64
+                                           + Imp::find1AtMaxIndexRaw(value);
+                                                                      // RETURN
+        }
+
+        const size_t numWords = lastWord - beginWord - 1;
+        const size_t ii       = findLastWordNotEqual(bitString + beginWord + 1,
+                                                     numWords,
+                                                     ~0ULL);
+        if (ii < numWords) {
+            const size_t word = beginWord + 1 + ii;
+
+            return word * k_BITS_PER_UINT64
+                             + Imp::find1AtMaxIndexRaw(~bitString[word]);
                                                                       // RETURN
         }
+
+        value = ~bitString[beginWord];
     }
 
     const int beginIdx = u32(begin) % k_BITS_PER_UINT64;
@@ -1824,19 +2328,16 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
-    uint64_t     value;
+    const size_t ii       = findFirstWordNotEqual(bitString, lastWord, ~0ULL);
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
-        value = ~bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+    if (ii < lastWord) {
+        return ii * k_BITS_PER_UINT64
+                                + Imp::find1AtMinIndexRaw(~bitString[ii]);
                                                                       // RETURN
-        }
     }
 
-    const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
-
-    value = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    const int      endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
+    const uint64_t value  = ~bitString[lastWord] & BitMaskUtil::lt64(endPos);
     return value
            ? lastWord * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value)
            : k_INVALID_INDEX;
@@ -1860,11 +2361,27 @@ size_t BitStringUtil::find0AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = ~bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = ~bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+            return beginWord * k_BITS_PER_UINT64
+                                           + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
+
+        const size_t numWords = lastWord - beginWord - 1;
+        const size_t ii       = findFirstWordNotEqual(
+                                                    bitString + beginWord + 1,
+                                                    numWords,
+                                                    ~0ULL);
+        if (ii < numWords) {
+            const size_t word = beginWord + 1 + ii;
+
+            return word * k_BITS_PER_UINT64
+                             + Imp::find1AtMinIndexRaw(~bitString[word]);
+                                                                      // RETURN
+        }
+
+        value = ~bitString[lastWord];
     }
 
     value &= BitMaskUtil::lt64(endPos);
@@ -1886,16 +2403,15 @@ size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString, size_t length)
 
     uint64_t     value    = bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; true; value = bitString[--ii]) {
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+    if (value) {
+        return lastWord * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
                                                                       // RETURN
-        }
-
-        if (0 == ii) {
-            return k_INVALID_INDEX;                                   // RETURN
-        }
     }
+
+    const size_t ii = findLastWordNotEqual(bitString, lastWord, 0);
+    return ii < lastWord
+           ? ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(bitString[ii])
+           : k_INVALID_INDEX;
 }
 
 size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString,
@@ -1914,13 +2430,28 @@ size_t BitStringUtil::find1AtMaxIndex(const uint64_t *bitString,
     const size_t beginWord =       begin  / k_BITS_PER_UINT64;
     const int    beginIdx  =   u32(begin) % k_BITS_PER_UINT64;
 
-    uint64_t  value     = bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    uint64_t     value     = bitString[lastWord] & BitMaskUtil::lt64(endPos);
 
-    for (size_t ii = lastWord; ii > beginWord; value = bitString[--ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMaxIndexRaw(value);
+            return lastWord * k_BITS_PER_UINT64
+                                           + Imp::find1AtMaxIndexRaw(value);
                                                                       // RETURN
         }
+
+        const size_t numWords = lastWord - beginWord - 1;
+        const size_t ii       = findLastWordNotEqual(bitString + beginWord + 1,
+                                                     numWords,
+                                                     0);
+        if (ii < numWords) {
+            const size_t word = beginWord + 1 + ii;
+
+            return word * k_BITS_PER_UINT64
+                             + Imp::find1AtMaxIndexRaw(bitString[word]);
+                                                                      // RETURN
+        }
+
+        value = bitString[beginWord];
     }
 
     value &= ge64Raw(beginIdx);
@@ -1938,19 +2469,16 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString, size_t length)
     }
 
     const size_t lastWord = (length - 1) / k_BITS_PER_UINT64;
-    uint64_t     value;
+    const size_t ii       = findFirstWordNotEqual(bitString, lastWord, 0);
 
-    for (size_t ii = 0; ii < lastWord; ++ii) {
-        value = bitString[ii];
-        if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+    if (ii < lastWord) {
+        return ii * k_BITS_PER_UINT64
+                                + Imp::find1AtMinIndexRaw(bitString[ii]);
                                                                       // RETURN
-        }
     }
 
-    const int endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
-
-    value = bitString[lastWord] & BitMaskUtil::lt64(endPos);
+    const int      endPos = u32(length - 1) % k_BITS_PER_UINT64 + 1;
+    const uint64_t value  = bitString[lastWord] & BitMaskUtil::lt64(endPos);
     return value
            ? lastWord * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value)
            : k_INVALID_INDEX;
@@ -1974,11 +2502,27 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString,
 
     uint64_t     value     = bitString[beginWord] & ge64Raw(beginIdx);
 
-    for (size_t ii = beginWord; ii < lastWord; value = bitString[++ii]) {
+    if (beginWord < lastWord) {
         if (value) {
-            return ii * k_BITS_PER_UINT64 + Imp::find1AtMinIndexRaw(value);
+            return beginWord * k_BITS_PER_UINT64
+                                           + Imp::find1AtMinIndexRaw(value);
                                                                       // RETURN
         }
+
+        const size_t numWords = lastWord - beginWord - 1;
+        const size_t ii       = findFirstWordNotEqual(
+                                                    bitString + beginWord + 1,
+                                                    numWords,
+                                                    0);
+        if (ii < numWords) {
+            const size_t word = beginWord + 1 + ii;
+
+            return word * k_BITS_PER_UINT64
+                             + Imp::find1AtMinIndexRaw(bitString[word]);
+                                                                      // RETURN
+        }
+
+        value = bitString[lastWord];
     }
 
     value &= BitMaskUtil::lt64(endPos);
@@ -2007,11 +2551,13 @@ bool BitStringUtil::isAny0(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    for (; numBits >= k_BITS_PER_UINT64; numBits -= k_BITS_PER_UINT64) {
-        if (~bitString[++idx]) {
-            return true;                                              // RETURN
-        }
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+    if (findFirstWordNotEqual(bitString + idx + 1, numWords, ~0ULL)
+                                                                < numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT_SAFE(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2041,12 +2587,12 @@ bool BitStringUtil::isAny1(const uint64_t *bitString,
     }
     numBits -= numOfBits;
 
-    while (numBits >= k_BITS_PER_UINT64) {
-        if (bitString[++idx]) {
-            return true;                                              // RETURN
-        }
-        numBits -= k_BITS_PER_UINT64;
+    const size_t numWords = numBits / k_BITS_PER_UINT64;
+    if (findFirstWordNotEqual(bitString + idx + 1, numWords, 0) < numWords) {
+        return true;                                                  // RETURN
     }
+    idx     += numWords;
+    numBits -= numWords * k_BITS_PER_UINT64;
     BSLS_ASSERT_SAFE(numBits < k_BITS_PER_UINT64);
 
     if (0 == numBits) {
@@ -2090,50 +2636,9 @@ size_t BitStringUtil::num1(const uint64_t *bitString,
     size_t ret = BitUtil::numBitsSet(bitString[lastWord] &
                                                     BitMaskUtil::lt64(endPos));
 
-    // We now want to visit all the words not including the highest-order and
-    // lowest-order words in 'bitString'.  We set 'array' such that
-    // '&array[0] == &bitString[1]'.  The first word we will visit in this
-    // array (as we predecrement 'ii') will be
-    // 'array[lastWord - 2] == bitString[lastWord - 1]'.  The last element we
-    // will visit will be 'array[0] == bitString[1]'.  The initial value of
-    // 'ii' below will be the number of words between the first and last words
-    // that must be traversed, not including the first word or the last word.
+    // Count the full words between the first and last words.
 
-    BSLS_ASSERT_SAFE(lastWord >= 1);    // therefore 'ii' below is >= 0 and can
-                                        // be represented as a 'size_t'
-
-    const uint64_t *array = bitString + 1;
-    size_t          ii    = lastWord
-                                     - 1  // word before last word
-                                     - 1  // adjust from 'bitString' to 'array'
-                                     + 1; // preparation for pre-decrement
-
-    while (ii >= 8) {
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-        ret +=       BitUtil::numBitsSet(array[--ii]);
-    }
-
-    BSLS_ASSERT_SAFE(ii < 8);
-
-    switch (ii) {
-      case 7: ret += BitUtil::numBitsSet(array[--ii]);
-      case 6: ret += BitUtil::numBitsSet(array[--ii]);
-      case 5: ret += BitUtil::numBitsSet(array[--ii]);
-      case 4: ret += BitUtil::numBitsSet(array[--ii]);
-      case 3: ret += BitUtil::numBitsSet(array[--ii]);
-      case 2: ret += BitUtil::numBitsSet(array[--ii]);
-      case 1: ret += BitUtil::numBitsSet(array[--ii]);
-      default: ;
-    }
-
-    BSLS_ASSERT_SAFE(0 == ii);
+    ret += numBitsSetInWords(bitString + 1, lastWord - 1);
 
     // And we are now ready to look at the lowest-order word.
 
@@ -2238,6 +2743,41 @@ bsl::ostream& BitStringUtil::print(bsl::ostream&   stream,
     return stream;
 }
 
+                        // -----------------------------
+                        // struct BitStringUtil_Dispatch
+                        // -----------------------------
+
+// CLASS METHODS
+BitStringUtil_Dispatch::Kernels BitStringUtil_Dispatch::bestSupported()
+{
+#ifdef BDLB_BITSTRINGUTIL_X86_KERNELS
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return e_AVX2;                                                // RETURN
+    }
+    if (__builtin_cpu_supports("popcnt")) {
+        return e_POPCNT;                                              // RETURN
+    }
+#endif
+
+    return e_PORTABLE;
+}
+
+void BitStringUtil_Dispatch::select(Kernels kernels)
+{
+    BSLS_ASSERT(kernels <= bestSupported());
+
+    bsls::AtomicOperations::setPtrRelease(
+                              &g_wordKernels_p,
+                              const_cast<WordKernels *>(kernelsFor(kernels)));
+}
+
+BitStringUtil_Dispatch::Kernels BitStringUtil_Dispatch::selected()
+{
+    return wordKernels().d_kernels;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -13,7 +13,7 @@ BSLS_IDENT("$Id: $")
 // bdlb::BitStringUtil: namespace for common bit-manipulation procedures
 //
 //@SEE_ALSO: bdlb_bitutil, bdlb_bitmaskutil, bdlb_bitstringimputil,
-//           bdlc_bitarray
+//           bdlb_bitstringrankindex, bdlc_bitarray
 //
 //@DESCRIPTION: This component provides a utility 'struct',
 // 'bdlb::BitStringUtil', that serves as a namespace for a collection of
@@ -220,6 +220,20 @@ BSLS_IDENT("$Id: $")
 //
 //..
 //
+///Performance
+///-----------
+// The operations that traverse many whole words of a bit string -- the
+// bitwise-logical operations (when both ranges begin on a word boundary), the
+// find operations, 'isAny0', 'isAny1', 'num0', and 'num1' -- process those
+// words with the fastest implementation supported by the executing CPU.  On
+// x86-64 platforms built with GCC or Clang, the CPU is queried once at run
+// time, and implementations using the 'POPCNT' instruction and 256-bit AVX2
+// vector instructions are used where available; on other platforms a portable
+// implementation is used.  All implementations produce identical results.
+// Note that 'num1' remains linear in the length of the range; clients
+// repeatedly counting the bits preceding arbitrary positions of a large,
+// unchanging bit string should consider 'bdlb::BitStringRankIndex'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -790,6 +804,43 @@ struct BitStringUtil {
         // that a trailing newline is provided in multiline mode only.
 };
 
+                        // =============================
+                        // struct BitStringUtil_Dispatch
+                        // =============================
+
+struct BitStringUtil_Dispatch {
+    // This struct is component-private.  Do not use.  This 'struct' provides
+    // a namespace for functions that query and select the implementation (the
+    // "kernels") used by the operations of 'BitStringUtil' to process whole
+    // words of bit strings.  The best kernels supported by the executing CPU
+    // are selected automatically; these functions are intended for testing
+    // and benchmarking.
+
+    // TYPES
+    enum Kernels {
+        // Enumerate the implementations of the kernels.
+
+        e_PORTABLE,  // portable C++, one word at a time
+        e_POPCNT,    // as 'e_PORTABLE', counting bits with 'POPCNT'
+        e_AVX2       // four words at a time, with AVX2 instructions
+    };
+
+    // CLASS METHODS
+    static Kernels bestSupported();
+        // Return the fastest kernels supported by this build on the executing
+        // CPU.
+
+    static void select(Kernels kernels);
+        // Select the specified 'kernels' for use by all subsequent operations
+        // of 'BitStringUtil'.  The behavior is undefined unless
+        // 'kernels <= bestSupported()', and no operation of 'BitStringUtil'
+        // is concurrently invoked.
+
+    static Kernels selected();
+        // Return the kernels used by the operations of 'BitStringUtil',
+        // selecting 'bestSupported()' if no kernels have been selected.
+};
+
 // ============================================================================
 //                              INLINE DEFINITIONS
 // ============================================================================
@@ -7,12 +7,14 @@
 
 #include <bsls_alignmentfromtype.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_cstddef.h>     // 'bsl::size_t'
 #include <bsl_cstdlib.h>     // 'bsl::rand'
@@ -79,8 +81,13 @@ using bsl::flush;
 // [13] St num0(const uint64_t *bitString, St index, St numBits);
 // [13] St num1(const uint64_t *bitString, St index, St numBits);
 // [12] OS& print(OS& stream, U64 *bs, St nb, int lvl, int spl);
+//
+// [23] Kernels BitStringUtil_Dispatch::bestSupported();
+// [23] void BitStringUtil_Dispatch::select(Kernels kernels);
+// [23] Kernels BitStringUtil_Dispatch::selected();
 // ----------------------------------------------------------------------------
-// [23] USAGE EXAMPLE
+// [24] USAGE EXAMPLE
+// [-1] PERFORMANCE OF WORD KERNELS
 // [ 1] void populateBitString(U64 *bitString, St idx, char *ascii);
 // [ 1] void populateBitStringHex(U64 *bitString, St idx, char *ascii);
 // ----------------------------------------------------------------------------
@@ -957,7 +964,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1107,6 +1114,223 @@ int main(int argc, char *argv[])
     ASSERT(false == isOffMay28);
 //..
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING WORD KERNELS
+        //   Ensure that the operations traversing whole words of long bit
+        //   strings produce the same results with each of the kernels
+        //   supported by the executing CPU.
+        //
+        // Concerns:
+        //: 1 'BitStringUtil_Dispatch::bestSupported' returns the same value
+        //:   on every call, and 'select' changes the value of 'selected'.
+        //:
+        //: 2 For ranges spanning many more words than the threshold above
+        //:   which the kernels are used, with or without partial words at
+        //:   either end, 'num0', 'num1', 'isAny0', 'isAny1', and the 'find'
+        //:   functions return the same value as the oracles, with each of
+        //:   the kernels.
+        //:
+        //: 3 For such ranges, the bitwise-logical operations produce the same
+        //:   result as the oracles, including when the two ranges begin on
+        //:   word boundaries and when they are the same range, and the bits
+        //:   outside the destination range are not modified.
+        //
+        // Plan:
+        //: 1 Verify that 'bestSupported' returns the same value twice, and,
+        //:   for each supported kernel, 'select' it and verify 'selected'.
+        //:   (C-1)
+        //:
+        //: 2 For each supported kernel, fill a bit string with each of a set
+        //:   of patterns (all 0s, all 1s, a single 1 or 0 at various
+        //:   positions, and garbage), and for a table of '(begin, end)'
+        //:   ranges compare the results of the accessors with those of the
+        //:   oracles.  (C-2)
+        //:
+        //: 3 For each supported kernel, for a table of source and destination
+        //:   indices and lengths, apply each bitwise-logical operation to
+        //:   garbage bit strings, and compare the result with that of the
+        //:   corresponding oracle.  Repeat with the source and destination
+        //:   being the same range of the same array.  (C-3)
+        //
+        // Testing:
+        //   Kernels BitStringUtil_Dispatch::bestSupported();
+        //   void BitStringUtil_Dispatch::select(Kernels kernels);
+        //   Kernels BitStringUtil_Dispatch::selected();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING WORD KERNELS\n"
+                             "====================\n";
+
+        typedef bdlb::BitStringUtil_Dispatch Dispatch;
+
+        enum { k_NUM_WORDS = 40,
+               k_NUM_BITS  = k_NUM_WORDS * k_BITS_PER_UINT64 };
+
+        const Dispatch::Kernels BEST = Dispatch::bestSupported();
+        ASSERT(BEST == Dispatch::bestSupported());
+
+        if (verbose) P(BEST);
+
+        static const size_t POSITIONS[] = { 0, 1, 63, 64, 65, 600, 1279,
+                                            1280, 2496, 2559 };
+        enum { k_NUM_POSITIONS = sizeof POSITIONS / sizeof *POSITIONS };
+
+        static const struct {
+            int    d_line;
+            size_t d_begin;
+            size_t d_end;
+        } RANGES[] = {
+            { L_,    0, k_NUM_BITS      },
+            { L_,    0, k_NUM_BITS - 1  },
+            { L_,    1, k_NUM_BITS      },
+            { L_,   63, k_NUM_BITS - 63 },
+            { L_,   64, k_NUM_BITS - 64 },
+            { L_,   65, 1300            },
+            { L_,  128, 128 + 8 * 64    },
+            { L_,  130, 130 + 8 * 64    },
+            { L_,  601, 1279            },
+            { L_, 1000, 1001            },
+        };
+        enum { k_NUM_RANGES = sizeof RANGES / sizeof *RANGES };
+
+        uint64_t bits[k_NUM_WORDS];
+
+        for (int ki = Dispatch::e_PORTABLE; ki <= BEST; ++ki) {
+            const Dispatch::Kernels KERNELS =
+                                          static_cast<Dispatch::Kernels>(ki);
+
+            Dispatch::select(KERNELS);
+            ASSERTV(ki, KERNELS == Dispatch::selected());
+
+            // Patterns: 0 - all 0s, 1 - all 1s, 2 - garbage, and
+            // '3 + 2 * pos' ('4 + 2 * pos') - a single 1 (0) at
+            // 'POSITIONS[pos]' among 0s (1s).
+
+            for (int pattern = 0; pattern < 3 + 2 * k_NUM_POSITIONS;
+                                                                 ++pattern) {
+                if (2 == pattern) {
+                    fillWithGarbage(bits, sizeof bits);
+                }
+                else {
+                    const bool VALUE = pattern >= 3 ? 0 == pattern % 2
+                                                    : 1 == pattern;
+
+                    bsl::fill(bits, bits + k_NUM_WORDS, VALUE ? ~0ULL : 0ULL);
+                    if (pattern >= 3) {
+                        Util::assign(bits,
+                                     POSITIONS[(pattern - 3) / 2],
+                                     !VALUE);
+                    }
+                }
+
+                for (int ri = 0; ri < k_NUM_RANGES; ++ri) {
+                    const int    LINE  = RANGES[ri].d_line;
+                    const size_t BEGIN = RANGES[ri].d_begin;
+                    const size_t END   = RANGES[ri].d_end;
+                    const size_t NB    = END - BEGIN;
+
+                    const size_t NUM1  = countOnes(bits, BEGIN, NB);
+
+                    ASSERTV(ki, pattern, LINE,
+                            NUM1 == Util::num1(bits, BEGIN, NB));
+                    ASSERTV(ki, pattern, LINE,
+                            NB - NUM1 == Util::num0(bits, BEGIN, NB));
+                    ASSERTV(ki, pattern, LINE,
+                            (NUM1 < NB) == Util::isAny0(bits, BEGIN, NB));
+                    ASSERTV(ki, pattern, LINE,
+                            (NUM1 > 0) == Util::isAny1(bits, BEGIN, NB));
+
+                    ASSERTV(ki, pattern, LINE,
+                            findAtMaxOracle(bits, BEGIN, END, false) ==
+                                   Util::find0AtMaxIndex(bits, BEGIN, END));
+                    ASSERTV(ki, pattern, LINE,
+                            findAtMinOracle(bits, BEGIN, END, false) ==
+                                   Util::find0AtMinIndex(bits, BEGIN, END));
+                    ASSERTV(ki, pattern, LINE,
+                            findAtMaxOracle(bits, BEGIN, END, true) ==
+                                   Util::find1AtMaxIndex(bits, BEGIN, END));
+                    ASSERTV(ki, pattern, LINE,
+                            findAtMinOracle(bits, BEGIN, END, true) ==
+                                   Util::find1AtMinIndex(bits, BEGIN, END));
+
+                    ASSERTV(ki, pattern, LINE,
+                            findAtMaxOracle(bits, 0, END, false) ==
+                                          Util::find0AtMaxIndex(bits, END));
+                    ASSERTV(ki, pattern, LINE,
+                            findAtMinOracle(bits, 0, END, false) ==
+                                          Util::find0AtMinIndex(bits, END));
+                    ASSERTV(ki, pattern, LINE,
+                            findAtMaxOracle(bits, 0, END, true) ==
+                                          Util::find1AtMaxIndex(bits, END));
+                    ASSERTV(ki, pattern, LINE,
+                            findAtMinOracle(bits, 0, END, true) ==
+                                          Util::find1AtMinIndex(bits, END));
+                }
+            }
+
+            static const struct {
+                int    d_line;
+                size_t d_dstIndex;
+                size_t d_srcIndex;
+                size_t d_numBits;
+            } OPS[] = {
+                { L_,    0,    0, k_NUM_BITS     },
+                { L_,    0,    0, k_NUM_BITS - 1 },
+                { L_,   64,  128, 8 * 64         },
+                { L_,   64,  128, 8 * 64 - 1     },
+                { L_,  128,   64, 20 * 64 + 17   },
+                { L_,    1,   64, 20 * 64        },
+                { L_,   64,   65, 20 * 64        },
+                { L_,  192, 1280, 7 * 64         },
+            };
+            enum { k_NUM_OPS = sizeof OPS / sizeof *OPS };
+
+            typedef void (*Op)(uint64_t *, size_t, const uint64_t *, size_t,
+                               size_t);
+            static const Op FUNCS[]   = { &Util::andEqual, &Util::minusEqual,
+                                          &Util::orEqual,  &Util::xorEqual };
+            static const Op ORACLES[] = { &andOracle, &minusOracle,
+                                          &orOracle,  &xorOracle };
+
+            uint64_t src[k_NUM_WORDS];
+            uint64_t dst[k_NUM_WORDS];
+            uint64_t exp[k_NUM_WORDS];
+
+            for (int fi = 0; fi < 4; ++fi) {
+                for (int oi = 0; oi < k_NUM_OPS; ++oi) {
+                    const int    LINE    = OPS[oi].d_line;
+                    const size_t DST_IDX = OPS[oi].d_dstIndex;
+                    const size_t SRC_IDX = OPS[oi].d_srcIndex;
+                    const size_t NB      = bsl::min(
+                                               OPS[oi].d_numBits,
+                                               k_NUM_BITS - bsl::max(DST_IDX,
+                                                                     SRC_IDX));
+
+                    // Distinct arrays.
+
+                    fillWithGarbage(src, sizeof src);
+                    fillWithGarbage(dst, sizeof dst);
+                    wordCpy(exp, dst, sizeof dst);
+
+                    FUNCS[fi](dst, DST_IDX, src, SRC_IDX, NB);
+                    ORACLES[fi](exp, DST_IDX, src, SRC_IDX, NB);
+                    ASSERTV(ki, fi, LINE, 0 == wordCmp(exp, dst, sizeof dst));
+
+                    // Same range of the same array.
+
+                    wordCpy(exp, dst, sizeof dst);
+                    wordCpy(src, dst, sizeof dst);
+
+                    FUNCS[fi](dst, DST_IDX, dst, DST_IDX, NB);
+                    ORACLES[fi](exp, DST_IDX, src, DST_IDX, NB);
+                    ASSERTV(ki, fi, LINE, 0 == wordCmp(exp, dst, sizeof dst));
+                }
+            }
+        }
+
+        Dispatch::select(BEST);
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING 'find1AtMinIndex' METHODS
@@ -6003,6 +6227,83 @@ int main(int argc, char *argv[])
 
         if (veryVerbose) P(k_ALIGNMENT);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF WORD KERNELS
+        //
+        // Concerns:
+        //: 1 The kernels selected on CPUs supporting 'POPCNT' and AVX2 are
+        //:   faster than the portable kernels.
+        //
+        // Plan:
+        //: 1 For each supported kernel, time 'num1', 'find1AtMinIndex', and
+        //:   'orEqual' on a bit string of 2^26 bits, and report the timings
+        //:   using 'bsls::Stopwatch'.
+        //
+        // Testing:
+        //   PERFORMANCE OF WORD KERNELS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE OF WORD KERNELS\n"
+                             "===========================\n";
+
+        typedef bdlb::BitStringUtil_Dispatch Dispatch;
+
+        enum { k_NUM_WORDS = 1 << 20, k_ITERATIONS = 20 };
+
+        const size_t NUM_BITS = static_cast<size_t>(k_NUM_WORDS)
+                                                          * k_BITS_PER_UINT64;
+
+        bsl::vector<uint64_t> bitsVec(k_NUM_WORDS);
+        bsl::vector<uint64_t> zerosVec(k_NUM_WORDS, 0);
+
+        uint64_t *bits  = bitsVec.data();
+        uint64_t *zeros = zerosVec.data();
+
+        fillWithGarbage(bits, k_NUM_WORDS * sizeof(uint64_t));
+
+        const Dispatch::Kernels BEST = Dispatch::bestSupported();
+
+        for (int ki = Dispatch::e_PORTABLE; ki <= BEST; ++ki) {
+            Dispatch::select(static_cast<Dispatch::Kernels>(ki));
+
+            bsls::Stopwatch sw;
+            size_t          sum = 0;
+
+            sw.start(true);
+            for (int ii = 0; ii < k_ITERATIONS; ++ii) {
+                sum += Util::num1(bits, ii, NUM_BITS - ii);
+            }
+            sw.stop();
+            const double NUM1_TIME = sw.accumulatedUserTime();
+
+            sw.reset();
+            sw.start(true);
+            for (int ii = 0; ii < k_ITERATIONS; ++ii) {
+                sum += Util::find1AtMinIndex(zeros, NUM_BITS - ii);
+            }
+            sw.stop();
+            const double FIND_TIME = sw.accumulatedUserTime();
+
+            sw.reset();
+            sw.start(true);
+            for (int ii = 0; ii < k_ITERATIONS; ++ii) {
+                Util::orEqual(zeros, 0, bits, 0, NUM_BITS);
+            }
+            sw.stop();
+            const double OR_TIME = sw.accumulatedUserTime();
+
+            bsl::fill(zerosVec.begin(), zerosVec.end(), 0);
+
+            cout << "kernels: " << ki
+                 << "  num1: " << NUM1_TIME
+                 << "  find1AtMinIndex: " << FIND_TIME
+                 << "  orEqual: " << OR_TIME
+                 << "  (" << sum << ")\n";
+        }
+
+        Dispatch::select(BEST);
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND.\n";
         testStatus = -1;
@@ -0,0 +1,188 @@
+// bdlb_floatconvertutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLB_FLOATCONVERTUTIL
+#define INCLUDED_BDLB_FLOATCONVERTUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide fast, exact conversions between floating point and text.
+//
+//@CLASSES:
+//  bdlb::FloatConvertUtil: namespace for floating point conversion functions
+//
+//@SEE_ALSO: bdlb_float
+//
+//@DESCRIPTION: This component provides a namespace, 'bdlb::FloatConvertUtil',
+// containing functions that convert 'float' and 'double' values to text and
+// text to 'double' values.  The conversions are exact in both directions:
+//
+//: o 'formatShortest' writes the *shortest* decimal representation of a value
+//:   that converts back to exactly the same value (the representation closest
+//:   to the value if several have the same length), so that formatting and
+//:   parsing a value "round-trips" with no loss of information.
+//:
+//: o 'parse' converts a decimal representation to the 'double' value nearest
+//:   to it (ties being broken in favor of an even significand), which is the
+//:   value that 'strtod' produces for the same text in the "C" locale.
+//
+// Both functions are several times faster than the standard library
+// facilities ('ostream' insertion, 'sprintf', and 'strtod') that they replace,
+// neither uses the current locale, and neither allocates memory.
+//
+///Text Format
+///-----------
+// 'formatShortest' chooses between fixed and scientific notation the way the
+// '%g' conversion of 'printf' does, given a 'precision' argument: if 'X' is
+// the decimal exponent of the value (i.e., the value is 'd.ddd * 10^X'), the
+// value is written in scientific notation if 'X < -4' or 'X >= precision',
+// and in fixed notation otherwise.  Unlike '%g', however, the number of
+// significant digits written is the number needed to round-trip the value,
+// rather than 'precision'.  Trailing zeros are never written after a decimal
+// point, a decimal point is never written without a following digit, and an
+// exponent is written with a sign and at least two digits.  For example:
+//..
+//  Value       precision  '%.*g'               'formatShortest'
+//  ----------  ---------  -------------------  ------------------
+//  0.1                15  0.1                  0.1
+//  1.0 / 3            15  0.333333333333333    0.3333333333333333
+//  0.1 + 0.2          15  0.3                  0.30000000000000004
+//  1.0e15             15  1e+15                1e+15
+//  123456.0f           6  123456               123456
+//  1234567.0f          6  1.23457e+06          1.234567e+06
+//..
+// 'parse' accepts the longest prefix of its input matching the following
+// grammar, which is the decimal subset of the grammar accepted by 'strtod'
+// (excluding leading whitespace, hexadecimal notation, infinities, and NaNs):
+//..
+//  number      ::= [sign] significand [exponent]
+//  significand ::= digits ['.' [digits]] | '.' digits
+//  exponent    ::= ('e' | 'E') [sign] digits
+//  sign        ::= '+' | '-'
+//  digits      ::= digit {digit}
+//..
+// A value too large for a 'double' is converted to an infinity, and a nonzero
+// value too small for the smallest subnormal 'double' is converted to zero,
+// both having the sign of the input.
+//
+///Algorithms
+///----------
+// 'formatShortest' uses the "Schubfach" algorithm of Raffaello Giulietti, and
+// 'parse' uses the algorithm of Daniel Lemire and Michael Eisel ("Number
+// Parsing at a Gigabyte per Second"), preceded by Clinger's fast path for
+// small significands and exponents.  Both algorithms use a single table of
+// 128-bit approximations of powers of ten.  The rare inputs for which 'parse'
+// cannot determine the correctly rounded result from that table (e.g., inputs
+// having more than 19 significant digits that lie extremely close to the
+// midpoint between two 'double' values, or subnormal results) are converted
+// by 'strtod'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Round-Tripping a Price
+///- - - - - - - - - - - - - - - - -
+// Suppose we publish prices as text, and our subscribers must recover exactly
+// the 'double' values we publish, using as few characters as possible.
+//
+// First, we format a price, which 'sprintf("%.15g", ...)' would format as
+// "0.3" even though that text does not convert back to the same value:
+//..
+//  const double price = 0.1 + 0.2;
+//
+//  char      buffer[bdlb::FloatConvertUtil::k_MAX_SHORTEST_LENGTH];
+//  const int length = bdlb::FloatConvertUtil::formatShortest(buffer,
+//                                                            price,
+//                                                            15);
+//
+//  assert(bsl::string(buffer, length) == "0.30000000000000004");
+//..
+// Then, a subscriber parses the text:
+//..
+//  double            parsed    = 0;
+//  const bsl::size_t numParsed = bdlb::FloatConvertUtil::parse(
+//                                                         &parsed,
+//                                                         buffer,
+//                                                         buffer + length);
+//..
+// Finally, we verify that the whole text was parsed and that the subscriber
+// recovered exactly the value we published:
+//..
+//  assert(static_cast<bsl::size_t>(length) == numParsed);
+//  assert(price == parsed);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+                          // =======================
+                          // struct FloatConvertUtil
+                          // =======================
+
+struct FloatConvertUtil {
+    // This 'struct' provides a namespace for functions converting between
+    // floating point values and their decimal text representations.
+
+    // CONSTANTS
+    enum {
+        k_MAX_PRECISION       = 17,  // largest 'precision' accepted by
+                                     // 'formatShortest'
+
+        k_MAX_SHORTEST_LENGTH = 24   // most characters written by
+                                     // 'formatShortest'
+    };
+
+    // CLASS METHODS
+    static int formatShortest(char *buffer, double value, int precision);
+    static int formatShortest(char *buffer, float  value, int precision);
+        // Write to the specified 'buffer' the shortest decimal representation
+        // of the specified 'value' that converts back to 'value', using fixed
+        // or scientific notation as the '%g' conversion of 'printf' would for
+        // the specified 'precision', as described in {Text Format}, and
+        // return the number of characters written.  A null character is not
+        // written.  The behavior is undefined unless 'value' is finite,
+        // 'buffer' has room for at least 'k_MAX_SHORTEST_LENGTH' characters,
+        // and '1 <= precision <= k_MAX_PRECISION'.  Note that a negative zero
+        // is written as "-0".
+
+    static bsl::size_t parse(double     *result,
+                             const char *begin,
+                             const char *end);
+        // Load into the specified 'result' the 'double' value nearest to the
+        // number represented by the longest prefix of the specified range
+        // '[begin, end)' matching the grammar described in {Text Format}, and
+        // return the length of that prefix.  If no prefix of the range
+        // matches the grammar, return 0 with no effect on 'result'.  The
+        // behavior is undefined unless '[begin, end)' is a valid range.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
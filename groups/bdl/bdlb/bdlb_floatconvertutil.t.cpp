@@ -0,0 +1,779 @@
+// bdlb_floatconvertutil.t.cpp                                        -*-C++-*-
+
+#include <bdlb_floatconvertutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cmath.h>       // 'bsl::frexp'
+#include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>     // 'bsl::atoi', 'bsl::strtod'
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test is a utility converting floating point values to
+// and from text.  'formatShortest' is verified against tables of expected
+// output, and, for many pseudo-random values, by verifying that 'strtod'
+// converts its output back to the original value and that 'sprintf' with one
+// fewer significant digit does not.  'parse' is verified against a table of
+// expected results, and against 'strtod' for many pseudo-random inputs.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int formatShortest(char *buffer, double value, int precision);
+// [ 3] int formatShortest(char *buffer, float  value, int precision);
+// [ 4] size_t parse(double *result, const char *begin, const char *end);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE OF CONVERSIONS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static int verbose = 0;
+static int veryVerbose = 0;
+static int veryVeryVerbose = 0;
+
+typedef bdlb::FloatConvertUtil Util;
+typedef bsls::Types::Uint64    Uint64;
+
+enum { k_BUFFER_SIZE = Util::k_MAX_SHORTEST_LENGTH };
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+Uint64 nextRandom()
+    // Return the next value of a sequence of pseudo-random numbers.
+{
+    static Uint64 seed = 0x0123456789abcdefULL;
+
+    seed = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+    const Uint64 hi = seed >> 32;
+    seed = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+    return hi << 32 | seed >> 32;
+}
+
+static
+double randomDouble()
+    // Return a pseudo-random finite 'double' value, chosen so that normal
+    // values of all magnitudes, and subnormal values, are frequent.
+{
+    while (true) {
+        Uint64 bits = nextRandom();
+        if (0 == (bits & 0xf)) {
+            bits &= 0x800fffffffffffffULL;   // subnormal
+        }
+        double value;
+        bsl::memcpy(&value, &bits, sizeof value);
+        if (value == value
+         && value !=  bsl::numeric_limits<double>::infinity()
+         && value != -bsl::numeric_limits<double>::infinity()) {
+            return value;                                             // RETURN
+        }
+    }
+}
+
+static
+float randomFloat()
+    // Return a pseudo-random finite 'float' value, chosen so that normal
+    // values of all magnitudes, and subnormal values, are frequent.
+{
+    while (true) {
+        unsigned int bits = static_cast<unsigned int>(nextRandom());
+        if (0 == (bits & 0xf)) {
+            bits &= 0x807fffffU;             // subnormal
+        }
+        float value;
+        bsl::memcpy(&value, &bits, sizeof value);
+        if (value == value
+         && value !=  bsl::numeric_limits<float>::infinity()
+         && value != -bsl::numeric_limits<float>::infinity()) {
+            return value;                                             // RETURN
+        }
+    }
+}
+
+static
+int numSignificantDigits(const char *text, int length)
+    // Return the number of significant digits in the specified 'text' of the
+    // specified 'length', as written by 'formatShortest'.
+{
+    int  numDigits = 0;
+    int  numZeros  = 0;  // zeros not yet known to be significant
+    bool isLeading = true;
+    for (int ii = 0; ii < length && 'e' != text[ii]; ++ii) {
+        const char c = text[ii];
+        if ('0' == c) {
+            if (!isLeading) {
+                ++numZeros;
+            }
+        }
+        else if ('1' <= c && c <= '9') {
+            isLeading  = false;
+            numDigits += numZeros + 1;
+            numZeros   = 0;
+        }
+    }
+    return numDigits;
+}
+
+template <class TYPE>
+static
+void verifyShortest(int line, TYPE value, int precision)
+    // Verify, using 'ASSERTV' and reporting the specified 'line', that
+    // 'formatShortest' writes, for the specified 'value' and 'precision', a
+    // representation that 'strtod' converts back to 'value', and that no
+    // representation having fewer significant digits converts back to
+    // 'value'.
+{
+    char      buffer[k_BUFFER_SIZE + 1];
+    const int length = Util::formatShortest(buffer, value, precision);
+    ASSERTV(line, length, 0 < length && length <= k_BUFFER_SIZE);
+    buffer[length] = '\0';
+
+    const TYPE parsed = static_cast<TYPE>(bsl::strtod(buffer, 0));
+    ASSERTV(line, buffer, 0 == bsl::memcmp(&parsed, &value, sizeof value));
+
+    // The representation nearest to 'value' having one fewer significant
+    // digit is the one most likely to convert back to 'value'.  Values at a
+    // power of two are skipped, since their rounding interval is asymmetric.
+
+    const int numDigits = numSignificantDigits(buffer, length);
+
+    int          exponent2;
+    const double fraction = bsl::frexp(static_cast<double>(value),
+                                       &exponent2);
+    if (numDigits > 1 && 0.5 != fraction && -0.5 != fraction) {
+        char shorter[64];
+        bsl::sprintf(shorter, "%.*e", numDigits - 2,
+                     static_cast<double>(value));
+        const TYPE other = static_cast<TYPE>(bsl::strtod(shorter, 0));
+        ASSERTV(line, buffer, shorter, other != value);
+    }
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Round-Tripping a Price
+///- - - - - - - - - - - - - - - - -
+// Suppose we publish prices as text, and our subscribers must recover exactly
+// the 'double' values we publish, using as few characters as possible.
+//
+// First, we format a price, which 'sprintf("%.15g", ...)' would format as
+// "0.3" even though that text does not convert back to the same value:
+//..
+  const double price = 0.1 + 0.2;
+
+  char      buffer[bdlb::FloatConvertUtil::k_MAX_SHORTEST_LENGTH];
+  const int length = bdlb::FloatConvertUtil::formatShortest(buffer,
+                                                            price,
+                                                            15);
+
+  ASSERT(bsl::string(buffer, length) == "0.30000000000000004");
+//..
+// Then, a subscriber parses the text:
+//..
+  double            parsed    = 0;
+  const bsl::size_t numParsed = bdlb::FloatConvertUtil::parse(
+                                                         &parsed,
+                                                         buffer,
+                                                         buffer + length);
+//..
+// Finally, we verify that the whole text was parsed and that the subscriber
+// recovered exactly the value we published:
+//..
+  ASSERT(static_cast<bsl::size_t>(length) == numParsed);
+  ASSERT(price == parsed);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'parse'
+        //
+        // Concerns:
+        //: 1 'parse' consumes the longest prefix of its input matching the
+        //:   documented grammar, and consumes nothing, leaving the result
+        //:   unchanged, if no prefix matches.
+        //:
+        //: 2 'parse' produces the 'double' nearest to the number, with ties
+        //:   broken in favor of an even significand, including for inputs
+        //:   having more than 19 significant digits, subnormal results, and
+        //:   results that overflow or underflow.
+        //:
+        //: 3 The sign of the input is preserved, including for zeros.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse inputs and verify the
+        //:   number of characters parsed and the result.  (C-1..3)
+        //:
+        //: 2 Parse, for many pseudo-random 'double' values, the text written
+        //:   by 'sprintf' with various numbers of significant digits, and
+        //:   verify that the result is the value that 'strtod' produces.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   size_t parse(double *result, const char *begin, const char *end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'parse'\n"
+                             "===============\n";
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double UNCHANGED = -12345.0;
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_numParsed;
+            double      d_expected;
+        } DATA[] = {
+            //LINE  INPUT                         NUM  EXPECTED
+            //----  ----------------------------  ---  ---------------------
+            { L_,   "",                             0, UNCHANGED             },
+            { L_,   "+",                            0, UNCHANGED             },
+            { L_,   "-",                            0, UNCHANGED             },
+            { L_,   ".",                            0, UNCHANGED             },
+            { L_,   "-.",                           0, UNCHANGED             },
+            { L_,   "e5",                           0, UNCHANGED             },
+            { L_,   " 1",                           0, UNCHANGED             },
+            { L_,   "abc",                          0, UNCHANGED             },
+            { L_,   "0",                            1, 0.0                   },
+            { L_,   "-0",                           2, -0.0                  },
+            { L_,   "1",                            1, 1.0                   },
+            { L_,   "+1",                           2, 1.0                   },
+            { L_,   "-1",                           2, -1.0                  },
+            { L_,   "1.",                           2, 1.0                   },
+            { L_,   ".5",                           2, 0.5                   },
+            { L_,   "-.5",                          3, -0.5                  },
+            { L_,   "1e",                           1, 1.0                   },
+            { L_,   "1e+",                          1, 1.0                   },
+            { L_,   "1e-",                          1, 1.0                   },
+            { L_,   "1ex",                          1, 1.0                   },
+            { L_,   "1e2",                          3, 100.0                 },
+            { L_,   "1E+2",                         4, 100.0                 },
+            { L_,   "1e-2",                         4, 0.01                  },
+            { L_,   "12.5,",                        4, 12.5                  },
+            { L_,   "12.5]",                        4, 12.5                  },
+            { L_,   "007",                          3, 7.0                   },
+            { L_,   "0.1",                          3, 0.1                   },
+            { L_,   "0.30000000000000004",         19, 0.30000000000000004   },
+            { L_,   "123456789012345678901234567890",
+                                                   30, 1.2345678901234568e29 },
+            { L_,   "0.100000000000000005551115123125782702118158340454101"
+                    "5625",                        57, 0.1                   },
+            { L_,   "9007199254740993",            16, 9007199254740992.0    },
+            { L_,   "9007199254740993.0000000001", 27, 9007199254740994.0    },
+            { L_,   "1.7976931348623157e308",      22, DBL_MAX               },
+            { L_,   "1.7976931348623159e308",      22, INF                   },
+            { L_,   "-1e309",                       6, -INF                  },
+            { L_,   "1e99999999999",               13, INF                   },
+            { L_,   "2.2250738585072014e-308",     23, DBL_MIN               },
+            { L_,   "4.9406564584124654e-324",     23, 5e-324                },
+            { L_,   "2.4703282292062328e-324",     23, 5e-324                },
+            { L_,   "2.4703282292062327e-324",     23, 0.0                   },
+            { L_,   "-1e-400",                      7, -0.0                  },
+            { L_,   "0e99999",                      7, 0.0                   },
+            { L_,   "0.0000000000000000000000000000001",
+                                                   33, 1e-31                 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE  = DATA[ti].d_line;
+            const char *const INPUT = DATA[ti].d_input;
+            const int         NUM   = DATA[ti].d_numParsed;
+            const double      EXP   = DATA[ti].d_expected;
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            double            result    = UNCHANGED;
+            const bsl::size_t numParsed = Util::parse(
+                                               &result,
+                                               INPUT,
+                                               INPUT + bsl::strlen(INPUT));
+
+            ASSERTV(LINE, numParsed, NUM, static_cast<bsl::size_t>(NUM)
+                                                                == numParsed);
+            ASSERTV(LINE, result, EXP, 0 == bsl::memcmp(&result,
+                                                           &EXP,
+                                                           sizeof EXP));
+        }
+
+        if (verbose) cout << "\nComparing with 'strtod'.\n";
+
+        for (int ii = 0; ii < 200000; ++ii) {
+            const double VALUE     = randomDouble();
+            const int    PRECISION = static_cast<int>(nextRandom() % 25);
+
+            char      input[64];
+            const int length = bsl::sprintf(input, "%.*e", PRECISION, VALUE);
+
+            const double EXP    = bsl::strtod(input, 0);
+            double       result = UNCHANGED;
+
+            const bsl::size_t numParsed = Util::parse(&result,
+                                                      input,
+                                                      input + length);
+            ASSERTV(input, static_cast<bsl::size_t>(length) == numParsed);
+            ASSERTV(input, result, EXP, 0 == bsl::memcmp(&result,
+                                                            &EXP,
+                                                            sizeof EXP));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'formatShortest' FOR 'float'
+        //
+        // Concerns:
+        //: 1 'formatShortest' writes the shortest representation that
+        //:   converts back to the value as a 'float', which may be much
+        //:   shorter than the shortest representation of the same value as a
+        //:   'double'.
+        //:
+        //: 2 Notation is chosen as for 'double' values.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format values and verify the
+        //:   output.  (C-1..2)
+        //:
+        //: 2 Format many pseudo-random 'float' values, and verify that the
+        //:   output converts back to the value and that no shorter output
+        //:   does.  (C-1)
+        //
+        // Testing:
+        //   int formatShortest(char *buffer, float  value, int precision);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'formatShortest' FOR 'float'\n"
+                             "====================================\n";
+
+        static const struct {
+            int         d_line;
+            float       d_value;
+            int         d_precision;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE            PREC  EXPECTED
+            //----  ---------------  ----  -----------------
+            { L_,   0.0f,               6, "0"               },
+            { L_,   -0.0f,              6, "-0"              },
+            { L_,   0.1f,               6, "0.1"             },
+            { L_,   0.125f,             6, "0.125"           },
+            { L_,   -1.5e1f,            6, "-15"             },
+            { L_,   1.0f / 3,           6, "0.33333334"      },
+            { L_,   123456.0f,          6, "123456"          },
+            { L_,   1234567.0f,         6, "1.234567e+06"    },
+            { L_,   1234567.0f,         7, "1234567"         },
+            { L_,   16777216.0f,        6, "1.6777216e+07"   },
+            { L_,   -1.23456e-20f,      6, "-1.23456e-20"    },
+            { L_,   FLT_MAX,            6, "3.4028235e+38"   },
+            { L_,   FLT_MIN,            6, "1.1754944e-38"   },
+            { L_,   1.4e-45f,           6, "1e-45"           },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE      = DATA[ti].d_line;
+            const float       VALUE     = DATA[ti].d_value;
+            const int         PRECISION = DATA[ti].d_precision;
+            const char *const EXP       = DATA[ti].d_expected;
+
+            char      buffer[k_BUFFER_SIZE];
+            const int length = Util::formatShortest(buffer, VALUE, PRECISION);
+
+            const bsl::string result(buffer, length);
+            ASSERTV(LINE, result, EXP, EXP == result);
+        }
+
+        if (verbose) cout << "\nVerifying pseudo-random values.\n";
+
+        for (int ii = 0; ii < 200000; ++ii) {
+            verifyShortest(ii, randomFloat(), 1 + ii % Util::k_MAX_PRECISION);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'formatShortest' FOR 'double'
+        //
+        // Concerns:
+        //: 1 'formatShortest' writes the shortest representation that
+        //:   converts back to the value, and the one closest to the value if
+        //:   several have the same length.
+        //:
+        //: 2 Fixed notation is used exactly when '-4 <= X < precision', where
+        //:   'X' is the decimal exponent of the value.
+        //:
+        //: 3 Zeros, including negative zero, subnormal values, and the
+        //:   extreme finite values are formatted correctly, and no output is
+        //:   longer than 'k_MAX_SHORTEST_LENGTH'.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, format values and verify the
+        //:   output.  (C-1..3)
+        //:
+        //: 2 Format many pseudo-random values with pseudo-random precisions,
+        //:   and verify that the output converts back to the value and that
+        //:   no shorter output does.  (C-1, 3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid precisions and non-finite values.  (C-4)
+        //
+        // Testing:
+        //   int formatShortest(char *buffer, double value, int precision);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'formatShortest' FOR 'double'\n"
+                             "=====================================\n";
+
+        static const struct {
+            int         d_line;
+            double      d_value;
+            int         d_precision;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE VALUE                    PREC EXPECTED
+            //---- ------------------------ ---- -------------------------
+            { L_, 0.0,                      15, "0"                       },
+            { L_, -0.0,                     15, "-0"                      },
+            { L_, 1.0,                      15, "1"                       },
+            { L_, -1.5,                     15, "-1.5"                    },
+            { L_, 10.0,                     15, "10"                      },
+            { L_, 0.1,                      15, "0.1"                     },
+            { L_, 0.125,                    15, "0.125"                   },
+            { L_, 0.1 + 0.2,                15, "0.30000000000000004"     },
+            { L_, 1.0 / 3,                  15, "0.3333333333333333"      },
+            { L_, 2.0 / 3,                  15, "0.6666666666666666"      },
+            { L_, 0.0001,                   15, "0.0001"                  },
+            { L_, 0.00001,                  15, "1e-05"                   },
+            { L_, 0.000123,                 15, "0.000123"                },
+            { L_, 0.0000123,                15, "1.23e-05"                },
+            { L_, 100.0,                     1, "1e+02"                   },
+            { L_, 100.0,                     2, "1e+02"                   },
+            { L_, 100.0,                     3, "100"                     },
+            { L_, 123.0,                     3, "123"                     },
+            { L_, 123.5,                     3, "123.5"                   },
+            { L_, 1234.5,                    3, "1.2345e+03"              },
+            { L_, 1234.5,                    4, "1234.5"                  },
+            { L_, 1e15,                     15, "1e+15"                   },
+            { L_, 1e15,                     16, "1000000000000000"        },
+            { L_, 123456789012345.0,        15, "123456789012345"         },
+            { L_, 1234567890123456.0,       15, "1.234567890123456e+15"   },
+            { L_, 9007199254740992.0,       17, "9007199254740992"        },
+            { L_, -9.9e100,                 15, "-9.9e+100"               },
+            { L_, 3.14e300,                 15, "3.14e+300"               },
+            { L_, 2.23e-308,                15, "2.23e-308"               },
+            { L_, 5e-324,                   15, "5e-324"                  },
+            { L_, -2.2250738585072009e-308, 15, "-2.225073858507201e-308" },
+            { L_, DBL_MIN,                  15, "2.2250738585072014e-308" },
+            { L_, -DBL_MAX,                 17, "-1.7976931348623157e+308"},
+            { L_, 1e23,                     15, "1e+23"                   },
+            { L_, 5e-5,                     15, "5e-05"                   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE      = DATA[ti].d_line;
+            const double      VALUE     = DATA[ti].d_value;
+            const int         PRECISION = DATA[ti].d_precision;
+            const char *const EXP       = DATA[ti].d_expected;
+
+            if (veryVerbose) { T_ P_(LINE) P(EXP) }
+
+            char      buffer[k_BUFFER_SIZE];
+            const int length = Util::formatShortest(buffer, VALUE, PRECISION);
+
+            const bsl::string result(buffer, length);
+            ASSERTV(LINE, result, EXP, EXP == result);
+        }
+
+        if (verbose) cout << "\nVerifying pseudo-random values.\n";
+
+        for (int ii = 0; ii < 200000; ++ii) {
+            verifyShortest(ii, randomDouble(), 1 + ii % Util::k_MAX_PRECISION);
+        }
+
+        if (verbose) cout << "\nNegative Testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[k_BUFFER_SIZE];
+
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0, 1));
+            ASSERT_PASS(Util::formatShortest(buffer, 1.0, 17));
+            ASSERT_FAIL(Util::formatShortest(buffer, 1.0, 0));
+            ASSERT_FAIL(Util::formatShortest(buffer, 1.0, 18));
+            ASSERT_FAIL(Util::formatShortest(
+                                 buffer,
+                                 bsl::numeric_limits<double>::infinity(),
+                                 15));
+            ASSERT_FAIL(Util::formatShortest(
+                                 buffer,
+                                 bsl::numeric_limits<float>::quiet_NaN(),
+                                 15));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format and parse a few values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        char buffer[k_BUFFER_SIZE];
+
+        int length = Util::formatShortest(buffer, 1.5, 15);
+        ASSERT("1.5" == bsl::string(buffer, length));
+
+        length = Util::formatShortest(buffer, -0.25f, 6);
+        ASSERT("-0.25" == bsl::string(buffer, length));
+
+        double value = 0;
+        ASSERT(5 == Util::parse(&value, buffer, buffer + length));
+        ASSERT(-0.25 == value);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF CONVERSIONS
+        //
+        // Concerns:
+        //: 1 'formatShortest' is faster than 'sprintf', and 'parse' is faster
+        //:   than 'strtod'.
+        //
+        // Plan:
+        //: 1 Format pseudo-random prices (values having a few fraction
+        //:   digits) and pseudo-random 'double' values using
+        //:   'formatShortest' and 'sprintf("%.17g")', and parse the results
+        //:   using 'parse' and 'strtod', and report the average time of each
+        //:   conversion using 'bsls::Stopwatch'.
+        //
+        // Testing:
+        //   PERFORMANCE OF CONVERSIONS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE OF CONVERSIONS\n"
+                             "==========================\n";
+
+        enum { k_NUM_VALUES = 1 << 20 };
+
+        for (int pass = 0; pass < 2; ++pass) {
+            bsl::vector<double> values(k_NUM_VALUES);
+            for (int ii = 0; ii < k_NUM_VALUES; ++ii) {
+                values[ii] = 0 == pass
+                           ? static_cast<double>(nextRandom() % 10000000)
+                                                                        / 1000
+                           : randomDouble();
+            }
+
+            bsl::vector<char> text(k_NUM_VALUES * 32);
+
+            bsls::Stopwatch sw;
+            Uint64          sum = 0;
+
+            sw.start(true);
+            for (int ii = 0; ii < k_NUM_VALUES; ++ii) {
+                sum += Util::formatShortest(&text[32 * ii], values[ii], 17);
+            }
+            sw.stop();
+            const double FORMAT_TIME = sw.accumulatedUserTime()
+                                                               / k_NUM_VALUES;
+
+            sw.reset();
+            sw.start(true);
+            for (int ii = 0; ii < k_NUM_VALUES; ++ii) {
+                char buffer[32];
+                sum += bsl::sprintf(buffer, "%.17g", values[ii]);
+            }
+            sw.stop();
+            const double SPRINTF_TIME = sw.accumulatedUserTime()
+                                                               / k_NUM_VALUES;
+
+            // Null-terminate each output for 'strtod'.
+
+            for (int ii = 0; ii < k_NUM_VALUES; ++ii) {
+                const int length = Util::formatShortest(&text[32 * ii],
+                                                        values[ii],
+                                                        17);
+                text[32 * ii + length] = '\0';
+            }
+
+            double total = 0;
+
+            sw.reset();
+            sw.start(true);
+            for (int ii = 0; ii < k_NUM_VALUES; ++ii) {
+                const char *begin = &text[32 * ii];
+                double      value;
+                Util::parse(&value, begin, begin + 32);
+                total += value;
+            }
+            sw.stop();
+            const double PARSE_TIME = sw.accumulatedUserTime() / k_NUM_VALUES;
+
+            sw.reset();
+            sw.start(true);
+            for (int ii = 0; ii < k_NUM_VALUES; ++ii) {
+                total += bsl::strtod(&text[32 * ii], 0);
+            }
+            sw.stop();
+            const double STRTOD_TIME = sw.accumulatedUserTime()
+                                                               / k_NUM_VALUES;
+
+            cout << (0 == pass ? "prices: " : "random: ")
+                 << "formatShortest: " << FORMAT_TIME
+                 << "  sprintf: "      << SPRINTF_TIME
+                 << "  parse: "        << PARSE_TIME
+                 << "  strtod: "       << STRTOD_TIME
+                 << "  (" << sum << ", " << total << ")\n";
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,107 @@
+// bdlb_integerformatutil.cpp                                         -*-C++-*-
+#include <bdlb_integerformatutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlb_integerformatutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace {
+
+const char DIGIT_PAIRS[] =
+    "00010203040506070809" "10111213141516171819"
+    "20212223242526272829" "30313233343536373839"
+    "40414243444546474849" "50515253545556575859"
+    "60616263646566676869" "70717273747576777879"
+    "80818283848586878889" "90919293949596979899";
+
+int formatMagnitude(char *buffer, bsls::Types::Uint64 magnitude)
+    // Write to the specified 'buffer' the decimal representation of the
+    // specified 'magnitude', and return the number of characters written.
+    // The behavior is undefined unless 'buffer' has room for the
+    // representation (at most 20 characters).
+{
+    // Generate the digits from the end of 'digits', two at a time, then copy
+    // them to 'buffer'.
+
+    char  digits[20];
+    char *end   = digits + sizeof digits;
+    char *begin = end;
+
+    while (magnitude >= 100) {
+        const unsigned int pair = static_cast<unsigned int>(magnitude % 100);
+        magnitude /= 100;
+        begin -= 2;
+        begin[0] = DIGIT_PAIRS[2 * pair];
+        begin[1] = DIGIT_PAIRS[2 * pair + 1];
+    }
+    if (magnitude >= 10) {
+        const unsigned int pair = static_cast<unsigned int>(magnitude);
+        begin -= 2;
+        begin[0] = DIGIT_PAIRS[2 * pair];
+        begin[1] = DIGIT_PAIRS[2 * pair + 1];
+    }
+    else {
+        *--begin = static_cast<char>('0' + magnitude);
+    }
+
+    const int length = static_cast<int>(end - begin);
+    bsl::memcpy(buffer, begin, length);
+    return length;
+}
+
+}  // close unnamed namespace
+
+namespace bdlb {
+
+                          // ------------------------
+                          // struct IntegerFormatUtil
+                          // ------------------------
+
+// CLASS METHODS
+int IntegerFormatUtil::formatDecimal(char *buffer, bsls::Types::Int64 value)
+{
+    BSLS_ASSERT(buffer);
+
+    if (value < 0) {
+        // Negate in unsigned arithmetic, so that the smallest value does not
+        // overflow.
+
+        *buffer = '-';
+        return 1 + formatMagnitude(
+                                 buffer + 1,
+                                 0 - static_cast<bsls::Types::Uint64>(value));
+                                                                      // RETURN
+    }
+    return formatMagnitude(buffer, value);
+}
+
+int IntegerFormatUtil::formatDecimal(char                *buffer,
+                                     bsls::Types::Uint64  value)
+{
+    BSLS_ASSERT(buffer);
+
+    return formatMagnitude(buffer, value);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
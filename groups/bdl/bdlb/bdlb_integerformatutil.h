@@ -0,0 +1,154 @@
+// bdlb_integerformatutil.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLB_INTEGERFORMATUTIL
+#define INCLUDED_BDLB_INTEGERFORMATUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide fast conversion of integers to decimal text.
+//
+//@CLASSES:
+//  bdlb::IntegerFormatUtil: namespace for integer formatting functions
+//
+//@SEE_ALSO: bdlb_floatconvertutil
+//
+//@DESCRIPTION: This component provides a namespace, 'bdlb::IntegerFormatUtil',
+// containing functions that write the decimal representation of an integer
+// to a character buffer.  The representation is that written by 'operator<<'
+// to a 'bsl::ostream' having default formatting flags: the digits of the
+// value, with no leading zeros, preceded by '-' if the value is negative.
+//
+// 'formatDecimal' produces two digits per division (looking each pair up in
+// a table), does not use the current locale or the formatting flags of any
+// stream, does not allocate memory, and does not write a terminating null
+// character.  It is intended for encoders that write many integers, such as
+// those of the 'baljsn' and 'balxml' packages.
+//
+// 'formatDecimal' is overloaded for 'int', 'unsigned int', 'long',
+// 'unsigned long', 'bsls::Types::Int64', and 'bsls::Types::Uint64'; a value
+// of a smaller integral type is promoted to 'int'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing an Integer to a Stream
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we write integers to a stream, and the formatting flags of the
+// stream must not affect them.
+//
+// First, we format the value into a buffer that is large enough for any
+// integer:
+//..
+//  const bsls::Types::Int64 value = -1234567890123LL;
+//
+//  char      buffer[bdlb::IntegerFormatUtil::k_MAX_DECIMAL_LENGTH];
+//  const int length = bdlb::IntegerFormatUtil::formatDecimal(buffer, value);
+//..
+// Then, we write the characters to the stream, which is configured to write
+// integers in hexadecimal:
+//..
+//  bsl::ostringstream stream;
+//  stream << bsl::hex;
+//  stream.write(buffer, length);
+//..
+// Finally, we verify that the integer was written in decimal:
+//..
+//  assert("-1234567890123" == stream.str());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+                          // ========================
+                          // struct IntegerFormatUtil
+                          // ========================
+
+struct IntegerFormatUtil {
+    // This 'struct' provides a namespace for functions writing the decimal
+    // representations of integers.
+
+    // CONSTANTS
+    enum {
+        k_MAX_DECIMAL_LENGTH = 20  // most characters written by
+                                   // 'formatDecimal' (e.g., for the smallest
+                                   // 'bsls::Types::Int64' value)
+    };
+
+    // CLASS METHODS
+    static int formatDecimal(char *buffer, int                 value);
+    static int formatDecimal(char *buffer, unsigned int        value);
+    static int formatDecimal(char *buffer, long                value);
+    static int formatDecimal(char *buffer, unsigned long       value);
+    static int formatDecimal(char *buffer, bsls::Types::Int64  value);
+    static int formatDecimal(char *buffer, bsls::Types::Uint64 value);
+        // Write to the specified 'buffer' the decimal representation of the
+        // specified 'value', preceded by '-' if 'value' is negative, and
+        // return the number of characters written.  A null character is not
+        // written.  The behavior is undefined unless 'buffer' has room for at
+        // least 'k_MAX_DECIMAL_LENGTH' characters.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // struct IntegerFormatUtil
+                          // ------------------------
+
+// CLASS METHODS
+inline
+int IntegerFormatUtil::formatDecimal(char *buffer, int value)
+{
+    return formatDecimal(buffer, static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+int IntegerFormatUtil::formatDecimal(char *buffer, unsigned int value)
+{
+    return formatDecimal(buffer, static_cast<bsls::Types::Uint64>(value));
+}
+
+inline
+int IntegerFormatUtil::formatDecimal(char *buffer, long value)
+{
+    return formatDecimal(buffer, static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+int IntegerFormatUtil::formatDecimal(char *buffer, unsigned long value)
+{
+    return formatDecimal(buffer, static_cast<bsls::Types::Uint64>(value));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
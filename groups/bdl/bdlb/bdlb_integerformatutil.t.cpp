@@ -0,0 +1,520 @@
+// bdlb_integerformatutil.t.cpp                                       -*-C++-*-
+
+#include <bdlb_integerformatutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>     // 'bsl::atoi'
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test is a utility writing the decimal representations
+// of integers.  'formatDecimal' is verified against a table of expected
+// output, including the limits of each integral type, and against 'sprintf'
+// for many pseudo-random values.  The overloads for 'int', 'unsigned int',
+// 'long', and 'unsigned long' forward to the 64-bit overloads, so they are
+// verified only for their limits and a few other values.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int formatDecimal(char *buffer, bsls::Types::Int64  value);
+// [ 2] int formatDecimal(char *buffer, int                 value);
+// [ 2] int formatDecimal(char *buffer, long                value);
+// [ 3] int formatDecimal(char *buffer, bsls::Types::Uint64 value);
+// [ 3] int formatDecimal(char *buffer, unsigned int        value);
+// [ 3] int formatDecimal(char *buffer, unsigned long       value);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static int verbose = 0;
+static int veryVerbose = 0;
+static int veryVeryVerbose = 0;
+
+typedef bdlb::IntegerFormatUtil Util;
+typedef bsls::Types::Int64      Int64;
+typedef bsls::Types::Uint64     Uint64;
+
+enum { k_BUFFER_SIZE = Util::k_MAX_DECIMAL_LENGTH };
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+Uint64 nextRandom()
+    // Return the next value of a sequence of pseudo-random numbers.
+{
+    static Uint64 seed = 0x0123456789abcdefULL;
+
+    seed = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+    const Uint64 hi = seed >> 32;
+    seed = 6364136223846793005ULL * seed + 1442695040888963407ULL;
+    return hi << 32 | seed >> 32;
+}
+
+static
+Uint64 randomMagnitude()
+    // Return a pseudo-random value, chosen so that values of all numbers of
+    // digits are frequent.
+{
+    const Uint64 bits = nextRandom();
+    return bits >> (bits & 0x3f);
+}
+
+template <class TYPE>
+static
+bsl::string format(TYPE value)
+    // Return the representation of the specified 'value' written by
+    // 'formatDecimal', after verifying, using 'ASSERTV', that no more than
+    // 'k_MAX_DECIMAL_LENGTH' characters were written.
+{
+    char buffer[k_BUFFER_SIZE + 1];
+    buffer[k_BUFFER_SIZE] = 'x';
+
+    const int length = Util::formatDecimal(buffer, value);
+
+    ASSERTV(length, 0 < length && length <= k_BUFFER_SIZE);
+    ASSERTV('x' == buffer[k_BUFFER_SIZE]);
+
+    return bsl::string(buffer, length);
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing an Integer to a Stream
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we write integers to a stream, and the formatting flags of the
+// stream must not affect them.
+//
+// First, we format the value into a buffer that is large enough for any
+// integer:
+//..
+  const bsls::Types::Int64 value = -1234567890123LL;
+
+  char      buffer[bdlb::IntegerFormatUtil::k_MAX_DECIMAL_LENGTH];
+  const int length = bdlb::IntegerFormatUtil::formatDecimal(buffer, value);
+//..
+// Then, we write the characters to the stream, which is configured to write
+// integers in hexadecimal:
+//..
+  bsl::ostringstream stream;
+  stream << bsl::hex;
+  stream.write(buffer, length);
+//..
+// Finally, we verify that the integer was written in decimal:
+//..
+  ASSERT("-1234567890123" == stream.str());
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING UNSIGNED 'formatDecimal'
+        //
+        // Concerns:
+        //: 1 The decimal representation of the value is written, with no
+        //:   leading zeros, and its length is returned.
+        //:
+        //: 2 Values having every number of digits, including the largest
+        //:   value of each unsigned type, are written correctly.
+        //:
+        //: 3 No more than 'k_MAX_DECIMAL_LENGTH' characters are written.
+        //:
+        //: 4 The overloads for the narrower unsigned types write the same
+        //:   representation as the 'bsls::Types::Uint64' overload.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the representation of
+        //:   each power of ten, of its predecessor, and of the largest value
+        //:   of each type.  (C-1..3)
+        //:
+        //: 2 Verify the representation of many pseudo-random values against
+        //:   that written by 'sprintf'.  (C-1..3)
+        //:
+        //: 3 Verify that the overloads for 'unsigned int' and 'unsigned long'
+        //:   write the same representation as the 'bsls::Types::Uint64'
+        //:   overload for values in their range.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null buffer (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   int formatDecimal(char *buffer, bsls::Types::Uint64 value);
+        //   int formatDecimal(char *buffer, unsigned int        value);
+        //   int formatDecimal(char *buffer, unsigned long       value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING UNSIGNED 'formatDecimal'\n"
+                             "================================\n";
+
+        if (verbose) cout << "\tPowers of ten and limits.\n";
+        {
+            Uint64 power = 1;
+            for (int digits = 1; digits <= 20; ++digits) {
+                const bsl::string EXP = "1" + bsl::string(digits - 1, '0');
+                ASSERTV(digits, EXP == format(power));
+
+                const Uint64 PREV = power - 1;
+                const bsl::string PREV_EXP = 1 == digits
+                                           ? bsl::string("0")
+                                           : bsl::string(digits - 1, '9');
+                ASSERTV(digits, PREV_EXP == format(PREV));
+
+                power *= 10;
+            }
+
+            ASSERT("18446744073709551615" == format(~Uint64(0)));
+            ASSERT("4294967295"           == format(UINT_MAX));
+            ASSERT("0"                    == format(0u));
+            ASSERT("0"                    == format(0ul));
+        }
+
+        if (verbose) cout << "\tPseudo-random values.\n";
+        {
+            for (int i = 0; i < 100000; ++i) {
+                const Uint64 VALUE = randomMagnitude();
+
+                char expected[32];
+                bsl::sprintf(expected, "%llu", VALUE);
+
+                if (veryVeryVerbose) { P(expected) }
+
+                ASSERTV(expected, expected == format(VALUE));
+
+                const unsigned int UINT_VALUE =
+                                             static_cast<unsigned int>(VALUE);
+                ASSERTV(UINT_VALUE,
+                        format(static_cast<Uint64>(UINT_VALUE)) ==
+                                                         format(UINT_VALUE));
+
+                const unsigned long ULONG_VALUE =
+                                            static_cast<unsigned long>(VALUE);
+                ASSERTV(ULONG_VALUE,
+                        format(static_cast<Uint64>(ULONG_VALUE)) ==
+                                                        format(ULONG_VALUE));
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[k_BUFFER_SIZE];
+
+            ASSERT_FAIL(Util::formatDecimal(0,      Uint64(1)));
+            ASSERT_PASS(Util::formatDecimal(buffer, Uint64(1)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING SIGNED 'formatDecimal'
+        //
+        // Concerns:
+        //: 1 The decimal representation of the value is written, preceded by
+        //:   '-' if the value is negative, and its length is returned.
+        //:
+        //: 2 The smallest and largest values of each signed type are written
+        //:   correctly (in particular, negating the smallest value does not
+        //:   overflow).
+        //:
+        //: 3 No more than 'k_MAX_DECIMAL_LENGTH' characters are written.
+        //:
+        //: 4 The overloads for 'int' and 'long' write the same representation
+        //:   as the 'bsls::Types::Int64' overload, and values of narrower
+        //:   types are promoted to 'int'.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the representation of
+        //:   values around zero, around powers of ten, and at the limits of
+        //:   'bsls::Types::Int64'.  (C-1..3)
+        //:
+        //: 2 Verify the representation of the limits of 'signed char',
+        //:   'short', 'int', and 'long'.  (C-2, 4)
+        //:
+        //: 3 Verify the representation of many pseudo-random values against
+        //:   that written by 'sprintf', and that the overloads for 'int' and
+        //:   'long' agree with the 'bsls::Types::Int64' overload for values
+        //:   in their range.  (C-1, 3, 4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null buffer (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   int formatDecimal(char *buffer, bsls::Types::Int64  value);
+        //   int formatDecimal(char *buffer, int                 value);
+        //   int formatDecimal(char *buffer, long                value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING SIGNED 'formatDecimal'\n"
+                             "==============================\n";
+
+        if (verbose) cout << "\tTable of values.\n";
+        {
+            static const struct {
+                int         d_line;   // source line number
+                Int64       d_value;  // value to format
+                const char *d_exp;    // expected representation
+            } DATA[] = {
+                //LINE  VALUE                       EXP
+                //----  --------------------------  ----------------------
+                { L_,                           0,  "0"                    },
+                { L_,                           1,  "1"                    },
+                { L_,                          -1,  "-1"                   },
+                { L_,                           9,  "9"                    },
+                { L_,                          -9,  "-9"                   },
+                { L_,                          10,  "10"                   },
+                { L_,                         -10,  "-10"                  },
+                { L_,                          99,  "99"                   },
+                { L_,                         100,  "100"                  },
+                { L_,                        -101,  "-101"                 },
+                { L_,                        1000,  "1000"                 },
+                { L_,                       -9999,  "-9999"                },
+                { L_,                  1234567890,  "1234567890"           },
+                { L_,        1000000000000000000LL, "1000000000000000000"  },
+                { L_,       -1000000000000000000LL, "-1000000000000000000" },
+                { L_,        9223372036854775807LL, "9223372036854775807"  },
+                { L_,       -9223372036854775807LL, "-9223372036854775807" },
+                { L_,   -9223372036854775807LL - 1, "-9223372036854775808" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE  = DATA[ti].d_line;
+                const Int64        VALUE = DATA[ti].d_value;
+                const bsl::string  EXP   = DATA[ti].d_exp;
+
+                const bsl::string result = format(VALUE);
+
+                if (veryVerbose) { P_(LINE) P_(EXP) P(result) }
+
+                ASSERTV(LINE, EXP, result, EXP == result);
+            }
+        }
+
+        if (verbose) cout << "\tLimits of narrower types.\n";
+        {
+            ASSERT("-128"        == format(SCHAR_MIN));
+            ASSERT("127"         == format(SCHAR_MAX));
+            ASSERT("-32768"      == format(SHRT_MIN));
+            ASSERT("32767"       == format(SHRT_MAX));
+            ASSERT("-2147483648" == format(INT_MIN));
+            ASSERT("2147483647"  == format(INT_MAX));
+
+            ASSERT(format(static_cast<Int64>(LONG_MIN)) == format(LONG_MIN));
+            ASSERT(format(static_cast<Int64>(LONG_MAX)) == format(LONG_MAX));
+
+            const short SHORT_VALUE = -12345;
+            char        buffer[k_BUFFER_SIZE];
+            ASSERT(6 == Util::formatDecimal(buffer, SHORT_VALUE));
+            ASSERT(0 == bsl::memcmp("-12345", buffer, 6));
+        }
+
+        if (verbose) cout << "\tPseudo-random values.\n";
+        {
+            for (int i = 0; i < 100000; ++i) {
+                const Uint64 MAGNITUDE = randomMagnitude() >> 1;
+                const Int64  VALUE     = i & 1
+                                       ? -static_cast<Int64>(MAGNITUDE)
+                                       : static_cast<Int64>(MAGNITUDE);
+
+                char expected[32];
+                bsl::sprintf(expected, "%lld", VALUE);
+
+                if (veryVeryVerbose) { P(expected) }
+
+                ASSERTV(expected, expected == format(VALUE));
+
+                const int INT_VALUE = static_cast<int>(VALUE);
+                ASSERTV(INT_VALUE,
+                        format(static_cast<Int64>(INT_VALUE)) ==
+                                                          format(INT_VALUE));
+
+                const long LONG_VALUE = static_cast<long>(VALUE);
+                ASSERTV(LONG_VALUE,
+                        format(static_cast<Int64>(LONG_VALUE)) ==
+                                                         format(LONG_VALUE));
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[k_BUFFER_SIZE];
+
+            ASSERT_FAIL(Util::formatDecimal(0,      Int64(-1)));
+            ASSERT_PASS(Util::formatDecimal(buffer, Int64(-1)));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a few values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        char buffer[k_BUFFER_SIZE];
+
+        int length = Util::formatDecimal(buffer, 42);
+        ASSERT("42" == bsl::string(buffer, length));
+
+        length = Util::formatDecimal(buffer, -7);
+        ASSERT("-7" == bsl::string(buffer, length));
+
+        length = Util::formatDecimal(buffer, 1234567890123ULL);
+        ASSERT("1234567890123" == bsl::string(buffer, length));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -11,9 +11,154 @@ BSLS_IDENT_RCSID(bdlc_packedintarray,"$Id$ $CSID$")
 #include <bslmf_assert.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+#define BDLC_PACKEDINTARRAY_X86_KERNELS 1
+#endif
+
+#ifdef BDLC_PACKEDINTARRAY_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace {
+
+#ifdef BDLC_PACKEDINTARRAY_X86_KERNELS
+
+                           // ------------------
+                           // AVX2 Widen Kernels
+                           // ------------------
+
+// Each kernel widens 32 bytes worth of destination elements per iteration,
+// loading just the source bytes needed with one of the following functions,
+// and finishes any remaining elements with a scalar loop.
+
+inline
+__m128i load32(const void *address)
+    // Return a vector whose low-order 4 bytes are loaded from the specified
+    // 'address'.
+{
+    int value;
+    bsl::memcpy(&value, address, sizeof value);
+    return _mm_cvtsi32_si128(value);
+}
+
+inline
+__m128i load64(const void *address)
+    // Return a vector whose low-order 8 bytes are loaded from the specified
+    // 'address'.
+{
+    return _mm_loadl_epi64(static_cast<const __m128i *>(address));
+}
+
+inline
+__m128i load128(const void *address)
+    // Return a vector loaded from the 16 bytes at the specified 'address'.
+{
+    return _mm_loadu_si128(static_cast<const __m128i *>(address));
+}
+
+#define BDLC_PACKEDINTARRAY_WIDEN_KERNEL(NAME, DST_TYPE, SRC_TYPE, LOAD, CVT) \
+    __attribute__((target("avx2")))                                           \
+    void NAME(DST_TYPE *dst, const SRC_TYPE *src, bsl::size_t numValues)      \
+    {                                                                         \
+        enum { k_STEP = 32 / sizeof(DST_TYPE) };                              \
+                                                                              \
+        bsl::size_t i = 0;                                                    \
+        for (; i + k_STEP <= numValues; i += k_STEP) {                        \
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i),         \
+                                CVT(LOAD(src + i)));                          \
+        }                                                                     \
+        for (; i < numValues; ++i) {                                          \
+            dst[i] = src[i];                                                  \
+        }                                                                     \
+    }
+
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::int16_t,  bsl::int8_t,
+                                 load128, _mm256_cvtepi8_epi16)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::int32_t,  bsl::int8_t,
+                                 load64,  _mm256_cvtepi8_epi32)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::int64_t,  bsl::int8_t,
+                                 load32,  _mm256_cvtepi8_epi64)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::int32_t,  bsl::int16_t,
+                                 load128, _mm256_cvtepi16_epi32)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::int64_t,  bsl::int16_t,
+                                 load64,  _mm256_cvtepi16_epi64)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::int64_t,  bsl::int32_t,
+                                 load128, _mm256_cvtepi32_epi64)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::uint16_t, bsl::uint8_t,
+                                 load128, _mm256_cvtepu8_epi16)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::uint32_t, bsl::uint8_t,
+                                 load64,  _mm256_cvtepu8_epi32)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::uint64_t, bsl::uint8_t,
+                                 load32,  _mm256_cvtepu8_epi64)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::uint32_t, bsl::uint16_t,
+                                 load128, _mm256_cvtepu16_epi32)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::uint64_t, bsl::uint16_t,
+                                 load64,  _mm256_cvtepu16_epi64)
+BDLC_PACKEDINTARRAY_WIDEN_KERNEL(widenAvx2, bsl::uint64_t, bsl::uint32_t,
+                                 load128, _mm256_cvtepu32_epi64)
+
+#undef BDLC_PACKEDINTARRAY_WIDEN_KERNEL
+
+enum {
+    k_MIN_KERNEL_VALUES = 32  // fewer values are widened by the scalar loop
+};
+
+BloombergLP::bsls::AtomicOperations::AtomicTypes::Int g_useAvx2 = { 0 };
+    // 0 if not yet determined, 1 if the AVX2 kernels are not supported, and 2
+    // if they are.
+
+bool useAvx2()
+    // Return 'true' if the processor supports the AVX2 kernels, and 'false'
+    // otherwise.
+{
+    using BloombergLP::bsls::AtomicOperations;
+
+    int state = AtomicOperations::getIntRelaxed(&g_useAvx2);
+    if (0 == state) {
+        // Concurrent initialization is benign: every thread stores the same
+        // value.
+
+        state = __builtin_cpu_supports("avx2") ? 2 : 1;
+        AtomicOperations::setIntRelaxed(&g_useAvx2, state);
+    }
+    return 2 == state;
+}
+
+#endif  // BDLC_PACKEDINTARRAY_X86_KERNELS
+
+template <class DST_TYPE, class SRC_TYPE>
+inline
+void widen(DST_TYPE *dst, const SRC_TYPE *src, bsl::size_t numValues)
+    // Assign to each of the specified 'numValues' elements of the specified
+    // 'dst' array the corresponding element of the specified 'src' array,
+    // using a vectorized kernel if one is supported and 'numValues' is large
+    // enough to benefit from it.  The behavior is undefined unless
+    // 'sizeof(DST_TYPE) > sizeof(SRC_TYPE)', both types have the same
+    // signedness, and the two arrays do not overlap.
+{
+#ifdef BDLC_PACKEDINTARRAY_X86_KERNELS
+    if (numValues >= k_MIN_KERNEL_VALUES && useAvx2()) {
+        widenAvx2(dst, src, numValues);
+        return;                                                       // RETURN
+    }
+#endif
+
+    BloombergLP::bdlc::PackedIntArrayImp_Util::copyValues<DST_TYPE, SRC_TYPE>(
+                                                                    dst,
+                                                                    src,
+                                                                    numValues);
+}
+
+}  // close unnamed namespace
 
 namespace BloombergLP {
 namespace bdlc {
@@ -75,6 +220,170 @@ int PackedIntArrayImp_Unsigned::
     return 1;                                                         // RETURN
 }
 
+                       // -----------------------------
+                       // struct PackedIntArrayImp_Util
+                       // -----------------------------
+
+// CLASS METHODS
+void PackedIntArrayImp_Util::copyValues(bsl::int16_t      *dst,
+                                        const bsl::int8_t *src,
+                                        bsl::size_t        numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::int32_t      *dst,
+                                        const bsl::int8_t *src,
+                                        bsl::size_t        numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::int64_t      *dst,
+                                        const bsl::int8_t *src,
+                                        bsl::size_t        numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::int32_t       *dst,
+                                        const bsl::int16_t *src,
+                                        bsl::size_t         numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::int64_t       *dst,
+                                        const bsl::int16_t *src,
+                                        bsl::size_t         numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::int64_t       *dst,
+                                        const bsl::int32_t *src,
+                                        bsl::size_t         numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::uint16_t      *dst,
+                                        const bsl::uint8_t *src,
+                                        bsl::size_t         numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::uint32_t      *dst,
+                                        const bsl::uint8_t *src,
+                                        bsl::size_t         numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::uint64_t      *dst,
+                                        const bsl::uint8_t *src,
+                                        bsl::size_t         numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::uint32_t       *dst,
+                                        const bsl::uint16_t *src,
+                                        bsl::size_t          numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::uint64_t       *dst,
+                                        const bsl::uint16_t *src,
+                                        bsl::size_t          numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::copyValues(bsl::uint64_t       *dst,
+                                        const bsl::uint32_t *src,
+                                        bsl::size_t          numValues)
+{
+    widen(dst, src, numValues);
+}
+
+void PackedIntArrayImp_Util::pack(bsl::uint64_t       *dst,
+                                  const bsl::uint64_t *src,
+                                  int                  numValues,
+                                  int                  width)
+{
+    BSLS_ASSERT(dst || 0 == numValues);
+    BSLS_ASSERT(src || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+    BSLS_ASSERT(     numValues <= k_VALUES_PER_BLOCK);
+    BSLS_ASSERT(0 <= width);
+    BSLS_ASSERT(     width     <= 64);
+
+    const int numWords = (numValues * width + 63) / 64;
+    bsl::memset(dst, 0, numWords * sizeof *dst);
+
+    if (0 == width) {
+        return;                                                       // RETURN
+    }
+
+    int bit = 0;
+    for (int i = 0; i < numValues; ++i, bit += width) {
+        const int word  = bit / 64;
+        const int shift = bit % 64;
+
+        dst[word] |= src[i] << shift;
+        if (shift + width > 64) {
+            dst[word + 1] |= src[i] >> (64 - shift);
+        }
+    }
+}
+
+int PackedIntArrayImp_Util::requiredWidth(bsl::uint64_t value)
+{
+    int width = 0;
+    while (value) {
+        ++width;
+        value >>= 1;
+    }
+    return width;
+}
+
+void PackedIntArrayImp_Util::unpack(bsl::uint64_t       *dst,
+                                    const bsl::uint64_t *src,
+                                    int                  numValues,
+                                    int                  width)
+{
+    BSLS_ASSERT(dst || 0 == numValues);
+    BSLS_ASSERT(src || 0 == numValues || 0 == width);
+    BSLS_ASSERT(0 <= numValues);
+    BSLS_ASSERT(     numValues <= k_VALUES_PER_BLOCK);
+    BSLS_ASSERT(0 <= width);
+    BSLS_ASSERT(     width     <= 64);
+
+    if (0 == width) {
+        bsl::memset(dst, 0, numValues * sizeof *dst);
+        return;                                                       // RETURN
+    }
+
+    const bsl::uint64_t mask = 64 == width
+                               ? ~static_cast<bsl::uint64_t>(0)
+                               : (static_cast<bsl::uint64_t>(1) << width) - 1;
+
+    int bit = 0;
+    for (int i = 0; i < numValues; ++i, bit += width) {
+        const int word  = bit / 64;
+        const int shift = bit % 64;
+
+        bsl::uint64_t value = src[word] >> shift;
+        if (shift + width > 64) {
+            value |= src[word + 1] << (64 - shift);
+        }
+        dst[i] = value & mask;
+    }
+}
+
                           // ------------------------
                           // struct PackedIntArrayImp
                           // ------------------------
@@ -93,25 +402,42 @@ void PackedIntArrayImp<STORAGE>::expandImp(int         requiredBytesPerElement,
 
     // Allocate new memory.
 
-    void *src = d_storage_p;
-    d_storage_p = d_allocator_p->allocate(requiredCapacityInBytes);
-    d_capacityInBytes = requiredCapacityInBytes;
+    void *dst = d_allocator_p->allocate(requiredCapacityInBytes);
 
-    // Copy existing data.
+    // Copy existing data, widening each element.  Since the source and
+    // destination do not overlap, the elements are converted front to back
+    // in bulk.
 
-    int srcBytesPerElement = d_bytesPerElement;
-    d_bytesPerElement = requiredBytesPerElement;
-    replaceImp(d_storage_p,
-               0,
-               d_bytesPerElement,
-               src,
-               0,
-               srcBytesPerElement,
-               d_length);
+    switch (requiredBytesPerElement) {
+      case 2: {
+        getValues(static_cast<typename STORAGE::TwoByteStorageType *>(dst),
+                  0,
+                  d_length);
+      } break;
+      case 4: {
+        getValues(static_cast<typename STORAGE::FourByteStorageType *>(dst),
+                  0,
+                  d_length);
+      } break;
+      case 8: {
+        getValues(static_cast<typename STORAGE::EightByteStorageType *>(dst),
+                  0,
+                  d_length);
+      } break;
+      default: {
+        // Only the above values are valid so this case should never happen.
+
+        BSLS_ASSERT_OPT("Invalid value for 'requiredBytesPerElement'." && 0);
+      } break;
+    }
 
     // Deallocate original memory.
 
-    d_allocator_p->deallocate(src);
+    d_allocator_p->deallocate(d_storage_p);
+
+    d_storage_p       = dst;
+    d_capacityInBytes = requiredCapacityInBytes;
+    d_bytesPerElement = requiredBytesPerElement;
 }
 
 template <class STORAGE>
@@ -434,6 +760,54 @@ int PackedIntArrayImp<STORAGE>::
     return requiredBytesPerElement;
 }
 
+template <class STORAGE>
+void PackedIntArrayImp<STORAGE>::replaceImp(bsl::size_t        dstIndex,
+                                            const ElementType *values,
+                                            bsl::size_t        numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    // Assert 'dstIndex + numValues <= d_length' without risk of overflow.
+    BSLS_ASSERT(numValues <= d_length);
+    BSLS_ASSERT(dstIndex  <= d_length - numValues);
+
+    switch (d_bytesPerElement) {
+      case 1: {
+        PackedIntArrayImp_Util::copyValues(
+                   static_cast<typename STORAGE::OneByteStorageType *>
+                                                     (d_storage_p) + dstIndex,
+                   values,
+                   numValues);
+      } break;
+      case 2: {
+        PackedIntArrayImp_Util::copyValues(
+                   static_cast<typename STORAGE::TwoByteStorageType *>
+                                                     (d_storage_p) + dstIndex,
+                   values,
+                   numValues);
+      } break;
+      case 4: {
+        PackedIntArrayImp_Util::copyValues(
+                   static_cast<typename STORAGE::FourByteStorageType *>
+                                                     (d_storage_p) + dstIndex,
+                   values,
+                   numValues);
+      } break;
+      case 8: {
+        PackedIntArrayImp_Util::copyValues(
+                   static_cast<typename STORAGE::EightByteStorageType *>
+                                                     (d_storage_p) + dstIndex,
+                   values,
+                   numValues);
+      } break;
+      default: {
+        // Only the above values are valid so this case should never happen.
+
+        BSLS_ASSERT_OPT("Invalid value for 'd_bytesPerElement'." && 0);
+      } break;
+    }
+}
+
 // PRIVATE ACCESSORS
 template <class STORAGE>
 bool PackedIntArrayImp<STORAGE>::isEqualImp(
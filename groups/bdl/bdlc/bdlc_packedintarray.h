@@ -27,6 +27,37 @@ BSLS_IDENT("$Id: $")
 // individual elements by calling the indexing operator or via iterators.  Note
 // that iterators are *not* invalidated if an array object reallocates memory.
 //
+///Bulk Access
+///-----------
+// The 'getValues' method copies a contiguous range of elements into a buffer
+// supplied by the caller, converting from the internal representation one
+// block at a time rather than one element at a time.  On x86-64 platforms
+// whose processor supports AVX2 (detected at run time), the conversion of
+// narrow stored elements to wider elements -- used both by 'getValues' and
+// when the array must widen its internal representation to accommodate a
+// larger value -- is vectorized.
+//
+///BDEX Compact Format
+///-------------------
+// In addition to version 1 of the BDEX format, which writes every element
+// using the current number of bytes per element, this component supports a
+// compact version 2 format that bit-packs the elements.  The format stores a
+// base value and, for each element, its offset from the base using the
+// smallest number of bits that can represent every offset.  Two encodings
+// are considered and the smaller is written:
+//
+//: o *frame-of-reference*: the base is the smallest element, and each offset
+//:   is the difference between the element and the base.
+//:
+//: o *delta*: available only if the elements are non-decreasing, the base is
+//:   the first element, and each offset is the difference between the
+//:   element and its predecessor (the offset of the first element is 0).
+//
+// Sorted sequences such as timestamps or identifiers therefore typically
+// stream in a few bits per element.  'maxSupportedBdexVersion' returns 2 for
+// serialization versions (i.e., 'YYYYMMDD' dates) of '20261019' or later, and
+// 1 otherwise.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -371,6 +402,103 @@ struct PackedIntArrayImp_Unsigned {
         // Return the required number of bytes to store the specified 'value'.
 };
 
+                       // =============================
+                       // struct PackedIntArrayImp_Util
+                       // =============================
+
+struct PackedIntArrayImp_Util {
+    // This 'struct' provides a namespace for the bulk operations used to
+    // implement 'PackedIntArrayImp': converting a sequence of stored elements
+    // to a different width, and packing a block of values into (and unpacking
+    // it from) a sequence of fixed-width bit fields.  The conversions that
+    // widen signed or unsigned values are vectorized on platforms supporting
+    // it.  This struct is component-private.  Do not use.
+
+    // PUBLIC TYPES
+    enum { k_VALUES_PER_BLOCK = 64 };  // maximum number of values packed or
+                                       // unpacked by a single call
+
+    // CLASS METHODS
+    template <class DST_TYPE, class SRC_TYPE>
+    static void copyValues(DST_TYPE       *dst,
+                           const SRC_TYPE *src,
+                           bsl::size_t     numValues);
+        // Assign to each of the specified 'numValues' elements of the
+        // specified 'dst' array the corresponding element of the specified
+        // 'src' array converted to 'DST_TYPE'.  The behavior is undefined
+        // unless the two arrays do not overlap.
+
+    static void copyValues(bsl::int16_t       *dst,
+                           const bsl::int8_t  *src,
+                           bsl::size_t         numValues);
+    static void copyValues(bsl::int32_t       *dst,
+                           const bsl::int8_t  *src,
+                           bsl::size_t         numValues);
+    static void copyValues(bsl::int64_t       *dst,
+                           const bsl::int8_t  *src,
+                           bsl::size_t         numValues);
+    static void copyValues(bsl::int32_t       *dst,
+                           const bsl::int16_t *src,
+                           bsl::size_t         numValues);
+    static void copyValues(bsl::int64_t       *dst,
+                           const bsl::int16_t *src,
+                           bsl::size_t         numValues);
+    static void copyValues(bsl::int64_t       *dst,
+                           const bsl::int32_t *src,
+                           bsl::size_t         numValues);
+    static void copyValues(bsl::uint16_t       *dst,
+                           const bsl::uint8_t  *src,
+                           bsl::size_t          numValues);
+    static void copyValues(bsl::uint32_t       *dst,
+                           const bsl::uint8_t  *src,
+                           bsl::size_t          numValues);
+    static void copyValues(bsl::uint64_t       *dst,
+                           const bsl::uint8_t  *src,
+                           bsl::size_t          numValues);
+    static void copyValues(bsl::uint32_t       *dst,
+                           const bsl::uint16_t *src,
+                           bsl::size_t          numValues);
+    static void copyValues(bsl::uint64_t       *dst,
+                           const bsl::uint16_t *src,
+                           bsl::size_t          numValues);
+    static void copyValues(bsl::uint64_t       *dst,
+                           const bsl::uint32_t *src,
+                           bsl::size_t          numValues);
+        // Assign to each of the specified 'numValues' elements of the
+        // specified 'dst' array the corresponding element of the specified
+        // 'src' array, sign- or zero-extended to the wider type.  The behavior
+        // is undefined unless the two arrays do not overlap.
+
+    static void pack(bsl::uint64_t       *dst,
+                     const bsl::uint64_t *src,
+                     int                  numValues,
+                     int                  width);
+        // Store the low-order specified 'width' bits of each of the specified
+        // 'numValues' values of the specified 'src' array consecutively into
+        // the '(numValues * width + 63) / 64' words of the specified 'dst'
+        // array, beginning with the least-significant bit of 'dst[0]'; the
+        // bits of the last word beyond the last value are set to 0.  The
+        // behavior is undefined unless
+        // '0 <= numValues <= k_VALUES_PER_BLOCK', '0 <= width <= 64', and each
+        // value of 'src' is representable in 'width' bits.
+
+    static int requiredWidth(bsl::uint64_t value);
+        // Return the number of bits required to represent the specified
+        // 'value', i.e., 0 if 'value' is 0, and one more than the index of
+        // the most-significant set bit of 'value' otherwise.
+
+    static void unpack(bsl::uint64_t       *dst,
+                       const bsl::uint64_t *src,
+                       int                  numValues,
+                       int                  width);
+        // Load into each of the specified 'numValues' elements of the
+        // specified 'dst' array the corresponding field of the specified
+        // 'width' bits stored in the specified 'src' array in the format
+        // written by 'pack'.  The behavior is undefined unless
+        // '0 <= numValues <= k_VALUES_PER_BLOCK', '0 <= width <= 64', and
+        // 'src' has at least '(numValues * width + 63) / 64' words.
+};
+
                           // =======================
                           // class PackedIntArrayImp
                           // =======================
@@ -411,6 +539,14 @@ class PackedIntArrayImp {
         // the specified 'minValue', starting from the specified 'value'.
 
     // PRIVATE MANIPULATORS
+    template <class STREAM>
+    void bdexStreamInCompact(STREAM& stream);
+        // Assign to this array the value read from the specified input
+        // 'stream' in the compact (version 2) BDEX format.  If 'stream' is
+        // invalid or becomes invalid, or the data read is not a valid array
+        // value, 'stream' is invalidated and this array has an unspecified,
+        // but valid, value.
+
     void expandImp(int         requiredBytesPerElement,
                    bsl::size_t requiredCapacityInBytes);
         // Make the capacity of this array at least the specified
@@ -442,10 +578,25 @@ class PackedIntArrayImp {
         // ranges do not overlap or: 'dst == src' and 'dstIndex >= srcIndex'
         // and 'dstBytesPerElement > srcBytesPerElement'.
 
+    void replaceImp(bsl::size_t        dstIndex,
+                    const ElementType *values,
+                    bsl::size_t        numValues);
+        // Change the values of the specified 'numValues' elements in this
+        // array beginning at the specified 'dstIndex' to those of the
+        // corresponding elements of the specified 'values' array.  The
+        // behavior is undefined unless 'dstIndex + numValues <= length()' and
+        // the required bytes to store each of the 'values' is less than or
+        // equal to 'bytesPerElement()'.
+
     // PRIVATE ACCESSORS
     char *address() const;
         // Return the address of the storage as a 'char *'.
 
+    template <class STREAM>
+    void bdexStreamOutCompact(STREAM& stream) const;
+        // Write the value of this array to the specified output 'stream' in
+        // the compact (version 2) BDEX format.
+
     bool isEqualImp(const PackedIntArrayImp& other) const;
         // Return 'true' if this and the specified 'other' array have the same
         // value, and 'false' otherwise.  Two 'PackedIntArrayImp' arrays have
@@ -669,6 +820,16 @@ class PackedIntArrayImp {
         // Return the number of elements this array can hold in terms of the
         // current data type used to store its elements.
 
+    template <class TYPE>
+    void getValues(TYPE        *result,
+                   bsl::size_t  index,
+                   bsl::size_t  numElements) const;
+        // Load into the specified 'result' array the values of the specified
+        // 'numElements' elements of this array beginning at the specified
+        // 'index', converted to 'TYPE'.  The behavior is undefined unless
+        // 'index + numElements <= length()' and 'result' has room for
+        // 'numElements' values that do not overlap this array.
+
     bool isEmpty() const;
         // Return 'true' if there are no elements in this array, and 'false'
         // otherwise.
@@ -1270,6 +1431,17 @@ class PackedIntArray {
         //    operator[](0)
         //..
 
+    void getValues(TYPE        *result,
+                   bsl::size_t  index,
+                   bsl::size_t  numElements) const;
+        // Load into the specified 'result' array the values of the specified
+        // 'numElements' elements of this array beginning at the specified
+        // 'index'.  The behavior is undefined unless
+        // 'index + numElements <= length()' and 'result' has room for
+        // 'numElements' values.  Note that this method is typically much
+        // faster than accessing each element through 'operator[]' or an
+        // iterator.
+
     bool isEmpty() const;
         // Return 'true' if there are no elements in this array, and 'false'
         // otherwise.
@@ -1466,6 +1638,22 @@ void PackedIntArrayImp_Unsigned::bdexPut64(STREAM& stream, bsl::uint64_t value)
     stream.putUint64(static_cast<bsls::Types::Uint64>(value));
 }
 
+                       // -----------------------------
+                       // struct PackedIntArrayImp_Util
+                       // -----------------------------
+
+// CLASS METHODS
+template <class DST_TYPE, class SRC_TYPE>
+inline
+void PackedIntArrayImp_Util::copyValues(DST_TYPE       *dst,
+                                        const SRC_TYPE *src,
+                                        bsl::size_t     numValues)
+{
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        dst[i] = static_cast<DST_TYPE>(src[i]);
+    }
+}
+
                           // ------------------------
                           // struct PackedIntArrayImp
                           // ------------------------
@@ -1492,6 +1680,111 @@ bsl::size_t PackedIntArrayImp<STORAGE>::nextCapacityGE(bsl::size_t minValue,
     return value;
 }
 
+// PRIVATE MANIPULATORS
+template <class STORAGE>
+template <class STREAM>
+void PackedIntArrayImp<STORAGE>::bdexStreamInCompact(STREAM& stream)
+{
+    enum { k_BLOCK = PackedIntArrayImp_Util::k_VALUES_PER_BLOCK };
+
+    typedef bsl::uint64_t Uint64;
+
+    int         tmpBytesPerElement;
+    int         tmpLength;
+    int         encoding;
+    ElementType base;
+    int         width;
+    {
+        char v;
+        stream.getInt8(v);
+        tmpBytesPerElement = static_cast<int>(v);
+    }
+    stream.getLength(tmpLength);
+    {
+        char v;
+        stream.getInt8(v);
+        encoding = static_cast<int>(v);
+    }
+    STORAGE::bdexGet64(stream, base);
+    {
+        char v;
+        stream.getInt8(v);
+        width = static_cast<int>(v);
+    }
+
+    if (!stream) {
+        return;                                                       // RETURN
+    }
+
+    if (   (   1 != tmpBytesPerElement
+            && 2 != tmpBytesPerElement
+            && 4 != tmpBytesPerElement
+            && 8 != tmpBytesPerElement)
+        || (0 != encoding && 1 != encoding)
+        || 0 > width
+        || 64 < width) {
+        stream.invalidate();
+        return;                                                       // RETURN
+    }
+
+    bsl::size_t numBytes = tmpBytesPerElement * tmpLength;
+    if (numBytes > d_capacityInBytes) {
+        bsl::size_t requiredCapacityInBytes =
+                                   nextCapacityGE(numBytes, d_capacityInBytes);
+
+        void *dst = d_allocator_p->allocate(requiredCapacityInBytes);
+        d_allocator_p->deallocate(d_storage_p);
+
+        d_storage_p       = dst;
+        d_capacityInBytes = requiredCapacityInBytes;
+    }
+
+    d_bytesPerElement = tmpBytesPerElement;
+    d_length          = tmpLength;
+
+    // Decode the elements one block at a time, verifying that each fits in
+    // the stated number of bytes per element.
+
+    ElementType values[k_BLOCK];
+    Uint64      offsets[k_BLOCK];
+    Uint64      words[k_BLOCK];
+
+    ElementType previous = base;
+    for (bsl::size_t i = 0; i < d_length; i += k_BLOCK) {
+        const int numValues = d_length - i < k_BLOCK
+                              ? static_cast<int>(d_length - i)
+                              : k_BLOCK;
+
+        const int numWords = (numValues * width + 63) / 64;
+        for (int k = 0; k < numWords; ++k) {
+            bsls::Types::Uint64 v;
+            stream.getUint64(v);
+            words[k] = static_cast<Uint64>(v);
+        }
+        if (!stream) {
+            removeAll();
+            return;                                                   // RETURN
+        }
+
+        PackedIntArrayImp_Util::unpack(offsets, words, numValues, width);
+        for (int j = 0; j < numValues; ++j) {
+            const ElementType from  = encoding ? previous : base;
+            const ElementType value = static_cast<ElementType>(
+                                   static_cast<Uint64>(from) + offsets[j]);
+
+            if (STORAGE::requiredBytesPerElement(value) > d_bytesPerElement) {
+                stream.invalidate();
+                removeAll();
+                return;                                               // RETURN
+            }
+            values[j] = value;
+            previous  = value;
+        }
+
+        replaceImp(i, values, numValues);
+    }
+}
+
 // PRIVATE ACCESSORS
 template <class STORAGE>
 inline
@@ -1500,11 +1793,105 @@ char *PackedIntArrayImp<STORAGE>::address() const
     return static_cast<char *>(d_storage_p);
 }
 
+template <class STORAGE>
+template <class STREAM>
+void PackedIntArrayImp<STORAGE>::bdexStreamOutCompact(STREAM& stream) const
+{
+    enum { k_BLOCK = PackedIntArrayImp_Util::k_VALUES_PER_BLOCK };
+
+    typedef bsl::uint64_t Uint64;
+
+    ElementType values[k_BLOCK];
+    Uint64      offsets[k_BLOCK];
+    Uint64      words[k_BLOCK];
+
+    // Determine the range of the elements and, if they are non-decreasing,
+    // the largest difference between consecutive elements.
+
+    const ElementType first    = d_length ? (*this)[0] : 0;
+    ElementType       minValue = first;
+    ElementType       maxValue = first;
+    ElementType       previous = first;
+    Uint64            maxDelta = 0;
+    bool              isSorted = true;
+
+    for (bsl::size_t i = 0; i < d_length; i += k_BLOCK) {
+        const int numValues = d_length - i < k_BLOCK
+                              ? static_cast<int>(d_length - i)
+                              : k_BLOCK;
+
+        getValues(values, i, numValues);
+        for (int j = 0; j < numValues; ++j) {
+            const ElementType value = values[j];
+            if (value < minValue) {
+                minValue = value;
+            }
+            if (value > maxValue) {
+                maxValue = value;
+            }
+            if (value < previous) {
+                isSorted = false;
+            }
+            else {
+                const Uint64 delta = static_cast<Uint64>(value)
+                                               - static_cast<Uint64>(previous);
+                if (delta > maxDelta) {
+                    maxDelta = delta;
+                }
+            }
+            previous = value;
+        }
+    }
+
+    const Uint64 range = static_cast<Uint64>(maxValue)
+                                               - static_cast<Uint64>(minValue);
+
+    const int rangeWidth = PackedIntArrayImp_Util::requiredWidth(range);
+    const int deltaWidth = PackedIntArrayImp_Util::requiredWidth(maxDelta);
+
+    const bool        isDelta = isSorted && deltaWidth < rangeWidth;
+    const int         width   = isDelta ? deltaWidth : rangeWidth;
+    const ElementType base    = isDelta ? first : minValue;
+
+    stream.putInt8(d_bytesPerElement);
+    stream.putLength(static_cast<int>(d_length));
+    stream.putInt8(isDelta ? 1 : 0);
+    STORAGE::bdexPut64(stream, base);
+    stream.putInt8(width);
+
+    previous = base;
+    for (bsl::size_t i = 0; i < d_length; i += k_BLOCK) {
+        const int numValues = d_length - i < k_BLOCK
+                              ? static_cast<int>(d_length - i)
+                              : k_BLOCK;
+
+        getValues(values, i, numValues);
+        for (int j = 0; j < numValues; ++j) {
+            const ElementType from = isDelta ? previous : base;
+
+            offsets[j] = static_cast<Uint64>(values[j])
+                                                   - static_cast<Uint64>(from);
+            previous   = values[j];
+        }
+
+        PackedIntArrayImp_Util::pack(words, offsets, numValues, width);
+
+        const int numWords = (numValues * width + 63) / 64;
+        for (int k = 0; k < numWords; ++k) {
+            stream.putUint64(words[k]);
+        }
+    }
+}
+
 // CLASS METHODS
 template <class STORAGE>
 inline
-int PackedIntArrayImp<STORAGE>::maxSupportedBdexVersion(int)
+int PackedIntArrayImp<STORAGE>::maxSupportedBdexVersion(
+                                                      int serializationVersion)
 {
+    if (serializationVersion >= 20261019) {
+        return 2;                                                     // RETURN
+    }
     return 1;
 }
 
@@ -1610,6 +1997,9 @@ STREAM& PackedIntArrayImp<STORAGE>::bdexStreamIn(STREAM& stream, int version)
                 }
             }
           } break;
+          case 2: {
+            bdexStreamInCompact(stream);
+          } break;
           default: {
             stream.invalidate();  // unrecognized version number
           }
@@ -1847,6 +2237,9 @@ STREAM& PackedIntArrayImp<STORAGE>::bdexStreamOut(STREAM& stream,
               } break;
             }
           } break;
+          case 2: {
+            bdexStreamOutCompact(stream);
+          } break;
           default: {
             stream.invalidate();  // unrecognized version number
           }
@@ -1867,6 +2260,56 @@ bsl::size_t PackedIntArrayImp<STORAGE>::capacity() const {
     return d_capacityInBytes / d_bytesPerElement;
 }
 
+template <class STORAGE>
+template <class TYPE>
+inline
+void PackedIntArrayImp<STORAGE>::getValues(TYPE        *result,
+                                           bsl::size_t  index,
+                                           bsl::size_t  numElements) const
+{
+    BSLS_ASSERT_SAFE(result || 0 == numElements);
+
+    // Assert 'index + numElements <= d_length' without risk of overflow.
+    BSLS_ASSERT_SAFE(numElements <= d_length);
+    BSLS_ASSERT_SAFE(index       <= d_length - numElements);
+
+    switch (d_bytesPerElement) {
+      case 1: {
+        PackedIntArrayImp_Util::copyValues(
+                  result,
+                  static_cast<const typename STORAGE::OneByteStorageType *>
+                                                        (d_storage_p) + index,
+                  numElements);
+      } break;
+      case 2: {
+        PackedIntArrayImp_Util::copyValues(
+                  result,
+                  static_cast<const typename STORAGE::TwoByteStorageType *>
+                                                        (d_storage_p) + index,
+                  numElements);
+      } break;
+      case 4: {
+        PackedIntArrayImp_Util::copyValues(
+                  result,
+                  static_cast<const typename STORAGE::FourByteStorageType *>
+                                                        (d_storage_p) + index,
+                  numElements);
+      } break;
+      case 8: {
+        PackedIntArrayImp_Util::copyValues(
+                  result,
+                  static_cast<const typename STORAGE::EightByteStorageType *>
+                                                        (d_storage_p) + index,
+                  numElements);
+      } break;
+      default: {
+        // Only the above values are valid so this case should never happen.
+
+        BSLS_ASSERT_OPT("Invalid value for 'd_bytesPerElement'." && 0);
+      } break;
+    }
+}
+
 template <class STORAGE>
 inline
 bool PackedIntArrayImp<STORAGE>::isEmpty() const {
@@ -2516,6 +2959,15 @@ TYPE PackedIntArray<TYPE>::front() const
     return static_cast<TYPE>(d_imp[0]);
 }
 
+template <class TYPE>
+inline
+void PackedIntArray<TYPE>::getValues(TYPE        *result,
+                                     bsl::size_t  index,
+                                     bsl::size_t  numElements) const
+{
+    d_imp.getValues(result, index, numElements);
+}
+
 template <class TYPE>
 inline
 bool PackedIntArray<TYPE>::isEmpty() const
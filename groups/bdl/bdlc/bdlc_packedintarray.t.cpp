@@ -11,6 +11,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bslx_byteinstream.h>
@@ -21,6 +22,7 @@
 #include <bslx_testinstreamexception.h>
 #include <bslx_testoutstream.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
@@ -28,6 +30,7 @@
 #include <bsl_map.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_cstdint.h>
 #include <bsl_utility.h>
@@ -145,6 +148,7 @@ using namespace bsl;
 // [ 4] bsl::size_t capacity() const;
 // [20] PackedIntArrayConstIterator end() const;
 // [19] TYPE front() const;
+// [26] void getValues(TYPE *result, bsl::size_t index, ne) const;
 // [ 4] bool isEmpty() const;
 // [ 6] bool isEqual(const PackedIntArray& other) const;
 // [ 4] bsl::size_t length() const;
@@ -155,13 +159,15 @@ using namespace bsl;
 // [11] void swap(PackedIntArray& a, PackedIntArray& b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] UnsignedObj& gg(UnsignedObj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 3] int ggg(UnsignedObj *object, const char *spec);
 // [ 8] PackedIntArray g(const char *spec);
 // [23] CONCERN: iterators remain valid over modifications
+// [26] CONCERN: widening the representation preserves element values
+// [27] CONCERN: BDEX version 2 round-trips every value compactly
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -572,6 +578,164 @@ OBJ& gg(OBJ *object, const char *spec)
     return *object;
 }
 
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class TYPE>
+TYPE randomValue(unsigned int *state, int numBytes)
+    // Return a pseudo-random value of the specified 'TYPE' that is
+    // representable in the specified 'numBytes' bytes, and advance the
+    // specified 'state' of the generator.  The behavior is undefined unless
+    // '1 <= numBytes <= sizeof(TYPE)'.
+{
+    bsl::uint64_t bits = 0;
+    for (int i = 0; i < 4; ++i) {
+        *state = *state * 1103515245u + 12345u;
+        bits   = (bits << 16) | (*state >> 16);
+    }
+
+    const int shift = 64 - 8 * numBytes;
+    return bsl::numeric_limits<TYPE>::is_signed
+           ? static_cast<TYPE>(static_cast<bsl::int64_t>(bits) >> shift)
+           : static_cast<TYPE>(bits >> shift);
+}
+
+template <class TYPE>
+TYPE maxValue(int numBytes)
+    // Return the largest value of the specified 'TYPE' that is representable
+    // in the specified 'numBytes' bytes.  The behavior is undefined unless
+    // '1 <= numBytes <= sizeof(TYPE)'.
+{
+    return static_cast<TYPE>(bsl::numeric_limits<TYPE>::max()
+                                       >> (8 * (sizeof(TYPE) - numBytes)));
+}
+
+template <class TYPE>
+void testGetValuesAndWidening(int numBytes, bsl::size_t length)
+    // Verify 'getValues', and the widening of the representation, of a
+    // 'bdlc::PackedIntArray<TYPE>' having the specified 'length' elements
+    // stored using the specified 'numBytes' bytes per element.
+{
+    typedef bdlc::PackedIntArray<TYPE> Array;
+
+    const TYPE SENTINEL = static_cast<TYPE>(0x5a);
+
+    bslma::TestAllocator oa("object");
+
+    unsigned int      state = static_cast<unsigned int>(length * 8 + numBytes);
+    bsl::vector<TYPE> expected(&oa);
+
+    Array mX(&oa);  const Array& X = mX;
+    for (bsl::size_t i = 0; i < length; ++i) {
+        const TYPE value = 0 == i ? maxValue<TYPE>(numBytes)
+                                  : randomValue<TYPE>(&state, numBytes);
+        mX.append(value);
+        expected.push_back(value);
+    }
+    if (length) {
+        ASSERTV(numBytes, length, numBytes == X.bytesPerElement());
+    }
+
+    // Load a variety of ranges between two sentinel elements.
+
+    bsl::vector<TYPE> buffer(length + 2, SENTINEL, &oa);
+
+    const bsl::size_t INDICES[]   = { 0, 1, 3, 33 };
+    const int         NUM_INDICES = static_cast<int>(sizeof INDICES
+                                                     / sizeof *INDICES);
+
+    for (int ti = 0; ti < NUM_INDICES; ++ti) {
+        const bsl::size_t INDEX = INDICES[ti];
+        if (INDEX > length) {
+            continue;
+        }
+
+        const bsl::size_t COUNTS[] = { length - INDEX, (length - INDEX) / 2 };
+
+        for (int tj = 0; tj < 2; ++tj) {
+            const bsl::size_t NE = COUNTS[tj];
+
+            bsl::fill(buffer.begin(), buffer.end(), SENTINEL);
+            X.getValues(&buffer[1], INDEX, NE);
+
+            ASSERTV(numBytes, length, INDEX, NE, SENTINEL == buffer[0]);
+            ASSERTV(numBytes, length, INDEX, NE, SENTINEL == buffer[NE + 1]);
+            for (bsl::size_t k = 0; k < NE; ++k) {
+                ASSERTV(numBytes, length, INDEX, k,
+                        expected[INDEX + k] == buffer[k + 1]);
+            }
+        }
+    }
+
+    // Widen the representation to each larger number of bytes per element.
+
+    for (int bytes = 2 * numBytes;
+         bytes <= static_cast<int>(sizeof(TYPE));
+         bytes *= 2) {
+        Array mY(&oa);  const Array& Y = mY;
+        for (bsl::size_t i = 0; i < length; ++i) {
+            mY.append(expected[i]);
+        }
+
+        const TYPE VALUE = maxValue<TYPE>(bytes);
+        mY.append(VALUE);
+
+        ASSERTV(numBytes, length, bytes, bytes == Y.bytesPerElement());
+        ASSERTV(numBytes, length, bytes, length + 1 == Y.length());
+        ASSERTV(numBytes, length, bytes, VALUE == Y[length]);
+        for (bsl::size_t i = 0; i < length; ++i) {
+            ASSERTV(numBytes, length, bytes, i, expected[i] == Y[i]);
+        }
+    }
+}
+
+template <class TYPE>
+void testCompactFormat(int                      line,
+                       const bsl::vector<TYPE>& values,
+                       bool                     veryVerbose,
+                       bool                     veryVeryVerbose)
+    // Verify, using the specified 'line' to report errors, that a
+    // 'bdlc::PackedIntArray<TYPE>' having the specified 'values' is
+    // externalized in the compact (version 2) BDEX format and unexternalized
+    // to an array having the same value and bytes per element, including in
+    // the presence of exceptions.  Report progress of the exception test
+    // according to the specified 'veryVerbose' and 'veryVeryVerbose' flags.
+{
+    typedef bdlc::PackedIntArray<TYPE> Array;
+
+    Array mX;  const Array& X = mX;
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        mX.append(values[i]);
+    }
+
+    Out out(SERIALIZATION_VERSION);
+    ASSERTV(line, &out == &X.bdexStreamOut(out, 2));
+    ASSERTV(line, out);
+
+    const char *const OD  = out.data();
+    const bsl::size_t LOD = out.length();
+
+    In in(OD, LOD);
+    ASSERTV(line, in);
+    ASSERTV(line, !in.isEmpty());
+
+    BSLX_TESTINSTREAM_EXCEPTION_TEST_BEGIN(in) {
+        in.reset();
+
+        Array mT;  const Array& T = mT;
+        mT.append(bsl::numeric_limits<TYPE>::max());
+        mT.append(static_cast<TYPE>(7));
+
+        ASSERTV(line, &in == &mT.bdexStreamIn(in, 2));
+        ASSERTV(line, X == T);
+        ASSERTV(line, X.bytesPerElement() == T.bytesPerElement());
+    } BSLX_TESTINSTREAM_EXCEPTION_TEST_END
+
+    ASSERTV(line, in);
+    ASSERTV(line, in.isEmpty());
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -595,7 +759,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -666,6 +830,351 @@ int main(int argc, char *argv[])
     ASSERT(                                   24 == nyc.length());
 //..
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING BDEX COMPACT FORMAT
+        //   Version 2 of the BDEX format bit-packs the elements as offsets
+        //   from a base value.
+        //
+        // Concerns:
+        //: 1 Arrays of every length and value range, including the extreme
+        //:   values of the element type, round-trip through the version 2
+        //:   format, preserving the bytes per element.
+        //:
+        //: 2 Non-decreasing sequences whose consecutive differences are
+        //:   smaller than their range use the delta encoding, and other
+        //:   sequences use the frame-of-reference encoding, each with the
+        //:   smallest possible number of bits per element.
+        //:
+        //: 3 The version 2 format of a sorted sequence with small consecutive
+        //:   differences is much smaller than the version 1 format.
+        //:
+        //: 4 Unexternalization is exception neutral.
+        //:
+        //: 5 Invalid or truncated data invalidates the stream.
+        //
+        // Plan:
+        //: 1 Using a helper, externalize in the version 2 format signed and
+        //:   unsigned arrays having a variety of values, and unexternalize
+        //:   them, using the 'BSLX_TESTINSTREAM_EXCEPTION_TEST_*' macros,
+        //:   into arrays having a different value.  (C-1, 4)
+        //:
+        //: 2 For a set of sequences, decode the header of the version 2 format
+        //:   and verify the encoding, base, and width.  (C-2)
+        //:
+        //: 3 Compare the lengths of the version 1 and version 2 formats of a
+        //:   sequence of timestamps written to a 'bslx::ByteOutStream'.  (C-3)
+        //:
+        //: 4 Unexternalize data having an invalid field, a value that does
+        //:   not fit the stated bytes per element, or a truncated payload, and
+        //:   verify that the stream is invalidated.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: BDEX version 2 round-trips every value compactly
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BDEX COMPACT FORMAT" << endl
+                          << "===========================" << endl;
+
+        const bsl::size_t LENGTHS[]   = { 0, 1, 2, 3, 63, 64, 65, 130, 1000 };
+        const int         NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                         / sizeof *LENGTHS);
+
+        if (verbose) cout << "\nRound-trip pseudo-random and sorted arrays."
+                          << endl;
+        {
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const bsl::size_t LENGTH = LENGTHS[ti];
+
+                for (int numBytes = 1; numBytes <= 8; numBytes *= 2) {
+                    unsigned int state = static_cast<unsigned int>(ti);
+
+                    bsl::vector<Element>         values;
+                    bsl::vector<UnsignedElement> unsignedValues;
+                    for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                        values.push_back(
+                                     randomValue<Element>(&state, numBytes));
+                        unsignedValues.push_back(
+                             randomValue<UnsignedElement>(&state, numBytes));
+                    }
+                    testCompactFormat(L_, values,
+                                      veryVerbose, veryVeryVerbose);
+                    testCompactFormat(L_, unsignedValues,
+                                      veryVerbose, veryVeryVerbose);
+
+                    bsl::sort(values.begin(), values.end());
+                    bsl::sort(unsignedValues.begin(), unsignedValues.end());
+                    testCompactFormat(L_, values,
+                                      veryVerbose, veryVeryVerbose);
+                    testCompactFormat(L_, unsignedValues,
+                                      veryVerbose, veryVeryVerbose);
+                }
+            }
+
+            bsl::vector<Element> values;
+            values.push_back(k_INT64_MIN);
+            values.push_back(k_INT64_MAX);
+            values.push_back(0);
+            values.push_back(-1);
+            testCompactFormat(L_, values, veryVerbose, veryVeryVerbose);
+
+            bsl::vector<UnsignedElement> unsignedValues;
+            unsignedValues.push_back(k_UINT64_MAX);
+            unsignedValues.push_back(0);
+            unsignedValues.push_back(k_UINT32_MAX);
+            testCompactFormat(L_, unsignedValues,
+                              veryVerbose, veryVeryVerbose);
+
+            bsl::vector<int> intValues;
+            for (int i = 0; i < 100; ++i) {
+                intValues.push_back(i * i - 5000);
+            }
+            testCompactFormat(L_, intValues, veryVerbose, veryVeryVerbose);
+        }
+
+        if (verbose) cout << "\nVerify the encoding chosen." << endl;
+        {
+            static const struct {
+                int          d_line;      // source line number
+                const char  *d_spec;      // specification of the array
+                int          d_encoding;  // expected encoding
+                Element      d_base;      // expected base
+                int          d_width;     // expected bits per element
+            } DATA[] = {
+                //LINE  SPEC     ENC  BASE          WIDTH
+                //----  -------  ---  ------------  -----
+                { L_,   "",        0,            0,     0 },
+                { L_,   "z",       0,            0,     0 },
+                { L_,   "OOOO",    0,            1,     0 },
+                { L_,   "zO",      0,            0,     1 },
+                { L_,   "ozOO",    1,           -1,     1 },
+                { L_,   "OzoO",    0,           -1,     2 },
+                { L_,   "cC",      0,   k_INT8_MIN,     8 },
+                { L_,   "ozOSS",   1,           -1,    15 },
+                { L_,   "Lz",      0,            0,    63 },
+                { L_,   "lL",      0,  k_INT64_MIN,    64 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const char *const SPEC     = DATA[ti].d_spec;
+                const int         ENCODING = DATA[ti].d_encoding;
+                const Element     BASE     = DATA[ti].d_base;
+                const int         WIDTH    = DATA[ti].d_width;
+
+                Obj        mX;
+                const Obj& X = gg(&mX, SPEC);
+
+                Out out(SERIALIZATION_VERSION);
+                X.bdexStreamOut(out, 2);
+
+                In in(out.data(), out.length());
+
+                char                bytesPerElement;
+                int                 length;
+                char                encoding;
+                bsls::Types::Int64  base;
+                char                width;
+
+                in.getInt8(bytesPerElement);
+                in.getLength(length);
+                in.getInt8(encoding);
+                in.getInt64(base);
+                in.getInt8(width);
+
+                ASSERTV(LINE, in);
+                ASSERTV(LINE, X.bytesPerElement() == bytesPerElement);
+                ASSERTV(LINE, static_cast<int>(X.length()) == length);
+                ASSERTV(LINE, ENCODING, encoding, ENCODING == encoding);
+                ASSERTV(LINE, BASE,     base,     BASE     == base);
+                ASSERTV(LINE, WIDTH,    width,    WIDTH    == width);
+            }
+        }
+
+        if (verbose) cout << "\nCompare the size of the formats." << endl;
+        {
+            const Element START = 1475280000000LL;  // milliseconds since 1970
+
+            Obj mX;  const Obj& X = mX;
+            for (int i = 0; i < 1000; ++i) {
+                mX.append(START + i * 1000 + i % 7);
+            }
+
+            bslx::ByteOutStream out1(SERIALIZATION_VERSION);
+            bslx::ByteOutStream out2(SERIALIZATION_VERSION);
+            X.bdexStreamOut(out1, 1);
+            X.bdexStreamOut(out2, 2);
+
+            if (veryVerbose) {
+                T_ P_(out1.length()) P(out2.length())
+            }
+
+            // The deltas require 10 bits, so the 1000 deltas fit in 157
+            // words.
+
+            ASSERTV(out1.length(), out2.length(),
+                    out2.length() * 6 < out1.length());
+
+            bslx::ByteInStream in(out2.data(), out2.length());
+            Obj                mT;
+            mT.bdexStreamIn(in, 2);
+            ASSERT(in);
+            ASSERT(X == mT);
+        }
+
+        if (verbose) cout << "\nUnexternalize invalid data." << endl;
+        {
+            static const struct {
+                int     d_line;             // source line number
+                int     d_bytesPerElement;  // bytes per element field
+                int     d_length;           // length field
+                int     d_encoding;         // encoding field
+                int     d_width;            // width field
+                int     d_numWords;         // number of words to write
+                Element d_word;             // value of each word
+                bool    d_isValid;          // expected validity of stream
+            } DATA[] = {
+                //LINE  BPE  LEN  ENC  WIDTH  WORDS    WORD  VALID
+                //----  ---  ---  ---  -----  -----  ------  -----
+                { L_,     1,   2,   0,     8,     1,    257,  true  },
+                { L_,     3,   2,   0,     8,     1,    257,  false },
+                { L_,     1,   2,   2,     8,     1,    257,  false },
+                { L_,     1,   2,   0,    65,     1,    257,  false },
+                { L_,     1,   2,   0,    -1,     1,    257,  false },
+                { L_,     1,   2,   0,     9,     1,    300,  false },
+                { L_,     2,   2,   0,     9,     1,    300,  true  },
+                { L_,     1,   2,   0,     8,     1, 0x7f7f,  true  },
+                { L_,     1,   2,   1,     8,     1, 0x7f7f,  false },
+                { L_,     1,   2,   0,     8,     0,    257,  false },
+                { L_,     1, 100,   0,    64,    99,      0,  false },
+                { L_,     1, 100,   0,    64,   100,      0,  true  },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int     LINE      = DATA[ti].d_line;
+                const int     BPE       = DATA[ti].d_bytesPerElement;
+                const int     LENGTH    = DATA[ti].d_length;
+                const int     ENCODING  = DATA[ti].d_encoding;
+                const int     WIDTH     = DATA[ti].d_width;
+                const int     NUM_WORDS = DATA[ti].d_numWords;
+                const Element WORD      = DATA[ti].d_word;
+                const bool    IS_VALID  = DATA[ti].d_isValid;
+
+                Out out(SERIALIZATION_VERSION);
+                out.putInt8(BPE);
+                out.putLength(LENGTH);
+                out.putInt8(ENCODING);
+                out.putInt64(0);
+                out.putInt8(WIDTH);
+                for (int k = 0; k < NUM_WORDS; ++k) {
+                    out.putUint64(WORD);
+                }
+
+                In  in(out.data(), out.length());
+                Obj mT;  const Obj& T = mT;
+                mT.bdexStreamIn(in, 2);
+
+                ASSERTV(LINE, IS_VALID == static_cast<bool>(in));
+                if (IS_VALID) {
+                    ASSERTV(LINE, BPE == T.bytesPerElement());
+                    ASSERTV(LINE, static_cast<bsl::size_t>(LENGTH)
+                                                                == T.length());
+                }
+            }
+        }
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'getValues' AND WIDENING
+        //   The bulk accessor loads the values of a range of elements for
+        //   every internal representation, and widening the representation
+        //   preserves the values of the elements.
+        //
+        // Concerns:
+        //: 1 'getValues' loads the values of the requested range of elements,
+        //:   for every number of bytes per element, into a buffer of the
+        //:   array's 'TYPE'.
+        //:
+        //: 2 'getValues' writes only the requested range of the buffer, for
+        //:   lengths both shorter than and not a multiple of the width of the
+        //:   vectorized conversion.
+        //:
+        //: 3 When a larger value is added, the existing elements are widened
+        //:   to each larger number of bytes per element without changing
+        //:   their values, in both signed and unsigned arrays.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a helper, for a set of lengths spanning the thresholds of
+        //:   the vectorized conversions and for each number of bytes per
+        //:   element, create arrays of pseudo-random values of several
+        //:   'TYPE's and compare the values loaded by 'getValues' for a
+        //:   variety of ranges with the values appended, verifying that the
+        //:   sentinel elements surrounding each range are unchanged.
+        //:   (C-1..2)
+        //:
+        //: 2 For each such array, append a value requiring each larger number
+        //:   of bytes per element, and verify that 'bytesPerElement' has
+        //:   increased and that every element retains its value.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid ranges (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   void getValues(TYPE *result, bsl::size_t index, ne) const;
+        //   CONCERN: widening the representation preserves element values
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'getValues' AND WIDENING" << endl
+                          << "================================" << endl;
+
+        const bsl::size_t LENGTHS[] = { 0, 1, 2, 3, 7, 15, 16, 17, 31, 32, 33,
+                                        63, 64, 65, 100, 257 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            if (veryVerbose) { T_ P(LENGTH) }
+
+            for (int numBytes = 1; numBytes <= 8; numBytes *= 2) {
+                testGetValuesAndWidening<Element>(numBytes, LENGTH);
+                testGetValuesAndWidening<UnsignedElement>(numBytes, LENGTH);
+                if (numBytes <= 4) {
+                    testGetValuesAndWidening<int>(numBytes, LENGTH);
+                    testGetValuesAndWidening<unsigned int>(numBytes, LENGTH);
+                }
+                if (numBytes <= 2) {
+                    testGetValuesAndWidening<short>(numBytes, LENGTH);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard
+                                          hG(bsls::AssertTest::failTestDriver);
+
+            Obj mX;  const Obj& X = gg(&mX, "zOC");
+
+            Element buffer[4];
+
+            ASSERT_SAFE_PASS(X.getValues(buffer, 0, 3));
+            ASSERT_SAFE_PASS(X.getValues(buffer, 3, 0));
+            ASSERT_SAFE_PASS(X.getValues(0,      1, 0));
+            ASSERT_SAFE_FAIL(X.getValues(buffer, 0, 4));
+            ASSERT_SAFE_FAIL(X.getValues(buffer, 4, 0));
+            ASSERT_SAFE_FAIL(X.getValues(buffer, 2, 2));
+            ASSERT_SAFE_FAIL(X.getValues(0,      0, 1));
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING 'remove(PIACI dstFirst, PIACI dstLast)'
@@ -4915,6 +5424,10 @@ int main(int argc, char *argv[])
             if (verbose) cout << "\tUsing class method syntax." << endl;
             ASSERT(1 == Obj::maxSupportedBdexVersion(0));
             ASSERT(1 == UnsignedObj::maxSupportedBdexVersion(0));
+            ASSERT(1 == Obj::maxSupportedBdexVersion(20261018));
+            ASSERT(1 == UnsignedObj::maxSupportedBdexVersion(20261018));
+            ASSERT(2 == Obj::maxSupportedBdexVersion(20261019));
+            ASSERT(2 == UnsignedObj::maxSupportedBdexVersion(20261019));
         }
 
         if (verbose) {
@@ -5324,7 +5837,7 @@ int main(int argc, char *argv[])
             ASSERT(UW != t);  ASSERT(UX == t);  ASSERT(UY != t);
         }
         {
-            const char version = 5 ; // too large (current version is 1)
+            const char version = 5 ; // too large (current version is 2)
 
             Out out(SERIALIZATION_VERSION);
 
@@ -5346,7 +5859,7 @@ int main(int argc, char *argv[])
             ASSERT(W != t);  ASSERT(X == t);  ASSERT(Y != t);
         }
         {
-            const char version = 5 ; // too large (current version is 1)
+            const char version = 5 ; // too large (current version is 2)
 
             Out out(SERIALIZATION_VERSION);
 
@@ -5426,11 +5939,20 @@ int main(int argc, char *argv[])
                 { L_,   "C",         0,   0, ""                             },
                 { L_,   "CS",        0,   0, ""                             },
 
-                { L_,   "C",         2,   0, ""                             },
-                { L_,   "CS",        2,   0, ""                             },
+                { L_,   "C",         3,   0, ""                             },
+                { L_,   "CS",        3,   0, ""                             },
 
                 { L_,   "C",         1,   3, "\x01\x01\x7F"                 },
-                { L_,   "CS",        1,   6, "\x02\x02\x00\x7F\x7f\xFF"     }
+                { L_,   "CS",        1,   6, "\x02\x02\x00\x7F\x7f\xFF"     },
+
+                { L_,   "C",         2,  12, "\x01\x01\x00"
+                                             "\x00\x00\x00\x00\x00\x00\x00\x7F"
+                                             "\x00"                         },
+                { L_,   "CS",        2,  20, "\x02\x02\x00"
+                                             "\x00\x00\x00\x00\x00\x00\x00\x7F"
+                                             "\x0F"
+                                             "\x00\x00\x00\x00\x3F\xC0\x00\x00"
+                                                                            },
             };
             const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
 
@@ -8091,6 +8613,118 @@ int main(int argc, char *argv[])
             ASSERT(false == X6[5]);         ASSERT(false == X6[7]);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BULK ACCESS, WIDENING, AND COMPACT STREAMING
+        //
+        // Concerns:
+        //: 1 'getValues' is faster than reading each element with
+        //:   'operator[]', and the vectorized widening is fast.
+        //:
+        //: 2 The compact BDEX format is much smaller than version 1 for
+        //:   sorted data.
+        //
+        // Plan:
+        //: 1 Time the summation of a large array of one-byte elements into an
+        //:   'int64' using 'operator[]' and using 'getValues' into a buffer,
+        //:   time the widening of the array, and time and measure both BDEX
+        //:   formats of a sequence of timestamps.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE: BULK ACCESS, WIDENING, AND COMPACT STREAMING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+             << "PERFORMANCE: BULK ACCESS, WIDENING, AND COMPACT STREAMING"
+             << endl
+             << "========================================================="
+             << endl;
+
+        const int NUM_ELEMENTS = argc > 2 ? atoi(argv[2]) : 1 << 22;
+        const int NUM_REPS     = 10;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mX.append(static_cast<Element>(i % 251) - 125);
+        }
+
+        bsls::Stopwatch timer;
+
+        Element sum1 = 0;
+        timer.start(true);
+        for (int rep = 0; rep < NUM_REPS; ++rep) {
+            for (bsl::size_t i = 0; i < X.length(); ++i) {
+                sum1 += X[i];
+            }
+        }
+        timer.stop();
+        const double ELEMENT_TIME = timer.accumulatedWallTime();
+
+        enum { k_CHUNK = 1024 };
+        Element chunk[k_CHUNK];
+        Element sum2 = 0;
+        timer.reset();
+        timer.start(true);
+        for (int rep = 0; rep < NUM_REPS; ++rep) {
+            for (bsl::size_t i = 0; i < X.length(); i += k_CHUNK) {
+                const bsl::size_t n = bsl::min<bsl::size_t>(k_CHUNK,
+                                                            X.length() - i);
+                X.getValues(chunk, i, n);
+                for (bsl::size_t j = 0; j < n; ++j) {
+                    sum2 += chunk[j];
+                }
+            }
+        }
+        timer.stop();
+        const double BULK_TIME = timer.accumulatedWallTime();
+        ASSERTV(sum1, sum2, sum1 == sum2);
+
+        timer.reset();
+        for (int rep = 0; rep < NUM_REPS; ++rep) {
+            Obj mY(X, &oa);
+            timer.start(true);
+            mY.append(k_INT64_MAX);
+            timer.stop();
+            ASSERT(8 == mY.bytesPerElement());
+        }
+        const double WIDEN_TIME = timer.accumulatedWallTime();
+
+        cout << "operator[]: " << ELEMENT_TIME / NUM_REPS << "s per pass\n"
+             << "getValues:  " << BULK_TIME    / NUM_REPS << "s per pass\n"
+             << "widen 1->8: " << WIDEN_TIME   / NUM_REPS << "s\n";
+
+        Obj mT(&oa);  const Obj& T = mT;
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mT.append(1475280000000LL + static_cast<Element>(i) * 1000
+                                                                   + i % 7);
+        }
+
+        for (int version = 1; version <= 2; ++version) {
+            bslx::ByteOutStream out(SERIALIZATION_VERSION, &oa);
+
+            timer.reset();
+            timer.start(true);
+            T.bdexStreamOut(out, version);
+            timer.stop();
+            const double OUT_TIME = timer.accumulatedWallTime();
+
+            Obj                mU(&oa);
+            bslx::ByteInStream in(out.data(), out.length());
+            timer.reset();
+            timer.start(true);
+            mU.bdexStreamIn(in, version);
+            timer.stop();
+            const double IN_TIME = timer.accumulatedWallTime();
+
+            ASSERT(T == mU);
+
+            cout << "BDEX version " << version << ": "
+                 << out.length() << " bytes, out " << OUT_TIME
+                 << "s, in " << IN_TIME << "s\n";
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -57,10 +57,56 @@ BSLS_IDENT_RCSID(bdlcc_objectpool_cpp,"$Id$ $CSID$")
 //                          <-ROUNDED_OBJECT_SIZE->
 //              <--------OBJECT_FRAME_SIZE------->
 //..
+//
+// When thread caches are enabled, each thread registers an
+// 'ObjectPool_ThreadCache' under the pool's thread-specific storage key.  The
+// objects of a cache are linked through 'd_next_p' exactly as on the free
+// list, but are considered *in use* by the free-list algorithm: their
+// reference count remains 2, so a thread still holding a stale reference to
+// one of them (from an earlier attempt to pop it) fails to pop it, exactly as
+// if the object had been obtained by a client.  Objects leave a cache only
+// through 'pushFreeObjects', which performs the same reference count
+// transition as releasing a single object, and then links all the objects
+// that are not handed over to a concurrent popper onto the free list with a
+// single compare-and-swap.
+//
+// An empty cache is refilled from the free list without popping its objects
+// one at a time: the whole free list is detached with an atomic swap, a
+// reference is taken to each of the objects at its front that are kept in the
+// cache, and the rest of the list is reattached, unchanged, with a
+// compare-and-swap that succeeds only if the free list is still empty.  A
+// thread holding a stale reference to a reattached object may then pop it,
+// which is correct because its links are unchanged.  Objects released to the
+// free list in the meantime are taken into the cache (and any excess is
+// trimmed) before the reattachment is retried.  The refill holds 'd_mutex', so
+// that a thread finding the free list empty while it is detached waits rather
+// than growing the pool.
+//
+// The local list of a cache is accessed only by its owning thread.  Other
+// threads return objects to a cache by pushing them onto its 'd_remoteList',
+// which the owner drains with an atomic swap when its local list is empty.
+// When the owning thread exits, the cache is drained, marked orphaned (after
+// which other threads no longer return objects to it), and drained again;
+// a thread that returns an object concurrently with the marking re-checks the
+// mark and drains the remote list itself.  Orphaned caches are retained on the
+// pool's registry and adopted by new threads, so the number of caches is
+// bounded by the maximum number of threads that used the pool concurrently.
 
 namespace BloombergLP {
 namespace bdlcc {
 
+                        // ----------------------------
+                        // class ObjectPool_ThreadCache
+                        // ----------------------------
+
+extern "C" void bdlcc_ObjectPool_retireThreadCache(void *threadCache)
+{
+    ObjectPool_ThreadCache *cache =
+                            static_cast<ObjectPool_ThreadCache *>(threadCache);
+
+    cache->d_retireFunction(cache);
+}
+
                        // ---------------------------
                        // ObjectPool_CreatorConverter
                        // ---------------------------
@@ -124,6 +124,46 @@ BSLS_IDENT("$Id: $")
 // number of objects.  If 'growBy' is not specified, it defaults to -1 (i.e.,
 // geometric increase beginning at 1).
 //
+///Per-Thread Caches
+///------------------
+// By default, every 'getObject' and 'releaseObject' operates on a single free
+// list shared by all threads, which becomes a point of contention when many
+// threads obtain and release objects at a high rate.  Calling
+// 'setThreadCacheCapacity' with a positive 'capacity' gives each thread that
+// uses the pool a private cache of available objects:
+//
+//: o 'releaseObject' adds the object to the cache of the calling thread.  When
+//:   the cache holds more than 'capacity' objects, the least recently released
+//:   half of them is returned to the shared free list in a single atomic
+//:   operation.
+//:
+//: o 'getObject' takes the most recently released object from the cache of
+//:   the calling thread.  When the cache is empty, it is refilled with up to
+//:   'capacity / 2' objects (at least one) from the shared free list, which
+//:   are detached from it in a single atomic operation.
+//
+// When a thread exits, the objects in its cache are returned to the shared
+// free list, and the cache is reused by the next thread that uses the pool.
+// Note that objects held in thread caches are not included in
+// 'numAvailableObjects', and that a pool having thread caches enabled
+// consumes one thread-specific storage key (see 'bslmt::ThreadUtil').
+//
+// The cache of a thread is retired by a thread-specific storage destructor
+// that runs when the thread exits, and that accesses both the cache and the
+// pool.  The destructor of the pool deletes the thread-specific storage key,
+// so that threads exiting afterwards do not retire their caches, and frees the
+// caches, but it cannot prevent a thread that is exiting at the same time
+// from retiring its cache.  Therefore, if thread caches were ever enabled, the
+// behavior is undefined unless every thread (other than the one destroying
+// the pool) that obtained or released objects from the pool has exited (e.g.,
+// has been joined), or is known not to exit until the destructor of the pool
+// returns.
+//
+// 'bdlcc::SharedObjectPool' can additionally be configured to return each
+// object to the cache of the thread that obtained it, rather than of the
+// thread that releases it, which keeps objects on the thread (and processor)
+// that uses them when they are released by a different thread.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -393,6 +433,59 @@ BSLS_IDENT("$Id: $")
 namespace BloombergLP {
 namespace bdlcc {
 
+template <class TYPE, class RESETTER>
+class SharedObjectPool_Rep;
+
+template <class TYPE, class CREATOR, class RESETTER>
+class SharedObjectPool;
+
+                        // ============================
+                        // class ObjectPool_ThreadCache
+                        // ============================
+
+class ObjectPool_ThreadCache {
+    // This private class holds the objects of an object pool that are
+    // available to a single thread without contention (see {Per-Thread
+    // Caches}).  The objects are linked in lists through the pool's object
+    // nodes, which are manipulated by the owning pool; this class is not
+    // templated so that it can be retired by a thread-specific storage
+    // destructor.
+
+  public:
+    // TYPES
+    typedef void (*RetireFunction)(ObjectPool_ThreadCache *cache);
+        // 'RetireFunction' is an alias for the type of a function invoked
+        // when the thread owning a cache exits.
+
+    // PUBLIC DATA
+    void                    *d_localList_p;     // objects available to the
+                                                // owning thread (accessed by
+                                                // the owning thread only)
+
+    int                      d_numLocalObjects; // length of 'd_localList_p'
+
+    bsls::AtomicOperations::AtomicTypes::Pointer
+                             d_remoteList;      // objects returned to this
+                                                // cache by other threads
+
+    bsls::AtomicOperations::AtomicTypes::Int
+                             d_isOrphaned;      // 1 if the owning thread
+                                                // has exited, and 0 otherwise
+
+    ObjectPool_ThreadCache  *d_next_p;          // next cache of the pool
+                                                // (guarded by the pool mutex)
+
+    void                    *d_pool_p;          // owning pool (held)
+
+    RetireFunction           d_retireFunction;  // invoked on thread exit
+};
+
+extern "C" void bdlcc_ObjectPool_retireThreadCache(void *threadCache);
+    // Invoke the retire function of the specified 'threadCache', which is
+    // the address of an 'ObjectPool_ThreadCache'.  This function is the
+    // thread-specific storage destructor of the thread caches of all object
+    // pools.
+
                          // =========================
                          // struct ObjectPoolFunctors
                          // =========================
@@ -653,6 +746,7 @@ class ObjectPool : public bdlma::Factory<TYPE> {
 
     // PRIVATE TYPES
     typedef ObjectPool<TYPE, CREATOR, RESETTER> MyType;
+    typedef ObjectPool_ThreadCache              ThreadCache;
 
     union ObjectNode {
         // This class stores a list pointer for linking the object nodes
@@ -807,7 +901,23 @@ class ObjectPool : public bdlma::Factory<TYPE> {
     bslma::Allocator      *d_allocator_p;          // held, not owned
 
     bslmt::Mutex           d_mutex;                // pool replenishment
-                                                   // serializer
+                                                   // and thread cache
+                                                   // registration serializer
+
+    int                    d_threadCacheCapacity;  // maximum number of objects
+                                                   // in a thread cache, or 0
+                                                   // if caches are disabled
+
+    bslmt::ThreadUtil::Key d_threadCacheKey;       // key of the cache of each
+                                                   // thread (valid only if
+                                                   // 'd_hasThreadCacheKey')
+
+    bool                   d_hasThreadCacheKey;    // 'true' if
+                                                   // 'd_threadCacheKey' was
+                                                   // created
+
+    ThreadCache           *d_threadCacheList;      // all thread caches of
+                                                   // this pool (owned)
 
     // NOT IMPLEMENTED
     ObjectPool(const MyType&, bslma::Allocator * = 0);
@@ -816,7 +926,19 @@ class ObjectPool : public bdlma::Factory<TYPE> {
     // FRIENDS
     friend class AutoCleanup;
 
+    template <class, class>
+    friend class SharedObjectPool_Rep;
+
+    template <class, class, class>
+    friend class SharedObjectPool;
+
   private:
+    // PRIVATE CLASS METHODS
+    static void retireThreadCache(ThreadCache *cache);
+        // Return the objects of the specified 'cache' to the free list of its
+        // pool and make 'cache' available for reuse by another thread.  This
+        // method is invoked when the thread owning 'cache' exits.
+
     // PRIVATE MANIPULATORS
     void replenish();
         // Add additional objects to this pool based on the replenishment
@@ -826,6 +948,64 @@ class ObjectPool : public bdlma::Factory<TYPE> {
         // Create the specified 'numObjects' objects and attach them to this
         // object pool.
 
+    ObjectNode *popFreeObject();
+        // Remove an object node from the free list of this pool, replenishing
+        // the pool if it is empty, and return its address.
+
+    void pushFreeObjects(ObjectNode *list);
+        // Return the object nodes of the specified 'list' (linked through
+        // their 'd_next_p' fields and terminated by 0), each holding an
+        // object that was obtained from this pool and reset, to the free list
+        // of this pool in a single atomic operation.
+
+    void cacheObject(ObjectNode *node, ThreadCache *cache);
+        // Add the specified 'node', holding a reset object, to the specified
+        // 'cache' of the calling thread, trimming 'cache' if it exceeds its
+        // capacity.
+
+    void returnObjectToThreadCache(ObjectNode *node, ThreadCache *cache);
+        // Return the specified 'node', holding a reset object, to the
+        // specified 'cache' of another thread, for reuse by that thread.
+
+    void releaseObjectToThreadCache(TYPE *object, ThreadCache *originCache);
+        // Return the specified 'object' back to this object pool as
+        // 'releaseObject' does, except that the object is returned to the
+        // specified 'originCache' if it is not 0.  The behavior is undefined
+        // unless 'originCache' is 0 or the address of a cache of this pool.
+        // Note that this method is not an overload of 'releaseObject' so that
+        // the address of 'releaseObject' can be taken unambiguously.
+
+    ThreadCache *currentThreadCache();
+        // Return the address of the cache of the calling thread, creating it
+        // if needed, or 0 if thread caches are disabled or the cache cannot
+        // be registered for the calling thread.
+
+    ThreadCache *createThreadCache();
+        // Create (or reuse an orphaned) cache, register it as the cache of the
+        // calling thread, and return its address, or return 0 if the cache
+        // cannot be registered.
+
+    void acquireDetachedObject(ObjectNode *node, ThreadCache *cache);
+        // Take the specified 'node', which was detached from the free list of
+        // this pool together with the objects linked to it, and add it to the
+        // specified 'cache' of the calling thread.
+
+    void refillThreadCache(ThreadCache *cache);
+        // Add available objects to the specified empty 'cache' of the calling
+        // thread, first from the objects returned to it by other threads and,
+        // if there are none, from the free list of this pool, detaching a
+        // batch of objects from the free list in a single atomic operation.
+
+    void trimThreadCache(ThreadCache *cache);
+        // Return the least recently released objects of the specified 'cache'
+        // of the calling thread to the free list of this pool, leaving half
+        // of the capacity of the thread caches.
+
+    void flushThreadCaches();
+        // Return the objects in all the thread caches of this pool to the free
+        // list of this pool.  The behavior is undefined if any other thread
+        // is concurrently using this pool.
+
   public:
     // TYPES
     typedef RESETTER ResetterType;
@@ -910,7 +1090,10 @@ class ObjectPool : public bdlma::Factory<TYPE> {
     virtual ~ObjectPool();
         // Destroy this object pool.  All objects created by this pool are
         // destroyed (even if some of them are still in use) and memory is
-        // reclaimed.
+        // reclaimed.  If thread caches were ever enabled, the behavior is
+        // undefined if a thread (other than the calling thread) that used
+        // this pool exits concurrently with this call (see {Per-Thread
+        // Caches}).
 
     // MANIPULATORS
     TYPE *getObject();
@@ -931,7 +1114,9 @@ class ObjectPool : public bdlma::Factory<TYPE> {
         // then this method should be invoked to return only *valid* objects
         // because the pool uses the released objects to satisfy further
         // 'getObject' requests.  The behavior is undefined unless the 'object'
-        // was obtained from this object pool's 'getObject' method.
+        // was obtained from this object pool's 'getObject' method.  Note that,
+        // if thread caches are enabled, the object is added to the cache of
+        // the calling thread (see {Per-Thread Caches}).
 
     void reserveCapacity(int numObjects);
         // Create enough objects to satisfy requests for at least the specified
@@ -940,15 +1125,31 @@ class ObjectPool : public bdlma::Factory<TYPE> {
         // different from 'increaseCapacity' in that the number of created
         // objects may be less than 'numObjects'.
 
+    int setThreadCacheCapacity(int capacity);
+        // Set the maximum number of objects held in the cache of each thread
+        // using this pool to the specified 'capacity', or disable thread
+        // caches if 'capacity' is 0 (see {Per-Thread Caches}).  Objects held
+        // in thread caches are first returned to the free list of this pool.
+        // Return 0 on success, and a non-zero value (with no effect) if
+        // thread caches cannot be enabled because no thread-specific storage
+        // key is available.  The behavior is undefined unless
+        // '0 <= capacity', and no other method of this pool is invoked
+        // concurrently.  Note that thread caches are disabled by default.
+
     // ACCESSORS
     int numAvailableObjects() const;
         // Return a *snapshot* of the number of objects available in this pool.
+        // Note that objects held in thread caches are not included.
 
     int numObjects() const;
         // Return the (instantaneous) number of objects managed by this pool.
         // This includes both the objects available in the pool and the objects
         // that were allocated from the pool and not yet released.
 
+    int threadCacheCapacity() const;
+        // Return the maximum number of objects held in the cache of each
+        // thread using this pool, or 0 if thread caches are disabled.
+
     // 'bdlma::Factory' INTERFACE
     virtual TYPE *createObject();
         // This concrete implementation of 'bdlma::Factory::createObject'
@@ -1045,6 +1246,448 @@ void ObjectPool<TYPE, CREATOR, RESETTER>::addObjects(int numObjects)
     d_numAvailableObjects.addRelaxed(numObjects);
 }
 
+template <class TYPE, class CREATOR, class RESETTER>
+typename ObjectPool<TYPE, CREATOR, RESETTER>::ObjectNode *
+ObjectPool<TYPE, CREATOR, RESETTER>::popFreeObject()
+{
+    ObjectNode *p;
+    do {
+        p = d_freeObjectsList.loadRelaxed();
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!p)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            p = d_freeObjectsList;
+            if (!p) {
+                replenish();
+                continue;
+            }
+        }
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            2 != bsls::AtomicOperations::addIntNv(&p->d_inUse.d_refCount,2))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            for (int i = 0; i < 3; ++i) {
+                // To avoid unnecessary contention, assume that if we did not
+                // get the first reference, then the other thread is about to
+                // complete the pop.  Wait for a few cycles until he does.  If
+                // he does not complete then go on and try to acquire it
+                // ourselves.
+
+                if (d_freeObjectsList != p) {
+                    break;
+                }
+            }
+        }
+
+        // Force a dependent read of d_next_p to make sure that we're not
+        // racing against a thread calling 'deallocate' for 'p' and that
+        // checked the 'refCount' *before* we incremented it.  Either we can
+        // observe the new free list value (== p) and because of the release
+        // barrier, we can observe the new 'd_next_p' value (this relies on a
+        // dependent load) or 'loadRelaxed' will the "old" (!= p) and the
+        // condition will fail.  Note that 'h' is made volatile so that the
+        // compiler does not replace the 'h->d_inUse' load with 'p->d_inUse'
+        // (and thus removing the data dependency).  TBD to be completely
+        // thorough 'h->d_inUse.d_next_p' needs a load dependent barrier (no-op
+        // on all current architectures though).
+
+        const ObjectNode * volatile h = d_freeObjectsList.loadRelaxed();
+
+        // Split the likely into 2 to workaround gcc 4.2 to gcc 4.4 bugs
+        // documented in 'bsls_performancehint'.
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(h == p)
+         && BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                  d_freeObjectsList.testAndSwap(p,h->d_inUse.d_next_p) == p)) {
+            break;
+        }
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        int refCount;
+        for (;;) {
+            refCount = bsls::AtomicOperations::getInt(&p->d_inUse.d_refCount);
+
+            if (refCount & 1) {
+                // The node is now free but not on the free list.  Try to take
+                // it.
+
+                if (refCount == bsls::AtomicOperations::testAndSwapInt(
+                                                    &p->d_inUse.d_refCount,
+                                                    refCount,
+                                                    refCount^1)) {
+                    // Taken!
+                    p->d_inUse.d_next_p = 0;  // not strictly necessary
+                    d_numAvailableObjects.addRelaxed(-1);
+                    return p;                                         // RETURN
+
+                }
+            }
+            else if (refCount == bsls::AtomicOperations::testAndSwapInt(
+                                                    &p->d_inUse.d_refCount,
+                                                    refCount,
+                                                    refCount - 2)) {
+                break;
+            }
+        }
+    } while (1);
+
+    p->d_inUse.d_next_p = 0;  // not strictly necessary
+    d_numAvailableObjects.addRelaxed(-1);
+    return p;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::pushFreeObjects(ObjectNode *list)
+{
+    // Release the reference of each node, and link the nodes that are not
+    // being acquired concurrently by a thread still holding a reference to
+    // them from an earlier 'popFreeObject' (see the implementation notes).
+
+    ObjectNode *first = 0;
+    ObjectNode *last  = 0;
+    int         numNodes = 0;
+
+    while (list) {
+        ObjectNode *current = list;
+        list = list->d_inUse.d_next_p;
+
+        int refCount = bsls::AtomicOperations::getIntRelaxed(
+                                                 &current->d_inUse.d_refCount);
+        bool handedOver = false;
+        do {
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
+                refCount = bsls::AtomicOperations::testAndSwapInt(
+                                                  &current->d_inUse.d_refCount,
+                                                  2,
+                                                  0);
+                if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
+                    break;
+                }
+            }
+
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            const int oldRefCount = refCount;
+            refCount = bsls::AtomicOperations::testAndSwapInt(
+                                                  &current->d_inUse.d_refCount,
+                                                  refCount,
+                                                  refCount - 1);
+            if (oldRefCount == refCount) {
+                // Someone else is still trying to pop this item.  Just let
+                // them have it.
+
+                d_numAvailableObjects.addRelaxed(1);
+                handedOver = true;
+                break;
+            }
+        } while (1);
+
+        if (!handedOver) {
+            current->d_inUse.d_next_p = first;
+            if (!first) {
+                last = current;
+            }
+            first = current;
+            ++numNodes;
+        }
+    }
+
+    if (!first) {
+        return;                                                       // RETURN
+    }
+
+    ObjectNode *head = d_freeObjectsList.loadRelaxed();
+    for (;;) {
+        last->d_inUse.d_next_p = head;
+        ObjectNode * const oldHead = head;
+        head = d_freeObjectsList.testAndSwap(head, first);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(oldHead == head)) {
+            break;
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+    d_numAvailableObjects.addRelaxed(numNodes);
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+void ObjectPool<TYPE, CREATOR, RESETTER>::cacheObject(ObjectNode  *node,
+                                                      ThreadCache *cache)
+{
+    node->d_inUse.d_next_p = static_cast<ObjectNode *>(cache->d_localList_p);
+    cache->d_localList_p = node;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                        ++cache->d_numLocalObjects > d_threadCacheCapacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        trimThreadCache(cache);
+    }
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::returnObjectToThreadCache(
+                                                           ObjectNode  *node,
+                                                           ThreadCache *cache)
+{
+    void *head = bsls::AtomicOperations::getPtrRelaxed(&cache->d_remoteList);
+    for (;;) {
+        node->d_inUse.d_next_p = static_cast<ObjectNode *>(head);
+        void * const oldHead = head;
+        head = bsls::AtomicOperations::testAndSwapPtr(&cache->d_remoteList,
+                                                      head,
+                                                      node);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(oldHead == head)) {
+            break;
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+
+    // If the owning thread exited concurrently, it may have collected the
+    // objects returned to its cache before 'node' was added; collect them on
+    // its behalf.
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                      bsls::AtomicOperations::getInt(&cache->d_isOrphaned))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        pushFreeObjects(static_cast<ObjectNode *>(
+                   bsls::AtomicOperations::swapPtr(&cache->d_remoteList, 0)));
+    }
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::releaseObjectToThreadCache(
+                                                    TYPE        *object,
+                                                    ThreadCache *originCache)
+{
+    if (!originCache || 0 == d_threadCacheCapacity) {
+        releaseObject(object);
+        return;                                                       // RETURN
+    }
+
+    ObjectNode *current = (ObjectNode *)(void *)object - 1;
+    d_objectResetter.object()(object);
+
+    if (originCache == bslmt::ThreadUtil::getSpecific(d_threadCacheKey)) {
+        cacheObject(current, originCache);
+    }
+    else if (bsls::AtomicOperations::getInt(&originCache->d_isOrphaned)) {
+        current->d_inUse.d_next_p = 0;
+        pushFreeObjects(current);
+    }
+    else {
+        returnObjectToThreadCache(current, originCache);
+    }
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+typename ObjectPool<TYPE, CREATOR, RESETTER>::ThreadCache *
+ObjectPool<TYPE, CREATOR, RESETTER>::currentThreadCache()
+{
+    if (0 == d_threadCacheCapacity) {
+        return 0;                                                     // RETURN
+    }
+
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                            bslmt::ThreadUtil::getSpecific(d_threadCacheKey));
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        cache = createThreadCache();
+    }
+    return cache;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+typename ObjectPool<TYPE, CREATOR, RESETTER>::ThreadCache *
+ObjectPool<TYPE, CREATOR, RESETTER>::createThreadCache()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    ThreadCache *cache = d_threadCacheList;
+    while (cache && !bsls::AtomicOperations::getInt(&cache->d_isOrphaned)) {
+        cache = cache->d_next_p;
+    }
+
+    bool isNew = false;
+    if (!cache) {
+        cache = static_cast<ThreadCache *>(
+                               d_allocator_p->allocate(sizeof(ThreadCache)));
+        cache->d_localList_p    = 0;
+        cache->d_numLocalObjects = 0;
+        bsls::AtomicOperations::initPointer(&cache->d_remoteList, 0);
+        bsls::AtomicOperations::initInt(&cache->d_isOrphaned, 0);
+        cache->d_next_p         = 0;
+        cache->d_pool_p         = this;
+        cache->d_retireFunction = &MyType::retireThreadCache;
+        isNew = true;
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_threadCacheKey, cache)) {
+        if (isNew) {
+            d_allocator_p->deallocate(cache);
+        }
+        return 0;                                                     // RETURN
+    }
+
+    if (isNew) {
+        cache->d_next_p   = d_threadCacheList;
+        d_threadCacheList = cache;
+    }
+    else {
+        bsls::AtomicOperations::setInt(&cache->d_isOrphaned, 0);
+    }
+    return cache;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+void ObjectPool<TYPE, CREATOR, RESETTER>::acquireDetachedObject(
+                                                           ObjectNode  *node,
+                                                           ThreadCache *cache)
+{
+    // Take a reference to 'node', as 'popFreeObject' does, so that a thread
+    // still holding a stale reference to it fails to pop it.
+
+    bsls::AtomicOperations::addInt(&node->d_inUse.d_refCount, 2);
+    d_numAvailableObjects.addRelaxed(-1);
+
+    node->d_inUse.d_next_p = static_cast<ObjectNode *>(cache->d_localList_p);
+    cache->d_localList_p = node;
+    ++cache->d_numLocalObjects;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::refillThreadCache(
+                                                            ThreadCache *cache)
+{
+    BSLS_ASSERT(0 == cache->d_localList_p);
+
+    // First, collect the objects returned to this cache by other threads.
+
+    ObjectNode *list = static_cast<ObjectNode *>(
+                   bsls::AtomicOperations::swapPtr(&cache->d_remoteList, 0));
+    if (list) {
+        int numObjects = 0;
+        for (ObjectNode *p = list; p; p = p->d_inUse.d_next_p) {
+            ++numObjects;
+        }
+        cache->d_localList_p    = list;
+        cache->d_numLocalObjects = numObjects;
+
+        if (numObjects > d_threadCacheCapacity) {
+            trimThreadCache(cache);
+        }
+        return;                                                       // RETURN
+    }
+
+    // Otherwise, detach the whole free list with a single atomic swap, take a
+    // batch of objects from its front, and reattach the rest unchanged.  The
+    // mutex is held so that a concurrent 'popFreeObject' finding the free list
+    // empty meanwhile waits for it to be reattached, rather than
+    // replenishing the pool.  Note that the cache is not modified if
+    // replenishing the free list throws.
+
+    const int batchSize = d_threadCacheCapacity > 1
+                        ? d_threadCacheCapacity / 2
+                        : 1;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    list = d_freeObjectsList.swap(0);
+    while (!list) {
+        replenish();
+        list = d_freeObjectsList.swap(0);
+    }
+
+    for (int i = 0; list && i < batchSize; ++i) {
+        ObjectNode *p = list;
+        list = p->d_inUse.d_next_p;
+        acquireDetachedObject(p, cache);
+    }
+
+    // Objects released to the free list since it was detached are taken as
+    // well, so that the rest of the detached list, whose links may be
+    // relied upon by a concurrent 'popFreeObject', is reattached as is.
+
+    while (list && 0 != d_freeObjectsList.testAndSwap(0, list)) {
+        ObjectNode *released = d_freeObjectsList.swap(0);
+        while (released) {
+            ObjectNode *p = released;
+            released = p->d_inUse.d_next_p;
+            acquireDetachedObject(p, cache);
+        }
+    }
+
+    if (cache->d_numLocalObjects > d_threadCacheCapacity) {
+        trimThreadCache(cache);
+    }
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::trimThreadCache(ThreadCache *cache)
+{
+    // Keep the most recently released objects, which are at the front of the
+    // list and most likely to be in the processor cache.
+
+    const int numToKeep = d_threadCacheCapacity / 2;
+
+    ObjectNode *list = static_cast<ObjectNode *>(cache->d_localList_p);
+    if (0 == numToKeep) {
+        cache->d_localList_p = 0;
+    }
+    else {
+        ObjectNode *lastKept = list;
+        for (int i = 1; i < numToKeep; ++i) {
+            lastKept = lastKept->d_inUse.d_next_p;
+        }
+        list = lastKept->d_inUse.d_next_p;
+        lastKept->d_inUse.d_next_p = 0;
+    }
+    cache->d_numLocalObjects = numToKeep;
+
+    pushFreeObjects(list);
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::flushThreadCaches()
+{
+    for (ThreadCache *cache = d_threadCacheList;
+         cache;
+         cache = cache->d_next_p) {
+        pushFreeObjects(static_cast<ObjectNode *>(cache->d_localList_p));
+        cache->d_localList_p     = 0;
+        cache->d_numLocalObjects = 0;
+
+        pushFreeObjects(static_cast<ObjectNode *>(
+                   bsls::AtomicOperations::swapPtr(&cache->d_remoteList, 0)));
+    }
+}
+
+// PRIVATE CLASS METHODS
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::retireThreadCache(ThreadCache *cache)
+{
+    MyType *pool = static_cast<MyType *>(cache->d_pool_p);
+
+    pool->pushFreeObjects(static_cast<ObjectNode *>(cache->d_localList_p));
+    cache->d_localList_p     = 0;
+    cache->d_numLocalObjects = 0;
+
+    pool->pushFreeObjects(static_cast<ObjectNode *>(
+                   bsls::AtomicOperations::swapPtr(&cache->d_remoteList, 0)));
+
+    // Once the cache is marked as orphaned, another thread may adopt it, or
+    // return objects to it and collect them itself.  Objects returned after
+    // the collection above but before the cache was marked are collected
+    // here.
+
+    bsls::AtomicOperations::setInt(&cache->d_isOrphaned, 1);
+
+    pool->pushFreeObjects(static_cast<ObjectNode *>(
+                   bsls::AtomicOperations::swapPtr(&cache->d_remoteList, 0)));
+}
+
 // CREATORS
 template <class TYPE, class CREATOR, class RESETTER>
 ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
@@ -1057,6 +1700,9 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_hasThreadCacheKey(false)
+, d_threadCacheList(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1073,6 +1719,9 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_hasThreadCacheKey(false)
+, d_threadCacheList(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1089,6 +1738,9 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_hasThreadCacheKey(false)
+, d_threadCacheList(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1108,6 +1760,9 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_hasThreadCacheKey(false)
+, d_threadCacheList(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1128,6 +1783,9 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_hasThreadCacheKey(false)
+, d_threadCacheList(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1145,6 +1803,9 @@ ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
 , d_blockList(0)
 , d_blockAllocator(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadCacheCapacity(0)
+, d_hasThreadCacheKey(false)
+, d_threadCacheList(0)
 {
     BSLS_ASSERT(0 != d_numReplenishObjects);
 }
@@ -1164,97 +1825,45 @@ ObjectPool<TYPE, CREATOR, RESETTER>::~ObjectPool()
             p += k_NUM_OBJECTS_PER_FRAME;
       }
   }
+
+    // Release the thread caches.  Note that the objects they hold were
+    // destroyed above.  Once the key is deleted, threads that exit no longer
+    // retire their caches; a thread exiting concurrently with this destructor
+    // could still do so, which the contract excludes.
+
+    if (d_hasThreadCacheKey) {
+        bslmt::ThreadUtil::deleteKey(d_threadCacheKey);
+    }
+    while (d_threadCacheList) {
+        ThreadCache *cache = d_threadCacheList;
+        d_threadCacheList = cache->d_next_p;
+        d_allocator_p->deallocate(cache);
+    }
 }
 
 // MANIPULATORS
 template <class TYPE, class CREATOR, class RESETTER>
 TYPE *ObjectPool<TYPE, CREATOR, RESETTER>::getObject()
 {
-    ObjectNode *p;
-    do {
-        p = d_freeObjectsList.loadRelaxed();
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!p)) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-
-            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-            p = d_freeObjectsList;
-            if (!p) {
-                replenish();
-                continue;
+    if (d_threadCacheCapacity) {
+        ThreadCache *cache = currentThreadCache();
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                                   !cache->d_localList_p)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                refillThreadCache(cache);
             }
-        }
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            2 != bsls::AtomicOperations::addIntNv(&p->d_inUse.d_refCount,2))) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            for (int i = 0; i < 3; ++i) {
-                // To avoid unnecessary contention, assume that if we did not
-                // get the first reference, then the other thread is about to
-                // complete the pop.  Wait for a few cycles until he does.  If
-                // he does not complete then go on and try to acquire it
-                // ourselves.
 
-                if (d_freeObjectsList != p) {
-                    break;
-                }
-            }
-        }
+            ObjectNode *p = static_cast<ObjectNode *>(cache->d_localList_p);
+            cache->d_localList_p = p->d_inUse.d_next_p;
+            --cache->d_numLocalObjects;
 
-        // Force a dependent read of d_next_p to make sure that we're not
-        // racing against a thread calling 'deallocate' for 'p' and that
-        // checked the 'refCount' *before* we incremented it.  Either we can
-        // observe the new free list value (== p) and because of the release
-        // barrier, we can observe the new 'd_next_p' value (this relies on a
-        // dependent load) or 'loadRelaxed' will the "old" (!= p) and the
-        // condition will fail.  Note that 'h' is made volatile so that the
-        // compiler does not replace the 'h->d_inUse' load with 'p->d_inUse'
-        // (and thus removing the data dependency).  TBD to be completely
-        // thorough 'h->d_inUse.d_next_p' needs a load dependent barrier (no-op
-        // on all current architectures though).
-
-        const ObjectNode * volatile h = d_freeObjectsList.loadRelaxed();
-
-        // Split the likely into 2 to workaround gcc 4.2 to gcc 4.4 bugs
-        // documented in 'bsls_performancehint'.
-
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(h == p)
-         && BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
-                  d_freeObjectsList.testAndSwap(p,h->d_inUse.d_next_p) == p)) {
-            break;
-        }
-
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-
-        int refCount;
-        for (;;) {
-            refCount = bsls::AtomicOperations::getInt(&p->d_inUse.d_refCount);
-
-            if (refCount & 1) {
-                // The node is now free but not on the free list.  Try to take
-                // it.
-
-                if (refCount == bsls::AtomicOperations::testAndSwapInt(
-                                                    &p->d_inUse.d_refCount,
-                                                    refCount,
-                                                    refCount^1)) {
-                    // Taken!
-                    p->d_inUse.d_next_p = 0;  // not strictly necessary
-                    d_numAvailableObjects.addRelaxed(-1);
-                    return (TYPE*)(p + 1);                            // RETURN
-
-                }
-            }
-            else if (refCount == bsls::AtomicOperations::testAndSwapInt(
-                                                    &p->d_inUse.d_refCount,
-                                                    refCount,
-                                                    refCount - 2)) {
-                break;
-            }
+            p->d_inUse.d_next_p = 0;  // not strictly necessary
+            return (TYPE *)(p + 1);                                   // RETURN
         }
-    } while (1);
+    }
 
-    p->d_inUse.d_next_p = 0;  // not strictly necessary
-    d_numAvailableObjects.addRelaxed(-1);
-    return (TYPE *)(p+1);
+    return (TYPE *)(popFreeObject() + 1);
 }
 
 template <class TYPE, class CREATOR, class RESETTER>
@@ -1272,47 +1881,14 @@ void ObjectPool<TYPE, CREATOR, RESETTER>::releaseObject(TYPE *object)
     ObjectNode *current = (ObjectNode *)(void *)object - 1;
     d_objectResetter.object()(object);
 
-    int refCount = bsls::AtomicOperations::getIntRelaxed(
-                                                 &current->d_inUse.d_refCount);
-    do {
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-            refCount = bsls::AtomicOperations::testAndSwapInt(
-                                                  &current->d_inUse.d_refCount,
-                                                  2,
-                                                  0);
-            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-                break;
-            }
-        }
-
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-
-        const int oldRefCount = refCount;
-        refCount = bsls::AtomicOperations::testAndSwapInt(
-                                                &current->d_inUse.d_refCount,
-                                                refCount,
-                                                refCount - 1);
-        if (oldRefCount == refCount) {
-            // Someone else is still trying to pop this item.  Just let them
-            // have it.
-
-            d_numAvailableObjects.addRelaxed(1);
-            return;                                                   // RETURN
-        }
-
-    } while (1);
-
-    ObjectNode *head = d_freeObjectsList.loadRelaxed();
-    for (;;) {
-        current->d_inUse.d_next_p = head;
-        ObjectNode * const oldHead = head;
-        head = d_freeObjectsList.testAndSwap(head, current);
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(oldHead == head)) {
-            break;
-        }
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    ThreadCache *cache = currentThreadCache();
+    if (cache) {
+        cacheObject(current, cache);
+    }
+    else {
+        current->d_inUse.d_next_p = 0;
+        pushFreeObjects(current);
     }
-    d_numAvailableObjects.addRelaxed(1);
 }
 
 template <class TYPE, class CREATOR, class RESETTER>
@@ -1325,6 +1901,28 @@ void ObjectPool<TYPE, CREATOR, RESETTER>::reserveCapacity(int numObjects)
    }
 }
 
+template <class TYPE, class CREATOR, class RESETTER>
+int ObjectPool<TYPE, CREATOR, RESETTER>::setThreadCacheCapacity(int capacity)
+{
+    BSLS_ASSERT(0 <= capacity);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (capacity && !d_hasThreadCacheKey) {
+        if (0 != bslmt::ThreadUtil::createKey(
+                                        &d_threadCacheKey,
+                                        &bdlcc_ObjectPool_retireThreadCache)) {
+            return -1;                                                // RETURN
+        }
+        d_hasThreadCacheKey = true;
+    }
+
+    flushThreadCaches();
+    d_threadCacheCapacity = capacity;
+
+    return 0;
+}
+
 // ACCESSORS
 template <class TYPE, class CREATOR, class RESETTER>
 inline
@@ -1340,6 +1938,13 @@ int ObjectPool<TYPE, CREATOR, RESETTER>::numObjects() const
     return d_numObjects;
 }
 
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+int ObjectPool<TYPE, CREATOR, RESETTER>::threadCacheCapacity() const
+{
+    return d_threadCacheCapacity;
+}
+
 template <class TYPE, class CREATOR, class RESETTER>
 inline
 TYPE *ObjectPool<TYPE, CREATOR, RESETTER>::createObject()
@@ -36,6 +36,7 @@
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
 #include <bsl_functional.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
@@ -96,10 +97,12 @@ using namespace bsl;  // automatically added by script
 // [ 8] void increaseCapacity(int numObjects);
 // [ 9] void releaseObject(TYPE *objPtr);
 // [ 1] void reserveCapacity(int numObjects);
+// [18] int setThreadCacheCapacity(int capacity);
 //
 // ACCESSORS
 // [ 8] int numAvailableObjects() const;
 // [ 7] int numObjects() const;
+// [18] int threadCacheCapacity() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 3] Verify concurrent access to underlying free object list.
@@ -107,6 +110,8 @@ using namespace bsl;  // automatically added by script
 // [ 5] Verify concurrent access to underlying free object list.
 // [ 6] Verify concurrent access to underlying free object list.
 // [10] USAGE EXAMPLE
+// [18] THREAD CACHES
+// [-1] PERFORMANCE TEST: THREAD CACHES
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -496,6 +501,105 @@ void case13Processor(bdlcc::ObjectPool<Case13Type>  *mX,
 
 }  // close unnamed namespace
 
+// ============================================================================
+//                         CASE 18 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace OBJECTPOOL_TEST_CASE_18
+{
+
+struct Tracked {
+    // This 'struct' records whether an object obtained from a pool is in use,
+    // so that an object dispensed twice is detected.
+
+    bsls::AtomicInt d_inUse;
+    int             d_threadIndex;
+};
+
+typedef bdlcc::ObjectPool<Tracked> TrackedPool;
+
+void useObjects(TrackedPool *pool,
+                int          threadIndex,
+                int          numIterations,
+                int          numObjectsPerIteration)
+    // Obtain the specified 'numObjectsPerIteration' objects from the specified
+    // 'pool', verify that none of them is in use, and release them, the
+    // specified 'numIterations' times, tagging each object with the specified
+    // 'threadIndex'.
+{
+    enum { k_MAX_OBJECTS = 64 };
+    BSLS_ASSERT(numObjectsPerIteration <= k_MAX_OBJECTS);
+
+    Tracked *objects[k_MAX_OBJECTS];
+
+    for (int i = 0; i < numIterations; ++i) {
+        for (int j = 0; j < numObjectsPerIteration; ++j) {
+            objects[j] = pool->getObject();
+            const int wasInUse = objects[j]->d_inUse.swap(1);
+            LOOP2_ASSERTT(threadIndex, i, 0 == wasInUse);
+            objects[j]->d_threadIndex = threadIndex;
+        }
+        for (int j = 0; j < numObjectsPerIteration; ++j) {
+            LOOP2_ASSERTT(threadIndex,
+                          i,
+                          threadIndex == objects[j]->d_threadIndex);
+            objects[j]->d_inUse = 0;
+            pool->releaseObject(objects[j]);
+        }
+    }
+}
+
+void acquireObjects(TrackedPool  *pool,
+                    Tracked     **objects,
+                    int           numObjects)
+    // Load into the specified 'objects' array the specified 'numObjects'
+    // objects obtained from the specified 'pool'.
+{
+    for (int i = 0; i < numObjects; ++i) {
+        objects[i] = pool->getObject();
+        const int wasInUse = objects[i]->d_inUse.swap(1);
+        LOOP_ASSERTT(i, 0 == wasInUse);
+    }
+}
+
+}  // close namespace OBJECTPOOL_TEST_CASE_18
+
+// ============================================================================
+//                         CASE -1 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace OBJECTPOOL_TEST_CASE_MINUS_1
+{
+
+struct Payload {
+    // This 'struct' is a small object whose access touches a cache line.
+
+    char d_data[64];
+};
+
+typedef bdlcc::ObjectPool<Payload> PayloadPool;
+
+void exercisePool(PayloadPool     *pool,
+                  bslmt::Barrier  *barrier,
+                  int              numIterations)
+    // Wait on the specified 'barrier', then obtain two objects from the
+    // specified 'pool', write to them, and release them, the specified
+    // 'numIterations' times.
+{
+    barrier->wait();
+
+    for (int i = 0; i < numIterations; ++i) {
+        Payload *p1 = pool->getObject();
+        Payload *p2 = pool->getObject();
+        p1->d_data[0] = static_cast<char>(i);
+        p2->d_data[0] = static_cast<char>(i);
+        pool->releaseObject(p2);
+        pool->releaseObject(p1);
+    }
+}
+
+}  // close namespace OBJECTPOOL_TEST_CASE_MINUS_1
+
 //                         CASE 12 RELATED ENTITIES
 //-----------------------------------------------------------------------------
 
@@ -1301,6 +1405,251 @@ int main(int argc, char *argv[])
     using namespace bdlf::PlaceHolders;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 18: {
+        // --------------------------------------------------------------------
+        // THREAD CACHES
+        //
+        // Concerns:
+        //: 1 Thread caches are disabled by default, and
+        //:   'setThreadCacheCapacity' enables and disables them.
+        //:
+        //: 2 With thread caches enabled, an object released by a thread is
+        //:   the next object obtained by that thread, and the number of
+        //:   objects held in a thread cache never exceeds its capacity.
+        //:
+        //: 3 Disabling thread caches returns the cached objects to the pool.
+        //:
+        //: 4 The objects cached by a thread are returned to the pool when the
+        //:   thread exits, and its cache is reused by later threads.
+        //:
+        //: 5 Objects are never dispensed twice when many threads obtain and
+        //:   release objects concurrently, including objects released by a
+        //:   thread other than the one that obtained them.
+        //:
+        //: 6 The pool releases all memory, including thread caches, when
+        //:   destroyed with objects in thread caches.
+        //:
+        //: 7 An empty cache is refilled with all the objects of the free list
+        //:   if there are fewer than a batch, and the pool is replenished
+        //:   only if the free list is empty.
+        //
+        // Plan:
+        //: 1 Using a single thread, obtain and release objects and verify the
+        //:   identity of the obtained objects and the number of available
+        //:   objects.  (C-1..3)
+        //:
+        //: 2 Create threads that obtain and release objects and exit, and
+        //:   verify that all objects are available afterwards.  (C-4)
+        //:
+        //: 3 Create threads that concurrently obtain and release objects,
+        //:   marking each object in use, and threads whose objects are
+        //:   released by the main thread.  (C-5)
+        //:
+        //: 4 Use a test allocator to verify that no memory is leaked.  (C-6)
+        //:
+        //: 5 Using a pool replenished with fewer objects than twice a batch,
+        //:   obtain objects one at a time, and verify the number of objects
+        //:   and of available objects after each refill.  (C-7)
+        //
+        // Testing:
+        //   int setThreadCacheCapacity(int capacity);
+        //   int threadCacheCapacity() const;
+        //   THREAD CACHES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD CACHES" << endl
+                          << "=============" << endl;
+
+        using namespace OBJECTPOOL_TEST_CASE_18;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\nSingle thread." << endl;
+        {
+            enum { k_CAPACITY = 8, k_GROW_BY = 32 };
+
+            TrackedPool pool(k_GROW_BY, &ta);
+            ASSERT(0 == pool.threadCacheCapacity());
+
+            ASSERT(0 == pool.setThreadCacheCapacity(k_CAPACITY));
+            ASSERT(k_CAPACITY == pool.threadCacheCapacity());
+
+            // The first request fills the cache with half its capacity.
+
+            Tracked *p = pool.getObject();
+            ASSERT(k_GROW_BY                  == pool.numObjects());
+            ASSERT(k_GROW_BY - k_CAPACITY / 2 == pool.numAvailableObjects());
+
+            // A released object is the next one obtained.
+
+            pool.releaseObject(p);
+            ASSERT(p == pool.getObject());
+            ASSERT(k_GROW_BY - k_CAPACITY / 2 == pool.numAvailableObjects());
+
+            Tracked *objects[k_GROW_BY];
+            objects[0] = p;
+            for (int i = 1; i < k_GROW_BY; ++i) {
+                objects[i] = pool.getObject();
+                for (int j = 0; j < i; ++j) {
+                    LOOP2_ASSERT(i, j, objects[i] != objects[j]);
+                }
+            }
+            ASSERT(k_GROW_BY == pool.numObjects());
+            ASSERT(0         == pool.numAvailableObjects());
+
+            // Releasing all the objects leaves at most 'k_CAPACITY' objects
+            // in the cache.
+
+            for (int i = 0; i < k_GROW_BY; ++i) {
+                pool.releaseObject(objects[i]);
+
+                const int numCached = i + 1 - pool.numAvailableObjects();
+                LOOP2_ASSERT(i, numCached, 0 <= numCached);
+                LOOP2_ASSERT(i, numCached, numCached <= k_CAPACITY);
+            }
+            ASSERT(objects[k_GROW_BY - 1] == pool.getObject());
+            pool.releaseObject(objects[k_GROW_BY - 1]);
+
+            // Disabling the caches returns the cached objects to the pool.
+
+            ASSERT(0 == pool.setThreadCacheCapacity(0));
+            ASSERT(0         == pool.threadCacheCapacity());
+            ASSERT(k_GROW_BY == pool.numAvailableObjects());
+
+            p = pool.getObject();
+            ASSERT(k_GROW_BY - 1 == pool.numAvailableObjects());
+            pool.releaseObject(p);
+
+            // Re-enable the caches and destroy the pool with cached objects.
+
+            ASSERT(0 == pool.setThreadCacheCapacity(1));
+            p = pool.getObject();
+            pool.releaseObject(p);
+            ASSERT(k_GROW_BY - 1 == pool.numAvailableObjects());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nRefilling from a short free list." << endl;
+        {
+            enum { k_CAPACITY = 8, k_GROW_BY = 6, k_NUM_OBJECTS = 7 };
+
+            TrackedPool pool(k_GROW_BY, &ta);
+            ASSERT(0 == pool.setThreadCacheCapacity(k_CAPACITY));
+
+            // Expected number of objects in the pool, and available in its
+            // free list, after obtaining each object.  The first refill takes
+            // a batch of 'k_CAPACITY / 2' objects, the second one the two
+            // remaining objects, and the third one replenishes the pool.
+
+            static const int EXP_NUM_OBJECTS[k_NUM_OBJECTS] = {
+                6, 6, 6, 6, 6, 6, 12
+            };
+            static const int EXP_NUM_AVAILABLE[k_NUM_OBJECTS] = {
+                2, 2, 2, 2, 0, 0,  2
+            };
+
+            Tracked *objects[k_NUM_OBJECTS];
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                objects[i] = pool.getObject();
+                for (int j = 0; j < i; ++j) {
+                    LOOP2_ASSERT(i, j, objects[i] != objects[j]);
+                }
+                LOOP2_ASSERT(i, pool.numObjects(),
+                             EXP_NUM_OBJECTS[i] == pool.numObjects());
+                LOOP2_ASSERT(i, pool.numAvailableObjects(),
+                             EXP_NUM_AVAILABLE[i] ==
+                                                  pool.numAvailableObjects());
+            }
+
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                pool.releaseObject(objects[i]);
+            }
+            ASSERT(0 == pool.setThreadCacheCapacity(0));
+            ASSERT(pool.numObjects() == pool.numAvailableObjects());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nThread exit." << endl;
+        {
+            enum { k_CAPACITY = 16, k_NUM_THREADS = 4, k_NUM_ROUNDS = 3 };
+
+            TrackedPool pool(-4, &ta);
+            ASSERT(0 == pool.setThreadCacheCapacity(k_CAPACITY));
+
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                bslmt::ThreadGroup tg(&ta);
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == tg.addThread(bdlf::BindUtil::bind(&useObjects,
+                                                                  &pool,
+                                                                  i,
+                                                                  100,
+                                                                  10)));
+                }
+                tg.joinAll();
+
+                LOOP_ASSERT(round,
+                            pool.numObjects() == pool.numAvailableObjects());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nConcurrent use." << endl;
+        {
+            enum {
+                k_CAPACITY      = 8,
+                k_NUM_THREADS   = 6,
+                k_NUM_ACQUIRED  = 40
+            };
+
+            TrackedPool pool(-2, &ta);
+            ASSERT(0 == pool.setThreadCacheCapacity(k_CAPACITY));
+
+            bslmt::ThreadGroup tg(&ta);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == tg.addThread(bdlf::BindUtil::bind(&useObjects,
+                                                              &pool,
+                                                              i,
+                                                              2000,
+                                                              1 + i % 4)));
+            }
+
+            // Release, from the main thread, objects obtained by other
+            // threads.
+
+            const int numAcquired = k_NUM_ACQUIRED;
+
+            for (int i = 0; i < 20; ++i) {
+                Tracked *objects[k_NUM_ACQUIRED];
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &handle,
+                                      bdlf::BindUtil::bind(&acquireObjects,
+                                                           &pool,
+                                                           &objects[0],
+                                                           numAcquired)));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+                for (int j = 0; j < k_NUM_ACQUIRED; ++j) {
+                    objects[j]->d_inUse = 0;
+                    pool.releaseObject(objects[j]);
+                }
+            }
+            tg.joinAll();
+
+            // Only the main thread may still hold cached objects.
+
+            const int numCached = pool.numObjects()
+                                - pool.numAvailableObjects();
+            LOOP_ASSERT(numCached, 0 <= numCached);
+            LOOP_ASSERT(numCached, numCached <= k_CAPACITY);
+
+            ASSERT(0 == pool.setThreadCacheCapacity(0));
+            ASSERT(pool.numObjects() == pool.numAvailableObjects());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 17: {
         /////////////////////////////////////////////////////////
         // bdlma::Factory test
@@ -2596,6 +2945,68 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THREAD CACHES
+        //
+        // Concerns:
+        //: 1 Thread caches reduce the cost of obtaining and releasing objects
+        //:   when many threads use the pool concurrently.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, measure the time taken by
+        //:   all the threads to obtain and release objects, first with thread
+        //:   caches disabled, then with thread caches enabled.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THREAD CACHES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: THREAD CACHES" << endl
+                          << "===============================" << endl;
+
+        using namespace OBJECTPOOL_TEST_CASE_MINUS_1;
+
+        enum { k_MAX_NUM_THREADS = 8, k_NUM_ITERATIONS = 1000000 };
+
+        const int numIterations = k_NUM_ITERATIONS;
+
+        cout << "threads  iterations  no cache (ms)  cache (ms)" << endl;
+
+        for (int numThreads = 1;
+             numThreads <= k_MAX_NUM_THREADS;
+             numThreads *= 2) {
+            double elapsed[2];
+
+            for (int useCache = 0; useCache < 2; ++useCache) {
+                PayloadPool pool(-32);
+                if (useCache) {
+                    ASSERT(0 == pool.setThreadCacheCapacity(64));
+                }
+
+                bslmt::Barrier     barrier(numThreads + 1);
+                bslmt::ThreadGroup tg;
+                tg.addThreads(bdlf::BindUtil::bind(&exercisePool,
+                                                   &pool,
+                                                   &barrier,
+                                                   numIterations),
+                              numThreads);
+
+                const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+                barrier.wait();
+                tg.joinAll();
+                const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+                elapsed[useCache] = static_cast<double>(end - start) / 1.0e6;
+            }
+
+            cout << setw(7)  << numThreads    << "  "
+                 << setw(10) << numIterations << "  "
+                 << setw(13) << elapsed[0]    << "  "
+                 << setw(10) << elapsed[1]    << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
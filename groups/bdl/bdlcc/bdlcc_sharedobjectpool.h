@@ -98,6 +98,30 @@ BSLS_IDENT("$Id: $")
 // an implementation-defined default will be chosen.  The behavior is undefined
 // if growBy is 0.
 //
+///Per-Thread Caches
+///-----------------
+// 'setThreadCacheCapacity' enables the per-thread caches of the underlying
+// 'bdlcc::ObjectPool' (see {'bdlcc_objectpool'|Per-Thread Caches}), so that
+// obtaining and releasing objects does not contend on the free list shared by
+// all threads.  The 'ThreadCachePolicy' supplied with the capacity determines
+// which cache an object is returned to when its last shared pointer is
+// destroyed:
+//
+//: 'e_RELEASE_TO_CURRENT_THREAD':
+//:   The object is added to the cache of the thread that destroys the last
+//:   shared pointer.  This policy is the cheapest when objects are usually
+//:   released by the thread that obtained them.
+//:
+//: 'e_RELEASE_TO_ACQUIRING_THREAD':
+//:   The object is returned to the cache of the thread that obtained it from
+//:   the pool.  This policy suits a producer thread that obtains objects and
+//:   hands them to consumer threads that release them: the objects flow back
+//:   to the producer, which reuses them while they are still in the memory
+//:   local to it, instead of accumulating in the caches of the consumers.
+//
+// Note that, as for 'bdlcc::ObjectPool', if thread caches were ever enabled,
+// the pool must not be destroyed while a thread that used it may be exiting.
+//
 ///Usage
 ///-----
 // This component is intended to improve the efficiency of code which provides
@@ -289,6 +313,13 @@ class SharedObjectPool_Rep: public bslma::SharedPtrRep {
     bslalg::ConstructorProxy<RESETTER> d_objectResetter;
 
     PoolType                          *d_pool_p;   // object pool (held)
+
+    ObjectPool_ThreadCache            *d_threadCache_p;
+                                                   // cache to which this
+                                                   // object is released, or 0
+                                                   // for the cache of the
+                                                   // releasing thread (held)
+
     bsls::ObjectBuffer<TYPE>           d_instance; // area for embedded
                                                    // instance
 
@@ -333,6 +364,11 @@ class SharedObjectPool_Rep: public bslma::SharedPtrRep {
         // Invoke the object resetter specified at construction on the
         // associated object.
 
+    void setThreadCache(ObjectPool_ThreadCache *threadCache);
+        // Return this object to the specified 'threadCache' of the associated
+        // pool upon release, or to the cache of the releasing thread if
+        // 'threadCache' is 0.
+
     virtual void *getDeleter(const std::type_info& type);
         // Return NULL.  Shared object pools strictly control the delete policy
         // for their objects, and do not expose it to end users.
@@ -371,6 +407,10 @@ class SharedObjectPool {
 
     PoolType                    d_pool;           // object pool (owned)
 
+    int                         d_threadCachePolicy;
+                                                  // 'ThreadCachePolicy' of
+                                                  // the thread caches
+
   private:
     // NOT IMPLEMENTED
     SharedObjectPool(const SharedObjectPool&);
@@ -384,6 +424,17 @@ class SharedObjectPool {
     typedef CREATOR    CreatorType;
     typedef RESETTER   ResetterType;
 
+    enum ThreadCachePolicy {
+        // Enumerate the caches to which objects are returned when thread
+        // caches are enabled (see {Per-Thread Caches}).
+
+        e_RELEASE_TO_CURRENT_THREAD,   // cache of the thread releasing the
+                                       // object
+
+        e_RELEASE_TO_ACQUIRING_THREAD  // cache of the thread that obtained
+                                       // the object
+    };
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(SharedObjectPool,
                                    bslma::UsesBslmaAllocator);
@@ -431,7 +482,10 @@ class SharedObjectPool {
     ~SharedObjectPool();
         // Destroy this object pool.  All objects created by this pool are
         // destroyed (even if some of them are still in use) and memory is
-        // reclaimed.
+        // reclaimed.  If thread caches were ever enabled, the behavior is
+        // undefined if a thread (other than the calling thread) that used
+        // this pool exits concurrently with this call (see {Per-Thread
+        // Caches}).
 
     // MANIPULATORS
     bsl::shared_ptr<TYPE> getObject();
@@ -452,6 +506,19 @@ class SharedObjectPool {
         // from 'increaseCapacity' in that the number of created objects may be
         // less than 'growBy'.
 
+    int setThreadCacheCapacity(
+                  int               capacity,
+                  ThreadCachePolicy policy = e_RELEASE_TO_CURRENT_THREAD);
+        // Set the maximum number of objects held in the cache of each thread
+        // using this pool to the specified 'capacity', or disable thread
+        // caches if 'capacity' is 0, and return objects upon release to the
+        // caches indicated by the optionally specified 'policy' (see
+        // {Per-Thread Caches}).  Return 0 on success, and a non-zero value
+        // (with no effect) if thread caches cannot be enabled.  The behavior
+        // is undefined unless '0 <= capacity', no other method of this pool
+        // is invoked concurrently, and no object obtained from this pool is
+        // outstanding.
+
     // ACCESSORS
     int numAvailableObjects() const;
         // Return a *snapshot* of the number of objects available in this pool.
@@ -460,6 +527,14 @@ class SharedObjectPool {
         // Return the (instantaneous) number of objects managed by this pool.
         // This includes both the objects available in the pool and the objects
         // that were allocated from the pool and not yet released.
+
+    int threadCacheCapacity() const;
+        // Return the maximum number of objects held in the cache of each
+        // thread using this pool, or 0 if thread caches are disabled.
+
+    ThreadCachePolicy threadCachePolicy() const;
+        // Return the policy determining the caches to which objects are
+        // returned when thread caches are enabled.
 };
 
 // ============================================================================
@@ -481,6 +556,7 @@ SharedObjectPool_Rep<TYPE, RESETTER>::SharedObjectPool_Rep(
                      bslma::Allocator                          *basicAllocator)
 : d_objectResetter(objectResetter,basicAllocator)
 , d_pool_p(pool)
+, d_threadCache_p(0)
 {
     (*objectCreator)(d_instance.buffer(), basicAllocator);
 }
@@ -500,11 +576,19 @@ void SharedObjectPool_Rep<TYPE, RESETTER>::reset()
     d_objectResetter.object()(&d_instance.object());
 }
 
+template <class TYPE, class RESETTER>
+inline
+void SharedObjectPool_Rep<TYPE, RESETTER>::setThreadCache(
+                                           ObjectPool_ThreadCache *threadCache)
+{
+    d_threadCache_p = threadCache;
+}
+
 template <class TYPE, class RESETTER>
 inline
 void SharedObjectPool_Rep<TYPE, RESETTER>::disposeRep()
 {
-    d_pool_p->releaseObject(this);
+    d_pool_p->releaseObjectToThreadCache(this, d_threadCache_p);
 }
 
 template <class TYPE, class RESETTER>
@@ -582,6 +666,7 @@ SharedObjectPool<TYPE, CREATOR, RESETTER>::SharedObjectPool(
                              bdlf::PlaceHolders::_1,
                              bdlf::PlaceHolders::_2),
          growBy, basicAllocator)
+, d_threadCachePolicy(e_RELEASE_TO_CURRENT_THREAD)
 {
 }
 
@@ -596,6 +681,7 @@ SharedObjectPool<TYPE, CREATOR, RESETTER>::SharedObjectPool(
                              bdlf::PlaceHolders::_1,
                              bdlf::PlaceHolders::_2),
          growBy, basicAllocator)
+, d_threadCachePolicy(e_RELEASE_TO_CURRENT_THREAD)
 {
 }
 
@@ -611,6 +697,7 @@ SharedObjectPool<TYPE, CREATOR, RESETTER>::SharedObjectPool(
                              bdlf::PlaceHolders::_1,
                              bdlf::PlaceHolders::_2),
          growBy, basicAllocator)
+, d_threadCachePolicy(e_RELEASE_TO_CURRENT_THREAD)
 {
 }
 
@@ -625,6 +712,7 @@ SharedObjectPool<TYPE, CREATOR, RESETTER>::SharedObjectPool(
                              bdlf::PlaceHolders::_1,
                              bdlf::PlaceHolders::_2),
          -1, basicAllocator)
+, d_threadCachePolicy(e_RELEASE_TO_CURRENT_THREAD)
 {
 }
 }  // close package namespace
@@ -649,6 +737,10 @@ bsl::shared_ptr<TYPE>
 SharedObjectPool<TYPE, CREATOR, RESETTER>::getObject()
 {
     RepType *rep = d_pool.getObject();
+    rep->setThreadCache(e_RELEASE_TO_ACQUIRING_THREAD == d_threadCachePolicy
+                        ? d_pool.currentThreadCache()
+                        : 0);
+
     bslma::SharedPtrRep *genericRep = rep;
     genericRep->resetCountsRaw(1, 0);
 
@@ -671,6 +763,19 @@ SharedObjectPool<TYPE, CREATOR, RESETTER>::reserveCapacity(int growBy)
     d_pool.reserveCapacity(growBy);
 }
 
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+int SharedObjectPool<TYPE, CREATOR, RESETTER>::setThreadCacheCapacity(
+                                                    int               capacity,
+                                                    ThreadCachePolicy policy)
+{
+    const int rc = d_pool.setThreadCacheCapacity(capacity);
+    if (0 == rc) {
+        d_threadCachePolicy = policy;
+    }
+    return rc;
+}
+
 // ACCESSORS
 template <class TYPE, class CREATOR, class RESETTER>
 inline
@@ -685,6 +790,21 @@ int SharedObjectPool<TYPE, CREATOR, RESETTER>::numObjects() const
 {
     return d_pool.numObjects();
 }
+
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+int SharedObjectPool<TYPE, CREATOR, RESETTER>::threadCacheCapacity() const
+{
+    return d_pool.threadCacheCapacity();
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+typename SharedObjectPool<TYPE, CREATOR, RESETTER>::ThreadCachePolicy
+SharedObjectPool<TYPE, CREATOR, RESETTER>::threadCachePolicy() const
+{
+    return static_cast<ThreadCachePolicy>(d_threadCachePolicy);
+}
 }  // close package namespace
 
 }  // close enterprise namespace
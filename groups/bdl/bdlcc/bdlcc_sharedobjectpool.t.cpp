@@ -18,6 +18,7 @@
 
 #include <bdlma_concurrentpoolallocator.h>
 
+#include <bslmt_barrier.h>
 #include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_threadattributes.h>
@@ -32,9 +33,13 @@
 
 #include <bsls_spinlock.h>
 #include <bsls_stopwatch.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_functional.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_numeric.h>
 #include <bsl_string.h>
@@ -444,8 +449,14 @@ void LinkTestRun<POOL>::run()
 // CREATORS
 //
 // MANIPULATORS
+// [ 9] int setThreadCacheCapacity(int capacity, ThreadCachePolicy policy);
 //
 // ACCESSORS
+// [ 9] int threadCacheCapacity() const;
+// [ 9] ThreadCachePolicy threadCachePolicy() const;
+//-----------------------------------------------------------------------------
+// [ 9] THREAD CACHE POLICIES
+// [-3] PERFORMANCE TEST: THREAD CACHE POLICIES
 
 // ============================================================================
 //                   THREAD-SAFE OUTPUT AND ASSERT MACROS
@@ -722,6 +733,82 @@ class FastLinkPool {
    }
 };
 
+// ============================================================================
+//                         CASE 9 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace SHAREDOBJECTPOOL_TEST_CASE_9 {
+
+typedef bdlcc::SharedObjectPool<int>   IntPool;
+typedef bsl::shared_ptr<int>           IntPtr;
+typedef bsl::vector<IntPtr>            IntPtrs;
+
+void acquire(IntPool *pool, IntPtrs *objects, int numObjects)
+    // Append to the specified 'objects' the specified 'numObjects' objects
+    // obtained from the specified 'pool'.
+{
+    for (int i = 0; i < numObjects; ++i) {
+        objects->push_back(pool->getObject());
+    }
+}
+
+void release(IntPtrs *objects)
+    // Release the specified 'objects'.
+{
+    objects->clear();
+}
+
+void exchange(IntPool         *pool,
+              IntPtrs         *slots,
+              bslmt::Barrier  *barrier,
+              int              index,
+              int              numThreads,
+              int              numRounds)
+    // For the specified 'numRounds', obtain objects from the specified 'pool'
+    // into the element of the specified 'slots' at the specified 'index', wait
+    // on the specified 'barrier', release the objects obtained by the thread
+    // having the next index modulo the specified 'numThreads', and wait on
+    // 'barrier' again.
+{
+    for (int round = 0; round < numRounds; ++round) {
+        acquire(pool, &slots[index], 1 + (index + round) % 8);
+        barrier->wait();
+
+        slots[(index + 1) % numThreads].clear();
+        barrier->wait();
+    }
+}
+
+}  // close namespace SHAREDOBJECTPOOL_TEST_CASE_9
+
+// ============================================================================
+//                         CASE -3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace SHAREDOBJECTPOOL_TEST_CASE_MINUS_3 {
+
+typedef bdlcc::SharedObjectPool<bsl::string> StringPool;
+typedef bsl::shared_ptr<bsl::string>         StringPtr;
+
+void produceAndConsume(StringPool     *pool,
+                       bslmt::Barrier *barrier,
+                       int             numIterations)
+    // Wait on the specified 'barrier', then obtain objects from the specified
+    // 'pool', use them, and release them, the specified 'numIterations'
+    // times.
+{
+    barrier->wait();
+
+    for (int i = 0; i < numIterations; ++i) {
+        StringPtr s1 = pool->getObject();
+        StringPtr s2 = pool->getObject();
+        s1->assign(1, 'a');
+        s2->assign(1, 'b');
+    }
+}
+
+}  // close namespace SHAREDOBJECTPOOL_TEST_CASE_MINUS_3
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -735,6 +822,182 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // THREAD CACHE POLICIES
+        //
+        // Concerns:
+        //: 1 Thread caches are disabled by default, and
+        //:   'setThreadCacheCapacity' sets the capacity and the policy.
+        //:
+        //: 2 With 'e_RELEASE_TO_CURRENT_THREAD', an object released by
+        //:   another thread is cached by that thread, and returned to the
+        //:   pool when that thread exits.
+        //:
+        //: 3 With 'e_RELEASE_TO_ACQUIRING_THREAD', an object released by
+        //:   another thread is returned to the cache of the thread that
+        //:   obtained it, and is reused by that thread.
+        //:
+        //: 4 An object released after the thread that obtained it has exited
+        //:   is returned to the pool.
+        //:
+        //: 5 Objects are not lost when many threads concurrently release
+        //:   objects obtained by other threads.
+        //
+        // Plan:
+        //: 1 Obtain objects in the main thread, release them in another
+        //:   thread, and verify the number of available objects and the
+        //:   identity of the objects obtained next, for both policies.
+        //:   (C-1..3)
+        //:
+        //: 2 Obtain objects in another thread, let it exit, and release the
+        //:   objects in the main thread.  (C-4)
+        //:
+        //: 3 Create threads that repeatedly release the objects obtained by
+        //:   one another, and verify that all objects are available once
+        //:   they exit.  (C-5)
+        //
+        // Testing:
+        //   int setThreadCacheCapacity(int capacity, ThreadCachePolicy);
+        //   int threadCacheCapacity() const;
+        //   ThreadCachePolicy threadCachePolicy() const;
+        //   THREAD CACHE POLICIES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD CACHE POLICIES" << endl
+                          << "=====================" << endl;
+
+        using namespace SHAREDOBJECTPOOL_TEST_CASE_9;
+
+        enum { k_CAPACITY = 8, k_NUM_OBJECTS = k_CAPACITY / 2 };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\nRelease to the current thread." << endl;
+        {
+            IntPool pool(32, &ta);
+            ASSERT(0 == pool.threadCacheCapacity());
+            ASSERT(IntPool::e_RELEASE_TO_CURRENT_THREAD ==
+                                                    pool.threadCachePolicy());
+
+            ASSERT(0 == pool.setThreadCacheCapacity(k_CAPACITY));
+            ASSERT(k_CAPACITY == pool.threadCacheCapacity());
+            ASSERT(IntPool::e_RELEASE_TO_CURRENT_THREAD ==
+                                                    pool.threadCachePolicy());
+
+            // The main thread obtains all the objects of its cache.
+
+            IntPtrs objects(&ta);
+            acquire(&pool, &objects, k_NUM_OBJECTS);
+            ASSERT(32 - k_NUM_OBJECTS == pool.numAvailableObjects());
+
+            // The objects are cached by the releasing thread, and returned to
+            // the pool when it exits.
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                   &handle,
+                                   bdlf::BindUtil::bind(&release, &objects)));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERT(objects.empty());
+            ASSERT(32 == pool.numAvailableObjects());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nRelease to the acquiring thread." << endl;
+        {
+            IntPool pool(32, &ta);
+            ASSERT(0 == pool.setThreadCacheCapacity(
+                                     k_CAPACITY,
+                                     IntPool::e_RELEASE_TO_ACQUIRING_THREAD));
+            ASSERT(k_CAPACITY == pool.threadCacheCapacity());
+            ASSERT(IntPool::e_RELEASE_TO_ACQUIRING_THREAD ==
+                                                    pool.threadCachePolicy());
+
+            IntPtrs objects(&ta);
+            acquire(&pool, &objects, k_NUM_OBJECTS);
+            ASSERT(32 - k_NUM_OBJECTS == pool.numAvailableObjects());
+
+            bsl::vector<int *> addresses(&ta);
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                addresses.push_back(objects[i].get());
+            }
+
+            // The objects return to the cache of the main thread, and are the
+            // next objects it obtains.
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                   &handle,
+                                   bdlf::BindUtil::bind(&release, &objects)));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERT(32 - k_NUM_OBJECTS == pool.numAvailableObjects());
+
+            acquire(&pool, &objects, k_NUM_OBJECTS);
+            ASSERT(32 - k_NUM_OBJECTS == pool.numAvailableObjects());
+
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                int *address = objects[i].get();
+                LOOP_ASSERT(i, addresses.end() != bsl::find(addresses.begin(),
+                                                            addresses.end(),
+                                                            address));
+            }
+            objects.clear();
+
+            // Objects obtained by a thread that has exited are returned to
+            // the pool.
+
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                &handle,
+                                bdlf::BindUtil::bind(&acquire,
+                                                     &pool,
+                                                     &objects,
+                                                     (int)k_NUM_OBJECTS)));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            const int numAvailable = pool.numAvailableObjects();
+            objects.clear();
+            ASSERT(numAvailable + k_NUM_OBJECTS ==
+                                                   pool.numAvailableObjects());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nConcurrent release." << endl;
+
+        for (int policy = 0; policy < 2; ++policy) {
+            enum { k_NUM_THREADS = 5, k_NUM_ROUNDS = 200 };
+
+            IntPool pool(-4, &ta);
+            ASSERT(0 == pool.setThreadCacheCapacity(
+                                  k_CAPACITY,
+                                  policy
+                                  ? IntPool::e_RELEASE_TO_ACQUIRING_THREAD
+                                  : IntPool::e_RELEASE_TO_CURRENT_THREAD));
+
+            bsl::vector<IntPtrs> slots(k_NUM_THREADS, IntPtrs(&ta), &ta);
+            bslmt::Barrier       barrier(k_NUM_THREADS);
+            bslmt::ThreadGroup   tg(&ta);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == tg.addThread(bdlf::BindUtil::bind(
+                                                      &exchange,
+                                                      &pool,
+                                                      &slots[0],
+                                                      &barrier,
+                                                      i,
+                                                      (int)k_NUM_THREADS,
+                                                      (int)k_NUM_ROUNDS)));
+            }
+            tg.joinAll();
+
+            LOOP_ASSERT(policy,
+                        pool.numObjects() == pool.numAvailableObjects());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 8: {
            //////////////////////////////////////////////////////
            // Constructor overloads
@@ -1242,6 +1505,77 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: THREAD CACHE POLICIES
+        //
+        // Concerns:
+        //: 1 Thread caches reduce the cost of obtaining and releasing shared
+        //:   objects when many threads use the pool concurrently.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, measure the time taken by
+        //:   all the threads to obtain and release objects with thread caches
+        //:   disabled, and with thread caches enabled under each policy.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: THREAD CACHE POLICIES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: THREAD CACHE POLICIES" << endl
+                          << "=======================================" << endl;
+
+        using namespace SHAREDOBJECTPOOL_TEST_CASE_MINUS_3;
+
+        enum {
+            k_MAX_NUM_THREADS = 8,
+            k_NUM_ITERATIONS  = 500000,
+            k_CAPACITY        = 64
+        };
+
+        const int numIterations = k_NUM_ITERATIONS;
+
+        cout << "threads  no cache (ms)  current (ms)  acquiring (ms)" << endl;
+
+        for (int numThreads = 1;
+             numThreads <= k_MAX_NUM_THREADS;
+             numThreads *= 2) {
+            double elapsed[3];
+
+            for (int mode = 0; mode < 3; ++mode) {
+                StringPool pool(-32);
+                if (1 == mode) {
+                    ASSERT(0 == pool.setThreadCacheCapacity(k_CAPACITY));
+                }
+                else if (2 == mode) {
+                    ASSERT(0 == pool.setThreadCacheCapacity(
+                                  k_CAPACITY,
+                                  StringPool::e_RELEASE_TO_ACQUIRING_THREAD));
+                }
+
+                bslmt::Barrier     barrier(numThreads + 1);
+                bslmt::ThreadGroup tg;
+                tg.addThreads(bdlf::BindUtil::bind(&produceAndConsume,
+                                                   &pool,
+                                                   &barrier,
+                                                   numIterations),
+                              numThreads);
+
+                const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+                barrier.wait();
+                tg.joinAll();
+                const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+                elapsed[mode] = static_cast<double>(end - start) / 1.0e6;
+            }
+
+            cout << setw(7)  << numThreads << "  "
+                 << setw(13) << elapsed[0] << "  "
+                 << setw(12) << elapsed[1] << "  "
+                 << setw(14) << elapsed[2] << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -22,7 +22,7 @@ BSLS_IDENT("$Id: $")
 //  bdlcc::SkipListPair:       type for opaque pointers
 //  bdlcc::SkipListPairHandle: scope mechanism for safe item references
 //
-//@SEE_ALSO:
+//@SEE_ALSO: bdlcc_concurrentskiplist
 //
 //@DESCRIPTION: This component provides a thread-safe value-semantic
 // associative Skip List container.  A Skip List stores objects of a
@@ -30,6 +30,18 @@ void *BufferedSequentialAllocator::allocate(size_type size)
     return d_pool.allocate(size);
 }
 
+void *BufferedSequentialAllocator::allocateAndExpand(size_type *size)
+{
+    BSLS_ASSERT(size);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == *size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    return d_pool.allocateAndExpand(size);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
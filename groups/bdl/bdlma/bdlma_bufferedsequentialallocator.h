@@ -24,7 +24,10 @@ BSLS_IDENT("$Id: $")
 //  ( bdlma::BufferedSequentialAllocator )
 //   `----------------------------------'
 //                   |        ctor/dtor
-//                   |
+//                   |        allocateAndExpand
+//                   |        checkpoint/rewind
+//                   |        grow
+//                   |        truncate
 //                   V
 //       ,-----------------------.
 //      ( bdlma::ManagedAllocator )
@@ -69,6 +72,11 @@ BSLS_IDENT("$Id: $")
 // 'allocate' with the pool directly.  However, the allocator interface is much
 // more widely accepted across objects, and hence more general purpose.
 //
+// As with 'bdlma::BufferedSequentialPool', a 'bdlma::SequentialCheckpoint'
+// obtained from 'checkpoint' can be supplied to 'rewind' to release only the
+// memory allocated after the checkpoint was taken, and the most recently
+// allocated block can be resized in place using 'grow' and 'truncate'.
+//
 ///Optional 'maxBufferSize' Parameter
 /// - - - - - - - - - - - - - - - - -
 // An optional 'maxBufferSize' parameter can be supplied at construction to
@@ -324,12 +332,34 @@ class BufferedSequentialAllocator : public ManagedAllocator {
         // memory space in the external buffer supplied at construction, use
         // memory obtained from the allocator supplied at construction.
 
+    void *allocateAndExpand(size_type *size);
+        // Return the address of a contiguous block of memory of at least the
+        // specified '*size' (in bytes), and load the actual amount of memory
+        // allocated into '*size'.  If '*size' is 0, return 0 with no effect.
+        // If the allocation request exceeds the remaining free memory space in
+        // the current buffer, use memory obtained from the allocator supplied
+        // at construction.
+
     virtual void deallocate(void *address);
         // This method has no effect on the memory block at the specified
         // 'address' as all memory allocated by this allocator is managed.  The
         // behavior is undefined unless 'address' is 0, or was allocated by
         // this allocator and has not already been deallocated.
 
+    int grow(void *address, int originalSize, int newSize);
+        // Increase the amount of memory allocated at the specified 'address'
+        // from the specified 'originalSize' (in bytes) to the specified
+        // 'newSize' (in bytes), without moving it.  Return 'newSize' after
+        // growing, or 'originalSize' if the memory at 'address' cannot be
+        // grown in place.  This method can only 'grow' the memory block
+        // returned by the most recent 'allocate' request from this allocator,
+        // provided that the current buffer has sufficient remaining memory,
+        // and otherwise has no effect.  The behavior is undefined unless the
+        // memory at 'address' was originally allocated by this allocator, the
+        // size of the memory block at 'address' is 'originalSize',
+        // 'originalSize <= newSize', and neither 'release' nor 'rewind' was
+        // called after allocating the memory block at 'address'.
+
     virtual void release();
         // Release all memory currently allocated through this allocator.  This
         // method deallocates all memory (if any) allocated with the allocator
@@ -337,6 +367,32 @@ class BufferedSequentialAllocator : public ManagedAllocator {
         // external buffer supplied at construction available for subsequent
         // allocations, but has no effect on the contents of the buffer.  Note
         // that this allocator is reset to its initial state by this method.
+
+    void rewind(const SequentialCheckpoint& checkpoint);
+        // Release all memory allocated through this allocator after the
+        // specified 'checkpoint' was obtained from it, retaining the memory
+        // allocated before.  The behavior is undefined unless 'checkpoint' was
+        // obtained from this allocator, and neither 'release' nor 'rewind' (to
+        // an earlier checkpoint) was called afterwards.
+
+    int truncate(void *address, int originalSize, int newSize);
+        // Reduce the amount of memory allocated at the specified 'address' of
+        // the specified 'originalSize' (in bytes) to the specified 'newSize'.
+        // Return 'newSize' after truncating, or 'originalSize' if the memory
+        // at 'address' cannot be truncated.  This method can only 'truncate'
+        // the memory block returned by the most recent 'allocate' request from
+        // this allocator, and otherwise has no effect.  The behavior is
+        // undefined unless the memory at 'address' was originally allocated by
+        // this allocator, the size of the memory block at 'address' is
+        // 'originalSize', 'newSize <= originalSize', '0 <= newSize', and
+        // neither 'release' nor 'rewind' was called after allocating the
+        // memory block at 'address'.
+
+    // ACCESSORS
+    SequentialCheckpoint checkpoint() const;
+        // Return a checkpoint recording the current allocation state of this
+        // allocator, which can later be supplied to 'rewind' to release all
+        // memory allocated after this call.
 };
 
 // ============================================================================
@@ -443,12 +499,42 @@ void BufferedSequentialAllocator::deallocate(void *)
 {
 }
 
+inline
+int BufferedSequentialAllocator::grow(void *address,
+                                      int   originalSize,
+                                      int   newSize)
+{
+    return d_pool.grow(address, originalSize, newSize);
+}
+
 inline
 void BufferedSequentialAllocator::release()
 {
     d_pool.release();
 }
 
+inline
+void BufferedSequentialAllocator::rewind(
+                                        const SequentialCheckpoint& checkpoint)
+{
+    d_pool.rewind(checkpoint);
+}
+
+inline
+int BufferedSequentialAllocator::truncate(void *address,
+                                          int   originalSize,
+                                          int   newSize)
+{
+    return d_pool.truncate(address, originalSize, newSize);
+}
+
+// ACCESSORS
+inline
+SequentialCheckpoint BufferedSequentialAllocator::checkpoint() const
+{
+    return d_pool.checkpoint();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -69,11 +69,18 @@ using namespace bsl;
 //
 // // MANIPULATORS
 // [ 2] void *allocate(size_type size);
+// [ 6] void *allocateAndExpand(size_type *size);
 // [ 3] void deallocate(void *address);
+// [ 6] int grow(void *address, int originalSize, int newSize);
 // [ 4] void release();
+// [ 6] void rewind(const SequentialCheckpoint& checkpoint);
+// [ 6] int truncate(void *address, int originalSize, int newSize);
+//
+// // ACCESSORS
+// [ 6] SequentialCheckpoint checkpoint() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE TEST
+// [ 7] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -246,7 +253,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -329,6 +336,84 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'checkpoint', 'rewind', AND RESIZING TEST
+        //
+        // Concerns:
+        //   That 'allocateAndExpand', 'checkpoint', 'grow', 'rewind', and
+        //   'truncate' are correctly forwarded to the underlying buffered
+        //   sequential pool.
+        //
+        // Plan:
+        //   Since 'bdlma::BufferedSequentialPool' is thoroughly tested, we
+        //   perform the same sequence of operations on a buffered sequential
+        //   allocator and on a buffered sequential pool, each using its own
+        //   external buffer and test allocator, and verify that the results
+        //   and the number of blocks in use are the same.
+        //
+        // Testing:
+        //   void *allocateAndExpand(size_type *size);
+        //   SequentialCheckpoint checkpoint() const;
+        //   int grow(void *address, int originalSize, int newSize);
+        //   void rewind(const SequentialCheckpoint& checkpoint);
+        //   int truncate(void *address, int originalSize, int newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'checkpoint', 'rewind', AND RESIZING TEST"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        enum { k_SIZE = 64 };
+
+        bsls::AlignedBuffer<k_SIZE> storageX;
+        bsls::AlignedBuffer<k_SIZE> storageP;
+
+        bslma::TestAllocator poolAllocator(veryVeryVeryVerbose);
+
+        Obj mX(storageX.buffer(), k_SIZE, &objectAllocator);
+        bdlma::BufferedSequentialPool pool(storageP.buffer(),
+                                           k_SIZE,
+                                           &poolAllocator);
+
+        const bdlma::SequentialCheckpoint CX = mX.checkpoint();
+        const bdlma::SequentialCheckpoint CP = pool.checkpoint();
+
+        ASSERT(storageX.buffer() == CX.buffer());
+
+        char *x1 = static_cast<char *>(mX.allocate(8));
+        char *p1 = static_cast<char *>(pool.allocate(8));
+
+        ASSERT(mX.grow(x1, 8, 16)    == pool.grow(p1, 8, 16));
+        ASSERT(mX.truncate(x1, 16, 4) == pool.truncate(p1, 16, 4));
+
+        Obj::size_type sizeX = 1;
+        bsls::Types::size_type sizeP = 1;
+
+        ASSERT(x1 + 4 == mX.allocateAndExpand(&sizeX));
+        ASSERT(p1 + 4 == pool.allocateAndExpand(&sizeP));
+        ASSERT(sizeP  == sizeX);
+
+        Obj::size_type zero = 0;
+        ASSERT(0 == mX.allocateAndExpand(&zero));
+        ASSERT(0 == zero);
+
+        mX.allocate(k_SIZE);
+        pool.allocate(k_SIZE);
+
+        ASSERT(1 == objectAllocator.numBlocksInUse());
+        ASSERT(1 == poolAllocator.numBlocksInUse());
+
+        mX.rewind(CX);
+        pool.rewind(CP);
+
+        ASSERT(0  == objectAllocator.numBlocksInUse());
+        ASSERT(0  == poolAllocator.numBlocksInUse());
+        ASSERT(CX == mX.checkpoint());
+        ASSERT(x1 == mX.allocate(8));
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // DTOR TEST
@@ -206,6 +206,27 @@ void *BufferedSequentialPool::allocate(bsls::Types::size_type size)
     return d_buffer.allocateRaw(static_cast<int>(size));
 }
 
+void *BufferedSequentialPool::allocateAndExpand(bsls::Types::size_type *size)
+{
+    BSLS_ASSERT(size);
+    BSLS_ASSERT(0 < *size);
+
+    void *result = allocate(*size);
+    *size = d_buffer.expand(result, static_cast<int>(*size));
+
+    return result;
+}
+
+void BufferedSequentialPool::rewind(const SequentialCheckpoint& checkpoint)
+{
+    BSLS_ASSERT(checkpoint.buffer());
+
+    d_blockList.releaseAfter(checkpoint.block());
+
+    d_buffer.replaceBuffer(checkpoint.buffer(), checkpoint.bufferSize());
+    d_buffer.rewind(checkpoint.cursor());
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -37,6 +37,16 @@ BSLS_IDENT("$Id: $")
 // Once the external buffer is exhausted, subsequent allocation requests
 // require dynamic memory allocation, and the performance of the pool degrades.
 //
+// The memory allocated after a 'bdlma::SequentialCheckpoint' is obtained from
+// the 'checkpoint' accessor can be released, leaving the memory allocated
+// before intact, by supplying that checkpoint to 'rewind'.  Rewinding to a
+// checkpoint taken while the pool was still allocating from the external
+// buffer returns all dynamically-allocated buffers obtained since, so that
+// subsequent allocations are again served from the external buffer.  The most
+// recently allocated memory block can also be resized in place using 'grow'
+// and 'truncate', and 'allocateAndExpand' returns the largest block that fits
+// in the current buffer.
+//
 ///Optional 'maxBufferSize' Parameter
 /// - - - - - - - - - - - - - - - - -
 // An optional 'maxBufferSize' parameter can be supplied at construction to
@@ -311,6 +321,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlma_infrequentdeleteblocklist.h>
 #endif
 
+#ifndef INCLUDED_BDLMA_SEQUENTIALCHECKPOINT
+#include <bdlma_sequentialcheckpoint.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -470,6 +484,15 @@ class BufferedSequentialPool {
         // memory obtained from the allocator supplied at construction.  The
         // behavior is undefined unless '0 < size'.
 
+    void *allocateAndExpand(bsls::Types::size_type *size);
+        // Return the address of a contiguous block of memory of at least the
+        // specified '*size' (in bytes), and load the actual amount of memory
+        // allocated in '*size'.  The block extends to the end of the buffer
+        // from which it is allocated.  If the allocation request exceeds the
+        // remaining free memory space in the current buffer, use memory
+        // obtained from the allocator supplied at construction.  The behavior
+        // is undefined unless '0 < *size'.
+
     template <class TYPE>
     void deleteObjectRaw(const TYPE *object);
         // Destroy the specified 'object'.  Note that memory associated with
@@ -482,6 +505,20 @@ class BufferedSequentialPool {
         // effect as the 'deleteObjectRaw' method (since no deallocation is
         // involved), and exists for consistency across memory pools.
 
+    int grow(void *address, int originalSize, int newSize);
+        // Increase the amount of memory allocated at the specified 'address'
+        // from the specified 'originalSize' (in bytes) to the specified
+        // 'newSize' (in bytes), without moving it.  Return 'newSize' after
+        // growing, or 'originalSize' if the memory block at 'address' cannot
+        // be grown in place.  This method can only 'grow' the memory block
+        // returned by the most recent 'allocate' request from this pool,
+        // provided that the current buffer has sufficient remaining memory,
+        // and otherwise has no effect.  The behavior is undefined unless the
+        // memory at 'address' was originally allocated by this pool, the size
+        // of the memory block at 'address' is 'originalSize',
+        // 'originalSize <= newSize', and neither 'release' nor 'rewind' was
+        // called after allocating the memory block at 'address'.
+
     void release();
         // Release all memory currently allocated through this pool.  This
         // method deallocates all memory (if any) allocated with the allocator
@@ -489,6 +526,36 @@ class BufferedSequentialPool {
         // external buffer supplied at construction available for subsequent
         // allocations, but has no effect on the contents of the buffer.  Note
         // that this pool is reset to its initial state by this method.
+
+    void rewind(const SequentialCheckpoint& checkpoint);
+        // Release all memory allocated through this pool after the specified
+        // 'checkpoint' was obtained from it, retaining the memory allocated
+        // before.  Dynamically-allocated buffers obtained after 'checkpoint'
+        // was taken are returned to the allocator supplied at construction,
+        // and subsequent allocations are satisfied from the buffer (possibly
+        // the external buffer supplied at construction) that was current when
+        // 'checkpoint' was taken.  The behavior is undefined unless
+        // 'checkpoint' was obtained from this pool, and neither 'release' nor
+        // 'rewind' (to an earlier checkpoint) was called afterwards.
+
+    int truncate(void *address, int originalSize, int newSize);
+        // Reduce the amount of memory allocated at the specified 'address' of
+        // the specified 'originalSize' (in bytes) to the specified 'newSize'.
+        // Return 'newSize' after truncating, or 'originalSize' if the memory
+        // block at 'address' cannot be truncated.  This method can only
+        // 'truncate' the memory block returned by the most recent 'allocate'
+        // request from this pool, and otherwise has no effect.  The behavior
+        // is undefined unless the memory at 'address' was originally allocated
+        // by this pool, the size of the memory block at 'address' is
+        // 'originalSize', 'newSize <= originalSize', '0 <= newSize', and
+        // neither 'release' nor 'rewind' was called after allocating the
+        // memory block at 'address'.
+
+    // ACCESSORS
+    SequentialCheckpoint checkpoint() const;
+        // Return a checkpoint recording the current allocation state of this
+        // pool, which can later be supplied to 'rewind' to release all memory
+        // allocated after this call.
 };
 
 }  // close package namespace
@@ -594,6 +661,16 @@ void BufferedSequentialPool::deleteObject(const TYPE *object)
     deleteObjectRaw(object);
 }
 
+inline
+int BufferedSequentialPool::grow(void *address, int originalSize, int newSize)
+{
+    BSLS_ASSERT_SAFE(address);
+    BSLS_ASSERT_SAFE(0 <= originalSize);
+    BSLS_ASSERT_SAFE(originalSize <= newSize);
+
+    return d_buffer.grow(address, originalSize, newSize);
+}
+
 inline
 void BufferedSequentialPool::release()
 {
@@ -601,6 +678,28 @@ void BufferedSequentialPool::release()
     d_blockList.release();
 }
 
+inline
+int BufferedSequentialPool::truncate(void *address,
+                                     int   originalSize,
+                                     int   newSize)
+{
+    BSLS_ASSERT_SAFE(address);
+    BSLS_ASSERT_SAFE(0 <= newSize);
+    BSLS_ASSERT_SAFE(newSize <= originalSize);
+
+    return d_buffer.truncate(address, originalSize, newSize);
+}
+
+// ACCESSORS
+inline
+SequentialCheckpoint BufferedSequentialPool::checkpoint() const
+{
+    return SequentialCheckpoint(d_blockList.mostRecentBlock(),
+                                d_buffer.buffer(),
+                                d_buffer.bufferSize(),
+                                d_buffer.cursor());
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
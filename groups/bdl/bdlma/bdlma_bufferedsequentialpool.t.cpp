@@ -65,14 +65,21 @@ using namespace bsl;
 //
 // // MANIPULATORS
 // [ 4] void *allocate(size_type size);
+// [ 9] void *allocateAndExpand(size_type *size);
 // [ 6] void deleteObjectRaw(const TYPE *object);
 // [ 6] void deleteObject(const TYPE *object);
+// [ 9] int grow(void *address, int originalSize, int newSize);
 // [ 5] void release();
+// [ 9] void rewind(const SequentialCheckpoint& checkpoint);
+// [ 9] int truncate(void *address, int originalSize, int newSize);
+//
+// // ACCESSORS
+// [ 9] SequentialCheckpoint checkpoint() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HELPER FUNCTION: 'int blockSize(numBytes)'
 // [ 8] FREE FUNCTION: 'operator new(size_t, bdlma::BufferedSequentialPool)'
-// [ 9] USAGE TEST
+// [10] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -488,7 +495,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -511,6 +518,138 @@ int main(int argc, char *argv[])
                           << "=============" << endl;
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // 'checkpoint', 'rewind', AND RESIZING TEST
+        //
+        // Concerns:
+        //   1. That rewinding to a checkpoint taken while allocating from the
+        //      external buffer returns all dynamically-allocated buffers, and
+        //      that subsequent allocations are again satisfied from the
+        //      external buffer.
+        //
+        //   2. That rewinding to a checkpoint taken while allocating from a
+        //      dynamically-allocated buffer retains that buffer.
+        //
+        //   3. That 'grow' and 'truncate' resize the most recent allocation in
+        //      place, and have no effect on other allocations.
+        //
+        //   4. That 'allocateAndExpand' returns a block extending to the end
+        //      of the current buffer.
+        //
+        // Plan:
+        //   Create a 'bdlma::BufferedSequentialPool' using a test allocator
+        //   and take checkpoints before and after exhausting the external
+        //   buffer.  Rewind to each checkpoint and verify, using the test
+        //   allocator, the number of blocks in use and the address of the next
+        //   allocation.  Then exercise 'grow', 'truncate', and
+        //   'allocateAndExpand', verifying the address of the next allocation
+        //   after each.
+        //
+        // Testing:
+        //   void *allocateAndExpand(size_type *size);
+        //   SequentialCheckpoint checkpoint() const;
+        //   int grow(void *address, int originalSize, int newSize);
+        //   void rewind(const SequentialCheckpoint& checkpoint);
+        //   int truncate(void *address, int originalSize, int newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'checkpoint', 'rewind', AND RESIZING TEST"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        if (verbose) cout << "\nTesting 'checkpoint' and 'rewind'." << endl;
+        {
+            Obj mX(buffer,
+                   k_BUFFER_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   bsls::Alignment::BSLS_BYTEALIGNED,
+                   &objectAllocator);
+            const Obj& X = mX;
+
+            const bdlma::SequentialCheckpoint C0 = X.checkpoint();
+            ASSERT(buffer == C0.buffer());
+
+            ASSERT(buffer == mX.allocate(k_BUFFER_SIZE / 2));
+
+            const bdlma::SequentialCheckpoint C1 = X.checkpoint();
+
+            mX.allocate(k_BUFFER_SIZE);
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+
+            const bdlma::SequentialCheckpoint C2 = X.checkpoint();
+
+            void *a = mX.allocate(8);
+            mX.allocate(k_BUFFER_SIZE * 2);
+            ASSERT(3 == objectAllocator.numBlocksInUse());
+
+            mX.rewind(C2);
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+            ASSERT(a == mX.allocate(8));
+
+            mX.rewind(C1);
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+            ASSERT(buffer + k_BUFFER_SIZE / 2 == mX.allocate(8));
+
+            mX.allocate(k_BUFFER_SIZE);
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+
+            mX.rewind(C0);
+            ASSERT(0      == objectAllocator.numBlocksInUse());
+            ASSERT(C0     == X.checkpoint());
+            ASSERT(buffer == mX.allocate(8));
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'grow' and 'truncate'." << endl;
+        {
+            Obj mX(buffer,
+                   k_BUFFER_SIZE,
+                   bsls::Alignment::BSLS_BYTEALIGNED,
+                   &objectAllocator);
+
+            char *a1 = static_cast<char *>(mX.allocate(8));
+            char *a2 = static_cast<char *>(mX.allocate(8));
+
+            ASSERT(8  == mX.grow(a1, 8, 16));
+            ASSERT(8  == mX.truncate(a1, 8, 4));
+
+            ASSERT(32 == mX.grow(a2, 8, 32));
+            ASSERT(a2 + 32 == mX.allocate(1));
+
+            char *a3 = static_cast<char *>(mX.allocate(16));
+            ASSERT(4 == mX.truncate(a3, 16, 4));
+            ASSERT(a3 + 4 == mX.allocate(1));
+
+            char *a4 = static_cast<char *>(mX.allocate(1));
+            ASSERT(1 == mX.grow(a4, 1, k_BUFFER_SIZE));
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'allocateAndExpand'." << endl;
+        {
+            Obj mX(buffer,
+                   k_BUFFER_SIZE,
+                   bsls::Alignment::BSLS_BYTEALIGNED,
+                   &objectAllocator);
+
+            mX.allocate(16);
+
+            bsls::Types::size_type size = 8;
+            char *a = static_cast<char *>(mX.allocateAndExpand(&size));
+            ASSERT(buffer + 16        == a);
+            ASSERT(k_BUFFER_SIZE - 16 == static_cast<int>(size));
+
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+            mX.allocate(1);
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // GLOBAL OPERATOR NEW TEST
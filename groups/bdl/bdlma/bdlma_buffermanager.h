@@ -42,7 +42,10 @@ BSLS_IDENT("$Id: $")
 // The 'release' method resets the buffer manager such that the memory within
 // the entire external buffer will be made available for subsequent
 // allocations.  Note that individually allocated memory blocks cannot be
-// separately deallocated.
+// separately deallocated.  However, the 'rewind' method can be used to release
+// only the memory allocated since the 'cursor' accessor was last consulted,
+// and the most recently allocated memory block can be resized in place using
+// the 'truncate', 'grow', and 'expand' methods.
 //
 // 'bdlma::BufferManager' is typically used for fast and efficient memory
 // allocation, when the user knows in advance the maximum amount of memory
@@ -373,6 +376,20 @@ class BufferManager {
         // 'address' is 'size', and 'release' was not called after allocating
         // the memory at 'address'.
 
+    int grow(void *address, int originalSize, int newSize);
+        // Increase the amount of memory allocated at the specified 'address'
+        // from the specified 'originalSize' (in bytes) to the specified
+        // 'newSize' (in bytes).  Return 'newSize' after growing, or
+        // 'originalSize' if the memory at 'address' cannot be grown.  This
+        // method can only 'grow' the memory block returned by the most recent
+        // 'allocate' or 'allocateRaw' request from this buffer manager, and
+        // only if sufficient memory remains in the buffer; otherwise it has no
+        // effect.  The behavior is undefined unless the memory at 'address'
+        // was originally allocated by this buffer manager, the size of the
+        // memory at 'address' is 'originalSize', 'originalSize <= newSize',
+        // and 'release' was not called after allocating the memory at
+        // 'address'.
+
     char *replaceBuffer(char *newBuffer, int newBufferSize);
         // Replace the buffer currently managed by this object with the
         // specified 'newBuffer' of the specified 'newBufferSize' (in bytes);
@@ -390,6 +407,17 @@ class BufferManager {
         // retained.  Subsequent allocations will allocate memory from the
         // beginning of the external buffer (if any).
 
+    void rewind(int cursor);
+        // Set the offset of the next available byte in the buffer currently
+        // managed by this object to the specified 'cursor'.  If 'cursor' is
+        // less than the value returned by the 'cursor' accessor, the memory
+        // allocated at or beyond 'cursor' is released and made available for
+        // subsequent allocations.  The behavior is undefined unless
+        // '0 <= cursor', 'cursor <= bufferSize()', and no memory allocated at
+        // or beyond 'cursor' is in use.  Note that 'cursor' is typically
+        // obtained from an earlier call to the 'cursor' accessor, in which
+        // case all memory allocated since that call is released.
+
     void reset();
         // Reset this buffer manager to its default constructed state, except
         // retain the alignment strategy in effect at the time of construction.
@@ -420,6 +448,13 @@ class BufferManager {
         // Return the size (in bytes) of the buffer currently managed by this
         // object, or 0 if this object currently manages no buffer.
 
+    int cursor() const;
+        // Return the offset (in bytes) of the next available byte in the
+        // buffer currently managed by this object, or 0 if this object
+        // currently manages no buffer.  Note that the returned value can be
+        // supplied to 'rewind' to release all memory allocated after this
+        // call.
+
     bool hasSufficientCapacity(int size) const;
         // Return 'true' if there is sufficient memory space in the buffer to
         // allocate a contiguous memory block of the specified 'size' (in
@@ -535,6 +570,15 @@ void BufferManager::release()
     d_cursor = 0;
 }
 
+inline
+void BufferManager::rewind(int cursor)
+{
+    BSLS_ASSERT_SAFE(0 <= cursor);
+    BSLS_ASSERT_SAFE(cursor <= d_bufferSize);
+
+    d_cursor = cursor;
+}
+
 inline
 void BufferManager::reset()
 {
@@ -556,6 +600,12 @@ int BufferManager::bufferSize() const
     return d_bufferSize;
 }
 
+inline
+int BufferManager::cursor() const
+{
+    return d_cursor;
+}
+
 inline
 bool BufferManager::hasSufficientCapacity(int size) const
 {
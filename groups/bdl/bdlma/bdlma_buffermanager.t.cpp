@@ -66,18 +66,21 @@ using namespace bsl;
 // [ 8] void deleteObjectRaw(const TYPE *object);
 // [ 8] void deleteObject(const TYPE *object);
 // [ 9] int expand(void *address, int size);
+// [11] int grow(void *address, int originalSize, int newSize);
 // [ 4] char *replaceBuffer(char *newBuffer, int newBufferSize);
 // [ 5] void release();
 // [ 6] void reset();
+// [11] void rewind(int cursor);
 // [10] int truncate(void *address, int originalSize, int newSize);
 //
 // // ACCESSORS
 // [ 2] char *buffer() const;
 // [ 2] int bufferSize() const;
+// [11] int cursor() const;
 // [ 7] bool hasSufficientCapacity(int size) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -377,7 +380,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -407,6 +410,126 @@ int main(int argc, char *argv[])
         result = detectNOccurrences(3, array, 5);
         ASSERT(false == result);
 
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // GROW, CURSOR, AND REWIND TEST
+        //
+        // Concerns:
+        //   1. That 'cursor' returns 0 for a default-constructed object, and
+        //      the offset of the next available byte otherwise.
+        //
+        //   2. That 'grow' extends the most recent allocation to 'newSize' and
+        //      returns 'newSize' if the buffer has sufficient room.
+        //
+        //   3. That 'grow' returns 'originalSize' and has no effect if the
+        //      block is not the most recent allocation, or if the buffer does
+        //      not have sufficient room.
+        //
+        //   4. That 'rewind' makes the memory after the specified cursor
+        //      available for subsequent allocations.
+        //
+        //   5. QoI: Asserted precondition violations are detected when
+        //      enabled.
+        //
+        // Plan:
+        //   Using a buffer manager with byte alignment, make two allocations
+        //   and verify the cursor after each.  Grow the older allocation and
+        //   verify that 'grow' fails, then grow the newer allocation both
+        //   within and beyond the end of the buffer, verifying the cursor in
+        //   each case.  Finally, rewind to a cursor recorded earlier and
+        //   verify that the next allocation is at the expected address.
+        //
+        //   For concern 5, verify that, in appropriate build modes, defensive
+        //   checks are triggered.
+        //
+        // Testing:
+        //   int grow(void *address, int originalSize, int newSize);
+        //   void rewind(int cursor);
+        //   int cursor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "GROW, CURSOR, AND REWIND TEST" << endl
+                                  << "=============================" << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        {
+            const Obj X;
+            ASSERT(0 == X.cursor());
+        }
+
+        Obj mX(buffer, k_BUFFER_SIZE, bsls::Alignment::BSLS_BYTEALIGNED);
+        const Obj& X = mX;
+
+        ASSERT(0 == X.cursor());
+
+        void *addr1 = mX.allocate(10);
+        ASSERT(buffer == addr1);
+        ASSERT(10     == X.cursor());
+
+        const int CURSOR = X.cursor();
+
+        void *addr2 = mX.allocate(20);
+        ASSERT(buffer + 10 == addr2);
+        ASSERT(30          == X.cursor());
+
+        if (verbose) cout << "\nTesting 'grow' on an older allocation."
+                          << endl;
+
+        ASSERT(10 == mX.grow(addr1, 10, 15));
+        ASSERT(30 == X.cursor());
+
+        if (verbose) cout << "\nTesting 'grow' on the latest allocation."
+                          << endl;
+
+        ASSERT(20 == mX.grow(addr2, 20, 20));
+        ASSERT(30 == X.cursor());
+
+        ASSERT(50 == mX.grow(addr2, 20, 50));
+        ASSERT(60 == X.cursor());
+
+        ASSERT(k_BUFFER_SIZE - 10 == mX.grow(addr2, 50, k_BUFFER_SIZE - 10));
+        ASSERT(k_BUFFER_SIZE      == X.cursor());
+
+        ASSERT(k_BUFFER_SIZE - 10 == mX.grow(addr2,
+                                             k_BUFFER_SIZE - 10,
+                                             k_BUFFER_SIZE - 9));
+        ASSERT(k_BUFFER_SIZE      == X.cursor());
+        ASSERT(0                  == mX.allocate(1));
+
+        if (verbose) cout << "\nTesting 'rewind'." << endl;
+
+        mX.rewind(CURSOR);
+        ASSERT(CURSOR == X.cursor());
+
+        void *addr3 = mX.allocate(5);
+        ASSERT(addr2  == addr3);
+
+        mX.rewind(0);
+        ASSERT(0      == X.cursor());
+        ASSERT(buffer == mX.allocate(1));
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(buffer, k_BUFFER_SIZE);
+
+            void *addr = mX.allocate(8);
+
+            ASSERT_PASS(mX.grow(addr, 8,  8));
+            ASSERT_FAIL(mX.grow(   0, 8,  8));
+            ASSERT_FAIL(mX.grow(addr, 8,  7));
+            ASSERT_FAIL(mX.grow(addr, -1, 8));
+
+            ASSERT_SAFE_PASS(mX.rewind(0));
+            ASSERT_SAFE_PASS(mX.rewind(k_BUFFER_SIZE));
+            ASSERT_SAFE_FAIL(mX.rewind(-1));
+            ASSERT_SAFE_FAIL(mX.rewind(k_BUFFER_SIZE + 1));
+        }
+
       } break;
       case 10: {
         // --------------------------------------------------------------------
@@ -83,6 +83,17 @@ void InfrequentDeleteBlockList::release()
     }
 }
 
+void InfrequentDeleteBlockList::releaseAfter(const void *address)
+{
+    while (d_head_p && address != &d_head_p->d_memory) {
+        void *lastBlock = d_head_p;
+        d_head_p        = d_head_p->d_next_p;
+        d_allocator_p->deallocate(lastBlock);
+    }
+
+    BSLS_ASSERT(0 == address || d_head_p);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -23,7 +23,10 @@ BSLS_IDENT("$Id: $")
 // to 'bdlma::BlockList', the 'bdlma::InfrequentDeleteBlockList' class does
 // *not* support the deallocation of individual items.  In particular, although
 // 'bdlma::InfrequentDeleteBlockList' has a 'deallocate' method, that method
-// has no effect.
+// has no effect.  However, the 'releaseAfter' method deallocates, in a single
+// operation, all of the memory blocks that were allocated after a given block
+// (as identified by the 'mostRecentBlock' accessor), which allows higher-level
+// memory managers to roll back to an earlier state.
 //
 ///Usage
 ///-----
@@ -251,6 +254,20 @@ class InfrequentDeleteBlockList {
     void release();
         // Deallocate all memory blocks currently managed by this object,
         // returning it to its default-constructed state.
+
+    void releaseAfter(const void *address);
+        // Deallocate all memory blocks currently managed by this object that
+        // were allocated after the memory block at the specified 'address',
+        // or all memory blocks if 'address' is 0.  The behavior is undefined
+        // unless 'address' is 0 or is the address of a memory block currently
+        // managed by this object.  Note that 'address' is typically obtained
+        // from an earlier call to 'mostRecentBlock'.
+
+    // ACCESSORS
+    void *mostRecentBlock() const;
+        // Return the address of the most recently allocated memory block
+        // currently managed by this object, or 0 if this object manages no
+        // memory blocks.
 };
 
 // ============================================================================
@@ -276,6 +293,13 @@ void InfrequentDeleteBlockList::deallocate(void *)
 {
 }
 
+// ACCESSORS
+inline
+void *InfrequentDeleteBlockList::mostRecentBlock() const
+{
+    return d_head_p ? reinterpret_cast<void *>(&d_head_p->d_memory) : 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
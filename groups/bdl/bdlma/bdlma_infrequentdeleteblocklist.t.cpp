@@ -37,9 +37,11 @@ using namespace bsl;
 // [ 2] void *allocate(int size);
 // [ 4] void deallocate(void *address);
 // [ 3] void release();
+// [ 5] void releaseAfter(const void *address);
+// [ 5] void *mostRecentBlock() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 5] USAGE EXAMPLE
+// [ 6] USAGE EXAMPLE
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [ *] CONCERN: There is no temporary allocation from any allocator.
 // [ 2] CONCERN: Precondition violations are detected when enabled.
@@ -291,7 +293,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -333,6 +335,80 @@ int main(int argc, char *argv[])
         }
         ASSERT(0 == a.numBytesInUse());
       } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'releaseAfter' AND 'mostRecentBlock'
+        //
+        // Concerns:
+        //: 1 'mostRecentBlock' returns 0 if no block is outstanding, and the
+        //:   address returned by the most recent 'allocate' otherwise.
+        //:
+        //: 2 'releaseAfter' deallocates exactly the blocks allocated after the
+        //:   block at the specified address, which remains the most recent
+        //:   block.
+        //:
+        //: 3 'releaseAfter(0)' deallocates all blocks.
+        //:
+        //: 4 Blocks can be allocated after calling 'releaseAfter'.
+        //
+        // Plan:
+        //: 1 Allocate a sequence of blocks, recording 'mostRecentBlock' after
+        //:   each allocation, then, for each recorded address (including 0),
+        //:   call 'releaseAfter' and verify the number of blocks in use and
+        //:   the value of 'mostRecentBlock' using a test allocator.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   void releaseAfter(const void *address);
+        //   void *mostRecentBlock() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'releaseAfter' AND 'mostRecentBlock'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        enum { k_NUM_BLOCKS = 5 };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int ti = 0; ti <= k_NUM_BLOCKS; ++ti) {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.mostRecentBlock());
+
+            void *blocks[k_NUM_BLOCKS + 1];
+            blocks[0] = 0;
+
+            for (int i = 1; i <= k_NUM_BLOCKS; ++i) {
+                void *p = mX.allocate(i * 8);
+
+                LOOP2_ASSERT(ti, i, p == X.mostRecentBlock());
+                blocks[i] = p;
+            }
+            LOOP_ASSERT(ti, k_NUM_BLOCKS == ta.numBlocksInUse());
+
+            mX.releaseAfter(blocks[ti]);
+
+            LOOP_ASSERT(ti, ti         == ta.numBlocksInUse());
+            LOOP_ASSERT(ti, blocks[ti] == X.mostRecentBlock());
+
+            mX.releaseAfter(blocks[ti]);  // no effect
+
+            LOOP_ASSERT(ti, ti         == ta.numBlocksInUse());
+
+            void *p = mX.allocate(16);
+
+            LOOP_ASSERT(ti, ti + 1 == ta.numBlocksInUse());
+            LOOP_ASSERT(ti, p      == X.mostRecentBlock());
+
+            mX.releaseAfter(0);
+
+            LOOP_ASSERT(ti, 0 == ta.numBlocksInUse());
+            LOOP_ASSERT(ti, 0 == X.mostRecentBlock());
+        }
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // TESTING DEALLOCATE
@@ -0,0 +1,272 @@
+// bdlma_numaallocator.cpp                                            -*-C++-*-
+#include <bdlma_numaallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_numaallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>       // 'GetSystemInfo', 'VirtualAllocExNuma',
+                           // 'VirtualFree'
+#else
+
+#include <sys/mman.h>      // 'mmap', 'munmap'
+#include <unistd.h>        // 'sysconf'
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/syscall.h>   // 'SYS_mbind'
+#endif
+
+#endif
+
+namespace BloombergLP {
+namespace {
+
+// Define the size (in bytes) of the header preceding each block returned to
+// the user, in which the size of the mapped region is stashed.
+
+static const bslma::Allocator::size_type OFFSET =
+                                       bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+BSLMF_ASSERT(sizeof(bsl::size_t) <= OFFSET);
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_mbind)
+
+// Define the 'mbind' policy (from '<linux/mempolicy.h>', which is not
+// available on all build hosts) placing pages preferably on a single node.
+
+static const int k_MPOL_PREFERRED = 1;
+
+// Define the number of nodes that can be described by the node mask supplied
+// to 'mbind'.
+
+static const int k_MAX_NUMA_NODES = 1024;
+
+#endif
+
+// HELPER FUNCTIONS
+
+int getSystemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+    static bsls::AtomicInt pageSize(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == pageSize.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        pageSize = static_cast<int>(info.dwPageSize);
+
+#else
+
+        pageSize = static_cast<int>(sysconf(_SC_PAGESIZE));
+
+#endif
+    }
+
+    return pageSize.loadRelaxed();
+}
+
+void *systemAllocOnNode(bsl::size_t size, int numaNode, int pageSize)
+    // Allocate a page-aligned block of memory of the specified 'size' (in
+    // bytes), placed (preferably) on the NUMA node having the specified
+    // 'numaNode' index, and return the address of the allocated block, or 0
+    // if the allocation fails.  The behavior is undefined unless 'size > 0',
+    // 'size' is a multiple of the specified 'pageSize', and
+    // 'pageSize == getSystemPageSize()'.
+{
+    BSLS_ASSERT(size > 0);
+    BSLS_ASSERT(0 <= numaNode);
+    BSLS_ASSERT_SAFE(0 == size % pageSize);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    (void)pageSize;
+
+    return VirtualAllocExNuma(GetCurrentProcess(),
+                              0,
+                              size,
+                              MEM_COMMIT | MEM_RESERVE,
+                              PAGE_READWRITE,
+                              static_cast<DWORD>(numaNode));          // RETURN
+
+#else
+
+    void *address = mmap(0,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANON | MAP_PRIVATE,
+                         -1,
+                         0);
+
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_mbind)
+
+    (void)pageSize;
+
+    if (numaNode < k_MAX_NUMA_NODES) {
+        // Note that failure to apply the policy (e.g., because the node does
+        // not exist, or the kernel was built without NUMA support) leaves the
+        // default first-touch policy in place, which is acceptable.
+
+        const int     k_BITS = static_cast<int>(sizeof(unsigned long)) * 8;
+        unsigned long nodeMask[k_MAX_NUMA_NODES / k_BITS] = { 0 };
+
+        nodeMask[numaNode / k_BITS] = 1UL << (numaNode % k_BITS);
+
+        // The kernel ignores the last bit of the mask, so one more than the
+        // number of bits in the mask is supplied as the maximum node.
+
+        syscall(SYS_mbind,
+                address,
+                size,
+                k_MPOL_PREFERRED,
+                nodeMask,
+                static_cast<unsigned long>(k_MAX_NUMA_NODES + 1),
+                0U);
+    }
+
+#else
+
+    // Place the pages according to the first-touch policy of the operating
+    // system by writing to each of them from the allocating thread.
+
+    (void)numaNode;
+
+    for (bsl::size_t offset = 0; offset < size; offset += pageSize) {
+        static_cast<volatile char *>(address)[offset] = 0;
+    }
+
+#endif
+
+    return address;
+
+#endif
+}
+
+void systemFree(void *address, bsl::size_t size)
+    // Return the memory block at the specified 'address' having the specified
+    // 'size' (in bytes) back to the system.  The behavior is undefined unless
+    // 'address' was returned by 'systemAllocOnNode' for a block of 'size'
+    // bytes and has not already been freed.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    // On some of our platforms, 'munmap' takes a 'char*' argument, while on
+    // others it takes a 'void*'.  Casting to 'char*', which will work in both
+    // cases.
+
+    munmap(static_cast<char *>(address), size);
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                            // -------------------
+                            // class NumaAllocator
+                            // -------------------
+
+// CREATORS
+NumaAllocator::~NumaAllocator()
+{
+}
+
+// MANIPULATORS
+void *NumaAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const int       pageSize  = getSystemPageSize();
+    const size_type totalSize = (size + OFFSET + pageSize - 1)
+                              / pageSize * pageSize;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(totalSize < size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The size computation overflowed.
+
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    void *region = systemAllocOnNode(totalSize, d_numaNode, pageSize);
+
+    if (!region) {
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    // Save 'totalSize' - we'll need it for 'systemFree' in 'deallocate'.
+
+    *static_cast<bsl::size_t *>(region) = totalSize;
+
+    return static_cast<char *>(region) + OFFSET;
+}
+
+void NumaAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    void *region = static_cast<char *>(address) - OFFSET;
+
+    systemFree(region, *static_cast<bsl::size_t *>(region));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,229 @@
+// bdlma_numaallocator.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLMA_NUMAALLOCATOR
+#define INCLUDED_BDLMA_NUMAALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator supplying memory local to a NUMA node.
+//
+//@CLASSES:
+//  bdlma::NumaAllocator: allocator supplying memory placed on a NUMA node
+//
+//@SEE_ALSO: bslmt_threadutil, bdlma_concurrentmultipoolallocator
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::NumaAllocator', that implements the 'bslma::Allocator' protocol and
+// supplies memory that is physically placed on the NUMA node whose index is
+// supplied at construction:
+//..
+//   ,--------------------.
+//  ( bdlma::NumaAllocator )
+//   `--------------------'
+//             |         ctor/dtor
+//             |         numaNode
+//             V
+//    ,----------------.
+//   ( bslma::Allocator )
+//    `----------------'
+//                       allocate
+//                       deallocate
+//..
+// On machines having multiple NUMA nodes (e.g., multi-socket servers), memory
+// attached to another node is considerably slower to access than local
+// memory.  By default, operating systems place each page of memory on the
+// node of the thread that first writes to it, so memory that is populated by
+// one thread and subsequently used by a thread running on another node (as
+// happens, for example, when a pool is replenished by whichever thread first
+// finds it empty) incurs remote-access latency for its lifetime.  Memory
+// supplied by a 'bdlma::NumaAllocator' is instead bound to a specific node,
+// regardless of which thread first writes to it.
+//
+// Each block is obtained directly from the system in a multiple of the system
+// page size (plus a small header), and is returned to the system when it is
+// deallocated.  A 'bdlma::NumaAllocator' is therefore intended to be used as
+// the backing allocator of a pool (e.g., a
+// 'bdlma::ConcurrentMultipoolAllocator') that requests large blocks
+// infrequently, rather than to satisfy small requests directly.
+//
+///Node Placement
+///--------------
+// The placement of memory is achieved as follows:
+//..
+// Platform      Technique
+// ------------  --------------------------------------------------------------
+// Linux         The block is mapped using 'mmap' and a preferred-node policy
+//               is applied to it using the 'mbind' system call.  Pages are
+//               placed on the node when first written, by any thread.
+//
+// Windows       The block is allocated using 'VirtualAllocExNuma' with the
+//               node as the preferred node.
+//
+// Other         The block is mapped using 'mmap', and each of its pages is
+//               written by the allocating thread, placing the pages according
+//               to the first-touch policy of the operating system (i.e., on
+//               the node of the allocating thread).
+//..
+// Note that placement on the requested node is a preference: if the node does
+// not exist, or has insufficient free memory, the operating system places
+// pages on another node, and 'allocate' still succeeds.  The nodes of the
+// machine can be enumerated with 'bslmt::ThreadUtil::numNumaNodes', and the
+// node of the current thread obtained with
+// 'bslmt::ThreadUtil::currentNumaNode'.
+//
+///Thread Safety
+///-------------
+// The 'bdlma::NumaAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying Node-Local Memory to a Pool
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that each of the worker threads of a server allocates short-lived
+// objects from a pool, and that we want the memory of the pool to be local to
+// the node on which the worker runs.
+//
+// First, we bind the current thread to a node (node 0 exists on every
+// machine), and determine the node on which it runs:
+//..
+//  bslmt::ThreadUtil::bindCurrentThreadToNumaNode(0);
+//
+//  const int node = bslmt::ThreadUtil::currentNumaNode();
+//..
+// Then, we create a 'bdlma::NumaAllocator' supplying memory on that node:
+//..
+//  bdlma::NumaAllocator numaAllocator(node);
+//  assert(node == numaAllocator.numaNode());
+//..
+// Next, we create a pool backed by 'numaAllocator':
+//..
+//  bdlma::ConcurrentMultipoolAllocator pool(&numaAllocator);
+//..
+// Now, we allocate memory from the pool, which replenishes itself with large
+// blocks of node-local memory:
+//..
+//  void *p = pool.allocate(64);
+//  bsl::memset(p, 0, 64);
+//..
+// Finally, we return the memory to the pool:
+//..
+//  pool.deallocate(p);
+//..
+// Note that 'bdlmt::FixedThreadPool' can be configured to bind its workers to
+// nodes and to supply them with pools built in this way.
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                            // ===================
+                            // class NumaAllocator
+                            // ===================
+
+class NumaAllocator : public bslma::Allocator {
+    // This class defines a concrete thread-safe allocator mechanism that
+    // implements the 'bslma::Allocator' protocol, and supplies memory that is
+    // placed on the NUMA node indicated at construction.  Note that, unlike
+    // many other allocators, an allocator cannot be (optionally) supplied at
+    // construction; instead, a system facility is used that allocates blocks
+    // of memory in multiples of the system page size.
+
+    // DATA
+    int d_numaNode;  // index of the node on which memory is placed
+
+  private:
+    // NOT IMPLEMENTED
+    NumaAllocator(const NumaAllocator&);
+    NumaAllocator& operator=(const NumaAllocator&);
+
+  public:
+    // CREATORS
+    explicit NumaAllocator(int numaNode);
+        // Create an allocator supplying memory placed on the NUMA node having
+        // the specified 'numaNode' index.  The behavior is undefined unless
+        // '0 <= numaNode'.
+
+    virtual ~NumaAllocator();
+        // Destroy this allocator object.  Note that destroying this allocator
+        // has no effect on any outstanding allocated memory.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes), placed on the NUMA node of this
+        // allocator (see {Node Placement}).  If 'size' is 0, no memory is
+        // allocated and 0 is returned.  Note that a multiple of the
+        // platform's memory page size is allocated for *every* call to this
+        // method.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // system.  If 'address' is 0, this method has no effect.  The behavior
+        // is undefined unless 'address' was returned by 'allocate' and has not
+        // already been deallocated.
+
+    // ACCESSORS
+    int numaNode() const;
+        // Return the index of the NUMA node on which this allocator places
+        // memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class NumaAllocator
+                            // -------------------
+
+// CREATORS
+inline
+NumaAllocator::NumaAllocator(int numaNode)
+: d_numaNode(numaNode)
+{
+    BSLS_ASSERT_SAFE(0 <= numaNode);
+}
+
+// ACCESSORS
+inline
+int NumaAllocator::numaNode() const
+{
+    return d_numaNode;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,467 @@
+// bdlma_numaallocator.t.cpp                                          -*-C++-*-
+#include <bdlma_numaallocator.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+  #include <sys/syscall.h>  // 'SYS_get_mempolicy'
+  #include <unistd.h>       // 'syscall'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::NumaAllocator' is an allocator mechanism that obtains memory from
+// the system and places it on the NUMA node supplied at construction.  The
+// primary concerns are that the blocks returned by 'allocate' are usable,
+// suitably aligned, and independent, and that the memory is returned to the
+// system by 'deallocate'.  Where the operating system can report the node of
+// a page (Linux), we also verify that memory is placed on the requested node.
+// Note that since the 'bdlma::NumaAllocator' constructor does not accept an
+// optional allocator argument, there is scant opportunity to use
+// 'bslma::TestAllocator' in this test driver.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit NumaAllocator(int numaNode);
+// [ 2] ~NumaAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 2] int numaNode() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [ *] CONCERN: In no case does memory come from the global allocator.
+// [ *] CONCERN: In no case does memory come from the default allocator.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::NumaAllocator Obj;
+
+static const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int nodeOfAddress(void *address)
+    // Return the index of the NUMA node on which the page containing the
+    // specified 'address' is placed, or -1 if it cannot be determined on this
+    // platform.  The behavior is undefined unless the page has been written.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_get_mempolicy)
+    // Flags from '<linux/mempolicy.h>'.
+
+    enum { k_MPOL_F_NODE = 1, k_MPOL_F_ADDR = 2 };
+
+    int node = -1;
+    if (0 == syscall(SYS_get_mempolicy,
+                     &node,
+                     0,
+                     0UL,
+                     address,
+                     static_cast<unsigned long>(k_MPOL_F_NODE
+                                                | k_MPOL_F_ADDR))) {
+        return node;                                                  // RETURN
+    }
+#else
+    (void)address;
+#endif
+    return -1;
+}
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying Node-Local Memory to a Pool
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that each of the worker threads of a server allocates short-lived
+// objects from a pool, and that we want the memory of the pool to be local to
+// the node on which the worker runs.
+//
+// First, we bind the current thread to a node (node 0 exists on every
+// machine), and determine the node on which it runs:
+//..
+    bslmt::ThreadUtil::bindCurrentThreadToNumaNode(0);
+
+    const int node = bslmt::ThreadUtil::currentNumaNode();
+//..
+// Then, we create a 'bdlma::NumaAllocator' supplying memory on that node:
+//..
+    bdlma::NumaAllocator numaAllocator(node);
+    ASSERT(node == numaAllocator.numaNode());
+//..
+// Next, we create a pool backed by 'numaAllocator':
+//..
+    bdlma::ConcurrentMultipoolAllocator pool(&numaAllocator);
+//..
+// Now, we allocate memory from the pool, which replenishes itself with large
+// blocks of node-local memory:
+//..
+    void *p = pool.allocate(64);
+    bsl::memset(p, 0, 64);
+//..
+// Finally, we return the memory to the pool:
+//..
+    pool.deallocate(p);
+//..
+// Note that 'bdlmt::FixedThreadPool' can be configured to bind its workers to
+// nodes and to supply them with pools built in this way.
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of (at least) the
+        //:   requested size, every byte of which can be written and read.
+        //:
+        //: 2 Blocks returned by 'allocate' do not overlap.
+        //:
+        //: 3 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 4 Blocks whose size, together with the header, exactly fill a
+        //:   whole number of pages are handled correctly.
+        //:
+        //: 5 Where the node of a page can be determined, memory is placed on
+        //:   the node of the allocator.
+        //
+        // Plan:
+        //: 1 For each size in a table of sizes (including sizes around
+        //:   multiples of the page size), allocate two blocks, fill each with
+        //:   a distinct pattern, verify the alignment and the contents of both
+        //:   blocks, and deallocate them.  (C-1, 2, 4)
+        //:
+        //: 2 Verify that 'allocate(0)' returns 0 and invoke 'deallocate(0)'.
+        //:   (C-3)
+        //:
+        //: 3 On Linux, for each node, allocate a block, write to it, and
+        //:   verify that, if the node of its page can be determined, it is the
+        //:   node of the allocator.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE AND DEALLOCATE" << endl
+                          << "=======================" << endl;
+
+        static const int SIZES[] = {
+            1, 2, 7, 8, 15, 16, 17, 100, 4096 - 16, 4096 - 15, 4096, 4097,
+            8192 - 16, 8192, 65536, 1 << 20
+        };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        if (verbose) cout << "\nTesting block usability." << endl;
+
+        Obj mX(0);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            if (veryVerbose) { T_ P(SIZE) }
+
+            char *p = static_cast<char *>(mX.allocate(SIZE));
+            char *q = static_cast<char *>(mX.allocate(SIZE));
+
+            ASSERTV(SIZE, p);
+            ASSERTV(SIZE, q);
+            ASSERTV(SIZE, 0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                                  % MAX_ALIGN);
+            ASSERTV(SIZE, 0 == reinterpret_cast<bsls::Types::UintPtr>(q)
+                                                                  % MAX_ALIGN);
+            ASSERTV(SIZE, p + SIZE <= q || q + SIZE <= p);
+
+            bsl::memset(p, 0xa5, SIZE);
+            bsl::memset(q, 0x5a, SIZE);
+
+            for (int i = 0; i < SIZE; ++i) {
+                if (static_cast<char>(0xa5) != p[i]
+                 || static_cast<char>(0x5a) != q[i]) {
+                    ASSERTV(SIZE, i, 0 && "corrupted block");
+                    break;
+                }
+            }
+
+            mX.deallocate(q);
+            mX.deallocate(p);
+        }
+
+        if (verbose) cout << "\nTesting 0 size and null address." << endl;
+        {
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+        }
+
+        if (verbose) cout << "\nTesting placement." << endl;
+
+        const int NUM_NODES = bslmt::ThreadUtil::numNumaNodes();
+
+        for (int node = 0; node < NUM_NODES; ++node) {
+            Obj mY(node);
+
+            char *p = static_cast<char *>(mY.allocate(100));
+            ASSERTV(node, p);
+            *p = 1;
+
+            const int actualNode = nodeOfAddress(p);
+            if (veryVerbose) { T_ P_(node) P(actualNode) }
+
+            ASSERTV(node, actualNode, -1 == actualNode || node == actualNode);
+
+            mY.deallocate(p);
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND 'numaNode'
+        //
+        // Concerns:
+        //: 1 The 'numaNode' accessor returns the node supplied at
+        //:   construction, which need not exist on this machine.
+        //:
+        //: 2 No memory is allocated by construction or destruction.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a sequence of node indices, create an allocator and verify
+        //:   the value returned by 'numaNode'.  (C-1, 2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a negative node index.  (C-3)
+        //
+        // Testing:
+        //   explicit NumaAllocator(int numaNode);
+        //   ~NumaAllocator();
+        //   int numaNode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND 'numaNode'" << endl
+                          << "=======================" << endl;
+
+        static const int NODES[] = { 0, 1, 2, 3, 63, 64, 1023, 1024, 100000 };
+        const int NUM_NODES = static_cast<int>(sizeof NODES / sizeof *NODES);
+
+        for (int ti = 0; ti < NUM_NODES; ++ti) {
+            const int NODE = NODES[ti];
+
+            const Obj X(NODE);
+            ASSERTV(NODE, X.numaNode(), NODE == X.numaNode());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_PASS(Obj(0));
+            ASSERT_SAFE_FAIL(Obj(-1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object 'mX' for node 0.
+        //: 2 Allocate blocks from 'mX' and overwrite them.
+        //: 3 Deallocate the blocks.
+        //: 4 Allow 'mX' to go out of scope.
+        //: 5 Create an object 'mY' for a node that does not exist, and verify
+        //:   that memory can still be allocated from it.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            Obj mX(0);
+            ASSERT(0 == mX.numaNode());
+
+            void *p = mX.allocate(MAX_ALIGN);  ASSERT(p);
+            bsl::memset(p, 0xff, MAX_ALIGN);
+
+            void *q = mX.allocate(100000);     ASSERT(q);
+            bsl::memset(q, 0xff, 100000);
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+        }
+
+        {
+            Obj mY(bslmt::ThreadUtil::numNumaNodes() + 1);
+
+            void *p = mY.allocate(1000);  ASSERT(p);
+            bsl::memset(p, 0xff, 1000);
+
+            mY.deallocate(p);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,646 @@
+// bdlma_samplingguardingallocator.cpp                                -*-C++-*-
+#include <bdlma_samplingguardingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_samplingguardingallocator_cpp,"$Id$ $CSID$")
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdio.h>              // 'bsl::fprintf'
+#include <bsl_cstdlib.h>             // 'bsl::abort'
+#include <bsl_new.h>                 // 'bsl::bad_alloc', placement 'new'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'GetSystemInfo', 'VirtualAlloc', 'VirtualFree',
+                       // 'VirtualProtect'
+#else
+
+#include <sys/mman.h>  // 'mmap', 'mprotect', 'munmap'
+#include <unistd.h>    // 'sysconf'
+
+#endif
+
+///Implementation Notes
+///--------------------
+// The slot metadata is updated under 'd_mutex' by 'allocate' and
+// 'deallocate', which take the mutex only for sampled blocks.  The state of a
+// slot is written last when a block is placed in it, so that
+// 'describeAddress', which does not take the mutex, observes either the
+// previous or the new description of the slot, except while a slot is being
+// reused.
+
+namespace BloombergLP {
+namespace bdlma {
+
+                   // =====================================
+                   // struct SamplingGuardingAllocator_Slot
+                   // =====================================
+
+struct SamplingGuardingAllocator_Slot {
+    // This 'struct' describes the block held by a slot of a
+    // 'SamplingGuardingAllocator'.
+
+    // TYPES
+    enum State {
+        e_NEVER_USED,  // the slot has never held a block
+        e_IN_USE,      // the slot holds a block in use
+        e_FREED        // the slot holds a deallocated block
+    };
+
+    // DATA
+    bsls::AtomicInt  d_state;           // 'State' of the slot
+
+    const void      *d_blockAddress;    // address of the block
+
+    bsl::size_t      d_blockSize;       // size of the block (in bytes)
+
+    void            *d_allocationStack[
+                         SamplingGuardingAllocator::k_MAX_STACK_FRAMES];
+                                        // stack that allocated the block
+
+    int              d_numAllocationFrames;
+                                        // length of 'd_allocationStack'
+
+    void            *d_deallocationStack[
+                         SamplingGuardingAllocator::k_MAX_STACK_FRAMES];
+                                        // stack that deallocated the block
+
+    int              d_numDeallocationFrames;
+                                        // length of 'd_deallocationStack'
+};
+
+}  // close package namespace
+
+namespace {
+
+typedef bdlma::SamplingGuardingAllocator_Slot Slot;
+
+// HELPER FUNCTIONS
+
+int getSystemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<int>(info.dwPageSize);                         // RETURN
+
+#else
+
+    return static_cast<int>(sysconf(_SC_PAGESIZE));                   // RETURN
+
+#endif
+}
+
+char *systemReserve(bsl::size_t size)
+    // Reserve a page-aligned, read/write protected region of memory of the
+    // specified 'size' (in bytes), and return its address, or 0 if the region
+    // cannot be reserved.  The behavior is undefined unless 'size > 0'.
+{
+    BSLS_ASSERT(size > 0);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    return static_cast<char *>(VirtualAlloc(0,
+                                            size,
+                                            MEM_COMMIT | MEM_RESERVE,
+                                            PAGE_NOACCESS));          // RETURN
+
+#else
+
+    void *address = mmap(0,
+                         size,
+                         PROT_NONE,
+                         MAP_ANON | MAP_PRIVATE,
+                         -1,
+                         0);
+
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    return static_cast<char *>(address);                              // RETURN
+
+#endif
+}
+
+void systemRelease(char *address, bsl::size_t size)
+    // Release the region of memory at the specified 'address' having the
+    // specified 'size' (in bytes).  The behavior is undefined unless
+    // 'address' was returned by 'systemReserve' for 'size' bytes and has not
+    // already been released.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    munmap(address, size);
+
+#endif
+}
+
+int systemSetAccess(char *page, int pageSize, bool isAccessible)
+    // Allow read/write access to the memory page at the specified 'page'
+    // address having the specified 'pageSize' (in bytes) if the specified
+    // 'isAccessible' is 'true', and prevent any access to it otherwise.
+    // Return 0 on success, and a non-zero value otherwise.
+{
+    BSLS_ASSERT(page);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    DWORD oldProtect;
+
+    return !VirtualProtect(page,
+                           pageSize,
+                           isAccessible ? PAGE_READWRITE : PAGE_NOACCESS,
+                           &oldProtect);                              // RETURN
+
+#else
+
+    return mprotect(page,
+                    pageSize,
+                    isAccessible ? PROT_READ | PROT_WRITE : PROT_NONE);
+                                                                      // RETURN
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                      // -------------------------------
+                      // class SamplingGuardingAllocator
+                      // -------------------------------
+
+// PRIVATE MANIPULATORS
+void *SamplingGuardingAllocator::allocateSample(size_type size)
+{
+    void *stack[k_MAX_STACK_FRAMES];
+    int   numFrames = d_stackCollector
+                    ? d_stackCollector(stack, k_MAX_STACK_FRAMES)
+                    : 0;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (0 == d_numFreeSlots) {
+        return 0;                                                     // RETURN
+    }
+
+    const int slotIndex = d_freeSlots_p[d_freeSlotsHead];
+    char     *page      = d_region_p + (2 * slotIndex + 1) * d_pageSize;
+
+    if (0 != systemSetAccess(page, d_pageSize, true)) {
+        return 0;                                                     // RETURN
+    }
+
+    d_freeSlotsHead = (d_freeSlotsHead + 1) % d_numSlots;
+    --d_numFreeSlots;
+
+    const size_type paddedSize =
+                          bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+
+    char *address = GuardingAllocator::e_BEFORE_USER_BLOCK ==
+                                                           d_guardPageLocation
+                    ? page
+                    : page + d_pageSize - paddedSize;
+
+    Slot& slot = d_slots_p[slotIndex];
+
+    slot.d_blockAddress = address;
+    slot.d_blockSize    = size;
+
+    if (numFrames < 0) {
+        numFrames = 0;
+    }
+    for (int i = 0; i < numFrames; ++i) {
+        slot.d_allocationStack[i] = stack[i];
+    }
+    slot.d_numAllocationFrames   = numFrames;
+    slot.d_numDeallocationFrames = 0;
+
+    slot.d_state = Slot::e_IN_USE;
+
+    d_numSampledAllocations.addRelaxed(1);
+
+    return address;
+}
+
+void SamplingGuardingAllocator::deallocateSample(void *address)
+{
+    const char        *p          = static_cast<char *>(address);
+    const bsl::size_t  pageIndex  = (p - d_region_p) / d_pageSize;
+    const int          slotIndex  = 1 == pageIndex % 2
+                                  ? static_cast<int>(pageIndex / 2)
+                                  : -1;
+
+    void *stack[k_MAX_STACK_FRAMES];
+    int   numFrames = d_stackCollector
+                    ? d_stackCollector(stack, k_MAX_STACK_FRAMES)
+                    : 0;
+
+    BlockInfo info;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (0 <= slotIndex) {
+            Slot& slot = d_slots_p[slotIndex];
+
+            if (Slot::e_IN_USE == slot.d_state
+             && address == slot.d_blockAddress) {
+                if (numFrames < 0) {
+                    numFrames = 0;
+                }
+                for (int i = 0; i < numFrames; ++i) {
+                    slot.d_deallocationStack[i] = stack[i];
+                }
+                slot.d_numDeallocationFrames = numFrames;
+
+                slot.d_state = Slot::e_FREED;
+
+                char *page = d_region_p + (2 * slotIndex + 1) * d_pageSize;
+                const int rc = systemSetAccess(page, d_pageSize, false);
+                (void)rc;
+
+                BSLS_ASSERT_OPT(0 == rc);
+
+                const int tail = (d_freeSlotsHead + d_numFreeSlots)
+                               % d_numSlots;
+                d_freeSlots_p[tail] = slotIndex;
+                ++d_numFreeSlots;
+
+                return;                                               // RETURN
+            }
+
+            loadBlockInfo(&info,
+                          slotIndex,
+                          Slot::e_FREED == slot.d_state
+                       && address == slot.d_blockAddress
+                          ? e_DOUBLE_FREE
+                          : e_INVALID_FREE,
+                          address);
+        }
+        else {
+            loadBlockInfo(&info, -1, e_INVALID_FREE, address);
+        }
+    }
+
+    d_errorCallback(info);
+}
+
+void SamplingGuardingAllocator::init(int numSlots, int samplingPeriod)
+{
+    BSLS_ASSERT(0 < numSlots);
+    BSLS_ASSERT(0 < samplingPeriod);
+
+    d_pageSize   = getSystemPageSize();
+    d_numSlots   = numSlots;
+    d_regionSize = static_cast<bsl::size_t>(2 * numSlots + 1) * d_pageSize;
+
+    d_slots_p = static_cast<Slot *>(
+                           d_allocator_p->allocate(numSlots * sizeof(Slot)));
+    bslma::DeallocatorProctor<bslma::Allocator> slotsProctor(d_slots_p,
+                                                             d_allocator_p);
+
+    d_freeSlots_p = static_cast<int *>(
+                      d_allocator_p->allocate(numSlots * sizeof(int)));
+    bslma::DeallocatorProctor<bslma::Allocator> freeSlotsProctor(
+                                                                d_freeSlots_p,
+                                                                d_allocator_p);
+
+    for (int i = 0; i < numSlots; ++i) {
+        Slot& slot = *new (d_slots_p + i) Slot();
+
+        slot.d_state.storeRelaxed(Slot::e_NEVER_USED);
+        slot.d_blockAddress          = 0;
+        slot.d_blockSize             = 0;
+        slot.d_numAllocationFrames   = 0;
+        slot.d_numDeallocationFrames = 0;
+
+        d_freeSlots_p[i] = i;
+    }
+    d_freeSlotsHead = 0;
+    d_numFreeSlots  = numSlots;
+
+    d_region_p = systemReserve(d_regionSize);
+    if (!d_region_p) {
+        BSLS_THROW(bsl::bad_alloc());
+    }
+
+    freeSlotsProctor.release();
+    slotsProctor.release();
+
+    d_samplingPeriod = samplingPeriod;
+    d_countdown      = samplingPeriod;
+}
+
+// PRIVATE ACCESSORS
+void SamplingGuardingAllocator::loadBlockInfo(
+                                            BlockInfo  *result,
+                                            int         slotIndex,
+                                            ErrorKind   errorKind,
+                                            const void *accessAddress) const
+{
+    BSLS_ASSERT(result);
+
+    result->d_errorKind     = errorKind;
+    result->d_accessAddress = accessAddress;
+
+    if (slotIndex < 0) {
+        result->d_blockAddress          = 0;
+        result->d_blockSize             = 0;
+        result->d_isFreed               = false;
+        result->d_numAllocationFrames   = 0;
+        result->d_numDeallocationFrames = 0;
+        return;                                                       // RETURN
+    }
+
+    const Slot& slot = d_slots_p[slotIndex];
+
+    result->d_blockAddress          = slot.d_blockAddress;
+    result->d_blockSize             = slot.d_blockSize;
+    result->d_isFreed               = Slot::e_FREED == slot.d_state;
+    result->d_numAllocationFrames   = slot.d_numAllocationFrames;
+    result->d_numDeallocationFrames = result->d_isFreed
+                                    ? slot.d_numDeallocationFrames
+                                    : 0;
+
+    for (int i = 0; i < result->d_numAllocationFrames; ++i) {
+        result->d_allocationStack[i] = slot.d_allocationStack[i];
+    }
+    for (int i = 0; i < result->d_numDeallocationFrames; ++i) {
+        result->d_deallocationStack[i] = slot.d_deallocationStack[i];
+    }
+}
+
+// CLASS METHODS
+const char *SamplingGuardingAllocator::errorKindDescription(ErrorKind kind)
+{
+    switch (kind) {
+      case e_BUFFER_OVERFLOW:  return "buffer overflow";              // RETURN
+      case e_BUFFER_UNDERFLOW: return "buffer underflow";             // RETURN
+      case e_USE_AFTER_FREE:   return "use after free";               // RETURN
+      case e_DOUBLE_FREE:      return "double free";                  // RETURN
+      case e_INVALID_FREE:     return "invalid free";                 // RETURN
+      default:                 return "unknown error";                // RETURN
+    }
+}
+
+void SamplingGuardingAllocator::abortOnError(const BlockInfo& info)
+{
+    bsl::fprintf(stderr,
+                 "bdlma::SamplingGuardingAllocator: %s at %p "
+                 "(block %p of %lu bytes)\n",
+                 errorKindDescription(info.d_errorKind),
+                 info.d_accessAddress,
+                 info.d_blockAddress,
+                 static_cast<unsigned long>(info.d_blockSize));
+    bsl::fflush(stderr);
+
+    bsl::abort();
+}
+
+// CREATORS
+SamplingGuardingAllocator::SamplingGuardingAllocator(
+                                              int               numSlots,
+                                              int               samplingPeriod,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_guardPageLocation(GuardingAllocator::e_AFTER_USER_BLOCK)
+, d_region_p(0)
+, d_regionSize(0)
+, d_pageSize(0)
+, d_numSlots(0)
+, d_slots_p(0)
+, d_freeSlots_p(0)
+, d_freeSlotsHead(0)
+, d_numFreeSlots(0)
+, d_countdown(0)
+, d_samplingPeriod(0)
+, d_numSampledAllocations(0)
+, d_stackCollector(0)
+, d_errorCallback(&abortOnError)
+{
+    init(numSlots, samplingPeriod);
+}
+
+SamplingGuardingAllocator::SamplingGuardingAllocator(
+                    int                                   numSlots,
+                    int                                   samplingPeriod,
+                    GuardingAllocator::GuardPageLocation  guardLocation,
+                    bslma::Allocator                     *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_guardPageLocation(guardLocation)
+, d_region_p(0)
+, d_regionSize(0)
+, d_pageSize(0)
+, d_numSlots(0)
+, d_slots_p(0)
+, d_freeSlots_p(0)
+, d_freeSlotsHead(0)
+, d_numFreeSlots(0)
+, d_countdown(0)
+, d_samplingPeriod(0)
+, d_numSampledAllocations(0)
+, d_stackCollector(0)
+, d_errorCallback(&abortOnError)
+{
+    init(numSlots, samplingPeriod);
+}
+
+SamplingGuardingAllocator::~SamplingGuardingAllocator()
+{
+    BSLS_ASSERT(d_numSlots == d_numFreeSlots);
+
+    systemRelease(d_region_p, d_regionSize);
+
+    d_allocator_p->deallocate(d_freeSlots_p);
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+// MANIPULATORS
+void *SamplingGuardingAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                          0 >= d_countdown.addRelaxed(-1))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Note that concurrent allocations may decrement the countdown below
+        // 0 before it is reset, in which case a few consecutive allocations
+        // are sampled.
+
+        d_countdown.storeRelaxed(d_samplingPeriod);
+
+        if (size <= static_cast<size_type>(d_pageSize)) {
+            void *address = allocateSample(size);
+            if (address) {
+                return address;                                       // RETURN
+            }
+        }
+    }
+
+    return d_allocator_p->allocate(size);
+}
+
+void SamplingGuardingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isGuardedAddress(address))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        deallocateSample(address);
+        return;                                                       // RETURN
+    }
+
+    d_allocator_p->deallocate(address);
+}
+
+void SamplingGuardingAllocator::setErrorCallback(ErrorCallback callback)
+{
+    BSLS_ASSERT(callback);
+
+    d_errorCallback = callback;
+}
+
+void SamplingGuardingAllocator::setSamplingPeriod(int samplingPeriod)
+{
+    BSLS_ASSERT(0 < samplingPeriod);
+
+    d_samplingPeriod = samplingPeriod;
+    d_countdown      = samplingPeriod;
+}
+
+void SamplingGuardingAllocator::setStackCollector(StackCollector collector)
+{
+    d_stackCollector = collector;
+}
+
+// ACCESSORS
+int SamplingGuardingAllocator::describeAddress(BlockInfo  *result,
+                                               const void *address) const
+{
+    BSLS_ASSERT(result);
+
+    if (!isGuardedAddress(address)) {
+        return -1;                                                    // RETURN
+    }
+
+    const char        *p         = static_cast<const char *>(address);
+    const bsl::size_t  pageIndex = (p - d_region_p) / d_pageSize;
+
+    if (1 == pageIndex % 2) {
+        // The address is within a slot.
+
+        const int   slotIndex = static_cast<int>(pageIndex / 2);
+        const Slot& slot      = d_slots_p[slotIndex];
+        const char *block     = static_cast<const char *>(slot.d_blockAddress);
+
+        ErrorKind kind;
+        switch (slot.d_state) {
+          case Slot::e_FREED: {
+            kind = e_USE_AFTER_FREE;
+          } break;
+          case Slot::e_IN_USE: {
+            kind = p < block                     ? e_BUFFER_UNDERFLOW
+                 : p >= block + slot.d_blockSize ? e_BUFFER_OVERFLOW
+                 :                                 e_UNKNOWN_ERROR;
+          } break;
+          default: {
+            loadBlockInfo(result, -1, e_UNKNOWN_ERROR, address);
+            return 0;                                                 // RETURN
+          }
+        }
+
+        loadBlockInfo(result, slotIndex, kind, address);
+        return 0;                                                     // RETURN
+    }
+
+    // The address is within a guard page: attribute the access to the closest
+    // block that was ever placed in an adjacent slot, whether or not that
+    // block has since been deallocated.
+
+    const int leftIndex  = static_cast<int>(pageIndex / 2) - 1;
+    const int rightIndex = static_cast<int>(pageIndex / 2);
+
+    bsl::size_t leftDistance  = 0;
+    bsl::size_t rightDistance = 0;
+    bool        hasLeft       = false;
+    bool        hasRight      = false;
+
+    if (0 <= leftIndex
+     && Slot::e_NEVER_USED != d_slots_p[leftIndex].d_state) {
+        const Slot& slot  = d_slots_p[leftIndex];
+        const char *end   = static_cast<const char *>(slot.d_blockAddress)
+                          + slot.d_blockSize;
+        leftDistance = p - end;
+        hasLeft      = true;
+    }
+    if (rightIndex < d_numSlots
+     && Slot::e_NEVER_USED != d_slots_p[rightIndex].d_state) {
+        const Slot& slot = d_slots_p[rightIndex];
+        rightDistance = static_cast<const char *>(slot.d_blockAddress) - p;
+        hasRight      = true;
+    }
+
+    if (hasLeft && (!hasRight || leftDistance <= rightDistance)) {
+        loadBlockInfo(result, leftIndex, e_BUFFER_OVERFLOW, address);
+    }
+    else if (hasRight) {
+        loadBlockInfo(result, rightIndex, e_BUFFER_UNDERFLOW, address);
+    }
+    else {
+        loadBlockInfo(result, -1, e_UNKNOWN_ERROR, address);
+    }
+
+    return 0;
+}
+
+int SamplingGuardingAllocator::numSlotsInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numSlots - d_numFreeSlots;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,510 @@
+// bdlma_samplingguardingallocator.h                                  -*-C++-*-
+#ifndef INCLUDED_BDLMA_SAMPLINGGUARDINGALLOCATOR
+#define INCLUDED_BDLMA_SAMPLINGGUARDINGALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator guarding a sample of its allocations.
+//
+//@CLASSES:
+//  bdlma::SamplingGuardingAllocator: allocator guarding sampled allocations
+//
+//@SEE_ALSO: bdlma_guardingallocator, balst_guardfaultreportutil
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::SamplingGuardingAllocator', that implements the 'bslma::Allocator'
+// protocol and detects buffer overflows, buffer underflows, uses after free,
+// double frees, and invalid frees for a *sample* of the allocations made
+// through it, at a cost low enough to be used in production:
+//..
+//   ,--------------------------------.
+//  ( bdlma::SamplingGuardingAllocator )
+//   `--------------------------------'
+//                   |         ctor/dtor
+//                   |         describeAddress
+//                   |         isGuardedAddress
+//                   |         setErrorCallback
+//                   |         setSamplingPeriod
+//                   |         setStackCollector
+//                   V
+//          ,----------------.
+//         ( bslma::Allocator )
+//          `----------------'
+//                             allocate
+//                             deallocate
+//..
+// 'bdlma::GuardingAllocator' adjoins a protected guard page to *every*
+// allocation, which costs at least two pages and several system calls per
+// allocation, and is therefore suitable for debugging only.  A
+// 'bdlma::SamplingGuardingAllocator' instead reserves, at construction, a
+// fixed number of *slots*, each occupying one memory page and separated from
+// its neighbors by protected guard pages.  One in every 'samplingPeriod'
+// allocations (of at most one page) is placed in a free slot; all other
+// allocations, and all allocations made when no slot is free, are forwarded to
+// the allocator supplied at construction.  The cost for the forwarded
+// allocations is a single atomic decrement, while an error in any sampled
+// allocation is detected as soon as it happens.  Running the same code on
+// many processes, or for a long time, therefore detects errors with high
+// probability, in the manner of GWP-ASan.
+//
+///Slot Layout
+///-----------
+// The memory reserved at construction is laid out as follows, where 'G' is a
+// protected guard page and 'S' is a slot:
+//..
+//  -----------------------------------------------------------------
+//  |  G  |  S0  |  G  |  S1  |  G  |  ...  |  G  |  Sn-1  |  G  |
+//  -----------------------------------------------------------------
+//..
+// A sampled block is placed at the end of its slot if guard pages are to
+// detect overflows ('GuardingAllocator::e_AFTER_USER_BLOCK', the default), and
+// at the beginning of its slot if they are to detect underflows
+// ('GuardingAllocator::e_BEFORE_USER_BLOCK').  As for 'GuardingAllocator',
+// blocks are maximally aligned, so an overflow that does not extend past the
+// size of the block rounded up to the maximal alignment is not detected.
+//
+// When a sampled block is deallocated, its slot is protected, so that any
+// subsequent access to the block faults, and the slot is queued for reuse
+// after all other free slots, maximizing the time during which a use after
+// free is detected.
+//
+///Reporting Errors
+///----------------
+// Double frees and invalid frees (of an address inside the slot region that
+// was not returned by 'allocate') are detected by 'deallocate', which invokes
+// the error callback of the allocator (by default, a function that writes a
+// short description to 'stderr' and aborts the process).
+//
+// Overflows, underflows, and uses after free cause a memory protection fault
+// (e.g., 'SIGSEGV') at the point of the erroneous access.  A fault handler can
+// call 'describeAddress' with the faulting address to obtain a description of
+// the error and of the affected block.
+//
+// The allocator records, for each sampled block, the stack of the thread that
+// allocated it and of the thread that deallocated it, using a stack collector
+// function that can be installed using 'setStackCollector'.  This component
+// does not depend on a facility to collect or resolve stack traces;
+// 'balst::GuardFaultReportUtil' installs a stack collector, an error callback,
+// and a fault handler that print the resolved allocation and deallocation
+// stacks of the affected block.
+//
+///Thread Safety
+///-------------
+// The 'allocate', 'deallocate', and accessor methods of a
+// 'bdlma::SamplingGuardingAllocator' are thread-safe.  The 'setErrorCallback',
+// 'setSamplingPeriod', and 'setStackCollector' manipulators must not be
+// invoked concurrently with any other method of the allocator.
+// 'describeAddress' does not acquire any lock, so that it can be called from
+// a signal handler, and may therefore return a description that is
+// inconsistent if the described slot is concurrently allocated or
+// deallocated.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting a Buffer Overflow
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that a server makes many small allocations, one of which is
+// occasionally overrun.  We supply the server with a sampling guarding
+// allocator, so that it runs at almost full speed while some of its
+// allocations are guarded.
+//
+// First, we create an allocator having 16 slots, guarding one allocation in
+// 4, and forwarding the others to the currently installed default allocator:
+//..
+//  bdlma::SamplingGuardingAllocator allocator(16, 4);
+//  assert(16 == allocator.numSlots());
+//  assert( 4 == allocator.samplingPeriod());
+//..
+// Then, we make some allocations, the fourth of which is guarded:
+//..
+//  void *blocks[4];
+//  for (int i = 0; i < 4; ++i) {
+//      blocks[i] = allocator.allocate(96);
+//  }
+//  assert(!allocator.isGuardedAddress(blocks[0]));
+//  assert( allocator.isGuardedAddress(blocks[3]));
+//  assert(1 == allocator.numSlotsInUse());
+//..
+// Next, we simulate a fault handler being invoked for a one-byte overflow of
+// the guarded block.  Since 96 is a multiple of the maximum alignment, the
+// block ends exactly at its guard page, so the overflow would fault (we do not
+// actually access the memory here):
+//..
+//  const char *overflow = static_cast<char *>(blocks[3]) + 96;
+//
+//  bdlma::SamplingGuardingAllocator::BlockInfo info;
+//  assert(0 == allocator.describeAddress(&info, overflow));
+//  assert(bdlma::SamplingGuardingAllocator::e_BUFFER_OVERFLOW ==
+//                                                          info.d_errorKind);
+//  assert(blocks[3] == info.d_blockAddress);
+//  assert(96        == info.d_blockSize);
+//..
+// Finally, we deallocate the blocks; the slot of the guarded block is
+// protected until it is reused:
+//..
+//  for (int i = 0; i < 4; ++i) {
+//      allocator.deallocate(blocks[i]);
+//  }
+//  assert(0 == allocator.numSlotsInUse());
+//
+//  assert(0 == allocator.describeAddress(&info, blocks[3]));
+//  assert(bdlma::SamplingGuardingAllocator::e_USE_AFTER_FREE ==
+//                                                          info.d_errorKind);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_GUARDINGALLOCATOR
+#include <bdlma_guardingallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+struct SamplingGuardingAllocator_Slot;
+
+                      // ===============================
+                      // class SamplingGuardingAllocator
+                      // ===============================
+
+class SamplingGuardingAllocator : public bslma::Allocator {
+    // This class defines a concrete thread-safe allocator mechanism that
+    // implements the 'bslma::Allocator' protocol, places one in every
+    // 'samplingPeriod' allocations in a slot surrounded by protected guard
+    // pages, and forwards the other allocations to the allocator supplied at
+    // construction.
+
+  public:
+    // TYPES
+    enum ErrorKind {
+        // Enumerate the kinds of memory errors detected by this allocator.
+
+        e_UNKNOWN_ERROR,     // address is guarded, but no error is known
+        e_BUFFER_OVERFLOW,   // access past the end of a block
+        e_BUFFER_UNDERFLOW,  // access before the beginning of a block
+        e_USE_AFTER_FREE,    // access to a deallocated block
+        e_DOUBLE_FREE,       // deallocation of a deallocated block
+        e_INVALID_FREE       // deallocation of an address not returned by
+                             // 'allocate'
+    };
+
+    enum {
+        k_MAX_STACK_FRAMES = 16  // maximum number of frames recorded in each
+                                 // allocation and deallocation stack
+    };
+
+    struct BlockInfo {
+        // This 'struct' describes a memory error affecting a block supplied
+        // by a 'SamplingGuardingAllocator', and the block itself.  The
+        // stack frames are ordered from the most recent call to the least
+        // recent, as recorded by the stack collector of the allocator.
+
+        ErrorKind    d_errorKind;       // kind of error
+
+        const void  *d_accessAddress;   // address of the erroneous access
+
+        const void  *d_blockAddress;    // address of the affected block, or
+                                        // 0 if no block is affected
+
+        bsl::size_t  d_blockSize;       // size (in bytes) of the block
+
+        bool         d_isFreed;         // 'true' if the block has been
+                                        // deallocated
+
+        void        *d_allocationStack[k_MAX_STACK_FRAMES];
+                                        // return addresses of the stack that
+                                        // allocated the block
+
+        int          d_numAllocationFrames;
+                                        // number of elements of
+                                        // 'd_allocationStack'
+
+        void        *d_deallocationStack[k_MAX_STACK_FRAMES];
+                                        // return addresses of the stack that
+                                        // deallocated the block
+
+        int          d_numDeallocationFrames;
+                                        // number of elements of
+                                        // 'd_deallocationStack'
+    };
+
+    typedef int (*StackCollector)(void **buffer, int maxFrames);
+        // 'StackCollector' is an alias for a function that loads into the
+        // specified 'buffer' at most the specified 'maxFrames' return
+        // addresses of the stack of the calling thread, ordered from the most
+        // recent call, and returns the number of addresses loaded (e.g.,
+        // 'balst::StackAddressUtil::getStackAddresses').
+
+    typedef void (*ErrorCallback)(const BlockInfo& info);
+        // 'ErrorCallback' is an alias for a function invoked with the
+        // description of an error detected by 'deallocate'.
+
+  private:
+    // DATA
+    bslma::Allocator               *d_allocator_p;      // allocator for
+                                                        // unsampled blocks
+                                                        // and slot metadata
+                                                        // (held, not owned)
+
+    GuardingAllocator::GuardPageLocation
+                                    d_guardPageLocation;
+                                                        // placement of
+                                                        // blocks in slots
+
+    char                           *d_region_p;         // reserved pages
+                                                        // (owned)
+
+    bsl::size_t                     d_regionSize;       // size (in bytes) of
+                                                        // 'd_region_p'
+
+    int                             d_pageSize;         // system page size
+
+    int                             d_numSlots;         // number of slots
+
+    SamplingGuardingAllocator_Slot *d_slots_p;          // slot metadata
+                                                        // (owned)
+
+    int                            *d_freeSlots_p;      // circular queue of
+                                                        // free slot indices
+                                                        // (owned)
+
+    int                             d_freeSlotsHead;    // index in
+                                                        // 'd_freeSlots_p' of
+                                                        // next free slot
+
+    int                             d_numFreeSlots;     // length of the queue
+
+    bsls::AtomicInt                 d_countdown;        // allocations until
+                                                        // the next sample
+
+    int                             d_samplingPeriod;   // one in this many
+                                                        // allocations is
+                                                        // sampled
+
+    bsls::AtomicInt64               d_numSampledAllocations;
+                                                        // total number of
+                                                        // sampled allocations
+
+    StackCollector                  d_stackCollector;   // stack collector, or
+                                                        // 0
+
+    ErrorCallback                   d_errorCallback;    // invoked on errors
+                                                        // detected by
+                                                        // 'deallocate'
+
+    mutable bslmt::Mutex            d_mutex;            // guards the slot
+                                                        // queue and metadata
+
+  private:
+    // NOT IMPLEMENTED
+    SamplingGuardingAllocator(const SamplingGuardingAllocator&);
+    SamplingGuardingAllocator& operator=(const SamplingGuardingAllocator&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    void *allocateSample(size_type size);
+        // Return a block of the specified 'size' (in bytes) placed in a free
+        // slot, or 0 if no slot is free.
+
+    void deallocateSample(void *address);
+        // Return the block at the specified 'address', which is within the
+        // slot region of this allocator, to its slot, or invoke the error
+        // callback if 'address' is not a block in use.
+
+    void init(int numSlots, int samplingPeriod);
+        // Reserve the memory and the metadata of the specified 'numSlots'
+        // slots, and sample one in every specified 'samplingPeriod'
+        // allocations.
+
+    // PRIVATE ACCESSORS
+    void loadBlockInfo(BlockInfo  *result,
+                       int         slotIndex,
+                       ErrorKind   errorKind,
+                       const void *accessAddress) const;
+        // Load into the specified 'result' the description of the specified
+        // 'errorKind' error at the specified 'accessAddress', affecting the
+        // block of the slot having the specified 'slotIndex', or no block if
+        // 'slotIndex' is negative.
+
+  public:
+    // CLASS METHODS
+    static const char *errorKindDescription(ErrorKind kind);
+        // Return the address of a printable, lower-case description of the
+        // specified 'kind' (e.g., "buffer overflow").  The string is
+        // null-terminated and has static storage duration.
+
+    static void abortOnError(const BlockInfo& info);
+        // Write a short description of the error described by the specified
+        // 'info' to 'stderr' and abort the process.  This function is the
+        // default error callback.
+
+    // CREATORS
+    SamplingGuardingAllocator(int               numSlots,
+                              int               samplingPeriod,
+                              bslma::Allocator *basicAllocator = 0);
+    SamplingGuardingAllocator(
+                  int                                   numSlots,
+                  int                                   samplingPeriod,
+                  GuardingAllocator::GuardPageLocation  guardLocation,
+                  bslma::Allocator                     *basicAllocator = 0);
+        // Create a sampling guarding allocator having the specified
+        // 'numSlots' guarded slots, that places one in every specified
+        // 'samplingPeriod' allocations of at most one memory page in a free
+        // slot.  Optionally specify a 'guardLocation' indicating whether
+        // sampled blocks are placed immediately before
+        // ('GuardingAllocator::e_AFTER_USER_BLOCK') or after
+        // ('GuardingAllocator::e_BEFORE_USER_BLOCK') a guard page; if
+        // 'guardLocation' is not specified, overflows are detected.
+        // Optionally specify a 'basicAllocator' used to supply the blocks
+        // that are not sampled and the metadata of the slots.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < numSlots' and
+        // '0 < samplingPeriod'.  Note that '(2 * numSlots + 1)' memory pages
+        // are reserved at construction.
+
+    virtual ~SamplingGuardingAllocator();
+        // Destroy this allocator object, releasing the slots.  The behavior is
+        // undefined if any sampled block is in use.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes).  If this allocation is sampled, 'size'
+        // does not exceed the memory page size, and a slot is free, the block
+        // is placed in that slot; otherwise it is obtained from the allocator
+        // supplied at construction.  If 'size' is 0, no memory is allocated
+        // and 0 is returned.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this method has no effect.  If
+        // 'address' is within the slots of this allocator but is not the
+        // address of a block in use, the error callback is invoked and this
+        // method has no other effect.  The behavior is undefined unless
+        // 'address' is within the slots of this allocator, or was returned by
+        // 'allocate' and has not already been deallocated.
+
+    void setErrorCallback(ErrorCallback callback);
+        // Invoke the specified 'callback' when 'deallocate' detects a double
+        // free or an invalid free.  The behavior is undefined unless
+        // 'callback' is not 0.
+
+    void setSamplingPeriod(int samplingPeriod);
+        // Sample one in every specified 'samplingPeriod' allocations.  The
+        // behavior is undefined unless '0 < samplingPeriod'.
+
+    void setStackCollector(StackCollector collector);
+        // Record the allocation and deallocation stacks of sampled blocks
+        // using the specified 'collector', or do not record stacks if
+        // 'collector' is 0.
+
+    // ACCESSORS
+    int describeAddress(BlockInfo *result, const void *address) const;
+        // Load into the specified 'result' a description of the error
+        // indicated by an access to the specified 'address', and of the block
+        // affected by the error.  Return 0 on success, and a non-zero value
+        // (with no effect on 'result') if 'address' is not within the slots
+        // of this allocator.  An access to a guard page is attributed to the
+        // closest block in use or deallocated.  Note that this method does not
+        // acquire any lock, and can be called from a signal handler.
+
+    bool isGuardedAddress(const void *address) const;
+        // Return 'true' if the specified 'address' is within the slots
+        // (including the guard pages) of this allocator, and 'false'
+        // otherwise.
+
+    bsls::Types::Int64 numSampledAllocations() const;
+        // Return the total number of blocks that have been placed in slots.
+
+    int numSlots() const;
+        // Return the number of guarded slots of this allocator.
+
+    int numSlotsInUse() const;
+        // Return the number of slots holding a block in use.
+
+    int samplingPeriod() const;
+        // Return the number of allocations among which one is sampled.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class SamplingGuardingAllocator
+                      // -------------------------------
+
+// ACCESSORS
+inline
+bool SamplingGuardingAllocator::isGuardedAddress(const void *address) const
+{
+    const char *p = static_cast<const char *>(address);
+
+    return d_region_p <= p && p < d_region_p + d_regionSize;
+}
+
+inline
+bsls::Types::Int64 SamplingGuardingAllocator::numSampledAllocations() const
+{
+    return d_numSampledAllocations.loadRelaxed();
+}
+
+inline
+int SamplingGuardingAllocator::numSlots() const
+{
+    return d_numSlots;
+}
+
+inline
+int SamplingGuardingAllocator::samplingPeriod() const
+{
+    return d_samplingPeriod;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1113 @@
+// bdlma_samplingguardingallocator.t.cpp                              -*-C++-*-
+#include <bdlma_samplingguardingallocator.h>
+
+#include <bdlma_guardingallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+  #include <sys/wait.h>  // 'waitpid', 'WIFSIGNALED'
+  #include <unistd.h>    // 'fork', 'sysconf', '_exit'
+#else
+  #include <windows.h>   // 'GetSystemInfo'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::SamplingGuardingAllocator' is an allocator mechanism that places one
+// in every 'samplingPeriod' allocations in a slot surrounded by protected
+// guard pages, and forwards all other allocations to an underlying allocator.
+// The primary concerns are that exactly the expected allocations are sampled,
+// that sampled blocks are usable and correctly placed within their slots,
+// that slots are reused in FIFO order, and that 'describeAddress' and
+// 'deallocate' correctly classify erroneous accesses and deallocations.  We
+// use a 'bslma::TestAllocator' as the underlying allocator to observe which
+// allocations are forwarded, and, on Unix platforms, verify in a child process
+// that an overflow of a sampled block actually faults.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 5] static const char *errorKindDescription(ErrorKind kind);
+// [ 5] static void abortOnError(const BlockInfo& info);
+//
+// CREATORS
+// [ 2] SamplingGuardingAllocator(int, int, Alloc*);
+// [ 2] SamplingGuardingAllocator(int, int, GuardPageLocation, Alloc*);
+// [ 2] ~SamplingGuardingAllocator();
+//
+// MANIPULATORS
+// [ 2] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 5] void setErrorCallback(ErrorCallback callback);
+// [ 2] void setSamplingPeriod(int samplingPeriod);
+// [ 4] void setStackCollector(StackCollector collector);
+//
+// ACCESSORS
+// [ 4] int describeAddress(BlockInfo *result, const void *address) const;
+// [ 2] bool isGuardedAddress(const void *address) const;
+// [ 2] bsls::Types::Int64 numSampledAllocations() const;
+// [ 2] int numSlots() const;
+// [ 3] int numSlotsInUse() const;
+// [ 2] int samplingPeriod() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCURRENCY
+// [ 7] USAGE EXAMPLE
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::SamplingGuardingAllocator Obj;
+typedef Obj::BlockInfo                   BlockInfo;
+typedef bdlma::GuardingAllocator         GA;
+
+static const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static int getPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+#ifdef BSLS_PLATFORM_OS_UNIX
+    return static_cast<int>(sysconf(_SC_PAGESIZE));
+#else
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<int>(info.dwPageSize);
+#endif
+}
+
+static int stackCollectorCount = 0;
+
+static int testStackCollector(void **buffer, int maxFrames)
+    // Load into the specified 'buffer' 3 (or the specified 'maxFrames', if
+    // less) fake return addresses identifying the invocation of this function
+    // (as counted by 'stackCollectorCount'), and return the number of
+    // addresses loaded.
+{
+    ++stackCollectorCount;
+
+    const int numFrames = maxFrames < 3 ? maxFrames : 3;
+    for (int i = 0; i < numFrames; ++i) {
+        buffer[i] = reinterpret_cast<void *>(
+                        static_cast<bsls::Types::IntPtr>(
+                                           stackCollectorCount * 100 + i + 1));
+    }
+    return numFrames;
+}
+
+static bsl::vector<BlockInfo> *reportedErrors_p = 0;
+
+static void recordError(const BlockInfo& info)
+    // Append the specified 'info' to '*reportedErrors_p'.
+{
+    ASSERT(reportedErrors_p);
+
+    reportedErrors_p->push_back(info);
+}
+
+                            // ==================
+                            // CONCURRENCY HELPER
+                            // ==================
+
+enum {
+    k_NUM_THREADS    = 4,
+    k_NUM_ITERATIONS = 2000,
+    k_NUM_LIVE       = 8
+};
+
+struct ThreadArgs {
+    Obj            *d_allocator_p;
+    bslmt::Barrier *d_barrier_p;
+    int             d_threadId;
+};
+
+extern "C"
+void *workerThread(void *arg)
+    // Allocate, fill, verify, and deallocate blocks from the allocator
+    // identified by the specified 'arg', which addresses a 'ThreadArgs'.
+{
+    ThreadArgs&    args      = *static_cast<ThreadArgs *>(arg);
+    Obj&           mX        = *args.d_allocator_p;
+    const char     FILL      = static_cast<char>('a' + args.d_threadId);
+    char          *live[k_NUM_LIVE];
+    bsl::size_t    sizes[k_NUM_LIVE];
+
+    args.d_barrier_p->wait();
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        for (int j = 0; j < k_NUM_LIVE; ++j) {
+            sizes[j] = 1 + (i * 7 + j * 13) % 300;
+            live[j]  = static_cast<char *>(mX.allocate(sizes[j]));
+            bsl::memset(live[j], FILL, sizes[j]);
+        }
+        for (int j = 0; j < k_NUM_LIVE; ++j) {
+            for (bsl::size_t k = 0; k < sizes[j]; ++k) {
+                if (FILL != live[j][k]) {
+                    LOOP3_ASSERT(i, j, k, FILL == live[j][k]);
+                    break;
+                }
+            }
+            mX.deallocate(live[j]);
+        }
+    }
+    return arg;
+}
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    const int PAGE = getPageSize();
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting a Buffer Overflow
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose that a server makes many small allocations, one of which is
+// occasionally overrun.  We supply the server with a sampling guarding
+// allocator, so that it runs at almost full speed while some of its
+// allocations are guarded.
+//
+// First, we create an allocator having 16 slots, guarding one allocation in
+// 4, and forwarding the others to the currently installed default allocator:
+//..
+    bdlma::SamplingGuardingAllocator allocator(16, 4);
+    ASSERT(16 == allocator.numSlots());
+    ASSERT( 4 == allocator.samplingPeriod());
+//..
+// Then, we make some allocations, the fourth of which is guarded:
+//..
+    void *blocks[4];
+    for (int i = 0; i < 4; ++i) {
+        blocks[i] = allocator.allocate(96);
+    }
+    ASSERT(!allocator.isGuardedAddress(blocks[0]));
+    ASSERT( allocator.isGuardedAddress(blocks[3]));
+    ASSERT(1 == allocator.numSlotsInUse());
+//..
+// Next, we simulate a fault handler being invoked for a one-byte overflow of
+// the guarded block.  Since 96 is a multiple of the maximum alignment, the
+// block ends exactly at its guard page, so the overflow would fault (we do not
+// actually access the memory here):
+//..
+    const char *overflow = static_cast<char *>(blocks[3]) + 96;
+
+    bdlma::SamplingGuardingAllocator::BlockInfo info;
+    ASSERT(0 == allocator.describeAddress(&info, overflow));
+    ASSERT(bdlma::SamplingGuardingAllocator::e_BUFFER_OVERFLOW ==
+                                                            info.d_errorKind);
+    ASSERT(blocks[3] == info.d_blockAddress);
+    ASSERT(96        == info.d_blockSize);
+//..
+// Finally, we deallocate the blocks; the slot of the guarded block is
+// protected until it is reused:
+//..
+    for (int i = 0; i < 4; ++i) {
+        allocator.deallocate(blocks[i]);
+    }
+    ASSERT(0 == allocator.numSlotsInUse());
+
+    ASSERT(0 == allocator.describeAddress(&info, blocks[3]));
+    ASSERT(bdlma::SamplingGuardingAllocator::e_USE_AFTER_FREE ==
+                                                            info.d_errorKind);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Blocks supplied concurrently to several threads, whether sampled
+        //:   or not, do not overlap.
+        //:
+        //: 2 All slots are free once every thread has deallocated its blocks.
+        //
+        // Plan:
+        //: 1 Create an allocator with fewer slots than the number of blocks
+        //:   live at any one time, and sampling one in 3 allocations, so that
+        //:   slots are contended and sometimes exhausted.
+        //:
+        //: 2 In each of several threads, repeatedly allocate several blocks,
+        //:   fill each with a value unique to the thread, verify the contents
+        //:   of every block, and deallocate the blocks.  (C-1)
+        //:
+        //: 3 Verify that some allocations were sampled, that no slot is in
+        //:   use, and that all blocks were returned to the underlying
+        //:   allocator.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj mX(k_NUM_THREADS * k_NUM_LIVE / 2, 3, &ta);
+
+            bslmt::Barrier            barrier(k_NUM_THREADS);
+            ThreadArgs                args[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_allocator_p = &mX;
+                args[i].d_barrier_p   = &barrier;
+                args[i].d_threadId    = i;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      &workerThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            if (veryVerbose) {
+                P(mX.numSampledAllocations());
+            }
+
+            ASSERT(0 <  mX.numSampledAllocations());
+            ASSERT(0 == mX.numSlotsInUse());
+            ASSERT(2 == ta.numBlocksInUse());  // slot metadata
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // DEALLOCATION ERRORS
+        //
+        // Concerns:
+        //: 1 Deallocating a sampled block twice invokes the error callback
+        //:   with 'e_DOUBLE_FREE' and a description of the block, including
+        //:   its allocation and deallocation stacks.
+        //:
+        //: 2 Deallocating an address within the slot region that was not
+        //:   returned by 'allocate' (within a slot or within a guard page)
+        //:   invokes the error callback with 'e_INVALID_FREE'.
+        //:
+        //: 3 An erroneous deallocation has no other effect on the allocator.
+        //:
+        //: 4 The default error callback is 'abortOnError'.
+        //:
+        //: 5 'errorKindDescription' returns a distinct description for each
+        //:   error kind, and a generic one for 'e_UNKNOWN_ERROR'.
+        //
+        // Plan:
+        //: 1 Install a callback recording its arguments, and a stack
+        //:   collector returning known addresses.
+        //:
+        //: 2 Deallocate a sampled block twice, and verify the recorded
+        //:   description.  (C-1)
+        //:
+        //: 3 Deallocate an address within a sampled block, the beginning of a
+        //:   slot that is in use, and the beginning of a guard page, and
+        //:   verify the recorded descriptions.  (C-2)
+        //:
+        //: 4 Verify that the number of slots in use is unaffected, and that
+        //:   the slots remain usable.  (C-3)
+        //:
+        //: 5 On Unix platforms, in a child process, deallocate a sampled
+        //:   block twice with the default callback installed, and verify that
+        //:   the child process is aborted.  (C-4)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null callback (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).
+        //:
+        //: 7 Using the table-driven technique, verify the description of each
+        //:   error kind.  (C-5)
+        //
+        // Testing:
+        //   static const char *errorKindDescription(ErrorKind kind);
+        //   static void abortOnError(const BlockInfo& info);
+        //   void setErrorCallback(ErrorCallback callback);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DEALLOCATION ERRORS" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        bsl::vector<BlockInfo> errors;
+        reportedErrors_p = &errors;
+
+        {
+            Obj mX(2, 1, &ta);
+
+            mX.setErrorCallback(&recordError);
+            mX.setStackCollector(&testStackCollector);
+            stackCollectorCount = 0;
+
+            if (verbose) cout << "\tDouble free." << endl;
+
+            char *p = static_cast<char *>(mX.allocate(40));  // stack 1xx
+            ASSERT(mX.isGuardedAddress(p));
+            mX.deallocate(p);                                // stack 2xx
+            ASSERT(0 == errors.size());
+
+            mX.deallocate(p);
+            ASSERT(1 == errors.size());
+            ASSERT(0 == mX.numSlotsInUse());
+            {
+                const BlockInfo& info = errors.back();
+
+                ASSERT(Obj::e_DOUBLE_FREE == info.d_errorKind);
+                ASSERT(p                  == info.d_accessAddress);
+                ASSERT(p                  == info.d_blockAddress);
+                ASSERT(40                 == info.d_blockSize);
+                ASSERT(true               == info.d_isFreed);
+                ASSERT(3                  == info.d_numAllocationFrames);
+                ASSERT(3                  == info.d_numDeallocationFrames);
+                ASSERT(reinterpret_cast<void *>(101) ==
+                                                  info.d_allocationStack[0]);
+                ASSERT(reinterpret_cast<void *>(201) ==
+                                                info.d_deallocationStack[0]);
+            }
+
+            if (verbose) cout << "\tInvalid free." << endl;
+
+            char *q = static_cast<char *>(mX.allocate(40));
+            ASSERT(mX.isGuardedAddress(q));
+            ASSERT(1 == mX.numSlotsInUse());
+
+            mX.deallocate(q + 8);
+            ASSERT(2 == errors.size());
+            ASSERT(Obj::e_INVALID_FREE == errors.back().d_errorKind);
+            ASSERT(q + 8               == errors.back().d_accessAddress);
+            ASSERT(q                   == errors.back().d_blockAddress);
+            ASSERT(false               == errors.back().d_isFreed);
+
+            char *slotBegin = q - (q - static_cast<char *>(0)) % PAGE;
+            mX.deallocate(slotBegin);
+            ASSERT(3 == errors.size());
+            ASSERT(Obj::e_INVALID_FREE == errors.back().d_errorKind);
+
+            char *guardPage = slotBegin - PAGE;
+            ASSERT(mX.isGuardedAddress(guardPage));
+            mX.deallocate(guardPage);
+            ASSERT(4 == errors.size());
+            ASSERT(Obj::e_INVALID_FREE == errors.back().d_errorKind);
+            ASSERT(0                   == errors.back().d_blockAddress);
+
+            ASSERT(1 == mX.numSlotsInUse());
+            mX.deallocate(q);
+            ASSERT(4 == errors.size());
+            ASSERT(0 == mX.numSlotsInUse());
+
+            void *r = mX.allocate(16);
+            ASSERT(mX.isGuardedAddress(r));
+            mX.deallocate(r);
+            ASSERT(4 == errors.size());
+
+            if (verbose) cout << "\tNegative testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                ASSERT_PASS(mX.setErrorCallback(&recordError));
+                ASSERT_FAIL(mX.setErrorCallback(0));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        reportedErrors_p = 0;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        if (verbose) cout << "\tDefault callback aborts." << endl;
+        {
+            Obj mX(1, 1, &ta);
+
+            void *p = mX.allocate(8);
+            ASSERT(mX.isGuardedAddress(p));
+            mX.deallocate(p);
+
+            const pid_t pid = fork();
+            if (0 == pid) {
+                mX.deallocate(p);
+                _exit(0);
+            }
+            ASSERT(0 < pid);
+
+            int status = 0;
+            ASSERT(pid == waitpid(pid, &status, 0));
+            ASSERT(WIFSIGNALED(status));
+        }
+#endif
+
+        if (verbose) cout << "\tError kind descriptions." << endl;
+        {
+            static const struct {
+                int             d_line;
+                Obj::ErrorKind  d_kind;
+                const char     *d_exp;
+            } DATA[] = {
+                //LINE  KIND                     EXP
+                //----  -----------------------  ------------------
+                { L_,   Obj::e_UNKNOWN_ERROR,    "unknown error"    },
+                { L_,   Obj::e_BUFFER_OVERFLOW,  "buffer overflow"  },
+                { L_,   Obj::e_BUFFER_UNDERFLOW, "buffer underflow" },
+                { L_,   Obj::e_USE_AFTER_FREE,   "use after free"   },
+                { L_,   Obj::e_DOUBLE_FREE,      "double free"      },
+                { L_,   Obj::e_INVALID_FREE,     "invalid free"     },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE = DATA[ti].d_line;
+                const char *EXP  = DATA[ti].d_exp;
+
+                const char *description =
+                                   Obj::errorKindDescription(DATA[ti].d_kind);
+
+                if (veryVerbose) { P_(LINE) P(description) }
+
+                LOOP_ASSERT(LINE, description);
+                LOOP_ASSERT(LINE, 0 == bsl::strcmp(EXP, description));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // DESCRIBE ADDRESS
+        //
+        // Concerns:
+        //: 1 An address within a slot holding a block in use is described as
+        //:   an overflow or underflow of that block, according to its
+        //:   position relative to the block.
+        //:
+        //: 2 An address within a slot holding a deallocated block is described
+        //:   as a use after free of that block.
+        //:
+        //: 3 An address within a guard page is attributed to the closest block
+        //:   of an adjacent slot that has ever been used.
+        //:
+        //: 4 Non-zero is returned, with no effect on the result, for an
+        //:   address outside of the slot region.
+        //:
+        //: 5 The allocation and deallocation stacks are recorded using the
+        //:   installed stack collector, and are not recorded if no stack
+        //:   collector is installed.
+        //:
+        //: 6 Accessing memory past the end of a sampled block (placed before a
+        //:   guard page) causes a fault.
+        //
+        // Plan:
+        //: 1 Using allocators of both guard page locations, sample blocks and
+        //:   describe addresses before, within, and after them, and in the
+        //:   guard pages on each side, before and after deallocating them,
+        //:   with and without a stack collector installed.  (C-1..5)
+        //:
+        //: 2 On Unix platforms, write past the end of a sampled block in a
+        //:   child process, and verify that the child process is terminated
+        //:   by a signal.  (C-6)
+        //
+        // Testing:
+        //   int describeAddress(BlockInfo *result, const void *address) const;
+        //   void setStackCollector(StackCollector collector);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DESCRIBE ADDRESS" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tGuard after user block." << endl;
+        {
+            Obj mX(3, 1, &ta);  const Obj& X = mX;
+
+            BlockInfo info;
+            bsl::memset(&info, 0, sizeof info);
+
+            int dummy;
+            ASSERT(0 != X.describeAddress(&info, &dummy));
+            ASSERT(0 == info.d_blockAddress);
+
+            // Before any block is allocated, the region is unattributed.
+
+            char *slot0 = 0;
+            {
+                char *p = static_cast<char *>(mX.allocate(1));
+                slot0   = p - (p - static_cast<char *>(0)) % PAGE;
+                mX.deallocate(p);
+            }
+            // slot 0 is now at the tail; slot 1 is next
+
+            mX.setStackCollector(&testStackCollector);
+            stackCollectorCount = 0;
+
+            char *p = static_cast<char *>(mX.allocate(100));  // slot 1
+            ASSERT(mX.isGuardedAddress(p));
+
+            char *slot1 = p - (p - static_cast<char *>(0)) % PAGE;
+            ASSERT(slot1 == slot0 + 2 * PAGE);
+
+            const int PADDED = static_cast<int>(
+                          bsls::AlignmentUtil::roundUpToMaximalAlignment(100));
+            ASSERT(slot1 + PAGE - PADDED == p);
+            ASSERT(0 == (p - static_cast<char *>(0)) % MAX_ALIGN);
+            bsl::memset(p, 0xff, 100);
+
+            ASSERT(0 == X.describeAddress(&info, p + 100));
+            ASSERT(Obj::e_BUFFER_OVERFLOW == info.d_errorKind);
+            ASSERT(p + 100                == info.d_accessAddress);
+            ASSERT(p                      == info.d_blockAddress);
+            ASSERT(100                    == info.d_blockSize);
+            ASSERT(false                  == info.d_isFreed);
+            ASSERT(3                      == info.d_numAllocationFrames);
+            ASSERT(0                      == info.d_numDeallocationFrames);
+            ASSERT(reinterpret_cast<void *>(103) ==
+                                                  info.d_allocationStack[2]);
+
+            ASSERT(0 == X.describeAddress(&info, slot1 + PAGE));
+            ASSERT(Obj::e_BUFFER_OVERFLOW == info.d_errorKind);
+            ASSERT(p                      == info.d_blockAddress);
+
+            ASSERT(0 == X.describeAddress(&info, slot1));
+            ASSERT(Obj::e_BUFFER_UNDERFLOW == info.d_errorKind);
+            ASSERT(p                       == info.d_blockAddress);
+
+            ASSERT(0 == X.describeAddress(&info, p + 50));
+            ASSERT(Obj::e_UNKNOWN_ERROR == info.d_errorKind);
+            ASSERT(p                    == info.d_blockAddress);
+
+            // The guard page between slots 0 and 1 is closer to the end of
+            // the block of slot 0 for its first bytes.
+
+            ASSERT(0 == X.describeAddress(&info, slot0 + PAGE));
+            ASSERT(Obj::e_BUFFER_OVERFLOW == info.d_errorKind);
+            ASSERT(slot0 + PAGE - MAX_ALIGN == info.d_blockAddress);
+            ASSERT(true                     == info.d_isFreed);
+
+            // The guard page before slot 0 can only be an underflow of slot 0.
+
+            ASSERT(0 == X.describeAddress(&info, slot0 - 1));
+            ASSERT(Obj::e_BUFFER_UNDERFLOW == info.d_errorKind);
+            ASSERT(slot0 + PAGE - MAX_ALIGN == info.d_blockAddress);
+
+            // Slot 2 has never been used.
+
+            ASSERT(0 == X.describeAddress(&info, slot1 + 2 * PAGE));
+            ASSERT(Obj::e_UNKNOWN_ERROR == info.d_errorKind);
+            ASSERT(0                    == info.d_blockAddress);
+
+            mX.deallocate(p);
+
+            ASSERT(0 == X.describeAddress(&info, p));
+            ASSERT(Obj::e_USE_AFTER_FREE == info.d_errorKind);
+            ASSERT(p                     == info.d_blockAddress);
+            ASSERT(true                  == info.d_isFreed);
+            ASSERT(3                     == info.d_numAllocationFrames);
+            ASSERT(3                     == info.d_numDeallocationFrames);
+            ASSERT(reinterpret_cast<void *>(201) ==
+                                                info.d_deallocationStack[0]);
+
+            mX.setStackCollector(0);
+
+            char *q = static_cast<char *>(mX.allocate(8));  // slot 2
+            ASSERT(0 == X.describeAddress(&info, q + 8));
+            ASSERT(Obj::e_BUFFER_OVERFLOW == info.d_errorKind);
+            ASSERT(0                      == info.d_numAllocationFrames);
+            mX.deallocate(q);
+
+            ASSERT(2 == stackCollectorCount);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tGuard before user block." << endl;
+        {
+            Obj mX(2, 1, GA::e_BEFORE_USER_BLOCK, &ta);  const Obj& X = mX;
+
+            char *p = static_cast<char *>(mX.allocate(100));
+            ASSERT(mX.isGuardedAddress(p));
+            ASSERT(0 == (p - static_cast<char *>(0)) % PAGE);
+            bsl::memset(p, 0xff, 100);
+
+            BlockInfo info;
+
+            ASSERT(0 == X.describeAddress(&info, p - 1));
+            ASSERT(Obj::e_BUFFER_UNDERFLOW == info.d_errorKind);
+            ASSERT(p                       == info.d_blockAddress);
+
+            ASSERT(0 == X.describeAddress(&info, p + 200));
+            ASSERT(Obj::e_BUFFER_OVERFLOW == info.d_errorKind);
+
+            mX.deallocate(p);
+
+            ASSERT(0 == X.describeAddress(&info, p + 10));
+            ASSERT(Obj::e_USE_AFTER_FREE == info.d_errorKind);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        if (verbose) cout << "\tOverflow faults." << endl;
+        {
+            Obj mX(1, 1, &ta);
+
+            char *p = static_cast<char *>(mX.allocate(64));
+            ASSERT(mX.isGuardedAddress(p));
+
+            cout.flush();
+            const pid_t pid = fork();
+            if (0 == pid) {
+                static_cast<volatile char *>(p)[64] = 0;
+                _exit(0);
+            }
+            ASSERT(0 < pid);
+
+            int status = 0;
+            ASSERT(pid == waitpid(pid, &status, 0));
+            ASSERT(WIFSIGNALED(status));
+
+            mX.deallocate(p);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SLOT REUSE
+        //
+        // Concerns:
+        //: 1 'deallocate' returns sampled blocks to their slots, and other
+        //:   blocks to the underlying allocator.
+        //:
+        //: 2 When all slots are in use, sampled allocations are forwarded to
+        //:   the underlying allocator.
+        //:
+        //: 3 Deallocated slots are reused in FIFO order.
+        //:
+        //: 4 'numSlotsInUse' reflects the number of sampled blocks in use.
+        //:
+        //: 5 Deallocating a null pointer has no effect.
+        //
+        // Plan:
+        //: 1 Using an allocator sampling every allocation, allocate more
+        //:   blocks than there are slots, and verify where each block is
+        //:   placed and the number of slots in use.  (C-2, 4)
+        //:
+        //: 2 Deallocate the blocks in an arbitrary order, and verify that the
+        //:   slots are subsequently reused in that order.  (C-1, 3, 4)
+        //:
+        //: 3 Deallocate a null pointer.  (C-5)
+        //
+        // Testing:
+        //   void deallocate(void *address);
+        //   int numSlotsInUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SLOT REUSE" << endl
+                          << "==========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            enum { k_NUM_SLOTS = 4 };
+
+            Obj mX(k_NUM_SLOTS, 1, &ta);  const Obj& X = mX;
+
+            ASSERT(2 == ta.numBlocksInUse());
+
+            void *blocks[k_NUM_SLOTS];
+            for (int i = 0; i < k_NUM_SLOTS; ++i) {
+                blocks[i] = mX.allocate(32);
+                LOOP_ASSERT(i, X.isGuardedAddress(blocks[i]));
+                LOOP_ASSERT(i, i + 1 == X.numSlotsInUse());
+            }
+            ASSERT(2 == ta.numBlocksInUse());
+
+            void *extra = mX.allocate(32);
+            ASSERT(!X.isGuardedAddress(extra));
+            ASSERT(3 == ta.numBlocksInUse());
+            ASSERT(k_NUM_SLOTS == X.numSlotsInUse());
+            ASSERT(k_NUM_SLOTS == X.numSampledAllocations());
+
+            mX.deallocate(extra);
+            ASSERT(2 == ta.numBlocksInUse());
+
+            const int ORDER[k_NUM_SLOTS] = { 2, 0, 3, 1 };
+            for (int i = 0; i < k_NUM_SLOTS; ++i) {
+                mX.deallocate(blocks[ORDER[i]]);
+                LOOP_ASSERT(i, k_NUM_SLOTS - i - 1 == X.numSlotsInUse());
+            }
+
+            mX.deallocate(0);
+            ASSERT(0 == X.numSlotsInUse());
+
+            for (int i = 0; i < k_NUM_SLOTS; ++i) {
+                void *p = mX.allocate(32);
+                LOOP_ASSERT(i, blocks[ORDER[i]] == p);
+                blocks[ORDER[i]] = p;
+            }
+            for (int i = 0; i < k_NUM_SLOTS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(0 == X.numSlotsInUse());
+            ASSERT(2 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS, SAMPLING, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors set the number of slots and the sampling period
+        //:   of the allocator, and obtain the slot metadata from the supplied
+        //:   allocator, or the default allocator if none is supplied.
+        //:
+        //: 2 Exactly one in every 'samplingPeriod' allocations is sampled,
+        //:   and the others are forwarded to the underlying allocator.
+        //:
+        //: 3 Allocations larger than a memory page are never sampled, but
+        //:   still restart the sampling countdown.
+        //:
+        //: 4 'setSamplingPeriod' changes the sampling period and restarts the
+        //:   countdown.
+        //:
+        //: 5 Sampled blocks are maximally aligned and usable, and
+        //:   'isGuardedAddress' is 'true' only for addresses in the slot
+        //:   region.
+        //:
+        //: 6 'allocate(0)' returns 0 and does not count as an allocation.
+        //:
+        //: 7 The destructor releases all memory.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create allocators with each constructor, with and without an
+        //:   allocator, and verify the accessors and the allocators used.
+        //:   (C-1, 7)
+        //:
+        //: 2 For a number of sampling periods, allocate a sequence of blocks
+        //:   of various sizes, and verify which blocks are sampled, and that
+        //:   each can be written.  (C-2..3, 5..6)
+        //:
+        //: 3 Change the sampling period and repeat.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-8)
+        //
+        // Testing:
+        //   SamplingGuardingAllocator(int, int, Alloc*);
+        //   SamplingGuardingAllocator(int, int, GuardPageLocation, Alloc*);
+        //   ~SamplingGuardingAllocator();
+        //   void *allocate(size_type size);
+        //   void setSamplingPeriod(int samplingPeriod);
+        //   bool isGuardedAddress(const void *address) const;
+        //   bsls::Types::Int64 numSampledAllocations() const;
+        //   int numSlots() const;
+        //   int samplingPeriod() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "CONSTRUCTORS, SAMPLING, AND BASIC ACCESSORS" << endl
+                  << "===========================================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator ta("object",  veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tConstructors." << endl;
+        {
+            Obj mX(5, 7);  const Obj& X = mX;
+            ASSERT(5 == X.numSlots());
+            ASSERT(7 == X.samplingPeriod());
+            ASSERT(0 == X.numSampledAllocations());
+            ASSERT(0 == X.numSlotsInUse());
+            ASSERT(2 == da.numBlocksInUse());
+
+            Obj mY(1, 1, GA::e_BEFORE_USER_BLOCK, &ta);  const Obj& Y = mY;
+            ASSERT(1 == Y.numSlots());
+            ASSERT(1 == Y.samplingPeriod());
+            ASSERT(2 == ta.numBlocksInUse());
+            ASSERT(2 == da.numBlocksInUse());
+
+            int dummy;
+            ASSERT(!X.isGuardedAddress(&dummy));
+            ASSERT(!X.isGuardedAddress(0));
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tSampling." << endl;
+        {
+            const int PERIODS[] = { 1, 2, 3, 4, 7, 16 };
+            const int NUM_PERIODS = sizeof PERIODS / sizeof *PERIODS;
+
+            for (int ti = 0; ti < NUM_PERIODS; ++ti) {
+                const int PERIOD = PERIODS[ti];
+
+                enum { k_NUM_ALLOCATIONS = 48 };
+
+                Obj mX(k_NUM_ALLOCATIONS, PERIOD, &ta);  const Obj& X = mX;
+
+                ASSERT(0 == mX.allocate(0));
+
+                bsl::vector<void *> blocks;
+                int                 numSampled = 0;
+
+                for (int i = 0; i < k_NUM_ALLOCATIONS; ++i) {
+                    const int  SIZE     = i % 5 == 2 ? PAGE + 1 : 1 + i * 37;
+                    const bool SAMPLED  = 0 == (i + 1) % PERIOD
+                                       && SIZE <= PAGE;
+
+                    void *p = mX.allocate(SIZE);
+                    LOOP2_ASSERT(PERIOD, i, p);
+                    LOOP2_ASSERT(PERIOD, i,
+                                 SAMPLED == X.isGuardedAddress(p));
+                    LOOP2_ASSERT(PERIOD, i,
+                             0 == (static_cast<char *>(p) -
+                                   static_cast<char *>(0)) % MAX_ALIGN);
+                    bsl::memset(p, 0xff, SIZE);
+
+                    numSampled += SAMPLED;
+                    blocks.push_back(p);
+                }
+                LOOP_ASSERT(PERIOD, numSampled == X.numSampledAllocations());
+                LOOP_ASSERT(PERIOD, numSampled == X.numSlotsInUse());
+
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    mX.deallocate(blocks[i]);
+                }
+                LOOP_ASSERT(PERIOD, 0 == X.numSlotsInUse());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tSetting the sampling period." << endl;
+        {
+            Obj mX(8, 100, &ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(8);
+            ASSERT(!X.isGuardedAddress(p));
+            mX.deallocate(p);
+
+            mX.setSamplingPeriod(2);
+            ASSERT(2 == X.samplingPeriod());
+
+            void *q = mX.allocate(8);
+            void *r = mX.allocate(8);
+            ASSERT(!X.isGuardedAddress(q));
+            ASSERT( X.isGuardedAddress(r));
+            ASSERT(1 == X.numSampledAllocations());
+
+            mX.deallocate(q);
+            mX.deallocate(r);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj( 0, 1, &ta));
+            ASSERT_FAIL(Obj( 1, 0, &ta));
+            ASSERT_PASS(Obj( 1, 1, &ta));
+
+            Obj mX(1, 1, &ta);
+            ASSERT_FAIL(mX.setSamplingPeriod(0));
+            ASSERT_PASS(mX.setSamplingPeriod(1));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object 'mX' sampling every other allocation.
+        //: 2 Allocate blocks from 'mX' and overwrite them.
+        //: 3 Deallocate the blocks.
+        //: 4 Allow 'mX' to go out of scope.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        {
+            Obj mX(4, 2, &ta);
+
+            void *p = mX.allocate(MAX_ALIGN);  ASSERT(p);
+            bsl::memset(p, 0xff, MAX_ALIGN);
+            ASSERT(!mX.isGuardedAddress(p));
+
+            void *q = mX.allocate(1000);       ASSERT(q);
+            bsl::memset(q, 0xff, 1000);
+            ASSERT( mX.isGuardedAddress(q));
+            ASSERT(1 == mX.numSlotsInUse());
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            ASSERT(0 == mX.numSlotsInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
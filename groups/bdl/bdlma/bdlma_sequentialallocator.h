@@ -24,6 +24,8 @@ BSLS_IDENT("$Id: $")
 //   `--------------------------'
 //                |         ctor/dtor
 //                |         allocateAndExpand
+//                |         checkpoint/rewind
+//                |         grow
 //                |         reserveCapacity
 //                |         truncate
 //                V
@@ -55,6 +57,12 @@ BSLS_IDENT("$Id: $")
 // 'bdlma::SequentialAllocator' is more general purpose than a
 // 'bdlma::SequentialPool'.
 //
+// As with 'bdlma::SequentialPool', the memory allocated after a
+// 'bdlma::SequentialCheckpoint' obtained from 'checkpoint' can be released,
+// without releasing the memory allocated before, by supplying that checkpoint
+// to 'rewind'.  The most recently allocated block can also be resized in place
+// using 'grow' and 'truncate'.
+//
 ///Optional 'initialSize' Parameter
 ///--------------------------------
 // An optional 'initialSize' parameter can be supplied at construction to
@@ -365,6 +373,20 @@ class SequentialAllocator : public ManagedAllocator {
         // behavior is undefined unless 'address' is 0, or was allocated by
         // this allocator and has not already been deallocated.
 
+    int grow(void *address, int originalSize, int newSize);
+        // Increase the amount of memory allocated at the specified 'address'
+        // from the specified 'originalSize' (in bytes) to the specified
+        // 'newSize' (in bytes), without moving it.  Return 'newSize' after
+        // growing, or 'originalSize' if the memory at 'address' cannot be
+        // grown in place.  This method can only 'grow' the memory block
+        // returned by the most recent 'allocate' request from this allocator,
+        // provided that the current internal buffer has sufficient remaining
+        // memory, and otherwise has no effect.  The behavior is undefined
+        // unless the memory at 'address' was originally allocated by this
+        // allocator, the size of the memory block at 'address' is
+        // 'originalSize', 'originalSize <= newSize', and neither 'release' nor
+        // 'rewind' was called after allocating the memory block at 'address'.
+
     virtual void release();
         // Release all memory allocated through this allocator.  The allocator
         // is reset to its default constructed state, retaining the alignment
@@ -381,6 +403,13 @@ class SequentialAllocator : public ManagedAllocator {
         // 'numBytes' of memory will be used for allocation before triggering
         // dynamic allocation.
 
+    void rewind(const SequentialCheckpoint& checkpoint);
+        // Release all memory allocated through this allocator after the
+        // specified 'checkpoint' was obtained from it, retaining the memory
+        // allocated before.  The behavior is undefined unless 'checkpoint' was
+        // obtained from this allocator, and neither 'release' nor 'rewind' (to
+        // an earlier checkpoint) was called afterwards.
+
     int truncate(void *address, int originalSize, int newSize);
         // Reduce the amount of memory allocated at the specified 'address' of
         // the specified 'originalSize' (in bytes) to the specified 'newSize'.
@@ -393,6 +422,12 @@ class SequentialAllocator : public ManagedAllocator {
         // 'originalSize', 'newSize <= originalSize', '0 <= newSize', and
         // 'release' was not called after allocating the memory block at
         // 'address'.
+
+    // ACCESSORS
+    SequentialCheckpoint checkpoint() const;
+        // Return a checkpoint recording the current allocation state of this
+        // allocator, which can later be supplied to 'rewind' to release all
+        // memory allocated after this call.
 };
 
 // ============================================================================
@@ -540,18 +575,37 @@ void SequentialAllocator::deallocate(void *)
 {
 }
 
+inline
+int SequentialAllocator::grow(void *address, int originalSize, int newSize)
+{
+    return d_sequentialPool.grow(address, originalSize, newSize);
+}
+
 inline
 void SequentialAllocator::release()
 {
     d_sequentialPool.release();
 }
 
+inline
+void SequentialAllocator::rewind(const SequentialCheckpoint& checkpoint)
+{
+    d_sequentialPool.rewind(checkpoint);
+}
+
 inline
 int SequentialAllocator::truncate(void *address, int originalSize, int newSize)
 {
     return d_sequentialPool.truncate(address, originalSize, newSize);
 }
 
+// ACCESSORS
+inline
+SequentialCheckpoint SequentialAllocator::checkpoint() const
+{
+    return d_sequentialPool.checkpoint();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -72,12 +72,17 @@ using namespace bsl;
 // [ 2] void *allocate(size_type size);
 // [ 5] void *allocateAndExpand(size_type *size);
 // [ 3] void deallocate(void *address);
+// [ 8] int grow(void *address, int originalSize, int newSize);
 // [ 4] void release();
 // [ 7] void reserveCapacity(int numBytes);
+// [ 8] void rewind(const SequentialCheckpoint& checkpoint);
 // [ 6] int truncate(void *address, int originalSize, int newSize);
+//
+// // ACCESSORS
+// [ 8] SequentialCheckpoint checkpoint() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE TEST
+// [ 9] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -280,7 +285,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -311,6 +316,59 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // 'checkpoint', 'rewind', AND 'grow' TEST
+        //
+        // Concerns:
+        //   That 'checkpoint', 'rewind', and 'grow' are correctly forwarded to
+        //   the underlying sequential pool.
+        //
+        // Plan:
+        //   Since 'bdlma::SequentialPool' is thoroughly tested, we perform the
+        //   same sequence of operations on a sequential allocator and on a
+        //   sequential pool using different test allocators, and verify that
+        //   the results and the number of blocks in use are the same.
+        //
+        // Testing:
+        //   SequentialCheckpoint checkpoint() const;
+        //   void rewind(const SequentialCheckpoint& checkpoint);
+        //   int grow(void *address, int originalSize, int newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'checkpoint', 'rewind', AND 'grow' TEST" << endl
+                          << "=======================================" << endl;
+
+        enum { k_INITIAL_SIZE = 64 };
+
+        bslma::TestAllocator poolAllocator(veryVeryVeryVerbose);
+
+        Obj                   mX(k_INITIAL_SIZE, &objectAllocator);
+        bdlma::SequentialPool pool(k_INITIAL_SIZE, &poolAllocator);
+
+        const bdlma::SequentialCheckpoint CX = mX.checkpoint();
+        const bdlma::SequentialCheckpoint CP = pool.checkpoint();
+
+        void *x1 = mX.allocate(8);
+        void *p1 = pool.allocate(8);
+
+        ASSERT(mX.grow(x1, 8, 16) == pool.grow(p1, 8, 16));
+
+        mX.allocate(k_INITIAL_SIZE * 4);
+        pool.allocate(k_INITIAL_SIZE * 4);
+
+        ASSERT(poolAllocator.numBlocksInUse() ==
+                                             objectAllocator.numBlocksInUse());
+
+        mX.rewind(CX);
+        pool.rewind(CP);
+
+        ASSERT(1 == objectAllocator.numBlocksInUse());
+        ASSERT(1 == poolAllocator.numBlocksInUse());
+        ASSERT(CX == mX.checkpoint());
+        ASSERT(x1 == mX.allocate(8));
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // 'reserveCapacity' TEST
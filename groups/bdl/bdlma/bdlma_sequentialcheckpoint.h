@@ -0,0 +1,319 @@
+// bdlma_sequentialcheckpoint.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLMA_SEQUENTIALCHECKPOINT
+#define INCLUDED_BDLMA_SEQUENTIALCHECKPOINT
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a record of the allocation state of a sequential pool.
+//
+//@CLASSES:
+//  bdlma::SequentialCheckpoint: allocation state of a sequential pool
+//
+//@SEE_ALSO: bdlma_sequentialpool, bdlma_bufferedsequentialpool
+//
+//@DESCRIPTION: This component defines an in-core value-semantic class,
+// 'bdlma::SequentialCheckpoint', that records the allocation state of a
+// sequential memory manager (such as 'bdlma::SequentialPool' or
+// 'bdlma::BufferedSequentialPool') at a given point in time.  A checkpoint is
+// obtained from the 'checkpoint' accessor of a sequential pool (or allocator),
+// and can later be supplied to its 'rewind' manipulator to release all of the
+// memory that was allocated after the checkpoint was taken, while retaining
+// the memory allocated before.  This makes it possible to discard scratch
+// data built in phases, one phase at a time, without releasing everything.
+//
+// A checkpoint has the following attributes:
+//..
+//  Name        Type         Default  Description
+//  ----------  -----------  -------  ----------------------------------------
+//  block       const void*  0        address of the most recently allocated
+//                                    block of the pool's block list
+//
+//  buffer      char*        0        address of the buffer from which the pool
+//                                    was allocating memory
+//
+//  bufferSize  int          0        size (in bytes) of 'buffer'
+//
+//  cursor      int          0        offset of the next available byte in
+//                                    'buffer'
+//..
+// The default-constructed checkpoint describes a pool that has not allocated
+// any memory and is not managing any buffer.  Note that a checkpoint holds,
+// but does not own, the memory it describes, and becomes invalid once the
+// memory it describes is released (e.g., by calling 'release' on the pool, or
+// by rewinding the pool to an earlier checkpoint).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Rolling Back a Sequential Memory Manager
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are implementing a sequential memory manager that dispenses
+// memory from buffers obtained from a 'bdlma::InfrequentDeleteBlockList' and
+// managed by a 'bdlma::BufferManager' (as 'bdlma::SequentialPool' does), and
+// that we want to release the memory allocated during a phase of processing
+// while keeping the memory allocated before it.
+//
+// First, we create the block list and the buffer manager, and allocate some
+// memory from an initial buffer:
+//..
+//  bslma::TestAllocator             ta;
+//  bdlma::InfrequentDeleteBlockList blockList(&ta);
+//  bdlma::BufferManager             bufferManager;
+//
+//  bufferManager.replaceBuffer(static_cast<char *>(blockList.allocate(256)),
+//                              256);
+//  void *phase1 = bufferManager.allocate(64);
+//  assert(phase1);
+//..
+// Next, we record the state of our memory manager in a checkpoint:
+//..
+//  const bdlma::SequentialCheckpoint checkpoint(blockList.mostRecentBlock(),
+//                                               bufferManager.buffer(),
+//                                               bufferManager.bufferSize(),
+//                                               bufferManager.cursor());
+//..
+// Then, we allocate more memory, some of it from a new buffer:
+//..
+//  void *phase2 = bufferManager.allocate(100);
+//  assert(phase2);
+//
+//  bufferManager.replaceBuffer(static_cast<char *>(blockList.allocate(1024)),
+//                              1024);
+//  bufferManager.allocate(512);
+//  assert(2 == ta.numBlocksInUse());
+//..
+// Finally, we roll our memory manager back to the state recorded in the
+// checkpoint, which releases the second buffer and makes the memory of
+// 'phase2' available again:
+//..
+//  blockList.releaseAfter(checkpoint.block());
+//  bufferManager.replaceBuffer(checkpoint.buffer(), checkpoint.bufferSize());
+//  bufferManager.rewind(checkpoint.cursor());
+//  assert(1 == ta.numBlocksInUse());
+//
+//  void *phase3 = bufferManager.allocate(100);
+//  assert(phase2 == phase3);
+//..
+// Note that 'bdlma::SequentialPool' and 'bdlma::BufferedSequentialPool'
+// provide 'checkpoint' and 'rewind' methods that perform these steps.
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                        // ==========================
+                        // class SequentialCheckpoint
+                        // ==========================
+
+class SequentialCheckpoint {
+    // This in-core value-semantic class records the allocation state of a
+    // sequential memory manager: the most recently allocated block of its
+    // block list, the buffer from which it dispenses memory, and the offset
+    // of the next available byte in that buffer.
+
+    // DATA
+    const void *d_block_p;     // most recently allocated block (held, not
+                               // owned), or 0
+
+    char       *d_buffer_p;    // current buffer (held, not owned), or 0
+
+    int         d_bufferSize;  // size (in bytes) of the current buffer
+
+    int         d_cursor;      // offset to next available byte in buffer
+
+  public:
+    // CREATORS
+    SequentialCheckpoint();
+        // Create a checkpoint describing a sequential memory manager that has
+        // not allocated any memory and is not managing any buffer.
+
+    SequentialCheckpoint(const void *block,
+                         char       *buffer,
+                         int         bufferSize,
+                         int         cursor);
+        // Create a checkpoint describing a sequential memory manager whose
+        // most recently allocated block is at the specified 'block' address
+        // (or 0 if no block has been allocated), that is allocating memory
+        // from the specified 'buffer' of the specified 'bufferSize' (in bytes)
+        // at the specified 'cursor' offset.  The behavior is undefined unless
+        // '0 <= cursor', 'cursor <= bufferSize', and 'buffer' is 0 only if
+        // 'bufferSize' is 0.
+
+    SequentialCheckpoint(const SequentialCheckpoint& original);
+        // Create a checkpoint having the same value as the specified
+        // 'original' checkpoint.
+
+    // ~SequentialCheckpoint();
+        // Destroy this checkpoint.  Note that this trivial destructor is
+        // generated by the compiler.
+
+    // MANIPULATORS
+    SequentialCheckpoint& operator=(const SequentialCheckpoint& rhs);
+        // Assign to this checkpoint the value of the specified 'rhs'
+        // checkpoint and return a reference providing modifiable access to
+        // this checkpoint.
+
+    // ACCESSORS
+    const void *block() const;
+        // Return the address of the most recently allocated block of the
+        // block list described by this checkpoint, or 0 if no block had been
+        // allocated.
+
+    char *buffer() const;
+        // Return the address of the buffer from which memory was being
+        // allocated when this checkpoint was taken, or 0 if no buffer was
+        // being managed.
+
+    int bufferSize() const;
+        // Return the size (in bytes) of the buffer described by this
+        // checkpoint.
+
+    int cursor() const;
+        // Return the offset of the next available byte in the buffer
+        // described by this checkpoint.
+};
+
+// FREE OPERATORS
+bool operator==(const SequentialCheckpoint& lhs,
+                const SequentialCheckpoint& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' checkpoints have the same
+    // value, and 'false' otherwise.  Two checkpoints have the same value if
+    // all of their corresponding attributes have the same value.
+
+bool operator!=(const SequentialCheckpoint& lhs,
+                const SequentialCheckpoint& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' checkpoints do not have
+    // the same value, and 'false' otherwise.  Two checkpoints do not have the
+    // same value if any of their corresponding attributes differ in value.
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class SequentialCheckpoint
+                        // --------------------------
+
+// CREATORS
+inline
+SequentialCheckpoint::SequentialCheckpoint()
+: d_block_p(0)
+, d_buffer_p(0)
+, d_bufferSize(0)
+, d_cursor(0)
+{
+}
+
+inline
+SequentialCheckpoint::SequentialCheckpoint(const void *block,
+                                           char       *buffer,
+                                           int         bufferSize,
+                                           int         cursor)
+: d_block_p(block)
+, d_buffer_p(buffer)
+, d_bufferSize(bufferSize)
+, d_cursor(cursor)
+{
+    BSLS_ASSERT_SAFE(0 <= cursor);
+    BSLS_ASSERT_SAFE(cursor <= bufferSize);
+    BSLS_ASSERT_SAFE(buffer || 0 == bufferSize);
+}
+
+inline
+SequentialCheckpoint::SequentialCheckpoint(
+                                          const SequentialCheckpoint& original)
+: d_block_p(original.d_block_p)
+, d_buffer_p(original.d_buffer_p)
+, d_bufferSize(original.d_bufferSize)
+, d_cursor(original.d_cursor)
+{
+}
+
+// MANIPULATORS
+inline
+SequentialCheckpoint& SequentialCheckpoint::operator=(
+                                               const SequentialCheckpoint& rhs)
+{
+    d_block_p    = rhs.d_block_p;
+    d_buffer_p   = rhs.d_buffer_p;
+    d_bufferSize = rhs.d_bufferSize;
+    d_cursor     = rhs.d_cursor;
+
+    return *this;
+}
+
+// ACCESSORS
+inline
+const void *SequentialCheckpoint::block() const
+{
+    return d_block_p;
+}
+
+inline
+char *SequentialCheckpoint::buffer() const
+{
+    return d_buffer_p;
+}
+
+inline
+int SequentialCheckpoint::bufferSize() const
+{
+    return d_bufferSize;
+}
+
+inline
+int SequentialCheckpoint::cursor() const
+{
+    return d_cursor;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlma::operator==(const SequentialCheckpoint& lhs,
+                       const SequentialCheckpoint& rhs)
+{
+    return lhs.block()      == rhs.block()
+        && lhs.buffer()     == rhs.buffer()
+        && lhs.bufferSize() == rhs.bufferSize()
+        && lhs.cursor()     == rhs.cursor();
+}
+
+inline
+bool bdlma::operator!=(const SequentialCheckpoint& lhs,
+                       const SequentialCheckpoint& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
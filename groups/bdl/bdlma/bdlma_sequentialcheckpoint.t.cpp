@@ -0,0 +1,463 @@
+// bdlma_sequentialcheckpoint.t.cpp                                   -*-C++-*-
+#include <bdlma_sequentialcheckpoint.h>
+
+#include <bdlma_buffermanager.h>               // for testing only
+#include <bdlma_infrequentdeleteblocklist.h>   // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// A 'bdlma::SequentialCheckpoint' is a simple in-core value-semantic class
+// holding four attributes that are set at construction.  We verify that the
+// constructors establish the expected attribute values, that the equality
+// operators compare every attribute, and that copy construction and
+// assignment preserve the value.
+//-----------------------------------------------------------------------------
+// // CREATORS
+// [ 2] bdlma::SequentialCheckpoint();
+// [ 2] bdlma::SequentialCheckpoint(const void *, char *, int, int);
+// [ 4] bdlma::SequentialCheckpoint(const bdlma::SequentialCheckpoint&);
+//
+// // MANIPULATORS
+// [ 5] operator=(const bdlma::SequentialCheckpoint& rhs);
+//
+// // ACCESSORS
+// [ 2] const void *block() const;
+// [ 2] char *buffer() const;
+// [ 2] int bufferSize() const;
+// [ 2] int cursor() const;
+//
+// // FREE OPERATORS
+// [ 3] bool operator==(const SequentialCheckpoint&, const Sequential...&);
+// [ 3] bool operator!=(const SequentialCheckpoint&, const Sequential...&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEF FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::SequentialCheckpoint Obj;
+
+static int  dummyBlock;
+static char buffer1[64];
+static char buffer2[128];
+
+static const struct {
+    int         d_line;
+    const void *d_block;
+    char       *d_buffer;
+    int         d_bufferSize;
+    int         d_cursor;
+} DATA[] = {
+    //LINE  BLOCK        BUFFER   SIZE  CURSOR
+    //----  -----------  -------  ----  ------
+    { L_,   0,           0,          0,      0 },
+    { L_,   0,           buffer1,   64,      0 },
+    { L_,   0,           buffer1,   64,      8 },
+    { L_,   0,           buffer1,   64,     64 },
+    { L_,   0,           buffer1,   32,      8 },
+    { L_,   &dummyBlock, buffer1,   64,      8 },
+    { L_,   &dummyBlock, buffer2,  128,      8 },
+    { L_,   &dummyBlock, buffer2,  128,    127 },
+};
+static const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+//=============================================================================
+//                               MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Rolling Back a Sequential Memory Manager
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+    bslma::TestAllocator             ta;
+    bdlma::InfrequentDeleteBlockList blockList(&ta);
+    bdlma::BufferManager             bufferManager;
+
+    bufferManager.replaceBuffer(static_cast<char *>(blockList.allocate(256)),
+                                256);
+    void *phase1 = bufferManager.allocate(64);
+    ASSERT(phase1);
+
+    const bdlma::SequentialCheckpoint checkpoint(blockList.mostRecentBlock(),
+                                                 bufferManager.buffer(),
+                                                 bufferManager.bufferSize(),
+                                                 bufferManager.cursor());
+
+    void *phase2 = bufferManager.allocate(100);
+    ASSERT(phase2);
+
+    bufferManager.replaceBuffer(static_cast<char *>(blockList.allocate(1024)),
+                                1024);
+    bufferManager.allocate(512);
+    ASSERT(2 == ta.numBlocksInUse());
+
+    blockList.releaseAfter(checkpoint.block());
+    bufferManager.replaceBuffer(checkpoint.buffer(), checkpoint.bufferSize());
+    bufferManager.rewind(checkpoint.cursor());
+    ASSERT(1 == ta.numBlocksInUse());
+
+    void *phase3 = bufferManager.allocate(100);
+    ASSERT(phase2 == phase3);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY-ASSIGNMENT OPERATOR
+        //
+        // Concerns:
+        //: 1 Any value can be assigned to an object having any initial value,
+        //:   without affecting the value of the source object.
+        //:
+        //: 2 An object can be assigned to itself.
+        //:
+        //: 3 The assignment operator returns a reference to the target.
+        //
+        // Plan:
+        //: 1 For each pair of values in 'DATA', assign one to an object having
+        //:   the other and verify the result against a control object.  (C-1,
+        //:   3)
+        //:
+        //: 2 Assign each object in 'DATA' to itself and verify that its value
+        //:   is unchanged.  (C-2)
+        //
+        // Testing:
+        //   operator=(const bdlma::SequentialCheckpoint& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "COPY-ASSIGNMENT OPERATOR" << endl
+                                  << "========================" << endl;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const Obj Z(DATA[i].d_block,
+                        DATA[i].d_buffer,
+                        DATA[i].d_bufferSize,
+                        DATA[i].d_cursor);
+
+            for (int j = 0; j < NUM_DATA; ++j) {
+                Obj mX(DATA[j].d_block,
+                       DATA[j].d_buffer,
+                       DATA[j].d_bufferSize,
+                       DATA[j].d_cursor);
+                const Obj& X = mX;
+
+                Obj *mR = &(mX = Z);
+
+                LOOP2_ASSERT(i, j, Z  == X);
+                LOOP2_ASSERT(i, j, mR == &mX);
+            }
+
+            Obj mX(Z);  const Obj& X = mX;
+            mX = X;
+            LOOP_ASSERT(i, Z == X);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTOR
+        //
+        // Concerns:
+        //: 1 The new object has the same value as the original object, and the
+        //:   original object is unchanged.
+        //
+        // Plan:
+        //: 1 For each value in 'DATA', copy construct an object and compare it
+        //:   to the original and to a control object.  (C-1)
+        //
+        // Testing:
+        //   bdlma::SequentialCheckpoint(const bdlma::SequentialCheckpoint&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "COPY CONSTRUCTOR" << endl
+                                  << "================" << endl;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const Obj W(DATA[i].d_block,
+                        DATA[i].d_buffer,
+                        DATA[i].d_bufferSize,
+                        DATA[i].d_cursor);
+            const Obj X(DATA[i].d_block,
+                        DATA[i].d_buffer,
+                        DATA[i].d_bufferSize,
+                        DATA[i].d_cursor);
+
+            const Obj Y(X);
+
+            LOOP_ASSERT(i, W == Y);
+            LOOP_ASSERT(i, W == X);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // EQUALITY OPERATORS
+        //
+        // Concerns:
+        //: 1 Two objects compare equal if and only if each of their
+        //:   corresponding attributes compare equal.
+        //:
+        //: 2 'operator!=' returns the inverse of 'operator=='.
+        //
+        // Plan:
+        //: 1 Compare every pair of objects created from the (distinct) values
+        //:   in 'DATA', each of which differs from its neighbor in a single
+        //:   attribute.  (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const SequentialCheckpoint&, const Sequent...&);
+        //   bool operator!=(const SequentialCheckpoint&, const Sequent...&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "EQUALITY OPERATORS" << endl
+                                  << "==================" << endl;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const Obj U(DATA[i].d_block,
+                        DATA[i].d_buffer,
+                        DATA[i].d_bufferSize,
+                        DATA[i].d_cursor);
+
+            for (int j = 0; j < NUM_DATA; ++j) {
+                const Obj V(DATA[j].d_block,
+                            DATA[j].d_buffer,
+                            DATA[j].d_bufferSize,
+                            DATA[j].d_cursor);
+
+                const bool EXP = i == j;
+
+                LOOP2_ASSERT(i, j,  EXP == (U == V));
+                LOOP2_ASSERT(i, j, !EXP == (U != V));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object has all attributes 0.
+        //:
+        //: 2 The value constructor sets each attribute to the supplied value,
+        //:   and each accessor returns the corresponding attribute.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Default construct an object and verify its attributes.  (C-1)
+        //:
+        //: 2 For each value in 'DATA', construct an object and verify its
+        //:   attributes.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid attribute values.  (C-3)
+        //
+        // Testing:
+        //   bdlma::SequentialCheckpoint();
+        //   bdlma::SequentialCheckpoint(const void *, char *, int, int);
+        //   const void *block() const;
+        //   char *buffer() const;
+        //   int bufferSize() const;
+        //   int cursor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONSTRUCTORS AND ACCESSORS" << endl
+                                  << "==========================" << endl;
+
+        {
+            const Obj X;
+
+            ASSERT(0 == X.block());
+            ASSERT(0 == X.buffer());
+            ASSERT(0 == X.bufferSize());
+            ASSERT(0 == X.cursor());
+        }
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int   LINE   = DATA[i].d_line;
+            const void *BLOCK  = DATA[i].d_block;
+            char       *BUFFER = DATA[i].d_buffer;
+            const int   SIZE   = DATA[i].d_bufferSize;
+            const int   CURSOR = DATA[i].d_cursor;
+
+            if (veryVerbose) { T_ P_(LINE) P_(SIZE) P(CURSOR) }
+
+            const Obj X(BLOCK, BUFFER, SIZE, CURSOR);
+
+            LOOP_ASSERT(LINE, BLOCK  == X.block());
+            LOOP_ASSERT(LINE, BUFFER == X.buffer());
+            LOOP_ASSERT(LINE, SIZE   == X.bufferSize());
+            LOOP_ASSERT(LINE, CURSOR == X.cursor());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_PASS(Obj(0, buffer1, 64,  0));
+            ASSERT_SAFE_PASS(Obj(0, buffer1, 64, 64));
+            ASSERT_SAFE_FAIL(Obj(0, buffer1, 64, -1));
+            ASSERT_SAFE_FAIL(Obj(0, buffer1, 64, 65));
+            ASSERT_SAFE_FAIL(Obj(0,       0, 64,  0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create objects using the default and value constructors, and
+        //:   exercise the copy constructor, assignment, and equality
+        //:   operators.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        const Obj Y(&dummyBlock, buffer1, sizeof buffer1, 16);
+
+        ASSERT(X != Y);
+
+        Obj mZ(Y);  const Obj& Z = mZ;
+        ASSERT(Y == Z);
+
+        mX = Z;
+        ASSERT(X == Y);
+
+        mZ = Obj();
+        ASSERT(Obj() == Z);
+        ASSERT(X     != Z);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
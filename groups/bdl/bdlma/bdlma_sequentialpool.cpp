@@ -258,6 +258,19 @@ void *SequentialPool::allocateAndExpand(bsls::Types::size_type *size)
     return result;
 }
 
+void SequentialPool::rewind(const SequentialCheckpoint& checkpoint)
+{
+    d_blockList.releaseAfter(checkpoint.block());
+
+    if (checkpoint.buffer()) {
+        d_buffer.replaceBuffer(checkpoint.buffer(), checkpoint.bufferSize());
+        d_buffer.rewind(checkpoint.cursor());
+    }
+    else {
+        d_buffer.reset();
+    }
+}
+
 void SequentialPool::reserveCapacity(int numBytes)
 {
     BSLS_ASSERT(0 < numBytes);
@@ -29,6 +29,28 @@ BSLS_IDENT("$Id: $")
 // deallocation is needed, but the user does not know in advance the maximum
 // amount of memory needed.
 //
+///Checkpoints
+///-----------
+// Although individual memory blocks cannot be deallocated, the memory
+// allocated after a given point in time can be released in a single
+// operation: The 'checkpoint' accessor returns a 'bdlma::SequentialCheckpoint'
+// recording the current allocation state of the pool, and the 'rewind'
+// manipulator releases all memory allocated after that checkpoint was taken
+// (returning any internal buffers obtained since then to the allocator
+// supplied at construction) while retaining the memory allocated before.
+// Checkpoints may be nested; rewinding to a checkpoint invalidates all
+// checkpoints taken after it.
+//
+///Resizing the Most Recent Allocation
+///-----------------------------------
+// The most recently allocated memory block can be resized in place: 'truncate'
+// gives back the unused tail of the block, and 'grow' extends the block if the
+// current internal buffer has sufficient room, without copying.  Together with
+// 'allocateAndExpand', which returns the largest block that fits in the
+// current internal buffer, this allows a buffer whose final size is not known
+// in advance (e.g., the characters of a string being built) to be grown at the
+// end of the pool and trimmed to its final size once complete.
+//
 ///Optional 'initialSize' Parameter
 ///--------------------------------
 // An optional 'initialSize' parameter can be supplied at construction to
@@ -297,6 +319,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlma_infrequentdeleteblocklist.h>
 #endif
 
+#ifndef INCLUDED_BDLMA_SEQUENTIALCHECKPOINT
+#include <bdlma_sequentialcheckpoint.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -490,6 +516,20 @@ class SequentialPool {
         // 'object' is not deallocated because there is no 'deallocate' method
         // in 'SequentialPool'.
 
+    int grow(void *address, int originalSize, int newSize);
+        // Increase the amount of memory allocated at the specified 'address'
+        // from the specified 'originalSize' (in bytes) to the specified
+        // 'newSize' (in bytes), without moving it.  Return 'newSize' after
+        // growing, or 'originalSize' if the memory block at 'address' cannot
+        // be grown in place.  This method can only 'grow' the memory block
+        // returned by the most recent 'allocate' request from this memory
+        // pool, provided that the current internal buffer has sufficient
+        // remaining memory, and otherwise has no effect.  The behavior is
+        // undefined unless the memory at 'address' was originally allocated by
+        // this memory pool, the size of the memory block at 'address' is
+        // 'originalSize', 'originalSize <= newSize', and neither 'release' nor
+        // 'rewind' was called after allocating the memory block at 'address'.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object'.  Note that this method has the same
@@ -511,6 +551,16 @@ class SequentialPool {
         // that not all 'numBytes' of memory will be used for allocation before
         // triggering dynamic allocation.
 
+    void rewind(const SequentialCheckpoint& checkpoint);
+        // Release all memory allocated through this pool after the specified
+        // 'checkpoint' was obtained from it, retaining the memory allocated
+        // before.  Internal buffers obtained after 'checkpoint' was taken are
+        // returned to the allocator supplied at construction, and subsequent
+        // allocations are satisfied from the internal buffer that was current
+        // when 'checkpoint' was taken.  The behavior is undefined unless
+        // 'checkpoint' was obtained from this pool, and neither 'release' nor
+        // 'rewind' (to an earlier checkpoint) was called afterwards.
+
     int truncate(void *address, int originalSize, int newSize);
         // Reduce the amount of memory allocated at the specified 'address' of
         // the specified 'originalSize' (in bytes) to the specified 'newSize'.
@@ -523,6 +573,12 @@ class SequentialPool {
         // 'address' is 'originalSize', 'newSize <= originalSize',
         // '0 <= newSize', and 'release' was not called after allocating the
         // memory block at 'address'.
+
+    // ACCESSORS
+    SequentialCheckpoint checkpoint() const;
+        // Return a checkpoint recording the current allocation state of this
+        // pool, which can later be supplied to 'rewind' to release all memory
+        // allocated after this call.
 };
 
 }  // close package namespace
@@ -626,6 +682,16 @@ void SequentialPool::deleteObject(const TYPE *object)
     deleteObjectRaw(object);
 }
 
+inline
+int SequentialPool::grow(void *address, int originalSize, int newSize)
+{
+    BSLS_ASSERT_SAFE(address);
+    BSLS_ASSERT_SAFE(0 <= originalSize);
+    BSLS_ASSERT_SAFE(originalSize <= newSize);
+
+    return d_buffer.grow(address, originalSize, newSize);
+}
+
 inline
 void SequentialPool::release()
 {
@@ -647,6 +713,16 @@ int SequentialPool::truncate(void *address, int originalSize, int newSize)
     return d_buffer.truncate(address, originalSize, newSize);
 }
 
+// ACCESSORS
+inline
+SequentialCheckpoint SequentialPool::checkpoint() const
+{
+    return SequentialCheckpoint(d_blockList.mostRecentBlock(),
+                                d_buffer.buffer(),
+                                d_buffer.bufferSize(),
+                                d_buffer.cursor());
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
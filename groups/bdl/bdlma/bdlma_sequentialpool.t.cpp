@@ -74,16 +74,21 @@ using namespace bsl;
 // // MANIPULATORS
 // [ 4] void *allocate(size_type size);
 // [ 7] void *allocateAndExpand(size_type *size);
+// [11] int grow(void *address, int originalSize, int newSize);
 // [ 6] void deleteObjectRaw(const TYPE *object);
 // [ 6] void deleteObject(const TYPE *object);
 // [ 5] void release();
 // [ 9] void reserveCapacity(int numBytes);
+// [11] void rewind(const SequentialCheckpoint& checkpoint);
 // [ 8] int truncate(void *address, int originalSize, int newSize);
+//
+// // ACCESSORS
+// [11] SequentialCheckpoint checkpoint() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HELPER FUNCTION: 'int blockSize(numBytes)'
 // [10] FREE FUNCTION: 'operator new(size_t, bdlma::SequentialPool)'
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -467,7 +472,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -490,6 +495,131 @@ int main(int argc, char *argv[])
                           << "=============" << endl;
 
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // 'checkpoint', 'rewind', AND 'grow' TEST
+        //
+        // Concerns:
+        //   1. That 'rewind' returns to the allocator supplied at construction
+        //      exactly the internal buffers obtained after the checkpoint was
+        //      taken.
+        //
+        //   2. That, after 'rewind', subsequent allocations are satisfied from
+        //      the memory that was available when the checkpoint was taken.
+        //
+        //   3. That checkpoints can be nested, and that rewinding to a
+        //      checkpoint taken before any allocation releases all memory.
+        //
+        //   4. That 'grow' extends the most recent allocation in place if the
+        //      internal buffer has sufficient room, and otherwise returns
+        //      'originalSize'.
+        //
+        // Plan:
+        //   Create a 'bdlma::SequentialPool' using a test allocator, take
+        //   checkpoints between allocations that do and do not trigger
+        //   dynamic allocation, then rewind to each checkpoint in reverse
+        //   order and verify, using the test allocator, the number of blocks
+        //   in use and the address of the next allocation.
+        //
+        //   For concern 4, allocate a block, 'grow' it, and verify that the
+        //   next allocation starts after the grown block; then attempt to
+        //   'grow' beyond the internal buffer and verify that it fails.
+        //
+        // Testing:
+        //   SequentialCheckpoint checkpoint() const;
+        //   void rewind(const SequentialCheckpoint& checkpoint);
+        //   int grow(void *address, int originalSize, int newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'checkpoint', 'rewind', AND 'grow' TEST" << endl
+                          << "=======================================" << endl;
+
+        enum { k_INITIAL_SIZE = 64 };
+
+        if (verbose) cout << "\nTesting 'checkpoint' and 'rewind'." << endl;
+        {
+            Obj mX(k_INITIAL_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   bsls::Alignment::BSLS_BYTEALIGNED,
+                   &objectAllocator);
+            const Obj& X = mX;
+
+            const bdlma::SequentialCheckpoint C0 = X.checkpoint();
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+
+            void *a1 = mX.allocate(16);
+            const bdlma::SequentialCheckpoint C1 = X.checkpoint();
+
+            void *a2 = mX.allocate(16);
+            ASSERT(static_cast<char *>(a1) + 16 == a2);
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+
+            const bdlma::SequentialCheckpoint C2 = X.checkpoint();
+            ASSERT(C1 != C2);
+
+            mX.allocate(k_INITIAL_SIZE);      // new internal buffer
+            mX.allocate(k_INITIAL_SIZE * 4);  // large block
+            ASSERT(3 == objectAllocator.numBlocksInUse());
+
+            mX.rewind(C2);
+            ASSERT(1  == objectAllocator.numBlocksInUse());
+            ASSERT(C2 == X.checkpoint());
+
+            mX.rewind(C1);
+            ASSERT(1  == objectAllocator.numBlocksInUse());
+            ASSERT(a2 == mX.allocate(8));
+
+            mX.rewind(C1);
+            mX.allocate(k_INITIAL_SIZE * 2);
+            ASSERT(2 == objectAllocator.numBlocksInUse());
+
+            mX.rewind(C0);
+            ASSERT(1  == objectAllocator.numBlocksInUse());
+            ASSERT(a1 == mX.allocate(8));
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'rewind' on a default constructed "
+                             "pool." << endl;
+        {
+            Obj mX(&objectAllocator);  const Obj& X = mX;
+
+            const bdlma::SequentialCheckpoint C0 = X.checkpoint();
+            ASSERT(bdlma::SequentialCheckpoint() == C0);
+
+            mX.allocate(8);
+            mX.allocate(k_DEFAULT_SIZE * 2);
+            ASSERT(0 < objectAllocator.numBlocksInUse());
+
+            mX.rewind(C0);
+            ASSERT(0  == objectAllocator.numBlocksInUse());
+            ASSERT(C0 == X.checkpoint());
+
+            ASSERT(0 != mX.allocate(8));
+            ASSERT(1 == objectAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'grow'." << endl;
+        {
+            Obj mX(k_INITIAL_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   bsls::Alignment::BSLS_BYTEALIGNED,
+                   &objectAllocator);
+
+            char *a1 = static_cast<char *>(mX.allocate(8));
+            char *a2 = static_cast<char *>(mX.allocate(8));
+
+            ASSERT(8  == mX.grow(a1, 8, 16));
+            ASSERT(24 == mX.grow(a2, 8, 24));
+            ASSERT(a2 + 24 == mX.allocate(1));
+
+            char *a3 = static_cast<char *>(mX.allocate(1));
+            ASSERT(1 == mX.grow(a3, 1, k_INITIAL_SIZE));
+            ASSERT(a3 + 1 == mX.allocate(1));
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // GLOBAL OPERATOR NEW TEST
@@ -14,9 +14,14 @@ BSLS_IDENT_RCSID(bdlmt_fixedthreadpool_cpp,"$Id$ $CSID$")
 
 #include <bslmt_lockguard.h>
 
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_numaallocator.h>
+
 #include <bdlf_memfn.h>
 #include <bdlt_currenttime.h>
 
+#include <bslma_default.h>
+
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
@@ -60,6 +65,29 @@ void initBlockSet(sigset_t *blockSet)
 namespace BloombergLP {
 
 namespace bdlmt {
+
+                    // ------------------------------------
+                    // struct FixedThreadPool_PlacementUtil
+                    // ------------------------------------
+
+// CLASS METHODS
+void FixedThreadPool_PlacementUtil::loadWorkerNodes(
+                                       bsl::vector<int>      *result,
+                                       int                    numNodes,
+                                       NumProcessorsFunction  numProcessors)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= numNodes);
+    BSLS_ASSERT(numProcessors);
+
+    result->clear();
+    for (int node = 0; node < numNodes; ++node) {
+        if (0 < numProcessors(node)) {
+            result->push_back(node);
+        }
+    }
+}
+
                            // ---------------------
                            // class FixedThreadPool
                            // ---------------------
@@ -173,8 +201,15 @@ void FixedThreadPool::workerThread()
     }
 }
 
-int FixedThreadPool::startNewThread()
+int FixedThreadPool::startNewThread(int index)
 {
+    bslmt::ThreadAttributes attributes(d_threadAttributes);
+
+    if (!d_workerNodes.empty()) {
+        attributes.setNumaNode(d_workerNodes[
+                            index % static_cast<int>(d_workerNodes.size())]);
+    }
+
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Block all asynchronous signals.
 
@@ -185,7 +220,7 @@ int FixedThreadPool::startNewThread()
     bsl::function<void()> workerThreadFunc =
                   bdlf::MemFnUtil::memFn(&FixedThreadPool::workerThread, this);
 
-    int rc = d_threadGroup.addThread(workerThreadFunc, d_threadAttributes);
+    int rc = d_threadGroup.addThread(workerThreadFunc, attributes);
 
 #if defined(BSLS_PLATFORM_OS_UNIX)
     // Restore the mask.
@@ -196,6 +231,47 @@ int FixedThreadPool::startNewThread()
     return rc;
 }
 
+void FixedThreadPool::createNodeAllocators()
+{
+    if (!d_nodeAllocators.empty()) {
+        return;                                                       // RETURN
+    }
+
+    const int numNodes = bslmt::ThreadUtil::numNumaNodes();
+
+    FixedThreadPool_PlacementUtil::loadWorkerNodes(
+                                  &d_workerNodes,
+                                  numNodes,
+                                  &bslmt::ThreadUtil::numNumaNodeProcessors);
+
+    d_numaAllocators.reserve(numNodes);
+    d_nodeAllocators.reserve(numNodes);
+
+    for (int node = 0; node < numNodes; ++node) {
+        d_numaAllocators.push_back(
+                             new (*d_allocator_p) bdlma::NumaAllocator(node));
+        d_nodeAllocators.push_back(
+                     new (*d_allocator_p) bdlma::ConcurrentMultipoolAllocator(
+                                                     d_numaAllocators.back()));
+    }
+}
+
+void FixedThreadPool::destroyNodeAllocators()
+{
+    // Note that the pooling allocators must be destroyed before the
+    // allocators backing them.
+
+    for (bsl::size_t i = 0; i < d_nodeAllocators.size(); ++i) {
+        d_allocator_p->deleteObject(d_nodeAllocators[i]);
+    }
+    for (bsl::size_t i = 0; i < d_numaAllocators.size(); ++i) {
+        d_allocator_p->deleteObject(d_numaAllocators[i]);
+    }
+    d_nodeAllocators.clear();
+    d_numaAllocators.clear();
+    d_workerNodes.clear();
+}
+
 // CREATORS
 
 FixedThreadPool::FixedThreadPool(
@@ -210,6 +286,11 @@ FixedThreadPool::FixedThreadPool(
 , d_threadGroup(basicAllocator)
 , d_threadAttributes(threadAttributes)
 , d_numThreads(numThreads)
+, d_workerPlacement(e_PLACEMENT_NONE)
+, d_workerNodes(basicAllocator)
+, d_numaAllocators(basicAllocator)
+, d_nodeAllocators(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT_OPT(0 != d_numThreads);
 
@@ -229,6 +310,11 @@ FixedThreadPool::FixedThreadPool(int               numThreads,
 , d_numThreadsReady(0)
 , d_threadGroup(basicAllocator)
 , d_numThreads(numThreads)
+, d_workerPlacement(e_PLACEMENT_NONE)
+, d_workerNodes(basicAllocator)
+, d_numaAllocators(basicAllocator)
+, d_nodeAllocators(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT_OPT(0 != d_numThreads);
 
@@ -242,6 +328,7 @@ FixedThreadPool::FixedThreadPool(int               numThreads,
 FixedThreadPool::~FixedThreadPool()
 {
     shutdown();
+    destroyNodeAllocators();
 }
 
 // MANIPULATORS
@@ -317,6 +404,21 @@ void FixedThreadPool::shutdown()
     }
 }
 
+void FixedThreadPool::setWorkerPlacement(WorkerPlacement placement)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    BSLS_ASSERT(e_STOP == d_control.loadRelaxed());
+
+    if (e_PLACEMENT_NUMA_NODE == placement) {
+        createNodeAllocators();
+    }
+    else {
+        destroyNodeAllocators();
+    }
+    d_workerPlacement = placement;
+}
+
 int FixedThreadPool::start()
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
@@ -326,7 +428,7 @@ int FixedThreadPool::start()
     }
 
     for (int i = d_threadGroup.numThreads(); i < d_numThreads; ++i)  {
-        if (0 != startNewThread()) {
+        if (0 != startNewThread(i)) {
 
             releaseWorkerThreads();
             d_threadGroup.joinAll();
@@ -372,6 +474,20 @@ void FixedThreadPool::stop()
         d_threadGroup.joinAll();
     }
 }
+
+// ACCESSORS
+bslma::Allocator *FixedThreadPool::workerAllocator() const
+{
+    if (d_nodeAllocators.empty()) {
+        return d_allocator_p;                                         // RETURN
+    }
+
+    const int node = bslmt::ThreadUtil::currentNumaNode();
+
+    return node < static_cast<int>(d_nodeAllocators.size())
+           ? d_nodeAllocators[node]
+           : d_nodeAllocators[0];
+}
 }  // close package namespace
 
 }  // close enterprise namespace
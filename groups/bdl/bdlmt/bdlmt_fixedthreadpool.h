@@ -91,6 +91,33 @@ BSLS_IDENT("$Id: $")
 // SIGIOT
 //..
 //
+///Worker Placement on NUMA Nodes
+///------------------------------
+// On machines having multiple NUMA nodes (e.g., multi-socket servers), a job
+// that accesses memory attached to another node than the one on which it runs
+// pays a remote-access latency.  By default, the worker threads of a thread
+// pool may run on any processor, and the memory used by jobs is placed
+// wherever the operating system chooses.  Calling 'setWorkerPlacement' with
+// 'e_PLACEMENT_NUMA_NODE' before the pool is started changes this:
+//
+//: o The worker threads are distributed round-robin across the NUMA nodes of
+//:   the machine having processors (worker 'i' is bound to the
+//:   '(i % numNodesWithProcessors)'th such node), by setting the 'numaNode'
+//:   attribute of the thread attributes supplied at construction.  Nodes
+//:   having no processors (e.g., nodes providing only memory) are skipped,
+//:   and if no node is found to have processors, the workers are not bound.
+//:
+//: o For each node, the pool creates a 'bdlma::ConcurrentMultipoolAllocator'
+//:   backed by a 'bdlma::NumaAllocator' placing memory on that node.  A job
+//:   can obtain the allocator of the node on which it runs by calling
+//:   'workerAllocator'.
+//
+// When 'e_PLACEMENT_NONE' (the default) is in effect, 'workerAllocator'
+// returns the allocator supplied at construction.  Note that memory obtained
+// from 'workerAllocator' may be deallocated by any thread, but remains placed
+// on the node of the job that allocated it.  See 'bslmt_threadutil' for the
+// platforms on which thread placement is supported.
+//
 ///Usage
 ///-----
 // This example demonstrates the use of a 'bdlmt::FixedThreadPool' to
@@ -348,8 +375,15 @@ BSLS_IDENT("$Id: $")
 #include <bsl_functional.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 
+namespace bdlma { class ConcurrentMultipoolAllocator; }
+namespace bdlma { class NumaAllocator; }
+
 
 namespace bdlmt {
 
@@ -357,6 +391,31 @@ extern "C" typedef void (*FixedThreadPoolJobFunc)(void *);
     // This type declares the prototype for functions that are suitable to be
     // specified 'bdlmt::FixedThreadPool::enqueueJob'.
 
+                    // ====================================
+                    // struct FixedThreadPool_PlacementUtil
+                    // ====================================
+
+struct FixedThreadPool_PlacementUtil {
+    // This component-private utility computes the NUMA nodes to which the
+    // worker threads of a 'FixedThreadPool' are bound.
+
+    // TYPES
+    typedef int (*NumProcessorsFunction)(int numaNode);
+        // 'NumProcessorsFunction' is an alias for a function returning the
+        // number of processors of the NUMA node having the specified
+        // 'numaNode' index (e.g., 'bslmt::ThreadUtil::numNumaNodeProcessors').
+
+    // CLASS METHODS
+    static void loadWorkerNodes(bsl::vector<int>      *result,
+                                int                    numNodes,
+                                NumProcessorsFunction  numProcessors);
+        // Load into the specified 'result' the indices, in increasing order,
+        // of the NUMA nodes in the range '[0 .. numNodes)', for the specified
+        // 'numNodes', for which the specified 'numProcessors' returns a
+        // positive value.  Note that binding a thread to a node having no
+        // processors fails.
+};
+
                            // =====================
                            // class FixedThreadPool
                            // =====================
@@ -377,6 +436,17 @@ class FixedThreadPool {
       , e_DRAIN
     };
 
+    enum WorkerPlacement {
+        // Enumerate the policies for placing worker threads and the memory
+        // they use (see {Worker Placement on NUMA Nodes}).
+
+        e_PLACEMENT_NONE,      // workers run anywhere, and use the allocator
+                               // supplied at construction
+
+        e_PLACEMENT_NUMA_NODE  // workers are bound round-robin to NUMA
+                               // nodes, and use node-local allocators
+    };
+
   private:
     // DATA
     Queue                   d_queue;              // underlying queue
@@ -426,6 +496,29 @@ class FixedThreadPool {
     const int               d_numThreads;         // number of configured
                                                   // processing threads.
 
+    WorkerPlacement         d_workerPlacement;    // placement of worker
+                                                  // threads and their memory
+
+    bsl::vector<int>        d_workerNodes;        // indices of the nodes
+                                                  // to which workers are
+                                                  // bound round-robin, empty
+                                                  // unless placement is
+                                                  // 'e_PLACEMENT_NUMA_NODE'
+
+    bsl::vector<bdlma::NumaAllocator *>
+                            d_numaAllocators;     // per-node allocators
+                                                  // (owned) backing
+                                                  // 'd_nodeAllocators'
+
+    bsl::vector<bdlma::ConcurrentMultipoolAllocator *>
+                            d_nodeAllocators;     // per-node allocators
+                                                  // (owned) returned by
+                                                  // 'workerAllocator', empty
+                                                  // unless placement is
+                                                  // 'e_PLACEMENT_NUMA_NODE'
+
+    bslma::Allocator       *d_allocator_p;        // memory allocator (held)
+
 #if defined(BSLS_PLATFORM_OS_UNIX)
     sigset_t                d_blockSet;           // set of signals to be
                                                   // blocked in managed threads
@@ -444,11 +537,21 @@ class FixedThreadPool {
     void workerThread();
         // The main function executed by each worker thread.
 
-    int startNewThread();
-        // Internal method to spawn a new processing thread and increment the
+    int startNewThread(int index);
+        // Internal method to spawn a new processing thread having the
+        // specified 'index' among the workers of this pool, and increment the
         // current count.  Note that this method must be called with
         // 'd_metaMutex' locked.
 
+    void createNodeAllocators();
+        // Create a node-local allocator for each NUMA node of the machine,
+        // and determine the nodes to which workers are bound, unless this
+        // has already been done.
+
+    void destroyNodeAllocators();
+        // Destroy the node-local allocators of this pool, if any, and forget
+        // the nodes to which workers are bound.
+
     void waitWorkerThreads();
         // Waits for worker threads to be ready at the gate.
 
@@ -538,6 +641,13 @@ class FixedThreadPool {
         // Disable queuing on this thread pool, cancel all queued jobs, and
         // after all actives jobs have completed, join all processing threads.
 
+    void setWorkerPlacement(WorkerPlacement placement);
+        // Set the policy used to place the worker threads of this pool, and
+        // the memory supplied by 'workerAllocator', to the specified
+        // 'placement' (see {Worker Placement on NUMA Nodes}).  The behavior
+        // is undefined unless this pool is not started and no memory supplied
+        // by 'workerAllocator' is outstanding.
+
     int start();
         // Spawn 'numThreads()' processing threads.  On success, enable
         // enqueuing and return 0.  Return a nonzero value otherwise.  If
@@ -577,6 +687,18 @@ class FixedThreadPool {
     int queueCapacity() const;
         // Return the capacity of the queue used to enqueue jobs by this thread
         // pool.
+
+    bslma::Allocator *workerAllocator() const;
+        // Return the address of the allocator to be used by the calling job
+        // to supply memory that should be local to the thread running it: if
+        // the worker placement is 'e_PLACEMENT_NUMA_NODE', the pooling
+        // allocator of the NUMA node of the calling thread, and the allocator
+        // supplied at construction otherwise.  The behavior is undefined if
+        // this method is called concurrently with 'setWorkerPlacement'.
+
+    WorkerPlacement workerPlacement() const;
+        // Return the policy used to place the worker threads of this pool and
+        // the memory supplied by 'workerAllocator'.
 };
 
 // ============================================================================
@@ -660,6 +782,12 @@ int FixedThreadPool::queueCapacity() const
     return d_queue.size();
 }
 
+inline
+FixedThreadPool::WorkerPlacement FixedThreadPool::workerPlacement() const
+{
+    return d_workerPlacement;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
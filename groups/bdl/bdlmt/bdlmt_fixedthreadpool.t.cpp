@@ -13,6 +13,8 @@
 
 #include <bslma_testallocator.h>
 
+#include <bdlma_concurrentmultipoolallocator.h>
+
 #include <bdlt_currenttime.h>
 #include <bslmt_barrier.h>
 #include <bslmt_lockguard.h>
@@ -60,7 +62,9 @@ using namespace bsl;  // automatically added by script
 // which are controlled by the test case.
 //
 // In addition to positive test cases (run in the nightly builds), a negative
-// test case -1 can be run manually to measure performance of enqueuing jobs.
+// test case -1 can be run manually to measure performance of enqueuing jobs,
+// and a negative test case -2 to measure the effect of worker placement on
+// the locality of the memory used by jobs.
 //
 // [ 3] bdlmt::FixedThreadPool(const bslmt::Attributes&, int, int, int);
 // [ 3] ~bdlmt::FixedThreadPool();
@@ -74,6 +78,10 @@ using namespace bsl;  // automatically added by script
 // [ 4] int queueCapacity() const;
 // [ 4] int numThreadsStarted() const;
 // [ 5] int tryenqueueJob(FixedThreadPoolJobFunc, void *);
+// [15] void setWorkerPlacement(WorkerPlacement placement);
+// [15] bslma::Allocator *workerAllocator() const;
+// [15] WorkerPlacement workerPlacement() const;
+// [16] void FixedThreadPool_PlacementUtil::loadWorkerNodes(...);
 // ----------------------------------------------------------------------------
 // [ 2] TESTING HELPER FUNCTIONS
 // [ 2] Breathing test
@@ -82,6 +90,7 @@ using namespace bsl;  // automatically added by script
 // [ 9] TESTING CPU consumption of an idle pool.
 // [11] Usage examples
 // [12] Usage examples
+// [-2] TESTING PERFORMANCE OF WORKER PLACEMENT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -435,6 +444,114 @@ static void myFastFunctorSearch(const string&         word,
     delete[] jobInfoArray;
 }
 
+// ============================================================================
+//                         CASE 15 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FIXEDTHREADPOOL_CASE_15 {
+
+struct PlacementRecord {
+    // This 'struct' records the placement observed by a job.
+
+    int               d_numaNode;   // node on which the job ran
+    bslma::Allocator *d_allocator;  // allocator returned by 'workerAllocator'
+};
+
+void placementJob(Obj *pool, PlacementRecord *record)
+    // Record, in the specified 'record', the NUMA node on which the calling
+    // job runs and the allocator returned by 'workerAllocator' of the
+    // specified 'pool', and verify that memory can be obtained from that
+    // allocator.
+{
+    record->d_numaNode  = bslmt::ThreadUtil::currentNumaNode();
+    record->d_allocator = pool->workerAllocator();
+
+    void *p = record->d_allocator->allocate(100);
+    bsl::memset(p, 0xa5, 100);
+    record->d_allocator->deallocate(p);
+}
+
+}  // close namespace FIXEDTHREADPOOL_CASE_15
+
+// ============================================================================
+//                         CASE 16 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FIXEDTHREADPOOL_CASE_16 {
+
+const char *s_processorCounts;
+    // Number of processors of each NUMA node reported by
+    // 'numProcessorsFromSpec', as a string of decimal digits, one per node.
+
+int numProcessorsFromSpec(int numaNode)
+    // Return the number of processors of the NUMA node having the specified
+    // 'numaNode' index according to 's_processorCounts', or 0 if
+    // 's_processorCounts' has no digit for that node.
+{
+    return numaNode < static_cast<int>(bsl::strlen(s_processorCounts))
+           ? s_processorCounts[numaNode] - '0'
+           : 0;
+}
+
+}  // close namespace FIXEDTHREADPOOL_CASE_16
+
+// ============================================================================
+//                         CASE -2 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FIXEDTHREADPOOL_CASE_MINUS_2 {
+
+struct ListNode {
+    // This 'struct' is a node of a singly-linked list whose elements are
+    // allocated individually.
+
+    ListNode *d_next_p;
+    int       d_value;
+    char      d_padding[48];
+};
+
+void listJob(Obj               *pool,
+             bslma::Allocator  *sharedAllocator,
+             int                listLength,
+             int                numTraversals,
+             bsls::AtomicInt64 *checksum)
+    // Build a list of the specified 'listLength' nodes from the allocator
+    // returned by 'workerAllocator' of the specified 'pool' or, if the
+    // specified 'sharedAllocator' is not 0, from 'sharedAllocator', traverse
+    // it the specified 'numTraversals' times, destroy it, and add the sum of
+    // the traversed values to the specified 'checksum'.
+{
+    bslma::Allocator *allocator = sharedAllocator
+                                ? sharedAllocator
+                                : pool->workerAllocator();
+
+    ListNode *head = 0;
+    for (int i = 0; i < listLength; ++i) {
+        ListNode *node = static_cast<ListNode *>(
+                                        allocator->allocate(sizeof(ListNode)));
+        node->d_next_p = head;
+        node->d_value  = i;
+        head = node;
+    }
+
+    bsls::Types::Int64 sum = 0;
+    for (int t = 0; t < numTraversals; ++t) {
+        for (const ListNode *node = head; node; node = node->d_next_p) {
+            sum += node->d_value;
+        }
+    }
+
+    while (head) {
+        ListNode *next = head->d_next_p;
+        allocator->deallocate(head);
+        head = next;
+    }
+
+    checksum->addRelaxed(sum);
+}
+
+}  // close namespace FIXEDTHREADPOOL_CASE_MINUS_2
+
 // ============================================================================
 //                         CASE 14 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -671,6 +788,192 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // case 0 is always the first case
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'FixedThreadPool_PlacementUtil::loadWorkerNodes'
+        //
+        // Concerns:
+        //: 1 The nodes to which workers are bound are those having
+        //:   processors, in increasing order of index.
+        //:
+        //: 2 A node having no processors (e.g., an offline node, or a node
+        //:   providing only memory) is skipped, wherever it appears.
+        //:
+        //: 3 If no node has processors, the result is empty.
+        //:
+        //: 4 The previous contents of the result are discarded.
+        //
+        // Plan:
+        //: 1 Using a table of per-node processor counts, reported by a
+        //:   function standing in for 'bslmt::ThreadUtil', call
+        //:   'loadWorkerNodes' on a non-empty vector and verify the result.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   void FixedThreadPool_PlacementUtil::loadWorkerNodes(...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'FixedThreadPool_PlacementUtil::"
+                          << "loadWorkerNodes'\n"
+                          << "========================================"
+                          << "================" << endl;
+
+        using namespace FIXEDTHREADPOOL_CASE_16;
+
+        static const struct {
+            int         d_line;       // source line number
+            int         d_numNodes;   // number of nodes
+            const char *d_counts;     // processors of each node
+            const char *d_expected;   // expected nodes, as digits
+        } DATA[] = {
+            //LINE  NODES  COUNTS      EXPECTED
+            //----  -----  ----------  --------
+            { L_,       0, "",         ""      },
+            { L_,       1, "0",        ""      },
+            { L_,       1, "4",        "0"     },
+            { L_,       2, "44",       "01"    },
+            { L_,       2, "40",       "0"     },
+            { L_,       2, "04",       "1"     },
+            { L_,       2, "00",       ""      },
+            { L_,       4, "4040",     "02"    },
+            { L_,       4, "0404",     "13"    },
+            { L_,       4, "4400",     "01"    },
+            { L_,       4, "21",       "01"    },
+            { L_,       8, "80800808", "0257"  },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE      = DATA[ti].d_line;
+            const int   NUM_NODES = DATA[ti].d_numNodes;
+            const char *EXPECTED  = DATA[ti].d_expected;
+
+            if (veryVerbose) { P_(LINE) P_(DATA[ti].d_counts) P(EXPECTED) }
+
+            s_processorCounts = DATA[ti].d_counts;
+
+            bsl::vector<int> nodes(3, 9);
+            bdlmt::FixedThreadPool_PlacementUtil::loadWorkerNodes(
+                                                      &nodes,
+                                                      NUM_NODES,
+                                                      &numProcessorsFromSpec);
+
+            ASSERTV(LINE, nodes.size(), bsl::strlen(EXPECTED) == nodes.size());
+            for (bsl::size_t i = 0; i < nodes.size(); ++i) {
+                ASSERTV(LINE, i, nodes[i], EXPECTED[i] - '0' == nodes[i]);
+            }
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING WORKER PLACEMENT
+        //
+        // Concerns:
+        //: 1 The worker placement is 'e_PLACEMENT_NONE' by default, and
+        //:   'workerAllocator' then returns the allocator supplied at
+        //:   construction.
+        //:
+        //: 2 When the placement is 'e_PLACEMENT_NUMA_NODE', the pool starts,
+        //:   runs jobs, and 'workerAllocator' returns a usable allocator
+        //:   other than the one supplied at construction, which is the same
+        //:   for all jobs running on the same node.
+        //:
+        //: 3 The placement can be changed while the pool is stopped, and
+        //:   changing it back to 'e_PLACEMENT_NONE' restores the allocator
+        //:   supplied at construction.
+        //:
+        //: 4 All memory allocated by the pool, including the node-local
+        //:   allocators, is supplied by the allocator supplied at
+        //:   construction, and is released on destruction.
+        //
+        // Plan:
+        //: 1 Create a pool with a test allocator and verify the default
+        //:   placement and 'workerAllocator'.  (C-1)
+        //:
+        //: 2 Set the placement to 'e_PLACEMENT_NUMA_NODE', start the pool,
+        //:   and enqueue jobs recording their node and worker allocator, and
+        //:   verify the recorded values.  (C-2)
+        //:
+        //: 3 Stop the pool, set the placement to 'e_PLACEMENT_NONE', and
+        //:   verify 'workerAllocator'.  Then restart the pool with the
+        //:   'e_PLACEMENT_NUMA_NODE' placement.  (C-3)
+        //:
+        //: 4 Destroy the pool and verify that no memory is outstanding from
+        //:   the test allocator, and that the default allocator was not used.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void setWorkerPlacement(WorkerPlacement placement);
+        //   bslma::Allocator *workerAllocator() const;
+        //   WorkerPlacement workerPlacement() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING WORKER PLACEMENT\n"
+                          << "========================" << endl;
+
+        using namespace FIXEDTHREADPOOL_CASE_15;
+
+        const int NUM_NODES   = bslmt::ThreadUtil::numNumaNodes();
+        const int NUM_THREADS = 2 * NUM_NODES + 1;
+        const int NUM_JOBS    = 64;
+
+        if (veryVerbose) { P(NUM_NODES) }
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        const bsls::Types::Int64 NUM_DEFAULT_ALLOCATIONS =
+                                                  taDefault.numAllocations();
+        {
+            Obj mX(NUM_THREADS, NUM_JOBS, &ta);  const Obj& X = mX;
+
+            ASSERT(Obj::e_PLACEMENT_NONE == X.workerPlacement());
+            ASSERT(&ta                   == X.workerAllocator());
+
+            mX.setWorkerPlacement(Obj::e_PLACEMENT_NUMA_NODE);
+            ASSERT(Obj::e_PLACEMENT_NUMA_NODE == X.workerPlacement());
+            ASSERT(&ta                        != X.workerAllocator());
+            ASSERT(0                          != X.workerAllocator());
+
+            for (int pass = 0; pass < 2; ++pass) {
+                bsl::vector<PlacementRecord> records(NUM_JOBS, &ta);
+
+                STARTPOOL(mX);
+
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    const Obj::Job job(bdlf::BindUtil::bind(&placementJob,
+                                                            &mX,
+                                                            &records[i]));
+                    ASSERTV(pass, i, 0 == mX.enqueueJob(job));
+                }
+                mX.drain();
+
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    const PlacementRecord& R = records[i];
+
+                    ASSERTV(pass, i, R.d_numaNode, 0 <= R.d_numaNode);
+                    ASSERTV(pass, i, R.d_numaNode, R.d_numaNode < NUM_NODES);
+                    ASSERTV(pass, i, &ta != R.d_allocator);
+                    ASSERTV(pass, i, 0   != R.d_allocator);
+
+                    for (int j = 0; j < i; ++j) {
+                        if (records[j].d_numaNode == R.d_numaNode) {
+                            ASSERTV(pass, i, j,
+                                    records[j].d_allocator == R.d_allocator);
+                        }
+                    }
+                }
+
+                mX.stop();
+
+                mX.setWorkerPlacement(Obj::e_PLACEMENT_NONE);
+                ASSERTV(pass, Obj::e_PLACEMENT_NONE == X.workerPlacement());
+                ASSERTV(pass, &ta                   == X.workerAllocator());
+
+                mX.setWorkerPlacement(Obj::e_PLACEMENT_NUMA_NODE);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(NUM_DEFAULT_ALLOCATIONS == taDefault.numAllocations());
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TEST CASE FOR WINDOWS TEST FAILURE
@@ -1724,6 +2027,92 @@ int main(int argc, char *argv[])
             localX.shutdown();
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // TESTING PERFORMANCE OF WORKER PLACEMENT
+        //   Measure the effect of binding workers and their memory to NUMA
+        //   nodes on jobs that access memory allocated from a pool.
+        //
+        // Plan:
+        //   Run a series of jobs that each build a linked list of small
+        //   blocks, traverse it repeatedly, and destroy it, first with the
+        //   blocks supplied by a single 'bdlma::ConcurrentMultipoolAllocator'
+        //   shared by all workers (whose memory is populated by the main
+        //   thread beforehand), and then with the 'e_PLACEMENT_NUMA_NODE'
+        //   placement and the blocks supplied by 'workerAllocator'.  Display
+        //   the elapsed time of each run.  Note that the difference is
+        //   significant only on machines having several NUMA nodes, and that
+        //   the verbose parameter can be used to scale the number of
+        //   traversals (default 100).
+        //
+        // Testing:
+        //   TESTING PERFORMANCE OF WORKER PLACEMENT
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "TESTING PERFORMANCE OF WORKER PLACEMENT\n"
+                 << "=======================================" << endl;
+
+        using namespace FIXEDTHREADPOOL_CASE_MINUS_2;
+
+        const int NUM_NODES      = bslmt::ThreadUtil::numNumaNodes();
+        const int NUM_THREADS    = NUM_NODES < 2 ? 4 : 4 * NUM_NODES;
+        const int NUM_JOBS       = 4 * NUM_THREADS;
+        const int LIST_LENGTH    = 64 * 1024;
+        const int NUM_TRAVERSALS = verbose > 1 ? verbose : 100;
+
+        P_(NUM_NODES) P_(NUM_THREADS) P(NUM_TRAVERSALS)
+
+        bdlma::ConcurrentMultipoolAllocator sharedAllocator(&testAllocator);
+        {
+            // Populate the shared pool from the main thread.
+
+            bsl::vector<void *> blocks(&testAllocator);
+            for (int i = 0; i < NUM_THREADS * LIST_LENGTH; ++i) {
+                blocks.push_back(sharedAllocator.allocate(sizeof(ListNode)));
+                bsl::memset(blocks.back(), 0, sizeof(ListNode));
+            }
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                sharedAllocator.deallocate(blocks[i]);
+            }
+        }
+
+        for (int placement = 0; placement < 2; ++placement) {
+            Obj mX(NUM_THREADS, NUM_JOBS, &testAllocator);
+
+            if (placement) {
+                mX.setWorkerPlacement(Obj::e_PLACEMENT_NUMA_NODE);
+            }
+            STARTPOOL(mX);
+
+            bsls::AtomicInt64 checksum(0);
+
+            bsls::Stopwatch timer;  timer.start();
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                mX.enqueueJob(bdlf::BindUtil::bind(
+                                          &listJob,
+                                          &mX,
+                                          placement ? 0 : &sharedAllocator,
+                                          LIST_LENGTH,
+                                          NUM_TRAVERSALS,
+                                          &checksum));
+            }
+            mX.drain();
+            timer.stop();
+
+            const bsls::Types::Int64 EXP = static_cast<bsls::Types::Int64>(
+                                                                    NUM_JOBS)
+                                     * NUM_TRAVERSALS
+                                     * (LIST_LENGTH - 1) * LIST_LENGTH / 2;
+            ASSERTV(checksum, EXP, EXP == checksum);
+
+            cout << (placement ? "\tnode-local workers and memory: "
+                               : "\tshared pool, unplaced workers: ")
+                 << timer.elapsedTime() << "s" << endl;
+
+            mX.stop();
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,209 @@
+// bslalg_hashedbidirectionalnode.h                                   -*-C++-*-
+#ifndef INCLUDED_BSLALG_HASHEDBIDIRECTIONALNODE
+#define INCLUDED_BSLALG_HASHEDBIDIRECTIONALNODE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a node holding a value and its hash code in a linked list.
+//
+//@CLASSES:
+//   bslalg::HashedBidirectionalNode : node holding a value and its hash code
+//
+//@SEE_ALSO: bslalg_bidirectionalnode, bslalg_hashtableimputil
+//
+//@DESCRIPTION: This component provides a single POD-like class template,
+// 'bslalg::HashedBidirectionalNode', used to represent a node in a
+// doubly-linked (bidirectional) list holding a value of a parameterized type
+// together with the hash code of that value.  A
+// 'bslalg::HashedBidirectionalNode' publicly derives from
+// 'bslalg::BidirectionalNode', so it may be used wherever a
+// 'bslalg::BidirectionalNode' holding the same type of value is expected
+// (e.g., by the iterators of a hash table), and adds an attribute 'hashCode'
+// of type 'std::size_t'.  The following inheritance hierarchy diagram shows
+// the classes involved and their methods:
+//..
+//               ,-------------------------------.
+//              ( bslalg::HashedBidirectionalNode )
+//               `-------------------------------'
+//                               |      hashCode
+//                               |      setHashCode
+//                               |      (all CREATORS unimplemented)
+//                               V
+//                  ,-------------------------.
+//                 ( bslalg::BidirectionalNode )
+//                  `-------------------------'
+//                               |      value
+//                               |      (all CREATORS unimplemented)
+//                               V
+//                  ,-------------------------.
+//                 ( bslalg::BidirectionalLink )
+//                  `-------------------------'
+//                                      ctor
+//                                      dtor
+//                                      setNextLink
+//                                      setPreviousLink
+//                                      nextLink
+//                                      previousLink
+//..
+// A hash table whose nodes store the hash codes of their elements can grow
+// (rehash) without invoking the hash functor, and can skip the (potentially
+// expensive) comparison of keys whose hash codes differ from that of the key
+// being sought, at the cost of one 'std::size_t' per node.  See
+// 'bslalg_hashtableimputil' for the operations on hash tables built from
+// nodes of this type.
+//
+// As for 'bslalg::BidirectionalNode', this class is "POD-like" to facilitate
+// efficient allocation and use in the context of container implementations:
+// it defines no constructor or destructor, and the 'value' attribute must be
+// constructed in-place (e.g., by the appropriate 'bsl::allocator_traits'
+// methods).  The 'hashCode' attribute is uninitialized until it is set with
+// 'setHashCode'.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Caching the Hash Code of a Value
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are implementing a container that stores strings in nodes, and
+// we want to avoid rehashing the (potentially long) strings whenever the hash
+// code of an element is needed.
+//
+// First, we allocate a node and construct its value in-place:
+//..
+//  typedef bslalg::HashedBidirectionalNode<const char *> Node;
+//
+//  bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+//
+//  Node *node = static_cast<Node *>(allocator->allocate(sizeof(Node)));
+//  node->reset();
+//  node->value() = "Hello, world!";
+//..
+// Then, we compute the hash code of the value once (for brevity, we hash only
+// the length of the string), and store it in the node:
+//..
+//  const int length = static_cast<int>(strlen(node->value()));
+//  node->setHashCode(bslalg::HashUtil::computeHash(length));
+//..
+// Next, we can retrieve the hash code whenever it is needed, without
+// recomputing it:
+//..
+//  assert(bslalg::HashUtil::computeHash(13) == node->hashCode());
+//..
+// Finally, as the node is also a 'bslalg::BidirectionalNode', code that
+// knows nothing of the hash code can still access the value:
+//..
+//  bslalg::BidirectionalNode<const char *> *base = node;
+//  assert(0 == strcmp("Hello, world!", base->value()));
+//
+//  allocator->deallocate(node);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_BIDIRECTIONALNODE
+#include <bslalg_bidirectionalnode.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                       // =============================
+                       // class HashedBidirectionalNode
+                       // =============================
+
+template <class VALUE>
+class HashedBidirectionalNode : public bslalg::BidirectionalNode<VALUE> {
+    // This POD-like 'class' describes a node suitable for use in a
+    // doubly-linked list of values of the template parameter type 'VALUE',
+    // that additionally stores the hash code of its value.  This class is a
+    // "POD-like" to facilitate efficient allocation and use in the context of
+    // a container implementation.  In order to meet the essential requirements
+    // of a POD type, this 'class' does not define a constructor or destructor.
+
+  private:
+    // DATA
+    native_std::size_t d_hashCode;  // hash code of the value
+
+    // The following creators are not defined because a
+    // 'HashedBidirectionalNode' should never be constructed, destructed, or
+    // assigned.
+
+  private:
+    // NOT IMPLEMENTED
+    HashedBidirectionalNode();
+    HashedBidirectionalNode(const HashedBidirectionalNode&);
+    HashedBidirectionalNode& operator=(const HashedBidirectionalNode&);
+    ~HashedBidirectionalNode();
+
+  public:
+    // MANIPULATORS
+    void setHashCode(native_std::size_t value);
+        // Set the 'hashCode' attribute of this object to the specified
+        // 'value'.
+
+    // ACCESSORS
+    native_std::size_t hashCode() const;
+        // Return the 'hashCode' attribute of this object.  The behavior is
+        // undefined unless the 'hashCode' attribute has been set with
+        // 'setHashCode'.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class HashedBidirectionalNode
+                       // -----------------------------
+
+// MANIPULATORS
+template <class VALUE>
+inline
+void HashedBidirectionalNode<VALUE>::setHashCode(native_std::size_t value)
+{
+    d_hashCode = value;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+native_std::size_t HashedBidirectionalNode<VALUE>::hashCode() const
+{
+    return d_hashCode;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
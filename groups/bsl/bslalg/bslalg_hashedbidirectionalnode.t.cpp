@@ -0,0 +1,402 @@
+// bslalg_hashedbidirectionalnode.t.cpp                               -*-C++-*-
+#include <bslalg_hashedbidirectionalnode.h>
+
+#include <bslalg_hashutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_isconst.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a POD-like node type adding a single attribute
+// to 'bslalg::BidirectionalNode'.  We test that the new attribute can be set
+// and observed, and that the attributes of the base classes remain accessible
+// and are not disturbed by the new attribute.
+//
+// Global Concerns:
+//: o No memory is ever allocated.
+//-----------------------------------------------------------------------------
+// [ 2] void setHashCode(std::size_t value);
+// [ 2] std::size_t hashCode() const;
+// [ 3] BASE CLASS MANIPULATORS AND ACCESSORS
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+// [ 1] BREATHING TEST
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class TYPE>
+bool isConst(TYPE *)
+{
+    return bsl::is_const<TYPE>::value;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;          // suppress warning
+    (void)veryVeryVerbose;      // suppress warning
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: In no case is memory allocated from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        bslma::TestAllocator da("default");
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Caching the Hash Code of a Value
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are implementing a container that stores strings in nodes, and
+// we want to avoid rehashing the (potentially long) strings whenever the hash
+// code of an element is needed.
+//
+// First, we allocate a node and construct its value in-place:
+//..
+    typedef bslalg::HashedBidirectionalNode<const char *> Node;
+
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    Node *node = static_cast<Node *>(allocator->allocate(sizeof(Node)));
+    node->reset();
+    node->value() = "Hello, world!";
+//..
+// Then, we compute the hash code of the value once (for brevity, we hash only
+// the length of the string), and store it in the node:
+//..
+    const int length = static_cast<int>(strlen(node->value()));
+    node->setHashCode(bslalg::HashUtil::computeHash(length));
+//..
+// Next, we can retrieve the hash code whenever it is needed, without
+// recomputing it:
+//..
+    ASSERT(bslalg::HashUtil::computeHash(13) == node->hashCode());
+//..
+// Finally, as the node is also a 'bslalg::BidirectionalNode', code that
+// knows nothing of the hash code can still access the value:
+//..
+    bslalg::BidirectionalNode<const char *> *base = node;
+    ASSERT(0 == strcmp("Hello, world!", base->value()));
+
+    allocator->deallocate(node);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BASE CLASS MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The base class manipulators and accessors are accessible (not
+        //:   private or protected inheritance).
+        //:
+        //: 2 A pointer to the node converts to a pointer to each base class,
+        //:   and 'static_cast' from a pointer to 'bslalg::BidirectionalLink'
+        //:   recovers the original node.
+        //:
+        //: 3 Setting the hash code does not affect the value or the links, and
+        //:   vice versa.
+        //
+        // Plan:
+        //: 1 Create a node, set all of its attributes to distinct values, and
+        //:   observe them through each of the base classes.  Modify each
+        //:   attribute in turn and verify that the others are unchanged.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   BASE CLASS MANIPULATORS AND ACCESSORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBASE CLASS MANIPULATORS AND ACCESSORS"
+                            "\n=====================================\n");
+
+        bslma::TestAllocator da("default");
+        bslma::TestAllocator oa("object");
+
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        typedef bslalg::HashedBidirectionalNode<int> Obj;
+        typedef bslalg::BidirectionalNode<int>       Base;
+        typedef bslalg::BidirectionalLink            Link;
+
+        Obj *xPtr = static_cast<Obj *>(oa.allocate(sizeof(Obj)));
+        Obj& mX = *xPtr; const Obj& X = mX;
+
+        Link *const K1 = reinterpret_cast<Link *>(0xaddc0c0a);
+        Link *const K2 = reinterpret_cast<Link *>(0xbaddeed5);
+
+        mX.reset();
+        mX.value() = 42;
+        mX.setHashCode(0x1234);
+
+        const Base& B = X;
+        const Link& L = X;
+
+        ASSERT(42     == B.value());
+        ASSERT(0      == L.nextLink());
+        ASSERT(0      == L.previousLink());
+        ASSERT(0x1234 == X.hashCode());
+
+        ASSERT(xPtr == static_cast<Obj *>(static_cast<Link *>(xPtr)));
+        ASSERT(&X.value() ==
+                      &static_cast<const Base *>(
+                                   static_cast<const Link *>(xPtr))->value());
+
+        mX.setNextLink(K1);
+        mX.setPreviousLink(K2);
+        ASSERT(K1     == X.nextLink());
+        ASSERT(K2     == X.previousLink());
+        ASSERT(42     == X.value());
+        ASSERT(0x1234 == X.hashCode());
+
+        mX.value() = -7;
+        ASSERT(-7     == X.value());
+        ASSERT(K1     == X.nextLink());
+        ASSERT(0x1234 == X.hashCode());
+
+        mX.setHashCode(~static_cast<native_std::size_t>(0));
+        ASSERT(~static_cast<native_std::size_t>(0) == X.hashCode());
+        ASSERT(-7     == X.value());
+        ASSERT(K1     == X.nextLink());
+        ASSERT(K2     == X.previousLink());
+
+        oa.deallocate(xPtr);
+
+        ASSERTV(0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'setHashCode' sets the 'hashCode' attribute to any value.
+        //:
+        //: 2 'hashCode' returns the value most recently set.
+        //:
+        //: 3 'hashCode' is declared 'const'.
+        //
+        // Plan:
+        //: 1 Using a table of distinct values (including the extremes), set
+        //:   the attribute, re-using one node, and verify the result through a
+        //:   'const' reference.  (C-1..3)
+        //
+        // Testing:
+        //   void setHashCode(std::size_t value);
+        //   std::size_t hashCode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND ACCESSORS"
+                            "\n==================================\n");
+
+        bslma::TestAllocator da("default");
+        bslma::TestAllocator oa("object");
+
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        const native_std::size_t MAX = ~static_cast<native_std::size_t>(0);
+
+        static const struct {
+            int                d_line;
+            native_std::size_t d_hashCode;
+        } DATA[] = {
+            { L_,           0 },
+            { L_,           1 },
+            { L_,        0x80 },
+            { L_,  0x7fffffff },
+            { L_,  0xffffffff },
+            { L_,     MAX - 1 },
+            { L_,         MAX },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        typedef bslalg::HashedBidirectionalNode<double> Obj;
+
+        Obj *xPtr = static_cast<Obj *>(oa.allocate(sizeof(Obj)));
+        Obj& mX = *xPtr; const Obj& X = mX;
+
+        mX.value() = 1.5;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int                LINE      = DATA[i].d_line;
+            const native_std::size_t HASH_CODE = DATA[i].d_hashCode;
+
+            mX.setHashCode(HASH_CODE);
+
+            ASSERTV(LINE, HASH_CODE == X.hashCode());
+            ASSERTV(LINE, 1.5       == X.value());
+        }
+
+        ASSERT(1 == isConst(&X.value()));
+
+        oa.deallocate(xPtr);
+
+        ASSERTV(0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator da("default");
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        typedef bslalg::HashedBidirectionalNode<int> Obj;
+
+        ASSERT(sizeof(bslalg::BidirectionalNode<int>) < sizeof(Obj));
+
+        Obj *xPtr = static_cast<Obj *>(da.allocate(sizeof(Obj)));
+        Obj& mX = *xPtr; const Obj& X = mX;
+
+        mX.value() = 1;
+        mX.setHashCode(2);
+        ASSERTV(X.value(),    1 == X.value());
+        ASSERTV(X.hashCode(), 2 == X.hashCode());
+
+        da.deallocate(&mX);
+        ASSERTV(0 == da.numBytesInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case is memory allocated from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
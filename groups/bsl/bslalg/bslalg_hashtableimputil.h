@@ -96,6 +96,18 @@ BSLS_IDENT("$Id: $")
 //:   'computeBucketIndex(HASHER(extractKey(link)' is the index of the bucket,
 //:   and no other nodes.
 //
+///Stored Hash Codes
+///-----------------
+// A hash table may instead be built from nodes of type
+// 'HashedBidirectionalNode<KEY_CONFIG::ValueType>' (see
+// 'bslalg_hashedbidirectionalnode'), each holding the (non-adjusted) hash
+// code of its element.  Such a table can be searched and rehashed by the
+// '...UsingStoredHashCodes' variants of 'find', 'findInBucket', and 'rehash'.
+// These variants never invoke the hash functor, and compare the hash code of
+// a candidate element with that of the key being sought before comparing the
+// keys themselves.  The caller is responsible for setting the hash code of
+// each node before it is inserted into the table.
+//
 ///'KEY_CONFIG' Template Parameter
 ///-------------------------------
 // Several of the operations provided by 'HashTableImpUtil' are template
@@ -511,6 +523,10 @@ BSLS_IDENT("$Id: $")
 #include <bslalg_bidirectionalnode.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_HASHEDBIDIRECTIONALNODE
+#include <bslalg_hashedbidirectionalnode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_HASHTABLEANCHOR
 #include <bslalg_hashtableanchor.h>
 #endif
@@ -642,6 +658,15 @@ struct HashTableImpUtil {
         // of type 'BidirectionalNode<KEY_CONFIG::ValueType>'.  'KEY_CONFIG'
         // shall be a namespace providing the type name 'ValueType'.
 
+    template <class KEY_CONFIG>
+    static native_std::size_t extractHashCode(
+                                                const BidirectionalLink *link);
+        // Return the hash code stored in the specified 'link'.  The behavior
+        // is undefined unless 'link' refers to a node of type
+        // 'HashedBidirectionalNode<KEY_CONFIG::ValueType>' whose hash code has
+        // been set.  'KEY_CONFIG' shall be a namespace providing the type name
+        // 'ValueType'.
+
     template <class KEY_CONFIG, class HASHER>
     static bool isWellFormed(const HashTableAnchor&  anchor,
                              const HASHER&           hasher,
@@ -758,6 +783,56 @@ struct HashTableImpUtil {
         //                  const KEY_CONFIG::KeyType& key2)
         //..
 
+    template <class KEY_CONFIG, class KEY_EQUAL>
+    static BidirectionalLink *findInBucket(
+              const HashTableBucket&                                    bucket,
+              typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
+              const KEY_EQUAL&                                equalityFunctor);
+        // Return the address of the first link in the specified 'bucket'
+        // having a value matching (according to the specified
+        // 'equalityFunctor') the specified 'key' if such a link exists, and
+        // return 0 otherwise.  The behavior is undefined unless 'bucket' is a
+        // bucket of a well-formed anchor (see 'isWellFormed') for the provided
+        // 'KEY_CONFIG' and some hash function.  'KEY_CONFIG' and 'KEY_EQUAL'
+        // shall meet the requirements described for 'find'.  Note that this
+        // function allows clients that locate (and prefetch) the buckets of
+        // several keys before searching any of them (e.g., to overlap the
+        // latency of the corresponding cache misses) to search those buckets
+        // without recomputing the bucket index.
+
+    template <class KEY_CONFIG, class KEY_EQUAL>
+    static BidirectionalLink *findUsingStoredHashCodes(
+              const HashTableAnchor&                                    anchor,
+              typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
+              const KEY_EQUAL&                                 equalityFunctor,
+              native_std::size_t                                     hashCode);
+        // Return the address of the first link in the list element of the
+        // specified 'anchor' having the specified 'hashCode' and a value
+        // matching (according to the specified 'equalityFunctor') the
+        // specified 'key' if such a link exists, and return 0 otherwise.
+        // 'equalityFunctor' is not invoked for links whose stored hash code
+        // differs from 'hashCode'.  The behavior is undefined unless 'anchor'
+        // is well-formed for the provided 'KEY_CONFIG' and some hash function,
+        // 'HASHER', such that 'HASHER(key)' returns 'hashCode', and each link
+        // in the list of 'anchor' is a
+        // 'HashedBidirectionalNode<KEY_CONFIG::ValueType>' storing the hash
+        // code of its key.  'KEY_CONFIG' and 'KEY_EQUAL' shall meet the
+        // requirements described for 'find'.
+
+    template <class KEY_CONFIG, class KEY_EQUAL>
+    static BidirectionalLink *findInBucketUsingStoredHashCodes(
+              const HashTableBucket&                                    bucket,
+              typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
+              const KEY_EQUAL&                                 equalityFunctor,
+              native_std::size_t                                     hashCode);
+        // Return the address of the first link in the specified 'bucket'
+        // having the specified 'hashCode' and a value matching (according to
+        // the specified 'equalityFunctor') the specified 'key' if such a link
+        // exists, and return 0 otherwise.  'equalityFunctor' is not invoked
+        // for links whose stored hash code differs from 'hashCode'.  The
+        // behavior is undefined unless 'bucket' is a bucket of an anchor
+        // meeting the requirements described for 'findUsingStoredHashCodes'.
+
     template <class KEY_CONFIG, class HASHER>
     static void rehash(HashTableAnchor   *newAnchor,
                        BidirectionalLink *elementList,
@@ -775,6 +850,22 @@ struct HashTableImpUtil {
         // whose nodes are each of type
         // 'BidirectionalNode<KEY_CONFIG::ValueType>', the previous address of
         // the first node and the next address of the last node are 0.
+
+    template <class KEY_CONFIG>
+    static void rehashUsingStoredHashCodes(HashTableAnchor   *newAnchor,
+                                           BidirectionalLink *elementList);
+        // Populate the specified 'newAnchor' with all the elements in the
+        // specified 'elementList', using the hash code stored in each element
+        // to determine its bucket.  This operation does not invoke any hash
+        // functor, and does not throw.  The buckets in the array in
+        // 'newAnchor' and the list root address in 'newAnchor' are assumed to
+        // be garbage and overwritten.  The behavior is undefined unless
+        // 'newAnchor' has one or more buckets, and 'elementList' is a
+        // well-formed bi-directional list (see
+        // 'BidirectionalLinkListUtil::isWellFormed') whose nodes are each of
+        // type 'HashedBidirectionalNode<KEY_CONFIG::ValueType>' storing the
+        // hash code of its key, the previous address of the first node and
+        // the next address of the last node are 0.
 };
 
 // ============================================================================
@@ -856,6 +947,18 @@ HashTableImpUtil::extractKey(BidirectionalLink *link)
     return KEY_CONFIG::extractKey(node->value());
 }
 
+template<class KEY_CONFIG>
+inline
+native_std::size_t HashTableImpUtil::extractHashCode(
+                                                 const BidirectionalLink *link)
+{
+    BSLS_ASSERT_SAFE(link);
+
+    typedef HashedBidirectionalNode<typename KEY_CONFIG::ValueType> HNode;
+
+    return static_cast<const HNode *>(link)->hashCode();
+}
+
 template <class KEY_CONFIG, class KEY_EQUAL>
 inline
 BidirectionalLink *HashTableImpUtil::find(
@@ -870,8 +973,18 @@ BidirectionalLink *HashTableImpUtil::find(
     const HashTableBucket *bucket = findBucketForHashCode(anchor, hashCode);
     BSLS_ASSERT_SAFE(bucket);
 
-    for (BidirectionalLink *cursor     = bucket->first(),
-                           * const end = bucket->end();
+    return findInBucket<KEY_CONFIG>(*bucket, key, equalityFunctor);
+}
+
+template <class KEY_CONFIG, class KEY_EQUAL>
+inline
+BidirectionalLink *HashTableImpUtil::findInBucket(
+  const HashTableBucket&                                       bucket,
+  typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
+  const KEY_EQUAL&                                             equalityFunctor)
+{
+    for (BidirectionalLink *cursor     = bucket.first(),
+                           * const end = bucket.end();
                                  end != cursor; cursor = cursor->nextLink() ) {
         if (equalityFunctor(key, extractKey<KEY_CONFIG>(cursor))) {
             return cursor;                                            // RETURN
@@ -881,6 +994,46 @@ BidirectionalLink *HashTableImpUtil::find(
     return 0;
 }
 
+template <class KEY_CONFIG, class KEY_EQUAL>
+inline
+BidirectionalLink *HashTableImpUtil::findUsingStoredHashCodes(
+  const HashTableAnchor&                                       anchor,
+  typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
+  const KEY_EQUAL&                                             equalityFunctor,
+  native_std::size_t                                           hashCode)
+{
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
+
+    const HashTableBucket *bucket = findBucketForHashCode(anchor, hashCode);
+    BSLS_ASSERT_SAFE(bucket);
+
+    return findInBucketUsingStoredHashCodes<KEY_CONFIG>(*bucket,
+                                                        key,
+                                                        equalityFunctor,
+                                                        hashCode);
+}
+
+template <class KEY_CONFIG, class KEY_EQUAL>
+inline
+BidirectionalLink *HashTableImpUtil::findInBucketUsingStoredHashCodes(
+  const HashTableBucket&                                       bucket,
+  typename HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type key,
+  const KEY_EQUAL&                                             equalityFunctor,
+  native_std::size_t                                           hashCode)
+{
+    for (BidirectionalLink *cursor     = bucket.first(),
+                           * const end = bucket.end();
+                                 end != cursor; cursor = cursor->nextLink() ) {
+        if (hashCode == extractHashCode<KEY_CONFIG>(cursor)
+         && equalityFunctor(key, extractKey<KEY_CONFIG>(cursor))) {
+            return cursor;                                            // RETURN
+        }
+    }
+
+    return 0;
+}
+
 template <class KEY_CONFIG, class HASHER>
 void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
                               BidirectionalLink *elementList,
@@ -957,6 +1110,37 @@ void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
     }
 }
 
+template <class KEY_CONFIG>
+void HashTableImpUtil::rehashUsingStoredHashCodes(
+                                              HashTableAnchor   *newAnchor,
+                                              BidirectionalLink *elementList)
+{
+    BSLS_ASSERT_SAFE(newAnchor);
+    BSLS_ASSERT_SAFE(newAnchor->bucketArrayAddress());
+    BSLS_ASSERT_SAFE(0 != newAnchor->bucketArraySize());
+    BSLS_ASSERT_SAFE(!elementList || !elementList->previousLink());
+
+    // As no user code is invoked, no proctor is needed to restore a single
+    // list if an exception is thrown (see 'rehash').
+
+    for (void **cursor     = (void **)  newAnchor->bucketArrayAddress(),
+              ** const end = (void **) (newAnchor->bucketArrayAddress() +
+                                        newAnchor->bucketArraySize());
+                                                      cursor < end; ++cursor) {
+        *cursor = 0;
+    }
+    newAnchor->setListRootAddress(0);
+
+    while (elementList) {
+        BidirectionalLink *nextNode = elementList;
+        elementList = elementList->nextLink();
+
+        insertAtBackOfBucket(newAnchor,
+                             nextNode,
+                             extractHashCode<KEY_CONFIG>(nextNode));
+    }
+}
+
 template <class KEY_CONFIG, class HASHER>
 bool HashTableImpUtil::isWellFormed(const HashTableAnchor&  anchor,
                                     const HASHER&           hasher,
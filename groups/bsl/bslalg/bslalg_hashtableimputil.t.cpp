@@ -45,9 +45,14 @@ using namespace BloombergLP::bslalg;
 // ----------------------------------------------------------------------------
 // [  ] ...
 // ----------------------------------------------------------------------------
+// [12] size_t extractHashCode(const BidirectionalLink *link);
+// [12] findUsingStoredHashCodes(const Anchor& a, KeyType& k, eq, size_t h);
+// [12] findInBucketUsingStoredHashCodes(const Bucket& b, k, eq, size_t h);
+// [12] rehashUsingStoredHashCodes(HashTableAnchor *a, BidirectionalLink *r);
 // [10] remove(HashTableAnchor *a, BidirectionalLink *l, size_t  h);
 // [10] bucketContainsLink(const Bucket& b, BidirectionalLink *l);
 // [ 9] find(const HashTableAnchor& a, KeyType& key, comparator, size_t h);
+// [ 9] findInBucket(const HashTableBucket& b, KeyType& key, comparator);
 // [ 8] rehash(  HashTableAnchor *a, BidirectionalLink *r, const HASHER& h);
 // [ 7] isWellFormed(const HashTableAnchor& anchor, bslma::Allocator *a = 0);
 // [ 6] insertAtPosition(Anchor *a, Link *l, size_t h, Link  *p);
@@ -330,6 +335,31 @@ struct Mod100Hasher {
     }
 };
 
+struct Times7Hasher {
+    size_t operator()(int value) const
+    {
+        return (unsigned) value * 7;
+    }
+};
+
+struct CountingEquals {
+    // This functor compares two 'int' values for equality, counting the number
+    // of times it is invoked.
+
+    int *d_numCalls_p;
+
+    explicit CountingEquals(int *numCalls)
+    : d_numCalls_p(numCalls)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        ++*d_numCalls_p;
+        return lhs == rhs;
+    }
+};
+
 struct Mod8Hasher {
     size_t operator()(int value) const
     {
@@ -672,7 +702,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -753,6 +783,143 @@ int main(int argc, char *argv[])
         ASSERT(0 == hs.count("chomp"));
 //..
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING STORED HASH CODES
+        //
+        // Concerns:
+        //: 1 'extractHashCode' returns the hash code stored in a
+        //:   'HashedBidirectionalNode'.
+        //:
+        //: 2 'rehashUsingStoredHashCodes' distributes the elements of a list
+        //:   to the buckets determined by their stored hash codes, leaving a
+        //:   well-formed anchor, for any number of buckets.
+        //:
+        //: 3 'findUsingStoredHashCodes' and 'findInBucketUsingStoredHashCodes'
+        //:   find every element in the table, and no element that is not.
+        //:
+        //: 4 The equality functor is invoked only for elements whose stored
+        //:   hash code matches that of the key being sought.
+        //:
+        //: 5 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Create a list of 'HashedBidirectionalNode<int>' objects, each
+        //:   storing the hash code returned by 'Times7Hasher' for its value.
+        //:   (C-1)
+        //:
+        //: 2 For a series of bucket array sizes, rehash the list into an
+        //:   anchor with 'rehashUsingStoredHashCodes', and verify that the
+        //:   anchor is well-formed for 'Times7Hasher'.  (C-2)
+        //:
+        //: 3 Search for each value in the table and for values not in the
+        //:   table with both find functions, supplying a 'CountingEquals'
+        //:   functor, and verify both the result and the number of times the
+        //:   functor is invoked.  (C-3..4)
+        //:
+        //: 4 Verify that the default allocator is not used.  (C-5)
+        //
+        // Testing:
+        //   size_t extractHashCode(const BidirectionalLink *link);
+        //   findUsingStoredHashCodes(const Anchor& a, KeyType& k, eq, size_t);
+        //   findInBucketUsingStoredHashCodes(const Bucket& b, k, eq, size_t);
+        //   rehashUsingStoredHashCodes(HashTableAnchor *a, Link *r);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING STORED HASH CODES\n"
+                            "=========================\n");
+
+        bslma::TestAllocator da("defaultAllocator", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard defaultGuard(&da);
+
+        bslma::TestAllocator oa("objectAllocator", veryVeryVeryVerbose);
+
+        typedef HashedBidirectionalNode<int> HashedNode;
+        typedef TestSetKeyPolicy<int>        TestPolicy;
+
+        enum { k_NUM_NODES = 40 };
+
+        Times7Hasher hasher;
+
+        HashedNode *nodes[k_NUM_NODES];
+        for (int i = 0; i < k_NUM_NODES; ++i) {
+            nodes[i] = static_cast<HashedNode *>(
+                                              oa.allocate(sizeof(HashedNode)));
+            nodes[i]->reset();
+            nodes[i]->value() = i;
+            nodes[i]->setHashCode(hasher(i));
+        }
+        for (int i = 0; i < k_NUM_NODES; ++i) {
+            nodes[i]->setPreviousLink(i > 0 ? nodes[i - 1] : 0);
+            nodes[i]->setNextLink(i + 1 < k_NUM_NODES ? nodes[i + 1] : 0);
+        }
+
+        for (int i = 0; i < k_NUM_NODES; ++i) {
+            ASSERTV(i, hasher(i) == Obj::extractHashCode<TestPolicy>(
+                                                                   nodes[i]));
+        }
+
+        const size_t NUM_BUCKETS[] = { 1, 2, 3, 7, 8, 13, 64 };
+        enum { NUM_NUM_BUCKETS = sizeof NUM_BUCKETS / sizeof *NUM_BUCKETS };
+
+        Link *root = nodes[0];
+
+        for (int ti = 0; ti < NUM_NUM_BUCKETS; ++ti) {
+            const size_t NB = NUM_BUCKETS[ti];
+
+            if (veryVerbose) { T_ P(NB) }
+
+            Bucket buckets[64];
+            memset(buckets, 0xa5, sizeof(buckets));  // garbage
+
+            Anchor anchor(buckets, NB, 0);    const Anchor& ANCHOR = anchor;
+
+            Obj::rehashUsingStoredHashCodes<TestPolicy>(&anchor, root);
+            root = anchor.listRootAddress();
+
+            ASSERTV(NB, k_NUM_NODES == (int) countElements(root));
+            ASSERTV(NB, (Obj::isWellFormed<TestPolicy>(ANCHOR,
+                                                       hasher,
+                                                       &oa)));
+
+            for (int i = 0; i < 2 * k_NUM_NODES; ++i) {
+                const bool EXPECTED = i < k_NUM_NODES;
+
+                Link *const EXP_LINK = EXPECTED ? nodes[i] : 0;
+                const int   EXP_CALLS = EXPECTED;
+
+                const size_t HASH_CODE = hasher(i);
+
+                int numCalls = 0;
+                Link *result = Obj::findUsingStoredHashCodes<TestPolicy>(
+                                                     ANCHOR,
+                                                     i,
+                                                     CountingEquals(&numCalls),
+                                                     HASH_CODE);
+                ASSERTV(NB, i, EXP_LINK  == result);
+                ASSERTV(NB, i, EXP_CALLS == numCalls);
+
+                const Bucket& BUCKET = buckets[Obj::computeBucketIndex(
+                                                                 HASH_CODE,
+                                                                 NB)];
+
+                numCalls = 0;
+                result = Obj::findInBucketUsingStoredHashCodes<TestPolicy>(
+                                                     BUCKET,
+                                                     i,
+                                                     CountingEquals(&numCalls),
+                                                     HASH_CODE);
+                ASSERTV(NB, i, EXP_LINK  == result);
+                ASSERTV(NB, i, EXP_CALLS == numCalls);
+            }
+        }
+
+        for (int i = 0; i < k_NUM_NODES; ++i) {
+            oa.deallocate(nodes[i]);
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // ATTEMPTED USAGE EXAMPLE
@@ -1333,6 +1500,17 @@ int main(int argc, char *argv[])
                                                                  i,
                                                                  Equals<int>(),
                                                                  i % 2)));
+
+            ASSERTV(i, links[i] == (Obj::findInBucket<TestPolicy>(
+                                                              buckets[i % 2],
+                                                              i,
+                                                              Equals<int>())));
+        }
+
+        for (int i = 2; i < ARRAY_LENGTH(buckets); ++i) {
+            ASSERTV(i, 0 == (Obj::findInBucket<TestPolicy>(buckets[i],
+                                                           i,
+                                                           Equals<int>())));
         }
 
         {
@@ -12,7 +12,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bslh::DefaultHashAlgorithm: a default hashing algorithm
 //
-//@SEE_ALSO: bslh_hash, bslh_defaultseededhashalgorithm
+//@SEE_ALSO: bslh_hash, bslh_defaultseededhashalgorithm,
+//           bslh_wyhashalgorithm
 //
 //@DESCRIPTION: 'bslh::DefaultHashAlgorithm' provides an unspecified default
 // hashing algorithm.  The supplied algorithm is suitable for general purpose
@@ -62,6 +63,22 @@ BSLS_IDENT("$Id: $")
 // write hashes from 'bslh::DefaultHashAlgorithm' to any memory accessible by
 // multiple machines.
 //
+///Selecting the Underlying Algorithm
+///----------------------------------
+// By default, 'bslh::DefaultHashAlgorithm' is implemented using
+// 'bslh::SpookyHashAlgorithm'.  If the macro
+// 'BSLH_DEFAULTHASHALGORITHM_USE_WYHASH' is defined, it is instead implemented
+// using 'bslh::WyHashAlgorithm', which is about twice as fast on the short
+// keys typical of hash tables, at the same (lack of) security guarantees.
+// Since 'bslh::Hash<>' uses 'bslh::DefaultHashAlgorithm' by default, this
+// macro selects the algorithm used by default throughout the hashing
+// infrastructure (e.g., by 'bsl::hash' and the unordered containers).
+//
+// The macro changes the layout of 'bslh::DefaultHashAlgorithm' and the hashes
+// it produces, so it must be defined consistently (typically on the compiler
+// command line) for every translation unit of a program, including those of
+// the libraries it links; otherwise the behavior is undefined.
+//
 ///Usage
 ///-----
 // This section illustrates intended usage of this component.
@@ -285,10 +302,20 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #endif
 
+#ifdef BSLH_DEFAULTHASHALGORITHM_USE_WYHASH
+
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#include <bslh_wyhashalgorithm.h>
+#endif
+
+#else
+
 #ifndef INCLUDED_BSLH_SPOOKYHASHALGORITHM
 #include <bslh_spookyhashalgorithm.h>
 #endif
 
+#endif
+
 namespace BloombergLP {
 
 namespace bslh {
@@ -300,7 +327,11 @@ class DefaultHashAlgorithm {
 
   private:
     // PRIVATE TYPES
+#ifdef BSLH_DEFAULTHASHALGORITHM_USE_WYHASH
+    typedef bslh::WyHashAlgorithm InternalHashAlgorithm;
+#else
     typedef bslh::SpookyHashAlgorithm InternalHashAlgorithm;
+#endif
         // Typedef indicating the algorithm currently being used by
         // 'bslh::DefualtHashAlgorithm' to compute hashes.  This algorithm is
         // subject to change.
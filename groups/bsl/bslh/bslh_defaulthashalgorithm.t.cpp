@@ -1,6 +1,9 @@
 // bslh_defaulthashalgorithm.t.cpp                                    -*-C++-*-
 #include <bslh_defaulthashalgorithm.h>
 
+#include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
+
 #include <bslmf_issame.h>
 
 #include <bsls_assert.h>
@@ -358,6 +361,13 @@ bool HashTable<TYPE, HASHER>::contains(const TYPE& value) const
 
 typedef DefaultHashAlgorithm Obj;
 
+#ifdef BSLH_DEFAULTHASHALGORITHM_USE_WYHASH
+typedef WyHashAlgorithm     CanonicalHashAlgorithm;
+#else
+typedef SpookyHashAlgorithm CanonicalHashAlgorithm;
+#endif
+    // The algorithm expected to underlie 'Obj' in this build configuration.
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -433,7 +443,9 @@ int main(int argc, char *argv[])
         //
         // Concerns:
         //: 1 The typedef 'result_type' is publicly accessible and an alias for
-        //:   'bslh::SpookyHashAlgorithm::result_type'.
+        //:   'bslh::SpookyHashAlgorithm::result_type' (or
+        //:   'bslh::WyHashAlgorithm::result_type' if
+        //:   'BSLH_DEFAULTHASHALGORITHM_USE_WYHASH' is defined).
         //:
         //: 2 'computeHash()' returns 'result_type'
         //
@@ -454,8 +466,9 @@ int main(int argc, char *argv[])
         if (verbose) printf("ASSERT the typedef is accessible and is the"
                             " correct type using 'bslmf::IsSame'. (C-1)\n");
         {
-            ASSERT((bslmf::IsSame<Obj::result_type,
-                                  SpookyHashAlgorithm::result_type>::VALUE));
+            ASSERT((bslmf::IsSame<
+                                 Obj::result_type,
+                                 CanonicalHashAlgorithm::result_type>::VALUE));
         }
 
         if (verbose) printf("Declare the expected signature of 'computeHash()'"
@@ -475,9 +488,10 @@ int main(int argc, char *argv[])
         //   operator that can be called with some bytes and a length.  Verify
         //   that calling 'operator()' will permute the algorithm's internal
         //   state as specified by the underlying hashing algorithm
-        //   (bslh::SpookyHashAlgorithm).  Verify that 'computeHash()' returns
-        //   the final value specified by the canonical implementation of the
-        //   underlying hashing algorithm.
+        //   ('bslh::SpookyHashAlgorithm', or 'bslh::WyHashAlgorithm' if
+        //   'BSLH_DEFAULTHASHALGORITHM_USE_WYHASH' is defined).  Verify that
+        //   'computeHash()' returns the final value specified by the canonical
+        //   implementation of the underlying hashing algorithm.
         //
         // Concerns:
         //: 1 The function call operator is callable.
@@ -546,9 +560,9 @@ int main(int argc, char *argv[])
                                         " 'bslh::DefaultHashAlgorithm' and"
                                         " 'bslh::SpookyHashAlgorithm'", VALUE);
 
-                Obj                 contiguousHash;
-                Obj                 dispirateHash;
-                SpookyHashAlgorithm cannonicalHashAlgorithm;
+                Obj                    contiguousHash;
+                Obj                    dispirateHash;
+                CanonicalHashAlgorithm cannonicalHashAlgorithm;
 
                 cannonicalHashAlgorithm(VALUE, strlen(VALUE));
                 contiguousHash(VALUE, strlen(VALUE));
@@ -559,7 +573,7 @@ int main(int argc, char *argv[])
                     dispirateHash(&VALUE[j], sizeof(char));
                 }
 
-                SpookyHashAlgorithm::result_type hash =
+                CanonicalHashAlgorithm::result_type hash =
                                          cannonicalHashAlgorithm.computeHash();
 
                 LOOP_ASSERT(LINE, hash == contiguousHash.computeHash());
@@ -1084,23 +1084,24 @@ int main(int argc, char *argv[])
             int                  d_line;
             const int            d_value;
             bsls::Types::Uint64  d_expectedHash;
+            bsls::Types::Uint64  d_expectedWyHash;
         } DATA[] = {
-        // LINE    DATA              HASH
-         {  L_,        1,  9778072230994240314ULL,},
-         {  L_,        3, 16874605512690156844ULL,},
-         {  L_,        9,  6609278684846086166ULL,},
-         {  L_,       27, 14610053422485613907ULL,},
-         {  L_,       81,  4473763709117720193ULL,},
-         {  L_,      243,  6469189993869193617ULL,},
-         {  L_,      729, 18245170745653607298ULL,},
-         {  L_,     2187,  4418771231001558887ULL,},
-         {  L_,     6561,  8361494415593539480ULL,},
-         {  L_,    19683,  8034516711244389554ULL,},
-         {  L_,    59049, 15257840606198213647ULL,},
-         {  L_,   177147,  9838846006369268307ULL,},
-         {  L_,   531441,  2891007685366740764ULL,},
-         {  L_,  1594323,  3005240762459740192ULL,},
-         {  L_,  4782969,  3383268391725748969ULL,},
+        // LINE    DATA              HASH                    WYHASH
+         {  L_,        1,  9778072230994240314ULL,  1489959078149032791ULL },
+         {  L_,        3, 16874605512690156844ULL, 10785815834190492667ULL },
+         {  L_,        9,  6609278684846086166ULL,  4545947166749760840ULL },
+         {  L_,       27, 14610053422485613907ULL, 16214440194457727407ULL },
+         {  L_,       81,  4473763709117720193ULL, 10856838873274793583ULL },
+         {  L_,      243,  6469189993869193617ULL,  7121698142467755658ULL },
+         {  L_,      729, 18245170745653607298ULL, 17860481109597868947ULL },
+         {  L_,     2187,  4418771231001558887ULL, 13741818234888842879ULL },
+         {  L_,     6561,  8361494415593539480ULL,  8460019142431240994ULL },
+         {  L_,    19683,  8034516711244389554ULL, 14796989208508862067ULL },
+         {  L_,    59049, 15257840606198213647ULL,   562489244959138016ULL },
+         {  L_,   177147,  9838846006369268307ULL,  7190805184287993316ULL },
+         {  L_,   531441,  2891007685366740764ULL,  2449802180982419993ULL },
+         {  L_,  1594323,  3005240762459740192ULL, 15572508454787908069ULL },
+         {  L_,  4782969,  3383268391725748969ULL, 10764191690996211860ULL },
         };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -1111,8 +1112,13 @@ int main(int argc, char *argv[])
             for (int i = 0; i != NUM_DATA; ++i) {
                 const int    LINE  = DATA[i].d_line;
                 const int    VALUE = DATA[i].d_value;
+#ifdef BSLH_DEFAULTHASHALGORITHM_USE_WYHASH
+                const size_t HASH  =
+                                 static_cast<size_t>(DATA[i].d_expectedWyHash);
+#else
                 const size_t HASH  =
                                    static_cast<size_t>(DATA[i].d_expectedHash);
+#endif
 
                 if (veryVerbose) printf("Hashing: %i, Expecting: " ZU "\n",
                                         VALUE,
@@ -0,0 +1,77 @@
+// bslh_wyhashalgorithm.cpp                                           -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslh_wyhashalgorithm_cpp,"$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// The reference implementation of wyhash consumes its input in 48-byte blocks
+// while *more* than 48 bytes remain, then in 16-byte chunks while more than 16
+// bytes remain, and finally reads the last 16 bytes of the input, which may
+// overlap bytes already consumed.  To produce the same hash incrementally,
+// 'operator()' processes a block only once it is known not to be the last 48
+// bytes of input, and retains the last 16 bytes of the last block processed in
+// front of the unprocessed bytes, so that 'computeHash' can read the last 16
+// bytes of the input from contiguous memory.
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bsls::Types::Uint64 Uint64;
+
+// The secret of the reference implementation.
+
+const Uint64 k_P1 = 0x8bb84b93962eacc9ULL;
+const Uint64 k_P2 = 0x4b33a62ed433d4a3ULL;
+const Uint64 k_P3 = 0x4d5a2da51de1aa47ULL;
+
+}  // close unnamed namespace
+
+namespace bslh {
+
+                           // ---------------------
+                           // class WyHashAlgorithm
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+void WyHashAlgorithm::processBlocks(const unsigned char *data,
+                                    size_t               numBlocks)
+{
+    BSLS_ASSERT_SAFE(data);
+
+    Uint64 seed = d_seed;
+    Uint64 see1 = d_see1;
+    Uint64 see2 = d_see2;
+
+    for (; numBlocks; --numBlocks, data += k_BLOCK_LENGTH) {
+        seed = mix(read64(data)      ^ k_P1, read64(data +  8) ^ seed);
+        see1 = mix(read64(data + 16) ^ k_P2, read64(data + 24) ^ see1);
+        see2 = mix(read64(data + 32) ^ k_P3, read64(data + 40) ^ see2);
+    }
+
+    d_seed = seed;
+    d_see1 = see1;
+    d_see2 = see2;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,540 @@
+// bslh_wyhashalgorithm.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#define INCLUDED_BSLH_WYHASHALGORITHM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the wyhash algorithm.
+//
+//@CLASSES:
+//  bslh::WyHashAlgorithm: functor implementing the wyhash algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_defaulthashalgorithm, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::WyHashAlgorithm' implements the wyhash algorithm (final
+// version 4) by Wang Yi.  This algorithm is a general purpose algorithm
+// designed for speed on short keys: a key of at most 16 bytes is hashed with
+// two 64-bit by 64-bit multiplications and a handful of loads, and longer keys
+// are consumed 48 bytes at a time by three independent multiply-and-fold
+// lanes.  For the 8-byte to 32-byte identifiers and short strings that make up
+// most keys of unordered associative containers, it is about twice as fast
+// as 'bslh::SpookyHashAlgorithm' and 'bslh::SipHashAlgorithm'.  For more
+// information, see: https://github.com/wangyi-fudan/wyhash
+//
+// This implementation accepts input incrementally: the same hash is produced
+// regardless of how a sequence of bytes is split across calls to
+// 'operator()', and that hash is equal to the hash computed by the reference
+// implementation ('wyhash(data, length, seed, _wyp)') for the concatenated
+// bytes.  Up to 64 bytes of input are buffered to achieve this.
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh' (internal users can also find
+// information here {TEAM BDE:USING MODULAR HASHING<GO>})
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+// There are *no* security guarantees made by 'bslh::WyHashAlgorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm, even if they do not know
+// the seed used to initialize it.  If security is required, an algorithm that
+// documents better secure properties should be used, such as
+// 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  Its speed relies on a fast 64-bit by 64-bit
+// multiplication yielding a 128-bit product, which is available on all 64-bit
+// platforms supported by BDE; on other platforms the product is computed with
+// four 32-bit multiplications, and the algorithm is correspondingly slower.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.  The reference implementation passes the SMHasher test suite.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm is endian-independent.  The hashes produced for a given
+// 8-byte seed and given sequence of bytes will be the same on big-endian and
+// little-endian platforms.  However, if the bytes are the object
+// representation of a value having internal structure (e.g., an integral or
+// floating-point value), they are likely ordered in different ways depending
+// on the platform, and thus will not hash to the same value.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Hashing Small Keys
+///- - - - - - - - - - - - - - -
+// Suppose that we maintain a cache of security descriptions, keyed by a
+// 64-bit security identifier and the 4-character code of the exchange on
+// which the security trades, and that lookups in this cache dominate the
+// processing time of our application.  Since the keys are small and not
+// supplied by untrusted parties, 'bslh::WyHashAlgorithm' is a good choice for
+// hashing them.
+//
+// First, we define the key type:
+//..
+//  struct SecurityKey {
+//      // This 'struct' identifies a security traded on an exchange.
+//
+//      bsls::Types::Uint64 d_id;            // security identifier
+//      char                d_exchange[4];   // exchange code
+//  };
+//..
+// Then, we define a hash functor for our keys that supplies the salient
+// attributes of the key to the algorithm, one attribute at a time:
+//..
+//  struct SecurityKeyHash {
+//      // This 'struct' is a functor hashing 'SecurityKey' objects using
+//      // 'bslh::WyHashAlgorithm'.
+//
+//      bsls::Types::Uint64 operator()(const SecurityKey& key) const
+//          // Return the hash of the specified 'key'.
+//      {
+//          bslh::WyHashAlgorithm hash;
+//          hash(&key.d_id,       sizeof key.d_id);
+//          hash(key.d_exchange,  sizeof key.d_exchange);
+//          return hash.computeHash();
+//      }
+//  };
+//..
+// Next, we hash two keys that differ only in their exchange:
+//..
+//  const SecurityKey keyA = { 123456789, { 'X', 'N', 'Y', 'S' } };
+//  const SecurityKey keyB = { 123456789, { 'X', 'L', 'O', 'N' } };
+//
+//  SecurityKeyHash hasher;
+//  assert(hasher(keyA) != hasher(keyB));
+//..
+// Finally, we verify that supplying the same bytes in a single call produces
+// the same hash, so that the hash does not depend on how the attributes of a
+// key are supplied to the algorithm:
+//..
+//  char bytes[sizeof keyA.d_id + sizeof keyA.d_exchange];
+//  memcpy(bytes, &keyA.d_id, sizeof keyA.d_id);
+//  memcpy(bytes + sizeof keyA.d_id, keyA.d_exchange, sizeof keyA.d_exchange);
+//
+//  bslh::WyHashAlgorithm hash;
+//  hash(bytes, sizeof bytes);
+//  assert(hasher(keyA) == hash.computeHash());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BYTEORDER
+#include <bsls_byteorder.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_STDDEF_H
+#include <stddef.h>  // for 'size_t'
+#define INCLUDED_STDDEF_H
+#endif
+
+#ifndef INCLUDED_STRING_H
+#include <string.h>  // for 'memcpy'
+#define INCLUDED_STRING_H
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_64_BIT)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BSLH_WYHASHALGORITHM_NATIVE_UINT128 1
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+#define BSLH_WYHASHALGORITHM_UMUL128 1
+#ifndef INCLUDED_INTRIN_H
+#include <intrin.h>  // for '_umul128'
+#define INCLUDED_INTRIN_H
+#endif
+#endif
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                           // =====================
+                           // class WyHashAlgorithm
+                           // =====================
+
+class WyHashAlgorithm {
+    // This class wraps an implementation of the "wyhash" algorithm in an
+    // interface that is usable in the modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    enum {
+        k_BLOCK_LENGTH = 48,  // number of bytes consumed by each iteration of
+                              // the main loop of the algorithm
+
+        k_TAIL_LENGTH  = 16   // number of bytes preceding the unprocessed
+                              // input that are retained in the buffer
+    };
+
+    // DATA
+    Uint64        d_seed;        // mixed seed, and accumulator of the first
+                                 // lane
+
+    Uint64        d_see1;        // accumulator of the second lane
+
+    Uint64        d_see2;        // accumulator of the third lane
+
+    Uint64        d_totalLength; // number of bytes passed to 'operator()'
+
+    size_t        d_numPending;  // number of unprocessed bytes in 'd_buffer'
+
+    union {
+        Uint64        d_alignment;
+            // Provides alignment
+
+        unsigned char d_buffer[k_TAIL_LENGTH + k_BLOCK_LENGTH];
+            // The last 'k_TAIL_LENGTH' bytes of the last block processed,
+            // followed by 'd_numPending' unprocessed bytes.
+    };
+
+    // NOT IMPLEMENTED
+    WyHashAlgorithm(const WyHashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    WyHashAlgorithm& operator=(const WyHashAlgorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE CLASS METHODS
+    static Uint64 mix(Uint64 a, Uint64 b);
+        // Return the exclusive-or of the high and low halves of the 128-bit
+        // product of the specified 'a' and 'b'.
+
+    static void multiply(Uint64 *a, Uint64 *b);
+        // Load into the specified 'a' and 'b' respectively the low and high
+        // halves of the 128-bit product of '*a' and '*b'.
+
+    static Uint64 read32(const unsigned char *data);
+        // Return the value of the 4 bytes at the specified 'data', read in
+        // little-endian order.
+
+    static Uint64 read64(const unsigned char *data);
+        // Return the value of the 8 bytes at the specified 'data', read in
+        // little-endian order.
+
+    // PRIVATE MANIPULATORS
+    void init(Uint64 seed);
+        // Initialize the state of this object for the specified 'seed'.
+
+    void processBlocks(const unsigned char *data, size_t numBlocks);
+        // Incorporate the specified 'numBlocks' blocks of 'k_BLOCK_LENGTH'
+        // bytes at the specified 'data' into the state of the lanes of this
+        // object.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+    // CREATORS
+    WyHashAlgorithm();
+        // Create a 'bslh::WyHashAlgorithm' using a default initial seed (0).
+
+    explicit WyHashAlgorithm(const char *seed);
+        // Create a 'bslh::WyHashAlgorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed',
+        // read in little-endian order.  Each bit of the supplied seed will
+        // contribute to the final hash produced by 'computeHash()'.  The
+        // behavior is undefined unless 'seed' points to at least 8 bytes of
+        // initialized memory.
+
+    //! ~WyHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash will be produced regardless of whether a sequence of bytes
+        // is passed in all at once or through multiple calls to this member
+        // function.  Input where 'numBytes' is 0 will have no effect on the
+        // internal state of the algorithm.  The behaviour is undefined unless
+        // 'data' points to a valid memory location with at least 'numBytes'
+        // bytes of initialized memory.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that, unlike some other algorithms, this does not change the
+        // internal state of the object, but calling 'computeHash()' more than
+        // once is not supported by all 'bslh' algorithms.  Also note that a
+        // value will be returned, even if data has not been passed into
+        // 'operator()'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class WyHashAlgorithm
+                           // ---------------------
+
+// PRIVATE CLASS METHODS
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::mix(Uint64 a, Uint64 b)
+{
+    multiply(&a, &b);
+    return a ^ b;
+}
+
+inline
+void WyHashAlgorithm::multiply(Uint64 *a, Uint64 *b)
+{
+    BSLS_ASSERT_SAFE(a);
+    BSLS_ASSERT_SAFE(b);
+
+#if defined(BSLH_WYHASHALGORITHM_NATIVE_UINT128)
+    __extension__ typedef unsigned __int128 Uint128;
+
+    const Uint128 product = static_cast<Uint128>(*a) * *b;
+
+    *a = static_cast<Uint64>(product);
+    *b = static_cast<Uint64>(product >> 64);
+#elif defined(BSLH_WYHASHALGORITHM_UMUL128)
+    *a = _umul128(*a, *b, b);
+#else
+    const Uint64 ha = *a >> 32;
+    const Uint64 hb = *b >> 32;
+    const Uint64 la = static_cast<unsigned int>(*a);
+    const Uint64 lb = static_cast<unsigned int>(*b);
+
+    const Uint64 rh  = ha * hb;
+    const Uint64 rm0 = ha * lb;
+    const Uint64 rm1 = hb * la;
+    const Uint64 rl  = la * lb;
+    const Uint64 t   = rl + (rm0 << 32);
+    Uint64       c   = t < rl;
+    const Uint64 lo  = t + (rm1 << 32);
+
+    c += lo < t;
+
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::read32(const unsigned char *data)
+{
+    unsigned int value;
+    memcpy(&value, data, sizeof value);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(value);
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::read64(const unsigned char *data)
+{
+    Uint64 value;
+    memcpy(&value, data, sizeof value);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(value);
+}
+
+// PRIVATE MANIPULATORS
+inline
+void WyHashAlgorithm::init(Uint64 seed)
+{
+    // The first two words of the secret of the reference implementation.
+
+    static const Uint64 k_P0 = 0x2d358dccaa6c78a5ULL;
+    static const Uint64 k_P1 = 0x8bb84b93962eacc9ULL;
+
+    d_seed        = seed ^ mix(seed ^ k_P0, k_P1);
+    d_see1        = d_seed;
+    d_see2        = d_seed;
+    d_totalLength = 0;
+    d_numPending  = 0;
+}
+
+// CREATORS
+inline
+WyHashAlgorithm::WyHashAlgorithm()
+{
+    init(0);
+}
+
+inline
+WyHashAlgorithm::WyHashAlgorithm(const char *seed)
+{
+    BSLS_ASSERT(seed);
+
+    init(read64(reinterpret_cast<const unsigned char *>(seed)));
+}
+
+// MANIPULATORS
+inline
+void WyHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(data);
+
+    const unsigned char *input = static_cast<const unsigned char *>(data);
+
+    d_totalLength += numBytes;
+
+    if (d_numPending + numBytes <= k_BLOCK_LENGTH) {
+        // Note that, as in the reference implementation, a block is processed
+        // only once it is known *not* to be the last block of input.
+
+        memcpy(d_buffer + k_TAIL_LENGTH + d_numPending, input, numBytes);
+        d_numPending += numBytes;
+        return;                                                       // RETURN
+    }
+
+    const size_t numFill = k_BLOCK_LENGTH - d_numPending;
+
+    memcpy(d_buffer + k_TAIL_LENGTH + d_numPending, input, numFill);
+    processBlocks(d_buffer + k_TAIL_LENGTH, 1);
+
+    input    += numFill;
+    numBytes -= numFill;
+
+    const unsigned char *lastBlockEnd = d_buffer + k_TAIL_LENGTH
+                                                 + k_BLOCK_LENGTH;
+
+    if (numBytes > k_BLOCK_LENGTH) {
+        const size_t numBlocks = (numBytes - 1) / k_BLOCK_LENGTH;
+
+        processBlocks(input, numBlocks);
+
+        input        += numBlocks * k_BLOCK_LENGTH;
+        numBytes     -= numBlocks * k_BLOCK_LENGTH;
+        lastBlockEnd  = input;
+    }
+
+    memcpy(d_buffer, lastBlockEnd - k_TAIL_LENGTH, k_TAIL_LENGTH);
+    memcpy(d_buffer + k_TAIL_LENGTH, input, numBytes);
+    d_numPending = numBytes;
+}
+
+inline
+WyHashAlgorithm::result_type WyHashAlgorithm::computeHash()
+{
+    // The first two words of the secret of the reference implementation.
+
+    static const Uint64 k_P0 = 0x2d358dccaa6c78a5ULL;
+    static const Uint64 k_P1 = 0x8bb84b93962eacc9ULL;
+
+    const unsigned char *p      = d_buffer + k_TAIL_LENGTH;
+    Uint64               seed   = d_seed;
+    Uint64               a;
+    Uint64               b;
+
+    if (d_totalLength <= 16) {
+        const size_t length = d_numPending;
+
+        if (length >= 4) {
+            const size_t shift = (length >> 3) << 2;
+
+            a = (read32(p) << 32) | read32(p + shift);
+            b = (read32(p + length - 4) << 32)
+              | read32(p + length - 4 - shift);
+        }
+        else if (length > 0) {
+            a = (static_cast<Uint64>(p[0])              << 16)
+              | (static_cast<Uint64>(p[length >> 1])    <<  8)
+              |  static_cast<Uint64>(p[length - 1]);
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        size_t remaining = d_numPending;
+
+        if (d_totalLength > k_BLOCK_LENGTH) {
+            seed ^= d_see1 ^ d_see2;
+        }
+
+        while (remaining > 16) {
+            seed = mix(read64(p) ^ k_P1, read64(p + 8) ^ seed);
+            p         += 16;
+            remaining -= 16;
+        }
+
+        // Note that the last 16 bytes of input may extend into the tail of
+        // the last block processed, which is retained at the beginning of
+        // 'd_buffer'.
+
+        a = read64(p + remaining - 16);
+        b = read64(p + remaining - 8);
+    }
+
+    a ^= k_P1;
+    b ^= seed;
+    multiply(&a, &b);
+
+    return mix(a ^ k_P0 ^ d_totalLength, b ^ k_P1);
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::WyHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1106 @@
+// bslh_wyhashalgorithm.t.cpp                                         -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslh_siphashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by the reference implementation of the hashing algorithm,
+// and to verify that the output does not depend on how the input is split
+// across calls to the function call operator.  The component will also be
+// tested for conformance to the requirements on 'bslh' hashing algorithms,
+// outlined in the 'bslh' package level documentation, and for the quality of
+// the distribution of its output.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 5] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 6] enum { k_SEED_LENGTH = 8 };
+//
+// CREATORS
+// [ 2] WyHashAlgorithm();
+// [ 2] explicit WyHashAlgorithm(const char *seed);
+// [ 2] ~WyHashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] INCREMENTAL HASHING
+// [ 7] Trait IsBitwiseMoveable
+// [ 8] HASH QUALITY
+// [ 9] USAGE EXAMPLE
+// [-1] EXAMINE HASH VALUES
+// [-2] SMALL-KEY THROUGHPUT BENCHMARK
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                   GLOBAL TYPEDEFS AND DATA FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef WyHashAlgorithm     Obj;
+typedef bsls::Types::Uint64 Uint64;
+
+const char genericSeed[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+const char testSeed[8] = {
+    // Little-endian representation of 0x0123456789abcdef.
+
+    '\xef', '\xcd', '\xab', '\x89', '\x67', '\x45', '\x23', '\x01'
+};
+
+enum { k_PATTERN_LENGTH = 1000 };
+
+unsigned char testPattern[k_PATTERN_LENGTH];
+    // Filled by 'initPattern' with the bytes hashed by the reference
+    // implementation to produce the expected values of case 3.
+
+void initPattern()
+    // Load into 'testPattern' the bytes 'i * 7 + 3' (modulo 256).
+{
+    for (int i = 0; i < k_PATTERN_LENGTH; ++i) {
+        testPattern[i] = static_cast<unsigned char>(i * 7 + 3);
+    }
+}
+
+void loadSeed(char *seed, Uint64 value)
+    // Load into the specified 'seed' the little-endian representation of the
+    // specified 'value'.
+{
+    for (int i = 0; i < 8; ++i) {
+        seed[i] = static_cast<char>(value >> (8 * i));
+    }
+}
+
+int popCount(Uint64 value)
+    // Return the number of bits set in the specified 'value'.
+{
+    int count = 0;
+    for (; value; value &= value - 1) {
+        ++count;
+    }
+    return count;
+}
+
+Uint64 nextRandom(Uint64 *state)
+    // Return the next value of the pseudo-random sequence having the
+    // specified 'state' (SplitMix64), and update 'state'.
+{
+    Uint64 z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+extern "C"
+int compareUint64(const void *lhs, const void *rhs)
+    // Return a negative value, 0, or a positive value if the 'Uint64' at the
+    // specified 'lhs' is less than, equal to, or greater than the 'Uint64' at
+    // the specified 'rhs', respectively.
+{
+    const Uint64 a = *static_cast<const Uint64 *>(lhs);
+    const Uint64 b = *static_cast<const Uint64 *>(rhs);
+    return a < b ? -1 : b < a ? 1 : 0;
+}
+
+template <class HASH_ALGORITHM>
+double timeSmallKeys(Uint64 *result, size_t keyLength, int numIterations)
+    // Hash 'numIterations' distinct keys of the specified 'keyLength' bytes
+    // (at most 64) using a default-seeded 'HASH_ALGORITHM', load into the
+    // specified 'result' a combination of the hashes, and return the elapsed
+    // time in seconds.
+{
+    const char seed[16] = { 0 };
+
+    unsigned char key[64] = { 0 };
+    Uint64        sum     = 0;
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    for (int i = 0; i < numIterations; ++i) {
+        memcpy(key, &i, sizeof i);
+
+        HASH_ALGORITHM hashAlg(seed);
+        hashAlg(key, keyLength);
+        sum += hashAlg.computeHash();
+    }
+
+    timer.stop();
+
+    *result = sum;
+    return timer.elapsedTime();
+}
+
+//=============================================================================
+//                             USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Hashing Small Keys
+///- - - - - - - - - - - - - - -
+// Suppose that we maintain a cache of security descriptions, keyed by a
+// 64-bit security identifier and the 4-character code of the exchange on
+// which the security trades, and that lookups in this cache dominate the
+// processing time of our application.  Since the keys are small and not
+// supplied by untrusted parties, 'bslh::WyHashAlgorithm' is a good choice for
+// hashing them.
+//
+// First, we define the key type:
+//..
+    struct SecurityKey {
+        // This 'struct' identifies a security traded on an exchange.
+
+        bsls::Types::Uint64 d_id;            // security identifier
+        char                d_exchange[4];   // exchange code
+    };
+//..
+// Then, we define a hash functor for our keys that supplies the salient
+// attributes of the key to the algorithm, one attribute at a time:
+//..
+    struct SecurityKeyHash {
+        // This 'struct' is a functor hashing 'SecurityKey' objects using
+        // 'bslh::WyHashAlgorithm'.
+
+        bsls::Types::Uint64 operator()(const SecurityKey& key) const
+            // Return the hash of the specified 'key'.
+        {
+            bslh::WyHashAlgorithm hash;
+            hash(&key.d_id,       sizeof key.d_id);
+            hash(key.d_exchange,  sizeof key.d_exchange);
+            return hash.computeHash();
+        }
+    };
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;      // suppress warning
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    initPattern();
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The hashing algorithm can be used to create more powerful
+        //   components such as functors that can be used to power hash tables.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+// Next, we hash two keys that differ only in their exchange:
+//..
+        const SecurityKey keyA = { 123456789, { 'X', 'N', 'Y', 'S' } };
+        const SecurityKey keyB = { 123456789, { 'X', 'L', 'O', 'N' } };
+
+        SecurityKeyHash hasher;
+        ASSERT(hasher(keyA) != hasher(keyB));
+//..
+// Finally, we verify that supplying the same bytes in a single call produces
+// the same hash, so that the hash does not depend on how the attributes of a
+// key are supplied to the algorithm:
+//..
+        char bytes[sizeof keyA.d_id + sizeof keyA.d_exchange];
+        memcpy(bytes, &keyA.d_id, sizeof keyA.d_id);
+        memcpy(bytes + sizeof keyA.d_id,
+               keyA.d_exchange,
+               sizeof keyA.d_exchange);
+
+        bslh::WyHashAlgorithm hash;
+        hash(bytes, sizeof bytes);
+        ASSERT(hasher(keyA) == hash.computeHash());
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // HASH QUALITY
+        //   The hashes produced by the algorithm should be well distributed,
+        //   and should avalanche.
+        //
+        // Concerns:
+        //: 1 Flipping any single bit of the input, for keys of any length,
+        //:   flips each bit of the output with a probability close to 50%.
+        //:
+        //: 2 Flipping any single bit of the seed flips each bit of the output
+        //:   with a probability close to 50%.
+        //:
+        //: 3 Small, sequential integer keys do not collide, and their hashes
+        //:   are evenly distributed into the buckets of a power-of-two sized
+        //:   hash table.
+        //
+        // Plan:
+        //: 1 For keys of various lengths, spanning the boundaries of the
+        //:   paths of the algorithm, hash random keys and the keys obtained by
+        //:   flipping each of their bits, and verify that the average
+        //:   fraction of output bits that change is within 2% of 50%, and
+        //:   that no output bit changes with a probability outside of
+        //:   [35%, 65%].  (C-1)
+        //:
+        //: 2 Repeat P-1 for single-bit changes to the seed.  (C-2)
+        //:
+        //: 3 Hash 2^16 consecutive 8-byte integers, sort the hashes, and
+        //:   verify there are no duplicates.  Distribute the hashes into 2^10
+        //:   buckets using their low bits and verify that no bucket is
+        //:   unreasonably full.  (C-3)
+        //
+        // Testing:
+        //   HASH QUALITY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHASH QUALITY"
+                            "\n============\n");
+
+        enum { k_NUM_SAMPLES = 64 };
+
+        if (verbose) printf("Verify input bits avalanche.  (C-1)\n");
+        {
+            static const size_t LENGTHS[] = {
+                1, 3, 4, 7, 8, 12, 16, 17, 24, 32, 48, 49, 64, 100
+            };
+            enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+            Uint64 state = 1;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const size_t LENGTH = LENGTHS[ti];
+
+                int    bitFlips[64] = { 0 };
+                Uint64 totalFlips   = 0;
+                Uint64 numTrials    = 0;
+
+                for (int si = 0; si < k_NUM_SAMPLES; ++si) {
+                    unsigned char key[100];
+                    for (size_t i = 0; i < LENGTH; ++i) {
+                        key[i] = static_cast<unsigned char>(
+                                                       nextRandom(&state));
+                    }
+
+                    Obj base(testSeed);
+                    base(key, LENGTH);
+                    const Uint64 baseHash = base.computeHash();
+
+                    for (size_t bit = 0; bit < LENGTH * 8; ++bit) {
+                        key[bit / 8] ^= static_cast<unsigned char>(
+                                                             1 << (bit % 8));
+
+                        Obj mutant(testSeed);
+                        mutant(key, LENGTH);
+                        const Uint64 diff = baseHash ^ mutant.computeHash();
+
+                        key[bit / 8] ^= static_cast<unsigned char>(
+                                                             1 << (bit % 8));
+
+                        totalFlips += popCount(diff);
+                        ++numTrials;
+                        for (int ob = 0; ob < 64; ++ob) {
+                            bitFlips[ob] += static_cast<int>((diff >> ob) & 1);
+                        }
+                    }
+                }
+
+                const double average = static_cast<double>(totalFlips)
+                                     / static_cast<double>(numTrials * 64);
+
+                if (veryVerbose) { P_(LENGTH) P(average) }
+
+                LOOP2_ASSERT(LENGTH, average, 0.48 < average);
+                LOOP2_ASSERT(LENGTH, average, 0.52 > average);
+
+                for (int ob = 0; ob < 64; ++ob) {
+                    const double p = static_cast<double>(bitFlips[ob])
+                                   / static_cast<double>(numTrials);
+
+                    LOOP3_ASSERT(LENGTH, ob, p, 0.35 < p && p < 0.65);
+                }
+            }
+        }
+
+        if (verbose) printf("Verify seed bits avalanche.  (C-2)\n");
+        {
+            static const size_t LENGTHS[] = { 0, 5, 8, 16, 40, 100 };
+            enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+            Uint64 state = 2;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const size_t LENGTH = LENGTHS[ti];
+
+                Uint64 totalFlips = 0;
+                Uint64 numTrials  = 0;
+
+                for (int si = 0; si < k_NUM_SAMPLES; ++si) {
+                    const Uint64 seedValue = nextRandom(&state);
+
+                    char seed[8];
+                    loadSeed(seed, seedValue);
+
+                    Obj base(seed);
+                    base(testPattern, LENGTH);
+                    const Uint64 baseHash = base.computeHash();
+
+                    for (int bit = 0; bit < 64; ++bit) {
+                        loadSeed(seed, seedValue ^ (1ULL << bit));
+
+                        Obj mutant(seed);
+                        mutant(testPattern, LENGTH);
+
+                        totalFlips += popCount(baseHash
+                                                     ^ mutant.computeHash());
+                        ++numTrials;
+                    }
+                }
+
+                const double average = static_cast<double>(totalFlips)
+                                     / static_cast<double>(numTrials * 64);
+
+                if (veryVerbose) { P_(LENGTH) P(average) }
+
+                LOOP2_ASSERT(LENGTH, average, 0.48 < average);
+                LOOP2_ASSERT(LENGTH, average, 0.52 > average);
+            }
+        }
+
+        if (verbose) printf("Verify distribution of integer keys.  (C-3)\n");
+        {
+            enum { k_NUM_KEYS = 1 << 16, k_NUM_BUCKETS = 1 << 10 };
+
+            static Uint64 hashes[k_NUM_KEYS];
+            static int    buckets[k_NUM_BUCKETS];
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                const Uint64 key = i;
+
+                Obj hashAlg;
+                hashAlg(&key, sizeof key);
+                hashes[i] = hashAlg.computeHash();
+
+                ++buckets[hashes[i] & (k_NUM_BUCKETS - 1)];
+            }
+
+            qsort(hashes, k_NUM_KEYS, sizeof *hashes, &compareUint64);
+
+            for (int i = 1; i < k_NUM_KEYS; ++i) {
+                LOOP_ASSERT(i, hashes[i - 1] != hashes[i]);
+            }
+
+            // The expected load is 64 per bucket, with a standard deviation
+            // of 8.
+
+            int maxLoad = 0;
+            for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+                maxLoad = maxLoad < buckets[i] ? buckets[i] : maxLoad;
+            }
+
+            if (veryVerbose) { P(maxLoad) }
+
+            ASSERTV(maxLoad, maxLoad < 64 + 6 * 8);
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the
+        //:   'bslmf::IsBitwiseMoveable' metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        if (verbose) printf("ASSERT the presence of the trait using the"
+                            " 'bslmf::IsBitwiseMoveable' metafunction."
+                            " (C-1)\n");
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_SEED_LENGTH'
+        //   The class is a seeded algorithm and should expose a
+        //   'k_SEED_LENGTH' enum.
+        //
+        // Concerns:
+        //: 1 'k_SEED_LENGTH' is publicly accessible.
+        //:
+        //: 2 'k_SEED_LENGTH' is set to 8.
+        //
+        // Plan:
+        //: 1 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value. (C-1,2)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 8 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'k_SEED_LENGTH'"
+                            "\n=======================\n");
+
+        if (verbose) printf("Access 'k_SEED_LENGTH' and ASSERT it is equal to"
+                            " the expected value. (C-1,2)\n");
+        {
+            ASSERT(8 == WyHashAlgorithm::k_SEED_LENGTH);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all 'bslh' hashing algorithms
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then assign
+        //:   to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        if (verbose) printf("ASSERT the typedef is accessible and is the"
+                            " correct type using 'bslmf::IsSame'. (C-1)\n");
+        {
+            ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                                  WyHashAlgorithm::result_type>::VALUE));
+        }
+
+        if (verbose) printf("Declare the expected signature of 'computeHash()'"
+                            " and then assign to it.  If it compiles, the test"
+                            " passes. (C-2)\n");
+        {
+            Obj::result_type (Obj::*expectedSignature) ();
+
+            (void)(expectedSignature = &Obj::computeHash);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INCREMENTAL HASHING
+        //   The hash of a sequence of bytes must not depend on how the
+        //   sequence is split across calls to 'operator()'.
+        //
+        // Concerns:
+        //: 1 Splitting the input into two parts at any position yields the
+        //:   same hash as passing the input in a single call, in particular
+        //:   when either part ends on, or straddles, the internal block and
+        //:   buffer boundaries.
+        //:
+        //: 2 Passing the input one byte at a time, or in chunks of any fixed
+        //:   size, yields the same hash as passing it in a single call.
+        //:
+        //: 3 Calls to 'operator()' with 0 bytes have no effect.
+        //
+        // Plan:
+        //: 1 For every length from 0 to 200 bytes, and every split position,
+        //:   hash the two parts of 'testPattern' in two calls, and compare
+        //:   against a single call.  (C-1)
+        //:
+        //: 2 For every length from 0 to 300 bytes, and every chunk size from
+        //:   1 to 100 bytes, hash 'testPattern' in consecutive chunks, with
+        //:   an empty call between chunks, and compare against a single call.
+        //:   (C-2,3)
+        //
+        // Testing:
+        //   INCREMENTAL HASHING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINCREMENTAL HASHING"
+                            "\n===================\n");
+
+        if (verbose) printf("Split the input at every position.  (C-1)\n");
+        {
+            for (size_t length = 0; length <= 200; ++length) {
+                Obj whole(testSeed);
+                whole(testPattern, length);
+                const Uint64 EXP = whole.computeHash();
+
+                for (size_t split = 0; split <= length; ++split) {
+                    Obj mX(testSeed);
+                    mX(testPattern, split);
+                    mX(testPattern + split, length - split);
+
+                    LOOP2_ASSERT(length, split, EXP == mX.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Pass the input in fixed-size chunks.  (C-2,3)\n");
+        {
+            for (size_t length = 0; length <= 300; ++length) {
+                Obj whole(testSeed);
+                whole(testPattern, length);
+                const Uint64 EXP = whole.computeHash();
+
+                for (size_t chunk = 1; chunk <= 100; ++chunk) {
+                    Obj mX(testSeed);
+
+                    for (size_t offset = 0; offset < length; offset += chunk) {
+                        const size_t n = length - offset < chunk
+                                       ? length - offset
+                                       : chunk;
+
+                        mX(testPattern + offset, n);
+                        mX(testPattern, 0);
+                    }
+
+                    LOOP2_ASSERT(length, chunk, EXP == mX.computeHash());
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify the class provides an overload for the function call
+        //   operator that can be called with some bytes and a length, and that
+        //   'computeHash()' returns the hash specified by the reference
+        //   implementation of wyhash (final version 4).
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 The output of 'computeHash()' is equal to the output of the
+        //:   reference implementation for the same input and seed, for inputs
+        //:   of every length handled by a distinct path of the algorithm.
+        //:
+        //: 3 'operator()' does not modify the bytes it is passed.
+        //:
+        //: 4 'operator()' asserts on null data.
+        //
+        // Plan:
+        //: 1 Hash the published test strings of the reference implementation
+        //:   with their seeds, and compare against the published values.
+        //:   (C-1,2)
+        //:
+        //: 2 Hash prefixes of various lengths of 'testPattern' and compare
+        //:   against values computed with the reference implementation.
+        //:   Verify 'testPattern' is unchanged.  (C-1..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator()' AND 'computeHash()'"
+                            "\n========================================\n");
+
+        if (verbose) printf("Compare against the published test vectors."
+                            " (C-1,2)\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_data;
+                Uint64      d_seed;
+                Uint64      d_hash;
+            } DATA[] = {
+                // LINE DATA                                SEED  HASH
+                // ---- ----------------------------------- ----  ----
+                { L_,   "",                                 0,
+                                                     0x93228a4de0eec5a2ULL },
+                { L_,   "a",                                1,
+                                                     0xc5bac3db178713c4ULL },
+                { L_,   "abc",                              2,
+                                                     0xa97f2f7b1d9b3314ULL },
+                { L_,   "message digest",                   3,
+                                                     0x786d1f1df3801df4ULL },
+                { L_,   "abcdefghijklmnopqrstuvwxyz",       4,
+                                                     0xdca5a8138ad37c87ULL },
+                { L_,   "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                        "abcdefghijklmnopqrstuvwxyz"
+                        "0123456789",                       5,
+                                                     0xb9e734f117cfaf70ULL },
+                { L_,   "1234567890123456789012345678901234567890"
+                        "1234567890123456789012345678901234567890",
+                                                            6,
+                                                     0x6cc5eab49a92d617ULL },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int     LINE = DATA[ti].d_line;
+                const char   *DATA_P = DATA[ti].d_data;
+                const Uint64  EXP  = DATA[ti].d_hash;
+
+                char seed[8];
+                loadSeed(seed, DATA[ti].d_seed);
+
+                Obj mX(seed);
+                mX(DATA_P, strlen(DATA_P));
+
+                LOOP_ASSERT(LINE, EXP == mX.computeHash());
+            }
+        }
+
+        if (verbose) printf("Compare against the reference implementation."
+                            " (C-1..3)\n");
+        {
+            static const struct {
+                int    d_line;
+                size_t d_length;
+                Uint64 d_hash;
+            } DATA[] = {
+                // LINE LENGTH HASH
+                // ---- ------ ---------------------
+                { L_,      0, 0x16d3b0a07d2cea83ULL },
+                { L_,      1, 0x65275b779288e010ULL },
+                { L_,      2, 0xc116492ab50ffe33ULL },
+                { L_,      3, 0x2c04afd6958cce3fULL },
+                { L_,      4, 0x684be46dec087474ULL },
+                { L_,      7, 0x5551290db8b36a9fULL },
+                { L_,      8, 0x11ddff7d19858aeaULL },
+                { L_,     15, 0xe1c8f1d76b50553cULL },
+                { L_,     16, 0x5acc90c733d2aa9dULL },
+                { L_,     17, 0x4a6ed437c4dd58c7ULL },
+                { L_,     31, 0x5a7c8c0fcd9f39c5ULL },
+                { L_,     32, 0xd83dd4159d0d22edULL },
+                { L_,     33, 0x71b7e412fca613eeULL },
+                { L_,     47, 0xb46d367361c32571ULL },
+                { L_,     48, 0xe0b4358c2c549901ULL },
+                { L_,     49, 0x3140dbc228bd254eULL },
+                { L_,     63, 0xf3bbdd99791ca30eULL },
+                { L_,     64, 0x38b976c4f1fe2940ULL },
+                { L_,     65, 0x5789555c42a4e703ULL },
+                { L_,     95, 0xafed2c14b062b817ULL },
+                { L_,     96, 0xa6d98fad35cb3cf0ULL },
+                { L_,     97, 0xbeca6cbd2f676873ULL },
+                { L_,    127, 0xb31fb7765e099b5fULL },
+                { L_,    128, 0x1d2048ce1fe1d883ULL },
+                { L_,    129, 0x41c6077c4e0a4f25ULL },
+                { L_,    200, 0xe72af85f74bee066ULL },
+                { L_,   1000, 0xe8a0e41d14865d9fULL },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE   = DATA[ti].d_line;
+                const size_t LENGTH = DATA[ti].d_length;
+                const Uint64 EXP    = DATA[ti].d_hash;
+
+                Obj mX(testSeed);
+                mX(testPattern, LENGTH);
+
+                const Uint64 hash = mX.computeHash();
+
+                if (veryVerbose) { P_(LINE) P_(LENGTH) P(hash) }
+
+                LOOP2_ASSERT(LINE, LENGTH, EXP == hash);
+            }
+
+            for (int i = 0; i < k_PATTERN_LENGTH; ++i) {
+                LOOP_ASSERT(i, static_cast<unsigned char>(i * 7 + 3)
+                                                         == testPattern[i]);
+            }
+        }
+
+        if (verbose) printf("Negative Testing. (C-4)\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj hash;
+
+            ASSERT_FAIL(hash(0, 0));
+            ASSERT_PASS(hash(testPattern, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the default and seeded constructors and the
+        //   destructor are publicly callable.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor, and using
+        //:   the seeded constructor.
+        //:
+        //: 2 A default-constructed object produces the same hashes as an
+        //:   object seeded with 0.
+        //:
+        //: 3 Objects created with different seeds produce different hashes.
+        //:
+        //: 4 The seeded constructor reads the seed as a little-endian 64-bit
+        //:   integer, regardless of the alignment of the seed.
+        //:
+        //: 5 Objects can be destroyed.
+        //:
+        //: 6 The seeded constructor asserts on a null seed.
+        //
+        // Plan:
+        //: 1 Create default-constructed and zero-seeded objects, hash the
+        //:   same input, and compare.  (C-1,2,5)
+        //:
+        //: 2 Create objects with seeds differing in a single byte, hash the
+        //:   same input, and verify the hashes differ.  (C-3)
+        //:
+        //: 3 Copy a seed to every offset of a buffer and verify the hash is
+        //:   unchanged.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid values.  (C-6)
+        //
+        // Testing:
+        //   WyHashAlgorithm();
+        //   explicit WyHashAlgorithm(const char *seed);
+        //   ~WyHashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CREATORS"
+                            "\n================\n");
+
+        if (verbose) printf("Compare default and zero-seeded objects."
+                            " (C-1,2,5)\n");
+        {
+            for (size_t length = 0; length <= 100; ++length) {
+                Obj mX;
+                Obj mY(genericSeed);
+
+                mX(testPattern, length);
+                mY(testPattern, length);
+
+                LOOP_ASSERT(length, mX.computeHash() == mY.computeHash());
+            }
+        }
+
+        if (verbose) printf("Compare objects with different seeds. (C-3)\n");
+        {
+            for (int byte = 0; byte < 8; ++byte) {
+                char seed[8];
+                memcpy(seed, genericSeed, sizeof seed);
+                seed[byte] = 1;
+
+                Obj mX(genericSeed);
+                Obj mY(seed);
+
+                mX(testPattern, 20);
+                mY(testPattern, 20);
+
+                LOOP_ASSERT(byte, mX.computeHash() != mY.computeHash());
+            }
+        }
+
+        if (verbose) printf("Verify seed alignment does not matter. (C-4)\n");
+        {
+            Obj mX(testSeed);
+            mX(testPattern, 16);
+            const Uint64 EXP = mX.computeHash();
+
+            ASSERT(0x5acc90c733d2aa9dULL == EXP);
+
+            for (int offset = 0; offset < 8; ++offset) {
+                char buffer[16];
+                memcpy(buffer + offset, testSeed, sizeof testSeed);
+
+                Obj mY(buffer + offset);
+                mY(testPattern, 16);
+
+                LOOP_ASSERT(offset, EXP == mY.computeHash());
+            }
+        }
+
+        if (verbose) printf("Negative Testing. (C-6)\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj dummy(0));
+            ASSERT_PASS(Obj dummy(genericSeed));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bslh::WyHashAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings.
+        //:   (C-1)
+        //:
+        //: 4 Verify the same hash is produced for a c-string hashed in one
+        //:   call and in several calls.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) printf("Instantiate 'bslh::WyHashAlgorithm'\n");
+        {
+            WyHashAlgorithm alg;
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different c-strings.\n");
+        {
+            WyHashAlgorithm alg1(genericSeed);
+            WyHashAlgorithm alg2(genericSeed);
+            const char *str1 = "Hello World";
+            const char *str2 = "Goodbye World";
+            alg1(str1, strlen(str1));
+            alg2(str2, strlen(str2));
+            ASSERT(alg1.computeHash() != alg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " c-strings.\n");
+        {
+            WyHashAlgorithm alg1(genericSeed);
+            WyHashAlgorithm alg2(genericSeed);
+            const char *str1 = "Hello World";
+            const char *str2 = "Hello World";
+            alg1(str1, strlen(str1));
+            alg2(str2, strlen(str2));
+            ASSERT(alg1.computeHash() == alg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hash is produced for a c-string"
+                            " hashed in one call and in several calls.\n");
+        {
+            const char *str = "The quick brown fox jumps over the lazy dog, "
+                              "then jumps over the lazy dog again.";
+
+            WyHashAlgorithm alg1;
+            WyHashAlgorithm alg2;
+            alg1(str, strlen(str));
+            alg2(str, 10);
+            alg2(str + 10, 50);
+            alg2(str + 60, strlen(str) - 60);
+            ASSERT(alg1.computeHash() == alg2.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // EXAMINE HASH VALUES
+        //   This case prints out hash values of the argument strings using a
+        //   fixed seed.  It is intended to demonstrate that the same strings
+        //   hash to the same values regardless of native byte ordering.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXAMINE HASH VALUES"
+                            "\n===================\n");
+
+        for (int i = 1; i < argc; ++i) {
+            WyHashAlgorithm hashAlg(testSeed);
+            hashAlg(argv[i], strlen(argv[i]));
+            P_(argv[i]) P(hashAlg.computeHash())
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // SMALL-KEY THROUGHPUT BENCHMARK
+        //   Compare the time taken to hash small keys by this algorithm, by
+        //   'bslh::SpookyHashAlgorithm' (the algorithm used by
+        //   'bslh::DefaultHashAlgorithm'), and by 'bslh::SipHashAlgorithm'
+        //   (the algorithm used by 'bslh::DefaultSeededHashAlgorithm').  Each
+        //   key is hashed by a newly created algorithm object, as done by
+        //   'bslh::Hash'.
+        //
+        // Testing:
+        //   SMALL-KEY THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        printf("\nSMALL-KEY THROUGHPUT BENCHMARK"
+               "\n==============================\n");
+
+        const int numIterations = argc > 2 ? atoi(argv[2]) : 10000000;
+
+        static const size_t LENGTHS[] = { 4, 8, 12, 16, 24, 32, 48, 64 };
+        enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        printf("%6s %12s %12s %12s   (ns/key)\n",
+               "LENGTH", "wyhash", "spooky", "siphash");
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const size_t LENGTH = LENGTHS[ti];
+
+            Uint64 rWy, rSpooky, rSip;
+
+            const double tWy     = timeSmallKeys<WyHashAlgorithm>(
+                                                              &rWy,
+                                                              LENGTH,
+                                                              numIterations);
+            const double tSpooky = timeSmallKeys<SpookyHashAlgorithm>(
+                                                              &rSpooky,
+                                                              LENGTH,
+                                                              numIterations);
+            const double tSip    = timeSmallKeys<SipHashAlgorithm>(
+                                                              &rSip,
+                                                              LENGTH,
+                                                              numIterations);
+
+            const double scale = 1e9 / numIterations;
+
+            printf("%6d %12.2f %12.2f %12.2f\n",
+                   static_cast<int>(LENGTH),
+                   tWy     * scale,
+                   tSpooky * scale,
+                   tSip    * scale);
+
+            if (veryVerbose) { P_(rWy) P_(rSpooky) P(rSip) }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
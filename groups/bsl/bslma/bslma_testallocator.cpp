@@ -16,9 +16,16 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <cstdio>   // print messages
 #include <cstdlib>  // 'abort'
 #include <cstring>  // 'memset'
+#include <new>      // placement 'new'
 
 namespace BloombergLP {
 
+namespace bslma {
+
+struct TestAllocator_List;
+
+}  // close package namespace
+
 namespace {
 
 typedef unsigned char               Uchar;
@@ -45,6 +52,10 @@ enum { PADDING_SIZE = sizeof(bsls::AlignmentUtil::MaxAlignedType) };
                                                     // before and after the
                                                     // user segment
 
+enum { NUM_LIST_SHARDS = 16 };                      // number of independently
+                                                    // locked shards of the
+                                                    // allocated memory list
+
 #define ZU BSLS_BSLTESTUTIL_FORMAT_ZU  // An alias for a string that can be
                                        // treated as the "%zu" format
                                        // specifier (MSVC issue).
@@ -57,9 +68,48 @@ struct Link {
     // This 'struct' holds pointers to the next and preceding allocated
     // memory block in the allocated memory block list.
 
-    bsls::Types::Int64  d_index;   // index of this allocation
-    Link               *d_next_p;  // next 'Link' pointer
-    Link               *d_prev_p;  // previous 'Link' pointer
+    bsls::Types::Int64         d_index;   // index of this allocation
+    Link                      *d_next_p;  // next 'Link' pointer
+    Link                      *d_prev_p;  // previous 'Link' pointer
+    bslma::TestAllocator_List *d_list_p;  // shard holding this 'Link'
+};
+
+                        // =======================
+                        // class OptionalLockGuard
+                        // =======================
+
+class OptionalLockGuard {
+    // This class implements a guard that locks a 'bsls::BslLock' on
+    // construction and unlocks it on destruction, or does nothing if no lock
+    // is supplied.
+
+    // DATA
+    bsls::BslLock *d_lock_p;  // lock (held, not owned), or 0
+
+  private:
+    // NOT IMPLEMENTED
+    OptionalLockGuard(const OptionalLockGuard&);
+    OptionalLockGuard& operator=(const OptionalLockGuard&);
+
+  public:
+    // CREATORS
+    explicit
+    OptionalLockGuard(bsls::BslLock *lock)
+        // Create a guard that locks the specified 'lock' unless 'lock' is 0.
+    : d_lock_p(lock)
+    {
+        if (d_lock_p) {
+            d_lock_p->lock();
+        }
+    }
+
+    ~OptionalLockGuard()
+        // Unlock the lock supplied at construction, if any.
+    {
+        if (d_lock_p) {
+            d_lock_p->unlock();
+        }
+    }
 };
 
                         // =============
@@ -203,14 +253,36 @@ namespace bslma {
 
 struct TestAllocator_List {
     // This 'struct' stores a head 'Link' and a tail 'Link' for list
-    // manipulation.
-
-    Link *d_head_p;  // address of first link in list (or 0)
-    Link *d_tail_p;  // address of last link in list (or 0)
+    // manipulation, and a lock that guards the list in concurrent mode.  A
+    // test allocator holds an array of 'NUM_LIST_SHARDS' such lists; outside
+    // of concurrent mode, only the first list is used to register newly
+    // allocated blocks.
+
+    Link          *d_head_p;  // address of first link in list (or 0)
+    Link          *d_tail_p;  // address of last link in list (or 0)
+    bsls::BslLock  d_lock;    // guard for this list in concurrent mode
 };
 
 }  // close package namespace
 
+static
+void updateMax(bsls::AtomicInt64 *maximum, bsls::Types::Int64 value)
+    // Load into the specified 'maximum' the specified 'value' if 'value' is
+    // greater than the current value of 'maximum'.  Note that this function
+    // is safe to call concurrently on the same 'maximum'.
+{
+    bsls::Types::Int64 current = maximum->loadRelaxed();
+
+    while (current < value) {
+        const bsls::Types::Int64 previous = maximum->testAndSwap(current,
+                                                                 value);
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+}
+
 static
 Link *removeLink(bslma::TestAllocator_List *allocatedList, Link *link)
     // Remove the specified 'link' from the specified 'allocatedList'.  Return
@@ -261,6 +333,7 @@ Link *addLink(bslma::TestAllocator_List *allocatedList,
 
     link->d_next_p = 0;
     link->d_index  = index;
+    link->d_list_p = allocatedList;
 
     if (!allocatedList->d_head_p) {
         allocatedList->d_head_p = link;
@@ -277,16 +350,46 @@ Link *addLink(bslma::TestAllocator_List *allocatedList,
 }
 
 static
-void printList(const bslma::TestAllocator_List& allocatedList)
-    // Print the indices of all 'Link' objects currently in the specified
-    // 'allocatedList'.
+const Link *nextLink(const Link **cursors)
+    // Return the address of the 'Link' having the lowest index among the
+    // 'NUM_LIST_SHARDS' links in the specified 'cursors' array, and advance
+    // the corresponding cursor to its successor, or return 0 if all cursors
+    // are 0.
 {
-    const Link *link_p = allocatedList.d_head_p;
+    const Link **min = 0;
+
+    for (int i = 0; i < NUM_LIST_SHARDS; ++i) {
+        if (cursors[i] && (!min || cursors[i]->d_index < (*min)->d_index)) {
+            min = &cursors[i];
+        }
+    }
+
+    if (!min) {
+        return 0;                                                     // RETURN
+    }
+
+    const Link *link = *min;
+    *min = link->d_next_p;
+    return link;
+}
+
+static
+void printList(const bslma::TestAllocator_List *allocatedLists)
+    // Print, in order of increasing index, the indices of all 'Link' objects
+    // currently in the 'NUM_LIST_SHARDS' lists of the specified
+    // 'allocatedLists' array.
+{
+    const Link *cursors[NUM_LIST_SHARDS];
+    for (int i = 0; i < NUM_LIST_SHARDS; ++i) {
+        cursors[i] = allocatedLists[i].d_head_p;
+    }
+
+    const Link *link_p = nextLink(cursors);
 
     while (link_p) {
         for (int i = 0; i < 8 && link_p; ++i) {
             std::printf("%lld\t", link_p->d_index);
-            link_p = link_p->d_next_p;
+            link_p = nextLink(cursors);
         }
 
         // The space after the '\n' is needed to align these indices properly
@@ -302,12 +405,28 @@ namespace bslma {
                         // class TestAllocator
                         // -------------------
 
+// PRIVATE MANIPULATORS
+void TestAllocator::initialize()
+{
+    BSLS_ASSERT(d_allocator_p);
+
+    d_list_p = (TestAllocator_List *)d_allocator_p->allocate(
+                                 NUM_LIST_SHARDS * sizeof(TestAllocator_List));
+
+    for (int i = 0; i < NUM_LIST_SHARDS; ++i) {
+        TestAllocator_List *list = new (d_list_p + i) TestAllocator_List;
+        list->d_head_p = 0;
+        list->d_tail_p = 0;
+    }
+}
+
 // CREATORS
 TestAllocator::TestAllocator(Allocator *basicAllocator)
 : d_name_p(0)
 , d_noAbortFlag(false)
 , d_quietFlag(false)
 , d_verboseFlag(false)
+, d_concurrentFlag(false)
 , d_allocationLimit(-1)
 , d_numAllocations(0)
 , d_numDeallocations(0)
@@ -327,12 +446,7 @@ TestAllocator::TestAllocator(Allocator *basicAllocator)
                 ? basicAllocator
                 : &MallocFreeAllocator::singleton())
 {
-    BSLS_ASSERT(d_allocator_p);
-
-    d_list_p = (TestAllocator_List *)d_allocator_p->allocate(
-                                                   sizeof(TestAllocator_List));
-    d_list_p->d_head_p = 0;
-    d_list_p->d_tail_p = 0;
+    initialize();
 }
 
 TestAllocator::TestAllocator(bool verboseFlag, Allocator *basicAllocator)
@@ -340,6 +454,7 @@ TestAllocator::TestAllocator(bool verboseFlag, Allocator *basicAllocator)
 , d_noAbortFlag(false)
 , d_quietFlag(false)
 , d_verboseFlag(verboseFlag)
+, d_concurrentFlag(false)
 , d_allocationLimit(-1)
 , d_numAllocations(0)
 , d_numDeallocations(0)
@@ -359,12 +474,7 @@ TestAllocator::TestAllocator(bool verboseFlag, Allocator *basicAllocator)
                 ? basicAllocator
                 : &MallocFreeAllocator::singleton())
 {
-    BSLS_ASSERT(d_allocator_p);
-
-    d_list_p = (TestAllocator_List *)d_allocator_p->allocate(
-                                                   sizeof(TestAllocator_List));
-    d_list_p->d_head_p = 0;
-    d_list_p->d_tail_p = 0;
+    initialize();
 }
 
 TestAllocator::TestAllocator(const char *name, Allocator *basicAllocator)
@@ -372,6 +482,7 @@ TestAllocator::TestAllocator(const char *name, Allocator *basicAllocator)
 , d_noAbortFlag(false)
 , d_quietFlag(false)
 , d_verboseFlag(false)
+, d_concurrentFlag(false)
 , d_allocationLimit(-1)
 , d_numAllocations(0)
 , d_numDeallocations(0)
@@ -391,12 +502,7 @@ TestAllocator::TestAllocator(const char *name, Allocator *basicAllocator)
                 ? basicAllocator
                 : &MallocFreeAllocator::singleton())
 {
-    BSLS_ASSERT(d_allocator_p);
-
-    d_list_p = (TestAllocator_List *)d_allocator_p->allocate(
-                                                   sizeof(TestAllocator_List));
-    d_list_p->d_head_p = 0;
-    d_list_p->d_tail_p = 0;
+    initialize();
 }
 
 TestAllocator::TestAllocator(const char *name,
@@ -406,6 +512,7 @@ TestAllocator::TestAllocator(const char *name,
 , d_noAbortFlag(false)
 , d_quietFlag(false)
 , d_verboseFlag(verboseFlag)
+, d_concurrentFlag(false)
 , d_allocationLimit(-1)
 , d_numAllocations(0)
 , d_numDeallocations(0)
@@ -425,12 +532,7 @@ TestAllocator::TestAllocator(const char *name,
                 ? basicAllocator
                 : &MallocFreeAllocator::singleton())
 {
-    BSLS_ASSERT(d_allocator_p);
-
-    d_list_p = (TestAllocator_List *)d_allocator_p->allocate(
-                                                   sizeof(TestAllocator_List));
-    d_list_p->d_head_p = 0;
-    d_list_p->d_tail_p = 0;
+    initialize();
 }
 
 TestAllocator::~TestAllocator()
@@ -442,14 +544,19 @@ TestAllocator::~TestAllocator()
         print();
     }
 
-    Link *link_p = d_list_p->d_head_p;
-    while (link_p) {
-        Link *linkToFree = link_p;
-        link_p = link_p->d_next_p;
-        d_allocator_p->deallocate(linkToFree);
+    for (int i = 0; i < NUM_LIST_SHARDS; ++i) {
+        TestAllocator_List *list = d_list_p + i;
+
+        Link *link_p = list->d_head_p;
+        while (link_p) {
+            Link *linkToFree = link_p;
+            link_p = link_p->d_next_p;
+            d_allocator_p->deallocate(linkToFree);
+        }
+        list->d_head_p = 0;
+        list->d_tail_p = 0;
+        list->~TestAllocator_List();
     }
-    d_list_p->d_head_p = 0;
-    d_list_p->d_tail_p = 0;
     d_allocator_p->deallocate(d_list_p);
 
     if (!isQuiet()) {
@@ -472,7 +579,8 @@ TestAllocator::~TestAllocator()
 // MANIPULATORS
 void *TestAllocator::allocate(size_type size)
 {
-    bsls::BslLockGuard guard(&d_lock);
+    const bool        concurrent = isConcurrent();
+    OptionalLockGuard guard(concurrent ? 0 : &d_lock);
 
     bsls::Types::Int64 allocationIndex = d_numAllocations.addRelaxed(1) - 1;
 
@@ -517,19 +625,25 @@ void *TestAllocator::allocate(size_type size)
     align->d_object.d_magicNumber = ALLOCATED_MEMORY;
     align->d_object.d_index       = allocationIndex;
 
-    d_numBlocksInUse.addRelaxed(1);
-    if (numBlocksMax() < numBlocksInUse()) {
-        d_numBlocksMax.storeRelaxed(numBlocksInUse());
-    }
+    updateMax(&d_numBlocksMax, d_numBlocksInUse.addRelaxed(1));
     d_numBlocksTotal.addRelaxed(1);
 
-    d_numBytesInUse.addRelaxed(static_cast<bsls::Types::Int64>(size));
-    if (numBytesMax() < numBytesInUse()) {
-        d_numBytesMax.storeRelaxed(numBytesInUse());
-    }
+    updateMax(&d_numBytesMax,
+              d_numBytesInUse.addRelaxed(
+                                       static_cast<bsls::Types::Int64>(size)));
     d_numBytesTotal.addRelaxed(static_cast<bsls::Types::Int64>(size));
 
-    Link *link = addLink(d_list_p, allocationIndex, d_allocator_p);
+    // In concurrent mode, spread the blocks over the shards of the allocated
+    // memory list, each of which is guarded by its own lock.
+
+    TestAllocator_List *list = concurrent
+                               ? d_list_p + allocationIndex % NUM_LIST_SHARDS
+                               : d_list_p;
+    Link *link;
+    {
+        OptionalLockGuard listGuard(concurrent ? &list->d_lock : 0);
+        link = addLink(list, allocationIndex, d_allocator_p);
+    }
     align->d_object.d_address_p = link;
     align->d_object.d_id_p      = this;
 
@@ -566,7 +680,8 @@ void *TestAllocator::allocate(size_type size)
 
 void TestAllocator::deallocate(void *address)
 {
-    bsls::BslLockGuard guard(&d_lock);
+    const bool        concurrent = isConcurrent();
+    OptionalLockGuard guard(concurrent ? 0 : &d_lock);
 
     d_numDeallocations.addRelaxed(1);
     d_lastDeallocatedAddress_p.storeRelaxed(reinterpret_cast<int *>(address));
@@ -644,8 +759,13 @@ void TestAllocator::deallocate(void *address)
     // Now check for corrupted memory block and cross allocation.
 
     if (!miscError && !overrunBy && !underrunBy) {
-        d_allocator_p->deallocate(removeLink(d_list_p,
-                                             align->d_object.d_address_p));
+        Link               *link = align->d_object.d_address_p;
+        TestAllocator_List *list = link->d_list_p;
+        {
+            OptionalLockGuard listGuard(concurrent ? &list->d_lock : 0);
+            removeLink(list, link);
+        }
+        d_allocator_p->deallocate(link);
     }
     else {
         if (miscError) {
@@ -743,9 +863,28 @@ void TestAllocator::print() const
                 numBlocksTotal(), numBytesTotal(),
                 numMismatches(),  numBoundsErrors());
 
-    if (d_list_p->d_head_p) {
+    // Lock every shard of the allocated memory list in case 'allocate' or
+    // 'deallocate' are being called concurrently in concurrent mode.
+
+    for (int i = 0; i < NUM_LIST_SHARDS; ++i) {
+        d_list_p[i].d_lock.lock();
+    }
+
+    bool hasOutstanding = false;
+    for (int i = 0; i < NUM_LIST_SHARDS; ++i) {
+        if (d_list_p[i].d_head_p) {
+            hasOutstanding = true;
+            break;
+        }
+    }
+
+    if (hasOutstanding) {
         std::printf(" Indices of Outstanding Memory Allocations:\n ");
-        printList(*d_list_p);
+        printList(d_list_p);
+    }
+
+    for (int i = NUM_LIST_SHARDS - 1; 0 <= i; --i) {
+        d_list_p[i].d_lock.unlock();
     }
     std::fflush(stdout);
 }
@@ -38,6 +38,7 @@ BSLS_IDENT("$Id: $")
 //             |         numMismatches/numBoundsErrors
 //             |         print/name
 //             |         setAllocationLimit/allocationLimit
+//             |         setConcurrent/isConcurrent
 //             |         setNoAbort/isNoAbort
 //             |         setQuiet/isQuiet
 //             |         setVerbose/isVerbose
@@ -78,7 +79,7 @@ BSLS_IDENT("$Id: $")
 //
 ///Modes
 ///-----
-// The test allocator's behavior is controlled by three basic *mode* flags:
+// The test allocator's behavior is controlled by four basic *mode* flags:
 //
 // VERBOSE MODE: (Default 0) Specifies that each allocation and deallocation
 // should be printed to standard output.  In verbose mode all state variables
@@ -97,13 +98,28 @@ BSLS_IDENT("$Id: $")
 // primarily for visual inspection of unusual error diagnostics in this
 // component's test driver (in non-quiet mode only).
 //
+// CONCURRENT MODE: (Default 0) Specifies that 'allocate' and 'deallocate'
+// should not serialize on a single lock.  In concurrent mode, the statistics
+// are maintained using atomic operations only, and the registry of
+// outstanding blocks is split into a number of independently locked shards,
+// so that threads allocating and deallocating at the same time rarely contend
+// with one another.  Bounds checking and mismatch detection are performed
+// exactly as they are otherwise.  Note that this mode is intended for
+// multi-threaded stress tests, where the single lock taken by default can
+// slow the code under test to the point of hiding races.  Also note that the
+// values returned by the 'lastAllocated*' and 'lastDeallocated*' accessors
+// are well-defined only in the absence of concurrent allocation (or
+// deallocation) requests, and that the indices of outstanding allocations
+// reported by 'print' are listed in increasing order only when they were
+// allocated from a single thread.
+//
 // Taking the default mode settings, memory allocation/deallocation will not be
 // displayed individually.  However, in the event of a mismatched deallocation
 // or a memory leak, the problem will be announced, any relevant state of the
 // object will be displayed, and the program will abort.
 //
-// The three modes are independently set using the 'setVerbose', 'setQuiet',
-// and 'setNoAbort' manipulators.
+// The four modes are independently set using the 'setVerbose', 'setQuiet',
+// 'setNoAbort', and 'setConcurrent' manipulators.
 //
 ///Allocation Limit
 ///----------------
@@ -146,7 +162,8 @@ BSLS_IDENT("$Id: $")
 // 'bsldoc_glossary') provided that the allocator supplied at construction (if
 // any) is fully thread-safe.  Note that the 'bslma::MallocFreeAllocator'
 // singleton (the allocator used by the test allocator if none is supplied at
-// construction) is fully thread-safe.
+// construction) is fully thread-safe.  The 'setConcurrent' manipulator,
+// however, must not be called while other threads are using the allocator.
 //
 ///Usage
 ///-----
@@ -357,6 +374,11 @@ class TestAllocator : public Allocator {
                                          // allocation/deallocation events and
                                          // print statistics on destruction
 
+    bsls::AtomicInt
+                d_concurrentFlag;        // whether or not to avoid taking
+                                         // 'd_lock' in 'allocate' and
+                                         // 'deallocate'
+
     bsls::AtomicInt64
                 d_allocationLimit;       // number of allocations before
                                          // exception is thrown by this object
@@ -428,16 +450,25 @@ class TestAllocator : public Allocator {
                                          // deallocated memory (or 0)
 
     TestAllocator_List
-               *d_list_p;                // list of allocated memory (owned)
+               *d_list_p;                // array of independently locked
+                                         // shards of the list of allocated
+                                         // memory (owned)
 
     mutable bsls::BslLock
                 d_lock;                  // ensure mutual exclusion in
-                                         // 'allocate', 'deallocate', 'print',
-                                         // and 'status'
+                                         // 'allocate', 'deallocate' (unless in
+                                         // concurrent mode), 'print', and
+                                         // 'status'
 
     Allocator  *d_allocator_p;           // memory allocator (held, not owned)
 
   private:
+    // PRIVATE MANIPULATORS
+    void initialize();
+        // Allocate and initialize the shards of the list of allocated memory
+        // using the allocator supplied at construction.  Note that this method
+        // is called only by the constructors of this class.
+
     // NOT IMPLEMENTED
     TestAllocator(const TestAllocator&);             // = delete
     TestAllocator& operator=(const TestAllocator&);  // = delete
@@ -508,6 +539,16 @@ class TestAllocator : public Allocator {
         // 'limit' is less than 0, no exception is to be thrown.  By default,
         // no exception is scheduled.
 
+    void setConcurrent(bool flagValue);
+        // Set the concurrent mode for this test allocator to the specified
+        // (boolean) 'flagValue'.  If 'flagValue' is 'true', 'allocate' and
+        // 'deallocate' update the statistics of this object using atomic
+        // operations only, and register allocated blocks in one of several
+        // independently locked shards, rather than serializing on a single
+        // lock.  Note that the default mode is *not* concurrent.  The behavior
+        // is undefined if this method is called concurrently with any other
+        // manipulator of this object.
+
     void setNoAbort(bool flagValue);
         // Set the no-abort mode for this test allocator to the specified
         // (boolean) 'flagValue'.  'If flagValue' is 'true', aborting on fatal
@@ -540,6 +581,11 @@ class TestAllocator : public Allocator {
         // exception is thrown.  A negative value indicates that no exception
         // is scheduled.
 
+    bool isConcurrent() const;
+        // Return 'true' if this allocator is currently in concurrent mode, and
+        // 'false' otherwise.  In concurrent mode, 'allocate' and 'deallocate'
+        // do not serialize on a single lock.
+
     bool isNoAbort() const;
         // Return 'true' if this allocator is currently in no-abort mode, and
         // 'false' otherwise.  In no-abort mode all diagnostic messages are
@@ -806,6 +852,12 @@ void TestAllocator::setAllocationLimit(bsls::Types::Int64 limit)
     d_allocationLimit.storeRelaxed(limit);
 }
 
+inline
+void TestAllocator::setConcurrent(bool flagValue)
+{
+    d_concurrentFlag.storeRelaxed(flagValue);
+}
+
 inline
 void TestAllocator::setNoAbort(bool flagValue)
 {
@@ -831,6 +883,12 @@ bsls::Types::Int64 TestAllocator::allocationLimit() const
     return d_allocationLimit.loadRelaxed();
 }
 
+inline
+bool TestAllocator::isConcurrent() const
+{
+    return d_concurrentFlag.loadRelaxed();
+}
+
 inline
 bool TestAllocator::isNoAbort() const
 {
@@ -60,10 +60,12 @@ using namespace BloombergLP;
 // [ 3] void *allocate(size_type size);
 // [ 3] void deallocate(void *address);
 // [ 2] void setAllocationLimit(Int64 limit);
+// [14] void setConcurrent(bool flagValue);
 // [ 2] void setNoAbort(bool flagValue);
 // [ 2] void setQuiet(bool flagValue);
 // [ 2] void setVerbose(bool flagValue);
 // [ 2] Int64 allocationLimit() const;
+// [14] bool isConcurrent() const;
 // [ 2] bool isNoAbort() const;
 // [ 2] bool isQuiet() const;
 // [ 2] bool isVerbose() const;
@@ -85,7 +87,7 @@ using namespace BloombergLP;
 // [12] void print() const;
 // [ 2] int status() const;
 //-----------------------------------------------------------------------------
-// [14] USAGE TEST
+// [15] USAGE TEST
 // [ 5] Ensure that exception is thrown after allocation limit is exceeded.
 // [ 1] Make sure that all counts are initialized to zero (placement new).
 // [ 1] Make sure that global operators new and delete are *not* called.
@@ -102,6 +104,7 @@ using namespace BloombergLP;
 // [10] Test 'numBlocksInUse', 'numBlocksTotal'
 // [11] Ensure that over and underruns are properly caught.
 // [13] Ensure that 'allocate' and 'deallocate' are thread-safe.
+// [14] Ensure that concurrent mode is thread-safe and detects errors.
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -584,7 +587,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVeryVerbose);
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // TEST USAGE
         //   Verify that the usage example for testing exception neutrality is
@@ -701,6 +704,247 @@ int main(int argc, char *argv[])
 // indicate whether or not exceptions are enabled.
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // CONCURRENT MODE
+        //   Ensure that the allocator is thread-safe in concurrent mode, and
+        //   that its checks and reporting are unaffected.
+        //
+        // Concerns:
+        //: 1 Concurrent mode is off by default, and can be turned on and off
+        //:   using 'setConcurrent'.
+        //:
+        //: 2 In concurrent mode, 'allocate' and 'deallocate' are thread-safe
+        //:   and maintain accurate statistics.
+        //:
+        //: 3 In concurrent mode, mismatched deallocations and over/underruns
+        //:   are still detected.
+        //:
+        //: 4 In concurrent mode, 'print' reports the indices of all
+        //:   outstanding allocations, in increasing order, although they are
+        //:   registered in different shards.
+        //:
+        //: 5 Blocks allocated in one mode can be deallocated in the other.
+        //
+        // Plan:
+        //: 1 Verify the default value of 'isConcurrent', and that it reflects
+        //:   the value set by 'setConcurrent'.  (C-1)
+        //:
+        //: 2 Repeat the test in case 13 on an allocator in concurrent mode,
+        //:   and verify the statistics after each iteration.  (C-2)
+        //:
+        //: 3 In quiet mode, deallocate an invalid address and corrupt the
+        //:   pads of allocated blocks, and verify that 'numMismatches' and
+        //:   'numBoundsErrors' are incremented.  (C-3)
+        //:
+        //: 4 Allocate a sequence of blocks, deallocate some of them, and
+        //:   compare the output of 'print' with the expected output.  (C-4)
+        //:
+        //: 5 Allocate blocks with concurrent mode off, turn it on, and
+        //:   deallocate them (and vice versa); verify the statistics.  (C-5)
+        //
+        // Testing:
+        //   void setConcurrent(bool flagValue);
+        //   bool isConcurrent() const;
+        //   CONCERN: concurrent mode is thread-safe and detects errors.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT MODE"
+                            "\n===============\n");
+
+        using namespace TestCase13;
+
+        if (verbose) printf("\nTesting 'setConcurrent' and 'isConcurrent'.\n");
+        {
+            Obj mX(veryVeryVeryVerbose);  const Obj& X = mX;
+
+            ASSERT(false == X.isConcurrent());
+
+            mX.setConcurrent(true);
+            ASSERT(true  == X.isConcurrent());
+
+            mX.setConcurrent(false);
+            ASSERT(false == X.isConcurrent());
+        }
+
+        if (verbose) printf("\nTesting thread safety.\n");
+        {
+            Obj mX("concurrent allocator", veryVeryVeryVerbose);
+            const Obj& X = mX;
+
+            mX.setConcurrent(true);
+
+            const int NUM_TEST_ITERATIONS   =  10;
+            const int NUM_THREAD_ITERATIONS = 500;
+
+            ThreadInfo info = { NUM_THREAD_ITERATIONS, &mX };
+
+            for (int ti = 0; ti < NUM_TEST_ITERATIONS; ++ti) {
+                ThreadId id1 = createThread(&threadFunction1, &info);
+                ThreadId id2 = createThread(&threadFunction2, &info);
+                ThreadId id3 = createThread(&threadFunction3, &info);
+
+                joinThread(id1);
+                joinThread(id2);
+                joinThread(id3);
+
+                const bsls::Types::Int64 EXP_ALLOCATIONS =
+                                (ti + 1) * NUM_THREAD_ITERATIONS * (1 + 2 + 3);
+
+                ASSERTV(ti, 0 == X.status());
+
+                ASSERTV(ti, EXP_ALLOCATIONS == X.numAllocations());
+                ASSERTV(ti, EXP_ALLOCATIONS == X.numDeallocations());
+                ASSERTV(ti, EXP_ALLOCATIONS == X.numBlocksTotal());
+
+                ASSERTV(ti, 0 == X.numBlocksInUse());
+                ASSERTV(ti, 3 <= X.numBlocksMax());
+                ASSERTV(ti, 6 >= X.numBlocksMax());
+
+                ASSERTV(ti, 0 == X.numBytesInUse());
+                ASSERTV(ti, 0  < X.numBytesMax());
+                ASSERTV(ti, X.numBytesMax() <= X.numBytesTotal());
+
+                ASSERTV(ti, 0 == X.numBoundsErrors());
+                ASSERTV(ti, 0 == X.numMismatches());
+            }
+        }
+
+        if (verbose) printf("\nTesting error detection.\n");
+        {
+            Obj mX(veryVeryVeryVerbose);  const Obj& X = mX;
+
+            mX.setConcurrent(true);
+            mX.setQuiet(true);
+
+            bsls::AlignmentUtil::MaxAlignedType notAllocated[4];
+            memset(notAllocated, 0, sizeof notAllocated);
+
+            mX.deallocate(&notAllocated[2]);
+            ASSERT(1 == X.numMismatches());
+            ASSERT(0 == X.numBoundsErrors());
+
+            char *p = (char *)mX.allocate(10);
+            p[10] = 'x';
+            mX.deallocate(p);
+            ASSERT(1 == X.numMismatches());
+            ASSERT(1 == X.numBoundsErrors());
+
+            p[10] = (char)0xB1;
+            p[-1] = 'x';
+            mX.deallocate(p);
+            ASSERT(1 == X.numMismatches());
+            ASSERT(2 == X.numBoundsErrors());
+
+            p[-1] = (char)0xB1;
+            mX.deallocate(p);
+            ASSERT(0 == X.numBlocksInUse());
+
+            // Deallocate an address inside an allocated block, rather than
+            // the freed block, as accessing deallocated memory can result in
+            // errors on some platforms.
+
+            bsls::AlignmentUtil::MaxAlignedType *q =
+                 (bsls::AlignmentUtil::MaxAlignedType *)mX.allocate(
+                                                               sizeof *q * 4);
+            memset(q, 0, sizeof *q * 4);
+
+            mX.deallocate(q + 2);
+            ASSERT(2 == X.numMismatches());
+            ASSERT(2 == X.numBoundsErrors());
+            ASSERT(1 == X.numBlocksInUse());
+
+            mX.deallocate(q);
+            ASSERT(0 == X.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting 'print'.\n");
+        {
+            Obj mX(veryVeryVeryVerbose);  const Obj& X = mX;
+
+            mX.setConcurrent(true);
+
+            const int NUM_BLOCKS = 40;
+
+            void *blocks[NUM_BLOCKS];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(1);
+            }
+
+            // Deallocate every third block, leaving outstanding blocks in
+            // every shard.
+
+            for (int i = 0; i < NUM_BLOCKS; i += 3) {
+                mX.deallocate(blocks[i]);
+            }
+
+            const bsls::Types::Int64 NUM_IN_USE = X.numBlocksInUse();
+
+            char expected[2000];
+            int  length = sprintf(
+                       expected,
+                       "\n"
+                       "==================================================\n"
+                       "                TEST ALLOCATOR STATE\n"
+                       "--------------------------------------------------\n"
+                       "        Category\tBlocks\tBytes\n"
+                       "        --------\t------\t-----\n"
+                       "          IN USE\t%lld\t%lld\n"
+                       "             MAX\t%d\t%d\n"
+                       "           TOTAL\t%d\t%d\n"
+                       "      MISMATCHES\t0\n"
+                       "   BOUNDS ERRORS\t0\n"
+                       "--------------------------------------------------\n"
+                       " Indices of Outstanding Memory Allocations:\n ",
+                       NUM_IN_USE, NUM_IN_USE,
+                       NUM_BLOCKS, NUM_BLOCKS,
+                       NUM_BLOCKS, NUM_BLOCKS);
+
+            int numPrinted = 0;
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                if (0 == i % 3) {
+                    continue;
+                }
+                length += sprintf(expected + length, "%d\t", i);
+                if (0 == ++numPrinted % 8) {
+                    length += sprintf(expected + length, "\n ");
+                }
+            }
+            if (numPrinted % 8) {
+                sprintf(expected + length, "\n ");
+            }
+
+            ASSERT(0 == verifyPrint(X, expected, argc));
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                if (i % 3) {
+                    mX.deallocate(blocks[i]);
+                }
+            }
+            ASSERT(0 == X.status());
+        }
+
+        if (verbose) printf("\nTesting switching modes.\n");
+        {
+            Obj mX(veryVeryVeryVerbose);  const Obj& X = mX;
+
+            void *p1 = mX.allocate(5);
+            mX.setConcurrent(true);
+            void *p2 = mX.allocate(7);
+            void *p3 = mX.allocate(9);
+            mX.deallocate(p1);
+            mX.setConcurrent(false);
+            mX.deallocate(p3);
+            mX.deallocate(p2);
+
+            ASSERT(0 == X.status());
+            ASSERT(3 == X.numBlocksTotal());
+            ASSERT(3 == X.numBlocksMax());
+            ASSERT(0 == X.numBlocksInUse());
+            ASSERT(21 == X.numBytesTotal());
+            ASSERT(21 == X.numBytesMax());
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // CONCURRENCY
@@ -46,6 +46,8 @@ bslmt::ThreadAttributes::ThreadAttributes()
 : d_detachedState(e_CREATE_JOINABLE)
 , d_guardSize(e_UNSET_GUARD_SIZE)
 , d_inheritScheduleFlag(true)
+, d_numaNode(e_UNSET_NUMA_NODE)
+, d_processorId(e_UNSET_PROCESSOR_ID)
 , d_schedulingPolicy(e_SCHED_DEFAULT)
 , d_schedulingPriority(e_UNSET_PRIORITY)
 , d_stackSize(e_UNSET_STACK_SIZE)
@@ -59,6 +61,8 @@ bool bslmt::operator==(const ThreadAttributes& lhs,
     return lhs.detachedState()      == rhs.detachedState()      &&
            lhs.guardSize()          == rhs.guardSize()          &&
            lhs.inheritSchedule()    == rhs.inheritSchedule()    &&
+           lhs.numaNode()           == rhs.numaNode()           &&
+           lhs.processorId()        == rhs.processorId()        &&
            lhs.schedulingPolicy()   == rhs.schedulingPolicy()   &&
            lhs.schedulingPriority() == rhs.schedulingPriority() &&
            lhs.stackSize()          == rhs.stackSize();
@@ -70,6 +74,8 @@ bool bslmt::operator!=(const ThreadAttributes& lhs,
     return lhs.detachedState()      != rhs.detachedState()      ||
            lhs.guardSize()          != rhs.guardSize()          ||
            lhs.inheritSchedule()    != rhs.inheritSchedule()    ||
+           lhs.numaNode()           != rhs.numaNode()           ||
+           lhs.processorId()        != rhs.processorId()        ||
            lhs.schedulingPolicy()   != rhs.schedulingPolicy()   ||
            lhs.schedulingPriority() != rhs.schedulingPriority() ||
            lhs.stackSize()          != rhs.stackSize();
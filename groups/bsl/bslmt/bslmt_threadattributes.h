@@ -37,11 +37,15 @@ BSLS_IDENT("$Id: $")
 //  inheritSchedule     bool                   'true'
 //  schedulingPolicy    enum SchedulingPolicy  e_SCHED_DEFAULT
 //  schedulingPriority  int                    e_UNSET_PRIORITY
+//  processorId         int                    e_UNSET_PROCESSOR_ID
+//  numaNode            int                    e_UNSET_NUMA_NODE
 //
 //  Name          Constraint
 //  ---------     ---------------------------------------------------
 //  stackSize     'e_UNSET_STACK_SIZE == stackSize || 0 <= stackSize'
 //  guardSize     'e_UNSET_GUARD_SIZE == guardSize || 0 <= guardSize'
+//  processorId   'e_UNSET_PROCESSOR_ID == processorId || 0 <= processorId'
+//  numaNode      'e_UNSET_NUMA_NODE == numaNode || 0 <= numaNode'
 //..
 //
 ///'detachedState' Attribute
@@ -120,6 +124,26 @@ BSLS_IDENT("$Id: $")
 // 'false'.  See 'bslmt_threadutil' for information about support for this
 // attribute.
 //
+///'processorId' Attribute
+///- - - - - - - - - - - -
+// The 'processorId' attribute, if not 'e_UNSET_PROCESSOR_ID', indicates the
+// (zero-based) index of the processor on which a created thread should
+// exclusively run (i.e., the thread's processor affinity).  Pinning a thread
+// to a processor avoids migrations between processors, and, on machines
+// having multiple NUMA nodes, keeps the thread close to memory it has
+// first-touched.  This attribute takes precedence over 'numaNode'.  See
+// 'bslmt_threadutil' for information about support for this attribute.
+//
+///'numaNode' Attribute
+///- - - - - - - - - -
+// The 'numaNode' attribute, if not 'e_UNSET_NUMA_NODE', indicates the
+// (zero-based) index of the NUMA node whose processors a created thread should
+// exclusively run on.  Memory that such a thread first touches is then
+// typically placed on that node by the operating system, and memory bound to
+// that node (see 'bdlma_numaallocator') can be accessed without the latency of
+// a remote node.  This attribute is ignored if 'processorId' is set.  See
+// 'bslmt_threadutil' for information about support for this attribute.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -317,12 +341,14 @@ class ThreadAttributes {
         // These attributes are initialized to these values when a thread
         // attributes object is default constructed.
 
-        e_UNSET_STACK_SIZE = -1,
-        e_UNSET_GUARD_SIZE = -1,
-        e_UNSET_PRIORITY   = INT_MIN,
+        e_UNSET_STACK_SIZE   = -1,
+        e_UNSET_GUARD_SIZE   = -1,
+        e_UNSET_PRIORITY     = INT_MIN,
+        e_UNSET_PROCESSOR_ID = -1,
+        e_UNSET_NUMA_NODE    = -1,
 
-        e_SCHED_MIN        = e_SCHED_OTHER,
-        e_SCHED_MAX        = e_SCHED_DEFAULT
+        e_SCHED_MIN          = e_SCHED_OTHER,
+        e_SCHED_MAX          = e_SCHED_DEFAULT
     };
 
   private:
@@ -338,6 +364,11 @@ class ThreadAttributes {
                                             // scheduling policy & priority
                                             // from its parent thread
 
+    int              d_numaNode;            // NUMA node whose processors the
+                                            // thread runs on
+
+    int              d_processorId;         // processor the thread runs on
+
     SchedulingPolicy d_schedulingPolicy;    // policy for scheduling thread
                                             // execution
 
@@ -375,6 +406,8 @@ class ThreadAttributes {
         //: o 'detachedState()      == e_CREATE_JOINABLE'
         //: o 'guardSize()          == e_UNSET_GUARD_SIZE'
         //: o 'inheritSchedule()    == true'
+        //: o 'numaNode()           == e_UNSET_NUMA_NODE'
+        //: o 'processorId()        == e_UNSET_PROCESSOR_ID'
         //: o 'schedulingPolicy()   == e_SCHED_DEFAULT'
         //: o 'schedulingPriority() == e_UNSET_PRIORITY'
         //: o 'stackSize()          == e_UNSET_STACK_SIZE'
@@ -415,6 +448,23 @@ class ThreadAttributes {
         // and ignore the respective values in this object.  See
         // 'bslmt_threadutil' for information about support for this attribute.
 
+    void setNumaNode(int value);
+        // Set the 'numaNode' attribute of this object to the specified
+        // 'value'.  A value other than 'e_UNSET_NUMA_NODE' (the default)
+        // indicates that a thread should run only on the processors of the
+        // NUMA node having the index 'value'.  This attribute is ignored if
+        // the 'processorId' attribute is set.  The behavior is undefined
+        // unless 'e_UNSET_NUMA_NODE == value' or '0 <= value'.  See
+        // 'bslmt_threadutil' for information about support for this attribute.
+
+    void setProcessorId(int value);
+        // Set the 'processorId' attribute of this object to the specified
+        // 'value'.  A value other than 'e_UNSET_PROCESSOR_ID' (the default)
+        // indicates that a thread should run only on the processor having the
+        // index 'value'.  The behavior is undefined unless
+        // 'e_UNSET_PROCESSOR_ID == value' or '0 <= value'.  See
+        // 'bslmt_threadutil' for information about support for this attribute.
+
     void setSchedulingPolicy(SchedulingPolicy value);
         // Set the value of the 'schedulingPolicy' attribute of this object to
         // the specified 'value'.  This attribute is ignored unless
@@ -464,6 +514,17 @@ class ThreadAttributes {
         // respective values in this object.  See 'bslmt_threadutil' for
         // information about support for this attribute.
 
+    int numaNode() const;
+        // Return the value of the 'numaNode' attribute of this object.  A
+        // value other than 'e_UNSET_NUMA_NODE' indicates that a thread should
+        // run only on the processors of the NUMA node having that index,
+        // unless the 'processorId' attribute is set.
+
+    int processorId() const;
+        // Return the value of the 'processorId' attribute of this object.  A
+        // value other than 'e_UNSET_PROCESSOR_ID' indicates that a thread
+        // should run only on the processor having that index.
+
     SchedulingPolicy schedulingPolicy() const;
         // Return the value of the 'schedulingPolicy' attribute of this object.
         // This attribute is ignored unless 'inheritSchedule' is 'false'.  See
@@ -489,15 +550,17 @@ bool operator==(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
     // value, and 'false' otherwise.  Two 'ThreadAttributes' objects have the
     // same value if the corresponding values of their 'detachedState',
-    // 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are the same.
+    // 'guardSize', 'inheritSchedule', 'numaNode', 'processorId',
+    // 'schedulingPolicy', 'schedulingPriority', and 'stackSize' attributes
+    // are the same.
 
 bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
     // same value, and 'false' otherwise.  Two 'baltzo::LocalTimeDescriptor'
     // objects do not have the same value if the corresponding values of their
-    // 'detachedState', 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are not the same.
+    // 'detachedState', 'guardSize', 'inheritSchedule', 'numaNode',
+    // 'processorId', 'schedulingPolicy', 'schedulingPriority', and
+    // 'stackSize' attributes are not the same.
 
 }  // close package namespace
 
@@ -515,6 +578,8 @@ bslmt::ThreadAttributes::ThreadAttributes(const ThreadAttributes& original)
 : d_detachedState(original.d_detachedState)
 , d_guardSize(original.d_guardSize)
 , d_inheritScheduleFlag(original.d_inheritScheduleFlag)
+, d_numaNode(original.d_numaNode)
+, d_processorId(original.d_processorId)
 , d_schedulingPolicy(original.d_schedulingPolicy)
 , d_schedulingPriority(original.d_schedulingPriority)
 , d_stackSize(original.d_stackSize)
@@ -529,6 +594,8 @@ bslmt::ThreadAttributes& bslmt::ThreadAttributes::operator=(
     d_detachedState       = rhs.d_detachedState;
     d_guardSize           = rhs.d_guardSize;
     d_inheritScheduleFlag = rhs.d_inheritScheduleFlag;
+    d_numaNode            = rhs.d_numaNode;
+    d_processorId         = rhs.d_processorId;
     d_schedulingPolicy    = rhs.d_schedulingPolicy;
     d_schedulingPriority  = rhs.d_schedulingPriority;
     d_stackSize           = rhs.d_stackSize;
@@ -562,6 +629,26 @@ void bslmt::ThreadAttributes::setInheritSchedule(bool value)
     d_inheritScheduleFlag = value;
 }
 
+inline
+void bslmt::ThreadAttributes::setNumaNode(int value)
+{
+    BSLMF_ASSERT(-1 == e_UNSET_NUMA_NODE);
+
+    BSLS_ASSERT_SAFE(-1 <= value);
+
+    d_numaNode = value;
+}
+
+inline
+void bslmt::ThreadAttributes::setProcessorId(int value)
+{
+    BSLMF_ASSERT(-1 == e_UNSET_PROCESSOR_ID);
+
+    BSLS_ASSERT_SAFE(-1 <= value);
+
+    d_processorId = value;
+}
+
 inline
 void bslmt::ThreadAttributes::setSchedulingPolicy(
                                       ThreadAttributes::SchedulingPolicy value)
@@ -608,6 +695,18 @@ bool bslmt::ThreadAttributes::inheritSchedule() const
     return d_inheritScheduleFlag;
 }
 
+inline
+int bslmt::ThreadAttributes::numaNode() const
+{
+    return d_numaNode;
+}
+
+inline
+int bslmt::ThreadAttributes::processorId() const
+{
+    return d_processorId;
+}
+
 inline
 bslmt::ThreadAttributes::SchedulingPolicy
 bslmt::ThreadAttributes::schedulingPolicy() const
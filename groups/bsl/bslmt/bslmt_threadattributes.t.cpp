@@ -272,7 +272,7 @@ int main(int argc, char *argv[])
         // ------------------------------------------------------------------
         // Testing Primary Manipulators / Accessors
         //
-        // For each of the 6 attributes of Attribute, set the attribute on a
+        // For each of the 8 attributes of Attribute, set the attribute on a
         // newly constructed object, copy the object, and use the accessor for
         // that attribute to verify the value.
         // ------------------------------------------------------------------
@@ -290,26 +290,32 @@ int main(int argc, char *argv[])
             bool                  d_inheritSchedule;
             int                   d_stackSize;
             int                   d_guardSize;
+            int                   d_processorId;
+            int                   d_numaNode;
 
             int                   d_whichVerify;
         } PARAM[] = {
            {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_OTHER,
-                0, 0, 0, 0, 1 },
+                0, 0, 0, 0, -1, -1, 1 },
            {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO,
-                0, 0, 0, 0, 2 },
+                0, 0, 0, 0, -1, -1, 2 },
            {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO,
-                5, 0, 0, 0, 3 },
+                5, 0, 0, 0, -1, -1, 3 },
            {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO,
-                4, true, 0, 0, 4 },
+                4, true, 0, 0, -1, -1, 4 },
 #ifdef BSLS_PLATFORM_CPU_64_BIT
            {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO,
-                3, 0, 300000, 0, 5 },
+                3, 0, 300000, 0, -1, -1, 5 },
 #else
            {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO,
-                3, 0, 80000, 0, 5 },
+                3, 0, 80000, 0, -1, -1, 5 },
 #endif
            {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO,
-                2, 0, 0, 2000, 6 }
+                2, 0, 0, 2000, -1, -1, 6 },
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO,
+                2, 0, 0, 0, 3, -1, 7 },
+           {L_, Obj::e_CREATE_DETACHED, Obj::e_SCHED_FIFO,
+                2, 0, 0, 0, -1, 1, 8 }
         };
 
         int numParams = sizeof(PARAM) / sizeof(Parameters);
@@ -321,6 +327,8 @@ int main(int argc, char *argv[])
             mX.setInheritSchedule(PARAM[i].d_inheritSchedule);
             mX.setStackSize(PARAM[i].d_stackSize);
             mX.setGuardSize(PARAM[i].d_guardSize);
+            mX.setProcessorId(PARAM[i].d_processorId);
+            mX.setNumaNode(PARAM[i].d_numaNode);
 
             const Obj& X = mX;
 
@@ -359,6 +367,23 @@ int main(int argc, char *argv[])
                 LOOP_ASSERT(PARAM[i].d_line, PARAM[i].d_guardSize ==
                             Y.guardSize());
                 break;
+            case 7:
+                LOOP_ASSERT(PARAM[i].d_line, PARAM[i].d_processorId ==
+                            Y.processorId());
+                break;
+            case 8:
+                LOOP_ASSERT(PARAM[i].d_line, PARAM[i].d_numaNode ==
+                            Y.numaNode());
+                break;
+            }
+
+            if (7 <= PARAM[i].d_whichVerify) {
+                // Each of the new attributes alone distinguishes values.
+
+                Obj mZ(X);
+                mZ.setProcessorId(Obj::e_UNSET_PROCESSOR_ID);
+                mZ.setNumaNode(Obj::e_UNSET_NUMA_NODE);
+                LOOP_ASSERT(PARAM[i].d_line, X != mZ);
             }
         }
       } break;
@@ -383,6 +408,8 @@ int main(int argc, char *argv[])
         ASSERT(Obj::e_SCHED_DEFAULT == X.schedulingPolicy());
         ASSERT(X.inheritSchedule());
         ASSERT(0 != X.stackSize());
+        ASSERT(Obj::e_UNSET_PROCESSOR_ID == X.processorId());
+        ASSERT(Obj::e_UNSET_NUMA_NODE    == X.numaNode());
 
 #if 0
         // 'Imp has been eliminated
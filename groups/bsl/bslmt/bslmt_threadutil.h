@@ -112,6 +112,43 @@ BSLS_IDENT("$Id: $")
 //               'inheritSchedule' are ignored for all clients.
 //..
 //
+///Processor Affinity and NUMA Placement
+///--------------------------------------
+// On machines having multiple NUMA nodes (e.g., multi-socket servers), memory
+// attached to another node is slower to access than local memory.
+// 'bslmt::ThreadUtil' allows clients to restrict newly created threads to a
+// single processor or to the processors of a single NUMA node by setting the
+// 'processorId' or 'numaNode' attribute of a thread attributes object supplied
+// to 'create', and to restrict the current thread using
+// 'bindCurrentThreadToProcessor' and 'bindCurrentThreadToNumaNode'.  The
+// 'numNumaNodes', 'numNumaNodeProcessors', and 'currentNumaNode' methods
+// describe the topology of the machine and the placement of the current
+// thread.  Processors and nodes are identified by the (zero-based) indices
+// used by the operating system.  Note that node indices need not be
+// contiguous, and that a node may have no processors (e.g., a node providing
+// only memory), so a node index less than 'numNumaNodes()' is not necessarily
+// a node to which a thread can be bound.
+//..
+// Platform      Restrictions
+// ------------  --------------------------------------------------------------
+// Linux         None.  Node topology is read from '/sys/devices/system/node';
+//               if it is not available, the machine is treated as having a
+//               single node comprising all processors.
+//
+// Windows       Only the processors of the processor group of the current
+//               process (i.e., at most 64 processors) can be addressed.
+//
+// Other         The 'processorId' and 'numaNode' attributes are ignored, the
+//               'bind*' methods fail, 'numNumaNodes' returns 1,
+//               'numNumaNodeProcessors' returns 0, and 'currentNumaNode'
+//               returns 0.
+//..
+// Thread creation fails if the processor described by the 'processorId'
+// attribute does not exist, or the node described by the 'numaNode' attribute
+// does not exist or has no processors, on a platform that supports affinity.
+// See 'bdlma_numaallocator' for an allocator supplying memory bound to a NUMA
+// node.
+//
 ///Supported Clock-Types
 ///---------------------
 // The component 'bsls::SystemClockType' supplies the enumeration indicating
@@ -567,6 +604,45 @@ struct ThreadUtil {
         // schedule another thread to run.  Note that this allows cooperating
         // threads of the same priority to share CPU resources equally.
 
+                       // *** Processor Placement ***
+
+    static int bindCurrentThreadToNumaNode(int numaNode);
+        // Restrict the current thread to run only on the processors of the
+        // NUMA node having the specified 'numaNode' index.  Return 0 on
+        // success, and a non-zero value if the node does not exist or
+        // processor affinity is not supported on this platform (see
+        // {Processor Affinity and NUMA Placement}).  The behavior is undefined
+        // unless '0 <= numaNode'.
+
+    static int bindCurrentThreadToProcessor(int processorId);
+        // Restrict the current thread to run only on the processor having the
+        // specified 'processorId' index.  Return 0 on success, and a non-zero
+        // value if the processor does not exist or processor affinity is not
+        // supported on this platform (see
+        // {Processor Affinity and NUMA Placement}).  The behavior is undefined
+        // unless '0 <= processorId'.
+
+    static int currentNumaNode();
+        // Return the index of the NUMA node of the processor on which the
+        // current thread is running, or 0 if it cannot be determined.  Note
+        // that, unless the current thread is bound to a single node, the
+        // returned value may be stale by the time it is used.
+
+    static int numNumaNodeProcessors(int numaNode);
+        // Return the number of processors of the NUMA node having the
+        // specified 'numaNode' index, or 0 if the node does not exist, is
+        // offline, has no processors (e.g., a node providing only memory), or
+        // processor affinity is not supported on this platform.  Note that a
+        // thread can be bound to a node only if this method returns a
+        // positive value for that node.  The behavior is undefined unless
+        // '0 <= numaNode'.
+
+    static int numNumaNodes();
+        // Return one more than the highest index of an online NUMA node on
+        // this machine, or 1 if it cannot be determined.  Note that a node
+        // having a lower index may be offline or have no processors (see
+        // 'numNumaNodeProcessors').
+
                        // *** Thread Identification ***
 
     static bool areEqual(const Handle& a, const Handle& b);
@@ -852,6 +928,44 @@ void bslmt::ThreadUtil::yield()
     Imp::yield();
 }
 
+                      // *** Processor Placement ***
+
+inline
+int bslmt::ThreadUtil::bindCurrentThreadToNumaNode(int numaNode)
+{
+    BSLS_ASSERT_SAFE(0 <= numaNode);
+
+    return Imp::bindCurrentThreadToNumaNode(numaNode);
+}
+
+inline
+int bslmt::ThreadUtil::bindCurrentThreadToProcessor(int processorId)
+{
+    BSLS_ASSERT_SAFE(0 <= processorId);
+
+    return Imp::bindCurrentThreadToProcessor(processorId);
+}
+
+inline
+int bslmt::ThreadUtil::currentNumaNode()
+{
+    return Imp::currentNumaNode();
+}
+
+inline
+int bslmt::ThreadUtil::numNumaNodeProcessors(int numaNode)
+{
+    BSLS_ASSERT_SAFE(0 <= numaNode);
+
+    return Imp::numNumaNodeProcessors(numaNode);
+}
+
+inline
+int bslmt::ThreadUtil::numNumaNodes()
+{
+    return Imp::numNumaNodes();
+}
+
                     // *** Thread Identification ***
 
 inline
@@ -36,6 +36,7 @@
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_set.h>
+#include <bsl_vector.h>
 
 #include <errno.h>
 
@@ -120,6 +121,8 @@ bool isPost_5_10;    // On Solairis, is OS post-Solaris 5.0
 #define ASSERT_PASS(expr)      BSLS_ASSERTTEST_ASSERT_PASS(expr)
 #define ASSERT_FAIL_RAW(expr)  BSLS_ASSERTTEST_ASSERT_FAIL_RAW(expr)
 #define ASSERT_PASS_RAW(expr)  BSLS_ASSERTTEST_ASSERT_PASS_RAW(expr)
+#define ASSERT_SAFE_FAIL(expr) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(expr)
+#define ASSERT_SAFE_PASS(expr) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(expr)
 
 #if !defined(BSLS_PLATFORM_OS_CYGWIN)
     const int MIN_GUARD_SIZE = 0;
@@ -1111,6 +1114,52 @@ void testStackSize()
 
 }  // close namespace STACKSIZE_TEST_CASE_NAMESPACE
 
+// ----------------------------------------------------------------------------
+//                                TEST CASE 16
+// ----------------------------------------------------------------------------
+
+namespace PROCESSOR_PLACEMENT_TEST_CASE_NAMESPACE {
+
+struct PlacementRecord {
+    // This 'struct' records the placement observed by a thread running
+    // 'placementTestFunction'.
+
+    int d_bindRc;    // status of binding to the requested node, or 0 if no
+                     // binding was requested
+
+    int d_numaNode;  // node on which the thread was found to be running
+};
+
+extern "C"
+void *placementTestFunction(void *arg)
+    // Record, in the 'PlacementRecord' addressed by the specified 'arg', the
+    // NUMA node on which the calling thread runs, first binding the thread to
+    // the node given by 'd_numaNode' if 'd_bindRc' is non-zero on entry.
+{
+    PlacementRecord *record = static_cast<PlacementRecord *>(arg);
+
+    if (record->d_bindRc) {
+        record->d_bindRc = bslmt::ThreadUtil::bindCurrentThreadToNumaNode(
+                                                           record->d_numaNode);
+    }
+    record->d_numaNode = bslmt::ThreadUtil::currentNumaNode();
+
+    return 0;
+}
+
+extern "C"
+void *bindToProcessorZero(void *arg)
+    // Bind the calling thread to processor 0, and load the status of the
+    // binding into the 'int' addressed by the specified 'arg'.
+{
+    int *rc = static_cast<int *>(arg);
+
+    *rc = bslmt::ThreadUtil::bindCurrentThreadToProcessor(0);
+    return 0;
+}
+
+}  // close namespace PROCESSOR_PLACEMENT_TEST_CASE_NAMESPACE
+
 // ----------------------------------------------------------------------------
 //                                TEST CASE 6
 // ----------------------------------------------------------------------------
@@ -1426,6 +1475,211 @@ int main(int argc, char *argv[])
 #endif
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 16: {
+        // --------------------------------------------------------------------
+        // PROCESSOR PLACEMENT
+        //
+        // Concerns:
+        //: 1 'numNumaNodes' returns a positive value, and 'currentNumaNode'
+        //:   returns a node index less than that value.
+        //:
+        //: 2 'numNumaNodeProcessors' returns 0 for a nonexistent node and, on
+        //:   platforms supporting affinity, a positive value for at least one
+        //:   node.
+        //:
+        //: 3 On platforms supporting affinity, a thread can bind itself to
+        //:   any existing processor or node having processors, and
+        //:   subsequently runs on that node, and binding to a node having no
+        //:   processors fails.
+        //:
+        //: 4 On platforms supporting affinity, a thread created with the
+        //:   'processorId' or 'numaNode' attribute runs on the described
+        //:   node, and thread creation fails if the processor does not exist,
+        //:   or the node does not exist or has no processors.
+        //:
+        //: 5 On other platforms, the 'bind*' methods fail and the placement
+        //:   attributes are ignored.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the values returned by 'numNumaNodes' and
+        //:   'currentNumaNode'.  (C-1)
+        //:
+        //: 2 Verify the values returned by 'numNumaNodeProcessors' for each
+        //:   node, and for a nonexistent node.  (C-2)
+        //:
+        //: 3 For each node, create a thread that binds itself to the node and
+        //:   records the node on which it runs, and verify the recorded
+        //:   values, taking into account whether the node has processors.
+        //:   (C-3, 5)
+        //:
+        //: 4 For each node, create a thread having the 'numaNode' attribute
+        //:   set to the node and verify the node recorded by the thread, or
+        //:   that creation fails if the node has no processors.  Create
+        //:   threads for a nonexistent node and a nonexistent processor, and
+        //:   verify that creation fails exactly on platforms supporting
+        //:   affinity.  (C-4, 5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for negative processor and node indices.  (C-6)
+        //
+        // Testing:
+        //   int bindCurrentThreadToNumaNode(int numaNode);
+        //   int bindCurrentThreadToProcessor(int processorId);
+        //   int currentNumaNode();
+        //   int numNumaNodeProcessors(int numaNode);
+        //   int numNumaNodes();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PROCESSOR PLACEMENT\n"
+                             "===================\n";
+
+        using namespace PROCESSOR_PLACEMENT_TEST_CASE_NAMESPACE;
+
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_WINDOWS)
+        const bool AFFINITY = true;
+#else
+        const bool AFFINITY = false;
+#endif
+
+        const int NUM_NODES = Obj::numNumaNodes();
+        if (veryVerbose) { P_(AFFINITY) P(NUM_NODES) }
+
+        ASSERT(1 <= NUM_NODES);
+        ASSERT(0 <= Obj::currentNumaNode());
+        ASSERT(     Obj::currentNumaNode() < NUM_NODES);
+
+        if (verbose) cout << "Counting the processors of each node.\n";
+
+        // A node may have no processors (e.g., a node providing only memory),
+        // and binding to such a node fails.
+
+        bsl::vector<bool> hasProcessors(NUM_NODES);
+        int               numNodesWithProcessors = 0;
+
+        for (int node = 0; node < NUM_NODES; ++node) {
+            const int NUM_PROCESSORS = Obj::numNumaNodeProcessors(node);
+            if (veryVerbose) { P_(node) P(NUM_PROCESSORS) }
+
+            ASSERTV(node, NUM_PROCESSORS, 0 <= NUM_PROCESSORS);
+            ASSERTV(node, NUM_PROCESSORS, AFFINITY || 0 == NUM_PROCESSORS);
+
+            hasProcessors[node] = 0 < NUM_PROCESSORS;
+            numNodesWithProcessors += hasProcessors[node];
+        }
+        ASSERTV(numNodesWithProcessors,
+                !AFFINITY || 0 < numNodesWithProcessors);
+        ASSERT(0 == Obj::numNumaNodeProcessors(NUM_NODES + 10));
+
+        if (verbose) cout << "Binding the current thread.\n";
+
+        for (int node = 0; node < NUM_NODES; ++node) {
+            PlacementRecord record = { 1, node };
+
+            Obj::Handle handle;
+            ASSERTV(node, 0 == Obj::create(&handle,
+                                           &placementTestFunction,
+                                           &record));
+            ASSERTV(node, 0 == Obj::join(handle));
+
+            ASSERTV(node, record.d_bindRc,
+                    hasProcessors[node] == (0 == record.d_bindRc));
+            if (AFFINITY && 0 == record.d_bindRc) {
+                ASSERTV(node, record.d_numaNode, node == record.d_numaNode);
+            }
+        }
+
+        {
+            PlacementRecord record = { 1, NUM_NODES + 10 };
+
+            Obj::Handle handle;
+            ASSERT(0 == Obj::create(&handle, &placementTestFunction, &record));
+            ASSERT(0 == Obj::join(handle));
+
+            ASSERTV(record.d_bindRc, 0 != record.d_bindRc);
+        }
+
+        {
+            // Binding to processor 0 is always possible where affinity is
+            // supported, as the test driver is not expected to run with a
+            // restricted affinity mask.
+
+            int rc = -1;
+
+            Obj::Handle handle;
+            ASSERT(0 == Obj::create(&handle, &bindToProcessorZero, &rc));
+            ASSERT(0 == Obj::join(handle));
+
+            ASSERTV(rc, AFFINITY == (0 == rc));
+        }
+
+        if (verbose) cout << "Creating threads with placement attributes.\n";
+
+        for (int node = 0; node < NUM_NODES; ++node) {
+            bslmt::ThreadAttributes attr;
+            attr.setNumaNode(node);
+
+            PlacementRecord record = { 0, -1 };
+
+            Obj::Handle handle;
+            int rc = Obj::create(&handle,
+                                 attr,
+                                 &placementTestFunction,
+                                 &record);
+            ASSERTV(node, rc, (AFFINITY && !hasProcessors[node]) == (0 != rc));
+            if (0 == rc) {
+                ASSERTV(node, 0 == Obj::join(handle));
+
+                if (AFFINITY) {
+                    ASSERTV(node, record.d_numaNode,
+                            node == record.d_numaNode);
+                }
+            }
+        }
+
+        {
+            bslmt::ThreadAttributes attr;
+            attr.setNumaNode(NUM_NODES + 10);
+
+            PlacementRecord record = { 0, -1 };
+
+            Obj::Handle handle;
+            int rc = Obj::create(&handle,
+                                 attr,
+                                 &placementTestFunction,
+                                 &record);
+            ASSERTV(rc, AFFINITY == (0 != rc));
+            if (0 == rc) {
+                ASSERT(0 == Obj::join(handle));
+            }
+        }
+
+        {
+            bslmt::ThreadAttributes attr;
+            attr.setProcessorId(1 << 20);
+
+            PlacementRecord record = { 0, -1 };
+
+            Obj::Handle handle;
+            int rc = Obj::create(&handle,
+                                 attr,
+                                 &placementTestFunction,
+                                 &record);
+            ASSERTV(rc, AFFINITY == (0 != rc));
+            if (0 == rc) {
+                ASSERT(0 == Obj::join(handle));
+            }
+        }
+
+        if (verbose) cout << "Negative testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_FAIL(Obj::bindCurrentThreadToNumaNode(-1));
+            ASSERT_SAFE_FAIL(Obj::bindCurrentThreadToProcessor(-1));
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // CREATE ALLOCATION TEST
@@ -25,6 +25,7 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 #include <bsls_atomicoperations.h>
 #include <bsls_platform.h>
 
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>
@@ -41,6 +42,10 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 # include <mach/clock.h>   // clock_sleep
 #elif defined(BSLS_PLATFORM_OS_SOLARIS)
 # include <sys/utsname.h>
+#elif defined(BSLS_PLATFORM_OS_LINUX)
+# include <sched.h>        // cpu_set_t, sched_getaffinity
+# include <sys/syscall.h>  // SYS_getcpu
+# include <unistd.h>       // syscall
 #endif
 
 #include <errno.h>         // constant 'EINTR'
@@ -71,6 +76,88 @@ int localPthreadsPolicy(int policy)
     BSLS_ASSERT_OPT(0);
 }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+static int loadNumaNodeCpuSet(cpu_set_t *result, int numaNode)
+    // Load into the specified 'result' the set of processors belonging to the
+    // NUMA node having the specified 'numaNode' index, as described by the
+    // 'cpulist' file of that node in 'sysfs'.  Return 0 on success, and a
+    // non-zero value if the node does not exist or its processors cannot be
+    // determined.  Note that, if the kernel does not expose NUMA topology,
+    // node 0 is taken to comprise all processors.
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= numaNode);
+
+    CPU_ZERO(result);
+
+    char path[64];
+    bsl::sprintf(path, "/sys/devices/system/node/node%d/cpulist", numaNode);
+
+    bsl::FILE *file = bsl::fopen(path, "r");
+    if (!file) {
+        if (0 != numaNode) {
+            return -1;                                                // RETURN
+        }
+        return sched_getaffinity(0, sizeof *result, result);          // RETURN
+    }
+
+    // The 'cpulist' format is a comma-separated list of decimal processor
+    // indices and inclusive ranges of indices, e.g., "0-7,16-23".
+
+    char  buffer[1024];
+    char *line = bsl::fgets(buffer, sizeof buffer, file);
+    bsl::fclose(file);
+
+    if (!line) {
+        return -1;                                                    // RETURN
+    }
+
+    int numCpus = 0;
+    while (*line >= '0' && *line <= '9') {
+        char *end;
+        int   first = static_cast<int>(bsl::strtol(line, &end, 10));
+        int   last  = first;
+        if ('-' == *end) {
+            last = static_cast<int>(bsl::strtol(end + 1, &end, 10));
+        }
+        for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu) {
+            CPU_SET(cpu, result);
+            ++numCpus;
+        }
+        line = ',' == *end ? end + 1 : end;
+    }
+
+    return 0 < numCpus ? 0 : -1;
+}
+
+static int loadAffinityCpuSet(cpu_set_t *result,
+                              int        processorId,
+                              int        numaNode)
+    // Load into the specified 'result' the set of processors described by the
+    // specified 'processorId' or, if 'processorId' is unset, by the specified
+    // 'numaNode'.  Return 0 on success, and a non-zero value otherwise.  The
+    // behavior is undefined unless at least one of 'processorId' and
+    // 'numaNode' is set.
+{
+    typedef bslmt::ThreadAttributes Attr;
+
+    if (Attr::e_UNSET_PROCESSOR_ID != processorId) {
+        if (processorId >= CPU_SETSIZE) {
+            return -1;                                                // RETURN
+        }
+        CPU_ZERO(result);
+        CPU_SET(processorId, result);
+        return 0;                                                     // RETURN
+    }
+
+    BSLS_ASSERT(Attr::e_UNSET_NUMA_NODE != numaNode);
+
+    return loadNumaNodeCpuSet(result, numaNode);
+}
+
+#endif  // defined(BSLS_PLATFORM_OS_LINUX)
+
 static int initPthreadAttribute(pthread_attr_t                 *destination,
                                 const bslmt::ThreadAttributes&  src)
     // Initialize the specified pthreads attribute type 'destination',
@@ -164,6 +251,22 @@ static int initPthreadAttribute(pthread_attr_t                 *destination,
         rc |= pthread_attr_setstacksize(destination, stackSize);
     }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (Attr::e_UNSET_PROCESSOR_ID != src.processorId()
+     || Attr::e_UNSET_NUMA_NODE    != src.numaNode()) {
+        cpu_set_t cpuSet;
+        int       affinityRc = loadAffinityCpuSet(&cpuSet,
+                                                  src.processorId(),
+                                                  src.numaNode());
+        if (0 == affinityRc) {
+            affinityRc = pthread_attr_setaffinity_np(destination,
+                                                     sizeof cpuSet,
+                                                     &cpuSet);
+        }
+        rc |= affinityRc;
+    }
+#endif
+
     return rc;
 }
 
@@ -236,6 +339,113 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::create(
     return rc;
 }
 
+                     // *** Processor Placement ***
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::
+                                      bindCurrentThreadToNumaNode(int numaNode)
+{
+    BSLS_ASSERT(0 <= numaNode);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t cpuSet;
+    if (0 != loadNumaNodeCpuSet(&cpuSet, numaNode)) {
+        return -1;                                                    // RETURN
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof cpuSet, &cpuSet);
+#else
+    return -1;
+#endif
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::
+                                  bindCurrentThreadToProcessor(int processorId)
+{
+    BSLS_ASSERT(0 <= processorId);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    if (processorId >= CPU_SETSIZE) {
+        return -1;                                                    // RETURN
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(processorId, &cpuSet);
+    return pthread_setaffinity_np(pthread_self(), sizeof cpuSet, &cpuSet);
+#else
+    return -1;
+#endif
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::currentNumaNode()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_getcpu)
+    unsigned int cpu  = 0;
+    unsigned int node = 0;
+    if (0 == syscall(SYS_getcpu, &cpu, &node, 0)) {
+        return static_cast<int>(node);                                // RETURN
+    }
+#endif
+    return 0;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::
+                                            numNumaNodeProcessors(int numaNode)
+{
+    BSLS_ASSERT(0 <= numaNode);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t cpuSet;
+    if (0 != loadNumaNodeCpuSet(&cpuSet, numaNode)) {
+        return 0;                                                     // RETURN
+    }
+    return CPU_COUNT(&cpuSet);
+#else
+    return 0;
+#endif
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::numNumaNodes()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // The topology cannot change while the process runs, so it is computed
+    // once and cached.  Racing initializations compute the same value.
+
+    static bsls::AtomicOperations::AtomicTypes::Int s_numNodes = { 0 };
+
+    int numNodes = bsls::AtomicOperations::getIntRelaxed(&s_numNodes);
+    if (0 == numNodes) {
+        numNodes = 1;
+
+        // The 'online' file lists the indices of the online nodes, e.g.,
+        // "0-1".  Note that the 'possible' file also lists nodes that are
+        // offline, which have no processors.
+
+        bsl::FILE *file = bsl::fopen("/sys/devices/system/node/online", "r");
+        if (file) {
+            char  buffer[256];
+            char *line = bsl::fgets(buffer, sizeof buffer, file);
+            bsl::fclose(file);
+
+            while (line && *line >= '0' && *line <= '9') {
+                char *end;
+                int   last = static_cast<int>(bsl::strtol(line, &end, 10));
+                if ('-' == *end) {
+                    last = static_cast<int>(bsl::strtol(end + 1, &end, 10));
+                }
+                if (last + 1 > numNodes) {
+                    numNodes = last + 1;
+                }
+                line = ',' == *end ? end + 1 : 0;
+            }
+        }
+        bsls::AtomicOperations::setIntRelaxed(&s_numNodes, numNodes);
+    }
+    return numNodes;
+#else
+    return 1;
+#endif
+}
+
                 // *** Thread Priorities ***
 
 int bslmt::ThreadUtilImpl<bslmt::Platform::PosixThreads>::
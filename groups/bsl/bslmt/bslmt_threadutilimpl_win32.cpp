@@ -305,6 +305,34 @@ static void invokeDestructors()
     LeaveCriticalSection(&s_threadSpecificDestructorsListLock);
 }
 
+static int loadAffinityMask(DWORD_PTR *result,
+                            int        processorId,
+                            int        numaNode)
+    // Load into the specified 'result' the mask of processors described by
+    // the specified 'processorId' or, if 'processorId' is unset, by the
+    // specified 'numaNode'.  Return 0 on success, and a non-zero value
+    // otherwise.  The behavior is undefined unless at least one of
+    // 'processorId' and 'numaNode' is set.  Note that only the processors of
+    // the calling process's processor group can be described.
+{
+    if (bslmt::ThreadAttributes::e_UNSET_PROCESSOR_ID != processorId) {
+        if (processorId >= static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+            return -1;                                                // RETURN
+        }
+        *result = static_cast<DWORD_PTR>(1) << processorId;
+        return 0;                                                     // RETURN
+    }
+
+    ULONGLONG mask = 0;
+    if (numaNode > 0xFF
+     || !GetNumaNodeProcessorMask(static_cast<UCHAR>(numaNode), &mask)
+     || 0 == mask) {
+        return -1;                                                    // RETURN
+    }
+    *result = static_cast<DWORD_PTR>(mask);
+    return 0;
+}
+
 static unsigned _stdcall ThreadEntry(void *arg)
     // This function is the entry point for all BCE thread functions.
 {
@@ -352,6 +380,16 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::create(
         return 1;                                                     // RETURN
     }
 
+    DWORD_PTR affinityMask = 0;
+    if (ThreadAttributes::e_UNSET_PROCESSOR_ID != attribute.processorId()
+     || ThreadAttributes::e_UNSET_NUMA_NODE    != attribute.numaNode()) {
+        if (0 != loadAffinityMask(&affinityMask,
+                                  attribute.processorId(),
+                                  attribute.numaNode())) {
+            return 1;                                                 // RETURN
+        }
+    }
+
     ThreadStartupInfo *startInfo = allocStartupInfo();
 
     int stackSize = attribute.stackSize();
@@ -382,6 +420,9 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::create(
         freeStartupInfo(startInfo);
         return 1;                                                     // RETURN
     }
+    if (affinityMask) {
+        SetThreadAffinityMask(handle->d_handle, affinityMask);
+    }
     if (ThreadAttributes::e_CREATE_DETACHED ==
                                                    attribute.detachedState()) {
         HANDLE tmpHandle = handle->d_handle;
@@ -397,6 +438,74 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::create(
     return 0;
 }
 
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::
+                                      bindCurrentThreadToNumaNode(int numaNode)
+{
+    BSLS_ASSERT(0 <= numaNode);
+
+    DWORD_PTR mask;
+    if (0 != loadAffinityMask(&mask,
+                              ThreadAttributes::e_UNSET_PROCESSOR_ID,
+                              numaNode)) {
+        return -1;                                                    // RETURN
+    }
+    return 0 != SetThreadAffinityMask(GetCurrentThread(), mask) ? 0 : -1;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::
+                                  bindCurrentThreadToProcessor(int processorId)
+{
+    BSLS_ASSERT(0 <= processorId);
+
+    DWORD_PTR mask;
+    if (0 != loadAffinityMask(&mask,
+                              processorId,
+                              ThreadAttributes::e_UNSET_NUMA_NODE)) {
+        return -1;                                                    // RETURN
+    }
+    return 0 != SetThreadAffinityMask(GetCurrentThread(), mask) ? 0 : -1;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::currentNumaNode()
+{
+    UCHAR node = 0;
+    if (!GetNumaProcessorNode(
+                           static_cast<UCHAR>(GetCurrentProcessorNumber()),
+                           &node)
+     || 0xFF == node) {
+        return 0;                                                     // RETURN
+    }
+    return node;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::
+                                            numNumaNodeProcessors(int numaNode)
+{
+    BSLS_ASSERT(0 <= numaNode);
+
+    DWORD_PTR mask;
+    if (0 != loadAffinityMask(&mask,
+                              ThreadAttributes::e_UNSET_PROCESSOR_ID,
+                              numaNode)) {
+        return 0;                                                     // RETURN
+    }
+
+    int numProcessors = 0;
+    for (; mask; mask &= mask - 1) {
+        ++numProcessors;
+    }
+    return numProcessors;
+}
+
+int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::numNumaNodes()
+{
+    ULONG highestNode = 0;
+    if (!GetNumaHighestNodeNumber(&highestNode)) {
+        return 1;                                                     // RETURN
+    }
+    return static_cast<int>(highestNode) + 1;
+}
+
 int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::join(
                                                               Handle&   handle,
                                                               void    **status)
@@ -233,6 +233,35 @@ struct ThreadUtilImpl<Platform::Win32Threads> {
         // schedule another thread to run.  This allows cooperating threads of
         // the same priority to share CPU resources equally.
 
+                       // *** Processor Placement ***
+
+    static int bindCurrentThreadToNumaNode(int numaNode);
+        // Restrict the current thread to run only on the processors of the
+        // NUMA node having the specified 'numaNode' index.  Return 0 on
+        // success, and a non-zero value if the node does not exist.  The
+        // behavior is undefined unless '0 <= numaNode'.
+
+    static int bindCurrentThreadToProcessor(int processorId);
+        // Restrict the current thread to run only on the processor having the
+        // specified 'processorId' index within the processor group of the
+        // current process.  Return 0 on success, and a non-zero value if the
+        // processor does not exist.  The behavior is undefined unless
+        // '0 <= processorId'.
+
+    static int currentNumaNode();
+        // Return the index of the NUMA node of the processor on which the
+        // current thread is running, or 0 if it cannot be determined.
+
+    static int numNumaNodeProcessors(int numaNode);
+        // Return the number of processors of the NUMA node having the
+        // specified 'numaNode' index, or 0 if the node does not exist, is
+        // offline, or has no processors.  The behavior is undefined unless
+        // '0 <= numaNode'.
+
+    static int numNumaNodes();
+        // Return one more than the highest index of an online NUMA node on
+        // this machine, or 1 if it cannot be determined.
+
     static void sleep(const bsls::TimeInterval& sleepTime);
         // Suspend execution of the current thread for a period of at least the
         // specified 'sleepTime' (relative time).  Note that the actual time
@@ -17,7 +17,10 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component implements a mechanism, 'BidirectionalNodePool',
 // that creates and destroys 'bslalg::BidirectionalListNode' objects holding
 // objects of a (template parameter) type 'VALUE' for use in hash-table-based
-// containers.
+// containers.  An optional third template parameter, 'NODE', selects a node
+// type derived from 'bslalg::BidirectionalNode<VALUE>' to be created instead
+// (e.g., 'bslalg::HashedBidirectionalNode<VALUE>', which additionally stores a
+// hash code).
 //
 // A 'BidirectionalNodePool' uses a memory pool provided by the
 // 'bslstl_simplepool' component in its implementation to provide memory for
@@ -221,13 +224,17 @@ namespace bslstl {
                        // class BidirectionalNodePool
                        // ===========================
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE,
+          class ALLOCATOR,
+          class NODE = bslalg::BidirectionalNode<VALUE> >
 class BidirectionalNodePool {
     // This class provides methods for creating and destroying nodes using the
     // appropriate allocator-traits of the (template parameter) type
-    // 'ALLOCATOR'.
+    // 'ALLOCATOR'.  The nodes are of the (template parameter) type 'NODE',
+    // which must be 'bslalg::BidirectionalNode<VALUE>' or a POD-like type
+    // derived from it (e.g., 'bslalg::HashedBidirectionalNode<VALUE>').
 
-    typedef SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>       Pool;
+    typedef SimplePool<NODE, ALLOCATOR>                                   Pool;
         // This 'typedef' is an alias for the memory pool allocator.
 
     typedef typename Pool::AllocatorTraits AllocatorTraits;
@@ -260,10 +267,10 @@ class BidirectionalNodePool {
 
     // ~BidirectionalNodePool() = default;
         // Destroy the memory pool maintained by this object, releasing all
-        // memory used by the nodes of the type 'BidirectionalNode<VALUE>' in
-        // the pool.  Any memory allocated for the nodes' 'value' attribute of
-        // the (template parameter) type 'VALUE' will be leaked unless the
-        // nodes are explicitly destroyed via the 'destroyNode' method.
+        // memory used by the nodes of the type 'NODE' in the pool.  Any memory
+        // allocated for the nodes' 'value' attribute of the (template
+        // parameter) type 'VALUE' will be leaked unless the nodes are
+        // explicitly destroyed via the 'destroyNode' method.
 
     // MANIPULATORS
     AllocatorType& allocator();
@@ -275,46 +282,44 @@ class BidirectionalNodePool {
         // allocator.
 
     bslalg::BidirectionalLink *createNode();
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and default
-        // construct an object of the (template parameter) type 'VALUE' at the
-        // 'value' attribute of the node.  Return the address of the Node.
-        // Note that the 'next' and 'prev' attributes of the returned node will
-        // be uninitialized.
+        // Allocate a node of the type 'NODE', and default construct an object
+        // of the (template parameter) type 'VALUE' at the 'value' attribute of
+        // the node.  Return the address of the Node.  Note that the 'next' and
+        // 'prev' attributes of the returned node will be uninitialized.
 
     template <class SOURCE>
     bslalg::BidirectionalLink *createNode(const SOURCE& value);
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
-        // construct an object of the (template parameter) type 'VALUE', using
-        // its single-argument constructor passing the specified 'value' as the
-        // argument, at the 'value' attribute of the node.  Return the address
-        // of the node.  Note that the 'next' and 'prev' attributes of the
-        // returned node will be uninitialized.
+        // Allocate a node of the type 'NODE', and construct an object of the
+        // (template parameter) type 'VALUE', using its single-argument
+        // constructor passing the specified 'value' as the argument, at the
+        // 'value' attribute of the node.  Return the address of the node.
+        // Note that the 'next' and 'prev' attributes of the returned node will
+        // be uninitialized.
 
     template <class FIRST_ARG, class SECOND_ARG>
     bslalg::BidirectionalLink *createNode(const FIRST_ARG&  first,
                                           const SECOND_ARG& second);
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
-        // construct an object of the (template parameter) type 'VALUE', using
-        // its two-arguments constructor passing the specified 'first' as the
-        // first argument and the specified 'second' as the second argument, at
-        // the 'value' attribute of the node.  Return the address of the node.
-        // Note that the 'next' and 'prev' attributes of the returned node will
-        // be uninitialized.
-
-    bslalg::BidirectionalLink *cloneNode(
-                                    const bslalg::BidirectionalLink& original);
-        // Allocate a node of the type 'BidirectionalNode<VALUE>', and
-        // copy-construct an object of the (template parameter) type 'VALUE'
-        // having the same value as the specified 'original' at the 'value'
+        // Allocate a node of the type 'NODE', and construct an object of the
+        // (template parameter) type 'VALUE', using its two-arguments
+        // constructor passing the specified 'first' as the first argument and
+        // the specified 'second' as the second argument, at the 'value'
         // attribute of the node.  Return the address of the node.  Note that
         // the 'next' and 'prev' attributes of the returned node will be
         // uninitialized.
 
+    bslalg::BidirectionalLink *cloneNode(
+                                    const bslalg::BidirectionalLink& original);
+        // Allocate a node of the type 'NODE', and copy-construct an object of
+        // the (template parameter) type 'VALUE' having the same value as the
+        // specified 'original' at the 'value' attribute of the node.  Return
+        // the address of the node.  Note that the 'next' and 'prev' attributes
+        // of the returned node will be uninitialized.
+
     void deleteNode(bslalg::BidirectionalLink *linkNode);
         // Destroy the 'VALUE' attribute of the specified 'linkNode' and return
         // the memory footprint of 'linkNode' to this pool for potential reuse.
-        // The behavior is undefined unless 'node' refers to a
-        // 'bslalg::BidirectionalNode<VALUE>' that was allocated by this pool.
+        // The behavior is undefined unless 'node' refers to a 'NODE' that was
+        // allocated by this pool.
 
     void reserveNodes(size_type numNodes);
         // Reserve memory from this pool to satisfy memory requests for at
@@ -341,9 +346,9 @@ class BidirectionalNodePool {
 };
 
 // FREE FUNCTIONS
-template <class VALUE, class ALLOCATOR>
-void swap(BidirectionalNodePool<VALUE, ALLOCATOR>& a,
-          BidirectionalNodePool<VALUE, ALLOCATOR>& b);
+template <class VALUE, class ALLOCATOR, class NODE>
+void swap(BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& a,
+          BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& b);
         // Efficiently exchange the nodes of the specified 'a' object with
         // those of the specified 'b' object.  This method provides the
         // no-throw exception-safety guarantee.  The behavior is undefined
@@ -361,8 +366,9 @@ void swap(BidirectionalNodePool<VALUE, ALLOCATOR>& a,
 
 namespace bslmf {
 
-template <class VALUE, class ALLOCATOR>
-struct IsBitwiseMoveable<bslstl::BidirectionalNodePool<VALUE, ALLOCATOR> >
+template <class VALUE, class ALLOCATOR, class NODE>
+struct IsBitwiseMoveable<
+                       bslstl::BidirectionalNodePool<VALUE, ALLOCATOR, NODE> >
 : bsl::integral_constant<bool, bslmf::IsBitwiseMoveable<ALLOCATOR>::value>
 {};
 
@@ -375,30 +381,30 @@ struct IsBitwiseMoveable<bslstl::BidirectionalNodePool<VALUE, ALLOCATOR> >
 namespace bslstl {
 
 // CREATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-BidirectionalNodePool<VALUE, ALLOCATOR>::BidirectionalNodePool(
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::BidirectionalNodePool(
                                                     const ALLOCATOR& allocator)
 : d_pool(allocator)
 {
 }
 
 // MANIPULATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-typename SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>::
+typename SimplePool<NODE, ALLOCATOR>::
                                                                  AllocatorType&
-BidirectionalNodePool<VALUE, ALLOCATOR>::allocator()
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::allocator()
 {
     return d_pool.allocator();
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::createNode()
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNode()
 {
-    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -408,13 +414,13 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode()
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 template <class SOURCE>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const SOURCE& value)
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNode(const SOURCE& value)
 {
-    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -424,14 +430,15 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const SOURCE& value)
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 template <class FIRST_ARG, class SECOND_ARG>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const FIRST_ARG&  first,
-                                                    const SECOND_ARG& second)
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::createNode(
+                                                     const FIRST_ARG&  first,
+                                                     const SECOND_ARG& second)
 {
-    bslalg::BidirectionalNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -442,74 +449,74 @@ BidirectionalNodePool<VALUE, ALLOCATOR>::createNode(const FIRST_ARG&  first,
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
 bslalg::BidirectionalLink *
-BidirectionalNodePool<VALUE, ALLOCATOR>::cloneNode(
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::cloneNode(
                                      const bslalg::BidirectionalLink& original)
 {
     return createNode(static_cast<const bslalg::BidirectionalNode<VALUE>&>
                                                            (original).value());
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::deleteNode(
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::deleteNode(
                                            bslalg::BidirectionalLink *linkNode)
 {
     BSLS_ASSERT(linkNode);
 
-    bslalg::BidirectionalNode<VALUE> *node =
-                     static_cast<bslalg::BidirectionalNode<VALUE> *>(linkNode);
+    NODE *node = static_cast<NODE *>(linkNode);
     AllocatorTraits::destroy(allocator(),
                              bsls::Util::addressOf(node->value()));
     d_pool.deallocate(node);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::reserveNodes(
+                                                            size_type numNodes)
 {
     BSLS_ASSERT_SAFE(0 < numNodes);
 
     d_pool.reserve(numNodes);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::swapRetainAllocators(
-                                BidirectionalNodePool<VALUE, ALLOCATOR>& other)
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::swapRetainAllocators(
+                          BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& other)
 {
     BSLS_ASSERT_SAFE(allocator() == other.allocator());
 
     d_pool.quickSwapRetainAllocators(other.d_pool);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void BidirectionalNodePool<VALUE, ALLOCATOR>::swapExchangeAllocators(
-                                BidirectionalNodePool<VALUE, ALLOCATOR>& other)
+void BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::swapExchangeAllocators(
+                          BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& other)
 {
     d_pool.quickSwapExchangeAllocators(other.d_pool);
 }
 
 // ACCESSORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
 const typename
-              SimplePool<bslalg::BidirectionalNode<VALUE>, ALLOCATOR>::
+              SimplePool<NODE, ALLOCATOR>::
                                                                  AllocatorType&
-BidirectionalNodePool<VALUE, ALLOCATOR>::allocator() const
+BidirectionalNodePool<VALUE, ALLOCATOR, NODE>::allocator() const
 {
     return d_pool.allocator();
 }
 
 }  // close package namespace
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void bslstl::swap(bslstl::BidirectionalNodePool<VALUE, ALLOCATOR>& a,
-                  bslstl::BidirectionalNodePool<VALUE, ALLOCATOR>& b)
+void bslstl::swap(bslstl::BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& a,
+                  bslstl::BidirectionalNodePool<VALUE, ALLOCATOR, NODE>& b)
 {
     a.swapRetainAllocators(b);
 }
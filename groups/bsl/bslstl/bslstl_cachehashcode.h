@@ -0,0 +1,147 @@
+// bslstl_cachehashcode.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_CACHEHASHCODE
+#define INCLUDED_BSLSTL_CACHEHASHCODE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a trait to store hash codes in the nodes of hash tables.
+//
+//@CLASSES:
+//  bslstl::CacheHashCode<HASHER>: trait detection metafunction
+//
+//@SEE_ALSO: bslstl_hashtable, bslalg_hashedbidirectionalnode
+//
+//@DESCRIPTION: This component defines a metafunction, 'bslstl::CacheHashCode',
+// that may be used to associate a hash functor type with the cache-hash-code
+// trait, and also to detect whether a hash functor type has been associated
+// with that trait.  A 'bslstl::HashTable' (and therefore each of the
+// unordered containers, such as 'bsl::unordered_map', that are implemented
+// using it) whose hash functor has the trait stores, in each node, the hash
+// code of the element held by the node (see 'bslalg_hashedbidirectionalnode').
+// Such a table:
+//
+//: o never invokes the hash functor when it grows (rehashes), or when it
+//:   erases an element,
+//:
+//: o compares the hash code of each candidate element with that of the key
+//:   being sought before comparing the keys themselves, and
+//:
+//: o uses one more 'std::size_t' of memory per element.
+//
+// The trait is worth declaring for hash functors that are expensive to
+// evaluate, or whose keys are expensive to compare, such as hash functors on
+// long strings.  It is not associated with any type by default, so the node
+// layout of existing containers is unchanged.
+//
+// The trait may be associated with a hash functor type either by specializing
+// 'bslstl::CacheHashCode' to derive from 'bsl::true_type', or by declaring it
+// as a nested trait of the hash functor:
+//..
+//  BSLMF_NESTED_TRAIT_DECLARATION(MyHasher, bslstl::CacheHashCode);
+//..
+// Note that the hash codes stored in the nodes of a table remain those
+// computed when each element was inserted, so the trait must not be declared
+// for hash functors whose result for a given key may change over the lifetime
+// of a table (which would violate the requirements of the unordered
+// containers in any case).
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Caching the Hash Codes of Long Strings
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a hash functor for strings that hashes every character of
+// the string, and we use it to key an unordered map whose keys are long
+// strings (e.g., file paths).  Every time the map grows, each key would be
+// rehashed, so we associate the 'bslstl::CacheHashCode' trait with the
+// functor.
+//
+// First, we define the hash functor, declaring the trait:
+//..
+//  struct PathHash {
+//      // This 'struct' provides a hash functor for the null-terminated
+//      // strings used as paths.
+//
+//      BSLMF_NESTED_TRAIT_DECLARATION(PathHash, bslstl::CacheHashCode);
+//
+//      // ACCESSORS
+//      native_std::size_t operator()(const char *path) const
+//          // Return the hash code of the specified 'path'.
+//      {
+//          native_std::size_t result = 5381;
+//          while (*path) {
+//              result = result * 33 + static_cast<unsigned char>(*path++);
+//          }
+//          return result;
+//      }
+//  };
+//..
+// Then, we observe that the trait is associated with 'PathHash', and is not
+// associated with other hash functors by default:
+//..
+//  assert(true  == bslstl::CacheHashCode<PathHash>::value);
+//  assert(false == bslstl::CacheHashCode<bsl::hash<int> >::value);
+//..
+// Now, a hash table instantiated with 'PathHash' will store the hash code of
+// each path in its nodes, and will not invoke 'PathHash' again for an element
+// once it has been inserted.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_DETECTNESTEDTRAIT
+#include <bslmf_detectnestedtrait.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                            // ====================
+                            // struct CacheHashCode
+                            // ====================
+
+template <class HASHER>
+struct CacheHashCode
+    : bslmf::DetectNestedTrait<HASHER, CacheHashCode>::type {
+    // This metafunction is derived from 'true_type' if a hash table using a
+    // hash functor of the (template parameter) type 'HASHER' should store the
+    // hash code of each of its elements, and from 'false_type' otherwise.
+    // This trait must be explicitly associated with a type (by specialization
+    // or a nested trait declaration) for this metafunction to return 'true'.
+};
+
+template <class HASHER>
+struct CacheHashCode<const HASHER> : CacheHashCode<HASHER>::type {
+    // This specialization associates the same trait with 'const HASHER' as
+    // with unqualified 'HASHER'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,274 @@
+// bslstl_cachehashcode.t.cpp                                         -*-C++-*-
+#include <bslstl_cachehashcode.h>
+
+#include <bslstl_hash.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stddef.h>     // 'size_t'
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a metafunction that determines whether a
+// hash functor type is associated with the cache-hash-code trait.  We verify
+// that the trait is not associated with any type by default, and that it can
+// be associated with a type by specialization or by a nested trait
+// declaration.
+//-----------------------------------------------------------------------------
+// [ 1] bslstl::CacheHashCode::value
+// ----------------------------------------------------------------------------
+// [ 2] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct PlainHasher {
+    // This 'struct' provides a hash functor with which the trait is not
+    // associated.
+
+    size_t operator()(int value) const { return value; }
+};
+
+struct NestedHasher {
+    // This 'struct' provides a hash functor with which the trait is associated
+    // by a nested trait declaration.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(NestedHasher, bslstl::CacheHashCode);
+
+    size_t operator()(int value) const { return value; }
+};
+
+struct SpecializedHasher {
+    // This 'struct' provides a hash functor with which the trait is associated
+    // by specialization.
+
+    size_t operator()(int value) const { return value; }
+};
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <>
+struct CacheHashCode<SpecializedHasher> : bsl::true_type {
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Caching the Hash Codes of Long Strings
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a hash functor for strings that hashes every character of
+// the string, and we use it to key an unordered map whose keys are long
+// strings (e.g., file paths).  Every time the map grows, each key would be
+// rehashed, so we associate the 'bslstl::CacheHashCode' trait with the
+// functor.
+//
+// First, we define the hash functor, declaring the trait:
+//..
+    struct PathHash {
+        // This 'struct' provides a hash functor for the null-terminated
+        // strings used as paths.
+
+        BSLMF_NESTED_TRAIT_DECLARATION(PathHash, bslstl::CacheHashCode);
+
+        // ACCESSORS
+        native_std::size_t operator()(const char *path) const
+            // Return the hash code of the specified 'path'.
+        {
+            native_std::size_t result = 5381;
+            while (*path) {
+                result = result * 33 + static_cast<unsigned char>(*path++);
+            }
+            return result;
+        }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    (void)veryVerbose;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we observe that the trait is associated with 'PathHash', and is not
+// associated with other hash functors by default:
+//..
+    ASSERT(true  == bslstl::CacheHashCode<PathHash>::value);
+    ASSERT(false == bslstl::CacheHashCode<bsl::hash<int> >::value);
+//..
+// Now, a hash table instantiated with 'PathHash' will store the hash code of
+// each path in its nodes, and will not invoke 'PathHash' again for an element
+// once it has been inserted.
+
+        ASSERT(5381 * 33 + 'a' == PathHash()("a"));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // 'bslstl::CacheHashCode::value'
+        //
+        // Concerns:
+        //: 1 The trait is not associated with any type by default, including
+        //:   the standard hash functors, function pointers, and fundamental
+        //:   types.
+        //:
+        //: 2 The trait can be associated with a type by a nested trait
+        //:   declaration.
+        //:
+        //: 3 The trait can be associated with a type by specialization.
+        //:
+        //: 4 The trait associated with a 'const'-qualified type is that of
+        //:   the unqualified type.
+        //:
+        //: 5 The metafunction derives from 'bsl::true_type' or
+        //:   'bsl::false_type'.
+        //
+        // Plan:
+        //: 1 Verify the value of the metafunction for a variety of types with
+        //:   and without the trait, both unqualified and 'const'-qualified.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify that a pointer to an instance of the metafunction converts
+        //:   to a pointer to the expected base.  (C-5)
+        //
+        // Testing:
+        //   bslstl::CacheHashCode::value
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'bslstl::CacheHashCode::value'"
+                            "\n==============================\n");
+
+        typedef size_t   Function(int);
+        typedef size_t (*FunctionPtr)(int);
+
+        ASSERT(!bslstl::CacheHashCode<int>::value);
+        ASSERT(!bslstl::CacheHashCode<Function>::value);
+        ASSERT(!bslstl::CacheHashCode<FunctionPtr>::value);
+        ASSERT(!bslstl::CacheHashCode<bsl::hash<int> >::value);
+        ASSERT(!bslstl::CacheHashCode<bsl::hash<const char *> >::value);
+        ASSERT(!bslstl::CacheHashCode<PlainHasher>::value);
+        ASSERT(!bslstl::CacheHashCode<const PlainHasher>::value);
+
+        ASSERT( bslstl::CacheHashCode<NestedHasher>::value);
+        ASSERT( bslstl::CacheHashCode<const NestedHasher>::value);
+
+        ASSERT( bslstl::CacheHashCode<SpecializedHasher>::value);
+        ASSERT( bslstl::CacheHashCode<const SpecializedHasher>::value);
+
+        const bsl::false_type *f =
+                                 (bslstl::CacheHashCode<PlainHasher> *) 0;
+        const bsl::true_type  *t =
+                                 (bslstl::CacheHashCode<NestedHasher> *) 0;
+        (void)f;
+        (void)t;
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,7 +12,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bslstl_Deque: standard-compliant 'bsl::deque' implementation
 //
-//@SEE_ALSO: bslstl_vector, bsl+stlhdrs
+//@SEE_ALSO: bslstl_vector, bslstl_dequeblockbytes, bslstl_dequesegmentutil,
+//           bsl+stlhdrs
 //
 //@DESCRIPTION: This component is for internal use only.  Please include
 // '<bsl_deque.h>' instead and use 'bsl::deque' directly.  This component
@@ -20,6 +21,19 @@ BSLS_IDENT("$Id: $")
 // 'bslma::Allocator' model and is suitable for use as an implementation of the
 // 'bsl::deque' class template.
 //
+///Block Size
+///----------
+// A 'bsl::deque' stores its elements in a sequence of fixed-size blocks.  By
+// default each block holds 200 bytes' worth of elements, but never fewer than
+// 16 elements.  The number of bytes per block may be configured for a
+// particular element type by specializing 'bslstl::DequeBlockBytes' (see
+// 'bslstl_dequeblockbytes'); this does not change the signature of
+// 'bsl::deque'.  A range specified by random-access iterators is appended to
+// a deque (by the range constructor, 'assign', or 'insert' at 'end') one block
+// at a time, copying elements of a bitwise copyable type with 'memcpy' when
+// the range is specified by pointers, and 'bslstl_dequesegmentutil' provides
+// algorithms that similarly process a range of a deque one block at a time.
+//
 ///Exceptional Behavior
 ///--------------------
 // Since this component is below the BSL STL, we centralize all the exceptional
@@ -166,6 +180,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_DEQUEBLOCKBYTES
+#include <bslstl_dequeblockbytes.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_ITERATOR
 #include <bslstl_iterator.h>
 #endif
@@ -178,6 +196,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_stdexceptutil.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_CONTAINERBASE
 #include <bslalg_containerbase.h>
 #endif
@@ -272,12 +294,15 @@ class Deque_Guard;
 template <class VALUE_TYPE>
 struct Deque_BlockLengthCalcUtil {
     // This 'struct' provides a namespace for the calculation of block length
-    // (the number of elements per block within a 'deque').  This ensures that
-    // each block in the deque can hold at least 16 elements.
+    // (the number of elements per block within a 'deque') from the number of
+    // bytes per block configured by 'bslstl::DequeBlockBytes'.  This ensures
+    // that each block in the deque can hold at least 16 elements.
 
     // TYPES
     enum {
-        DEFAULT_BLOCK_SIZE = 200,  // number of bytes per block
+        DEFAULT_BLOCK_SIZE = BloombergLP::bslstl::DequeBlockBytes<
+                                                           VALUE_TYPE>::value,
+                                   // number of bytes per block
         BLOCK_LENGTH       = (16 * sizeof(VALUE_TYPE) >= DEFAULT_BLOCK_SIZE)
                              ? 16
                              : (DEFAULT_BLOCK_SIZE / sizeof(VALUE_TYPE))
@@ -1129,6 +1154,10 @@ class Deque_Guard {
     std::size_t operator--();
         // Decrement the count of this guard, and return new count.
 
+    std::size_t operator+=(std::size_t numElements);
+        // Increment the count of this guard by the specified 'numElements',
+        // and return new count.
+
     void release();
         // Set the count of this tail guard to zero.  Note that this guard
         // destructor will do nothing if count is not incremented again after
@@ -1404,24 +1433,35 @@ deque<VALUE_TYPE,ALLOCATOR>::privateAppend(
                                 "deque<...>::insert(pos,n,v): deque too long");
     }
 
-    for ( ; first != last; ++first) {
-        IteratorImp insertPoint = guard.end();
+    // Since the number of elements is known, allocate all of the new blocks
+    // up front, then copy the elements one block-sized segment at a time,
+    // which lets 'bslalg::ArrayPrimitives' use 'memcpy' when 'INPUT_ITER' is
+    // a pointer to a bitwise copyable 'VALUE_TYPE'.  Note that the guard is
+    // incremented only after each segment is copied: 'copyConstruct' destroys
+    // the elements of a partially copied segment if an exception is thrown.
 
-        // There must be room for the iterator to be incremented.  Allocate new
-        // block now if necessary.  We cannot wait until after the new element
-        // is constructed or else we won't be able to increment the guard right
-        // away and there will be a window where an exception will cause a
-        // resource leak.
+    const size_type numNewBlocks = (this->d_finish.offsetInBlock()
+                                                + numElements) / BLOCK_LENGTH;
+    newBlocks.insertAtBack(numNewBlocks);
 
-        if (1 == insertPoint.remainingInBlock()) {
-            newBlocks.insertAtBack(1);
-            insertPoint = guard.end();  // 'insertAtBack(1)' invalidated iter
+    size_type remaining = numElements;
+    while (remaining) {
+        IteratorImp insertPoint   = guard.end();
+        size_type   segmentLength = insertPoint.remainingInBlock();
+        if (segmentLength > remaining) {
+            segmentLength = remaining;
         }
-        BloombergLP::bslalg::ScalarPrimitives::copyConstruct(
-                                             BSLS_UTIL_ADDRESSOF(*insertPoint),
-                                             *first,
-                                             this->bslmaAllocator());
-        ++guard;
+        INPUT_ITER segmentEnd = first;
+        bsl::advance(segmentEnd, segmentLength);
+
+        BloombergLP::bslalg::ArrayPrimitives::copyConstruct(
+                                                     insertPoint.valuePtr(),
+                                                     first,
+                                                     segmentEnd,
+                                                     this->bslmaAllocator());
+        guard += segmentLength;
+        first      = segmentEnd;
+        remaining -= segmentLength;
     }
 
     this->d_finish += guard.count();
@@ -1560,16 +1600,19 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateInsertDispatch(
         return;                                                       // RETURN
     }
 
-    if (position == this->cbegin()) {
-        privatePrepend(first, last, Tag());
-        return;                                                       // RETURN
-    }
+    // Test for 'end' first, so that a range inserted into an empty deque
+    // (e.g., by the range constructor) is appended.
 
     if (position == this->cend()) {
         privateAppend(first, last, Tag());
         return;                                                       // RETURN
     }
 
+    if (position == this->cbegin()) {
+        privatePrepend(first, last, Tag());
+        return;                                                       // RETURN
+    }
+
     privateInsert(position, first, last, Tag());
 }
 
@@ -1804,13 +1847,13 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateInsert(
 {
     BSLS_ASSERT(first != last);
 
-    if (position == this->cbegin()) {
-        privatePrepend(first, last, tag);
+    if (position == this->cend()) {
+        privateAppend(first, last, tag);
         return;                                                       // RETURN
     }
 
-    if (position == this->cend()) {
-        privateAppend(first, last, tag);
+    if (position == this->cbegin()) {
+        privatePrepend(first, last, tag);
         return;                                                       // RETURN
     }
 
@@ -2966,6 +3009,14 @@ std::size_t Deque_Guard<VALUE_TYPE, ALLOCATOR>::operator--()
     return --d_count;
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+std::size_t
+Deque_Guard<VALUE_TYPE, ALLOCATOR>::operator+=(std::size_t numElements)
+{
+    return d_count += numElements;
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 inline
 void Deque_Guard<VALUE_TYPE, ALLOCATOR>::release()
@@ -147,6 +147,8 @@ using namespace bsl;
 // [11] ALLOCATOR-RELATED CONCERNS
 // [18] USAGE EXAMPLE
 // [22] CONCERN: 'std::length_error' is used properly
+// [27] CONCERN: block size is configured by 'bslstl::DequeBlockBytes'
+// [27] CONCERN: range append constructs elements one block at a time
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(deque<T,A> *object, const char *spec, int vF = 1);
@@ -1266,6 +1268,36 @@ struct IsBitwiseMoveable<LimitAllocator<ALLOCATOR> >
 
 }  // close enterprise namespace
 
+struct LargeBlockElement {
+    // This 'struct' provides an element type for which the number of bytes per
+    // deque block is configured to be larger than the default.
+
+    int d_value;
+};
+
+struct SmallBlockElement {
+    // This 'struct' provides an element type for which the number of bytes per
+    // deque block is configured to be smaller than 16 elements.
+
+    int d_value;
+};
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <>
+struct DequeBlockBytes<LargeBlockElement>
+    : bsl::integral_constant<std::size_t, 1024> {
+};
+
+template <>
+struct DequeBlockBytes<SmallBlockElement>
+    : bsl::integral_constant<std::size_t, 8> {
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
 //=============================================================================
 //                       TEST DRIVER TEMPLATE
 //-----------------------------------------------------------------------------
@@ -7916,6 +7948,181 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCK SIZE AND SEGMENTED RANGE APPEND
+        //
+        // Concerns:
+        //: 1 The number of elements per block is 200 bytes' worth of elements
+        //:   (but at least 16) unless 'bslstl::DequeBlockBytes' is
+        //:   specialized for the element type.
+        //:
+        //: 2 A specialization of 'bslstl::DequeBlockBytes' changes the number
+        //:   of elements per block (but never below 16), and a deque of such
+        //:   elements allocates correspondingly fewer (or more) blocks.
+        //:
+        //: 3 Appending a random-access range at the back of a deque, starting
+        //:   at any offset within the last block, and spanning any number of
+        //:   blocks, copies each element of the range in order.
+        //:
+        //: 4 If the copy of an element of the range throws, the deque is left
+        //:   unchanged and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Verify the block length of deques of types with and without a
+        //:   specialization of the trait.  (C-1..2)
+        //:
+        //: 2 Push many elements into deques of 'int' and 'LargeBlockElement'
+        //:   (which have the same size), and compare the number of blocks
+        //:   allocated by a test allocator.  (C-2)
+        //:
+        //: 3 For deques of 'int' and of 'bsl::string', and for a set of
+        //:   initial lengths and range lengths around multiples of the block
+        //:   length, append a range using 'insert' at 'end', the range
+        //:   constructor, and 'assign', and verify the resulting values.
+        //:   (C-3)
+        //:
+        //: 4 Repeat P-3 for 'bsl::string' values that allocate memory, in the
+        //:   presence of injected exceptions.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: block size is configured by 'bslstl::DequeBlockBytes'
+        //   CONCERN: range append constructs elements one block at a time
+        // --------------------------------------------------------------------
+
+        if (verbose)
+                  printf("\nTESTING BLOCK SIZE AND SEGMENTED RANGE APPEND"
+                         "\n=============================================\n");
+
+        if (verbose) printf("\nVerify the block length.\n");
+        {
+            ASSERT(200 == Deque_BlockLengthCalcUtil<char>::BLOCK_LENGTH);
+            ASSERT( 50 == Deque_BlockLengthCalcUtil<int>::BLOCK_LENGTH);
+            ASSERT( 16 == Deque_BlockLengthCalcUtil<L>::BLOCK_LENGTH);
+
+            ASSERT(256 ==
+                  Deque_BlockLengthCalcUtil<LargeBlockElement>::BLOCK_LENGTH);
+            ASSERT( 16 ==
+                  Deque_BlockLengthCalcUtil<SmallBlockElement>::BLOCK_LENGTH);
+        }
+
+        if (verbose) printf("\nCompare the number of blocks allocated.\n");
+        {
+            const int NUM_ELEMENTS = 256 * 16;
+
+            bslma::TestAllocator ta("int", veryVeryVeryVerbose);
+            bslma::TestAllocator tb("large block", veryVeryVeryVerbose);
+            {
+                bsl::deque<int>               mX(&ta);
+                bsl::deque<LargeBlockElement> mY(&tb);
+
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    const LargeBlockElement E = { i };
+                    mX.push_back(i);
+                    mY.push_back(E);
+                }
+                for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                    LOOP_ASSERT(i, i == mX[i]);
+                    LOOP_ASSERT(i, i == mY[i].d_value);
+                }
+
+                // Each deque allocates one block per 'BLOCK_LENGTH' elements,
+                // plus a few allocations of its array of block pointers.
+
+                if (veryVerbose) {
+                    P_(ta.numAllocations()); P(tb.numAllocations());
+                }
+                LOOP_ASSERT(ta.numAllocations(),
+                            NUM_ELEMENTS / 50 < ta.numAllocations());
+                LOOP_ASSERT(tb.numAllocations(),
+                            NUM_ELEMENTS / 256 < tb.numAllocations());
+                LOOP_ASSERT(tb.numAllocations(),
+                            NUM_ELEMENTS / 256 + 8 > tb.numAllocations());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == tb.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nAppend random-access ranges.\n");
+        {
+            const int LENGTHS[] = { 0, 1, 2, 15, 16, 17, 49, 50, 51, 99, 100,
+                                    101, 199, 200, 201, 250 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            int         intSource[250];
+            bsl::string strSource[250];
+            for (int i = 0; i < 250; ++i) {
+                intSource[i] = i + 1000;
+                strSource[i].assign(
+                             "a string long enough to allocate memory #", 41);
+                strSource[i].push_back(static_cast<char>('0' + i % 10));
+            }
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int INIT = LENGTHS[ti];
+                for (int tj = 0; tj < NUM_LENGTHS; ++tj) {
+                    const int LENGTH = LENGTHS[tj];
+
+                    // Integers, from a pointer range (bitwise copy).
+
+                    bsl::deque<int> mX(&ta);  const bsl::deque<int>& X = mX;
+                    for (int i = 0; i < INIT; ++i) {
+                        mX.push_back(i);
+                    }
+                    mX.insert(mX.end(), intSource, intSource + LENGTH);
+                    LOOP2_ASSERT(INIT, LENGTH,
+                               static_cast<size_t>(INIT + LENGTH) == X.size());
+                    for (int i = 0; i < INIT; ++i) {
+                        LOOP3_ASSERT(INIT, LENGTH, i, i == X[i]);
+                    }
+                    for (int i = 0; i < LENGTH; ++i) {
+                        LOOP3_ASSERT(INIT, LENGTH, i,
+                                     intSource[i] == X[INIT + i]);
+                    }
+
+                    // Integers, from a deque range (element-wise copy).
+
+                    bsl::deque<int> mY(X.begin(), X.end(), &ta);
+                    LOOP2_ASSERT(INIT, LENGTH, X == mY);
+
+                    mY.assign(intSource, intSource + LENGTH);
+                    LOOP2_ASSERT(INIT, LENGTH,
+                                 static_cast<size_t>(LENGTH) == mY.size());
+                    LOOP2_ASSERT(INIT, LENGTH,
+                            0 == LENGTH || intSource[LENGTH - 1] == mY.back());
+
+                    // Strings, in the presence of exceptions.
+
+                    bsl::deque<bsl::string> mZ(&ta);
+                    const bsl::deque<bsl::string>& Z = mZ;
+                    for (int i = 0; i < INIT; ++i) {
+                        mZ.push_back(strSource[i % 10]);
+                    }
+
+                    BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                        LOOP2_ASSERT(INIT, LENGTH,
+                                     static_cast<size_t>(INIT) == Z.size());
+
+                        mZ.insert(mZ.end(), strSource, strSource + LENGTH);
+                    } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                    LOOP2_ASSERT(INIT, LENGTH,
+                               static_cast<size_t>(INIT + LENGTH) == Z.size());
+                    for (int i = 0; i < INIT; ++i) {
+                        LOOP3_ASSERT(INIT, LENGTH, i,
+                                     strSource[i % 10] == Z[i]);
+                    }
+                    for (int i = 0; i < LENGTH; ++i) {
+                        LOOP3_ASSERT(INIT, LENGTH, i,
+                                     strSource[i] == Z[INIT + i]);
+                    }
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
@@ -0,0 +1,143 @@
+// bslstl_dequeblockbytes.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLSTL_DEQUEBLOCKBYTES
+#define INCLUDED_BSLSTL_DEQUEBLOCKBYTES
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a trait to configure the block size of 'bsl::deque'.
+//
+//@CLASSES:
+//  bslstl::DequeBlockBytes<VALUE_TYPE>: number of bytes per deque block
+//
+//@SEE_ALSO: bslstl_deque, bslstl_dequesegmentutil
+//
+//@DESCRIPTION: This component defines a metafunction,
+// 'bslstl::DequeBlockBytes', whose 'value' is the target number of bytes in
+// each of the blocks in which a 'bsl::deque' of the (template parameter) type
+// 'VALUE_TYPE' stores its elements.  The number of elements per block of a
+// 'bsl::deque<VALUE_TYPE>' is 'DequeBlockBytes<VALUE_TYPE>::value /
+// sizeof(VALUE_TYPE)', except that each block always holds at least 16
+// elements.  By default, 'value' is 200 for every type, which is the block
+// size 'bsl::deque' has always used.
+//
+// The block size is a trade-off: larger blocks mean fewer block allocations,
+// fewer block-boundary checks during iteration, and longer contiguous runs of
+// elements for the block-wise algorithms of 'bslstl_dequesegmentutil', at the
+// cost of more memory held by a short or sparsely-filled deque.  The default
+// size is small for deques of small elements that are pushed and traversed in
+// bulk (e.g., 'char' or 'int'), for which a larger block size may be
+// configured by specializing 'bslstl::DequeBlockBytes' to derive from
+// 'bsl::integral_constant<std::size_t, N>':
+//..
+//  namespace BloombergLP {
+//  namespace bslstl {
+//
+//  template <>
+//  struct DequeBlockBytes<char> : bsl::integral_constant<std::size_t, 4096> {
+//  };
+//
+//  }  // close package namespace
+//  }  // close enterprise namespace
+//..
+// The block size is part of the layout of a 'bsl::deque', so a specialization
+// must be visible in every translation unit that instantiates the deque
+// (preferably by declaring it in the same header as 'VALUE_TYPE' itself), and
+// must not be changed once deques of the type are exchanged between separately
+// compiled code.  Note that the block size is deliberately not a template or
+// constructor parameter of 'bsl::deque', whose signature must remain that of
+// 'std::deque'.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Using Larger Blocks for a Deque of Small Records
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we buffer market ticks, each represented by a small 'struct', in a
+// 'bsl::deque', and that ticks arrive (and are consumed) in bursts of
+// thousands.  With the default block size, a deque of 16-byte ticks allocates
+// a new block every 16 elements, so we configure a larger block size.
+//
+// First, we define the tick type:
+//..
+//  struct Tick {
+//      // This 'struct' describes the price and quantity of a trade.
+//
+//      // DATA
+//      double d_price;     // trade price
+//      int    d_quantity;  // number of shares
+//  };
+//..
+// Then, we specialize 'bslstl::DequeBlockBytes' for 'Tick' (at namespace
+// scope, immediately after the definition of 'Tick'):
+//..
+//  namespace BloombergLP {
+//  namespace bslstl {
+//
+//  template <>
+//  struct DequeBlockBytes<Tick> : bsl::integral_constant<std::size_t, 4096> {
+//      // Store 'Tick' objects in 4K blocks.
+//  };
+//
+//  }  // close package namespace
+//  }  // close enterprise namespace
+//..
+// Finally, we observe the configured block size, and that of a type for which
+// the trait has not been specialized:
+//..
+//  assert(4096 == bslstl::DequeBlockBytes<Tick>::value);
+//  assert( 200 == bslstl::DequeBlockBytes<int>::value);
+//..
+// A 'bsl::deque<Tick>' now stores 256 ticks in each of its blocks.
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                           // ======================
+                           // struct DequeBlockBytes
+                           // ======================
+
+template <class VALUE_TYPE>
+struct DequeBlockBytes : bsl::integral_constant<std::size_t, 200> {
+    // This metafunction provides, as 'value', the target number of bytes in
+    // each block of a 'bsl::deque' of the (template parameter) type
+    // 'VALUE_TYPE'.  This trait may be specialized for a particular
+    // 'VALUE_TYPE' to configure the block size of deques of that type.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,248 @@
+// bslstl_dequeblockbytes.t.cpp                                       -*-C++-*-
+#include <bslstl_dequeblockbytes.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stddef.h>     // 'size_t'
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a metafunction providing the number of
+// bytes per block of a 'bsl::deque'.  We verify the default value, and that
+// the value can be configured for a type by specialization without affecting
+// other types.  The effect of the trait on the layout of 'bsl::deque' is
+// tested in the test driver of 'bslstl_deque'.
+//-----------------------------------------------------------------------------
+// [ 1] bslstl::DequeBlockBytes::value
+// ----------------------------------------------------------------------------
+// [ 2] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct PlainType {
+    // This 'struct' provides a type for which the trait is not specialized.
+
+    int d_data;
+};
+
+struct LargeBlockType {
+    // This 'struct' provides a type for which the trait is specialized.
+
+    int d_data;
+};
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <>
+struct DequeBlockBytes<LargeBlockType>
+    : bsl::integral_constant<std::size_t, 1024> {
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Using Larger Blocks for a Deque of Small Records
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we buffer market ticks, each represented by a small 'struct', in a
+// 'bsl::deque', and that ticks arrive (and are consumed) in bursts of
+// thousands.  With the default block size, a deque of 16-byte ticks allocates
+// a new block every 16 elements, so we configure a larger block size.
+//
+// First, we define the tick type:
+//..
+    struct Tick {
+        // This 'struct' describes the price and quantity of a trade.
+
+        // DATA
+        double d_price;     // trade price
+        int    d_quantity;  // number of shares
+    };
+//..
+// Then, we specialize 'bslstl::DequeBlockBytes' for 'Tick' (at namespace
+// scope, immediately after the definition of 'Tick'):
+//..
+    namespace BloombergLP {
+    namespace bslstl {
+
+    template <>
+    struct DequeBlockBytes<Tick> : bsl::integral_constant<std::size_t, 4096> {
+        // Store 'Tick' objects in 4K blocks.
+    };
+
+    }  // close package namespace
+    }  // close enterprise namespace
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    (void)veryVerbose;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Finally, we observe the configured block size, and that of a type for which
+// the trait has not been specialized:
+//..
+    ASSERT(4096 == bslstl::DequeBlockBytes<Tick>::value);
+    ASSERT( 200 == bslstl::DequeBlockBytes<int>::value);
+//..
+// A 'bsl::deque<Tick>' now stores 256 ticks in each of its blocks.
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // 'bslstl::DequeBlockBytes::value'
+        //
+        // Concerns:
+        //: 1 The value is 200 for every type by default, including
+        //:   fundamental, pointer, and user-defined types.
+        //:
+        //: 2 The value can be configured for a type by specialization.
+        //:
+        //: 3 Specializing the trait for one type does not affect the value for
+        //:   other types.
+        //:
+        //: 4 The value is a compile-time constant of type 'std::size_t'.
+        //
+        // Plan:
+        //: 1 Verify the value of the metafunction for a variety of types with
+        //:   and without a specialization.  (C-1..3)
+        //:
+        //: 2 Use the value as an array bound, and verify that a pointer to an
+        //:   instance of the metafunction converts to a pointer to the
+        //:   expected 'bsl::integral_constant'.  (C-4)
+        //
+        // Testing:
+        //   bslstl::DequeBlockBytes::value
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'bslstl::DequeBlockBytes::value'"
+                            "\n================================\n");
+
+        ASSERT(200 == bslstl::DequeBlockBytes<char>::value);
+        ASSERT(200 == bslstl::DequeBlockBytes<int>::value);
+        ASSERT(200 == bslstl::DequeBlockBytes<double>::value);
+        ASSERT(200 == bslstl::DequeBlockBytes<void *>::value);
+        ASSERT(200 == bslstl::DequeBlockBytes<PlainType>::value);
+
+        ASSERT(1024 == bslstl::DequeBlockBytes<LargeBlockType>::value);
+
+        char buffer[bslstl::DequeBlockBytes<LargeBlockType>::value];
+        ASSERT(1024 == sizeof buffer);
+
+        const bsl::integral_constant<std::size_t, 200> *d =
+                                     (bslstl::DequeBlockBytes<PlainType> *) 0;
+        const bsl::integral_constant<std::size_t, 1024> *s =
+                                (bslstl::DequeBlockBytes<LargeBlockType> *) 0;
+        (void)d;
+        (void)s;
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
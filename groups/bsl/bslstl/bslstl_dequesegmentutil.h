@@ -0,0 +1,383 @@
+// bslstl_dequesegmentutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLSTL_DEQUESEGMENTUTIL
+#define INCLUDED_BSLSTL_DEQUESEGMENTUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide algorithms processing a deque range one block at a time.
+//
+//@CLASSES:
+//  bslstl::DequeSegmentUtil: namespace for segmented deque algorithms
+//
+//@SEE_ALSO: bslstl_deque, bslstl_dequeblockbytes, bslalg_dequeiterator
+//
+//@DESCRIPTION: This component provides a namespace, 'DequeSegmentUtil', for
+// algorithms ('forEach', 'copy', and 'find') that operate on a range of
+// elements of a 'bsl::deque', specified by a pair of iterators, with the same
+// effect as the standard algorithms of the same names.  A deque stores its
+// elements in a sequence of fixed-size blocks (see 'bslstl_dequeblockbytes'),
+// and each increment of a deque iterator must check whether the iterator has
+// reached the end of its block.  The algorithms of this component instead
+// split the range into *segments*, the maximal contiguous runs of elements
+// within a block, and process each segment using plain pointers, so that
+// block boundaries are checked once per block rather than once per element.
+// In particular:
+//
+//: o 'forEach' invokes a visitor on each element in a tight loop that the
+//:   compiler can unroll or vectorize,
+//:
+//: o 'copy' invokes 'native_std::copy' on each segment, which copies elements
+//:   of a bitwise copyable type to a contiguous output range using 'memmove',
+//:   and
+//:
+//: o 'find' invokes 'native_std::find' on each segment.
+//
+// In addition, 'forEachSegment' provides the segments themselves to a
+// visitor, as pairs of pointers, for operations that can process a contiguous
+// array of elements in bulk (e.g., writing them to a stream).
+//
+// The iterators supplied to each algorithm must be 'iterator' or
+// 'const_iterator' objects of (the same) 'bsl::deque', and (as for the
+// standard algorithms) the behavior is undefined unless they specify a valid
+// range.  Note that appending a random-access range to a 'bsl::deque' (using
+// its range constructor, 'assign', or 'insert' at 'end') already copies the
+// range one block at a time.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Processing a Queue of Prices
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we buffer the prices of trades in a 'bsl::deque', and periodically
+// need to compute statistics on the buffered prices, to look for a specific
+// price, and to take a snapshot of the prices in a contiguous array.
+//
+// First, we define a visitor that accumulates the sum of the values it is
+// invoked on:
+//..
+//  struct SumVisitor {
+//      // This 'struct' accumulates the sum of the values it visits.
+//
+//      // DATA
+//      double d_sum;  // sum of the values visited so far
+//
+//      // CREATORS
+//      SumVisitor() : d_sum(0) {}
+//          // Create a visitor having a sum of 0.
+//
+//      // MANIPULATORS
+//      void operator()(double value)
+//          // Add the specified 'value' to the sum.
+//      {
+//          d_sum += value;
+//      }
+//  };
+//..
+// Then, we fill a deque with prices (spanning many blocks of the deque):
+//..
+//  bsl::deque<double> prices;
+//  for (int i = 0; i < 1000; ++i) {
+//      prices.push_back(100.0 + i % 7);
+//  }
+//..
+// Next, we compute the sum of the prices, one block at a time:
+//..
+//  SumVisitor sum = bslstl::DequeSegmentUtil::forEach(prices.begin(),
+//                                                     prices.end(),
+//                                                     SumVisitor());
+//  assert(102997.0 == sum.d_sum);
+//..
+// Then, we look for the first price of 106:
+//..
+//  bsl::deque<double>::const_iterator it =
+//               bslstl::DequeSegmentUtil::find(prices.cbegin(),
+//                                              prices.cend(),
+//                                              106.0);
+//  assert(prices.cend() != it);
+//  assert(6 == it - prices.cbegin());
+//..
+// Finally, we copy the last 500 prices into an array:
+//..
+//  double snapshot[500];
+//  double *end = bslstl::DequeSegmentUtil::copy(prices.end() - 500,
+//                                               prices.end(),
+//                                               snapshot);
+//  assert(snapshot + 500 == end);
+//  assert(prices[500] == snapshot[0]);
+//  assert(prices[999] == snapshot[499]);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_RANDOMACCESSITERATOR
+#include <bslstl_randomaccessiterator.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_DEQUEITERATOR
+#include <bslalg_dequeiterator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // =======================
+                          // struct DequeSegmentUtil
+                          // =======================
+
+struct DequeSegmentUtil {
+    // This 'struct' provides a namespace for algorithms on ranges of elements
+    // of a 'bsl::deque' that process each contiguous segment of the range
+    // (i.e., the part of the range within one block of the deque) using
+    // pointers.  In each function, 'ELEMENT_TYPE' is the 'value_type' of the
+    // deque, 'const'-qualified for 'const_iterator' arguments.
+
+    // CLASS METHODS
+    template <class ELEMENT_TYPE,
+              class VALUE_TYPE,
+              int   BLOCK_LENGTH,
+              class OUTPUT_ITERATOR>
+    static OUTPUT_ITERATOR copy(
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& first,
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& last,
+        OUTPUT_ITERATOR                                                result);
+        // Assign the elements in the specified range '[first .. last)' of a
+        // deque, in order, to the output range starting at the specified
+        // 'result', and return an iterator to the end of the output range.
+        // The behavior is undefined unless 'first' and 'last' are iterators
+        // into the same deque, 'first <= last', and the output range does not
+        // overlap '[first .. last)'.
+
+    template <class ELEMENT_TYPE,
+              class VALUE_TYPE,
+              int   BLOCK_LENGTH,
+              class VALUE>
+    static
+    RandomAccessIterator<ELEMENT_TYPE,
+                         bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >
+    find(const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& first,
+         const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& last,
+         const VALUE&                                                  value);
+        // Return an iterator to the first element in the specified range
+        // '[first .. last)' of a deque that compares equal to the specified
+        // 'value', or 'last' if there is no such element.  The behavior is
+        // undefined unless 'first' and 'last' are iterators into the same
+        // deque, and 'first <= last'.
+
+    template <class ELEMENT_TYPE,
+              class VALUE_TYPE,
+              int   BLOCK_LENGTH,
+              class VISITOR>
+    static VISITOR forEach(
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& first,
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& last,
+        VISITOR                                                       visitor);
+        // Invoke the specified 'visitor' on each element in the specified
+        // range '[first .. last)' of a deque, in order, and return (a copy of)
+        // 'visitor' after it has visited the last element.  'visitor' must be
+        // invocable as 'visitor(e)' for an lvalue 'e' of type 'ELEMENT_TYPE'.
+        // The behavior is undefined unless 'first' and 'last' are iterators
+        // into the same deque, and 'first <= last'.
+
+    template <class ELEMENT_TYPE,
+              class VALUE_TYPE,
+              int   BLOCK_LENGTH,
+              class VISITOR>
+    static VISITOR forEachSegment(
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& first,
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& last,
+        VISITOR                                                       visitor);
+        // Invoke the specified 'visitor' on each non-empty segment of the
+        // specified range '[first .. last)' of a deque, in order, and return
+        // (a copy of) 'visitor' after it has visited the last segment.  Each
+        // segment is the maximal contiguous subrange of '[first .. last)'
+        // within one block of the deque, and is supplied to 'visitor' as
+        // 'visitor(begin, end)', where 'begin' and 'end' are pointers to
+        // 'ELEMENT_TYPE' specifying the segment '[begin .. end)'.  The
+        // behavior is undefined unless 'first' and 'last' are iterators into
+        // the same deque, and 'first <= last'.
+};
+
+// ============================================================================
+//                      TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // struct DequeSegmentUtil
+                          // -----------------------
+
+// CLASS METHODS
+template <class ELEMENT_TYPE,
+          class VALUE_TYPE,
+          int   BLOCK_LENGTH,
+          class OUTPUT_ITERATOR>
+OUTPUT_ITERATOR DequeSegmentUtil::copy(
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& first,
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& last,
+        OUTPUT_ITERATOR                                                result)
+{
+    BSLS_ASSERT_SAFE(!(last < first));
+
+    bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH>       position =
+                                                                  first.imp();
+    const bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH>& end = last.imp();
+
+    while (position.blockPtr() != end.blockPtr()) {
+        const ELEMENT_TYPE *segmentBegin = position.valuePtr();
+        const ELEMENT_TYPE *segmentEnd   = position.blockEnd();
+        result = native_std::copy(segmentBegin, segmentEnd, result);
+        position.nextBlock();
+    }
+
+    const ELEMENT_TYPE *segmentBegin = position.valuePtr();
+    const ELEMENT_TYPE *segmentEnd   = end.valuePtr();
+    return native_std::copy(segmentBegin, segmentEnd, result);
+}
+
+template <class ELEMENT_TYPE,
+          class VALUE_TYPE,
+          int   BLOCK_LENGTH,
+          class VALUE>
+RandomAccessIterator<ELEMENT_TYPE,
+                     bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >
+DequeSegmentUtil::find(
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& first,
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& last,
+        const VALUE&                                                   value)
+{
+    BSLS_ASSERT_SAFE(!(last < first));
+
+    typedef bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> IteratorImp;
+
+    IteratorImp        position = first.imp();
+    const IteratorImp& end      = last.imp();
+
+    while (position.blockPtr() != end.blockPtr()) {
+        VALUE_TYPE *segmentEnd = position.blockEnd();
+        VALUE_TYPE *found      = native_std::find(position.valuePtr(),
+                                                  segmentEnd,
+                                                  value);
+        if (found != segmentEnd) {
+            return IteratorImp(position.blockPtr(), found);           // RETURN
+        }
+        position.nextBlock();
+    }
+
+    VALUE_TYPE *found = native_std::find(position.valuePtr(),
+                                         end.valuePtr(),
+                                         value);
+    return IteratorImp(position.blockPtr(), found);
+}
+
+template <class ELEMENT_TYPE,
+          class VALUE_TYPE,
+          int   BLOCK_LENGTH,
+          class VISITOR>
+VISITOR DequeSegmentUtil::forEach(
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& first,
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& last,
+        VISITOR                                                       visitor)
+{
+    BSLS_ASSERT_SAFE(!(last < first));
+
+    bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH>       position =
+                                                                  first.imp();
+    const bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH>& end = last.imp();
+
+    while (position.blockPtr() != end.blockPtr()) {
+        ELEMENT_TYPE *segmentEnd = position.blockEnd();
+        for (ELEMENT_TYPE *p = position.valuePtr(); p != segmentEnd; ++p) {
+            visitor(*p);
+        }
+        position.nextBlock();
+    }
+
+    ELEMENT_TYPE *segmentEnd = end.valuePtr();
+    for (ELEMENT_TYPE *p = position.valuePtr(); p != segmentEnd; ++p) {
+        visitor(*p);
+    }
+    return visitor;
+}
+
+template <class ELEMENT_TYPE,
+          class VALUE_TYPE,
+          int   BLOCK_LENGTH,
+          class VISITOR>
+VISITOR DequeSegmentUtil::forEachSegment(
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& first,
+        const RandomAccessIterator<ELEMENT_TYPE,
+                      bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> >& last,
+        VISITOR                                                       visitor)
+{
+    BSLS_ASSERT_SAFE(!(last < first));
+
+    bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH>       position =
+                                                                  first.imp();
+    const bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH>& end = last.imp();
+
+    while (position.blockPtr() != end.blockPtr()) {
+        ELEMENT_TYPE *segmentBegin = position.valuePtr();
+        ELEMENT_TYPE *segmentEnd   = position.blockEnd();
+        if (segmentBegin != segmentEnd) {
+            visitor(segmentBegin, segmentEnd);
+        }
+        position.nextBlock();
+    }
+
+    ELEMENT_TYPE *segmentBegin = position.valuePtr();
+    ELEMENT_TYPE *segmentEnd   = end.valuePtr();
+    if (segmentBegin != segmentEnd) {
+        visitor(segmentBegin, segmentEnd);
+    }
+    return visitor;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,919 @@
+// bslstl_dequesegmentutil.t.cpp                                      -*-C++-*-
+#include <bslstl_dequesegmentutil.h>
+
+#include <bslstl_deque.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <algorithm>    // 'std::for_each', 'std::copy', 'std::find'
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides algorithms on ranges of deque elements
+// that must have the same effect as the standard algorithms of the same
+// names.  We test each algorithm on every subrange of deques of several
+// lengths, whose first element is at several offsets within its block, and
+// whose elements are of types with several block lengths, and compare the
+// results with those of a simple loop over the range using deque iterators.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] OUTPUT_ITERATOR copy(first, last, OUTPUT_ITERATOR result);
+// [ 5] iterator find(first, last, const VALUE& value);
+// [ 3] VISITOR forEach(first, last, VISITOR visitor);
+// [ 2] VISITOR forEachSegment(first, last, VISITOR visitor);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARED WITH THE STANDARD ALGORITHMS
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool         verbose;
+static bool     veryVerbose;
+static bool veryVeryVerbose;
+
+struct LargeValue {
+    // This 'struct' provides a value type large enough that a deque of it has
+    // the minimum block length of 16.
+
+    // DATA
+    int  d_value;
+    char d_padding[60];
+
+    // CREATORS
+    LargeValue(int value = 0)                                       // IMPLICIT
+    : d_value(value)
+    {
+    }
+};
+
+bool operator==(const LargeValue& lhs, const LargeValue& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same value, and
+    // 'false' otherwise.
+{
+    return lhs.d_value == rhs.d_value;
+}
+
+bool operator==(const LargeValue& lhs, int rhs)
+    // Return 'true' if the specified 'lhs' has the specified 'rhs' value, and
+    // 'false' otherwise.
+{
+    return lhs.d_value == rhs;
+}
+
+int intValue(int value)
+    // Return the specified 'value'.
+{
+    return value;
+}
+
+int intValue(double value)
+    // Return the specified 'value' converted to 'int'.
+{
+    return static_cast<int>(value);
+}
+
+int intValue(const LargeValue& value)
+    // Return the value of the specified 'value'.
+{
+    return value.d_value;
+}
+
+template <class TYPE>
+void makeDeque(bsl::deque<TYPE> *result, int length, int numFront)
+    // Load into the specified 'result' the values '[0 .. length)', in order,
+    // pushing the first (up to) specified 'numFront' values at the front of
+    // the deque and the rest at the back, so as to vary the offset of the
+    // first element within its block.
+{
+    result->clear();
+    if (numFront > length) {
+        numFront = length;
+    }
+    for (int i = numFront; i < length; ++i) {
+        result->push_back(TYPE(i));
+    }
+    for (int i = numFront - 1; i >= 0; --i) {
+        result->push_front(TYPE(i));
+    }
+}
+
+template <class TYPE>
+class SegmentRecorder {
+    // This class provides a segment visitor that records the segments it
+    // visits.
+
+    // DATA
+    bsl::vector<TYPE *> *d_begins_p;  // recorded segment beginnings
+    bsl::vector<TYPE *> *d_ends_p;    // recorded segment ends
+
+  public:
+    // CREATORS
+    SegmentRecorder(bsl::vector<TYPE *> *begins, bsl::vector<TYPE *> *ends)
+        // Create a recorder that appends the beginning and end of each
+        // visited segment to the specified 'begins' and 'ends', respectively.
+    : d_begins_p(begins)
+    , d_ends_p(ends)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()(TYPE *begin, TYPE *end)
+        // Record the segment specified by 'begin' and 'end'.
+    {
+        d_begins_p->push_back(begin);
+        d_ends_p->push_back(end);
+    }
+};
+
+template <class TYPE>
+class ValueRecorder {
+    // This class provides an element visitor that records the (integer
+    // values of the) elements it visits, and counts the visits.
+
+    // DATA
+    bsl::vector<int> *d_values_p;   // recorded values
+    int               d_numVisits;  // number of visits by this copy
+
+  public:
+    // CREATORS
+    explicit ValueRecorder(bsl::vector<int> *values)
+        // Create a recorder that appends the value of each visited element to
+        // the specified 'values'.
+    : d_values_p(values)
+    , d_numVisits(0)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()(TYPE& element)
+        // Record the value of the specified 'element'.
+    {
+        d_values_p->push_back(intValue(element));
+        ++d_numVisits;
+    }
+
+    // ACCESSORS
+    int numVisits() const
+        // Return the number of elements visited by this object.
+    {
+        return d_numVisits;
+    }
+};
+
+template <class TYPE>
+struct Doubler {
+    // This 'struct' provides an element visitor that doubles each element.
+
+    // MANIPULATORS
+    void operator()(TYPE& element) const
+        // Double the value of the specified 'element'.
+    {
+        element = TYPE(intValue(element) * 2);
+    }
+};
+
+struct IntSum {
+    // This 'struct' provides an element visitor that sums the elements it
+    // visits.
+
+    // DATA
+    bsls::Types::Int64 d_sum;  // sum of the visited elements
+
+    // CREATORS
+    IntSum() : d_sum(0) {}
+        // Create a visitor having a sum of 0.
+
+    // MANIPULATORS
+    void operator()(int value)
+        // Add the specified 'value' to the sum.
+    {
+        d_sum += value;
+    }
+};
+
+const int LENGTHS[]   = { 0, 1, 2, 15, 16, 17, 24, 25, 26, 49, 50, 51, 99,
+                          120 };
+const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+const int FRONTS[]    = { 0, 1, 15, 16, 24, 25, 49, 50 };
+const int NUM_FRONTS  = sizeof FRONTS / sizeof *FRONTS;
+
+                            // ================
+                            // class TestDriver
+                            // ================
+
+template <class TYPE>
+struct TestDriver {
+    // This 'struct' provides a namespace for the test cases that are run for
+    // deques of several element types.
+
+    typedef bsl::deque<TYPE>                     Obj;
+    typedef typename Obj::iterator               Iter;
+    typedef typename Obj::const_iterator         CIter;
+    typedef bslstl::DequeSegmentUtil             Util;
+
+    static void testForEachSegment();
+        // Test 'forEachSegment'.
+
+    static void testForEach();
+        // Test 'forEach'.
+
+    static void testCopy();
+        // Test 'copy'.
+
+    static void testFind();
+        // Test 'find'.
+};
+
+template <class TYPE>
+void TestDriver<TYPE>::testForEachSegment()
+{
+    bslma::TestAllocator ta(veryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const int LENGTH = LENGTHS[ti];
+        for (int tj = 0; tj < NUM_FRONTS; ++tj) {
+            const int FRONT = FRONTS[tj];
+
+            Obj mX(&ta);  const Obj& X = mX;
+            makeDeque(&mX, LENGTH, FRONT);
+
+            for (int i = 0; i <= LENGTH; ++i) {
+                for (int j = i; j <= LENGTH; ++j) {
+                    bsl::vector<TYPE *> begins(&ta);
+                    bsl::vector<TYPE *> ends(&ta);
+
+                    Util::forEachSegment(mX.begin() + i,
+                                         mX.begin() + j,
+                                         SegmentRecorder<TYPE>(&begins,
+                                                               &ends));
+
+                    // The segments are non-empty and together visit each
+                    // element of the range, in order.  Each segment lies
+                    // within one block, and the first element of each segment
+                    // but the first is in a different block than its
+                    // predecessor.
+
+                    int k = i;
+                    for (size_t s = 0; s < begins.size(); ++s) {
+                        ASSERTV(LENGTH, FRONT, i, j, s, begins[s] < ends[s]);
+
+                        const Iter segmentBegin = mX.begin() + k;
+                        if (s > 0) {
+                            ASSERTV(LENGTH, FRONT, i, j, s,
+                                    (segmentBegin - 1).imp().blockPtr() !=
+                                              segmentBegin.imp().blockPtr());
+                        }
+                        for (TYPE *p = begins[s]; p != ends[s]; ++p, ++k) {
+                            ASSERTV(LENGTH, FRONT, i, j, k, &X[k] == p);
+                            ASSERTV(LENGTH, FRONT, i, j, k,
+                                    segmentBegin.imp().blockPtr() ==
+                                         (mX.begin() + k).imp().blockPtr());
+                        }
+                    }
+                    ASSERTV(LENGTH, FRONT, i, j, k, j == k);
+
+                    // 'const_iterator' ranges provide pointers to 'const'.
+
+                    bsl::vector<const TYPE *> cbegins(&ta);
+                    bsl::vector<const TYPE *> cends(&ta);
+
+                    Util::forEachSegment(X.begin() + i,
+                                         X.begin() + j,
+                                         SegmentRecorder<const TYPE>(&cbegins,
+                                                                     &cends));
+                    ASSERTV(LENGTH, FRONT, i, j,
+                            begins.size() == cbegins.size());
+                    for (size_t s = 0; s < begins.size() &&
+                                                   s < cbegins.size(); ++s) {
+                        ASSERTV(LENGTH, FRONT, i, j, s,
+                                begins[s] == cbegins[s]);
+                        ASSERTV(LENGTH, FRONT, i, j, s, ends[s] == cends[s]);
+                    }
+                }
+            }
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testForEach()
+{
+    bslma::TestAllocator ta(veryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const int LENGTH = LENGTHS[ti];
+        for (int tj = 0; tj < NUM_FRONTS; ++tj) {
+            const int FRONT = FRONTS[tj];
+
+            Obj mX(&ta);  const Obj& X = mX;
+            makeDeque(&mX, LENGTH, FRONT);
+
+            for (int i = 0; i <= LENGTH; ++i) {
+                for (int j = i; j <= LENGTH; ++j) {
+                    bsl::vector<int> values(&ta);
+
+                    ValueRecorder<const TYPE> result =
+                                   Util::forEach(X.begin() + i,
+                                                 X.begin() + j,
+                                                 ValueRecorder<const TYPE>(
+                                                                    &values));
+
+                    ASSERTV(LENGTH, FRONT, i, j, result.numVisits(),
+                            j - i == result.numVisits());
+                    ASSERTV(LENGTH, FRONT, i, j, values.size(),
+                            static_cast<size_t>(j - i) == values.size());
+                    for (size_t k = 0; k < values.size(); ++k) {
+                        ASSERTV(LENGTH, FRONT, i, j, k,
+                                static_cast<int>(i + k) == values[k]);
+                    }
+                }
+            }
+
+            // The visitor can modify the elements of an 'iterator' range.
+
+            for (int i = 0; i <= LENGTH; ++i) {
+                for (int j = i; j <= LENGTH; ++j) {
+                    makeDeque(&mX, LENGTH, FRONT);
+
+                    Util::forEach(mX.begin() + i,
+                                  mX.begin() + j,
+                                  Doubler<TYPE>());
+
+                    for (int k = 0; k < LENGTH; ++k) {
+                        const int EXP = i <= k && k < j ? 2 * k : k;
+                        ASSERTV(LENGTH, FRONT, i, j, k,
+                                EXP == intValue(X[k]));
+                    }
+                }
+            }
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCopy()
+{
+    bslma::TestAllocator ta(veryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const int LENGTH = LENGTHS[ti];
+        for (int tj = 0; tj < NUM_FRONTS; ++tj) {
+            const int FRONT = FRONTS[tj];
+
+            Obj mX(&ta);  const Obj& X = mX;
+            makeDeque(&mX, LENGTH, FRONT);
+
+            for (int i = 0; i <= LENGTH; ++i) {
+                for (int j = i; j <= LENGTH; ++j) {
+
+                    // Copy into an array (of one more element than needed, to
+                    // detect overruns).
+
+                    bsl::vector<TYPE> array(LENGTH + 1, TYPE(-1), &ta);
+
+                    TYPE *end = Util::copy(X.begin() + i,
+                                           X.begin() + j,
+                                           array.data());
+                    ASSERTV(LENGTH, FRONT, i, j, array.data() + j - i == end);
+                    for (int k = 0; k < j - i; ++k) {
+                        ASSERTV(LENGTH, FRONT, i, j, k,
+                                i + k == intValue(array[k]));
+                    }
+                    ASSERTV(LENGTH, FRONT, i, j,
+                            -1 == intValue(array[j - i]));
+
+                    // Copy from an 'iterator' range into another deque,
+                    // through a deque iterator.
+
+                    Obj mY(LENGTH + 1, TYPE(-1), &ta);
+
+                    Iter yEnd = Util::copy(mX.begin() + i,
+                                           mX.begin() + j,
+                                           mY.begin());
+                    ASSERTV(LENGTH, FRONT, i, j, mY.begin() + j - i == yEnd);
+                    for (int k = 0; k < j - i; ++k) {
+                        ASSERTV(LENGTH, FRONT, i, j, k,
+                                i + k == intValue(mY[k]));
+                    }
+                    ASSERTV(LENGTH, FRONT, i, j, -1 == intValue(mY[j - i]));
+                }
+            }
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testFind()
+{
+    bslma::TestAllocator ta(veryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        const int LENGTH = LENGTHS[ti];
+        for (int tj = 0; tj < NUM_FRONTS; ++tj) {
+            const int FRONT = FRONTS[tj];
+
+            Obj mX(&ta);  const Obj& X = mX;
+            makeDeque(&mX, LENGTH, FRONT);
+
+            for (int i = 0; i <= LENGTH; ++i) {
+                for (int j = i; j <= LENGTH; ++j) {
+                    const int VALUES[] = { i - 1, i, (i + j) / 2, j - 1, j };
+                    const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+                    for (int tk = 0; tk < NUM_VALUES; ++tk) {
+                        const int  V     = VALUES[tk];
+                        const bool FOUND = i <= V && V < j;
+
+                        CIter cResult = Util::find(X.begin() + i,
+                                                   X.begin() + j,
+                                                   TYPE(V));
+                        ASSERTV(LENGTH, FRONT, i, j, V,
+                                (FOUND ? X.begin() + V : X.begin() + j) ==
+                                                                     cResult);
+
+                        Iter result = Util::find(mX.begin() + i,
+                                                 mX.begin() + j,
+                                                 TYPE(V));
+                        ASSERTV(LENGTH, FRONT, i, j, V,
+                                (FOUND ? mX.begin() + V : mX.begin() + j) ==
+                                                                      result);
+                    }
+                }
+            }
+        }
+    }
+
+    // A value repeated across a block boundary is found at its first
+    // position.
+
+    {
+        Obj mX(&ta);  const Obj& X = mX;
+        makeDeque(&mX, 120, 0);
+        for (int k = 0; k < 110; k += 7) {
+            mX[k + 1] = mX[k];
+            mX[k + 2] = mX[k];
+            ASSERTV(k, X.begin() + k == Util::find(X.begin(),
+                                                   X.end(),
+                                                   TYPE(k)));
+            ASSERTV(k, X.begin() + k + 1 == Util::find(X.begin() + k + 1,
+                                                       X.end(),
+                                                       TYPE(k)));
+        }
+    }
+    ASSERT(0 == ta.numBlocksInUse());
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Processing a Queue of Prices
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we buffer the prices of trades in a 'bsl::deque', and periodically
+// need to compute statistics on the buffered prices, to look for a specific
+// price, and to take a snapshot of the prices in a contiguous array.
+//
+// First, we define a visitor that accumulates the sum of the values it is
+// invoked on:
+//..
+    struct SumVisitor {
+        // This 'struct' accumulates the sum of the values it visits.
+
+        // DATA
+        double d_sum;  // sum of the values visited so far
+
+        // CREATORS
+        SumVisitor() : d_sum(0) {}
+            // Create a visitor having a sum of 0.
+
+        // MANIPULATORS
+        void operator()(double value)
+            // Add the specified 'value' to the sum.
+        {
+            d_sum += value;
+        }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we fill a deque with prices (spanning many blocks of the deque):
+//..
+    bsl::deque<double> prices;
+    for (int i = 0; i < 1000; ++i) {
+        prices.push_back(100.0 + i % 7);
+    }
+//..
+// Next, we compute the sum of the prices, one block at a time:
+//..
+    SumVisitor sum = bslstl::DequeSegmentUtil::forEach(prices.begin(),
+                                                       prices.end(),
+                                                       SumVisitor());
+    ASSERT(102997.0 == sum.d_sum);
+//..
+// Then, we look for the first price of 106:
+//..
+    bsl::deque<double>::const_iterator it =
+                 bslstl::DequeSegmentUtil::find(prices.cbegin(),
+                                                prices.cend(),
+                                                106.0);
+    ASSERT(prices.cend() != it);
+    ASSERT(6 == it - prices.cbegin());
+//..
+// Finally, we copy the last 500 prices into an array:
+//..
+    double snapshot[500];
+    double *end = bslstl::DequeSegmentUtil::copy(prices.end() - 500,
+                                                 prices.end(),
+                                                 snapshot);
+    ASSERT(snapshot + 500 == end);
+    ASSERT(prices[500] == snapshot[0]);
+    ASSERT(prices[999] == snapshot[499]);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'find'
+        //
+        // Concerns:
+        //: 1 'find' returns an iterator to the first element of the range
+        //:   equal to the value, whether it is in the first, a middle, or the
+        //:   last segment of the range, and at any position in its segment.
+        //:
+        //: 2 'find' returns 'last' if no element of the range is equal to the
+        //:   value, including elements just outside of the range.
+        //:
+        //: 3 The result has the type of the iterator arguments, for both
+        //:   'iterator' and 'const_iterator' ranges.
+        //
+        // Plan:
+        //: 1 For deques of several element types, lengths, and offsets of the
+        //:   first element, search each subrange for the values of the
+        //:   elements at either end of, in the middle of, and just outside of
+        //:   the range, and compare the result with the expected iterator.
+        //:   (C-1..3)
+        //:
+        //: 2 Search a deque holding duplicate values, some spanning a block
+        //:   boundary.  (C-1)
+        //
+        // Testing:
+        //   iterator find(first, last, const VALUE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'find'"
+                            "\n======\n");
+
+        TestDriver<int>::testFind();
+        TestDriver<double>::testFind();
+        TestDriver<LargeValue>::testFind();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'copy'
+        //
+        // Concerns:
+        //: 1 'copy' assigns each element of the range, in order, to the output
+        //:   range, and returns the end of the output range.
+        //:
+        //: 2 'copy' does not write past the end of the output range.
+        //:
+        //: 3 'copy' works with pointers and with other (e.g., deque) output
+        //:   iterators.
+        //
+        // Plan:
+        //: 1 For deques of several element types, lengths, and offsets of the
+        //:   first element, copy each subrange into an array and into another
+        //:   deque, each having one element more than needed, and verify the
+        //:   values in the output, the returned iterator, and that the last
+        //:   element of the output is unchanged.  (C-1..3)
+        //
+        // Testing:
+        //   OUTPUT_ITERATOR copy(first, last, OUTPUT_ITERATOR result);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'copy'"
+                            "\n======\n");
+
+        TestDriver<int>::testCopy();
+        TestDriver<double>::testCopy();
+        TestDriver<LargeValue>::testCopy();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'forEach'
+        //
+        // Concerns:
+        //: 1 'forEach' invokes the visitor once on each element of the range,
+        //:   in order, and on no other element.
+        //:
+        //: 2 'forEach' returns the visitor after it has visited each element.
+        //:
+        //: 3 The visitor can modify the elements of an 'iterator' range.
+        //
+        // Plan:
+        //: 1 For deques of several element types, lengths, and offsets of the
+        //:   first element, visit each subrange with a visitor recording the
+        //:   elements it visits, and verify the recorded values and the count
+        //:   in the returned visitor.  (C-1..2)
+        //:
+        //: 2 Visit each subrange with a visitor doubling each element, and
+        //:   verify the values of all of the elements of the deque.  (C-3)
+        //
+        // Testing:
+        //   VISITOR forEach(first, last, VISITOR visitor);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'forEach'"
+                            "\n=========\n");
+
+        TestDriver<int>::testForEach();
+        TestDriver<double>::testForEach();
+        TestDriver<LargeValue>::testForEach();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'forEachSegment'
+        //
+        // Concerns:
+        //: 1 The segments supplied to the visitor are non-empty, and together
+        //:   are the whole range, in order.
+        //:
+        //: 2 Each segment lies within one block, and is maximal, i.e., two
+        //:   consecutive segments lie in different blocks.
+        //:
+        //: 3 A range within a single block is supplied as a single segment,
+        //:   and an empty range supplies no segment.
+        //:
+        //: 4 A 'const_iterator' range supplies the same segments as pointers
+        //:   to 'const'.
+        //
+        // Plan:
+        //: 1 For deques of several element types, lengths, and offsets of the
+        //:   first element, visit each subrange with a visitor recording the
+        //:   segments it visits, and verify that the recorded segments are
+        //:   those expected, by comparing the addresses of their elements with
+        //:   those of the elements of the deque, and the block of the end of
+        //:   the first segment with that of the beginning of the range.
+        //:   (C-1..3)
+        //:
+        //: 2 Repeat P-1 using 'const_iterator' objects, and compare the
+        //:   segments with those recorded in P-1.  (C-4)
+        //
+        // Testing:
+        //   VISITOR forEachSegment(first, last, VISITOR visitor);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'forEachSegment'"
+                            "\n================\n");
+
+        TestDriver<int>::testForEachSegment();
+        TestDriver<double>::testForEachSegment();
+        TestDriver<LargeValue>::testForEachSegment();
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Apply each algorithm to a deque spanning several blocks, and
+        //:   compare the results with those of the standard algorithms.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bslstl::DequeSegmentUtil Util;
+
+        bsl::deque<int> mX;  const bsl::deque<int>& X = mX;
+        for (int i = 0; i < 500; ++i) {
+            mX.push_back(i);
+        }
+
+        IntSum sum = Util::forEach(X.begin(), X.end(), IntSum());
+        ASSERTV(sum.d_sum, 500 * 499 / 2 == sum.d_sum);
+
+        int array[500];
+        ASSERT(array + 500 == Util::copy(X.begin(), X.end(), array));
+        ASSERT(std::equal(X.begin(), X.end(), array));
+
+        ASSERT(X.begin() + 321 == Util::find(X.begin(), X.end(), 321));
+        ASSERT(X.end()         == Util::find(X.begin(), X.end(), 500));
+        ASSERT(X.end()         == Util::find(X.begin() + 400, X.end(), 321));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARED WITH THE STANDARD ALGORITHMS
+        //   Compare the time taken to sum, copy, and search a deque of 'int'
+        //   by 'forEach', 'copy', and 'find' with that taken by
+        //   'std::for_each', 'std::copy', and 'std::find'.  Optionally specify
+        //   the number of elements as the second argument (1M by default).
+        //
+        // Testing:
+        //   PERFORMANCE COMPARED WITH THE STANDARD ALGORITHMS
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE COMPARED WITH THE STANDARD ALGORITHMS"
+               "\n=================================================\n");
+
+        typedef bslstl::DequeSegmentUtil Util;
+
+        const int numElements = argc > 2 && atoi(argv[2]) > 0
+                              ? atoi(argv[2])
+                              : 1 << 20;
+        const int numRounds   = 50;
+
+        bsl::deque<int> mX;  const bsl::deque<int>& X = mX;
+        for (int i = 0; i < numElements; ++i) {
+            mX.push_back(i);
+        }
+        bsl::vector<int> array(numElements);
+
+        bsls::Stopwatch    timer;
+        bsls::Types::Int64 check = 0;
+
+        timer.start();
+        for (int r = 0; r < numRounds; ++r) {
+            check += std::for_each(X.begin(), X.end(), IntSum()).d_sum;
+        }
+        timer.stop();
+        printf("std::for_each:    %8.4fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        for (int r = 0; r < numRounds; ++r) {
+            check -= Util::forEach(X.begin(), X.end(), IntSum()).d_sum;
+        }
+        timer.stop();
+        printf("Util::forEach:    %8.4fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        for (int r = 0; r < numRounds; ++r) {
+            check += std::copy(X.begin(), X.end(), array.begin())[-1];
+        }
+        timer.stop();
+        printf("std::copy:        %8.4fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        for (int r = 0; r < numRounds; ++r) {
+            check -= Util::copy(X.begin(), X.end(), array.data())[-1];
+        }
+        timer.stop();
+        printf("Util::copy:       %8.4fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        for (int r = 0; r < numRounds; ++r) {
+            check += std::find(X.begin(), X.end(), numElements - 1 - r)
+                                                                 - X.begin();
+        }
+        timer.stop();
+        printf("std::find:        %8.4fs\n", timer.elapsedTime());
+
+        timer.reset();
+        timer.start();
+        for (int r = 0; r < numRounds; ++r) {
+            check -= Util::find(X.begin(), X.end(), numElements - 1 - r)
+                                                                 - X.begin();
+        }
+        timer.stop();
+        printf("Util::find:       %8.4fs\n", timer.elapsedTime());
+
+        ASSERTV(check, 0 == check);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1806 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_string.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_mallocfreeallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsltf_templatetestfacility.h>
+
+#include <functional>   // 'std::less'
+#include <stdexcept>    // 'std::out_of_range'
+
+#include <ctype.h>      // 'islower', 'toupper'
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>     // 'strlen'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container, 'bsl::flat_map',
+// that holds its key-value pairs in a 'bsl::vector' sorted by key.  The
+// primary manipulators are the default constructor, 'insert(value)', and
+// 'clear'; the basic accessors are 'begin', 'end', 'size', and
+// 'get_allocator'.  Most test cases are instantiated, through
+// 'RUN_EACH_TYPE', for each of the "regular" test types of
+// 'bsltf_templatetestfacility' as the key type, ordered by a comparator that
+// orders objects of those types by their identifiers, with 'int' as the
+// mapped type.  The values of the maps used in the tests are described by
+// strings of uppercase letters, each letter standing for the key having that
+// identifier; unless otherwise stated, the mapped value of each key is the
+// position of its letter in the string.  In addition to verifying the value
+// of each map, we verify, with test allocators, that all memory is supplied
+// by the allocator of the map (which is also the allocator of its keys), and
+// that no memory is leaked when an exception is thrown.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map(const C& comparator = C(), const A& allocator = A());
+// [ 2] flat_map(const A& allocator);
+// [ 4] flat_map(const flat_map& original);
+// [ 4] flat_map(const flat_map& original, const A& allocator);
+// [ 5] flat_map(ITER first, ITER last, const C& comparator, const A&);
+// [ 5] flat_map(sorted_unique_t, ITER first, ITER last, const C&, const A&);
+// [ 2] ~flat_map();
+//
+// MANIPULATORS
+// [ 4] flat_map& operator=(const flat_map& rhs);
+// [ 6] VALUE& operator[](const key_type& key);
+// [ 6] VALUE& at(const key_type& key);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] reverse_iterator rbegin();
+// [ 3] reverse_iterator rend();
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 6] iterator insert(const_iterator hint, const value_type& value);
+// [ 5] void insert(ITER first, ITER last);
+// [ 5] void insert(sorted_unique_t, ITER first, ITER last);
+// [ 6] iterator erase(const_iterator position);
+// [ 6] size_type erase(const key_type& key);
+// [ 6] iterator erase(const_iterator first, const_iterator last);
+// [ 4] void swap(flat_map& other);
+// [ 2] void clear();
+// [ 7] void reserve(size_type numElements);
+// [ 7] void shrink_to_fit();
+// [ 3] iterator find(const key_type& key);
+// [ 3] iterator lower_bound(const key_type& key);
+// [ 3] iterator upper_bound(const key_type& key);
+// [ 3] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// ACCESSORS
+// [ 6] const VALUE& at(const key_type& key) const;
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 3] const_reverse_iterator rbegin() const;
+// [ 3] const_reverse_iterator rend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 7] size_type max_size() const;
+// [ 7] size_type capacity() const;
+// [ 7] key_compare key_comp() const;
+// [ 7] value_compare value_comp() const;
+// [ 3] const_iterator find(const key_type& key) const;
+// [ 3] size_type count(const key_type& key) const;
+// [ 3] bool contains(const key_type& key) const;
+// [ 3] const_iterator lower_bound(const key_type& key) const;
+// [ 3] const_iterator upper_bound(const key_type& key) const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const KEY&) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_map& lhs, const flat_map& rhs);
+// [ 4] bool operator!=(const flat_map& lhs, const flat_map& rhs);
+// [ 7] bool operator<(const flat_map& lhs, const flat_map& rhs);
+// [ 7] bool operator>(const flat_map& lhs, const flat_map& rhs);
+// [ 7] bool operator<=(const flat_map& lhs, const flat_map& rhs);
+// [ 7] bool operator>=(const flat_map& lhs, const flat_map& rhs);
+// [ 4] void swap(flat_map& a, flat_map& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] TYPE TRAITS
+// [ 7] FUNCTION-POINTER COMPARATOR
+// [ 8] EXCEPTION SAFETY
+// [ 9] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARED WITH 'bsl::map'
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+#define RUN_EACH_TYPE BSLTF_TEMPLATETESTFACILITY_RUN_EACH_TYPE
+
+typedef bsltf::TemplateTestFacility TTF;
+typedef bslstl::SortedSequenceUtil  Util;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+                            // ====================
+                            // class TestComparator
+                            // ====================
+
+template <class TYPE>
+class TestComparator {
+    // This test class provides a comparator ordering objects of the
+    // parameterized 'TYPE' by their identifiers (see
+    // 'bsltf::TemplateTestFacility::getIdentifier'), in ascending or
+    // descending order, and identified by an integer supplied at
+    // construction.
+
+    // DATA
+    int  d_id;           // identifier of this comparator
+    bool d_compareLess;  // 'true' for ascending order
+
+  public:
+    // CREATORS
+    explicit TestComparator(int id = 0, bool compareLess = true)
+        // Create a comparator having the optionally specified 'id', that
+        // orders objects in ascending order unless the optionally specified
+        // 'compareLess' is 'false'.
+    : d_id(id)
+    , d_compareLess(compareLess)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        const int lhsId = TTF::getIdentifier<TYPE>(lhs);
+        const int rhsId = TTF::getIdentifier<TYPE>(rhs);
+
+        return d_compareLess ? lhsId < rhsId : rhsId < lhsId;
+    }
+
+    int id() const
+        // Return the identifier of this comparator.
+    {
+        return d_id;
+    }
+};
+
+bool lessThan(const int& lhs, const int& rhs)
+    // Return 'true' if the specified 'lhs' is less than the specified 'rhs',
+    // and 'false' otherwise.
+{
+    return lhs < rhs;
+}
+
+                              // ================
+                              // class TestDriver
+                              // ================
+
+template <class KEY>
+class TestDriver {
+    // This class template provides a namespace for testing 'bsl::flat_map'
+    // instantiated with the (template parameter) type 'KEY' and the mapped
+    // type 'int'.
+
+    // PRIVATE TYPES
+    typedef TestComparator<KEY>                Comp;
+    typedef bsl::flat_map<KEY, int, Comp>      Obj;
+    typedef typename Obj::value_type           Pair;
+    typedef typename Obj::iterator             Iter;
+    typedef typename Obj::const_iterator       CIter;
+
+    // PRIVATE CLASS METHODS
+    static void gg(Obj *object, const char *spec);
+        // Insert into the specified 'object' a pair for each character of the
+        // specified 'spec', having the key created from the character and the
+        // position of the character in 'spec' as its mapped value.
+
+    static bool verify(const Obj& object, const char *expected);
+        // Return 'true' if the sequence of keys of the specified 'object' has
+        // the identifiers given by the characters of the specified
+        // 'expected', in order, and 'false' otherwise.
+
+    static void fill(bsl::vector<Pair> *pairs, const char *spec);
+        // Append to the specified 'pairs' a pair for each character of the
+        // specified 'spec', having the key created from the character and the
+        // position of the character in 'spec' as its mapped value.
+
+    static bool sameKeys(const Obj& lhs, const Obj& rhs);
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same
+        // sequence of keys, and 'false' otherwise.
+
+    static bool checkMapped(const Obj& object, const char *spec);
+        // Return 'true' if the mapped value of each pair of the specified
+        // 'object' is the position in the specified 'spec' of a character
+        // that is the identifier of the key of the pair, and 'false'
+        // otherwise.
+
+    static bool checkMerged(const Obj&  object,
+                            const Obj&  original,
+                            const char *spec);
+        // Return 'true' if each pair of the specified 'original' is in the
+        // specified 'object', and the mapped value of each other pair of
+        // 'object' is the position in the specified 'spec' of a character that
+        // is the identifier of the key of the pair, and 'false' otherwise.
+
+  public:
+    // CLASS METHODS
+    static void testCase2();
+        // Test primary manipulators.
+
+    static void testCase3();
+        // Test lookup methods.
+
+    static void testCase4();
+        // Test copy construction, assignment, swap, and equality.
+
+    static void testCase5();
+        // Test range construction and bulk insertion.
+
+    static void testCase6();
+        // Test element access, hinted insertion, and erasure.
+};
+
+                              // ----------------
+                              // class TestDriver
+                              // ----------------
+
+// PRIVATE CLASS METHODS
+template <class KEY>
+void TestDriver<KEY>::gg(Obj *object, const char *spec)
+{
+    for (int i = 0; spec[i]; ++i) {
+        object->insert(Pair(TTF::create<KEY>(spec[i]), i));
+    }
+}
+
+template <class KEY>
+bool TestDriver<KEY>::verify(const Obj& object, const char *expected)
+{
+    if (strlen(expected) != object.size()) {
+        return false;                                                 // RETURN
+    }
+    for (CIter it = object.begin(); it != object.end(); ++it, ++expected) {
+        if (*expected != TTF::getIdentifier<KEY>(it->first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY>
+void TestDriver<KEY>::fill(bsl::vector<Pair> *pairs, const char *spec)
+{
+    for (int i = 0; spec[i]; ++i) {
+        pairs->push_back(Pair(TTF::create<KEY>(spec[i]), i));
+    }
+}
+
+template <class KEY>
+bool TestDriver<KEY>::sameKeys(const Obj& lhs, const Obj& rhs)
+{
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+    for (CIter l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r) {
+        if (TTF::getIdentifier<KEY>(l->first)
+                                       != TTF::getIdentifier<KEY>(r->first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY>
+bool TestDriver<KEY>::checkMapped(const Obj& object, const char *spec)
+{
+    const int len = static_cast<int>(strlen(spec));
+    for (CIter it = object.begin(); it != object.end(); ++it) {
+        if (it->second < 0 || it->second >= len
+         || spec[it->second] != TTF::getIdentifier<KEY>(it->first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY>
+bool TestDriver<KEY>::checkMerged(const Obj&  object,
+                                  const Obj&  original,
+                                  const char *spec)
+{
+    Obj inserted(object, object.get_allocator());
+    for (CIter it = original.begin(); it != original.end(); ++it) {
+        CIter position = object.find(it->first);
+        if (position == object.end() || position->second != it->second) {
+            return false;                                             // RETURN
+        }
+        inserted.erase(it->first);
+    }
+    return checkMapped(inserted, spec);
+}
+
+// CLASS METHODS
+template <class KEY>
+void TestDriver<KEY>::testCase2()
+{
+    // ------------------------------------------------------------------------
+    // PRIMARY MANIPULATORS
+    //
+    // Concerns:
+    //: 1 Each constructor creates an empty map using the expected comparator
+    //:   and allocator, without allocating memory.
+    //:
+    //: 2 'insert' adds a pair if and only if no pair having an equivalent key
+    //:   is present, keeps the pairs sorted by key, and returns an iterator
+    //:   to the pair having the key and whether the pair was inserted.
+    //:
+    //: 3 'insert' does not change the mapped value of a pair already present.
+    //:
+    //: 4 'clear' removes all pairs, retaining the capacity.
+    //:
+    //: 5 All memory, including that of the keys, is supplied by the object
+    //:   allocator, and is released on destruction.
+    //:
+    //: 6 An empty comparator adds no space to the map.
+    //
+    // Plan:
+    //: 1 Create maps with each constructor, and verify their state and that
+    //:   no memory was allocated.  (C-1)
+    //:
+    //: 2 For each spec in a table, insert the pairs of the spec into a map
+    //:   created with a test allocator, verifying the return value of each
+    //:   insertion, and verify the resulting sequence of keys and mapped
+    //:   values.  Verify that no memory from the default allocator remains in
+    //:   use (temporary copies of pairs made by 'bsl::vector' use the default
+    //:   allocator), and that no memory is in use after the map is destroyed.
+    //:   (C-2, 3, 5)
+    //:
+    //: 3 Clear the map, and verify its state.  (C-4)
+    //:
+    //: 4 Compare the size of a map with that of a vector.  (C-6)
+    //
+    // Testing:
+    //   flat_map(const C& comparator = C(), const A& allocator = A());
+    //   flat_map(const A& allocator);
+    //   ~flat_map();
+    //   pair<iterator, bool> insert(const value_type& value);
+    //   void clear();
+    //   allocator_type get_allocator() const;
+    //   const_iterator begin() const;
+    //   const_iterator end() const;
+    //   bool empty() const;
+    //   size_type size() const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const Obj W;
+        const Obj X(Comp(7), &oa);
+        const Obj Y(&oa);
+
+        ASSERT(W.empty());           ASSERT(0 == W.size());
+        ASSERT(X.empty());           ASSERT(0 == X.size());
+        ASSERT(Y.empty());           ASSERT(0 == Y.size());
+
+        ASSERT(W.begin() == W.end());
+
+        ASSERT(&da == W.get_allocator().mechanism());
+        ASSERT(&oa == X.get_allocator().mechanism());
+        ASSERT(&oa == Y.get_allocator().mechanism());
+
+        ASSERT(0 == W.key_comp().id());
+        ASSERT(7 == X.key_comp().id());
+        ASSERT(0 == Y.key_comp().id());
+
+        ASSERT(0 == da.numBlocksTotal());
+        ASSERT(0 == oa.numBlocksTotal());
+    }
+
+    static const struct {
+        int         d_line;      // source line number
+        const char *d_spec;      // keys to insert, in order
+        const char *d_inserted;  // 'Y' for each key expected to be inserted
+        const char *d_result;    // expected keys, in order
+    } DATA[] = {
+        //LINE  SPEC         INSERTED     RESULT
+        //----  -----------  -----------  ---------
+        { L_,   "",          "",          ""        },
+        { L_,   "A",         "Y",         "A"       },
+        { L_,   "AA",        "YN",        "A"       },
+        { L_,   "AB",        "YY",        "AB"      },
+        { L_,   "BA",        "YY",        "AB"      },
+        { L_,   "CAB",       "YYY",       "ABC"     },
+        { L_,   "CABBAC",    "YYYNNN",    "ABC"     },
+        { L_,   "EDCBA",     "YYYYY",     "ABCDE"   },
+        { L_,   "ACEGBDF",   "YYYYYYY",   "ABCDEFG" },
+        { L_,   "GFAGFA",    "YYYNNN",    "AFG"     },
+        { L_,   "ZYXABCZ",   "YYYYYYN",   "ABCXYZ"  },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int   LINE     = DATA[ti].d_line;
+        const char *SPEC     = DATA[ti].d_spec;
+        const char *INSERTED = DATA[ti].d_inserted;
+        const char *RESULT   = DATA[ti].d_result;
+
+        if (veryVerbose) { T_ P_(LINE) P_(SPEC) P(RESULT) }
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bsl::vector<Pair>    values(&sa);
+        fill(&values, SPEC);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; SPEC[i]; ++i) {
+                const Pair& VALUE = values[i];
+                const bool  EXP   = 'Y' == INSERTED[i];
+                const bsl::pair<Iter, bool> R = mX.insert(VALUE);
+
+                ASSERTV(LINE, i, EXP == R.second);
+                ASSERTV(LINE, i, X.end() != R.first);
+                ASSERTV(LINE, i,
+                        SPEC[i] == TTF::getIdentifier<KEY>(R.first->first));
+
+                // The mapped value is that of the first pair inserted having
+                // the key.
+
+                ASSERTV(LINE, i, SPEC[R.first->second] == SPEC[i]);
+                ASSERTV(LINE, i, EXP == (i == R.first->second));
+            }
+
+            ASSERTV(LINE, verify(X, RESULT));
+            ASSERTV(LINE, (0 == *RESULT) == X.empty());
+            ASSERTV(LINE, da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+            const typename Obj::size_type CAPACITY = X.capacity();
+
+            mX.clear();
+            ASSERTV(LINE, X.empty());
+            ASSERTV(LINE, 0 == X.size());
+            ASSERTV(LINE, X.begin() == X.end());
+            ASSERTV(LINE, CAPACITY == X.capacity());
+        }
+        ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    }
+
+    ASSERTV(sizeof(bsl::flat_map<KEY, int>),
+            sizeof(bsl::vector<Pair>) == sizeof(bsl::flat_map<KEY, int>));
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // LOOKUP METHODS
+    //
+    // Concerns:
+    //: 1 'find', 'count', and 'contains' find a key if and only if an
+    //:   equivalent key is in the map.
+    //:
+    //: 2 'lower_bound', 'upper_bound', and 'equal_range' return the positions
+    //:   of the first pair whose key is not ordered before, and the first pair
+    //:   whose key is ordered after, the key sought.
+    //:
+    //: 3 The lookup methods honor the ordering of the comparator.
+    //:
+    //: 4 The non-'const' lookup methods and iterators return the same
+    //:   positions as the 'const' ones, and provide modifiable access to the
+    //:   mapped values.
+    //:
+    //: 5 The reverse iterators traverse the pairs in reverse order.
+    //:
+    //: 6 The lookup methods do not allocate memory.
+    //
+    // Plan:
+    //: 1 For each spec in a table, create a map (ordered in ascending and in
+    //:   descending order), and look up each key from 'A' to 'Z' with the
+    //:   'const' and non-'const' methods, comparing the results against the
+    //:   position of the key computed by a linear scan.  (C-1..4)
+    //:
+    //: 2 Modify the mapped value of each pair found, and verify the change
+    //:   through the 'const' iterators.  (C-4)
+    //:
+    //: 3 Traverse each map with the reverse iterators.  (C-5)
+    //:
+    //: 4 Verify that no memory was allocated by the lookups.  (C-6)
+    //
+    // Testing:
+    //   iterator begin();
+    //   iterator end();
+    //   reverse_iterator rbegin();
+    //   reverse_iterator rend();
+    //   iterator find(const key_type& key);
+    //   iterator lower_bound(const key_type& key);
+    //   iterator upper_bound(const key_type& key);
+    //   pair<iterator, iterator> equal_range(const key_type& key);
+    //   const_reverse_iterator rbegin() const;
+    //   const_reverse_iterator rend() const;
+    //   const_iterator find(const key_type& key) const;
+    //   size_type count(const key_type& key) const;
+    //   bool contains(const key_type& key) const;
+    //   const_iterator lower_bound(const key_type& key) const;
+    //   const_iterator upper_bound(const key_type& key) const;
+    //   pair<const_iterator, const_iterator> equal_range(const KEY&) const;
+    // ------------------------------------------------------------------------
+
+    static const char *SPECS[] = {
+        "", "A", "M", "Z", "AB", "AZ", "ACE", "BDFHJ", "AEIMQUY",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        for (int order = 0; order < 2; ++order) {
+            const char *SPEC = SPECS[ti];
+            const bool  LESS = 0 == order;
+
+            if (veryVerbose) { T_ P_(SPEC) P(LESS) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(Comp(0, LESS), &oa);  const Obj& X = mX;
+            gg(&mX, SPEC);
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numBlocksTotal();
+
+            ASSERTV(SPEC, LESS, X.begin() == mX.begin());
+            ASSERTV(SPEC, LESS, X.end()   == mX.end());
+
+            for (char c = 'A'; c <= 'Z'; ++c) {
+                const KEY VALUE = TTF::create<KEY>(c);
+
+                // Compute the expected position by a linear scan.
+
+                CIter exp = X.begin();
+                while (exp != X.end()
+                    && (LESS ? TTF::getIdentifier<KEY>(exp->first) < c
+                             : TTF::getIdentifier<KEY>(exp->first) > c)) {
+                    ++exp;
+                }
+                const bool FOUND = exp != X.end()
+                                && TTF::getIdentifier<KEY>(exp->first) == c;
+                const CIter EXP_UPPER = FOUND ? exp + 1 : exp;
+
+                ASSERTV(SPEC, LESS, c, FOUND == X.contains(VALUE));
+                ASSERTV(SPEC, LESS, c, (FOUND ? 1u : 0u) == X.count(VALUE));
+                ASSERTV(SPEC, LESS, c,
+                        (FOUND ? exp : X.end()) == X.find(VALUE));
+                ASSERTV(SPEC, LESS, c, exp       == X.lower_bound(VALUE));
+                ASSERTV(SPEC, LESS, c, EXP_UPPER == X.upper_bound(VALUE));
+
+                const bsl::pair<CIter, CIter> R = X.equal_range(VALUE);
+                ASSERTV(SPEC, LESS, c, exp       == R.first);
+                ASSERTV(SPEC, LESS, c, EXP_UPPER == R.second);
+
+                const Iter MF = mX.find(VALUE);
+                ASSERTV(SPEC, LESS, c, CIter(MF) == X.find(VALUE));
+                ASSERTV(SPEC, LESS, c,
+                        CIter(mX.lower_bound(VALUE)) == exp);
+                ASSERTV(SPEC, LESS, c,
+                        CIter(mX.upper_bound(VALUE)) == EXP_UPPER);
+
+                const bsl::pair<Iter, Iter> MR = mX.equal_range(VALUE);
+                ASSERTV(SPEC, LESS, c, CIter(MR.first)  == exp);
+                ASSERTV(SPEC, LESS, c, CIter(MR.second) == EXP_UPPER);
+
+                if (FOUND) {
+                    MF->second = 100 + c;
+                    ASSERTV(SPEC, LESS, c, 100 + c == exp->second);
+                }
+            }
+
+            typename Obj::const_reverse_iterator rit = X.rbegin();
+            for (CIter it = X.end(); it != X.begin(); ++rit) {
+                --it;
+                ASSERTV(SPEC, LESS, X.rend() != rit);
+                ASSERTV(SPEC, LESS, &*it == &*rit);
+            }
+            ASSERTV(SPEC, LESS, X.rend() == rit);
+
+            typename Obj::reverse_iterator mrit = mX.rbegin();
+            for (Iter it = mX.end(); it != mX.begin(); ++mrit) {
+                --it;
+                ASSERTV(SPEC, LESS, mX.rend() != mrit);
+                ASSERTV(SPEC, LESS, &*it == &*mrit);
+            }
+            ASSERTV(SPEC, LESS, mX.rend() == mrit);
+
+            ASSERTV(SPEC, LESS, NUM_ALLOCS == oa.numBlocksTotal());
+        }
+    }
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+    //
+    // Concerns:
+    //: 1 The copy constructor creates a map having the value and comparator
+    //:   of the original, using the default allocator unless an allocator is
+    //:   supplied.
+    //:
+    //: 2 Assignment copies the value and comparator of the source, and does
+    //:   not change the allocator of the target.  Self-assignment has no
+    //:   effect.
+    //:
+    //: 3 'swap' exchanges the values and comparators, without allocating
+    //:   memory if the allocators are the same, and correctly if the
+    //:   allocators differ.
+    //:
+    //: 4 Two maps are equal if and only if they have the same keys and the
+    //:   same mapped values.
+    //:
+    //: 5 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For each pair of specs in a table, create maps having the values of
+    //:   the specs, and verify the results of the equality operators.  Change
+    //:   a mapped value of one of two equal maps, and verify that they are no
+    //:   longer equal.  (C-4)
+    //:
+    //: 2 For each pair, copy-construct, assign, and swap (with the same and
+    //:   different allocators), verifying the values, comparators, and
+    //:   allocators of the results, and the use of memory.  (C-1..3, 5)
+    //
+    // Testing:
+    //   flat_map(const flat_map& original);
+    //   flat_map(const flat_map& original, const A& allocator);
+    //   flat_map& operator=(const flat_map& rhs);
+    //   void swap(flat_map& other);
+    //   bool operator==(const flat_map& lhs, const flat_map& rhs);
+    //   bool operator!=(const flat_map& lhs, const flat_map& rhs);
+    //   void swap(flat_map& a, flat_map& b);
+    // ------------------------------------------------------------------------
+
+    static const char *SPECS[] = {
+        "", "A", "B", "AB", "ABC", "ABD", "ABCDEFGH", "BCDEFGHI"
+    };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        for (int tj = 0; tj < NUM_SPECS; ++tj) {
+            const char *SPEC1 = SPECS[ti];
+            const char *SPEC2 = SPECS[tj];
+
+            if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+            {
+                Obj mX(Comp(1), &oa);  const Obj& X = mX;  gg(&mX, SPEC1);
+                Obj mY(Comp(2), &oa);  const Obj& Y = mY;  gg(&mY, SPEC2);
+
+                ASSERTV(SPEC1, SPEC2, (ti == tj) == (X == Y));
+                ASSERTV(SPEC1, SPEC2, (ti != tj) == (X != Y));
+
+                if (ti == tj && !X.empty()) {
+                    ++mY.begin()->second;
+                    ASSERTV(SPEC1, SPEC2, X != Y);
+                    ASSERTV(SPEC1, SPEC2, !(X == Y));
+                    --mY.begin()->second;
+                }
+
+                // Copy construction.
+
+                {
+                    const Obj C(X);
+                    ASSERTV(SPEC1, verify(C, SPEC1));
+                    ASSERTV(SPEC1, X == C);
+                    ASSERTV(SPEC1, 1 == C.key_comp().id());
+                    ASSERTV(SPEC1, &da == C.get_allocator().mechanism());
+
+                    const Obj D(X, &za);
+                    ASSERTV(SPEC1, verify(D, SPEC1));
+                    ASSERTV(SPEC1, X == D);
+                    ASSERTV(SPEC1, 1 == D.key_comp().id());
+                    ASSERTV(SPEC1, &za == D.get_allocator().mechanism());
+                }
+
+                // Assignment.
+
+                {
+                    Obj mZ(Comp(3), &za);  const Obj& Z = mZ;
+                    gg(&mZ, SPEC2);
+
+                    Obj *mR = &(mZ = X);
+                    ASSERTV(SPEC1, SPEC2, mR == &mZ);
+                    ASSERTV(SPEC1, SPEC2, X == Z);
+                    ASSERTV(SPEC1, SPEC2, 1 == Z.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2,
+                            &za == Z.get_allocator().mechanism());
+
+                    mZ = Z;
+                    ASSERTV(SPEC1, SPEC2, X == Z);
+                }
+
+                // Swap with the same allocator.
+
+                {
+                    const bsls::Types::Int64 NUM_ALLOCS = oa.numBlocksTotal();
+
+                    mX.swap(mY);
+                    ASSERTV(SPEC1, SPEC2, verify(X, SPEC2));
+                    ASSERTV(SPEC1, SPEC2, verify(Y, SPEC1));
+                    ASSERTV(SPEC1, SPEC2, 2 == X.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2, 1 == Y.key_comp().id());
+
+                    swap(mX, mY);
+                    ASSERTV(SPEC1, SPEC2, verify(X, SPEC1));
+                    ASSERTV(SPEC1, SPEC2, verify(Y, SPEC2));
+                    ASSERTV(SPEC1, SPEC2, 1 == X.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2, 2 == Y.key_comp().id());
+
+                    ASSERTV(SPEC1, SPEC2, NUM_ALLOCS == oa.numBlocksTotal());
+                }
+
+                // Swap with different allocators.
+
+                {
+                    Obj mZ(Comp(3), &za);  const Obj& Z = mZ;
+                    gg(&mZ, SPEC2);
+
+                    mX.swap(mZ);
+                    ASSERTV(SPEC1, SPEC2, verify(X, SPEC2));
+                    ASSERTV(SPEC1, SPEC2, verify(Z, SPEC1));
+                    ASSERTV(SPEC1, SPEC2, 3 == X.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2, 1 == Z.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2,
+                            &oa == X.get_allocator().mechanism());
+                    ASSERTV(SPEC1, SPEC2,
+                            &za == Z.get_allocator().mechanism());
+                }
+            }
+            ASSERTV(SPEC1, SPEC2, 0 == oa.numBlocksInUse());
+            ASSERTV(SPEC1, SPEC2, 0 == za.numBlocksInUse());
+        }
+    }
+    ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // RANGE CONSTRUCTION AND BULK INSERTION
+    //
+    // Concerns:
+    //: 1 The range constructor creates a map holding one of each set of
+    //:   pairs of the range having equivalent keys, in order.
+    //:
+    //: 2 The range 'insert' adds the pairs of the range whose keys are not
+    //:   equivalent to keys already in the map, keeps the pairs sorted, and
+    //:   does not change the mapped values of the pairs already present.
+    //:
+    //: 3 The 'sorted_unique' overloads accept strictly sorted ranges and
+    //:   produce the same result.
+    //:
+    //: 4 The comparator and allocator are those supplied, and the keys use
+    //:   the allocator of the map.
+    //
+    // Plan:
+    //: 1 For each row of a table of an initial spec, a range spec, and the
+    //:   expected result, create a map from the initial spec with the range
+    //:   constructor, insert the range, and verify the keys of the result,
+    //:   and that each mapped value is that of a pair of the range having the
+    //:   key, or, after the insertion, that of the pair already in the map.
+    //:   Repeat with the 'sorted_unique' overloads for rows whose specs are
+    //:   strictly sorted.  Verify that no memory from the default allocator
+    //:   remains in use.  (C-1..4)
+    //
+    // Testing:
+    //   flat_map(ITER first, ITER last, const C& comparator, const A&);
+    //   flat_map(sorted_unique_t, ITER first, ITER last, const C&, const A&);
+    //   void insert(ITER first, ITER last);
+    //   void insert(sorted_unique_t, ITER first, ITER last);
+    // ------------------------------------------------------------------------
+
+    static const struct {
+        int         d_line;      // source line number
+        const char *d_initial;   // keys of the range constructor
+        const char *d_range;     // keys of the range to insert
+        const char *d_result;    // expected keys after the insertion
+    } DATA[] = {
+        //LINE  INITIAL      RANGE        RESULT
+        //----  -----------  -----------  -----------
+        { L_,   "",          "",          ""          },
+        { L_,   "",          "A",         "A"         },
+        { L_,   "A",         "",          "A"         },
+        { L_,   "A",         "A",         "A"         },
+        { L_,   "AB",        "CD",        "ABCD"      },
+        { L_,   "CD",        "AB",        "ABCD"      },
+        { L_,   "AC",        "BD",        "ABCD"      },
+        { L_,   "BD",        "AC",        "ABCD"      },
+        { L_,   "ACE",       "ABCDEF",    "ABCDEF"    },
+        { L_,   "DCBA",      "HGFE",      "ABCDEFGH"  },
+        { L_,   "ABAB",      "BABA",      "AB"        },
+        { L_,   "QWERTY",    "ASDFGH",    "ADEFGHQRSTWY" },
+        { L_,   "ZZZZ",      "AAAA",      "AZ"        },
+        { L_,   "MJKL",      "JKLMNJ",    "JKLMN"     },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int   LINE    = DATA[ti].d_line;
+        const char *INITIAL = DATA[ti].d_initial;
+        const char *RANGE   = DATA[ti].d_range;
+        const char *RESULT  = DATA[ti].d_result;
+
+        if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P_(RANGE) P(RESULT) }
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bsl::vector<Pair> initial(&sa);  fill(&initial, INITIAL);
+        bsl::vector<Pair> range(&sa);    fill(&range,   RANGE);
+
+        // The keys of 'INITIAL', each mapped to the position of its first
+        // occurrence.
+
+        Obj mE(&sa);  const Obj& E = mE;  gg(&mE, INITIAL);
+
+        {
+            Obj mX(initial.begin(), initial.end(), Comp(4), &oa);
+            const Obj& X = mX;
+
+            ASSERTV(LINE, sameKeys(X, E));
+            ASSERTV(LINE, checkMapped(X, INITIAL));
+            ASSERTV(LINE, 4 == X.key_comp().id());
+            ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+
+            const Obj Y(X, &sa);
+
+            mX.insert(range.begin(), range.end());
+            ASSERTV(LINE, verify(X, RESULT));
+            ASSERTV(LINE, checkMerged(X, Y, RANGE));
+
+            // Inserting an empty range has no effect.
+
+            const Obj Z(X, &sa);
+
+            mX.insert(range.begin(), range.begin());
+            ASSERTV(LINE, X == Z);
+        }
+
+        const bool INITIAL_SORTED = Util::isStrictlySorted(
+                                                     initial.begin(),
+                                                     initial.end(),
+                                                     E.value_comp());
+        const bool RANGE_SORTED   = Util::isStrictlySorted(
+                                                     range.begin(),
+                                                     range.end(),
+                                                     E.value_comp());
+
+        if (INITIAL_SORTED) {
+            Obj mX(bsl::sorted_unique,
+                   initial.begin(),
+                   initial.end(),
+                   Comp(5),
+                   &oa);
+            const Obj& X = mX;
+
+            ASSERTV(LINE, X == E);
+            ASSERTV(LINE, 5 == X.key_comp().id());
+            ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+
+            if (RANGE_SORTED) {
+                mX.insert(bsl::sorted_unique, range.begin(), range.end());
+                ASSERTV(LINE, verify(X, RESULT));
+                ASSERTV(LINE, checkMerged(X, E, RANGE));
+            }
+        }
+
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        ASSERTV(LINE, da.numBlocksInUse(), 0 == da.numBlocksInUse());
+    }
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase6()
+{
+    // ------------------------------------------------------------------------
+    // ELEMENT ACCESS, HINTED INSERTION, AND ERASURE
+    //
+    // Concerns:
+    //: 1 'operator[]' returns a reference to the mapped value of the key,
+    //:   first inserting a pair having the key and a value-initialized mapped
+    //:   value, at its sorted position, if the key is not present.
+    //:
+    //: 2 'at' returns a reference to the mapped value of the key if the key is
+    //:   present, and throws 'std::out_of_range' otherwise, without changing
+    //:   the map.
+    //:
+    //: 3 'insert' with a hint inserts a pair whose key is not already present
+    //:   at its sorted position, whether or not the hint is correct, and
+    //:   returns an iterator to the pair having the key.
+    //:
+    //: 4 Each 'erase' overload removes the expected pairs and returns the
+    //:   expected iterator or count.
+    //
+    // Plan:
+    //: 1 For each spec in a table and each key from 'A' to 'H', access the key
+    //:   with 'operator[]' and 'at', and verify the results and the value of
+    //:   the map.  (C-1..2)
+    //:
+    //: 2 For each spec in a table and each key from 'A' to 'H', insert a pair
+    //:   having the key with each valid hint, and verify the result against
+    //:   the unhinted insertion.  (C-3)
+    //:
+    //: 3 For each spec in a table, erase each position, each key from 'A' to
+    //:   'H', and each range of positions, and verify the results.  (C-4)
+    //
+    // Testing:
+    //   VALUE& operator[](const key_type& key);
+    //   VALUE& at(const key_type& key);
+    //   const VALUE& at(const key_type& key) const;
+    //   iterator insert(const_iterator hint, const value_type& value);
+    //   iterator erase(const_iterator position);
+    //   size_type erase(const key_type& key);
+    //   iterator erase(const_iterator first, const_iterator last);
+    // ------------------------------------------------------------------------
+
+    static const char *SPECS[] = { "", "A", "C", "BD", "ACEG", "BCDEFG" };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    if (verbose) printf("\tTesting 'operator[]' and 'at'.\n");
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        const char *SPEC = SPECS[ti];
+
+        Obj mE(&oa);  const Obj& E = mE;  gg(&mE, SPEC);
+
+        for (char c = 'A'; c <= 'H'; ++c) {
+            if (veryVerbose) { T_ P_(SPEC) P(c) }
+
+            const KEY   VALUE = TTF::create<KEY>(c);
+            const char *FOUND = strchr(SPEC, c);
+
+            Obj mX(E, &oa);  const Obj& X = mX;
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool threw = false;
+            try {
+                const int& R = X.at(VALUE);
+                ASSERTV(SPEC, c, FOUND);
+                ASSERTV(SPEC, c, FOUND - SPEC == R);
+            }
+            catch (const std::out_of_range&) {
+                threw = true;
+            }
+            ASSERTV(SPEC, c, !FOUND == threw);
+
+            threw = false;
+            try {
+                int& R = mX.at(VALUE);
+                ASSERTV(SPEC, c, FOUND);
+                ASSERTV(SPEC, c, &R == &X.find(VALUE)->second);
+            }
+            catch (const std::out_of_range&) {
+                threw = true;
+            }
+            ASSERTV(SPEC, c, !FOUND == threw);
+            ASSERTV(SPEC, c, X == E);
+#endif
+
+            int& R = mX[VALUE];
+            ASSERTV(SPEC, c, X.contains(VALUE));
+            ASSERTV(SPEC, c, &R == &X.find(VALUE)->second);
+            ASSERTV(SPEC, c, (FOUND ? FOUND - SPEC : 0) == R);
+            ASSERTV(SPEC, c, E.size() + !FOUND == X.size());
+            ASSERTV(SPEC, c, Util::isStrictlySorted(X.begin(),
+                                                    X.end(),
+                                                    X.value_comp()));
+
+            R = 42;
+            ASSERTV(SPEC, c, 42 == X.at(VALUE));
+            ASSERTV(SPEC, c, 42 == mX[VALUE]);
+            ASSERTV(SPEC, c, E.size() + !FOUND == X.size());
+        }
+    }
+
+    if (verbose) printf("\tTesting 'insert' with a hint.\n");
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        const char *SPEC = SPECS[ti];
+
+        Obj mE(&oa);  const Obj& E = mE;  gg(&mE, SPEC);
+
+        for (char c = 'A'; c <= 'H'; ++c) {
+            const Pair VALUE(TTF::create<KEY>(c), 99);
+
+            Obj mY(E, &oa);  const Obj& Y = mY;
+            mY.insert(VALUE);
+
+            for (size_t h = 0; h <= E.size(); ++h) {
+                if (veryVerbose) { T_ P_(SPEC) P_(c) P(h) }
+
+                Obj mX(E, &oa);  const Obj& X = mX;
+
+                const Iter R = mX.insert(X.begin() + h, VALUE);
+                ASSERTV(SPEC, c, h, X == Y);
+                ASSERTV(SPEC, c, h, X.end() != R);
+                ASSERTV(SPEC, c, h, c == TTF::getIdentifier<KEY>(R->first));
+            }
+        }
+    }
+
+    if (verbose) printf("\tTesting 'erase'.\n");
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        const char *SPEC = SPECS[ti];
+        const int   LEN  = static_cast<int>(strlen(SPEC));
+
+        Obj mE(&oa);  const Obj& E = mE;  gg(&mE, SPEC);
+
+        for (int i = 0; i < LEN; ++i) {
+            Obj mX(E, &oa);  const Obj& X = mX;
+
+            const Iter R = mX.erase(X.begin() + i);
+            ASSERTV(SPEC, i, X.begin() + i == R);
+            ASSERTV(SPEC, i, LEN - 1 == static_cast<int>(X.size()));
+            ASSERTV(SPEC, i, !X.contains(TTF::create<KEY>(SPEC[i])));
+        }
+
+        for (char c = 'A'; c <= 'H'; ++c) {
+            Obj mX(E, &oa);  const Obj& X = mX;
+
+            const bool FOUND = 0 != strchr(SPEC, c);
+            ASSERTV(SPEC, c, (FOUND ? 1u : 0u) ==
+                                              mX.erase(TTF::create<KEY>(c)));
+            ASSERTV(SPEC, c, !X.contains(TTF::create<KEY>(c)));
+            ASSERTV(SPEC, c, E.size() - (FOUND ? 1 : 0) == X.size());
+        }
+
+        for (int i = 0; i <= LEN; ++i) {
+            for (int j = i; j <= LEN; ++j) {
+                Obj mX(E, &oa);  const Obj& X = mX;
+
+                const Iter R = mX.erase(X.begin() + i, X.begin() + j);
+                ASSERTV(SPEC, i, j, X.begin() + i == R);
+                ASSERTV(SPEC, i, j, LEN - (j - i) ==
+                                               static_cast<int>(X.size()));
+                for (int k = 0; k < LEN; ++k) {
+                    const bool EXP = k < i || j <= k;
+                    ASSERTV(SPEC, i, j, k,
+                            EXP == X.contains(TTF::create<KEY>(SPEC[k])));
+                }
+            }
+        }
+    }
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Table of Reference Data
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we load a table of reference data (e.g., the number of decimal
+// places with which to display the price of each of a set of securities) from
+// a file at start-up, and look up the table many times thereafter.  Since the
+// table is built once, we hold it in a 'bsl::flat_map', which we build from
+// all of the records at once.
+//
+// First, we load the records, which are not in any particular order, into a
+// vector:
+//..
+  typedef bsl::pair<bsl::string, int> Record;
+
+  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+  bsl::vector<Record> records(&oa);
+  records.push_back(Record("IBM",  2));
+  records.push_back(Record("AAPL", 2));
+  records.push_back(Record("T",    3));
+  records.push_back(Record("BRK",  0));
+//..
+// Then, we build the table, which sorts the records once:
+//..
+  bsl::flat_map<bsl::string, int> places(records.begin(),
+                                         records.end(),
+                                         std::less<bsl::string>(),
+                                         &oa);
+  ASSERT(4      == places.size());
+  ASSERT("AAPL" == places.begin()->first);
+//..
+// Next, we look up some securities:
+//..
+  ASSERT(3 == places.at("T"));
+  ASSERT(places.end()  != places.find("BRK"));
+  ASSERT(places.end()  == places.find("MSFT"));
+//..
+// Now, we add a record for a security that was missing from the file, using
+// 'operator[]', which inserts an element for a key that is not present:
+//..
+  places["MSFT"] = 2;
+  ASSERT(5 == places.size());
+  ASSERT(2 == places.at("MSFT"));
+//..
+// Finally, we observe that the keys held by the map use the allocator of the
+// map:
+//..
+  ASSERT(&oa == places.begin()->first.get_allocator().mechanism());
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an allocation fails during 'insert(value)' or 'operator[]',
+        //:   the map is left in a valid state, and no memory is leaked.
+        //:
+        //: 2 If an allocation fails during the range constructor, no memory
+        //:   is leaked.
+        //:
+        //: 3 If an allocation fails during the range 'insert', the map is left
+        //:   in a valid state: its keys are strictly sorted.
+        //
+        // Plan:
+        //: 1 Using 'bsl::string' keys and mapped values long enough to
+        //:   allocate memory, perform each operation in the exception-test
+        //:   loop of 'bslma::TestAllocator', and verify the state of the map
+        //:   on each exception, and that no memory is leaked.  (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+        typedef bsl::flat_map<bsl::string, bsl::string> Obj;
+        typedef Obj::value_type                         Pair;
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bsl::vector<Pair> pairs(&sa);
+        for (char c = 'A'; c <= 'P'; ++c) {
+            pairs.push_back(Pair(bsl::string(40, c, &sa),
+                                 bsl::string(40, c + 'a' - 'A', &sa)));
+        }
+        bsl::vector<Pair> range(&sa);
+        for (int i = 0; i < 16; ++i) {
+            range.push_back(pairs[(i * 7) % 16]);
+        }
+
+        Obj mY(&sa);  const Obj& Y = mY;
+        for (int i = 0; i < 16; i += 2) {
+            mY.insert(pairs[i]);
+        }
+
+        if (verbose) printf("\tTesting 'insert(value)'.\n");
+        {
+            for (int i = 1; i < 16; i += 2) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    try {
+                        mX.insert(pairs[i]);
+                    }
+                    catch (...) {
+                        ASSERTV(i, Util::isStrictlySorted(X.begin(),
+                                                          X.end(),
+                                                          X.value_comp()));
+                        throw;
+                    }
+                    ASSERTV(i, Y.size() + 1 == X.size());
+                    ASSERTV(i, X.contains(pairs[i].first));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting 'operator[]'.\n");
+        {
+            for (int i = 1; i < 16; i += 2) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    try {
+                        mX[pairs[i].first] = pairs[i].second;
+                    }
+                    catch (...) {
+                        ASSERTV(i, Util::isStrictlySorted(X.begin(),
+                                                          X.end(),
+                                                          X.value_comp()));
+                        throw;
+                    }
+                    ASSERTV(i, Y.size() + 1 == X.size());
+                    ASSERTV(i, pairs[i].second == X.at(pairs[i].first));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range constructor.\n");
+        {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(range.begin(),
+                            range.end(),
+                            std::less<bsl::string>(),
+                            &oa);
+                ASSERTV(X.size(), 16 == X.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range 'insert'.\n");
+        {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                mX.insert(pairs.begin(), pairs.begin() + 8);
+
+                try {
+                    mX.insert(range.begin(), range.end());
+                }
+                catch (...) {
+                    ASSERT(Util::isStrictlySorted(X.begin(),
+                                                  X.end(),
+                                                  X.value_comp()));
+                    ASSERTV(X.size(), X.size() <= 16);
+                    throw;
+                }
+                ASSERTV(X.size(), 16 == X.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+#endif
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // RELATIONAL OPERATORS, CAPACITY, COMPARATORS, AND TRAITS
+        //
+        // Concerns:
+        //: 1 The relational operators compare maps lexicographically, by key
+        //:   and then by mapped value.
+        //:
+        //: 2 'reserve' increases the capacity, without changing the value;
+        //:   'shrink_to_fit' reduces the capacity to the size.
+        //:
+        //: 3 'key_comp' returns the comparator supplied at construction, and
+        //:   'value_comp' returns a comparator ordering pairs by key using it.
+        //:
+        //: 4 A function pointer may be used as the comparator.
+        //:
+        //: 5 The map has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 For each pair of specs in a table, compare maps of 'int' keys and
+        //:   mapped values, and verify the results against the
+        //:   lexicographical comparison of the specs.  (C-1)
+        //:
+        //: 2 Reserve and shrink a map, and verify its capacity and value.
+        //:   (C-2)
+        //:
+        //: 3 Create maps with stateful and function-pointer comparators, and
+        //:   verify the comparators and the ordering of the keys.  (C-3..4)
+        //:
+        //: 4 Verify the traits.  (C-5)
+        //
+        // Testing:
+        //   bool operator<(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator>(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator<=(const flat_map& lhs, const flat_map& rhs);
+        //   bool operator>=(const flat_map& lhs, const flat_map& rhs);
+        //   void reserve(size_type numElements);
+        //   void shrink_to_fit();
+        //   size_type max_size() const;
+        //   size_type capacity() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   TYPE TRAITS
+        //   FUNCTION-POINTER COMPARATOR
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRELATIONAL OPERATORS, CAPACITY, COMPARATORS,"
+                            " AND TRAITS"
+                            "\n============================================"
+                            "===========\n");
+
+        typedef bsl::flat_map<int, int> Obj;
+        typedef Obj::value_type         Pair;
+
+        if (verbose) printf("\tTesting relational operators.\n");
+        {
+            // Each character is a key; an uppercase letter is mapped to 0,
+            // and a lowercase letter to 1 (with the key of the uppercase
+            // letter).
+
+            static const char *SPECS[] = {
+                "", "A", "AB", "ABC", "ABD", "Ab", "AC", "a", "aB", "B", "BC"
+            };
+            const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+            for (int ti = 0; ti < NUM_SPECS; ++ti) {
+                for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                    Obj mX;  const Obj& X = mX;
+                    Obj mY;  const Obj& Y = mY;
+
+                    for (const char *s = SPECS[ti]; *s; ++s) {
+                        mX.insert(Pair(toupper(*s), !!islower(*s)));
+                    }
+                    for (const char *s = SPECS[tj]; *s; ++s) {
+                        mY.insert(Pair(toupper(*s), !!islower(*s)));
+                    }
+
+                    // The specs are listed in lexicographical order of the
+                    // pairs they describe.
+
+                    ASSERTV(ti, tj, (ti <  tj) == (X <  Y));
+                    ASSERTV(ti, tj, (ti >  tj) == (X >  Y));
+                    ASSERTV(ti, tj, (ti <= tj) == (X <= Y));
+                    ASSERTV(ti, tj, (ti >= tj) == (X >= Y));
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting capacity.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 < X.max_size());
+
+            mX.reserve(100);
+            ASSERTV(X.capacity(), 100 <= X.capacity());
+            ASSERTV(X.empty());
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numBlocksTotal();
+            for (int i = 100; i > 0; --i) {
+                mX[i] = -i;
+            }
+            ASSERTV(NUM_ALLOCS == oa.numBlocksTotal());
+            ASSERTV(X.size(), 100 == X.size());
+            ASSERTV(X.begin()->first,   1 == X.begin()->first);
+            ASSERTV(X.begin()->second, -1 == X.begin()->second);
+
+            mX.erase(X.begin() + 10, X.end());
+            mX.shrink_to_fit();
+            ASSERTV(X.capacity(), 10 == X.capacity());
+            ASSERTV(X.size(), 10 == X.size());
+        }
+
+        if (verbose) printf("\tTesting comparators.\n");
+        {
+            typedef bsl::flat_map<int, int, TestComparator<int> > CObj;
+
+            CObj mX(TestComparator<int>(9, false));  const CObj& X = mX;
+            ASSERTV(9 == X.key_comp().id());
+            ASSERTV(9 == X.value_comp().keyComparator().id());
+
+            for (int i = 0; i < 10; ++i) {
+                mX[i] = i;
+            }
+            ASSERTV(X.begin()->first, 9 == X.begin()->first);
+            ASSERT( X.value_comp()(*X.begin(), *X.rbegin()));
+            ASSERT(!X.value_comp()(*X.rbegin(), *X.begin()));
+
+            typedef bool (*FunctionPtr)(const int&, const int&);
+            typedef bsl::flat_map<int, int, FunctionPtr> FObj;
+
+            FObj mY(&lessThan);  const FObj& Y = mY;
+            ASSERT(&lessThan == Y.key_comp());
+            ASSERT(&lessThan == Y.value_comp().keyComparator());
+
+            static const int VALUES[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+            for (int i = 0; i < 8; ++i) {
+                mY[VALUES[i]] += 1;
+            }
+            ASSERTV(Y.size(), 7 == Y.size());
+            ASSERTV(Y.begin()->first,  1 == Y.begin()->first);
+            ASSERTV(Y.begin()->second, 2 == Y.begin()->second);
+            ASSERTV(Y.rbegin()->first, 9 == Y.rbegin()->first);
+            ASSERT(Y.contains(4));
+            ASSERT(!Y.contains(7));
+        }
+
+        if (verbose) printf("\tTesting traits.\n");
+        {
+            ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+            ASSERT(bslalg::HasStlIterators<Obj>::value);
+            typedef bsl::flat_map<int,
+                                  int,
+                                  std::less<int>,
+                                  std::allocator<Pair> > StdObj;
+            ASSERT(!bslma::UsesBslmaAllocator<StdObj>::value);
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS, HINTED INSERTION, AND ERASURE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nELEMENT ACCESS, HINTED INSERTION, AND ERASURE"
+                            "\n============================================="
+                            "\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase6,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RANGE CONSTRUCTION AND BULK INSERTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE CONSTRUCTION AND BULK INSERTION"
+                            "\n=====================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase5,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                            "\n====================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase4,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LOOKUP METHODS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP METHODS"
+                            "\n==============\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase3,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS"
+                            "\n====================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase2,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert, look up, and erase some pairs, and copy and
+        //:   compare the map.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::flat_map<int, int> Obj;
+        typedef Obj::value_type         Pair;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT( mX.insert(Pair(5, 50)).second);
+        ASSERT( mX.insert(Pair(1, 10)).second);
+        ASSERT( mX.insert(Pair(3, 30)).second);
+        ASSERT(!mX.insert(Pair(3, 31)).second);
+        ASSERTV(X.size(), 3 == X.size());
+
+        ASSERT(1  == X.begin()->first);
+        ASSERT(5  == X.rbegin()->first);
+        ASSERT(30 == X.at(3));
+        ASSERT(X.contains(3));
+        ASSERT(X.end() == X.find(2));
+        ASSERT(3 == X.lower_bound(2)->first);
+
+        mX[7] = 70;
+        ASSERT(4  == X.size());
+        ASSERT(70 == X.rbegin()->second);
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        ASSERT(1 == mX.erase(3));
+        ASSERT(0 == mX.erase(3));
+        ASSERT(X != Y);
+        ASSERT(X >  Y);
+
+        mY = X;
+        ASSERT(X == Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARED WITH 'bsl::map'
+        //   Compare the time taken to build a map of 'int' keys from a range
+        //   of unsorted pairs having unique keys, to look up keys (half of
+        //   which are in the map), and to iterate over the map, for
+        //   'bsl::flat_map' and 'bsl::map', and the memory used by each.
+        //   Optionally specify the number of elements in the map as the
+        //   second argument (1M by default).
+        //
+        // Testing:
+        //   PERFORMANCE COMPARED WITH 'bsl::map'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE COMPARED WITH 'bsl::map'"
+               "\n====================================\n");
+
+        typedef bsls::Types::Uint64             Uint64;
+        typedef bsl::flat_map<int, int>         FlatMap;
+        typedef bsl::map<int, int>              Map;
+        typedef bsl::pair<int, int>             Pair;
+
+        enum { k_NUM_LOOKUPS = 1 << 22 };
+
+        const int numElements = argc > 2 && atoi(argv[2]) > 0
+                              ? atoi(argv[2])
+                              : 1 << 20;
+
+        bslma::Allocator *alloc = &bslma::MallocFreeAllocator::singleton();
+
+        bsl::vector<Pair> pairs(alloc);
+        bsl::vector<int>  keys(alloc);
+        pairs.reserve(numElements);
+        keys.reserve(k_NUM_LOOKUPS);
+
+        // Multiplying by an odd constant (modulo 2^31) maps distinct indices
+        // to distinct keys, in no particular order.  The keys of the indices
+        // in '[0 .. numElements)' are in the map.
+
+        const Uint64 k_SPREAD = 0x9e3779b1ULL;
+        const Uint64 k_MASK   = 0x7fffffffULL;
+
+        for (int i = 0; i < numElements; ++i) {
+            pairs.push_back(Pair(static_cast<int>((i * k_SPREAD) & k_MASK),
+                                 i));
+        }
+
+        Uint64 state = 88172645463325252ULL;
+        for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            keys.push_back(static_cast<int>(
+                         ((state % (2 * numElements)) * k_SPREAD) & k_MASK));
+        }
+
+        bslma::TestAllocator fa("flat", veryVeryVeryVerbose);
+        bslma::TestAllocator ma("map",  veryVeryVeryVerbose);
+
+        bsls::Stopwatch timer;
+        double          flatTimes[3];
+        double          mapTimes[3];
+        Uint64          flatSum = 0;
+        Uint64          mapSum  = 0;
+
+        {
+            timer.start();
+            const FlatMap X(pairs.begin(), pairs.end(), std::less<int>(), &fa);
+            timer.stop();
+            flatTimes[0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+                FlatMap::const_iterator it = X.find(keys[i]);
+                flatSum += it != X.end() ? it->second : 0;
+            }
+            timer.stop();
+            flatTimes[1] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < 16; ++j) {
+                for (FlatMap::const_iterator it = X.begin();
+                     it != X.end();
+                     ++it) {
+                    flatSum += it->second;
+                }
+            }
+            timer.stop();
+            flatTimes[2] = timer.elapsedTime();
+            timer.reset();
+
+            printf("flat_map: size %d, %lld bytes in use\n",
+                   static_cast<int>(X.size()),
+                   fa.numBytesInUse());
+        }
+        {
+            timer.start();
+            const Map X(pairs.begin(), pairs.end(), std::less<int>(), &ma);
+            timer.stop();
+            mapTimes[0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+                Map::const_iterator it = X.find(keys[i]);
+                mapSum += it != X.end() ? it->second : 0;
+            }
+            timer.stop();
+            mapTimes[1] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < 16; ++j) {
+                for (Map::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    mapSum += it->second;
+                }
+            }
+            timer.stop();
+            mapTimes[2] = timer.elapsedTime();
+            timer.reset();
+
+            printf("map:      size %d, %lld bytes in use\n",
+                   static_cast<int>(X.size()),
+                   ma.numBytesInUse());
+        }
+
+        ASSERTV(flatSum, mapSum, flatSum == mapSum);
+
+        static const char *const NAMES[] = { "build", "find", "iterate" };
+        for (int i = 0; i < 3; ++i) {
+            printf("%-8s flat_map %8.4fs   map %8.4fs   ratio %5.2f\n",
+                   NAMES[i],
+                   flatTimes[i],
+                   mapTimes[i],
+                   mapTimes[i] / flatTimes[i]);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
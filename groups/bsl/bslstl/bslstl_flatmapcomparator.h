@@ -0,0 +1,289 @@
+// bslstl_flatmapcomparator.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMAPCOMPARATOR
+#define INCLUDED_BSLSTL_FLATMAPCOMPARATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a comparator for key-value pairs and lookup keys.
+//
+//@CLASSES:
+//   bslstl::FlatMapComparator: comparator for 'pair' objects and key objects
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatmultimap, bslstl_mapcomparator
+//
+//@DESCRIPTION: This component provides a functor adapter, 'FlatMapComparator',
+// that adapts a parameterized 'COMPARATOR' comparing objects of a
+// parameterized 'KEY' type into a functor comparing objects of type
+// 'bsl::pair<KEY, VALUE>' with each other, and with objects of 'KEY' type,
+// by their keys (i.e., their 'first' members).  Note that this functor was
+// designed to be supplied to the standard algorithms ('std::lower_bound',
+// 'std::sort', etc.), and to the functions of 'bslstl::SortedSequenceUtil',
+// primarily for the purpose of implementing the sorted "flat" map containers
+// (see 'bslstl_flatmap' and 'bslstl_flatmultimap'), which hold their
+// key-value pairs in a sorted 'bsl::vector'.
+//
+// As for 'bslstl::MapComparator', the (template parameter) type 'COMPARATOR'
+// may be a function pointer type, and an empty 'COMPARATOR' adds no space to
+// a 'FlatMapComparator' (or to a class that derives from it).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Sorted Vector of Pairs
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a vector of key-value pairs sorted by key, and we want to
+// find the value having a given key.
+//
+// First, we create the vector:
+//..
+//  typedef bsl::pair<int, const char *> Pair;
+//
+//  bsl::vector<Pair> pairs;
+//  pairs.push_back(Pair(1, "one"));
+//  pairs.push_back(Pair(3, "three"));
+//  pairs.push_back(Pair(5, "five"));
+//..
+// Then, we create a comparator for the pairs:
+//..
+//  typedef bslstl::FlatMapComparator<int, const char *, std::less<int> >
+//                                                                  Comparator;
+//  const Comparator comparator;
+//..
+// Now, we look up a key, using the comparator to compare the key with the
+// pairs:
+//..
+//  bsl::vector<Pair>::const_iterator it =
+//                 std::lower_bound(pairs.begin(), pairs.end(), 3, comparator);
+//  assert(pairs.end() != it);
+//  assert(0 == strcmp("three", it->second));
+//..
+// Finally, we observe that the same comparator orders the pairs themselves:
+//..
+//  assert( comparator(pairs[0], pairs[1]));
+//  assert(!comparator(pairs[1], pairs[0]));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_FUNCTORADAPTER
+#include <bslalg_functoradapter.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                       // =======================
+                       // class FlatMapComparator
+                       // =======================
+
+template <class KEY, class VALUE, class COMPARATOR>
+#ifdef BSLS_PLATFORM_CMP_MSVC
+// Visual C++ does not recognize the private inheritance of the comparator
+// ('FunctorAdapter<COMPARATOR>::Type') in derived classes, such as
+// 'bsl::flat_map::DataWrapper'.
+class FlatMapComparator : public bslalg::FunctorAdapter<COMPARATOR>::Type {
+#else
+class FlatMapComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
+#endif
+    // This class overloads the function-call operator to compare objects of
+    // type 'bsl::pair<KEY, VALUE>' with each other, and with objects of the
+    // parameterized 'KEY' type, by key, using a functor of the parameterized
+    // 'COMPARATOR' type.
+
+  public:
+    // TYPES
+    typedef bsl::pair<KEY, VALUE> ValueType;
+        // This alias represents the type of the key-value pairs compared by
+        // this comparator.
+
+    // CREATORS
+    FlatMapComparator();
+        // Create a 'FlatMapComparator' object that will use a default
+        // constructed 'COMPARATOR'.
+
+    explicit FlatMapComparator(const COMPARATOR& keyComparator);
+        // Create a 'FlatMapComparator' object holding a copy of the specified
+        // 'keyComparator'.
+
+    // FlatMapComparator(const FlatMapComparator& original) = default;
+        // Create a 'FlatMapComparator' object with the 'COMPARATOR' object of
+        // the specified 'original' object.
+
+    // ~FlatMapComparator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    // FlatMapComparator& operator=(const FlatMapComparator& rhs) = default;
+        // Assign to this object the 'COMPARATOR' object of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    void swap(FlatMapComparator& other);
+        // Efficiently exchange the value of this object with the value of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee.
+
+    COMPARATOR& keyComparator();
+        // Return a reference providing modifiable access to the function
+        // pointer or functor to which this comparator delegates comparison
+        // operations.
+
+    // ACCESSORS
+    bool operator()(const ValueType& lhs, const ValueType& rhs) const;
+        // Return 'true' if 'lhs.first' of the specified 'lhs' is less than
+        // (ordered before, according to the comparator held by this object)
+        // 'rhs.first' of the specified 'rhs', and 'false' otherwise.
+
+    bool operator()(const ValueType& lhs, const KEY& rhs) const;
+        // Return 'true' if 'lhs.first' of the specified 'lhs' is less than
+        // (ordered before, according to the comparator held by this object)
+        // the specified 'rhs', and 'false' otherwise.
+
+    bool operator()(const KEY& lhs, const ValueType& rhs) const;
+        // Return 'true' if the specified 'lhs' is less than (ordered before,
+        // according to the comparator held by this object) 'rhs.first' of the
+        // specified 'rhs', and 'false' otherwise.
+
+    const COMPARATOR& keyComparator() const;
+        // Return a reference providing non-modifiable access to the function
+        // pointer or functor to which this comparator delegates comparison
+        // operations.
+};
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(FlatMapComparator<KEY, VALUE, COMPARATOR>& a,
+          FlatMapComparator<KEY, VALUE, COMPARATOR>& b);
+    // Efficiently exchange the values of the specified 'a' and 'b' objects.
+    // This function provides the no-throw exception-safety guarantee.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                       // -----------------------
+                       // class FlatMapComparator
+                       // -----------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMapComparator<KEY, VALUE, COMPARATOR>::FlatMapComparator()
+: bslalg::FunctorAdapter<COMPARATOR>::Type()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMapComparator<KEY, VALUE, COMPARATOR>::FlatMapComparator(
+                                              const COMPARATOR& keyComparator)
+: bslalg::FunctorAdapter<COMPARATOR>::Type(keyComparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMapComparator<KEY, VALUE, COMPARATOR>::swap(
+                              FlatMapComparator<KEY, VALUE, COMPARATOR>& other)
+{
+    bslalg::SwapUtil::swap(
+      static_cast<typename bslalg::FunctorAdapter<COMPARATOR>::Type*>(this),
+      static_cast<typename bslalg::FunctorAdapter<COMPARATOR>::Type*>(
+                                                  BSLS_UTIL_ADDRESSOF(other)));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+COMPARATOR& FlatMapComparator<KEY, VALUE, COMPARATOR>::keyComparator()
+{
+    return *this;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                                   const ValueType& lhs,
+                                                   const ValueType& rhs) const
+{
+    return keyComparator()(lhs.first, rhs.first);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                                   const ValueType& lhs,
+                                                   const KEY&       rhs) const
+{
+    return keyComparator()(lhs.first, rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMapComparator<KEY, VALUE, COMPARATOR>::operator()(
+                                                   const KEY&       lhs,
+                                                   const ValueType& rhs) const
+{
+    return keyComparator()(lhs, rhs.first);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const COMPARATOR&
+FlatMapComparator<KEY, VALUE, COMPARATOR>::keyComparator() const
+{
+    return *this;
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void swap(FlatMapComparator<KEY, VALUE, COMPARATOR>& a,
+          FlatMapComparator<KEY, VALUE, COMPARATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
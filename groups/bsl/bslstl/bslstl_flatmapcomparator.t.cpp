@@ -0,0 +1,406 @@
+// bslstl_flatmapcomparator.t.cpp                                     -*-C++-*-
+#include <bslstl_flatmapcomparator.h>
+
+#include <bslstl_vector.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <algorithm>    // 'std::lower_bound'
+#include <functional>   // 'std::less', 'std::greater'
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>     // 'strcmp'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a functor adapter that compares key-value pairs
+// with each other and with keys, delegating to a key comparator.  We verify
+// that each overload of the function-call operator delegates to the key
+// comparator with the expected arguments, for comparators that are functors
+// (stateless and stateful) and function pointers, and that the key comparator
+// is copied, assigned, and swapped as expected.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatMapComparator();
+// [ 2] explicit FlatMapComparator(const COMPARATOR& keyComparator);
+// [ 2] FlatMapComparator(const FlatMapComparator& original);
+//
+// MANIPULATORS
+// [ 2] FlatMapComparator& operator=(const FlatMapComparator& rhs);
+// [ 3] void swap(FlatMapComparator& other);
+// [ 2] COMPARATOR& keyComparator();
+//
+// ACCESSORS
+// [ 1] bool operator()(const ValueType&, const ValueType&) const;
+// [ 1] bool operator()(const ValueType&, const KEY&) const;
+// [ 1] bool operator()(const KEY&, const ValueType&) const;
+// [ 2] const COMPARATOR& keyComparator() const;
+//
+// FREE FUNCTIONS
+// [ 3] void swap(FlatMapComparator& a, FlatMapComparator& b);
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+class ModuloLess {
+    // This class provides a stateful comparator that orders integers by their
+    // remainder modulo a divisor supplied at construction.
+
+    // DATA
+    int d_divisor;  // divisor
+
+  public:
+    // CREATORS
+    explicit ModuloLess(int divisor = 10)
+        // Create a comparator using the optionally specified 'divisor'.
+    : d_divisor(divisor)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the remainder of the specified 'lhs' is less than
+        // that of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs % d_divisor < rhs % d_divisor;
+    }
+
+    int divisor() const
+        // Return the divisor of this comparator.
+    {
+        return d_divisor;
+    }
+};
+
+bool intGreater(const int& lhs, const int& rhs)
+    // Return 'true' if the specified 'lhs' is greater than the specified
+    // 'rhs', and 'false' otherwise.
+{
+    return lhs > rhs;
+}
+
+typedef bsl::pair<int, const char *> Pair;
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Sorted Vector of Pairs
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a vector of key-value pairs sorted by key, and we want to
+// find the value having a given key.
+//
+// First, we create the vector:
+//..
+    typedef bsl::pair<int, const char *> Pair;
+
+    bsl::vector<Pair> pairs;
+    pairs.push_back(Pair(1, "one"));
+    pairs.push_back(Pair(3, "three"));
+    pairs.push_back(Pair(5, "five"));
+//..
+// Then, we create a comparator for the pairs:
+//..
+    typedef bslstl::FlatMapComparator<int, const char *, std::less<int> >
+                                                                    Comparator;
+    const Comparator comparator;
+//..
+// Now, we look up a key, using the comparator to compare the key with the
+// pairs:
+//..
+    bsl::vector<Pair>::const_iterator it =
+                   std::lower_bound(pairs.begin(), pairs.end(), 3, comparator);
+    ASSERT(pairs.end() != it);
+    ASSERT(0 == strcmp("three", it->second));
+//..
+// Finally, we observe that the same comparator orders the pairs themselves:
+//..
+    ASSERT( comparator(pairs[0], pairs[1]));
+    ASSERT(!comparator(pairs[1], pairs[0]));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SWAP
+        //
+        // Concerns:
+        //: 1 Both the member and free 'swap' exchange the key comparators of
+        //:   the two objects.
+        //:
+        //: 2 Swapping works for function-pointer comparators.
+        //
+        // Plan:
+        //: 1 Create two objects with stateful comparators having distinct
+        //:   states, swap them with each function, and verify the states.
+        //:   (C-1)
+        //:
+        //: 2 Repeat P-1 with function-pointer comparators.  (C-2)
+        //
+        // Testing:
+        //   void swap(FlatMapComparator& other);
+        //   void swap(FlatMapComparator& a, FlatMapComparator& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSWAP"
+                            "\n====\n");
+
+        typedef bslstl::FlatMapComparator<int, int, ModuloLess> Obj;
+
+        Obj mX(ModuloLess(3));  const Obj& X = mX;
+        Obj mY(ModuloLess(7));  const Obj& Y = mY;
+
+        mX.swap(mY);
+        ASSERTV(X.keyComparator().divisor(), 7 == X.keyComparator().divisor());
+        ASSERTV(Y.keyComparator().divisor(), 3 == Y.keyComparator().divisor());
+
+        swap(mX, mY);
+        ASSERTV(X.keyComparator().divisor(), 3 == X.keyComparator().divisor());
+        ASSERTV(Y.keyComparator().divisor(), 7 == Y.keyComparator().divisor());
+
+        typedef bool (*FunctionPtr)(const int&, const int&);
+        typedef bslstl::FlatMapComparator<int, int, FunctionPtr> FpObj;
+
+        FpObj mF(&intGreater);  const FpObj& F = mF;
+        FpObj mG(0);            const FpObj& G = mG;
+
+        mF.swap(mG);
+        ASSERT(0           == F.keyComparator());
+        ASSERT(&intGreater == G.keyComparator());
+
+        swap(mF, mG);
+        ASSERT(&intGreater == F.keyComparator());
+        ASSERT(0           == G.keyComparator());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, AND 'keyComparator'
+        //
+        // Concerns:
+        //: 1 The default constructor creates a default-constructed key
+        //:   comparator.
+        //:
+        //: 2 The value constructor, copy constructor, and copy-assignment
+        //:   operator copy the key comparator.
+        //:
+        //: 3 Both overloads of 'keyComparator' return a reference to the key
+        //:   comparator held by the object, and the reference returned by the
+        //:   non-'const' overload can be used to modify it.
+        //:
+        //: 4 An empty comparator adds no space.
+        //
+        // Plan:
+        //: 1 Create objects with a stateful comparator using each constructor
+        //:   and assignment, and verify the state of the key comparator.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that a comparator of an empty type is empty.  (C-4)
+        //
+        // Testing:
+        //   FlatMapComparator();
+        //   explicit FlatMapComparator(const COMPARATOR& keyComparator);
+        //   FlatMapComparator(const FlatMapComparator& original);
+        //   FlatMapComparator& operator=(const FlatMapComparator& rhs);
+        //   COMPARATOR& keyComparator();
+        //   const COMPARATOR& keyComparator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, ASSIGNMENT, AND 'keyComparator'"
+                            "\n=========================================\n");
+
+        typedef bslstl::FlatMapComparator<int, int, ModuloLess> Obj;
+
+        Obj mW;                 const Obj& W = mW;
+        ASSERTV(W.keyComparator().divisor(),
+                10 == W.keyComparator().divisor());
+
+        Obj mX(ModuloLess(3));  const Obj& X = mX;
+        ASSERTV(X.keyComparator().divisor(), 3 == X.keyComparator().divisor());
+
+        Obj mY(X);              const Obj& Y = mY;
+        ASSERTV(Y.keyComparator().divisor(), 3 == Y.keyComparator().divisor());
+
+        mW = X;
+        ASSERTV(W.keyComparator().divisor(), 3 == W.keyComparator().divisor());
+
+        mX.keyComparator() = ModuloLess(5);
+        ASSERTV(X.keyComparator().divisor(), 5 == X.keyComparator().divisor());
+        ASSERT(&mX.keyComparator() == &X.keyComparator());
+
+        typedef bslstl::FlatMapComparator<int, int, std::less<int> > EmptyObj;
+        ASSERTV(sizeof(EmptyObj), 1 == sizeof(EmptyObj));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // FUNCTION-CALL OPERATORS
+        //
+        // Concerns:
+        //: 1 Each overload of the function-call operator compares the keys of
+        //:   its arguments, in order, using the key comparator.
+        //:
+        //: 2 The 'second' members of the pairs are ignored.
+        //:
+        //: 3 The operators work with functor and function-pointer key
+        //:   comparators.
+        //
+        // Plan:
+        //: 1 For each pair of keys in a table, compare pairs and keys with
+        //:   each overload, for a default-constructed 'std::less', a stateful
+        //:   comparator, and a function pointer, and verify the results
+        //:   against the key comparator.  (C-1..3)
+        //
+        // Testing:
+        //   bool operator()(const ValueType&, const ValueType&) const;
+        //   bool operator()(const ValueType&, const KEY&) const;
+        //   bool operator()(const KEY&, const ValueType&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFUNCTION-CALL OPERATORS"
+                            "\n=======================\n");
+
+        typedef bool (*FunctionPtr)(const int&, const int&);
+
+        typedef bslstl::FlatMapComparator<int, const char *, std::less<int> >
+                                                                       LessObj;
+        typedef bslstl::FlatMapComparator<int, const char *, ModuloLess>
+                                                                     ModuloObj;
+        typedef bslstl::FlatMapComparator<int, const char *, FunctionPtr>
+                                                                         FpObj;
+
+        const LessObj   L;
+        const ModuloObj M(ModuloLess(4));
+        const FpObj     F(&intGreater);
+
+        const ModuloLess MODULO(4);
+
+        static const int KEYS[] = { -3, 0, 1, 2, 4, 5, 9, 13 };
+        const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            for (int j = 0; j < NUM_KEYS; ++j) {
+                const int  I = KEYS[i];
+                const int  J = KEYS[j];
+                const Pair PI(I, "lhs");
+                const Pair PJ(J, "rhs");
+
+                if (veryVerbose) { T_ P_(I) P(J) }
+
+                ASSERTV(I, J, (I < J) == L(PI, PJ));
+                ASSERTV(I, J, (I < J) == L(PI,  J));
+                ASSERTV(I, J, (I < J) == L( I, PJ));
+
+                ASSERTV(I, J, MODULO(I, J) == M(PI, PJ));
+                ASSERTV(I, J, MODULO(I, J) == M(PI,  J));
+                ASSERTV(I, J, MODULO(I, J) == M( I, PJ));
+
+                ASSERTV(I, J, (I > J) == F(PI, PJ));
+                ASSERTV(I, J, (I > J) == F(PI,  J));
+                ASSERTV(I, J, (I > J) == F( I, PJ));
+            }
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
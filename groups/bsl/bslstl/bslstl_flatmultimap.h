@@ -0,0 +1,1448 @@
+// bslstl_flatmultimap.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMULTIMAP
+#define INCLUDED_BSLSTL_FLATMULTIMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multimap container holding its pairs in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_multimap: multimap template implemented with a sorted vector
+//
+//@SEE_ALSO: bslstl_multimap, bslstl_flatmap, bslstl_sortedrangetag
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_multimap', implementing a container holding an ordered sequence
+// of key-value pairs (possibly having equivalent keys), with an interface
+// similar to that of 'bsl::multimap', but storing its pairs contiguously, in
+// key order, in a 'bsl::vector', rather than in the nodes of a balanced
+// binary tree.
+//
+// An instantiation of 'flat_multimap' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of key-value pairs) and
+// the ordered sequence of key-value pairs the 'flat_multimap' contains.  If
+// 'flat_multimap' is instantiated with a key type or mapped-value type that
+// is not itself value-semantic, then it will not retain all of its
+// value-semantic qualities.
+//
+// A 'flat_multimap' has the same advantages and drawbacks, compared with
+// 'bsl::multimap', as 'bsl::flat_map' has compared with 'bsl::map' (see
+// 'bslstl_flatmap'): it is compact, and fast to search, to iterate, and to
+// build in bulk, but inserting or erasing an individual element takes time
+// linear in the size of the container, and invalidates all iterators.  The
+// names of the container and of its 'sorted_equivalent' constructor and
+// 'insert' overloads are those of the 'std::flat_multimap' of C++23.
+//
+///Differences from 'bsl::multimap'
+///--------------------------------
+// As for 'bsl::flat_map', the 'value_type' of a 'flat_multimap' is
+// 'bsl::pair<KEY, VALUE>', not 'bsl::pair<const KEY, VALUE>', and the
+// behavior is undefined if the key of an element is modified, through an
+// iterator, such that the elements are no longer sorted by key.
+//
+// 'insert(value)' inserts 'value' after any pairs having an equivalent key,
+// as does 'bsl::multimap::insert'.  When a range of pairs is inserted, the
+// pairs are sorted (with 'std::stable_sort') before being merged with those of
+// the multimap, so that, as for 'bsl::multimap', the pairs of the range that
+// have equivalent keys keep their relative order, and follow any pairs having
+// an equivalent key that were already in the multimap.
+//
+///Requirements on 'KEY' and 'VALUE'
+///---------------------------------
+// A 'flat_multimap' is a fully "Value-Semantic Type" (see
+// {'bsldoc_glossary'}) only if the supplied 'KEY' and 'VALUE' template
+// parameters are fully value-semantic.  In addition to the requirements
+// imposed on the element type of 'bsl::vector', 'KEY' and 'VALUE' must be
+// "copy-assignable", as elements are moved within the vector as elements are
+// inserted and erased.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_multimap's 'ALLOCATOR' template parameter
+// determines how that multimap will allocate memory, and is supplied to the
+// underlying 'bsl::vector'.  If the (template parameter) type 'ALLOCATOR' of
+// a 'flat_multimap' instantiation is 'bsl::allocator' (the default), then
+// objects of that type will conform to the standard behavior of a
+// 'bslma'-allocator-enabled type: such a multimap accepts an optional
+// 'bslma::Allocator' argument at construction, uses it (or the default
+// allocator, if none is supplied) to supply memory throughout its lifetime,
+// and supplies it to the constructors of the keys and mapped values of
+// (template parameter) types 'KEY' and 'VALUE' having the
+// 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_multimap':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the multimap
+//  'V'             - (template parameter) type 'VALUE' of the multimap
+//  'a', 'b'        - two distinct objects of type 'flat_multimap<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'value_type'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  'N'             - distance(i1, i2)
+//  'e'             - number of elements in 'a' having a key equivalent to 'k'
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_multimap<K, V> a;    (default construction)   | O[1]               |
+//  | flat_multimap<K, V> a(al);                         |                    |
+//  | flat_multimap<K, V> a(c, al);                      |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multimap<K, V> a(b); (copy construction)      | O[n]               |
+//  | flat_multimap<K, V> a(b, al);                      |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multimap<K, V> a(i1, i2);                     | O[N] if [i1, i2)   |
+//  | flat_multimap<K, V> a(i1, i2, c, al);              | is sorted,         |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | flat_multimap<K, V> a(sorted_equivalent, i1, i2);  | O[N]               |
+//  | flat_multimap<K, V> a(sorted_equivalent, i1, i2,   |                    |
+//  |                       c, al);                      |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_multimap<K, V>(); (destruction)            | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;                    (assignment)             | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b, a < b, a <= b, a > b, a >= b       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a, b)                              | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.max_size(), a.empty(), a.capacity(),   | O[1]               |
+//  | a.get_allocator(), a.key_comp(), a.value_comp()    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(v), a.insert(p1, v)                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N * log(N)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_equivalent, i1, i2)                | O[n + N]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(k), a.erase(p1, p2)           | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(m), a.shrink_to_fit()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.contains(k), a.lower_bound(k),        | O[log(n)]          |
+//  | a.upper_bound(k), a.equal_range(k)                 |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.count(k)                                         | O[log(n) + e]      |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: An Index of Words
+/// - - - - - - - - - - - - - -
+// Suppose we want to index the lines of a document on which each of a set of
+// words appears.  Since the index is built once, and then searched, we hold
+// it in a 'bsl::flat_multimap', mapping each word to a line number, which we
+// build from all of the entries at once.
+//
+// First, we collect the entries, in the order in which the words appear in
+// the document:
+//..
+//  typedef bsl::pair<bsl::string, int> Entry;
+//
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  bsl::vector<Entry> entries(&oa);
+//  entries.push_back(Entry("vector", 1));
+//  entries.push_back(Entry("sorted", 1));
+//  entries.push_back(Entry("vector", 2));
+//  entries.push_back(Entry("map",    3));
+//  entries.push_back(Entry("vector", 3));
+//..
+// Then, we build the index, which sorts the entries once:
+//..
+//  typedef bsl::flat_multimap<bsl::string, int> Index;
+//
+//  Index index(entries.begin(), entries.end(), std::less<bsl::string>(), &oa);
+//  assert(5 == index.size());
+//..
+// Next, we find the lines on which a word appears.  Since the sort is stable,
+// the entries for a word are in the order in which they were collected:
+//..
+//  assert(3 == index.count("vector"));
+//
+//  bsl::pair<Index::const_iterator, Index::const_iterator> range =
+//                                                 index.equal_range("vector");
+//  int line = 0;
+//  for (Index::const_iterator it = range.first; it != range.second; ++it) {
+//      assert(++line == it->second);
+//  }
+//  assert(3 == line);
+//..
+// Now, we add an entry, which is inserted after the existing entries for the
+// word:
+//..
+//  Index::iterator it = index.insert(Entry("map", 5));
+//  assert(5 == it->second);
+//  assert(2 == index.count("map"));
+//  assert(3 == index.lower_bound("map")->second);
+//..
+// Finally, we observe that the keys held by the multimap use the allocator of
+// the multimap:
+//..
+//  assert(&oa == index.begin()->first.get_allocator().mechanism());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATMAPCOMPARATOR
+#include <bslstl_flatmapcomparator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SORTEDRANGETAG
+#include <bslstl_sortedrangetag.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SORTEDSEQUENCEUTIL
+#include <bslstl_sortedsequenceutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                           // ===================
+                           // class flat_multimap
+                           // ===================
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<bsl::pair<KEY, VALUE> > >
+class flat_multimap {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having possibly equivalent keys
+    // (of the template parameter type, 'KEY') and associated values (of the
+    // template parameter type, 'VALUE') in a 'bsl::vector' sorted by key.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef bsl::pair<KEY, VALUE>                               ValueType;
+        // This typedef is an alias for the type of key-value pair objects
+        // maintained by this multimap.
+
+    typedef bsl::vector<ValueType, ALLOCATOR>                   Container;
+        // This typedef is an alias for the type of the sorted sequence of
+        // key-value pairs held by this multimap.
+
+    typedef BloombergLP::bslstl::FlatMapComparator<KEY, VALUE, COMPARATOR>
+                                                                    Comparator;
+        // This typedef is an alias for the comparator used internally by this
+        // multimap, which compares key-value pairs with each other, and with
+        // keys.
+
+    typedef bsl::allocator_traits<ALLOCATOR>                   AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslstl::SortedSequenceUtil             SequenceUtil;
+        // This typedef is a convenient alias for the utility used to sort the
+        // key-value pairs held by this multimap.
+
+    struct DataWrapper : public Comparator {
+        // This struct is wrapper around the comparator and the vector of
+        // key-value pairs.  It takes advantage of the empty-base optimization
+        // (EBO) so that if the comparator is stateless, it takes up no space.
+
+        Container d_values;  // key-value pairs, sorted by key
+
+        DataWrapper(const COMPARATOR& comparator,
+                    const ALLOCATOR&  basicAllocator);
+            // Create a 'DataWrapper' object with the specified 'comparator'
+            // and an empty sequence of key-value pairs using the specified
+            // 'basicAllocator'.
+
+        DataWrapper(const COMPARATOR& comparator,
+                    const Container&  values,
+                    const ALLOCATOR&  basicAllocator);
+            // Create a 'DataWrapper' object with the specified 'comparator'
+            // and a copy of the specified 'values' using the specified
+            // 'basicAllocator'.
+    };
+
+    // DATA
+    DataWrapper d_data;  // comparator and sorted key-value pairs
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::pair<KEY, VALUE>                      value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef Comparator                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Container::iterator               iterator;
+    typedef typename Container::const_iterator         const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // PRIVATE MANIPULATORS
+    void quickSwap(flat_multimap& other);
+        // Efficiently exchange the value and comparator of this object with
+        // the value and comparator of the specified 'other' object.  This
+        // method provides the no-throw exception-safety guarantee.  The
+        // behavior is undefined unless this object was created with the same
+        // allocator as 'other'.
+
+    // PRIVATE ACCESSORS
+    const Comparator& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // comparator for this multimap.
+
+  public:
+    // CREATORS
+    explicit flat_multimap(const COMPARATOR& comparator     = COMPARATOR(),
+                           const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Construct an empty multimap.  Optionally specify a 'comparator' used
+        // to order key-value pairs contained in this object.  If 'comparator'
+        // is not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the 'ALLOCATOR' argument is of type
+        // 'bsl::allocator' (the default), then 'basicAllocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.  If the 'ALLOCATOR'
+        // argument is of type 'bsl::allocator' and 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used to
+        // supply memory.
+    : d_data(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to
+        // workaround an AIX compiler bug, where the constructor can fail to
+        // compile because it is unable to find the definition of the default
+        // argument.  This occurs when a templatized class wraps around the
+        // container and the comparator is defined after the new class.
+    }
+
+    explicit flat_multimap(const ALLOCATOR& basicAllocator);
+        // Construct an empty multimap that will use the specified
+        // 'basicAllocator' to supply memory.  Use a default-constructed object
+        // of the (template parameter) type 'COMPARATOR' to order the key-value
+        // pairs contained in this multimap.  If the template parameter
+        // 'ALLOCATOR' argument is of type 'bsl::allocator' (the default), then
+        // 'basicAllocator' shall be convertible to 'bslma::Allocator *'.
+
+    flat_multimap(const flat_multimap& original);
+        // Construct a multimap having the same value as the specified
+        // 'original'.  Use a copy of 'original.key_comp()' to order the
+        // key-value pairs contained in this multimap.  Use the allocator
+        // returned by 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  If the (template parameter) type 'ALLOCATOR' is of
+        // type 'bsl::allocator' (the default), the currently installed default
+        // allocator is used to supply memory.
+
+    flat_multimap(const flat_multimap& original,
+                  const ALLOCATOR&     basicAllocator);
+        // Construct a multimap having the same value as that of the specified
+        // 'original' that will use the specified 'basicAllocator' to supply
+        // memory.  Use a copy of 'original.key_comp()' to order the key-value
+        // pairs contained in this multimap.  If the template parameter
+        // 'ALLOCATOR' argument is of type 'bsl::allocator' (the default), then
+        // 'basicAllocator' shall be convertible to 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Construct a multimap holding each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element.  Pairs having
+        // equivalent keys keep their relative order in the sequence.
+        // Optionally specify a 'comparator' used to order key-value pairs
+        // contained in this object.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify the 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the template parameter 'ALLOCATOR' argument
+        // is of type 'bsl::allocator' (the default), then 'basicAllocator', if
+        // supplied, shall be convertible to 'bslma::Allocator *'.  The pairs
+        // are copied into this multimap, and then sorted once, so that this
+        // operation has 'O[N * log(N)]' complexity, or 'O[N]' complexity if
+        // the sequence is already sorted, where 'N' is the number of elements
+        // between 'first' and 'last'.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator     = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Construct a multimap holding each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element, in the order of the
+        // sequence, without sorting them.  Optionally specify a 'comparator'
+        // used to order key-value pairs contained in this object, and a
+        // 'basicAllocator' used to supply memory, as for the preceding
+        // constructor.  This operation has 'O[N]' complexity, where 'N' is the
+        // number of elements between 'first' and 'last'.  The behavior is
+        // undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last', and the
+        // sequence is sorted by key according to 'comparator'.
+
+    ~flat_multimap();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_multimap& operator=(const flat_multimap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The allocator of this object is unchanged.  This
+        // method provides the strong exception-safety guarantee.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or the 'end' iterator if this multimap
+        // is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this multimap.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or 'rend' if this multimap is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multimap.
+
+    iterator insert(const value_type& value);
+        // Insert the specified 'value' into this multimap, after any
+        // 'value_type' objects having a key equivalent to that of 'value', and
+        // return an iterator referring to the newly inserted object.  All
+        // iterators to this multimap are invalidated.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this multimap (in amortized
+        // constant time, plus the time to move the elements after the
+        // insertion point, if the specified 'hint' is a valid position at
+        // which to insert 'value'), and return an iterator referring to the
+        // newly inserted object.  'hint' is a valid position if 'value' may be
+        // inserted immediately before it without disordering the sequence of
+        // keys; 'value' is then inserted there, and is otherwise inserted as
+        // if by 'insert(value)'.  The behavior is undefined unless 'hint' is
+        // an iterator in the range '[begin() .. end()]' (both endpoints
+        // included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator.  The inserted
+        // objects follow any objects already in this multimap having
+        // equivalent keys, and the inserted objects having equivalent keys
+        // keep their relative order in the range.  The new objects are
+        // appended to those of this multimap, sorted once, and merged with the
+        // existing objects, so that this operation has 'O[n + N * log(N)]'
+        // complexity, where 'n' is the size of this multimap and 'N' is the
+        // number of elements in the range.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.  All iterators to this
+        // multimap are invalidated.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR first,
+                INPUT_ITERATOR last);
+        // Insert into this multimap the value of each 'value_type' object in
+        // the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, without sorting
+        // the range.  The inserted objects follow any objects already in this
+        // multimap having equivalent keys, and retain their relative order.
+        // This operation has 'O[n + N]' complexity, where 'n' is the size of
+        // this multimap and 'N' is the number of elements in the range.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last',
+        // and the sequence is sorted by key according to 'key_comp()'.  All
+        // iterators to this multimap are invalidated.
+
+    iterator erase(const_iterator position);
+        // Remove from this multimap the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last element in the sequence
+        // of elements maintained by this multimap.  The behavior is undefined
+        // unless 'position' refers to a 'value_type' object in this multimap.
+
+    size_type erase(const key_type& key);
+        // Remove from this multimap all 'value_type' objects whose keys are
+        // equivalent to the specified 'key', and return the number of objects
+        // removed.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multimap the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return an iterator referring to the element at
+        // 'last' after the removal.  The behavior is undefined unless 'first'
+        // and 'last' either refer to elements in this multimap or are the
+        // 'end' iterator, and the 'first' position is at or before the 'last'
+        // position in the ordered sequence provided by this container.
+
+    void swap(flat_multimap& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee if the allocators of the two objects
+        // compare equal, and the basic guarantee otherwise, in which case
+        // the elements of both objects are copied.
+
+    void clear();
+        // Remove all entries from this multimap (i.e., make the size of this
+        // multimap 0).  Note that the capacity of this multimap is unchanged.
+
+    void reserve(size_type numElements);
+        // Change the capacity of this multimap to at least the specified
+        // 'numElements', so that that many elements can be held without
+        // allocating memory.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this multimap to its size, if possible.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this multimap does not contain such an object.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this multimap whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this multimap does not contain such an object.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this multimap
+        // contains no such objects, then the two iterators will both be
+        // positioned at the point at which an object having 'key' would be
+        // inserted.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // multimap.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this multimap, or the 'end' iterator if this multimap
+        // is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this multimap.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this multimap, or 'rend' if this multimap is
+        // empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this multimap.
+
+    bool empty() const;
+        // Return 'true' if this multimap contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this multimap.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this multimap could possibly hold.  Note that there is no
+        // guarantee that the multimap can successfully grow to the returned
+        // size, or even close to that size without running out of resources.
+
+    size_type capacity() const;
+        // Return the number of elements this multimap can hold without
+        // allocating memory.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // multimap; if a comparator was supplied at construction, return its
+        // value, otherwise return a default constructed 'key_compare' object.
+        // Note that this comparator compares objects of type 'KEY', which is
+        // the key part of the 'value_type' objects contained in this multimap.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by comparing
+        // their respective keys using 'key_comp()'.  Note that this
+        // comparator compares objects of type 'value_type' (i.e.,
+        // 'bsl::pair<KEY, VALUE>').
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this multimap whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this multimap whose
+        // keys are equivalent to the specified 'key'.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this multimap contains a 'value_type' object whose
+        // key is equivalent to the specified 'key', and 'false' otherwise.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater-than or equal-to the specified 'key', and the
+        // past-the-end iterator if this multimap does not contain such an
+        // object.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this multimap whose key
+        // is greater than the specified 'key', and the past-the-end iterator
+        // if this multimap does not contain such an object.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this multimap whose keys are
+        // equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence, and the second is
+        // positioned one past the end of the sequence.  If this multimap
+        // contains no such objects, then the two iterators will both be
+        // positioned at the point at which an object having 'key' would be
+        // inserted.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_multimap' objects have the same
+    // value if they have the same number of key-value pairs, and each
+    // key-value pair in the ordered sequence of pairs of one has the same
+    // value as the corresponding pair in the ordered sequence of pairs of the
+    // other.  This method requires that the (template parameter) types 'KEY'
+    // and 'VALUE' both be "equality-comparable".
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_multimap' objects do not
+    // have the same value if they do not have the same number of key-value
+    // pairs, or some key-value pair in the ordered sequence of pairs of one
+    // does not have the same value as the corresponding pair in the ordered
+    // sequence of pairs of the other.  This method requires that the
+    // (template parameter) types 'KEY' and 'VALUE' both be
+    // "equality-comparable".
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically less than that of the specified 'rhs' multimap, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of multimap 'lhs' is lexicographically less than that of
+    // multimap 'rhs' if 'true == *i < *j' for the first pair of corresponding
+    // iterator positions where '*i' and '*j' differ, or if
+    // 'rhs.size() > lhs.size()' and '*i == *j' at every position of 'lhs'.
+    // This method requires that 'operator<', inducing a total order, be
+    // defined for 'value_type'.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically greater than that of the specified 'rhs' multimap,
+    // and 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical comparison.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical comparison.
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // multimap, and 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical comparison.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the values and comparators of the specified 'a' and 'b'
+    // objects.  This function provides the no-throw exception-safety
+    // guarantee if the allocators of the two objects compare equal, and the
+    // basic guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class DataWrapper
+                             // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::DataWrapper::DataWrapper(
+                                        const COMPARATOR& comparator,
+                                        const ALLOCATOR&  basicAllocator)
+: Comparator(comparator)
+, d_values(basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::DataWrapper::DataWrapper(
+                                        const COMPARATOR& comparator,
+                                        const Container&  values,
+                                        const ALLOCATOR&  basicAllocator)
+: Comparator(comparator)
+, d_values(values, basicAllocator)
+{
+}
+
+                           // -------------------
+                           // class flat_multimap
+                           // -------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::quickSwap(
+                                                         flat_multimap& other)
+{
+    static_cast<Comparator&>(d_data).swap(other.d_data);
+    d_data.d_values.swap(other.d_data.d_values);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::Comparator&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_data;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                              const ALLOCATOR& basicAllocator)
+: d_data(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                                const flat_multimap& original)
+: d_data(original.key_comp(),
+         original.d_data.d_values,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                  original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                          const flat_multimap& original,
+                                          const ALLOCATOR&     basicAllocator)
+: d_data(original.key_comp(), original.d_data.d_values, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_data(comparator, basicAllocator)
+{
+    d_data.d_values.assign(first, last);
+    SequenceUtil::sortSuffix(&d_data.d_values, 0, this->comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            sorted_equivalent_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_data(comparator, basicAllocator)
+{
+    d_data.d_values.assign(first, last);
+
+    BSLS_ASSERT_SAFE(SequenceUtil::isSorted(d_data.d_values.begin(),
+                                            d_data.d_values.end(),
+                                            this->comparator()));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::~flat_multimap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                                     const flat_multimap& rhs)
+{
+    if (this != BSLS_UTIL_ADDRESSOF(rhs)) {
+        flat_multimap other(rhs, get_allocator());
+        quickSwap(other);
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_data.d_values.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_data.d_values.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                       const value_type& value)
+{
+    return d_data.d_values.insert(upper_bound(value.first), value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                      const_iterator    hint,
+                                                      const value_type& value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint && hint <= cend());
+
+    if ((hint == cend()   || !comparator()(*hint, value))
+     && (hint == cbegin() || !comparator()(value, *(hint - 1)))) {
+        return d_data.d_values.insert(hint, value);                   // RETURN
+    }
+    return insert(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    const size_type position = size();
+    d_data.d_values.insert(d_data.d_values.end(), first, last);
+    SequenceUtil::sortSuffix(&d_data.d_values, position, comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                   sorted_equivalent_t,
+                                                   INPUT_ITERATOR first,
+                                                   INPUT_ITERATOR last)
+{
+    // Since the appended values are sorted, 'sortSuffix' merely verifies that
+    // they are sorted (in linear time) before merging them.  The merge is
+    // stable, so the appended values follow the existing values having
+    // equivalent keys, in their original order.
+
+    const size_type position = size();
+    d_data.d_values.insert(d_data.d_values.end(), first, last);
+
+    BSLS_ASSERT_SAFE(SequenceUtil::isSorted(
+                                            d_data.d_values.begin() + position,
+                                            d_data.d_values.end(),
+                                            comparator()));
+
+    SequenceUtil::sortSuffix(&d_data.d_values, position, comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(
+                                                      const_iterator position)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position && position < cend());
+
+    return d_data.d_values.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const pair<iterator, iterator> range = equal_range(key);
+    const size_type numErased = range.second - range.first;
+    d_data.d_values.erase(range.first, range.second);
+    return numErased;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                        const_iterator last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= first && first <= last && last <= cend());
+
+    return d_data.d_values.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(
+                                                          flat_multimap& other)
+{
+    // Swap the elements first: if the allocators differ, 'vector::swap'
+    // copies the elements (and may throw), whereas swapping the comparators
+    // cannot throw.
+
+    d_data.d_values.swap(other.d_data.d_values);
+    static_cast<Comparator&>(d_data).swap(other.d_data);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_data.d_values.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                        size_type numElements)
+{
+    d_data.d_values.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_data.d_values.shrink_to_fit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    iterator position = lower_bound(key);
+    return position != end() && !comparator()(key, *position)
+           ? position
+           : end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                          const key_type& key)
+{
+    return std::lower_bound(begin(), end(), key, comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                          const key_type& key)
+{
+    return std::upper_bound(begin(), end(), key, comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                          const key_type& key)
+{
+    return std::equal_range(begin(), end(), key, comparator());
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_data.d_values.get_allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_data.d_values.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_data.d_values.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                        const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                        const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                        const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                        const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_data.d_values.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_data.d_values.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_data.d_values.max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_data.d_values.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return comparator().keyComparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(
+                                                    const key_type& key) const
+{
+    const_iterator position = lower_bound(key);
+    return position != end() && !comparator()(key, *position)
+           ? position
+           : end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(
+                                                    const key_type& key) const
+{
+    const pair<const_iterator, const_iterator> range = equal_range(key);
+    return range.second - range.first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                    const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                    const key_type& key) const
+{
+    return std::lower_bound(begin(), end(), key, comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                    const key_type& key) const
+{
+    return std::upper_bound(begin(), end(), key, comparator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                    const key_type& key) const
+{
+    return std::equal_range(begin(), end(), key, comparator());
+}
+
+}  // close namespace bsl
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+            const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                       bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
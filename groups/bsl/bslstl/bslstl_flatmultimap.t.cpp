@@ -0,0 +1,1634 @@
+// bslstl_flatmultimap.t.cpp                                          -*-C++-*-
+#include <bslstl_flatmultimap.h>
+
+#include <bslstl_string.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <bsltf_templatetestfacility.h>
+
+#include <algorithm>    // 'std::equal'
+#include <functional>   // 'std::less'
+
+#include <ctype.h>      // 'islower', 'toupper'
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>     // 'strlen'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container,
+// 'bsl::flat_multimap', that holds its key-value pairs, possibly having
+// equivalent keys, in a 'bsl::vector' sorted by key.  The primary
+// manipulators are the default constructor, 'insert(value)', and 'clear'; the
+// basic accessors are 'begin', 'end', 'size', and 'get_allocator'.  Most test
+// cases are instantiated, through 'RUN_EACH_TYPE', for each of the "regular"
+// test types of 'bsltf_templatetestfacility' as the key type, ordered by a
+// comparator that orders objects of those types by their identifiers, with
+// 'int' as the mapped type.  The values of the multimaps used in the tests are
+// described by strings of uppercase letters, each letter standing for the key
+// having that identifier; unless otherwise stated, the mapped value of each
+// pair is the position of its letter in the string, so that the relative
+// order of pairs having equivalent keys can be verified.  In addition to
+// verifying the value of each multimap, we verify, with test allocators, that
+// all memory is supplied by the allocator of the multimap, and that no memory
+// is leaked when an exception is thrown.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_multimap(const C& comparator = C(), const A& allocator = A());
+// [ 2] flat_multimap(const A& allocator);
+// [ 4] flat_multimap(const flat_multimap& original);
+// [ 4] flat_multimap(const flat_multimap& original, const A& allocator);
+// [ 5] flat_multimap(ITER first, ITER last, const C& comparator, const A&);
+// [ 5] flat_multimap(sorted_equivalent_t, ITER, ITER, const C&, const A&);
+// [ 2] ~flat_multimap();
+//
+// MANIPULATORS
+// [ 4] flat_multimap& operator=(const flat_multimap& rhs);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] reverse_iterator rbegin();
+// [ 3] reverse_iterator rend();
+// [ 2] iterator insert(const value_type& value);
+// [ 6] iterator insert(const_iterator hint, const value_type& value);
+// [ 5] void insert(ITER first, ITER last);
+// [ 5] void insert(sorted_equivalent_t, ITER first, ITER last);
+// [ 6] iterator erase(const_iterator position);
+// [ 6] size_type erase(const key_type& key);
+// [ 6] iterator erase(const_iterator first, const_iterator last);
+// [ 4] void swap(flat_multimap& other);
+// [ 2] void clear();
+// [ 7] void reserve(size_type numElements);
+// [ 7] void shrink_to_fit();
+// [ 3] iterator find(const key_type& key);
+// [ 3] iterator lower_bound(const key_type& key);
+// [ 3] iterator upper_bound(const key_type& key);
+// [ 3] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 3] const_reverse_iterator rbegin() const;
+// [ 3] const_reverse_iterator rend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 7] size_type max_size() const;
+// [ 7] size_type capacity() const;
+// [ 7] key_compare key_comp() const;
+// [ 7] value_compare value_comp() const;
+// [ 3] const_iterator find(const key_type& key) const;
+// [ 3] size_type count(const key_type& key) const;
+// [ 3] bool contains(const key_type& key) const;
+// [ 3] const_iterator lower_bound(const key_type& key) const;
+// [ 3] const_iterator upper_bound(const key_type& key) const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const KEY&) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_multimap& lhs, const flat_multimap& rhs);
+// [ 4] bool operator!=(const flat_multimap& lhs, const flat_multimap& rhs);
+// [ 7] bool operator<(const flat_multimap&, const flat_multimap&);
+// [ 7] bool operator>(const flat_multimap&, const flat_multimap&);
+// [ 7] bool operator<=(const flat_multimap&, const flat_multimap&);
+// [ 7] bool operator>=(const flat_multimap&, const flat_multimap&);
+// [ 4] void swap(flat_multimap& a, flat_multimap& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] TYPE TRAITS
+// [ 7] FUNCTION-POINTER COMPARATOR
+// [ 8] EXCEPTION SAFETY
+// [ 9] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+#define RUN_EACH_TYPE BSLTF_TEMPLATETESTFACILITY_RUN_EACH_TYPE
+
+typedef bsltf::TemplateTestFacility TTF;
+typedef bslstl::SortedSequenceUtil  Util;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+                            // ====================
+                            // class TestComparator
+                            // ====================
+
+template <class TYPE>
+class TestComparator {
+    // This test class provides a comparator ordering objects of the
+    // parameterized 'TYPE' by their identifiers (see
+    // 'bsltf::TemplateTestFacility::getIdentifier'), in ascending or
+    // descending order, and identified by an integer supplied at
+    // construction.
+
+    // DATA
+    int  d_id;           // identifier of this comparator
+    bool d_compareLess;  // 'true' for ascending order
+
+  public:
+    // CREATORS
+    explicit TestComparator(int id = 0, bool compareLess = true)
+        // Create a comparator having the optionally specified 'id', that
+        // orders objects in ascending order unless the optionally specified
+        // 'compareLess' is 'false'.
+    : d_id(id)
+    , d_compareLess(compareLess)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        const int lhsId = TTF::getIdentifier<TYPE>(lhs);
+        const int rhsId = TTF::getIdentifier<TYPE>(rhs);
+
+        return d_compareLess ? lhsId < rhsId : rhsId < lhsId;
+    }
+
+    int id() const
+        // Return the identifier of this comparator.
+    {
+        return d_id;
+    }
+};
+
+bool lessThan(const int& lhs, const int& rhs)
+    // Return 'true' if the specified 'lhs' is less than the specified 'rhs',
+    // and 'false' otherwise.
+{
+    return lhs < rhs;
+}
+
+                              // ================
+                              // class TestDriver
+                              // ================
+
+template <class KEY>
+class TestDriver {
+    // This class template provides a namespace for testing
+    // 'bsl::flat_multimap' instantiated with the (template parameter) type
+    // 'KEY' and the mapped type 'int'.
+
+    // PRIVATE TYPES
+    typedef TestComparator<KEY>                    Comp;
+    typedef bsl::flat_multimap<KEY, int, Comp>     Obj;
+    typedef typename Obj::value_type               Pair;
+    typedef typename Obj::iterator                 Iter;
+    typedef typename Obj::const_iterator           CIter;
+
+    // PRIVATE CLASS METHODS
+    static void gg(Obj *object, const char *spec);
+        // Insert into the specified 'object' a pair for each character of the
+        // specified 'spec', having the key created from the character and the
+        // position of the character in 'spec' as its mapped value.
+
+    static bool verify(const Obj& object, const char *expected);
+        // Return 'true' if the sequence of keys of the specified 'object' has
+        // the identifiers given by the characters of the specified
+        // 'expected', in order, and 'false' otherwise.
+
+    static bool isInOrder(const Obj& object);
+        // Return 'true' if the mapped values of each sequence of pairs of the
+        // specified 'object' having equivalent keys are in increasing order,
+        // and 'false' otherwise.
+
+    static void fill(bsl::vector<Pair> *pairs, const char *spec);
+        // Append to the specified 'pairs' a pair for each character of the
+        // specified 'spec', having the key created from the character and the
+        // position of the character in 'spec' as its mapped value.
+
+    static bool checkMapped(CIter first, CIter last, const char *spec);
+        // Return 'true' if the mapped value of each pair in the specified
+        // range '[first .. last)' is the position in the specified 'spec' of a
+        // character that is the identifier of the key of the pair, and no two
+        // pairs in the range have the same mapped value, and 'false'
+        // otherwise.
+
+    static bool checkMerged(const Obj&  object,
+                            const Obj&  original,
+                            const char *spec);
+        // Return 'true' if, for each key, the sequence of pairs of the
+        // specified 'object' having the key starts with the sequence of pairs
+        // of the specified 'original' having the key, and the mapped values of
+        // the other pairs of 'object' satisfy 'checkMapped' for the specified
+        // 'spec', and 'false' otherwise.
+
+  public:
+    // CLASS METHODS
+    static void testCase2();
+        // Test primary manipulators.
+
+    static void testCase3();
+        // Test lookup methods.
+
+    static void testCase4();
+        // Test copy construction, assignment, swap, and equality.
+
+    static void testCase5();
+        // Test range construction and bulk insertion.
+
+    static void testCase6();
+        // Test hinted insertion and erasure.
+};
+
+                              // ----------------
+                              // class TestDriver
+                              // ----------------
+
+// PRIVATE CLASS METHODS
+template <class KEY>
+void TestDriver<KEY>::gg(Obj *object, const char *spec)
+{
+    for (int i = 0; spec[i]; ++i) {
+        object->insert(Pair(TTF::create<KEY>(spec[i]), i));
+    }
+}
+
+template <class KEY>
+bool TestDriver<KEY>::verify(const Obj& object, const char *expected)
+{
+    if (strlen(expected) != object.size()) {
+        return false;                                                 // RETURN
+    }
+    for (CIter it = object.begin(); it != object.end(); ++it, ++expected) {
+        if (*expected != TTF::getIdentifier<KEY>(it->first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY>
+bool TestDriver<KEY>::isInOrder(const Obj& object)
+{
+    for (CIter it = object.begin(); it != object.end(); ++it) {
+        if (it != object.begin()
+         && TTF::getIdentifier<KEY>(it->first)
+                                 == TTF::getIdentifier<KEY>((it - 1)->first)
+         && it->second <= (it - 1)->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY>
+void TestDriver<KEY>::fill(bsl::vector<Pair> *pairs, const char *spec)
+{
+    for (int i = 0; spec[i]; ++i) {
+        pairs->push_back(Pair(TTF::create<KEY>(spec[i]), i));
+    }
+}
+
+template <class KEY>
+bool TestDriver<KEY>::checkMapped(CIter first, CIter last, const char *spec)
+{
+    const int len = static_cast<int>(strlen(spec));
+    for (CIter it = first; it != last; ++it) {
+        if (it->second < 0 || it->second >= len
+         || spec[it->second] != TTF::getIdentifier<KEY>(it->first)) {
+            return false;                                             // RETURN
+        }
+        for (CIter other = first; other != it; ++other) {
+            if (other->second == it->second) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    return true;
+}
+
+template <class KEY>
+bool TestDriver<KEY>::checkMerged(const Obj&  object,
+                                  const Obj&  original,
+                                  const char *spec)
+{
+    Obj inserted(object, object.get_allocator());
+    for (CIter it = original.begin(); it != original.end(); ) {
+        const bsl::pair<CIter, CIter> expected =
+                                               original.equal_range(it->first);
+        const bsl::pair<CIter, CIter> actual = object.equal_range(it->first);
+
+        if (actual.second - actual.first < expected.second - expected.first
+         || !std::equal(expected.first, expected.second, actual.first)) {
+            return false;                                             // RETURN
+        }
+
+        // Remove the pairs of 'original' from 'inserted'.
+
+        const Iter position = inserted.lower_bound(it->first);
+        inserted.erase(position,
+                       position + (expected.second - expected.first));
+
+        it = expected.second;
+    }
+    return checkMapped(inserted.begin(), inserted.end(), spec);
+}
+
+// CLASS METHODS
+template <class KEY>
+void TestDriver<KEY>::testCase2()
+{
+    // ------------------------------------------------------------------------
+    // PRIMARY MANIPULATORS
+    //
+    // Concerns:
+    //: 1 Each constructor creates an empty multimap using the expected
+    //:   comparator and allocator, without allocating memory.
+    //:
+    //: 2 'insert' adds every pair, keeps the pairs sorted by key, and returns
+    //:   an iterator to the inserted pair.
+    //:
+    //: 3 'insert' places a pair after the pairs already present having
+    //:   equivalent keys.
+    //:
+    //: 4 'clear' removes all pairs, retaining the capacity.
+    //:
+    //: 5 All memory, including that of the keys, is supplied by the object
+    //:   allocator, and is released on destruction.
+    //:
+    //: 6 An empty comparator adds no space to the multimap.
+    //
+    // Plan:
+    //: 1 Create multimaps with each constructor, and verify their state and
+    //:   that no memory was allocated.  (C-1)
+    //:
+    //: 2 For each spec in a table, insert the pairs of the spec into a
+    //:   multimap created with a test allocator, verifying the iterator
+    //:   returned by each insertion, and verify the resulting sequence of keys
+    //:   and that the mapped values of pairs having equivalent keys are in
+    //:   the order of insertion.  Verify that no memory from the default
+    //:   allocator remains in use, and that no memory is in use after the
+    //:   multimap is destroyed.  (C-2, 3, 5)
+    //:
+    //: 3 Clear the multimap, and verify its state.  (C-4)
+    //:
+    //: 4 Compare the size of a multimap with that of a vector.  (C-6)
+    //
+    // Testing:
+    //   flat_multimap(const C& comparator = C(), const A& allocator = A());
+    //   flat_multimap(const A& allocator);
+    //   ~flat_multimap();
+    //   iterator insert(const value_type& value);
+    //   void clear();
+    //   allocator_type get_allocator() const;
+    //   const_iterator begin() const;
+    //   const_iterator end() const;
+    //   bool empty() const;
+    //   size_type size() const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const Obj W;
+        const Obj X(Comp(7), &oa);
+        const Obj Y(&oa);
+
+        ASSERT(W.empty());           ASSERT(0 == W.size());
+        ASSERT(X.empty());           ASSERT(0 == X.size());
+        ASSERT(Y.empty());           ASSERT(0 == Y.size());
+
+        ASSERT(W.begin() == W.end());
+
+        ASSERT(&da == W.get_allocator().mechanism());
+        ASSERT(&oa == X.get_allocator().mechanism());
+        ASSERT(&oa == Y.get_allocator().mechanism());
+
+        ASSERT(0 == W.key_comp().id());
+        ASSERT(7 == X.key_comp().id());
+        ASSERT(0 == Y.key_comp().id());
+
+        ASSERT(0 == da.numBlocksTotal());
+        ASSERT(0 == oa.numBlocksTotal());
+    }
+
+    static const struct {
+        int         d_line;      // source line number
+        const char *d_spec;      // keys to insert, in order
+        const char *d_result;    // expected keys, in order
+    } DATA[] = {
+        //LINE  SPEC         RESULT
+        //----  -----------  -----------
+        { L_,   "",          ""          },
+        { L_,   "A",         "A"         },
+        { L_,   "AA",        "AA"        },
+        { L_,   "AB",        "AB"        },
+        { L_,   "BA",        "AB"        },
+        { L_,   "CAB",       "ABC"       },
+        { L_,   "CABBAC",    "AABBCC"    },
+        { L_,   "EDCBA",     "ABCDE"     },
+        { L_,   "ACEGBDF",   "ABCDEFG"   },
+        { L_,   "GFAGFA",    "AAFFGG"    },
+        { L_,   "ZYXABCZ",   "ABCXYZZ"   },
+        { L_,   "AAAAAA",    "AAAAAA"    },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int   LINE   = DATA[ti].d_line;
+        const char *SPEC   = DATA[ti].d_spec;
+        const char *RESULT = DATA[ti].d_result;
+
+        if (veryVerbose) { T_ P_(LINE) P_(SPEC) P(RESULT) }
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bsl::vector<Pair>    values(&sa);
+        fill(&values, SPEC);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; SPEC[i]; ++i) {
+                const Pair& VALUE = values[i];
+                const Iter  R     = mX.insert(VALUE);
+
+                ASSERTV(LINE, i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(LINE, i, X.end() != R);
+                ASSERTV(LINE, i, VALUE == *R);
+
+                // The inserted pair follows those having equivalent keys.
+
+                ASSERTV(LINE, i, X.upper_bound(VALUE.first) == R + 1);
+            }
+
+            ASSERTV(LINE, verify(X, RESULT));
+            ASSERTV(LINE, isInOrder(X));
+            ASSERTV(LINE, (0 == *RESULT) == X.empty());
+            ASSERTV(LINE, da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+            const typename Obj::size_type CAPACITY = X.capacity();
+
+            mX.clear();
+            ASSERTV(LINE, X.empty());
+            ASSERTV(LINE, 0 == X.size());
+            ASSERTV(LINE, X.begin() == X.end());
+            ASSERTV(LINE, CAPACITY == X.capacity());
+        }
+        ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    }
+
+    ASSERTV(sizeof(bsl::flat_multimap<KEY, int>),
+            sizeof(bsl::vector<Pair>) == sizeof(bsl::flat_multimap<KEY, int>));
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // LOOKUP METHODS
+    //
+    // Concerns:
+    //: 1 'find', 'count', and 'contains' find a key if and only if an
+    //:   equivalent key is in the multimap, and 'count' returns the number of
+    //:   pairs having equivalent keys.
+    //:
+    //: 2 'find' returns the first pair having an equivalent key.
+    //:
+    //: 3 'lower_bound', 'upper_bound', and 'equal_range' return the positions
+    //:   of the first pair whose key is not ordered before, and the first pair
+    //:   whose key is ordered after, the key sought.
+    //:
+    //: 4 The lookup methods honor the ordering of the comparator.
+    //:
+    //: 5 The non-'const' lookup methods and iterators return the same
+    //:   positions as the 'const' ones, and provide modifiable access to the
+    //:   mapped values.
+    //:
+    //: 6 The reverse iterators traverse the pairs in reverse order.
+    //:
+    //: 7 The lookup methods do not allocate memory.
+    //
+    // Plan:
+    //: 1 For each spec in a table, create a multimap (ordered in ascending and
+    //:   in descending order), and look up each key from 'A' to 'Z' with the
+    //:   'const' and non-'const' methods, comparing the results against the
+    //:   positions of the key computed by a linear scan.  (C-1..5)
+    //:
+    //: 2 Modify the mapped value of each pair found, and verify the change
+    //:   through the 'const' iterators.  (C-5)
+    //:
+    //: 3 Traverse each multimap with the reverse iterators.  (C-6)
+    //:
+    //: 4 Verify that no memory was allocated by the lookups.  (C-7)
+    //
+    // Testing:
+    //   iterator begin();
+    //   iterator end();
+    //   reverse_iterator rbegin();
+    //   reverse_iterator rend();
+    //   iterator find(const key_type& key);
+    //   iterator lower_bound(const key_type& key);
+    //   iterator upper_bound(const key_type& key);
+    //   pair<iterator, iterator> equal_range(const key_type& key);
+    //   const_reverse_iterator rbegin() const;
+    //   const_reverse_iterator rend() const;
+    //   const_iterator find(const key_type& key) const;
+    //   size_type count(const key_type& key) const;
+    //   bool contains(const key_type& key) const;
+    //   const_iterator lower_bound(const key_type& key) const;
+    //   const_iterator upper_bound(const key_type& key) const;
+    //   pair<const_iterator, const_iterator> equal_range(const KEY&) const;
+    // ------------------------------------------------------------------------
+
+    static const char *SPECS[] = {
+        "", "A", "AA", "M", "ZZZ", "AB", "AZZ", "AACEE", "BDDDFHJ", "AEIMQUY",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ", "MAMBMCMDME"
+    };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        for (int order = 0; order < 2; ++order) {
+            const char *SPEC = SPECS[ti];
+            const bool  LESS = 0 == order;
+
+            if (veryVerbose) { T_ P_(SPEC) P(LESS) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(Comp(0, LESS), &oa);  const Obj& X = mX;
+            gg(&mX, SPEC);
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numBlocksTotal();
+
+            ASSERTV(SPEC, LESS, X.begin() == mX.begin());
+            ASSERTV(SPEC, LESS, X.end()   == mX.end());
+
+            for (char c = 'A'; c <= 'Z'; ++c) {
+                const KEY VALUE = TTF::create<KEY>(c);
+
+                // Compute the expected positions by a linear scan.
+
+                CIter exp = X.begin();
+                while (exp != X.end()
+                    && (LESS ? TTF::getIdentifier<KEY>(exp->first) < c
+                             : TTF::getIdentifier<KEY>(exp->first) > c)) {
+                    ++exp;
+                }
+                CIter expUpper = exp;
+                while (expUpper != X.end()
+                    && TTF::getIdentifier<KEY>(expUpper->first) == c) {
+                    ++expUpper;
+                }
+                const CIter     EXP_UPPER = expUpper;
+                const bool      FOUND     = exp != EXP_UPPER;
+                const ptrdiff_t COUNT     = EXP_UPPER - exp;
+
+                ASSERTV(SPEC, LESS, c, FOUND == X.contains(VALUE));
+                ASSERTV(SPEC, LESS, c,
+                        static_cast<size_t>(COUNT) == X.count(VALUE));
+                ASSERTV(SPEC, LESS, c,
+                        (FOUND ? exp : X.end()) == X.find(VALUE));
+                ASSERTV(SPEC, LESS, c, exp       == X.lower_bound(VALUE));
+                ASSERTV(SPEC, LESS, c, EXP_UPPER == X.upper_bound(VALUE));
+
+                const bsl::pair<CIter, CIter> R = X.equal_range(VALUE);
+                ASSERTV(SPEC, LESS, c, exp       == R.first);
+                ASSERTV(SPEC, LESS, c, EXP_UPPER == R.second);
+
+                const Iter MF = mX.find(VALUE);
+                ASSERTV(SPEC, LESS, c, CIter(MF) == X.find(VALUE));
+                ASSERTV(SPEC, LESS, c,
+                        CIter(mX.lower_bound(VALUE)) == exp);
+                ASSERTV(SPEC, LESS, c,
+                        CIter(mX.upper_bound(VALUE)) == EXP_UPPER);
+
+                const bsl::pair<Iter, Iter> MR = mX.equal_range(VALUE);
+                ASSERTV(SPEC, LESS, c, CIter(MR.first)  == exp);
+                ASSERTV(SPEC, LESS, c, CIter(MR.second) == EXP_UPPER);
+
+                if (FOUND) {
+                    MF->second = 100 + c;
+                    ASSERTV(SPEC, LESS, c, 100 + c == exp->second);
+                }
+            }
+
+            typename Obj::const_reverse_iterator rit = X.rbegin();
+            for (CIter it = X.end(); it != X.begin(); ++rit) {
+                --it;
+                ASSERTV(SPEC, LESS, X.rend() != rit);
+                ASSERTV(SPEC, LESS, &*it == &*rit);
+            }
+            ASSERTV(SPEC, LESS, X.rend() == rit);
+
+            typename Obj::reverse_iterator mrit = mX.rbegin();
+            for (Iter it = mX.end(); it != mX.begin(); ++mrit) {
+                --it;
+                ASSERTV(SPEC, LESS, mX.rend() != mrit);
+                ASSERTV(SPEC, LESS, &*it == &*mrit);
+            }
+            ASSERTV(SPEC, LESS, mX.rend() == mrit);
+
+            ASSERTV(SPEC, LESS, NUM_ALLOCS == oa.numBlocksTotal());
+        }
+    }
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+    //
+    // Concerns:
+    //: 1 The copy constructor creates a multimap having the value and
+    //:   comparator of the original, using the default allocator unless an
+    //:   allocator is supplied.
+    //:
+    //: 2 Assignment copies the value and comparator of the source, and does
+    //:   not change the allocator of the target.  Self-assignment has no
+    //:   effect.
+    //:
+    //: 3 'swap' exchanges the values and comparators, without allocating
+    //:   memory if the allocators are the same, and correctly if the
+    //:   allocators differ.
+    //:
+    //: 4 Two multimaps are equal if and only if they have the same sequence
+    //:   of keys and mapped values, including the order of the pairs having
+    //:   equivalent keys.
+    //:
+    //: 5 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For each pair of specs in a table, create multimaps having the
+    //:   values of the specs, and verify the results of the equality
+    //:   operators.  Change a mapped value of one of two equal multimaps, and
+    //:   verify that they are no longer equal.  (C-4)
+    //:
+    //: 2 For each pair, copy-construct, assign, and swap (with the same and
+    //:   different allocators), verifying the values, comparators, and
+    //:   allocators of the results, and the use of memory.  (C-1..3, 5)
+    //
+    // Testing:
+    //   flat_multimap(const flat_multimap& original);
+    //   flat_multimap(const flat_multimap& original, const A& allocator);
+    //   flat_multimap& operator=(const flat_multimap& rhs);
+    //   void swap(flat_multimap& other);
+    //   bool operator==(const flat_multimap& lhs, const flat_multimap& rhs);
+    //   bool operator!=(const flat_multimap& lhs, const flat_multimap& rhs);
+    //   void swap(flat_multimap& a, flat_multimap& b);
+    // ------------------------------------------------------------------------
+
+    // Specs having the same keys in a different order produce different
+    // mapped values, and so different multimaps.
+
+    static const char *SPECS[] = {
+        "", "A", "B", "AA", "AB", "BA", "ABB", "BAB", "ABC", "ABD",
+        "ABCDEFGH", "BCDEFGHI"
+    };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        for (int tj = 0; tj < NUM_SPECS; ++tj) {
+            const char *SPEC1 = SPECS[ti];
+            const char *SPEC2 = SPECS[tj];
+
+            if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+            {
+                Obj mX(Comp(1), &oa);  const Obj& X = mX;  gg(&mX, SPEC1);
+                Obj mY(Comp(2), &oa);  const Obj& Y = mY;  gg(&mY, SPEC2);
+
+                ASSERTV(SPEC1, SPEC2, (ti == tj) == (X == Y));
+                ASSERTV(SPEC1, SPEC2, (ti != tj) == (X != Y));
+
+                if (ti == tj && !X.empty()) {
+                    ++mY.rbegin()->second;
+                    ASSERTV(SPEC1, SPEC2, X != Y);
+                    ASSERTV(SPEC1, SPEC2, !(X == Y));
+                    --mY.rbegin()->second;
+                }
+
+                // Copy construction.
+
+                {
+                    const Obj C(X);
+                    ASSERTV(SPEC1, X == C);
+                    ASSERTV(SPEC1, 1 == C.key_comp().id());
+                    ASSERTV(SPEC1, &da == C.get_allocator().mechanism());
+
+                    const Obj D(X, &za);
+                    ASSERTV(SPEC1, X == D);
+                    ASSERTV(SPEC1, 1 == D.key_comp().id());
+                    ASSERTV(SPEC1, &za == D.get_allocator().mechanism());
+                }
+
+                // Assignment.
+
+                {
+                    Obj mZ(Comp(3), &za);  const Obj& Z = mZ;
+                    gg(&mZ, SPEC2);
+
+                    Obj *mR = &(mZ = X);
+                    ASSERTV(SPEC1, SPEC2, mR == &mZ);
+                    ASSERTV(SPEC1, SPEC2, X == Z);
+                    ASSERTV(SPEC1, SPEC2, 1 == Z.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2,
+                            &za == Z.get_allocator().mechanism());
+
+                    mZ = Z;
+                    ASSERTV(SPEC1, SPEC2, X == Z);
+                }
+
+                // Swap with the same allocator.
+
+                {
+                    const Obj XX(X, &za);
+                    const Obj YY(Y, &za);
+
+                    const bsls::Types::Int64 NUM_ALLOCS = oa.numBlocksTotal();
+
+                    mX.swap(mY);
+                    ASSERTV(SPEC1, SPEC2, YY == X);
+                    ASSERTV(SPEC1, SPEC2, XX == Y);
+                    ASSERTV(SPEC1, SPEC2, 2 == X.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2, 1 == Y.key_comp().id());
+
+                    swap(mX, mY);
+                    ASSERTV(SPEC1, SPEC2, XX == X);
+                    ASSERTV(SPEC1, SPEC2, YY == Y);
+                    ASSERTV(SPEC1, SPEC2, 1 == X.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2, 2 == Y.key_comp().id());
+
+                    ASSERTV(SPEC1, SPEC2, NUM_ALLOCS == oa.numBlocksTotal());
+                }
+
+                // Swap with different allocators.
+
+                {
+                    Obj mZ(Comp(3), &za);  const Obj& Z = mZ;
+                    gg(&mZ, SPEC2);
+
+                    mX.swap(mZ);
+                    ASSERTV(SPEC1, SPEC2, Y == X);
+                    ASSERTV(SPEC1, SPEC2, 3 == X.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2, 1 == Z.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2,
+                            &oa == X.get_allocator().mechanism());
+                    ASSERTV(SPEC1, SPEC2,
+                            &za == Z.get_allocator().mechanism());
+                }
+            }
+            ASSERTV(SPEC1, SPEC2, 0 == oa.numBlocksInUse());
+            ASSERTV(SPEC1, SPEC2, 0 == za.numBlocksInUse());
+        }
+    }
+    ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // RANGE CONSTRUCTION AND BULK INSERTION
+    //
+    // Concerns:
+    //: 1 The range constructor creates a multimap holding every pair of the
+    //:   range, sorted by key.
+    //:
+    //: 2 The range 'insert' adds every pair of the range, keeps the pairs
+    //:   sorted, and places the inserted pairs after the pairs already present
+    //:   having equivalent keys, whose order is unchanged.
+    //:
+    //: 3 The 'sorted_equivalent' overloads accept sorted ranges, and retain
+    //:   the order of the pairs of the range having equivalent keys.
+    //:
+    //: 4 The comparator and allocator are those supplied, and the keys use
+    //:   the allocator of the multimap.
+    //
+    // Plan:
+    //: 1 For each row of a table of an initial spec, a range spec, and the
+    //:   expected result, create a multimap from the initial spec with the
+    //:   range constructor, insert the range, and verify the keys of the
+    //:   result, that each pair of the range is present, and, after the
+    //:   insertion, that the pairs already in the multimap precede those of
+    //:   the range having equivalent keys.  Repeat with the
+    //:   'sorted_equivalent' overloads for rows whose specs are sorted, and
+    //:   verify that the result is that of inserting the pairs one at a time.
+    //:   Verify that no memory from the default allocator remains in use.
+    //:   (C-1..4)
+    //
+    // Testing:
+    //   flat_multimap(ITER first, ITER last, const C& comparator, const A&);
+    //   flat_multimap(sorted_equivalent_t, ITER, ITER, const C&, const A&);
+    //   void insert(ITER first, ITER last);
+    //   void insert(sorted_equivalent_t, ITER first, ITER last);
+    // ------------------------------------------------------------------------
+
+    static const struct {
+        int         d_line;      // source line number
+        const char *d_initial;   // keys of the range constructor
+        const char *d_range;     // keys of the range to insert
+        const char *d_result;    // expected keys after the insertion
+    } DATA[] = {
+        //LINE  INITIAL      RANGE        RESULT
+        //----  -----------  -----------  -----------------
+        { L_,   "",          "",          ""                },
+        { L_,   "",          "A",         "A"               },
+        { L_,   "A",         "",          "A"               },
+        { L_,   "A",         "A",         "AA"              },
+        { L_,   "AB",        "CD",        "ABCD"            },
+        { L_,   "CD",        "AB",        "ABCD"            },
+        { L_,   "AC",        "BD",        "ABCD"            },
+        { L_,   "BD",        "AC",        "ABCD"            },
+        { L_,   "ACE",       "ABCDEF",    "AABCCDEEF"       },
+        { L_,   "DCBA",      "HGFE",      "ABCDEFGH"        },
+        { L_,   "ABAB",      "BABA",      "AAAABBBB"        },
+        { L_,   "AABB",      "AABB",      "AAAABBBB"        },
+        { L_,   "QWERTY",    "ASDFGH",    "ADEFGHQRSTWY"    },
+        { L_,   "ZZZZ",      "AAAA",      "AAAAZZZZ"        },
+        { L_,   "MJKL",      "JKLMNJ",    "JJJKKLLMMN"      },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int   LINE    = DATA[ti].d_line;
+        const char *INITIAL = DATA[ti].d_initial;
+        const char *RANGE   = DATA[ti].d_range;
+        const char *RESULT  = DATA[ti].d_result;
+
+        if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P_(RANGE) P(RESULT) }
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bsl::vector<Pair> initial(&sa);  fill(&initial, INITIAL);
+        bsl::vector<Pair> range(&sa);    fill(&range,   RANGE);
+
+        // The pairs of 'INITIAL', inserted one at a time.
+
+        Obj mE(&sa);  const Obj& E = mE;  gg(&mE, INITIAL);
+
+        {
+            Obj mX(initial.begin(), initial.end(), Comp(4), &oa);
+            const Obj& X = mX;
+
+            ASSERTV(LINE, E.size() == X.size());
+            for (CIter e = E.begin(), x = X.begin(); e != E.end(); ++e, ++x) {
+                ASSERTV(LINE, TTF::getIdentifier<KEY>(e->first) ==
+                                           TTF::getIdentifier<KEY>(x->first));
+            }
+            ASSERTV(LINE, checkMapped(X.begin(), X.end(), INITIAL));
+            ASSERTV(LINE, 4 == X.key_comp().id());
+            ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+
+            const Obj Y(X, &sa);
+
+            mX.insert(range.begin(), range.end());
+            ASSERTV(LINE, verify(X, RESULT));
+            ASSERTV(LINE, checkMerged(X, Y, RANGE));
+
+            // Inserting an empty range has no effect.
+
+            const Obj Z(X, &sa);
+
+            mX.insert(range.begin(), range.begin());
+            ASSERTV(LINE, X == Z);
+        }
+
+        const bool INITIAL_SORTED = Util::isSorted(initial.begin(),
+                                                   initial.end(),
+                                                   E.value_comp());
+        const bool RANGE_SORTED   = Util::isSorted(range.begin(),
+                                                   range.end(),
+                                                   E.value_comp());
+
+        if (INITIAL_SORTED) {
+            Obj mX(bsl::sorted_equivalent,
+                   initial.begin(),
+                   initial.end(),
+                   Comp(5),
+                   &oa);
+            const Obj& X = mX;
+
+            ASSERTV(LINE, X == E);
+            ASSERTV(LINE, 5 == X.key_comp().id());
+            ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+
+            if (RANGE_SORTED) {
+                mX.insert(bsl::sorted_equivalent, range.begin(), range.end());
+
+                Obj mF(E, &sa);  const Obj& F = mF;
+                for (int i = 0; RANGE[i]; ++i) {
+                    mF.insert(range[i]);
+                }
+                ASSERTV(LINE, verify(X, RESULT));
+                ASSERTV(LINE, X == F);
+            }
+        }
+
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        ASSERTV(LINE, da.numBlocksInUse(), 0 == da.numBlocksInUse());
+    }
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase6()
+{
+    // ------------------------------------------------------------------------
+    // HINTED INSERTION AND ERASURE
+    //
+    // Concerns:
+    //: 1 'insert' with a hint inserts the pair immediately before the hint if
+    //:   that position keeps the pairs sorted, and otherwise where
+    //:   'insert(value)' would, and returns an iterator to the inserted pair.
+    //:
+    //: 2 Each 'erase' overload removes the expected pairs and returns the
+    //:   expected iterator or count.
+    //
+    // Plan:
+    //: 1 For each spec in a table and each key from 'A' to 'H', insert a pair
+    //:   having the key with each possible hint, and verify the position of
+    //:   the inserted pair, and the resulting value, against the positions of
+    //:   the key found by 'lower_bound' and 'upper_bound'.  (C-1)
+    //:
+    //: 2 For each spec in a table, erase each position, each key from 'A' to
+    //:   'H', and each range of positions, and verify the results.  (C-2)
+    //
+    // Testing:
+    //   iterator insert(const_iterator hint, const value_type& value);
+    //   iterator erase(const_iterator position);
+    //   size_type erase(const key_type& key);
+    //   iterator erase(const_iterator first, const_iterator last);
+    // ------------------------------------------------------------------------
+
+    static const char *SPECS[] = {
+        "", "A", "C", "CC", "BD", "ACEG", "BCCCDEFG", "AAAHHH"
+    };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    if (verbose) printf("\tTesting 'insert' with a hint.\n");
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        const char *SPEC = SPECS[ti];
+
+        Obj mE(&oa);  const Obj& E = mE;  gg(&mE, SPEC);
+
+        for (char c = 'A'; c <= 'H'; ++c) {
+            const Pair VALUE(TTF::create<KEY>(c), 99);
+
+            const int LOWER = static_cast<int>(E.lower_bound(VALUE.first)
+                                                                 - E.begin());
+            const int UPPER = static_cast<int>(E.upper_bound(VALUE.first)
+                                                                 - E.begin());
+
+            for (int h = 0; h <= static_cast<int>(E.size()); ++h) {
+                if (veryVerbose) { T_ P_(SPEC) P_(c) P(h) }
+
+                Obj mX(E, &oa);  const Obj& X = mX;
+
+                const Iter R = mX.insert(X.begin() + h, VALUE);
+
+                const int EXP = LOWER <= h && h <= UPPER ? h : UPPER;
+
+                ASSERTV(SPEC, c, h, EXP == R - mX.begin());
+                ASSERTV(SPEC, c, h, VALUE == *R);
+                ASSERTV(SPEC, c, h, E.size() + 1 == X.size());
+                ASSERTV(SPEC, c, h, std::equal(E.begin(),
+                                               E.begin() + EXP,
+                                               X.begin()));
+                ASSERTV(SPEC, c, h, std::equal(E.begin() + EXP,
+                                               E.end(),
+                                               X.begin() + EXP + 1));
+            }
+        }
+    }
+
+    if (verbose) printf("\tTesting 'erase'.\n");
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        const char *SPEC = SPECS[ti];
+        const int   LEN  = static_cast<int>(strlen(SPEC));
+
+        Obj mE(&oa);  const Obj& E = mE;  gg(&mE, SPEC);
+
+        for (int i = 0; i < LEN; ++i) {
+            Obj mX(E, &oa);  const Obj& X = mX;
+
+            const Iter R = mX.erase(X.begin() + i);
+            ASSERTV(SPEC, i, X.begin() + i == R);
+            ASSERTV(SPEC, i, LEN - 1 == static_cast<int>(X.size()));
+            ASSERTV(SPEC, i, std::equal(X.begin(),
+                                        X.begin() + i,
+                                        E.begin()));
+            ASSERTV(SPEC, i, std::equal(X.begin() + i,
+                                        X.end(),
+                                        E.begin() + i + 1));
+        }
+
+        for (char c = 'A'; c <= 'H'; ++c) {
+            Obj mX(E, &oa);  const Obj& X = mX;
+
+            const KEY                     VALUE = TTF::create<KEY>(c);
+            const typename Obj::size_type COUNT = E.count(VALUE);
+
+            ASSERTV(SPEC, c, COUNT == mX.erase(VALUE));
+            ASSERTV(SPEC, c, !X.contains(VALUE));
+            ASSERTV(SPEC, c, E.size() - COUNT == X.size());
+            ASSERTV(SPEC, c, 0 == mX.erase(VALUE));
+        }
+
+        for (int i = 0; i <= LEN; ++i) {
+            for (int j = i; j <= LEN; ++j) {
+                Obj mX(E, &oa);  const Obj& X = mX;
+
+                const Iter R = mX.erase(X.begin() + i, X.begin() + j);
+                ASSERTV(SPEC, i, j, X.begin() + i == R);
+                ASSERTV(SPEC, i, j, LEN - (j - i) ==
+                                               static_cast<int>(X.size()));
+                ASSERTV(SPEC, i, j, std::equal(X.begin() + i,
+                                               X.end(),
+                                               E.begin() + j));
+            }
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: An Index of Words
+/// - - - - - - - - - - - - - -
+// Suppose we want to index the lines of a document on which each of a set of
+// words appears.  Since the index is built once, and then searched, we hold
+// it in a 'bsl::flat_multimap', mapping each word to a line number, which we
+// build from all of the entries at once.
+//
+// First, we collect the entries, in the order in which the words appear in
+// the document:
+//..
+  typedef bsl::pair<bsl::string, int> Entry;
+
+  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+  bsl::vector<Entry> entries(&oa);
+  entries.push_back(Entry("vector", 1));
+  entries.push_back(Entry("sorted", 1));
+  entries.push_back(Entry("vector", 2));
+  entries.push_back(Entry("map",    3));
+  entries.push_back(Entry("vector", 3));
+//..
+// Then, we build the index, which sorts the entries once:
+//..
+  typedef bsl::flat_multimap<bsl::string, int> Index;
+
+  Index index(entries.begin(), entries.end(), std::less<bsl::string>(), &oa);
+  ASSERT(5 == index.size());
+//..
+// Next, we find the lines on which a word appears.  Since the sort is stable,
+// the entries for a word are in the order in which they were collected:
+//..
+  ASSERT(3 == index.count("vector"));
+
+  bsl::pair<Index::const_iterator, Index::const_iterator> range =
+                                                 index.equal_range("vector");
+  int line = 0;
+  for (Index::const_iterator it = range.first; it != range.second; ++it) {
+      ASSERT(++line == it->second);
+  }
+  ASSERT(3 == line);
+//..
+// Now, we add an entry, which is inserted after the existing entries for the
+// word:
+//..
+  Index::iterator it = index.insert(Entry("map", 5));
+  ASSERT(5 == it->second);
+  ASSERT(2 == index.count("map"));
+  ASSERT(3 == index.lower_bound("map")->second);
+//..
+// Finally, we observe that the keys held by the multimap use the allocator of
+// the multimap:
+//..
+  ASSERT(&oa == index.begin()->first.get_allocator().mechanism());
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an allocation fails during 'insert(value)', the multimap is
+        //:   left in a valid state, and no memory is leaked.
+        //:
+        //: 2 If an allocation fails during the range constructor, no memory
+        //:   is leaked.
+        //:
+        //: 3 If an allocation fails during the range 'insert', the multimap is
+        //:   left in a valid state: its keys are sorted.
+        //
+        // Plan:
+        //: 1 Using 'bsl::string' keys and mapped values long enough to
+        //:   allocate memory, perform each operation in the exception-test
+        //:   loop of 'bslma::TestAllocator', and verify the state of the
+        //:   multimap on each exception, and that no memory is leaked.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+        typedef bsl::flat_multimap<bsl::string, bsl::string> Obj;
+        typedef Obj::value_type                              Pair;
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bsl::vector<Pair> pairs(&sa);
+        for (char c = 'A'; c <= 'P'; ++c) {
+            pairs.push_back(Pair(bsl::string(40, c, &sa),
+                                 bsl::string(40, c + 'a' - 'A', &sa)));
+        }
+        bsl::vector<Pair> range(&sa);
+        for (int i = 0; i < 16; ++i) {
+            range.push_back(pairs[(i * 7) % 16]);
+        }
+
+        Obj mY(&sa);  const Obj& Y = mY;
+        for (int i = 0; i < 16; i += 2) {
+            mY.insert(pairs[i]);
+        }
+
+        if (verbose) printf("\tTesting 'insert(value)'.\n");
+        {
+            for (int i = 0; i < 16; ++i) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    try {
+                        mX.insert(pairs[i]);
+                    }
+                    catch (...) {
+                        ASSERTV(i, Util::isSorted(X.begin(),
+                                                  X.end(),
+                                                  X.value_comp()));
+                        throw;
+                    }
+                    ASSERTV(i, Y.size() + 1 == X.size());
+                    ASSERTV(i, X.contains(pairs[i].first));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range constructor.\n");
+        {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(range.begin(),
+                            range.end(),
+                            std::less<bsl::string>(),
+                            &oa);
+                ASSERTV(X.size(), 16 == X.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range 'insert'.\n");
+        {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                mX.insert(pairs.begin(), pairs.begin() + 8);
+
+                try {
+                    mX.insert(range.begin(), range.end());
+                }
+                catch (...) {
+                    ASSERT(Util::isSorted(X.begin(),
+                                          X.end(),
+                                          X.value_comp()));
+                    ASSERTV(X.size(), 8 <= X.size() && X.size() <= 24);
+                    throw;
+                }
+                ASSERTV(X.size(), 24 == X.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+#endif
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // RELATIONAL OPERATORS, CAPACITY, COMPARATORS, AND TRAITS
+        //
+        // Concerns:
+        //: 1 The relational operators compare multimaps lexicographically, by
+        //:   key and then by mapped value.
+        //:
+        //: 2 'reserve' increases the capacity, without changing the value;
+        //:   'shrink_to_fit' reduces the capacity to the size.
+        //:
+        //: 3 'key_comp' returns the comparator supplied at construction, and
+        //:   'value_comp' returns a comparator ordering pairs by key using it.
+        //:
+        //: 4 A function pointer may be used as the comparator.
+        //:
+        //: 5 The multimap has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 For each pair of specs in a table, compare multimaps of 'int'
+        //:   keys and mapped values, and verify the results against the
+        //:   lexicographical comparison of the specs.  (C-1)
+        //:
+        //: 2 Reserve and shrink a multimap, and verify its capacity and value.
+        //:   (C-2)
+        //:
+        //: 3 Create multimaps with stateful and function-pointer comparators,
+        //:   and verify the comparators and the ordering of the keys.
+        //:   (C-3..4)
+        //:
+        //: 4 Verify the traits.  (C-5)
+        //
+        // Testing:
+        //   bool operator<(const flat_multimap&, const flat_multimap&);
+        //   bool operator>(const flat_multimap&, const flat_multimap&);
+        //   bool operator<=(const flat_multimap&, const flat_multimap&);
+        //   bool operator>=(const flat_multimap&, const flat_multimap&);
+        //   void reserve(size_type numElements);
+        //   void shrink_to_fit();
+        //   size_type max_size() const;
+        //   size_type capacity() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   TYPE TRAITS
+        //   FUNCTION-POINTER COMPARATOR
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRELATIONAL OPERATORS, CAPACITY, COMPARATORS,"
+                            " AND TRAITS"
+                            "\n============================================"
+                            "===========\n");
+
+        typedef bsl::flat_multimap<int, int> Obj;
+        typedef Obj::value_type              Pair;
+
+        if (verbose) printf("\tTesting relational operators.\n");
+        {
+            // Each character is a key; an uppercase letter is mapped to 0,
+            // and a lowercase letter to 1 (with the key of the uppercase
+            // letter).  Pairs having equivalent keys are in the order of the
+            // spec.
+
+            static const char *SPECS[] = {
+                "", "A", "AA", "AAB", "Aa", "AB", "ABC", "ABD", "Ab", "AC",
+                "a", "aA", "aB", "B", "BC"
+            };
+            const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+            for (int ti = 0; ti < NUM_SPECS; ++ti) {
+                for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                    Obj mX;  const Obj& X = mX;
+                    Obj mY;  const Obj& Y = mY;
+
+                    for (const char *s = SPECS[ti]; *s; ++s) {
+                        mX.insert(Pair(toupper(*s), !!islower(*s)));
+                    }
+                    for (const char *s = SPECS[tj]; *s; ++s) {
+                        mY.insert(Pair(toupper(*s), !!islower(*s)));
+                    }
+
+                    // The specs are listed in lexicographical order of the
+                    // pairs they describe.
+
+                    ASSERTV(ti, tj, (ti <  tj) == (X <  Y));
+                    ASSERTV(ti, tj, (ti >  tj) == (X >  Y));
+                    ASSERTV(ti, tj, (ti <= tj) == (X <= Y));
+                    ASSERTV(ti, tj, (ti >= tj) == (X >= Y));
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting capacity.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 < X.max_size());
+
+            mX.reserve(100);
+            ASSERTV(X.capacity(), 100 <= X.capacity());
+            ASSERTV(X.empty());
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numBlocksTotal();
+            for (int i = 100; i > 0; --i) {
+                mX.insert(Pair(i / 2, -i));
+            }
+            ASSERTV(NUM_ALLOCS == oa.numBlocksTotal());
+            ASSERTV(X.size(), 100 == X.size());
+            ASSERTV(X.begin()->first,   0 == X.begin()->first);
+            ASSERTV(X.begin()->second, -1 == X.begin()->second);
+            ASSERTV(X.count(1), 2 == X.count(1));
+
+            mX.erase(X.begin() + 10, X.end());
+            mX.shrink_to_fit();
+            ASSERTV(X.capacity(), 10 == X.capacity());
+            ASSERTV(X.size(), 10 == X.size());
+        }
+
+        if (verbose) printf("\tTesting comparators.\n");
+        {
+            typedef bsl::flat_multimap<int, int, TestComparator<int> > CObj;
+
+            CObj mX(TestComparator<int>(9, false));  const CObj& X = mX;
+            ASSERTV(9 == X.key_comp().id());
+            ASSERTV(9 == X.value_comp().keyComparator().id());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(Pair(i, i));
+            }
+            ASSERTV(X.begin()->first, 9 == X.begin()->first);
+            ASSERT( X.value_comp()(*X.begin(), *X.rbegin()));
+            ASSERT(!X.value_comp()(*X.rbegin(), *X.begin()));
+
+            typedef bool (*FunctionPtr)(const int&, const int&);
+            typedef bsl::flat_multimap<int, int, FunctionPtr> FObj;
+
+            FObj mY(&lessThan);  const FObj& Y = mY;
+            ASSERT(&lessThan == Y.key_comp());
+            ASSERT(&lessThan == Y.value_comp().keyComparator());
+
+            static const int VALUES[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+            for (int i = 0; i < 8; ++i) {
+                mY.insert(Pair(VALUES[i], i));
+            }
+            ASSERTV(Y.size(), 8 == Y.size());
+            ASSERTV(Y.count(1), 2 == Y.count(1));
+            ASSERTV(Y.begin()->first,  1 == Y.begin()->first);
+            ASSERTV(Y.begin()->second, 1 == Y.begin()->second);
+            ASSERTV(Y.rbegin()->first, 9 == Y.rbegin()->first);
+            ASSERT(Y.contains(4));
+            ASSERT(!Y.contains(7));
+        }
+
+        if (verbose) printf("\tTesting traits.\n");
+        {
+            ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+            ASSERT(bslalg::HasStlIterators<Obj>::value);
+            typedef bsl::flat_multimap<int,
+                                       int,
+                                       std::less<int>,
+                                       std::allocator<Pair> > StdObj;
+            ASSERT(!bslma::UsesBslmaAllocator<StdObj>::value);
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // HINTED INSERTION AND ERASURE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHINTED INSERTION AND ERASURE"
+                            "\n============================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase6,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RANGE CONSTRUCTION AND BULK INSERTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE CONSTRUCTION AND BULK INSERTION"
+                            "\n=====================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase5,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                            "\n====================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase4,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LOOKUP METHODS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP METHODS"
+                            "\n==============\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase3,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS"
+                            "\n====================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase2,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a multimap, insert, look up, and erase some pairs, and
+        //:   copy and compare the multimap.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::flat_multimap<int, int> Obj;
+        typedef Obj::value_type              Pair;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        mX.insert(Pair(5, 50));
+        mX.insert(Pair(1, 10));
+        mX.insert(Pair(3, 30));
+        ASSERT(31 == mX.insert(Pair(3, 31))->second);
+        ASSERTV(X.size(), 4 == X.size());
+
+        ASSERT(1  == X.begin()->first);
+        ASSERT(5  == X.rbegin()->first);
+        ASSERT(2  == X.count(3));
+        ASSERT(30 == X.find(3)->second);
+        ASSERT(31 == (X.upper_bound(3) - 1)->second);
+        ASSERT(X.contains(3));
+        ASSERT(X.end() == X.find(2));
+        ASSERT(3 == X.lower_bound(2)->first);
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        ASSERT(2 == mX.erase(3));
+        ASSERT(0 == mX.erase(3));
+        ASSERT(X != Y);
+        ASSERT(X >  Y);
+
+        mY = X;
+        ASSERT(X == Y);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
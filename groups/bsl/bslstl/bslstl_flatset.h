@@ -0,0 +1,1280 @@
+// bslstl_flatset.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATSET
+#define INCLUDED_BSLSTL_FLATSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a set container holding its keys in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_set: set template implemented with a sorted 'bsl::vector'
+//
+//@SEE_ALSO: bslstl_set, bslstl_flatmap, bslstl_sortedrangetag
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_set', implementing a container holding an ordered sequence of
+// unique keys, having an interface similar to that of 'bsl::set', but storing
+// its keys contiguously, in order, in a 'bsl::vector', rather than in the
+// nodes of a balanced binary tree.
+//
+// An instantiation of 'flat_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the 'flat_set' contains.  If 'flat_set' is instantiated
+// with a key type that is not itself value-semantic, then it will not retain
+// all of its value-semantic qualities.
+//
+// Compared with 'bsl::set', a 'flat_set':
+//
+//: o uses much less memory (one 'KEY' per element, with no per-element node
+//:   or allocation overhead),
+//:
+//: o searches and iterates considerably faster, because its keys are
+//:   contiguous in memory, and
+//:
+//: o can be built from a range of keys in 'O[N * log(N)]' time with a single
+//:   sort (or in 'O[N]' time if the range is known to be sorted), but
+//:
+//: o inserts and erases individual keys in time linear in the size of the
+//:   container, and
+//:
+//: o invalidates all iterators and references to its elements when a key is
+//:   inserted or erased (as for 'bsl::vector').
+//
+// 'flat_set' is therefore best suited to sets that are built once (or in
+// bulk), and then searched many times.  The names of the container and of
+// its 'sorted_unique' constructor and 'insert' overloads are those of the
+// 'std::flat_set' of C++23; unlike 'std::flat_set', the container adaptor
+// is not parameterized by the type of the underlying sequence, which is always
+// 'bsl::vector<KEY, ALLOCATOR>'.
+//
+///Requirements on 'KEY'
+///---------------------
+// A 'flat_set' is a fully "Value-Semantic Type" (see {'bsldoc_glossary'})
+// only if the supplied 'KEY' template parameter is fully value-semantic.  In
+// addition to the requirements imposed on the element type of 'bsl::vector',
+// 'KEY' must be "copy-assignable", as keys are moved within the vector as keys
+// are inserted and erased.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'flat_set's 'ALLOCATOR' template parameter
+// determines how that set will allocate memory, and is supplied to the
+// underlying 'bsl::vector'.  If the (template parameter) type 'ALLOCATOR' of
+// a 'flat_set' instantiation is 'bsl::allocator' (the default), then objects
+// of that type will conform to the standard behavior of a
+// 'bslma'-allocator-enabled type: such a set accepts an optional
+// 'bslma::Allocator' argument at construction, uses it (or the default
+// allocator, if none is supplied) to supply memory throughout its lifetime,
+// and supplies it to the constructors of keys of a (template parameter) type
+// 'KEY' having the 'bslma::UsesBslmaAllocator' trait.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_set':
+//..
+//  Legend
+//  ------
+//  'K'             - (template parameter) type 'KEY' of the set
+//  'a', 'b'        - two distinct objects of type 'flat_set<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  'N'             - distance(i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_set<K> a;    (default construction)           | O[1]               |
+//  | flat_set<K> a(al);                                 |                    |
+//  | flat_set<K> a(c, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(b); (copy construction)              | O[n]               |
+//  | flat_set<K> a(b, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(i1, i2);                             | O[N] if [i1, i2)   |
+//  | flat_set<K> a(i1, i2, c, al);                      | is sorted,         |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(sorted_unique, i1, i2);              | O[N]               |
+//  | flat_set<K> a(sorted_unique, i1, i2, c, al);       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_set<K>(); (destruction)                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;            (assignment)                     | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b, a < b, a <= b, a > b, a >= b       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a, b)                              | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.max_size(), a.empty(), a.capacity(),   | O[1]               |
+//  | a.get_allocator(), a.key_comp(), a.value_comp()    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k)                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, k)                                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[n + N * log(N)]  |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(sorted_unique, i1, i2)                    | O[n + N]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(k), a.erase(p1, p2)           | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(m), a.shrink_to_fit()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.count(k), a.contains(k),              | O[log(n)]          |
+//  | a.lower_bound(k), a.upper_bound(k),                |                    |
+//  | a.equal_range(k)                                   |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Table of Reserved Words
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a tokenizer that must determine, for each identifier
+// it reads, whether the identifier is a reserved word.  The table of reserved
+// words is built once, and is searched for every identifier, so we hold it in
+// a 'bsl::flat_set'.
+//
+// First, we build the set from an (unsorted) array of words, sorting the
+// words once (and removing the duplicate) rather than inserting them one at a
+// time:
+//..
+//  const char *const WORDS[] = { "while", "if", "for", "else", "do", "if" };
+//  const int         NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+//
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  bsl::flat_set<bsl::string> reserved(WORDS,
+//                                      WORDS + NUM_WORDS,
+//                                      std::less<bsl::string>(),
+//                                      &oa);
+//  assert(5 == reserved.size());
+//..
+// Then, we observe that the words are held in order:
+//..
+//  assert("do"    == *reserved.begin());
+//  assert("while" == *reserved.rbegin());
+//..
+// Next, we look up some identifiers:
+//..
+//  assert( reserved.contains("for"));
+//  assert(!reserved.contains("foreach"));
+//  assert(reserved.end() == reserved.find("x"));
+//..
+// Finally, we observe that the set, and each string in it, use the allocator
+// supplied at construction:
+//..
+//  assert(&oa == reserved.get_allocator().mechanism());
+//  assert(&oa == reserved.begin()->get_allocator().mechanism());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SORTEDRANGETAG
+#include <bslstl_sortedrangetag.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SORTEDSEQUENCEUTIL
+#include <bslstl_sortedsequenceutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_FUNCTORADAPTER
+#include <bslalg_functoradapter.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                             // ==============
+                             // class flat_set
+                             // ==============
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<KEY> >
+class flat_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of the template parameter type,
+    // 'KEY') in a sorted 'bsl::vector'.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef bsl::vector<KEY, ALLOCATOR>                         Container;
+        // This typedef is an alias for the type of the sorted sequence of
+        // keys held by this set.
+
+    typedef typename BloombergLP::bslalg::FunctorAdapter<COMPARATOR>::Type
+                                                                    Comparator;
+        // This typedef is an alias for the comparator used internally by this
+        // set, which may be used as a base class even if 'COMPARATOR' is a
+        // function pointer type.
+
+    typedef bsl::allocator_traits<ALLOCATOR>                   AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef BloombergLP::bslstl::SortedSequenceUtil             SequenceUtil;
+        // This typedef is a convenient alias for the utility used to sort the
+        // keys held by this set.
+
+    struct DataWrapper : public Comparator {
+        // This struct is wrapper around the comparator and the vector of
+        // keys.  It takes advantage of the empty-base optimization (EBO) so
+        // that if the comparator is stateless, it takes up no space.
+
+        Container d_keys;  // sorted sequence of unique keys
+
+        DataWrapper(const COMPARATOR& comparator,
+                    const ALLOCATOR&  basicAllocator);
+            // Create a 'DataWrapper' object with the specified 'comparator'
+            // and an empty sequence of keys using the specified
+            // 'basicAllocator'.
+
+        DataWrapper(const COMPARATOR& comparator,
+                    const Container&  keys,
+                    const ALLOCATOR&  basicAllocator);
+            // Create a 'DataWrapper' object with the specified 'comparator'
+            // and a copy of the specified 'keys' using the specified
+            // 'basicAllocator'.
+    };
+
+    // DATA
+    DataWrapper d_data;  // comparator and sorted keys
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Container::const_iterator         iterator;
+    typedef typename Container::const_iterator         const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // PRIVATE MANIPULATORS
+    COMPARATOR& comparator();
+        // Return a reference providing modifiable access to the comparator
+        // for this set.
+
+    void quickSwap(flat_set& other);
+        // Efficiently exchange the value and comparator of this object with
+        // the value and comparator of the specified 'other' object.  This
+        // method provides the no-throw exception-safety guarantee.  The
+        // behavior is undefined unless this object was created with the same
+        // allocator as 'other'.
+
+    // PRIVATE ACCESSORS
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // comparator for this set.
+
+  public:
+    // CREATORS
+    explicit flat_set(const COMPARATOR& comparator     = COMPARATOR(),
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Construct an empty set.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify the 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' argument is of type
+        // 'bsl::allocator' (the default), then 'basicAllocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.  If the 'ALLOCATOR'
+        // argument is of type 'bsl::allocator' and 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used to
+        // supply memory.
+    : d_data(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to
+        // workaround an AIX compiler bug, where the constructor can fail to
+        // compile because it is unable to find the definition of the default
+        // argument.  This occurs when a templatized class wraps around the
+        // container and the comparator is defined after the new class.
+    }
+
+    explicit flat_set(const ALLOCATOR& basicAllocator);
+        // Construct an empty set that will use the specified 'basicAllocator'
+        // to supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // set.  If the template parameter 'ALLOCATOR' argument is of type
+        // 'bsl::allocator' (the default), then 'basicAllocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    flat_set(const flat_set& original);
+        // Construct a set having the same value as the specified 'original'.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this set.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  If the (template parameter) type 'ALLOCATOR' is of
+        // type 'bsl::allocator' (the default), the currently installed default
+        // allocator is used to supply memory.
+
+    flat_set(const flat_set& original, const ALLOCATOR& basicAllocator);
+        // Construct a set having the same value as that of the specified
+        // 'original' that will use the specified 'basicAllocator' to supply
+        // memory.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this set.  If the template parameter 'ALLOCATOR'
+        // argument is of type 'bsl::allocator' (the default), then
+        // 'basicAllocator' shall be convertible to 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator     = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Construct a set holding each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, retaining only one of each set
+        // of equivalent keys (which one is unspecified).  Optionally specify a
+        // 'comparator' used to order keys contained in this object.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // the 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'ALLOCATOR' is used.  If the template parameter
+        // 'ALLOCATOR' argument is of type 'bsl::allocator' (the default), then
+        // 'basicAllocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *'.  The keys are copied into this set, and then
+        // sorted once, so that this operation has 'O[N * log(N)]' complexity,
+        // or 'O[N]' complexity if the sequence is already sorted, where 'N' is
+        // the number of elements between 'first' and 'last'.  The (template
+        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
+        // input iterator defined in the C++11 standard [24.2.3] providing
+        // access to values of a type convertible to 'value_type'.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    flat_set(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator     = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Construct a set holding each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, without sorting them.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object, and a 'basicAllocator' used to supply memory, as for
+        // the preceding constructor.  This operation has 'O[N]' complexity,
+        // where 'N' is the number of elements between 'first' and 'last'.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or before
+        // 'last', and the sequence is strictly sorted according to
+        // 'comparator' (i.e., sorted, with no two keys being equivalent).
+
+    ~flat_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_set& operator=(const flat_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The allocator of this object is unchanged.  This
+        // method provides the strong exception-safety guarantee.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, if a key
+        // equivalent to 'value' already exists in this set, this method has
+        // no effect.  Return a pair whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) key in this set that is
+        // equivalent to 'value', and whose 'second' member is 'true' if a new
+        // key was inserted, and 'false' if the key was already present.  All
+        // iterators to this set are invalidated if a key is inserted.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set (in amortized constant
+        // time, plus the time to move the keys after the insertion point, if
+        // the specified 'hint' is a valid iterator at which 'value' would be
+        // inserted) if a key equivalent to 'value' does not already exist in
+        // this set; otherwise, if a key equivalent to 'value' already exists
+        // in this set, this method has no effect.  Return an iterator
+        // referring to the (possibly newly inserted) key in this set that is
+        // equivalent to 'value'.  If 'hint' is not the position at which
+        // 'value' would be inserted, 'value' is inserted as if by
+        // 'insert(value)'.  The behavior is undefined unless 'hint' is an
+        // iterator in the range '[begin() .. end()]' (both endpoints
+        // included).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // equivalent to a key already in this set, retaining only one of each
+        // set of equivalent keys in the range (which one is unspecified).  The
+        // new keys are appended to the keys of this set, sorted once, and
+        // merged with the existing keys, so that this operation has
+        // 'O[n + N * log(N)]' complexity, where 'n' is the size of this set
+        // and 'N' is the number of elements in the range.  The (template
+        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
+        // input iterator defined in the C++11 standard [24.2.3] providing
+        // access to values of a type convertible to 'value_type'.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last'.
+        // All iterators to this set are invalidated.
+
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // equivalent to a key already in this set, without sorting the range.
+        // This operation has 'O[n + N]' complexity, where 'n' is the size of
+        // this set and 'N' is the number of elements in the range.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last',
+        // and the sequence is strictly sorted according to 'key_comp()'.  All
+        // iterators to this set are invalidated.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the key at the specified 'position', and return
+        // an iterator referring to the key immediately following the removed
+        // key, or to the past-the-end position if the removed key was the
+        // last key in the sequence of keys maintained by this set.  The
+        // behavior is undefined unless 'position' refers to a key in this
+        // set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the key equivalent to the specified 'key', if
+        // such a key exists, and return 1; otherwise, if there is no key
+        // equivalent to 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the keys starting at the specified 'first'
+        // position up to, but not including the specified 'last' position,
+        // and return 'last'.  The behavior is undefined unless 'first' and
+        // 'last' either refer to keys in this set or are the 'end' iterator,
+        // and the 'first' position is at or before the 'last' position in the
+        // ordered sequence provided by this container.
+
+    void swap(flat_set& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee if the allocators of the two objects
+        // compare equal, and the basic guarantee otherwise, in which case
+        // the keys of both objects are copied.
+
+    void clear();
+        // Remove all keys from this set (i.e., make the size of this set 0).
+        // Note that the capacity of this set is unchanged.
+
+    void reserve(size_type numKeys);
+        // Change the capacity of this set to at least the specified 'numKeys',
+        // so that that many keys can be held without allocating memory.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this set to its size, if possible.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first key
+        // in the ordered sequence of keys maintained by this set, or the 'end'
+        // iterator if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end position in the ordered sequence of keys maintained by
+        // this set.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last key in the ordered sequence of keys maintained by this set, or
+        // 'rend' if this set is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning position in the ordered sequence of keys
+        // maintained by this set.
+
+    bool empty() const;
+        // Return 'true' if this set contains no keys, and 'false' otherwise.
+
+    size_type size() const;
+        // Return the number of keys in this set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of keys that
+        // this set could possibly hold.  Note that there is no guarantee that
+        // the set can successfully grow to the returned size, or even close
+        // to that size without running out of resources.
+
+    size_type capacity() const;
+        // Return the number of keys this set can hold without allocating
+        // memory.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // set; if a comparator was supplied at construction, return its value,
+        // otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by comparing
+        // their keys using 'key_comp()'.  Note that, since 'value_type' is
+        // 'KEY', the returned object is the same as 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the key in
+        // this set equivalent to the specified 'key', if such a key exists,
+        // and the past-the-end ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of keys within this set that are equivalent to
+        // the specified 'key'.  Note that since a set maintains unique keys,
+        // the returned value will be either 0 or 1.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this set contains a key equivalent to the specified
+        // 'key', and 'false' otherwise.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set greater-than or equal-to the
+        // specified 'key', and the past-the-end iterator if this set does not
+        // contain such a key.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) key in this set greater than the specified
+        // 'key', and the past-the-end iterator if this set does not contain
+        // such a key.
+
+    pair<const_iterator, const_iterator> equal_range(
+                                                   const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of keys in this set equivalent to the specified 'key',
+        // where the first iterator is positioned at the start of the sequence
+        // and the second is positioned one past the end of the sequence.  If
+        // this set contains no keys equivalent to 'key', then the two
+        // iterators will both be positioned at the point at which 'key' would
+        // be inserted.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_set' objects have the same
+    // value if they have the same number of keys, and each key in the ordered
+    // sequence of keys of one has the same value as the corresponding key in
+    // the ordered sequence of keys of the other.  This method requires that
+    // the (template parameter) type 'KEY' be "equality-comparable".
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_set' objects do not have
+    // the same value if they do not have the same number of keys, or some key
+    // in the ordered sequence of keys of one does not have the same value as
+    // the corresponding key in the ordered sequence of keys of the other.
+    // This method requires that the (template parameter) type 'KEY' be
+    // "equality-comparable".
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin() .. lhs.end())' and '[rhs.begin() .. rhs.end())',
+    // the value of set 'lhs' is lexicographically less than that of set 'rhs'
+    // if 'true == *i < *j' for the first pair of corresponding iterator
+    // positions where '*i' and '*j' differ, or if 'rhs.size() > lhs.size()'
+    // and '*i == *j' at every position of 'lhs'.  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than that of the specified 'rhs' set, and
+    // 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical comparison.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical comparison.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // set, and 'false' otherwise.  See 'operator<' for the definition of
+    // lexicographical comparison.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_set<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the values and comparators of the specified 'a' and 'b'
+    // objects.  This function provides the no-throw exception-safety
+    // guarantee if the allocators of the two objects compare equal, and the
+    // basic guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class DataWrapper
+                             // -----------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::DataWrapper::DataWrapper(
+                                        const COMPARATOR& comparator,
+                                        const ALLOCATOR&  basicAllocator)
+: Comparator(comparator)
+, d_keys(basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::DataWrapper::DataWrapper(
+                                        const COMPARATOR& comparator,
+                                        const Container&  keys,
+                                        const ALLOCATOR&  basicAllocator)
+: Comparator(comparator)
+, d_keys(keys, basicAllocator)
+{
+}
+
+                             // --------------
+                             // class flat_set
+                             // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+COMPARATOR& flat_set<KEY, COMPARATOR, ALLOCATOR>::comparator()
+{
+    return d_data;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::quickSwap(flat_set& other)
+{
+    BloombergLP::bslalg::SwapUtil::swap(
+                                   static_cast<Comparator *>(&d_data),
+                                   static_cast<Comparator *>(&other.d_data));
+    d_data.d_keys.swap(other.d_data.d_keys);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR& flat_set<KEY, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_data;
+}
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                              const ALLOCATOR& basicAllocator)
+: d_data(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const flat_set& original)
+: d_data(original.key_comp(),
+         original.d_data.d_keys,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                  original.get_allocator()))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                              const flat_set&  original,
+                                              const ALLOCATOR& basicAllocator)
+: d_data(original.key_comp(), original.d_data.d_keys, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_data(comparator, basicAllocator)
+{
+    d_data.d_keys.assign(first, last);
+    SequenceUtil::sortSuffixUnique(&d_data.d_keys, 0, this->comparator());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                            sorted_unique_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_data(comparator, basicAllocator)
+{
+    d_data.d_keys.assign(first, last);
+
+    BSLS_ASSERT_SAFE(SequenceUtil::isStrictlySorted(d_data.d_keys.begin(),
+                                                    d_data.d_keys.end(),
+                                                    this->comparator()));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::~flat_set()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const flat_set& rhs)
+{
+    if (this != BSLS_UTIL_ADDRESSOF(rhs)) {
+        flat_set other(rhs, get_allocator());
+        quickSwap(other);
+    }
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    const_iterator position = lower_bound(value);
+    if (position != end() && !comparator()(value, *position)) {
+        return pair<iterator, bool>(position, false);                 // RETURN
+    }
+    return pair<iterator, bool>(d_data.d_keys.insert(position, value), true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                             const value_type& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= hint && hint <= end());
+
+    if ((hint == end()   || comparator()(value, *hint))
+     && (hint == begin() || comparator()(*(hint - 1), value))) {
+        return d_data.d_keys.insert(hint, value);                     // RETURN
+    }
+    return insert(value).first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    const size_type position = size();
+    d_data.d_keys.insert(d_data.d_keys.end(), first, last);
+    SequenceUtil::sortSuffixUnique(&d_data.d_keys, position, comparator());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                  INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    // Since the appended keys are sorted, 'sortSuffixUnique' merely verifies
+    // that they are sorted (in linear time) before merging them.
+
+    const size_type position = size();
+    d_data.d_keys.insert(d_data.d_keys.end(), first, last);
+
+    BSLS_ASSERT_SAFE(SequenceUtil::isStrictlySorted(
+                                              d_data.d_keys.begin() + position,
+                                              d_data.d_keys.end(),
+                                              comparator()));
+
+    SequenceUtil::sortSuffixUnique(&d_data.d_keys, position, comparator());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(begin() <= position && position < end());
+
+    return d_data.d_keys.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == end()) {
+        return 0;                                                     // RETURN
+    }
+    d_data.d_keys.erase(position);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    BSLS_ASSERT_SAFE(begin() <= first && first <= last && last <= end());
+
+    return d_data.d_keys.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::swap(flat_set& other)
+{
+    // Swap the keys first: if the allocators differ, 'vector::swap' copies
+    // the keys (and may throw), whereas swapping the comparators cannot throw.
+
+    d_data.d_keys.swap(other.d_data.d_keys);
+    BloombergLP::bslalg::SwapUtil::swap(
+                                   static_cast<Comparator *>(&d_data),
+                                   static_cast<Comparator *>(&other.d_data));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_data.d_keys.clear();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::reserve(size_type numKeys)
+{
+    d_data.d_keys.reserve(numKeys);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::shrink_to_fit()
+{
+    d_data.d_keys.shrink_to_fit();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_data.d_keys.get_allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_data.d_keys.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_data.d_keys.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_data.d_keys.empty();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_data.d_keys.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_data.d_keys.max_size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_data.d_keys.capacity();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return key_comp();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    const_iterator position = lower_bound(key);
+    return position != end() && !comparator()(key, *position)
+           ? position
+           : end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::contains(const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return std::lower_bound(begin(), end(), key, comparator());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return std::upper_bound(begin(), end(), key, comparator());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    const_iterator startIt = lower_bound(key);
+    const_iterator endIt   = startIt;
+    if (endIt != end() && !comparator()(key, *endIt)) {
+        ++endIt;
+    }
+    return pair<const_iterator, const_iterator>(startIt, endIt);
+}
+
+}  // close namespace bsl
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1375 @@
+// bslstl_flatset.t.cpp                                               -*-C++-*-
+#include <bslstl_flatset.h>
+
+#include <bslstl_string.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <bsltf_templatetestfacility.h>
+
+#include <functional>   // 'std::less'
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>     // 'strlen'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container, 'bsl::flat_set',
+// that holds its keys in a sorted 'bsl::vector'.  The primary manipulators
+// are the default constructor, 'insert(value)', and 'clear'; the basic
+// accessors are 'begin', 'end', 'size', and 'get_allocator'.  Most test cases
+// are instantiated, through 'RUN_EACH_TYPE', for each of the "regular" test
+// types of 'bsltf_templatetestfacility', ordered by a comparator that orders
+// objects of those types by their identifiers.  The values of the sets used
+// in the tests are described by strings of uppercase letters, each letter
+// standing for the key having that identifier.  In addition to verifying the
+// value of each set, we verify, with test allocators, that all memory is
+// supplied by the allocator of the set (which is also the allocator of its
+// keys), and that no memory is leaked when an exception is thrown.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_set(const C& comparator = C(), const A& allocator = A());
+// [ 2] flat_set(const A& allocator);
+// [ 4] flat_set(const flat_set& original);
+// [ 4] flat_set(const flat_set& original, const A& allocator);
+// [ 5] flat_set(ITER first, ITER last, const C& comparator, const A&);
+// [ 5] flat_set(sorted_unique_t, ITER first, ITER last, const C&, const A&);
+// [ 2] ~flat_set();
+//
+// MANIPULATORS
+// [ 4] flat_set& operator=(const flat_set& rhs);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 6] iterator insert(const_iterator hint, const value_type& value);
+// [ 5] void insert(ITER first, ITER last);
+// [ 5] void insert(sorted_unique_t, ITER first, ITER last);
+// [ 6] iterator erase(const_iterator position);
+// [ 6] size_type erase(const key_type& key);
+// [ 6] iterator erase(const_iterator first, const_iterator last);
+// [ 4] void swap(flat_set& other);
+// [ 2] void clear();
+// [ 7] void reserve(size_type numKeys);
+// [ 7] void shrink_to_fit();
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 3] const_reverse_iterator rbegin() const;
+// [ 3] const_reverse_iterator rend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 7] size_type max_size() const;
+// [ 7] size_type capacity() const;
+// [ 7] key_compare key_comp() const;
+// [ 7] value_compare value_comp() const;
+// [ 3] const_iterator find(const key_type& key) const;
+// [ 3] size_type count(const key_type& key) const;
+// [ 3] bool contains(const key_type& key) const;
+// [ 3] const_iterator lower_bound(const key_type& key) const;
+// [ 3] const_iterator upper_bound(const key_type& key) const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const KEY&) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const flat_set& lhs, const flat_set& rhs);
+// [ 4] bool operator!=(const flat_set& lhs, const flat_set& rhs);
+// [ 7] bool operator<(const flat_set& lhs, const flat_set& rhs);
+// [ 7] bool operator>(const flat_set& lhs, const flat_set& rhs);
+// [ 7] bool operator<=(const flat_set& lhs, const flat_set& rhs);
+// [ 7] bool operator>=(const flat_set& lhs, const flat_set& rhs);
+// [ 4] void swap(flat_set& a, flat_set& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] TYPE TRAITS
+// [ 7] FUNCTION-POINTER COMPARATOR
+// [ 8] EXCEPTION SAFETY
+// [ 9] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+#define RUN_EACH_TYPE BSLTF_TEMPLATETESTFACILITY_RUN_EACH_TYPE
+
+typedef bsltf::TemplateTestFacility TTF;
+typedef bslstl::SortedSequenceUtil  Util;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+                            // ====================
+                            // class TestComparator
+                            // ====================
+
+template <class TYPE>
+class TestComparator {
+    // This test class provides a comparator ordering objects of the
+    // parameterized 'TYPE' by their identifiers (see
+    // 'bsltf::TemplateTestFacility::getIdentifier'), in ascending or
+    // descending order, and identified by an integer supplied at
+    // construction.
+
+    // DATA
+    int  d_id;           // identifier of this comparator
+    bool d_compareLess;  // 'true' for ascending order
+
+  public:
+    // CREATORS
+    explicit TestComparator(int id = 0, bool compareLess = true)
+        // Create a comparator having the optionally specified 'id', that
+        // orders objects in ascending order unless the optionally specified
+        // 'compareLess' is 'false'.
+    : d_id(id)
+    , d_compareLess(compareLess)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        const int lhsId = TTF::getIdentifier<TYPE>(lhs);
+        const int rhsId = TTF::getIdentifier<TYPE>(rhs);
+
+        return d_compareLess ? lhsId < rhsId : rhsId < lhsId;
+    }
+
+    int id() const
+        // Return the identifier of this comparator.
+    {
+        return d_id;
+    }
+};
+
+bool lessThan(const int& lhs, const int& rhs)
+    // Return 'true' if the specified 'lhs' is less than the specified 'rhs',
+    // and 'false' otherwise.
+{
+    return lhs < rhs;
+}
+
+                              // ================
+                              // class TestDriver
+                              // ================
+
+template <class KEY>
+class TestDriver {
+    // This class template provides a namespace for testing 'bsl::flat_set'
+    // instantiated with the (template parameter) type 'KEY'.
+
+    // PRIVATE TYPES
+    typedef TestComparator<KEY>                Comp;
+    typedef bsl::flat_set<KEY, Comp>           Obj;
+    typedef typename Obj::const_iterator       CIter;
+
+    // PRIVATE CLASS METHODS
+    static void gg(Obj *object, const char *spec);
+        // Insert into the specified 'object' the key created from each
+        // character of the specified 'spec'.
+
+    static bool verify(const Obj& object, const char *expected);
+        // Return 'true' if the sequence of keys of the specified 'object' has
+        // the identifiers given by the characters of the specified
+        // 'expected', in order, and 'false' otherwise.
+
+    static void fill(bsl::vector<KEY> *keys, const char *spec);
+        // Append to the specified 'keys' the key created from each character
+        // of the specified 'spec'.
+
+  public:
+    // CLASS METHODS
+    static void testCase2();
+        // Test primary manipulators.
+
+    static void testCase3();
+        // Test lookup accessors.
+
+    static void testCase4();
+        // Test copy construction, assignment, swap, and equality.
+
+    static void testCase5();
+        // Test range construction and bulk insertion.
+
+    static void testCase6();
+        // Test hinted insertion and erasure.
+};
+
+                              // ----------------
+                              // class TestDriver
+                              // ----------------
+
+// PRIVATE CLASS METHODS
+template <class KEY>
+void TestDriver<KEY>::gg(Obj *object, const char *spec)
+{
+    for (; *spec; ++spec) {
+        object->insert(TTF::create<KEY>(*spec));
+    }
+}
+
+template <class KEY>
+bool TestDriver<KEY>::verify(const Obj& object, const char *expected)
+{
+    if (strlen(expected) != object.size()) {
+        return false;                                                 // RETURN
+    }
+    for (CIter it = object.begin(); it != object.end(); ++it, ++expected) {
+        if (*expected != TTF::getIdentifier<KEY>(*it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY>
+void TestDriver<KEY>::fill(bsl::vector<KEY> *keys, const char *spec)
+{
+    for (; *spec; ++spec) {
+        keys->push_back(TTF::create<KEY>(*spec));
+    }
+}
+
+// CLASS METHODS
+template <class KEY>
+void TestDriver<KEY>::testCase2()
+{
+    // ------------------------------------------------------------------------
+    // PRIMARY MANIPULATORS
+    //
+    // Concerns:
+    //: 1 Each constructor creates an empty set using the expected comparator
+    //:   and allocator, without allocating memory.
+    //:
+    //: 2 'insert' adds a key if and only if no equivalent key is present,
+    //:   keeps the keys sorted, and returns an iterator to the equivalent key
+    //:   and whether the key was inserted.
+    //:
+    //: 3 'clear' removes all keys, retaining the capacity.
+    //:
+    //: 4 All memory, including that of the keys, is supplied by the object
+    //:   allocator, and is released on destruction.
+    //:
+    //: 5 An empty comparator adds no space to the set.
+    //
+    // Plan:
+    //: 1 Create sets with each constructor, and verify their state and that
+    //:   no memory was allocated.  (C-1)
+    //:
+    //: 2 For each spec in a table, insert the keys of the spec into a set
+    //:   created with a test allocator, verifying the return value of each
+    //:   insertion, and verify the resulting sequence of keys.  Verify that
+    //:   no memory from the default allocator remains in use (temporary
+    //:   copies of keys made by 'bsl::vector' use the default allocator),
+    //:   and that no memory is in use after the set is destroyed.  (C-2, 4)
+    //:
+    //: 3 Clear the set, and verify its state.  (C-3)
+    //:
+    //: 4 Compare the size of a set with that of a vector.  (C-5)
+    //
+    // Testing:
+    //   flat_set(const C& comparator = C(), const A& allocator = A());
+    //   flat_set(const A& allocator);
+    //   ~flat_set();
+    //   pair<iterator, bool> insert(const value_type& value);
+    //   void clear();
+    //   allocator_type get_allocator() const;
+    //   const_iterator begin() const;
+    //   const_iterator end() const;
+    //   bool empty() const;
+    //   size_type size() const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const Obj W;
+        const Obj X(Comp(7), &oa);
+        const Obj Y(&oa);
+
+        ASSERT(W.empty());           ASSERT(0 == W.size());
+        ASSERT(X.empty());           ASSERT(0 == X.size());
+        ASSERT(Y.empty());           ASSERT(0 == Y.size());
+
+        ASSERT(W.begin() == W.end());
+
+        ASSERT(&da == W.get_allocator().mechanism());
+        ASSERT(&oa == X.get_allocator().mechanism());
+        ASSERT(&oa == Y.get_allocator().mechanism());
+
+        ASSERT(0 == W.key_comp().id());
+        ASSERT(7 == X.key_comp().id());
+        ASSERT(0 == Y.key_comp().id());
+
+        ASSERT(0 == da.numBlocksTotal());
+        ASSERT(0 == oa.numBlocksTotal());
+    }
+
+    static const struct {
+        int         d_line;      // source line number
+        const char *d_spec;      // keys to insert, in order
+        const char *d_inserted;  // 'Y' for each key expected to be inserted
+        const char *d_result;    // expected keys, in order
+    } DATA[] = {
+        //LINE  SPEC         INSERTED     RESULT
+        //----  -----------  -----------  ---------
+        { L_,   "",          "",          ""        },
+        { L_,   "A",         "Y",         "A"       },
+        { L_,   "AA",        "YN",        "A"       },
+        { L_,   "AB",        "YY",        "AB"      },
+        { L_,   "BA",        "YY",        "AB"      },
+        { L_,   "CAB",       "YYY",       "ABC"     },
+        { L_,   "CABBAC",    "YYYNNN",    "ABC"     },
+        { L_,   "EDCBA",     "YYYYY",     "ABCDE"   },
+        { L_,   "ACEGBDF",   "YYYYYYY",   "ABCDEFG" },
+        { L_,   "GFAGFA",    "YYYNNN",    "AFG"     },
+        { L_,   "ZYXABCZ",   "YYYYYYN",   "ABCXYZ"  },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int   LINE     = DATA[ti].d_line;
+        const char *SPEC     = DATA[ti].d_spec;
+        const char *INSERTED = DATA[ti].d_inserted;
+        const char *RESULT   = DATA[ti].d_result;
+
+        if (veryVerbose) { T_ P_(LINE) P_(SPEC) P(RESULT) }
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bsl::vector<KEY>     values(&sa);
+        fill(&values, SPEC);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (const char *key = SPEC; *key; ++key) {
+                const KEY&  VALUE = values[key - SPEC];
+                const bool  EXP   = 'Y' == INSERTED[key - SPEC];
+                const bsl::pair<CIter, bool> R = mX.insert(VALUE);
+
+                ASSERTV(LINE, *key, EXP == R.second);
+                ASSERTV(LINE, *key, X.end() != R.first);
+                ASSERTV(LINE, *key, *key == TTF::getIdentifier<KEY>(*R.first));
+            }
+
+            ASSERTV(LINE, verify(X, RESULT));
+            ASSERTV(LINE, (0 == *RESULT) == X.empty());
+            ASSERTV(LINE, da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+            const typename Obj::size_type CAPACITY = X.capacity();
+
+            mX.clear();
+            ASSERTV(LINE, X.empty());
+            ASSERTV(LINE, 0 == X.size());
+            ASSERTV(LINE, X.begin() == X.end());
+            ASSERTV(LINE, CAPACITY == X.capacity());
+        }
+        ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    }
+
+    ASSERTV(sizeof(bsl::flat_set<KEY>),
+            sizeof(bsl::vector<KEY>) == sizeof(bsl::flat_set<KEY>));
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // LOOKUP ACCESSORS
+    //
+    // Concerns:
+    //: 1 'find', 'count', and 'contains' find a key if and only if an
+    //:   equivalent key is in the set.
+    //:
+    //: 2 'lower_bound', 'upper_bound', and 'equal_range' return the positions
+    //:   of the first key not ordered before, and the first key ordered after,
+    //:   the key sought.
+    //:
+    //: 3 The lookup accessors honor the ordering of the comparator.
+    //:
+    //: 4 The reverse iterators traverse the keys in reverse order.
+    //:
+    //: 5 The lookup accessors do not allocate memory.
+    //
+    // Plan:
+    //: 1 For each spec in a table, create a set (ordered in ascending and in
+    //:   descending order), and look up each key from 'A' to 'Z', comparing
+    //:   the results against the position of the key computed by a linear
+    //:   scan.  (C-1..3)
+    //:
+    //: 2 Traverse each set with the reverse iterators.  (C-4)
+    //:
+    //: 3 Verify that no memory was allocated by the lookups.  (C-5)
+    //
+    // Testing:
+    //   const_reverse_iterator rbegin() const;
+    //   const_reverse_iterator rend() const;
+    //   const_iterator find(const key_type& key) const;
+    //   size_type count(const key_type& key) const;
+    //   bool contains(const key_type& key) const;
+    //   const_iterator lower_bound(const key_type& key) const;
+    //   const_iterator upper_bound(const key_type& key) const;
+    //   pair<const_iterator, const_iterator> equal_range(const KEY&) const;
+    // ------------------------------------------------------------------------
+
+    static const char *SPECS[] = {
+        "", "A", "M", "Z", "AB", "AZ", "ACE", "BDFHJ", "AEIMQUY",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        for (int order = 0; order < 2; ++order) {
+            const char *SPEC = SPECS[ti];
+            const bool  LESS = 0 == order;
+
+            if (veryVerbose) { T_ P_(SPEC) P(LESS) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(Comp(0, LESS), &oa);  const Obj& X = mX;
+            gg(&mX, SPEC);
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numBlocksTotal();
+
+            for (char c = 'A'; c <= 'Z'; ++c) {
+                const KEY VALUE = TTF::create<KEY>(c);
+
+                // Compute the expected position by a linear scan.
+
+                CIter exp = X.begin();
+                while (exp != X.end()
+                    && (LESS ? TTF::getIdentifier<KEY>(*exp) < c
+                             : TTF::getIdentifier<KEY>(*exp) > c)) {
+                    ++exp;
+                }
+                const bool FOUND = exp != X.end()
+                                && TTF::getIdentifier<KEY>(*exp) == c;
+                const CIter EXP_UPPER = FOUND ? exp + 1 : exp;
+
+                ASSERTV(SPEC, LESS, c, FOUND == X.contains(VALUE));
+                ASSERTV(SPEC, LESS, c, (FOUND ? 1u : 0u) == X.count(VALUE));
+                ASSERTV(SPEC, LESS, c,
+                        (FOUND ? exp : X.end()) == X.find(VALUE));
+                ASSERTV(SPEC, LESS, c, exp       == X.lower_bound(VALUE));
+                ASSERTV(SPEC, LESS, c, EXP_UPPER == X.upper_bound(VALUE));
+
+                const bsl::pair<CIter, CIter> R = X.equal_range(VALUE);
+                ASSERTV(SPEC, LESS, c, exp       == R.first);
+                ASSERTV(SPEC, LESS, c, EXP_UPPER == R.second);
+            }
+
+            typename Obj::const_reverse_iterator rit = X.rbegin();
+            for (CIter it = X.end(); it != X.begin(); ++rit) {
+                --it;
+                ASSERTV(SPEC, LESS, X.rend() != rit);
+                ASSERTV(SPEC, LESS, &*it == &*rit);
+            }
+            ASSERTV(SPEC, LESS, X.rend() == rit);
+
+            ASSERTV(SPEC, LESS, NUM_ALLOCS == oa.numBlocksTotal());
+        }
+    }
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+    //
+    // Concerns:
+    //: 1 The copy constructor creates a set having the value and comparator
+    //:   of the original, using the default allocator unless an allocator is
+    //:   supplied.
+    //:
+    //: 2 Assignment copies the value and comparator of the source, and does
+    //:   not change the allocator of the target.  Self-assignment has no
+    //:   effect.
+    //:
+    //: 3 'swap' exchanges the values and comparators, without allocating
+    //:   memory if the allocators are the same, and correctly if the
+    //:   allocators differ.
+    //:
+    //: 4 Two sets are equal if and only if they have the same keys.
+    //:
+    //: 5 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For each pair of specs in a table, create sets having the values of
+    //:   the specs, and verify the results of the equality operators.
+    //:   (C-4)
+    //:
+    //: 2 For each pair, copy-construct, assign, and swap (with the same and
+    //:   different allocators), verifying the values, comparators, and
+    //:   allocators of the results, and the use of memory.  (C-1..3, 5)
+    //
+    // Testing:
+    //   flat_set(const flat_set& original);
+    //   flat_set(const flat_set& original, const A& allocator);
+    //   flat_set& operator=(const flat_set& rhs);
+    //   void swap(flat_set& other);
+    //   bool operator==(const flat_set& lhs, const flat_set& rhs);
+    //   bool operator!=(const flat_set& lhs, const flat_set& rhs);
+    //   void swap(flat_set& a, flat_set& b);
+    // ------------------------------------------------------------------------
+
+    static const char *SPECS[] = {
+        "", "A", "B", "AB", "ABC", "ABD", "ABCDEFGH", "BCDEFGHI"
+    };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        for (int tj = 0; tj < NUM_SPECS; ++tj) {
+            const char *SPEC1 = SPECS[ti];
+            const char *SPEC2 = SPECS[tj];
+
+            if (veryVerbose) { T_ P_(SPEC1) P(SPEC2) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+            {
+                Obj mX(Comp(1), &oa);  const Obj& X = mX;  gg(&mX, SPEC1);
+                Obj mY(Comp(2), &oa);  const Obj& Y = mY;  gg(&mY, SPEC2);
+
+                ASSERTV(SPEC1, SPEC2, (ti == tj) == (X == Y));
+                ASSERTV(SPEC1, SPEC2, (ti != tj) == (X != Y));
+
+                // Copy construction.
+
+                {
+                    const Obj C(X);
+                    ASSERTV(SPEC1, verify(C, SPEC1));
+                    ASSERTV(SPEC1, 1 == C.key_comp().id());
+                    ASSERTV(SPEC1, &da == C.get_allocator().mechanism());
+
+                    const Obj D(X, &za);
+                    ASSERTV(SPEC1, verify(D, SPEC1));
+                    ASSERTV(SPEC1, 1 == D.key_comp().id());
+                    ASSERTV(SPEC1, &za == D.get_allocator().mechanism());
+                }
+
+                // Assignment.
+
+                {
+                    Obj mZ(Comp(3), &za);  const Obj& Z = mZ;
+                    gg(&mZ, SPEC2);
+
+                    Obj *mR = &(mZ = X);
+                    ASSERTV(SPEC1, SPEC2, mR == &mZ);
+                    ASSERTV(SPEC1, SPEC2, verify(Z, SPEC1));
+                    ASSERTV(SPEC1, SPEC2, 1 == Z.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2,
+                            &za == Z.get_allocator().mechanism());
+
+                    mZ = Z;
+                    ASSERTV(SPEC1, SPEC2, verify(Z, SPEC1));
+                }
+
+                // Swap with the same allocator.
+
+                {
+                    const bsls::Types::Int64 NUM_ALLOCS = oa.numBlocksTotal();
+
+                    mX.swap(mY);
+                    ASSERTV(SPEC1, SPEC2, verify(X, SPEC2));
+                    ASSERTV(SPEC1, SPEC2, verify(Y, SPEC1));
+                    ASSERTV(SPEC1, SPEC2, 2 == X.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2, 1 == Y.key_comp().id());
+
+                    swap(mX, mY);
+                    ASSERTV(SPEC1, SPEC2, verify(X, SPEC1));
+                    ASSERTV(SPEC1, SPEC2, verify(Y, SPEC2));
+                    ASSERTV(SPEC1, SPEC2, 1 == X.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2, 2 == Y.key_comp().id());
+
+                    ASSERTV(SPEC1, SPEC2, NUM_ALLOCS == oa.numBlocksTotal());
+                }
+
+                // Swap with different allocators.
+
+                {
+                    Obj mZ(Comp(3), &za);  const Obj& Z = mZ;
+                    gg(&mZ, SPEC2);
+
+                    mX.swap(mZ);
+                    ASSERTV(SPEC1, SPEC2, verify(X, SPEC2));
+                    ASSERTV(SPEC1, SPEC2, verify(Z, SPEC1));
+                    ASSERTV(SPEC1, SPEC2, 3 == X.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2, 1 == Z.key_comp().id());
+                    ASSERTV(SPEC1, SPEC2,
+                            &oa == X.get_allocator().mechanism());
+                    ASSERTV(SPEC1, SPEC2,
+                            &za == Z.get_allocator().mechanism());
+                }
+            }
+            ASSERTV(SPEC1, SPEC2, 0 == oa.numBlocksInUse());
+            ASSERTV(SPEC1, SPEC2, 0 == za.numBlocksInUse());
+        }
+    }
+    ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // RANGE CONSTRUCTION AND BULK INSERTION
+    //
+    // Concerns:
+    //: 1 The range constructor creates a set holding one of each set of
+    //:   equivalent keys of the range, in order.
+    //:
+    //: 2 The range 'insert' adds the keys of the range that are not
+    //:   equivalent to keys already in the set, and keeps the keys sorted.
+    //:
+    //: 3 The 'sorted_unique' overloads accept strictly sorted ranges and
+    //:   produce the same result.
+    //:
+    //: 4 The comparator and allocator are those supplied, and the keys use
+    //:   the allocator of the set.
+    //
+    // Plan:
+    //: 1 For each row of a table of an initial spec, a range spec, and the
+    //:   expected result, create a set from the initial spec with the range
+    //:   constructor, insert the range, and verify the result.  Repeat with
+    //:   the 'sorted_unique' overloads for rows whose specs are strictly
+    //:   sorted.  Verify that no memory from the default allocator remains
+    //:   in use.  (C-1..4)
+    //
+    // Testing:
+    //   flat_set(ITER first, ITER last, const C& comparator, const A&);
+    //   flat_set(sorted_unique_t, ITER first, ITER last, const C&, const A&);
+    //   void insert(ITER first, ITER last);
+    //   void insert(sorted_unique_t, ITER first, ITER last);
+    // ------------------------------------------------------------------------
+
+    static const struct {
+        int         d_line;      // source line number
+        const char *d_initial;   // keys of the range constructor
+        const char *d_range;     // keys of the range to insert
+        const char *d_result;    // expected keys after the insertion
+    } DATA[] = {
+        //LINE  INITIAL      RANGE        RESULT
+        //----  -----------  -----------  -----------
+        { L_,   "",          "",          ""          },
+        { L_,   "",          "A",         "A"         },
+        { L_,   "A",         "",          "A"         },
+        { L_,   "A",         "A",         "A"         },
+        { L_,   "AB",        "CD",        "ABCD"      },
+        { L_,   "CD",        "AB",        "ABCD"      },
+        { L_,   "AC",        "BD",        "ABCD"      },
+        { L_,   "BD",        "AC",        "ABCD"      },
+        { L_,   "ACE",       "ABCDEF",    "ABCDEF"    },
+        { L_,   "DCBA",      "HGFE",      "ABCDEFGH"  },
+        { L_,   "ABAB",      "BABA",      "AB"        },
+        { L_,   "QWERTY",    "ASDFGH",    "ADEFGHQRSTWY" },
+        { L_,   "ZZZZ",      "AAAA",      "AZ"        },
+        { L_,   "MJKL",      "JKLMNJ",    "JKLMN"     },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int   LINE    = DATA[ti].d_line;
+        const char *INITIAL = DATA[ti].d_initial;
+        const char *RANGE   = DATA[ti].d_range;
+        const char *RESULT  = DATA[ti].d_result;
+
+        if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P_(RANGE) P(RESULT) }
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bsl::vector<KEY> initial(&sa);  fill(&initial, INITIAL);
+        bsl::vector<KEY> range(&sa);    fill(&range,   RANGE);
+
+        // The unique keys of 'INITIAL', in order.
+
+        Obj mE(&sa);  const Obj& E = mE;  gg(&mE, INITIAL);
+
+        {
+            Obj mX(initial.begin(), initial.end(), Comp(4), &oa);
+            const Obj& X = mX;
+
+            ASSERTV(LINE, X == E);
+            ASSERTV(LINE, 4 == X.key_comp().id());
+            ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+
+            mX.insert(range.begin(), range.end());
+            ASSERTV(LINE, verify(X, RESULT));
+
+            // Inserting an empty range has no effect.
+
+            mX.insert(range.begin(), range.begin());
+            ASSERTV(LINE, verify(X, RESULT));
+        }
+
+        const bool INITIAL_SORTED = Util::isStrictlySorted(initial.begin(),
+                                                           initial.end(),
+                                                           Comp());
+        const bool RANGE_SORTED   = Util::isStrictlySorted(range.begin(),
+                                                           range.end(),
+                                                           Comp());
+
+        if (INITIAL_SORTED) {
+            Obj mX(bsl::sorted_unique,
+                   initial.begin(),
+                   initial.end(),
+                   Comp(5),
+                   &oa);
+            const Obj& X = mX;
+
+            ASSERTV(LINE, X == E);
+            ASSERTV(LINE, 5 == X.key_comp().id());
+            ASSERTV(LINE, &oa == X.get_allocator().mechanism());
+
+            if (RANGE_SORTED) {
+                mX.insert(bsl::sorted_unique, range.begin(), range.end());
+                ASSERTV(LINE, verify(X, RESULT));
+            }
+        }
+
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        ASSERTV(LINE, da.numBlocksInUse(), 0 == da.numBlocksInUse());
+    }
+}
+
+template <class KEY>
+void TestDriver<KEY>::testCase6()
+{
+    // ------------------------------------------------------------------------
+    // HINTED INSERTION AND ERASURE
+    //
+    // Concerns:
+    //: 1 'insert' with a hint inserts a key not already present at its sorted
+    //:   position, whether or not the hint is correct, and returns an
+    //:   iterator to the equivalent key.
+    //:
+    //: 2 Each 'erase' overload removes the expected keys and returns the
+    //:   expected iterator or count.
+    //
+    // Plan:
+    //: 1 For each spec in a table and each key from 'A' to 'H', insert the key
+    //:   with each valid hint, and verify the result against the unhinted
+    //:   insertion.  (C-1)
+    //:
+    //: 2 For each spec in a table, erase each position, each key from 'A' to
+    //:   'H', and each range of positions, and verify the results.  (C-2)
+    //
+    // Testing:
+    //   iterator insert(const_iterator hint, const value_type& value);
+    //   iterator erase(const_iterator position);
+    //   size_type erase(const key_type& key);
+    //   iterator erase(const_iterator first, const_iterator last);
+    // ------------------------------------------------------------------------
+
+    static const char *SPECS[] = { "", "A", "C", "BD", "ACEG", "BCDEFG" };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    if (verbose) printf("\tTesting 'insert' with a hint.\n");
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        const char *SPEC = SPECS[ti];
+
+        Obj mE(&oa);  const Obj& E = mE;  gg(&mE, SPEC);
+
+        for (char c = 'A'; c <= 'H'; ++c) {
+            const KEY VALUE = TTF::create<KEY>(c);
+
+            Obj mY(E, &oa);  const Obj& Y = mY;
+            mY.insert(VALUE);
+
+            for (size_t h = 0; h <= E.size(); ++h) {
+                if (veryVerbose) { T_ P_(SPEC) P_(c) P(h) }
+
+                Obj mX(E, &oa);  const Obj& X = mX;
+
+                const CIter R = mX.insert(X.begin() + h, VALUE);
+                ASSERTV(SPEC, c, h, X == Y);
+                ASSERTV(SPEC, c, h, X.end() != R);
+                ASSERTV(SPEC, c, h, c == TTF::getIdentifier<KEY>(*R));
+            }
+        }
+    }
+
+    if (verbose) printf("\tTesting 'erase'.\n");
+
+    for (int ti = 0; ti < NUM_SPECS; ++ti) {
+        const char *SPEC = SPECS[ti];
+        const int   LEN  = static_cast<int>(strlen(SPEC));
+
+        Obj mE(&oa);  const Obj& E = mE;  gg(&mE, SPEC);
+
+        for (int i = 0; i < LEN; ++i) {
+            Obj mX(E, &oa);  const Obj& X = mX;
+
+            const CIter R = mX.erase(X.begin() + i);
+            ASSERTV(SPEC, i, X.begin() + i == R);
+            ASSERTV(SPEC, i, LEN - 1 == static_cast<int>(X.size()));
+            ASSERTV(SPEC, i, !X.contains(TTF::create<KEY>(SPEC[i])));
+        }
+
+        for (char c = 'A'; c <= 'H'; ++c) {
+            Obj mX(E, &oa);  const Obj& X = mX;
+
+            const bool FOUND = 0 != strchr(SPEC, c);
+            ASSERTV(SPEC, c, (FOUND ? 1u : 0u) ==
+                                              mX.erase(TTF::create<KEY>(c)));
+            ASSERTV(SPEC, c, !X.contains(TTF::create<KEY>(c)));
+            ASSERTV(SPEC, c, E.size() - (FOUND ? 1 : 0) == X.size());
+        }
+
+        for (int i = 0; i <= LEN; ++i) {
+            for (int j = i; j <= LEN; ++j) {
+                Obj mX(E, &oa);  const Obj& X = mX;
+
+                const CIter R = mX.erase(X.begin() + i, X.begin() + j);
+                ASSERTV(SPEC, i, j, X.begin() + i == R);
+                ASSERTV(SPEC, i, j, LEN - (j - i) ==
+                                               static_cast<int>(X.size()));
+                for (int k = 0; k < LEN; ++k) {
+                    const bool EXP = k < i || j <= k;
+                    ASSERTV(SPEC, i, j, k,
+                            EXP == X.contains(TTF::create<KEY>(SPEC[k])));
+                }
+            }
+        }
+    }
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Table of Reserved Words
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a tokenizer that must determine, for each identifier
+// it reads, whether the identifier is a reserved word.  The table of reserved
+// words is built once, and is searched for every identifier, so we hold it in
+// a 'bsl::flat_set'.
+//
+// First, we build the set from an (unsorted) array of words, sorting the
+// words once (and removing the duplicate) rather than inserting them one at a
+// time:
+//..
+  const char *const WORDS[] = { "while", "if", "for", "else", "do", "if" };
+  const int         NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+
+  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+  bsl::flat_set<bsl::string> reserved(WORDS,
+                                      WORDS + NUM_WORDS,
+                                      std::less<bsl::string>(),
+                                      &oa);
+  ASSERT(5 == reserved.size());
+//..
+// Then, we observe that the words are held in order:
+//..
+  ASSERT("do"    == *reserved.begin());
+  ASSERT("while" == *reserved.rbegin());
+//..
+// Next, we look up some identifiers:
+//..
+  ASSERT( reserved.contains("for"));
+  ASSERT(!reserved.contains("foreach"));
+  ASSERT(reserved.end() == reserved.find("x"));
+//..
+// Finally, we observe that the set, and each string in it, use the allocator
+// supplied at construction:
+//..
+  ASSERT(&oa == reserved.get_allocator().mechanism());
+  ASSERT(&oa == reserved.begin()->get_allocator().mechanism());
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an allocation fails during 'insert(value)', the set is left in
+        //:   a valid state, and no memory is leaked.
+        //:
+        //: 2 If an allocation fails during the range constructor, no memory
+        //:   is leaked.
+        //:
+        //: 3 If an allocation fails during the range 'insert', the set is left
+        //:   in a valid state: its keys are strictly sorted, and each was in
+        //:   the set or in the range.
+        //
+        // Plan:
+        //: 1 Using 'bsl::string' keys long enough to allocate memory, perform
+        //:   each operation in the exception-test loop of
+        //:   'bslma::TestAllocator', and verify the state of the set on each
+        //:   exception, and that no memory is leaked.  (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+        typedef bsl::flat_set<bsl::string> Obj;
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> keys(&sa);
+        for (char c = 'A'; c <= 'P'; ++c) {
+            keys.push_back(bsl::string(40, c, &sa));
+        }
+        bsl::vector<bsl::string> range(&sa);
+        for (int i = 0; i < 16; ++i) {
+            range.push_back(keys[(i * 7) % 16]);
+        }
+
+        if (verbose) printf("\tTesting 'insert(value)'.\n");
+        {
+            Obj mY(&sa);  const Obj& Y = mY;
+            for (int i = 0; i < 16; i += 2) {
+                mY.insert(keys[i]);
+            }
+
+            for (int i = 1; i < 16; i += 2) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj mX(Y, &oa);  const Obj& X = mX;
+
+                    try {
+                        mX.insert(keys[i]);
+                    }
+                    catch (...) {
+                        ASSERTV(i, Util::isStrictlySorted(
+                                                  X.begin(),
+                                                  X.end(),
+                                                  std::less<bsl::string>()));
+                        throw;
+                    }
+                    ASSERTV(i, Y.size() + 1 == X.size());
+                    ASSERTV(i, X.contains(keys[i]));
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range constructor.\n");
+        {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(range.begin(),
+                            range.end(),
+                            std::less<bsl::string>(),
+                            &oa);
+                ASSERTV(X.size(), 16 == X.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range 'insert'.\n");
+        {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                mX.insert(keys.begin(), keys.begin() + 8);
+
+                try {
+                    mX.insert(range.begin(), range.end());
+                }
+                catch (...) {
+                    ASSERT(Util::isStrictlySorted(X.begin(),
+                                                  X.end(),
+                                                  std::less<bsl::string>()));
+                    ASSERTV(X.size(), X.size() <= 16);
+                    throw;
+                }
+                ASSERTV(X.size(), 16 == X.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+#endif
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // RELATIONAL OPERATORS, CAPACITY, COMPARATORS, AND TRAITS
+        //
+        // Concerns:
+        //: 1 The relational operators compare sets lexicographically.
+        //:
+        //: 2 'reserve' increases the capacity, without changing the value;
+        //:   'shrink_to_fit' reduces the capacity to the size.
+        //:
+        //: 3 'key_comp' and 'value_comp' return the comparator supplied at
+        //:   construction.
+        //:
+        //: 4 A function pointer may be used as the comparator.
+        //:
+        //: 5 The set has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 For each pair of specs in a table, compare sets of 'int', and
+        //:   verify the results against the lexicographical comparison of the
+        //:   specs.  (C-1)
+        //:
+        //: 2 Reserve and shrink a set, and verify its capacity and value.
+        //:   (C-2)
+        //:
+        //: 3 Create sets with stateful and function-pointer comparators, and
+        //:   verify the comparators and the ordering of the keys.  (C-3..4)
+        //:
+        //: 4 Verify the traits.  (C-5)
+        //
+        // Testing:
+        //   bool operator<(const flat_set& lhs, const flat_set& rhs);
+        //   bool operator>(const flat_set& lhs, const flat_set& rhs);
+        //   bool operator<=(const flat_set& lhs, const flat_set& rhs);
+        //   bool operator>=(const flat_set& lhs, const flat_set& rhs);
+        //   void reserve(size_type numKeys);
+        //   void shrink_to_fit();
+        //   size_type max_size() const;
+        //   size_type capacity() const;
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   TYPE TRAITS
+        //   FUNCTION-POINTER COMPARATOR
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRELATIONAL OPERATORS, CAPACITY, COMPARATORS,"
+                            " AND TRAITS"
+                            "\n============================================"
+                            "===========\n");
+
+        typedef bsl::flat_set<int> Obj;
+
+        if (verbose) printf("\tTesting relational operators.\n");
+        {
+            static const char *SPECS[] = {
+                "", "A", "AB", "ABC", "ABD", "AC", "B", "BC"
+            };
+            const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+            for (int ti = 0; ti < NUM_SPECS; ++ti) {
+                for (int tj = 0; tj < NUM_SPECS; ++tj) {
+                    Obj mX;  const Obj& X = mX;
+                    Obj mY;  const Obj& Y = mY;
+
+                    for (const char *s = SPECS[ti]; *s; ++s) mX.insert(*s);
+                    for (const char *s = SPECS[tj]; *s; ++s) mY.insert(*s);
+
+                    // The specs are listed in lexicographical order.
+
+                    ASSERTV(ti, tj, (ti <  tj) == (X <  Y));
+                    ASSERTV(ti, tj, (ti >  tj) == (X >  Y));
+                    ASSERTV(ti, tj, (ti <= tj) == (X <= Y));
+                    ASSERTV(ti, tj, (ti >= tj) == (X >= Y));
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting capacity.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 < X.max_size());
+
+            mX.reserve(100);
+            ASSERTV(X.capacity(), 100 <= X.capacity());
+            ASSERTV(X.empty());
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numBlocksTotal();
+            for (int i = 100; i > 0; --i) {
+                mX.insert(i);
+            }
+            ASSERTV(NUM_ALLOCS == oa.numBlocksTotal());
+            ASSERTV(X.size(), 100 == X.size());
+            ASSERTV(*X.begin(), 1 == *X.begin());
+
+            mX.erase(X.begin() + 10, X.end());
+            mX.shrink_to_fit();
+            ASSERTV(X.capacity(), 10 == X.capacity());
+            ASSERTV(X.size(), 10 == X.size());
+        }
+
+        if (verbose) printf("\tTesting comparators.\n");
+        {
+            typedef bsl::flat_set<int, TestComparator<int> > CObj;
+
+            CObj mX(TestComparator<int>(9, false));  const CObj& X = mX;
+            ASSERTV(9 == X.key_comp().id());
+            ASSERTV(9 == X.value_comp().id());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i);
+            }
+            ASSERTV(*X.begin(), 9 == *X.begin());
+
+            typedef bool (*FunctionPtr)(const int&, const int&);
+            typedef bsl::flat_set<int, FunctionPtr> FObj;
+
+            FObj mY(&lessThan);  const FObj& Y = mY;
+            ASSERT(&lessThan == Y.key_comp());
+            ASSERT(&lessThan == Y.value_comp());
+
+            static const int VALUES[] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+            mY.insert(VALUES, VALUES + 8);
+            ASSERTV(Y.size(), 7 == Y.size());
+            ASSERTV(*Y.begin(),  1 == *Y.begin());
+            ASSERTV(*Y.rbegin(), 9 == *Y.rbegin());
+            ASSERT(Y.contains(4));
+            ASSERT(!Y.contains(7));
+        }
+
+        if (verbose) printf("\tTesting traits.\n");
+        {
+            ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+            ASSERT(bslalg::HasStlIterators<Obj>::value);
+            typedef bsl::flat_set<int, std::less<int>, std::allocator<int> >
+                                                                       StdObj;
+            ASSERT(!bslma::UsesBslmaAllocator<StdObj>::value);
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // HINTED INSERTION AND ERASURE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHINTED INSERTION AND ERASURE"
+                            "\n============================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase6,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RANGE CONSTRUCTION AND BULK INSERTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRANGE CONSTRUCTION AND BULK INSERTION"
+                            "\n=====================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase5,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                            "\n====================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase4,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // LOOKUP ACCESSORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP ACCESSORS"
+                            "\n================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase3,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS"
+                            "\n====================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase2,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a set, insert, look up, and erase some keys, and copy and
+        //:   compare the set.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::flat_set<int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT( mX.insert(5).second);
+        ASSERT( mX.insert(1).second);
+        ASSERT( mX.insert(3).second);
+        ASSERT(!mX.insert(3).second);
+        ASSERTV(X.size(), 3 == X.size());
+
+        ASSERT(1 == *X.begin());
+        ASSERT(5 == *X.rbegin());
+        ASSERT(X.contains(3));
+        ASSERT(X.end() == X.find(2));
+        ASSERT(3 == *X.lower_bound(2));
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        ASSERT(1 == mX.erase(3));
+        ASSERT(0 == mX.erase(3));
+        ASSERT(X != Y);
+        ASSERT(X >  Y);
+
+        mY = X;
+        ASSERT(X == Y);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
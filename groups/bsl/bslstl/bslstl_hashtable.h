@@ -118,11 +118,25 @@ BSLS_IDENT("$Id: $")
 // the first and last element in the linked-list whose adjusted hash-values are
 // equal to that bucket's index.
 //
-// As we do not cache the hashed value, if any hash function throws we will
-// either do nothing and allow the exception to propagate, or, if some change
-// of state has already been made, clear the whole container to provide the
-// basic exception guarantee.  There are similar concerns for the 'COMPARATOR'
-// predicate.
+// By default, the hash code of an element is not stored, so it is recomputed
+// whenever it is needed (e.g., when the table grows).  If any hash function
+// throws we will either do nothing and allow the exception to propagate, or,
+// if some change of state has already been made, clear the whole container to
+// provide the basic exception guarantee.  There are similar concerns for the
+// 'COMPARATOR' predicate.
+//
+///Storing Hash Codes
+///------------------
+// If the 'bslstl::CacheHashCode' trait is associated with the 'HASHER' type
+// (see 'bslstl_cachehashcode'), the nodes of the table are of type
+// 'bslalg::HashedBidirectionalNode<ValueType>', and each stores the hash code
+// of its element, computed once when the element is inserted.  Such a table
+// never invokes the hash functor to rehash or to erase an element, and
+// invokes the comparator only for elements whose hash code is that of the key
+// being sought, at the cost of one 'std::size_t' per element.  This is worth
+// doing when the hash functor is expensive (e.g., for long strings), and is
+// transparent to the clients of the table: 'NodeType' is still derived from
+// 'bslalg::BidirectionalNode<ValueType>'.
 //
 ///Usage
 ///-----
@@ -1471,6 +1485,10 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_bidirectionalnodepool.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_CACHEHASHCODE
+#include <bslstl_cachehashcode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_BIDIRECTIONALLINK
 #include <bslalg_bidirectionallink.h>
 #endif
@@ -1483,6 +1501,10 @@ BSLS_IDENT("$Id: $")
 #include <bslalg_functoradapter.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_HASHEDBIDIRECTIONALNODE
+#include <bslalg_hashedbidirectionalnode.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_HASHTABLEBUCKET
 #include <bslalg_hashtablebucket.h>
 #endif
@@ -1852,6 +1874,125 @@ void swap(HashTable_ComparatorWrapper<FUNCTOR> &lhs,
     // Swap the functor wrapped by the specified 'lhs' object with the functor
     // wrapped by the specified 'rhs' object.
 
+                       // =========================
+                       // struct HashTable_NodeUtil
+                       // =========================
+
+template <class KEY_CONFIG, bool STORE_HASH_CODE>
+struct HashTable_NodeUtil {
+    // This 'struct' provides a namespace for the operations of a 'HashTable'
+    // that depend on whether its nodes store the hash codes of their elements
+    // (see {Storing Hash Codes}).  This primary template provides the
+    // operations for nodes that do not store hash codes, which are therefore
+    // recomputed, using the supplied hash functor, whenever they are needed.
+
+    // PUBLIC TYPES
+    typedef bslalg::BidirectionalNode<typename KEY_CONFIG::ValueType>
+                                                                      NodeType;
+    typedef typename
+    bslalg::HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type        KeyType;
+
+    // CLASS METHODS
+    template <class HASHER>
+    static native_std::size_t hashCodeForNode(
+                                       bslalg::BidirectionalLink *node,
+                                       const HASHER&              hasher);
+        // Return the hash code of the element held by the specified 'node',
+        // computed by the specified 'hasher'.
+
+    static void setHashCode(bslalg::BidirectionalLink *node,
+                            native_std::size_t         hashCode);
+        // Do nothing.  Note that the hash code of 'node' is not stored.
+
+    template <class KEY_EQUAL>
+    static bslalg::BidirectionalLink *find(
+                               const bslalg::HashTableAnchor& anchor,
+                               KeyType                        key,
+                               const KEY_EQUAL&               equalityFunctor,
+                               native_std::size_t             hashCode);
+        // Return the address of the first node in the specified 'anchor'
+        // holding an element whose key matches (according to the specified
+        // 'equalityFunctor') the specified 'key' having the specified
+        // 'hashCode', and 0 if there is no such node (see
+        // 'bslalg::HashTableImpUtil::find').
+
+    template <class KEY_EQUAL>
+    static bslalg::BidirectionalLink *findInBucket(
+                               const bslalg::HashTableBucket& bucket,
+                               KeyType                        key,
+                               const KEY_EQUAL&               equalityFunctor,
+                               native_std::size_t             hashCode);
+        // Return the address of the first node in the specified 'bucket'
+        // holding an element whose key matches (according to the specified
+        // 'equalityFunctor') the specified 'key' having the specified
+        // 'hashCode', and 0 if there is no such node (see
+        // 'bslalg::HashTableImpUtil::findInBucket').
+
+    template <class HASHER>
+    static void rehash(bslalg::HashTableAnchor   *newAnchor,
+                       bslalg::BidirectionalLink *elementList,
+                       const HASHER&              hasher);
+        // Populate the specified 'newAnchor' with all the elements in the
+        // specified 'elementList', using the specified 'hasher' to compute
+        // the hash code of each element (see
+        // 'bslalg::HashTableImpUtil::rehash').
+};
+
+template <class KEY_CONFIG>
+struct HashTable_NodeUtil<KEY_CONFIG, true> {
+    // This partial specialization of 'HashTable_NodeUtil' provides the
+    // operations for nodes that store the hash codes of their elements.  No
+    // operation invokes a hash functor.
+
+    // PUBLIC TYPES
+    typedef bslalg::HashedBidirectionalNode<typename KEY_CONFIG::ValueType>
+                                                                      NodeType;
+    typedef typename
+    bslalg::HashTableImpUtil_ExtractKeyResult<KEY_CONFIG>::Type        KeyType;
+
+    // CLASS METHODS
+    template <class HASHER>
+    static native_std::size_t hashCodeForNode(
+                                       bslalg::BidirectionalLink *node,
+                                       const HASHER&              hasher);
+        // Return the hash code stored in the specified 'node'.  Note that the
+        // specified 'hasher' is not used.
+
+    static void setHashCode(bslalg::BidirectionalLink *node,
+                            native_std::size_t         hashCode);
+        // Store the specified 'hashCode' in the specified 'node'.
+
+    template <class KEY_EQUAL>
+    static bslalg::BidirectionalLink *find(
+                               const bslalg::HashTableAnchor& anchor,
+                               KeyType                        key,
+                               const KEY_EQUAL&               equalityFunctor,
+                               native_std::size_t             hashCode);
+        // Return the address of the first node in the specified 'anchor'
+        // storing the specified 'hashCode' and holding an element whose key
+        // matches (according to the specified 'equalityFunctor') the
+        // specified 'key', and 0 if there is no such node.
+
+    template <class KEY_EQUAL>
+    static bslalg::BidirectionalLink *findInBucket(
+                               const bslalg::HashTableBucket& bucket,
+                               KeyType                        key,
+                               const KEY_EQUAL&               equalityFunctor,
+                               native_std::size_t             hashCode);
+        // Return the address of the first node in the specified 'bucket'
+        // storing the specified 'hashCode' and holding an element whose key
+        // matches (according to the specified 'equalityFunctor') the
+        // specified 'key', and 0 if there is no such node.
+
+    template <class HASHER>
+    static void rehash(bslalg::HashTableAnchor   *newAnchor,
+                       bslalg::BidirectionalLink *elementList,
+                       const HASHER&              hasher);
+        // Populate the specified 'newAnchor' with all the elements in the
+        // specified 'elementList', using the hash code stored in each
+        // element.  Note that the specified 'hasher' is not used.
+};
+
                            // ===============
                            // class HashTable
                            // ===============
@@ -1911,7 +2052,6 @@ class HashTable {
     typedef ::bsl::allocator_traits<AllocatorType> AllocatorTraits;
     typedef typename KEY_CONFIG::KeyType           KeyType;
     typedef typename KEY_CONFIG::ValueType         ValueType;
-    typedef bslalg::BidirectionalNode<ValueType>   NodeType;
     typedef typename AllocatorTraits::size_type    SizeType;
 
   private:
@@ -1920,6 +2060,13 @@ class HashTable {
     HashTable_ImplParameters<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>
                                                                 ImplParameters;
 
+    typedef HashTable_NodeUtil<KEY_CONFIG, CacheHashCode<HASHER>::value>
+                                                                      NodeUtil;
+
+  public:
+    // TYPES
+    typedef typename NodeUtil::NodeType            NodeType;
+
   private:
     // DATA
     ImplParameters      d_parameters;    // policies governing table behavior
@@ -2261,6 +2408,23 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    void findBatch(bslalg::BidirectionalLink **results,
+                   const KeyType              *keys,
+                   SizeType                    numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array the value that 'find' would return for the
+        // corresponding element of the specified 'keys' array.  The keys are
+        // looked up in groups: the hash codes of all keys in a group are
+        // computed, and their buckets and first nodes prefetched, before any
+        // of them is searched, so that the cache misses incurred by the
+        // lookups of a group overlap rather than occur one after the other.
+        // The behavior is undefined unless 'results' and 'keys' each refer to
+        // arrays of at least 'numKeys' elements.  Note that this function
+        // can be faster than successive calls to 'find' only when the table
+        // is much larger than the data cache, and even then may perform no
+        // better on a processor that already overlaps the misses of
+        // successive lookups.
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a value
@@ -2612,17 +2776,16 @@ class HashTable_ImplParameters
     typedef ALLOCATOR                              AllocatorType;
     typedef ::bsl::allocator_traits<AllocatorType> AllocatorTraits;
     typedef typename KEY_CONFIG::ValueType         ValueType;
-    typedef bslalg::BidirectionalNode<ValueType>   NodeType;
 
   public:
     // PUBLIC TYPES
     typedef HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR> HashTableType;
+    typedef typename HashTableType::NodeType                     NodeType;
     typedef typename HashTableType::AllocatorTraits::
                                 template rebind_traits<NodeType> ReboundTraits;
     typedef typename ReboundTraits::allocator_type               NodeAllocator;
 
-    typedef
-    BidirectionalNodePool<typename HashTableType::ValueType, NodeAllocator>
+    typedef BidirectionalNodePool<ValueType, NodeAllocator, NodeType>
                                                                    NodeFactory;
 
   private:
@@ -3115,6 +3278,151 @@ void HashTable_Util::initAnchor(bslalg::HashTableAnchor *anchor,
     anchor->setBucketArrayAddressAndSize(data, newArraySize);
 }
 
+                       // -------------------------
+                       // struct HashTable_NodeUtil
+                       // -------------------------
+
+// CLASS METHODS
+template <class KEY_CONFIG, bool STORE_HASH_CODE>
+template <class HASHER>
+inline
+native_std::size_t
+HashTable_NodeUtil<KEY_CONFIG, STORE_HASH_CODE>::hashCodeForNode(
+                                       bslalg::BidirectionalLink *node,
+                                       const HASHER&              hasher)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    return hasher(bslalg::HashTableImpUtil::extractKey<KEY_CONFIG>(node));
+}
+
+template <class KEY_CONFIG, bool STORE_HASH_CODE>
+inline
+void HashTable_NodeUtil<KEY_CONFIG, STORE_HASH_CODE>::setHashCode(
+                                               bslalg::BidirectionalLink *,
+                                               native_std::size_t)
+{
+}
+
+template <class KEY_CONFIG, bool STORE_HASH_CODE>
+template <class KEY_EQUAL>
+inline
+bslalg::BidirectionalLink *
+HashTable_NodeUtil<KEY_CONFIG, STORE_HASH_CODE>::find(
+                               const bslalg::HashTableAnchor& anchor,
+                               KeyType                        key,
+                               const KEY_EQUAL&               equalityFunctor,
+                               native_std::size_t             hashCode)
+{
+    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(anchor,
+                                                      key,
+                                                      equalityFunctor,
+                                                      hashCode);
+}
+
+template <class KEY_CONFIG, bool STORE_HASH_CODE>
+template <class KEY_EQUAL>
+inline
+bslalg::BidirectionalLink *
+HashTable_NodeUtil<KEY_CONFIG, STORE_HASH_CODE>::findInBucket(
+                               const bslalg::HashTableBucket& bucket,
+                               KeyType                        key,
+                               const KEY_EQUAL&               equalityFunctor,
+                               native_std::size_t)
+{
+    return bslalg::HashTableImpUtil::findInBucket<KEY_CONFIG>(
+                                                              bucket,
+                                                              key,
+                                                              equalityFunctor);
+}
+
+template <class KEY_CONFIG, bool STORE_HASH_CODE>
+template <class HASHER>
+inline
+void HashTable_NodeUtil<KEY_CONFIG, STORE_HASH_CODE>::rehash(
+                                       bslalg::HashTableAnchor   *newAnchor,
+                                       bslalg::BidirectionalLink *elementList,
+                                       const HASHER&              hasher)
+{
+    bslalg::HashTableImpUtil::rehash<KEY_CONFIG>(newAnchor,
+                                                 elementList,
+                                                 hasher);
+}
+
+                 // -------------------------------------------
+                 // struct HashTable_NodeUtil<KEY_CONFIG, true>
+                 // -------------------------------------------
+
+// CLASS METHODS
+template <class KEY_CONFIG>
+template <class HASHER>
+inline
+native_std::size_t HashTable_NodeUtil<KEY_CONFIG, true>::hashCodeForNode(
+                                       bslalg::BidirectionalLink *node,
+                                       const HASHER&)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    return bslalg::HashTableImpUtil::extractHashCode<KEY_CONFIG>(node);
+}
+
+template <class KEY_CONFIG>
+inline
+void HashTable_NodeUtil<KEY_CONFIG, true>::setHashCode(
+                                         bslalg::BidirectionalLink *node,
+                                         native_std::size_t         hashCode)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    static_cast<NodeType *>(node)->setHashCode(hashCode);
+}
+
+template <class KEY_CONFIG>
+template <class KEY_EQUAL>
+inline
+bslalg::BidirectionalLink *HashTable_NodeUtil<KEY_CONFIG, true>::find(
+                               const bslalg::HashTableAnchor& anchor,
+                               KeyType                        key,
+                               const KEY_EQUAL&               equalityFunctor,
+                               native_std::size_t             hashCode)
+{
+    return bslalg::HashTableImpUtil::findUsingStoredHashCodes<KEY_CONFIG>(
+                                                              anchor,
+                                                              key,
+                                                              equalityFunctor,
+                                                              hashCode);
+}
+
+template <class KEY_CONFIG>
+template <class KEY_EQUAL>
+inline
+bslalg::BidirectionalLink *HashTable_NodeUtil<KEY_CONFIG, true>::findInBucket(
+                               const bslalg::HashTableBucket& bucket,
+                               KeyType                        key,
+                               const KEY_EQUAL&               equalityFunctor,
+                               native_std::size_t             hashCode)
+{
+    return bslalg::HashTableImpUtil::
+                         findInBucketUsingStoredHashCodes<KEY_CONFIG>(
+                                                              bucket,
+                                                              key,
+                                                              equalityFunctor,
+                                                              hashCode);
+}
+
+template <class KEY_CONFIG>
+template <class HASHER>
+inline
+void HashTable_NodeUtil<KEY_CONFIG, true>::rehash(
+                                       bslalg::HashTableAnchor   *newAnchor,
+                                       bslalg::BidirectionalLink *elementList,
+                                       const HASHER&)
+{
+    bslalg::HashTableImpUtil::rehashUsingStoredHashCodes<KEY_CONFIG>(
+                                                                  newAnchor,
+                                                                  elementList);
+}
+
                 //-------------------------------
                 // class HashTable_ImplParameters
                 //-------------------------------
@@ -3423,6 +3731,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
         size_t hashCode = this->hashCodeForNode(cursor);
         bslalg::BidirectionalLink *newNode =
                                  d_parameters.nodeFactory().cloneNode(*cursor);
+        NodeUtil::setHashCode(newNode, hashCode);
 
         bslalg::HashTableImpUtil::insertAtBackOfBucket(&d_anchor,
                                                        newNode,
@@ -3550,10 +3859,9 @@ rehashIntoExactlyNumBuckets(SizeType newNumBuckets, SizeType capacity)
     Proctor cleanUpIfUserHashThrows(this, &d_anchor, &newAnchor);
 
     if (d_anchor.listRootAddress()) {
-        bslalg::HashTableImpUtil::rehash<KEY_CONFIG>(
-                                          &newAnchor,
-                                          this->d_anchor.listRootAddress(),
-                                          this->d_parameters.hasher());
+        NodeUtil::rehash(&newAnchor,
+                         this->d_anchor.listRootAddress(),
+                         this->d_parameters.hasher());
     }
 
     cleanUpIfUserHashThrows.dismiss();
@@ -3603,11 +3911,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                             DEDUCED_KEY&       key,
                                             native_std::size_t hashValue) const
 {
-    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
-                                                     d_anchor,
-                                                     key,
-                                                     d_parameters.comparator(),
-                                                     hashValue);
+    return NodeUtil::find(d_anchor, key, d_parameters.comparator(), hashValue);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3629,8 +3933,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hashCodeForNode(
 {
     BSLS_ASSERT_SAFE(node);
 
-    return d_parameters.hashCodeForKey(
-                       bslalg::HashTableImpUtil::extractKey<KEY_CONFIG>(node));
+    return NodeUtil::hashCodeForNode(node, d_parameters.hasher());
 }
 
 // MANIPULATORS
@@ -3691,6 +3994,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    NodeUtil::setHashCode(newNode, hashCode);
     if (!position) {
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
     }
@@ -3743,6 +4047,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    NodeUtil::setHashCode(newNode, hashCode);
     if (!hint) {
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
     }
@@ -3778,6 +4083,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
         }
 
         position = d_parameters.nodeFactory().createNode(value);
+        NodeUtil::setHashCode(position, hashCode);
         bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
                                                         position,
                                                         hashCode);
@@ -3832,6 +4138,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
             this->rehashForNumBuckets(numBuckets() * 2);
         }
 
+        NodeUtil::setHashCode(newNode, hashCode);
         ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
         nodeProctor.release();
 
@@ -3857,6 +4164,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
         position = d_parameters.nodeFactory().createNode(
                                             key,
                                             typename ValueType::second_type());
+        NodeUtil::setHashCode(position, hashCode);
 
         bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
                                                         position,
@@ -4067,11 +4375,64 @@ bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                                       const KeyType& key) const
 {
-    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
-                                             d_anchor,
-                                             key,
-                                             d_parameters.comparator(),
-                                             d_parameters.hashCodeForKey(key));
+    return NodeUtil::find(d_anchor,
+                          key,
+                          d_parameters.comparator(),
+                          d_parameters.hashCodeForKey(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findBatch(
+                                  bslalg::BidirectionalLink **results,
+                                  const KeyType              *keys,
+                                  SizeType                    numKeys) const
+{
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    enum { k_GROUP_SIZE = 16 };  // number of lookups in flight; enough to
+                                 // cover the latency of a cache miss, but few
+                                 // enough for the prefetched lines to remain
+                                 // in the first-level cache
+
+    const bslalg::HashTableBucket *buckets[k_GROUP_SIZE];
+    native_std::size_t             hashCodes[k_GROUP_SIZE];
+
+    bslalg::HashTableBucket *bucketArray = d_anchor.bucketArrayAddress();
+    const native_std::size_t numBuckets  = d_anchor.bucketArraySize();
+
+    while (numKeys) {
+        const SizeType groupSize = numKeys < k_GROUP_SIZE
+                                 ? numKeys
+                                 : static_cast<SizeType>(k_GROUP_SIZE);
+
+        for (SizeType i = 0; i != groupSize; ++i) {
+            hashCodes[i] = d_parameters.hashCodeForKey(keys[i]);
+            buckets[i]   = bucketArray
+                         + ImpUtil::computeBucketIndex(hashCodes[i],
+                                                       numBuckets);
+            bsls::PerformanceHint::prefetchForReading(buckets[i]);
+        }
+
+        for (SizeType i = 0; i != groupSize; ++i) {
+            if (bslalg::BidirectionalLink *first = buckets[i]->first()) {
+                bsls::PerformanceHint::prefetchForReading(first);
+            }
+        }
+
+        for (SizeType i = 0; i != groupSize; ++i) {
+            results[i] = NodeUtil::findInBucket(*buckets[i],
+                                                keys[i],
+                                                d_parameters.comparator(),
+                                                hashCodes[i]);
+        }
+
+        results += groupSize;
+        keys    += groupSize;
+        numKeys -= groupSize;
+    }
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -4151,11 +4512,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasSameValue(
 
     while (cursor) {
         bslalg::BidirectionalLink *rhsFirst =
-             ImpUtil::find<KEY_CONFIG>(other.d_anchor,
-                                       ImpUtil::extractKey<KEY_CONFIG>(cursor),
-                                       other.d_parameters.comparator(),
-                                       other.d_parameters.hashCodeForKey(
-                                     ImpUtil::extractKey<KEY_CONFIG>(cursor)));
+             NodeUtil::find(other.d_anchor,
+                            ImpUtil::extractKey<KEY_CONFIG>(cursor),
+                            other.d_parameters.comparator(),
+                            NodeUtil::hashCodeForNode(
+                                              cursor,
+                                              other.d_parameters.hasher()));
         if (!rhsFirst) {
             return false;  // no matching key                         // RETURN
         }
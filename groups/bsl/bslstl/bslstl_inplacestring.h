@@ -0,0 +1,1371 @@
+// bslstl_inplacestring.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLSTL_INPLACESTRING
+#define INCLUDED_BSLSTL_INPLACESTRING
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-capacity string that never allocates memory.
+//
+//@CLASSES:
+//   bsl::basic_inplace_string: string template holding its characters in place
+//
+//@SEE_ALSO: bslstl_string, bslstl_stringref, bslstl_smallvector
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::basic_inplace_string', implementing a string of characters of the
+// (template parameter) type 'CHAR_TYPE' whose characters (and a terminating
+// null character) are always held in a buffer within the footprint of the
+// object itself.  The buffer holds at most 'CAPACITY' characters (the second
+// template parameter); a 'basic_inplace_string' never allocates memory, and
+// an operation that would make its length exceed 'CAPACITY' throws
+// 'std::length_error' instead.
+//
+// An instantiation of 'basic_inplace_string' is a value-semantic type whose
+// salient attribute is the sequence of characters it holds.  Its interface is
+// a subset of that of 'bsl::basic_string', restricted to the operations most
+// commonly applied to short identifiers (construction, assignment, appending,
+// element access, and comparison).
+//
+///Motivation
+///----------
+// 'bsl::basic_string' stores strings of up to 23 'char's (19 on 32-bit
+// platforms) without allocating memory; the size of this "short string buffer"
+// is fixed by the layout of 'basic_string', and so cannot be tuned per use.
+// Identifiers of 20 to 64 characters (e.g., security identifiers, topic names,
+// and field keys) are very common in messaging applications, and each copy of
+// such an identifier held in a 'bsl::string' costs an allocation and a
+// deallocation.  A 'basic_inplace_string' sized for the longest identifier of
+// a given kind avoids these costs entirely, and can be copied with a single
+// 'memcpy' of its used portion.
+//
+// Compared with 'bsl::basic_string', a 'basic_inplace_string':
+//
+//: o Never allocates memory, and so does not take an allocator.
+//:
+//: o Throws 'std::length_error' whenever its length would exceed 'CAPACITY'.
+//:
+//: o Has a footprint of roughly 'CAPACITY + 1' characters, however short its
+//:   value.
+//:
+//: o Is trivially copyable and bitwise moveable.
+//
+// A 'basic_inplace_string' hashes (see 'bslh_hash') to the same value as a
+// 'bsl::basic_string' having the same characters, and can be converted
+// implicitly to a 'bslstl::StringRefImp' referring to its characters.
+//
+// Also note that 'basic_inplace_string<char, CAPACITY>' is supported as a
+// string type by the BER encoder and decoder (see 'balber_berutil'), so it can
+// be used in place of 'bsl::string' for bounded-length fields of 'bdlat'
+// message types.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Holding Bounded-Length Identifiers
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are processing trade messages, each of which names an
+// instrument using an identifier of at most 32 characters.  Most identifiers
+// are longer than the short string buffer of 'bsl::string', so holding them in
+// 'bsl::string' objects would cost an allocation per message.
+//
+// First, we define a type for identifiers:
+//..
+//  typedef bsl::basic_inplace_string<char, 32> Identifier;
+//..
+// Then, we create an identifier too long for the short string buffer of
+// 'bsl::string', and observe that it is held in place:
+//..
+//  bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+//  bslma::DefaultAllocatorGuard dag(&da);
+//
+//  Identifier id("XS0123456789 Corp Fixed 2027");
+//
+//  assert(28 == id.size());
+//  assert(32 == id.capacity());
+//  assert("XS0123456789 Corp Fixed 2027" == id);
+//..
+// Next, we append a suffix, and compare the result with a character string:
+//..
+//  id += " Sr";
+//
+//  assert(31 == id.size());
+//  assert("XS0123456789 Corp Fixed 2027 Sr" == id);
+//..
+// Now, we observe that an attempt to exceed the capacity of the identifier
+// throws 'std::length_error', and leaves the identifier unchanged:
+//..
+//  bool caught = false;
+//  try {
+//      id.append("..");
+//  }
+//  catch (const std::length_error&) {
+//      caught = true;
+//  }
+//  assert(true == caught);
+//  assert(31   == id.size());
+//..
+// Finally, we note that none of the above used any memory:
+//..
+//  assert(0 == da.numAllocations());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRING
+#include <bslstl_string.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_OSTREAM
+#include <ostream>
+#define INCLUDED_OSTREAM
+#endif
+
+namespace bsl {
+
+                        // ==========================
+                        // class basic_inplace_string
+                        // ==========================
+
+template <class CHAR_TYPE,
+          std::size_t CAPACITY,
+          class CHAR_TRAITS = char_traits<CHAR_TYPE> >
+class basic_inplace_string {
+    // This class template implements a value-semantic string type holding at
+    // most 'CAPACITY' characters of the (template parameter) type
+    // 'CHAR_TYPE', followed by a null character, within the footprint of the
+    // object.  Operations that would exceed 'CAPACITY' throw
+    // 'std::length_error'.
+
+    BSLMF_ASSERT(0 < CAPACITY);
+
+  public:
+    // PUBLIC TYPES
+    typedef CHAR_TRAITS                             traits_type;
+    typedef CHAR_TYPE                               value_type;
+    typedef std::size_t                             size_type;
+    typedef std::ptrdiff_t                          difference_type;
+    typedef CHAR_TYPE&                              reference;
+    typedef const CHAR_TYPE&                        const_reference;
+    typedef CHAR_TYPE                              *pointer;
+    typedef const CHAR_TYPE                        *const_pointer;
+    typedef CHAR_TYPE                              *iterator;
+    typedef const CHAR_TYPE                        *const_iterator;
+    typedef bsl::reverse_iterator<iterator>         reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+    // CLASS DATA
+    static const size_type npos = ~size_type(0);
+        // Value used to denote "not-a-position", guaranteed to be outside the
+        // range '[ 0, CAPACITY ]'.
+
+  private:
+    // DATA
+    size_type d_length;                  // number of characters held
+    CHAR_TYPE d_buffer[CAPACITY + 1];    // characters, then a null character
+
+    // PRIVATE CLASS METHODS
+    static void checkLength(size_type length, const char *message);
+        // Throw 'std::length_error' with the specified 'message' if the
+        // specified 'length' exceeds 'CAPACITY'.
+
+    // PRIVATE MANIPULATORS
+    void privateSetLength(size_type length);
+        // Set the length of this string to the specified 'length', and write
+        // the terminating null character.  The behavior is undefined unless
+        // 'length <= CAPACITY'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(basic_inplace_string,
+                                   bsl::is_trivially_copyable);
+    BSLMF_NESTED_TRAIT_DECLARATION(basic_inplace_string,
+                                   BloombergLP::bslmf::IsBitwiseMoveable);
+
+    // CREATORS
+    basic_inplace_string();
+        // Create an empty string.
+
+    basic_inplace_string(const basic_inplace_string& original);
+        // Create a string having the value of the specified 'original'
+        // string.  Note that only the characters of 'original' (and not its
+        // entire buffer) are copied.
+
+    basic_inplace_string(const CHAR_TYPE *characterString);         // IMPLICIT
+        // Create a string holding the characters of the specified
+        // null-terminated 'characterString' (excluding the null character).
+        // Throw 'std::length_error' if the length of 'characterString'
+        // exceeds 'CAPACITY'.  The behavior is undefined unless
+        // 'characterString' is not null.
+
+    basic_inplace_string(const CHAR_TYPE *characterString,
+                         size_type        numChars);
+        // Create a string holding the specified 'numChars' characters of the
+        // array starting at the specified 'characterString'.  Throw
+        // 'std::length_error' if 'CAPACITY < numChars'.  The behavior is
+        // undefined unless 'characterString' refers to an array of at least
+        // 'numChars' characters.
+
+    basic_inplace_string(size_type numChars, CHAR_TYPE character);
+        // Create a string holding the specified 'numChars' copies of the
+        // specified 'character'.  Throw 'std::length_error' if
+        // 'CAPACITY < numChars'.
+
+    template <class ALLOCATOR>
+    explicit
+    basic_inplace_string(
+             const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& original);
+        // Create a string holding the characters of the specified 'original'
+        // string.  Throw 'std::length_error' if 'CAPACITY < original.size()'.
+
+    explicit
+    basic_inplace_string(
+            const BloombergLP::bslstl::StringRefImp<CHAR_TYPE>& strRef);
+        // Create a string holding the characters referred to by the
+        // specified 'strRef'.  Throw 'std::length_error' if
+        // 'CAPACITY < strRef.length()'.
+
+    // ~basic_inplace_string() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    basic_inplace_string& operator=(const basic_inplace_string& rhs);
+        // Assign to this string the value of the specified 'rhs' string, and
+        // return a reference providing modifiable access to this string.
+
+    basic_inplace_string& operator=(const CHAR_TYPE *rhs);
+        // Assign to this string the characters of the specified
+        // null-terminated 'rhs', and return a reference providing modifiable
+        // access to this string.  Throw 'std::length_error', leaving this
+        // string unchanged, if the length of 'rhs' exceeds 'CAPACITY'.
+
+    basic_inplace_string& operator=(CHAR_TYPE character);
+        // Assign to this string the single specified 'character', and return
+        // a reference providing modifiable access to this string.
+
+    basic_inplace_string& operator+=(const basic_inplace_string& rhs);
+    basic_inplace_string& operator+=(const CHAR_TYPE *rhs);
+    basic_inplace_string& operator+=(CHAR_TYPE character);
+        // Append to this string the characters of the specified 'rhs' string
+        // (or the specified 'character'), and return a reference providing
+        // modifiable access to this string.  Throw 'std::length_error',
+        // leaving this string unchanged, if the resulting length would exceed
+        // 'CAPACITY'.
+
+    basic_inplace_string& assign(const CHAR_TYPE *characterString);
+    basic_inplace_string& assign(const CHAR_TYPE *characterString,
+                                 size_type        numChars);
+    basic_inplace_string& assign(size_type numChars, CHAR_TYPE character);
+    template <class ALLOCATOR>
+    basic_inplace_string& assign(
+                 const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& str);
+    basic_inplace_string& assign(
+               const BloombergLP::bslstl::StringRefImp<CHAR_TYPE>& strRef);
+        // Assign to this string the characters that would be held by a
+        // string constructed from the specified arguments, and return a
+        // reference providing modifiable access to this string.  Throw
+        // 'std::length_error', leaving this string unchanged, if the
+        // resulting length would exceed 'CAPACITY'.  The characters assigned
+        // may be part of this string.
+
+    basic_inplace_string& append(const basic_inplace_string& str);
+    basic_inplace_string& append(const CHAR_TYPE *characterString);
+    basic_inplace_string& append(const CHAR_TYPE *characterString,
+                                 size_type        numChars);
+    basic_inplace_string& append(size_type numChars, CHAR_TYPE character);
+        // Append to this string the characters that would be held by a
+        // string constructed from the specified arguments, and return a
+        // reference providing modifiable access to this string.  Throw
+        // 'std::length_error', leaving this string unchanged, if the
+        // resulting length would exceed 'CAPACITY'.  The characters appended
+        // may be part of this string.
+
+    void push_back(CHAR_TYPE character);
+        // Append the specified 'character' to this string.  Throw
+        // 'std::length_error', leaving this string unchanged, if
+        // 'CAPACITY == size()'.
+
+    void pop_back();
+        // Remove the last character of this string.  The behavior is
+        // undefined unless this string is not empty.
+
+    void clear();
+        // Remove all characters from this string.
+
+    void resize(size_type newLength);
+    void resize(size_type newLength, CHAR_TYPE character);
+        // Change the length of this string to the specified 'newLength',
+        // appending copies of the optionally specified 'character' (or
+        // 'CHAR_TYPE()' otherwise) if 'size() < newLength', and removing
+        // trailing characters otherwise.  Throw 'std::length_error', leaving
+        // this string unchanged, if 'CAPACITY < newLength'.
+
+    basic_inplace_string& erase(size_type position = 0,
+                                size_type numChars = npos);
+        // Remove the lesser of the specified 'numChars' and
+        // 'size() - position' characters starting at the specified 'position'
+        // (all characters from 'position' by default), and return a reference
+        // providing modifiable access to this string.  Throw
+        // 'std::out_of_range' if 'size() < position'.
+
+                             // *** iterators ***
+
+    iterator begin();
+    iterator end();
+        // Return an iterator referring to the first character of this string
+        // (or the past-the-end position if this string is empty), or to the
+        // past-the-end position, respectively.
+
+    reverse_iterator rbegin();
+    reverse_iterator rend();
+        // Return a reverse iterator referring to the last character of this
+        // string (or the past-the-end position if this string is empty), or
+        // to the reverse past-the-end position, respectively.
+
+                           // *** element access ***
+
+    reference operator[](size_type position);
+        // Return a reference to the modifiable character at the specified
+        // 'position' of this string.  The behavior is undefined unless
+        // 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference to the modifiable character at the specified
+        // 'position' of this string.  Throw 'std::out_of_range' if
+        // 'size() <= position'.
+
+    reference front();
+    reference back();
+        // Return a reference to the modifiable first (or last, respectively)
+        // character of this string.  The behavior is undefined unless this
+        // string is not empty.
+
+    // ACCESSORS
+
+                             // *** iterators ***
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator referring to the first character of this string
+        // (or the past-the-end position if this string is empty), or to the
+        // past-the-end position, respectively.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator referring to the last character of this
+        // string (or the past-the-end position if this string is empty), or
+        // to the reverse past-the-end position, respectively.
+
+                           // *** element access ***
+
+    const_reference operator[](size_type position) const;
+        // Return a reference to the non-modifiable character at the specified
+        // 'position' of this string, or to the terminating null character if
+        // 'position == size()'.  The behavior is undefined unless
+        // 'position <= size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference to the non-modifiable character at the specified
+        // 'position' of this string.  Throw 'std::out_of_range' if
+        // 'size() <= position'.
+
+    const_reference front() const;
+    const_reference back() const;
+        // Return a reference to the non-modifiable first (or last,
+        // respectively) character of this string.  The behavior is undefined
+        // unless this string is not empty.
+
+    const CHAR_TYPE *c_str() const;
+    const CHAR_TYPE *data() const;
+        // Return the address of the null-terminated array of characters held
+        // by this string.
+
+                             // *** capacity ***
+
+    size_type size() const;
+    size_type length() const;
+        // Return the number of characters in this string.
+
+    size_type max_size() const;
+    size_type capacity() const;
+        // Return 'CAPACITY', the maximum number of characters this string can
+        // hold.
+
+    bool empty() const;
+        // Return 'true' if this string holds no characters, and 'false'
+        // otherwise.
+
+                            // *** comparison ***
+
+    int compare(const basic_inplace_string& other) const;
+    int compare(const CHAR_TYPE *other) const;
+        // Lexicographically compare the characters of this string with those
+        // of the specified 'other' string (using 'CHAR_TRAITS::compare'), and
+        // return a negative value if this string is less than 'other', a
+        // positive value if it is greater, and 0 otherwise.  The behavior is
+        // undefined unless 'other' is not null.
+
+                             // *** conversion ***
+
+    operator BloombergLP::bslstl::StringRefImp<CHAR_TYPE>() const;
+        // Return a string reference referring to the characters of this
+        // string.
+};
+
+// FREE OPERATORS
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator==(
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs);
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator==(
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+            const CHAR_TYPE                                              *rhs);
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator==(
+            const CHAR_TYPE                                              *lhs,
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings have the same
+    // value, and 'false' otherwise.  Two strings have the same value if they
+    // have the same length, and each character of one is equal to the
+    // corresponding character of the other.  The behavior is undefined unless
+    // a character string argument is null-terminated.
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator!=(
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs);
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator!=(
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+            const CHAR_TYPE                                              *rhs);
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator!=(
+            const CHAR_TYPE                                              *lhs,
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' strings do not have the
+    // same value, and 'false' otherwise.  The behavior is undefined unless a
+    // character string argument is null-terminated.
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator<(
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs);
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator>(
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs);
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator<=(
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs);
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+bool operator>=(
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+            const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs);
+    // Return the result of lexicographically comparing the specified 'lhs'
+    // and 'rhs' strings (see 'basic_inplace_string::compare').
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+native_std::basic_ostream<CHAR_TYPE, CHAR_TRAITS>&
+operator<<(
+         native_std::basic_ostream<CHAR_TYPE, CHAR_TRAITS>&            stream,
+         const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& string);
+    // Write the characters of the specified 'string' to the specified output
+    // 'stream', and return a reference to 'stream'.
+
+// FREE FUNCTIONS
+template <class HASHALG, class CHAR_TYPE, std::size_t CAPACITY,
+          class CHAR_TRAITS>
+void hashAppend(
+       HASHALG&                                                      hashAlg,
+       const basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& input);
+    // Pass the specified 'input' string to the specified 'hashAlg' hashing
+    // algorithm of (template parameter) type 'HASHALG'.  Note that the
+    // resulting hash value is the same as for a 'basic_string' holding the
+    // same characters.
+
+// ============================================================================
+//                  INLINE AND TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class basic_inplace_string
+                        // --------------------------
+
+// CLASS DATA
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+const
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::size_type
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::npos;
+
+// PRIVATE CLASS METHODS
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+void basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::checkLength(
+                                                      size_type   length,
+                                                      const char *message)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(length > CAPACITY)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(message);
+    }
+}
+
+// PRIVATE MANIPULATORS
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+void basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::privateSetLength(
+                                                              size_type length)
+{
+    BSLS_ASSERT_SAFE(length <= CAPACITY);
+
+    d_length = length;
+    CHAR_TRAITS::assign(d_buffer[length], CHAR_TYPE());
+}
+
+// CREATORS
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::basic_inplace_string()
+{
+    privateSetLength(0);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::basic_inplace_string(
+                                       const basic_inplace_string& original)
+: d_length(original.d_length)
+{
+    CHAR_TRAITS::copy(d_buffer, original.d_buffer, d_length + 1);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::basic_inplace_string(
+                                             const CHAR_TYPE *characterString)
+{
+    BSLS_ASSERT_SAFE(characterString);
+
+    const size_type numChars = CHAR_TRAITS::length(characterString);
+    checkLength(numChars,
+                "inplace_string<...>(const C *s): string too long");
+    CHAR_TRAITS::copy(d_buffer, characterString, numChars);
+    privateSetLength(numChars);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::basic_inplace_string(
+                                             const CHAR_TYPE *characterString,
+                                             size_type        numChars)
+{
+    BSLS_ASSERT_SAFE(characterString || 0 == numChars);
+
+    checkLength(numChars,
+                "inplace_string<...>(const C *s, n): string too long");
+    CHAR_TRAITS::copy(d_buffer, characterString, numChars);
+    privateSetLength(numChars);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::basic_inplace_string(
+                                                       size_type numChars,
+                                                       CHAR_TYPE character)
+{
+    checkLength(numChars, "inplace_string<...>(n, c): string too long");
+    CHAR_TRAITS::assign(d_buffer, numChars, character);
+    privateSetLength(numChars);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+template <class ALLOCATOR>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::basic_inplace_string(
+              const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& original)
+{
+    checkLength(original.size(),
+                "inplace_string<...>(const string& s): string too long");
+    CHAR_TRAITS::copy(d_buffer, original.data(), original.size());
+    privateSetLength(original.size());
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::basic_inplace_string(
+             const BloombergLP::bslstl::StringRefImp<CHAR_TYPE>& strRef)
+{
+    checkLength(strRef.length(),
+                "inplace_string<...>(const StringRef& s): string too long");
+    CHAR_TRAITS::copy(d_buffer, strRef.data(), strRef.length());
+    privateSetLength(strRef.length());
+}
+
+// MANIPULATORS
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::operator=(
+                                               const basic_inplace_string& rhs)
+{
+    if (this != &rhs) {
+        d_length = rhs.d_length;
+        CHAR_TRAITS::copy(d_buffer, rhs.d_buffer, d_length + 1);
+    }
+    return *this;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::operator=(
+                                                          const CHAR_TYPE *rhs)
+{
+    return assign(rhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::operator=(
+                                                           CHAR_TYPE character)
+{
+    CHAR_TRAITS::assign(d_buffer[0], character);
+    privateSetLength(1);
+    return *this;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::operator+=(
+                                               const basic_inplace_string& rhs)
+{
+    return append(rhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::operator+=(
+                                                          const CHAR_TYPE *rhs)
+{
+    return append(rhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::operator+=(
+                                                           CHAR_TYPE character)
+{
+    push_back(character);
+    return *this;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::assign(
+                                              const CHAR_TYPE *characterString)
+{
+    BSLS_ASSERT_SAFE(characterString);
+
+    return assign(characterString, CHAR_TRAITS::length(characterString));
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::assign(
+                                              const CHAR_TYPE *characterString,
+                                              size_type        numChars)
+{
+    BSLS_ASSERT_SAFE(characterString || 0 == numChars);
+
+    checkLength(numChars,
+                "inplace_string<...>::assign(const C *s, n): string too long");
+
+    // 'characterString' may refer to the characters of this string, hence
+    // 'move' rather than 'copy'.
+
+    CHAR_TRAITS::move(d_buffer, characterString, numChars);
+    privateSetLength(numChars);
+    return *this;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::assign(
+                                                       size_type numChars,
+                                                       CHAR_TYPE character)
+{
+    checkLength(numChars,
+                "inplace_string<...>::assign(n, c): string too long");
+    CHAR_TRAITS::assign(d_buffer, numChars, character);
+    privateSetLength(numChars);
+    return *this;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+template <class ALLOCATOR>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::assign(
+                   const basic_string<CHAR_TYPE, CHAR_TRAITS, ALLOCATOR>& str)
+{
+    return assign(str.data(), str.size());
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::assign(
+                 const BloombergLP::bslstl::StringRefImp<CHAR_TYPE>& strRef)
+{
+    return assign(strRef.data(), strRef.length());
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::append(
+                                               const basic_inplace_string& str)
+{
+    return append(str.d_buffer, str.d_length);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::append(
+                                              const CHAR_TYPE *characterString)
+{
+    BSLS_ASSERT_SAFE(characterString);
+
+    return append(characterString, CHAR_TRAITS::length(characterString));
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::append(
+                                              const CHAR_TYPE *characterString,
+                                              size_type        numChars)
+{
+    BSLS_ASSERT_SAFE(characterString || 0 == numChars);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numChars >
+                                                       CAPACITY - d_length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                "inplace_string<...>::append(const C *s, n): string too long");
+    }
+
+    // The characters appended may be a part of this string, but cannot
+    // overlap the (unused) portion of the buffer they are copied to.
+
+    CHAR_TRAITS::copy(d_buffer + d_length, characterString, numChars);
+    privateSetLength(d_length + numChars);
+    return *this;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::append(
+                                                       size_type numChars,
+                                                       CHAR_TYPE character)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numChars >
+                                                       CAPACITY - d_length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                         "inplace_string<...>::append(n, c): string too long");
+    }
+    CHAR_TRAITS::assign(d_buffer + d_length, numChars, character);
+    privateSetLength(d_length + numChars);
+    return *this;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+void basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::push_back(
+                                                           CHAR_TYPE character)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(CAPACITY == d_length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                             "inplace_string<...>::push_back(c): string full");
+    }
+    CHAR_TRAITS::assign(d_buffer[d_length], character);
+    privateSetLength(d_length + 1);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+void basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    privateSetLength(d_length - 1);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+void basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::clear()
+{
+    privateSetLength(0);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+void basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::resize(
+                                                           size_type newLength)
+{
+    resize(newLength, CHAR_TYPE());
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+void basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::resize(
+                                                       size_type newLength,
+                                                       CHAR_TYPE character)
+{
+    checkLength(newLength,
+                "inplace_string<...>::resize(n, c): string too long");
+    if (newLength > d_length) {
+        CHAR_TRAITS::assign(d_buffer + d_length,
+                            newLength - d_length,
+                            character);
+    }
+    privateSetLength(newLength);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>&
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::erase(
+                                                        size_type position,
+                                                        size_type numChars)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position > d_length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                    "inplace_string<...>::erase(pos, n): invalid position");
+    }
+    if (numChars > d_length - position) {
+        numChars = d_length - position;
+    }
+    CHAR_TRAITS::move(d_buffer + position,
+                      d_buffer + position + numChars,
+                      d_length - position - numChars);
+    privateSetLength(d_length - numChars);
+    return *this;
+}
+
+                             // *** iterators ***
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::begin()
+{
+    return d_buffer;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::end()
+{
+    return d_buffer + d_length;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::reverse_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::reverse_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+                           // *** element access ***
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::reference
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::operator[](
+                                                            size_type position)
+{
+    BSLS_ASSERT_SAFE(position < d_length);
+
+    return d_buffer[position];
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::reference
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= d_length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                              "inplace_string<...>::at(n): invalid position");
+    }
+    return d_buffer[position];
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::reference
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_buffer[0];
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::reference
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_buffer[d_length - 1];
+}
+
+// ACCESSORS
+
+                             // *** iterators ***
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::begin() const
+{
+    return d_buffer;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::cbegin() const
+{
+    return d_buffer;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::end() const
+{
+    return d_buffer + d_length;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::cend() const
+{
+    return d_buffer + d_length;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_reverse_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_reverse_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_reverse_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_reverse_iterator
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+                           // *** element access ***
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_reference
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::operator[](
+                                                      size_type position) const
+{
+    BSLS_ASSERT_SAFE(position <= d_length);
+
+    return d_buffer[position];
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_reference
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::at(
+                                                      size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= d_length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                        "const inplace_string<...>::at(n): invalid position");
+    }
+    return d_buffer[position];
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_reference
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_buffer[0];
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::const_reference
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_buffer[d_length - 1];
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+const CHAR_TYPE *
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::c_str() const
+{
+    return d_buffer;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+const CHAR_TYPE *
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::data() const
+{
+    return d_buffer;
+}
+
+                             // *** capacity ***
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::size_type
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::size() const
+{
+    return d_length;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::size_type
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::length() const
+{
+    return d_length;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::size_type
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::max_size() const
+{
+    return CAPACITY;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+typename basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::size_type
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::capacity() const
+{
+    return CAPACITY;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::empty() const
+{
+    return 0 == d_length;
+}
+
+                            // *** comparison ***
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+int basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::compare(
+                                       const basic_inplace_string& other) const
+{
+    const size_type numChars = d_length < other.d_length ? d_length
+                                                         : other.d_length;
+    const int result = CHAR_TRAITS::compare(d_buffer,
+                                            other.d_buffer,
+                                            numChars);
+    if (result) {
+        return result;                                                // RETURN
+    }
+    return d_length < other.d_length ? -1 : d_length > other.d_length;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+int basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::compare(
+                                                  const CHAR_TYPE *other) const
+{
+    BSLS_ASSERT_SAFE(other);
+
+    const size_type otherLength = CHAR_TRAITS::length(other);
+    const size_type numChars    = d_length < otherLength ? d_length
+                                                         : otherLength;
+    const int result = CHAR_TRAITS::compare(d_buffer, other, numChars);
+    if (result) {
+        return result;                                                // RETURN
+    }
+    return d_length < otherLength ? -1 : d_length > otherLength;
+}
+
+                             // *** conversion ***
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>::
+                  operator BloombergLP::bslstl::StringRefImp<CHAR_TYPE>() const
+{
+    return BloombergLP::bslstl::StringRefImp<CHAR_TYPE>(d_buffer,
+                                                        d_buffer + d_length);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator==(
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && 0 == CHAR_TRAITS::compare(lhs.data(), rhs.data(), lhs.size());
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator==(
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+        const CHAR_TYPE                                                   *rhs)
+{
+    return 0 == lhs.compare(rhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator==(
+        const CHAR_TYPE                                                   *lhs,
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs)
+{
+    return 0 == rhs.compare(lhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator!=(
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator!=(
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+        const CHAR_TYPE                                                   *rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator!=(
+        const CHAR_TYPE                                                   *lhs,
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator<(
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs)
+{
+    return 0 > lhs.compare(rhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator>(
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator<=(
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+bool bsl::operator>=(
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& lhs,
+        const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class CHAR_TYPE, std::size_t CAPACITY, class CHAR_TRAITS>
+inline
+native_std::basic_ostream<CHAR_TYPE, CHAR_TRAITS>&
+bsl::operator<<(
+    native_std::basic_ostream<CHAR_TYPE, CHAR_TRAITS>&                 stream,
+    const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& string)
+{
+    return stream.write(string.data(), string.size());
+}
+
+// FREE FUNCTIONS
+template <class HASHALG, class CHAR_TYPE, std::size_t CAPACITY,
+          class CHAR_TRAITS>
+inline
+void bsl::hashAppend(
+  HASHALG&                                                           hashAlg,
+  const bsl::basic_inplace_string<CHAR_TYPE, CAPACITY, CHAR_TRAITS>& input)
+{
+    using ::BloombergLP::bslh::hashAppend;
+    hashAlg(input.data(), sizeof(CHAR_TYPE) * input.size());
+    hashAppend(hashAlg, input.size());
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1132 @@
+// bslstl_inplacestring.t.cpp                                         -*-C++-*-
+#include <bslstl_inplacestring.h>
+
+#include <bslstl_string.h>
+#include <bslstl_stringref.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslh_hash.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_istriviallycopyable.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <new>          // placement 'new'
+#include <sstream>      // 'std::ostringstream'
+#include <stdexcept>    // 'std::length_error', 'std::out_of_range'
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>     // 'strlen', 'memset'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic string type,
+// 'bsl::basic_inplace_string', that holds up to 'CAPACITY' characters within
+// its own footprint, and never allocates memory.  The primary manipulators
+// are the default constructor, 'push_back', and 'clear'; the basic accessors
+// are 'size', 'capacity', 'c_str', and 'operator[]'.  Every manipulator that
+// can exceed 'CAPACITY' is verified to throw 'std::length_error' and leave the
+// object unchanged.  All test cases install a test allocator as the default
+// allocator, and verify that it is never used.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] basic_inplace_string();
+// [ 2] basic_inplace_string(const basic_inplace_string& original);
+// [ 2] basic_inplace_string(const CHAR_TYPE *characterString);
+// [ 2] basic_inplace_string(const CHAR_TYPE *characterString, size_type n);
+// [ 2] basic_inplace_string(size_type numChars, CHAR_TYPE character);
+// [ 2] basic_inplace_string(const basic_string<C, T, A>& original);
+// [ 2] basic_inplace_string(const StringRefImp<CHAR_TYPE>& strRef);
+//
+// MANIPULATORS
+// [ 2] basic_inplace_string& operator=(const basic_inplace_string& rhs);
+// [ 2] basic_inplace_string& operator=(const CHAR_TYPE *rhs);
+// [ 2] basic_inplace_string& operator=(CHAR_TYPE character);
+// [ 3] basic_inplace_string& operator+=(const basic_inplace_string& rhs);
+// [ 3] basic_inplace_string& operator+=(const CHAR_TYPE *rhs);
+// [ 3] basic_inplace_string& operator+=(CHAR_TYPE character);
+// [ 2] basic_inplace_string& assign(const CHAR_TYPE *characterString);
+// [ 2] basic_inplace_string& assign(const CHAR_TYPE *s, size_type n);
+// [ 2] basic_inplace_string& assign(size_type n, CHAR_TYPE c);
+// [ 2] basic_inplace_string& assign(const basic_string<C, T, A>& str);
+// [ 2] basic_inplace_string& assign(const StringRefImp<CHAR_TYPE>& strRef);
+// [ 3] basic_inplace_string& append(const basic_inplace_string& str);
+// [ 3] basic_inplace_string& append(const CHAR_TYPE *characterString);
+// [ 3] basic_inplace_string& append(const CHAR_TYPE *s, size_type n);
+// [ 3] basic_inplace_string& append(size_type n, CHAR_TYPE c);
+// [ 2] void push_back(CHAR_TYPE character);
+// [ 3] void pop_back();
+// [ 2] void clear();
+// [ 3] void resize(size_type newLength);
+// [ 3] void resize(size_type newLength, CHAR_TYPE character);
+// [ 3] basic_inplace_string& erase(size_type position, size_type numChars);
+// [ 4] iterator begin();
+// [ 4] iterator end();
+// [ 4] reverse_iterator rbegin();
+// [ 4] reverse_iterator rend();
+// [ 4] reference operator[](size_type position);
+// [ 4] reference at(size_type position);
+// [ 4] reference front();
+// [ 4] reference back();
+//
+// ACCESSORS
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator cbegin() const;
+// [ 4] const_iterator end() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_reverse_iterator rbegin() const;
+// [ 4] const_reverse_iterator crbegin() const;
+// [ 4] const_reverse_iterator rend() const;
+// [ 4] const_reverse_iterator crend() const;
+// [ 2] const_reference operator[](size_type position) const;
+// [ 4] const_reference at(size_type position) const;
+// [ 4] const_reference front() const;
+// [ 4] const_reference back() const;
+// [ 2] const CHAR_TYPE *c_str() const;
+// [ 2] const CHAR_TYPE *data() const;
+// [ 2] size_type size() const;
+// [ 2] size_type length() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type capacity() const;
+// [ 2] bool empty() const;
+// [ 4] int compare(const basic_inplace_string& other) const;
+// [ 4] int compare(const CHAR_TYPE *other) const;
+// [ 4] operator StringRefImp<CHAR_TYPE>() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const Obj& lhs, const Obj& rhs);
+// [ 4] bool operator==(const Obj& lhs, const CHAR_TYPE *rhs);
+// [ 4] bool operator==(const CHAR_TYPE *lhs, const Obj& rhs);
+// [ 4] bool operator!=(const Obj& lhs, const Obj& rhs);
+// [ 4] bool operator!=(const Obj& lhs, const CHAR_TYPE *rhs);
+// [ 4] bool operator!=(const CHAR_TYPE *lhs, const Obj& rhs);
+// [ 4] bool operator<(const Obj& lhs, const Obj& rhs);
+// [ 4] bool operator>(const Obj& lhs, const Obj& rhs);
+// [ 4] bool operator<=(const Obj& lhs, const Obj& rhs);
+// [ 4] bool operator>=(const Obj& lhs, const Obj& rhs);
+// [ 4] ostream& operator<<(ostream& stream, const Obj& string);
+//
+// FREE FUNCTIONS
+// [ 4] void hashAppend(HASHALG& hashAlg, const Obj& input);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] ALIASING
+// [ 4] TYPE TRAITS
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARED WITH 'bsl::string'
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsl::basic_inplace_string<char, 8> Obj;
+
+static const char *const LONG = "0123456789abcdefghijklmnopqrstuvwxyz";
+    // A string longer than the capacity of 'Obj'.
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Holding Bounded-Length Identifiers
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are processing trade messages, each of which names an
+// instrument using an identifier of at most 32 characters.  Most identifiers
+// are longer than the short string buffer of 'bsl::string', so holding them in
+// 'bsl::string' objects would cost an allocation per message.
+//
+// First, we define a type for identifiers:
+//..
+  typedef bsl::basic_inplace_string<char, 32> Identifier;
+//..
+// Then, we create an identifier too long for the short string buffer of
+// 'bsl::string', and observe that it is held in place:
+//..
+  bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+  bslma::DefaultAllocatorGuard dag(&da);
+
+  Identifier id("XS0123456789 Corp Fixed 2027");
+
+  ASSERT(28 == id.size());
+  ASSERT(32 == id.capacity());
+  ASSERT("XS0123456789 Corp Fixed 2027" == id);
+//..
+// Next, we append a suffix, and compare the result with a character string:
+//..
+  id += " Sr";
+
+  ASSERT(31 == id.size());
+  ASSERT("XS0123456789 Corp Fixed 2027 Sr" == id);
+//..
+// Now, we observe that an attempt to exceed the capacity of the identifier
+// throws 'std::length_error', and leaves the identifier unchanged:
+//..
+  bool caught = false;
+  try {
+      id.append("..");
+  }
+  catch (const std::length_error&) {
+      caught = true;
+  }
+  ASSERT(true == caught);
+  ASSERT(31   == id.size());
+//..
+// Finally, we note that none of the above used any memory:
+//..
+  ASSERT(0 == da.numAllocations());
+//..
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ACCESSORS, COMPARISON, AND TRAITS
+        //
+        // Concerns:
+        //: 1 Iterators and element accessors refer to the characters of the
+        //:   string, and 'at' throws 'std::out_of_range' for an invalid
+        //:   position.
+        //:
+        //: 2 'compare' and the relational operators order strings
+        //:   lexicographically, a prefix ordering before a longer string, and
+        //:   strings having different characters beyond their length (left
+        //:   over by earlier values) compare equal.
+        //:
+        //: 3 The conversion to 'bslstl::StringRef' refers to the characters
+        //:   of the string, and 'operator<<' writes them.
+        //:
+        //: 4 The hash of a string is the same as that of a 'bsl::string'
+        //:   holding the same characters.
+        //:
+        //: 5 The class is trivially copyable and bitwise moveable.
+        //
+        // Plan:
+        //: 1 Using a table of strings in increasing order, compare each pair
+        //:   of strings using each operator.  (C-2)
+        //:
+        //: 2 Exercise the iterators and element accessors on a known value.
+        //:   (C-1)
+        //:
+        //: 3 Convert a string to a 'StringRef', stream it, and hash it with
+        //:   'bslh::Hash<>', comparing with a 'bsl::string'.  (C-3..4)
+        //:
+        //: 4 Verify the traits with 'BSLMF_ASSERT'.  (C-5)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   reference operator[](size_type position);
+        //   reference at(size_type position);
+        //   reference front();
+        //   reference back();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        //   const_reference at(size_type position) const;
+        //   const_reference front() const;
+        //   const_reference back() const;
+        //   int compare(const basic_inplace_string& other) const;
+        //   int compare(const CHAR_TYPE *other) const;
+        //   operator StringRefImp<CHAR_TYPE>() const;
+        //   bool operator==(const Obj& lhs, const Obj& rhs);
+        //   bool operator==(const Obj& lhs, const CHAR_TYPE *rhs);
+        //   bool operator==(const CHAR_TYPE *lhs, const Obj& rhs);
+        //   bool operator!=(const Obj& lhs, const Obj& rhs);
+        //   bool operator!=(const Obj& lhs, const CHAR_TYPE *rhs);
+        //   bool operator!=(const CHAR_TYPE *lhs, const Obj& rhs);
+        //   bool operator<(const Obj& lhs, const Obj& rhs);
+        //   bool operator>(const Obj& lhs, const Obj& rhs);
+        //   bool operator<=(const Obj& lhs, const Obj& rhs);
+        //   bool operator>=(const Obj& lhs, const Obj& rhs);
+        //   ostream& operator<<(ostream& stream, const Obj& string);
+        //   void hashAppend(HASHALG& hashAlg, const Obj& input);
+        //   TYPE TRAITS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nACCESSORS, COMPARISON, AND TRAITS"
+                            "\n=================================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tTesting relational operators.\n");
+        {
+            static const char *const DATA[] = {
+                "", "A", "AA", "AAB", "AB", "ABCDEFGH", "B", "BA", "a"
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                Obj mX(LONG, 8);  const Obj& X = mX;
+
+                // Leave characters of the previous value beyond the length.
+
+                mX = DATA[ti];
+
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const Obj Y(DATA[tj]);
+
+                    const int EXP = ti < tj ? -1 : ti > tj;
+                    const int RESULT = X.compare(Y);
+                    ASSERTV(ti, tj, EXP == (RESULT > 0) - (RESULT < 0));
+
+                    const int RESULT2 = X.compare(DATA[tj]);
+                    ASSERTV(ti, tj, EXP == (RESULT2 > 0) - (RESULT2 < 0));
+
+                    ASSERTV(ti, tj, (ti == tj) == (X == Y));
+                    ASSERTV(ti, tj, (ti == tj) == (X == DATA[tj]));
+                    ASSERTV(ti, tj, (ti == tj) == (DATA[tj] == X));
+                    ASSERTV(ti, tj, (ti != tj) == (X != Y));
+                    ASSERTV(ti, tj, (ti != tj) == (X != DATA[tj]));
+                    ASSERTV(ti, tj, (ti != tj) == (DATA[tj] != X));
+                    ASSERTV(ti, tj, (ti <  tj) == (X <  Y));
+                    ASSERTV(ti, tj, (ti >  tj) == (X >  Y));
+                    ASSERTV(ti, tj, (ti <= tj) == (X <= Y));
+                    ASSERTV(ti, tj, (ti >= tj) == (X >= Y));
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting iterators and element access.\n");
+        {
+            Obj mX("abcd");  const Obj& X = mX;
+
+            ASSERT(4 == X.end() - X.begin());
+            ASSERT(X.begin()  == X.cbegin());
+            ASSERT(X.end()    == X.cend());
+            ASSERT(X.c_str()  == X.begin());
+            ASSERT('d'        == *X.rbegin());
+            ASSERT('d'        == *X.crbegin());
+            ASSERT(4          == X.rend() - X.rbegin());
+            ASSERT(X.rend()   == X.crend());
+            ASSERT('a'        == X.front());
+            ASSERT('d'        == X.back());
+            ASSERT('c'        == X.at(2));
+            ASSERT('\0'       == X[4]);
+
+            *mX.begin()  = 'A';
+            *mX.rbegin() = 'D';
+            mX[1]        = 'B';
+            mX.at(2)     = 'C';
+            ASSERT("ABCD" == X);
+
+            mX.front() = 'w';
+            mX.back()  = 'z';
+            ASSERT("wBCz" == X);
+            ASSERT(4 == mX.end() - mX.begin());
+            ASSERT(4 == mX.rend() - mX.rbegin());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.at(4);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(4);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+        }
+
+        if (verbose) printf("\tTesting conversion, streaming, and hashing.\n");
+        {
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            typedef bsl::basic_inplace_string<char, 40> LongObj;
+
+            const char *const VALUE = "a string not fitting in a short buffer";
+
+            const LongObj     X(VALUE);
+            const bsl::string S(VALUE, &sa);
+
+            const bslstl::StringRef REF = X;
+            ASSERT(REF.data()   == X.data());
+            ASSERT(REF.length() == X.size());
+
+            std::ostringstream oss;
+            oss << X;
+            ASSERT(VALUE == oss.str());
+
+            ASSERT(bslh::Hash<>()(S) == bslh::Hash<>()(X));
+            ASSERT(bslh::Hash<>()(S) != bslh::Hash<>()(LongObj("x")));
+        }
+
+        if (verbose) printf("\tTesting type traits.\n");
+        {
+            BSLMF_ASSERT(bsl::is_trivially_copyable<Obj>::value);
+            BSLMF_ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // APPEND, RESIZE, AND ERASE
+        //
+        // Concerns:
+        //: 1 Each overload of 'append' and 'operator+=' appends the expected
+        //:   characters, and keeps the string null-terminated.
+        //:
+        //: 2 'append' and 'resize' accept a resulting length equal to
+        //:   'CAPACITY', and throw 'std::length_error', leaving the string
+        //:   unchanged, for a larger length.
+        //:
+        //: 3 'erase' removes the expected characters, clamps the number of
+        //:   characters removed to the end of the string, and throws
+        //:   'std::out_of_range' for a position past the end.
+        //:
+        //: 4 A string can be appended to, or assigned from, (part of) itself.
+        //
+        // Plan:
+        //: 1 Using a table of initial values and appended values, apply each
+        //:   overload of 'append' and check the result against
+        //:   'bsl::string', including for results exceeding 'CAPACITY'.
+        //:   (C-1..2)
+        //:
+        //: 2 Exercise 'resize', 'pop_back', and 'erase' on known values.
+        //:   (C-2..3)
+        //:
+        //: 3 Append and assign a string from itself.  (C-4)
+        //
+        // Testing:
+        //   basic_inplace_string& operator+=(const basic_inplace_string& rhs);
+        //   basic_inplace_string& operator+=(const CHAR_TYPE *rhs);
+        //   basic_inplace_string& operator+=(CHAR_TYPE character);
+        //   basic_inplace_string& append(const basic_inplace_string& str);
+        //   basic_inplace_string& append(const CHAR_TYPE *characterString);
+        //   basic_inplace_string& append(const CHAR_TYPE *s, size_type n);
+        //   basic_inplace_string& append(size_type n, CHAR_TYPE c);
+        //   void pop_back();
+        //   void resize(size_type newLength);
+        //   void resize(size_type newLength, CHAR_TYPE character);
+        //   basic_inplace_string& erase(size_type position, size_type n);
+        //   ALIASING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nAPPEND, RESIZE, AND ERASE"
+                            "\n=========================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting 'append'.\n");
+        {
+            static const char *const DATA[] = {
+                "", "a", "abc", "abcdefg", "abcdefgh"
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                for (int tj = 0; tj < NUM_DATA; ++tj) {
+                    const char *const INIT = DATA[ti];
+                    const char *const SUFF = DATA[tj];
+
+                    bsl::string exp(INIT, &sa);
+                    exp += SUFF;
+
+                    const bool FITS = exp.size() <= 8;
+
+                    for (int cfg = 0; cfg < 6; ++cfg) {
+                        Obj mX(INIT);  const Obj& X = mX;
+
+                        bool caught = false;
+#ifdef BDE_BUILD_TARGET_EXC
+                        try {
+#endif
+                            switch (cfg) {
+                              case 0: mX.append(SUFF);                 break;
+                              case 1: mX.append(SUFF, strlen(SUFF));   break;
+                              case 2: mX.append(Obj(SUFF));            break;
+                              case 3: mX += SUFF;                      break;
+                              case 4: mX += Obj(SUFF);                 break;
+                              case 5: {
+                                for (const char *p = SUFF; *p; ++p) {
+                                    mX += *p;
+                                }
+                              } break;
+                            }
+#ifdef BDE_BUILD_TARGET_EXC
+                        }
+                        catch (const std::length_error&) {
+                            caught = true;
+                        }
+#endif
+                        ASSERTV(ti, tj, cfg, caught == !FITS);
+                        if (FITS) {
+                            ASSERTV(ti, tj, cfg, exp.c_str() == X);
+                            ASSERTV(ti, tj, cfg, '\0' == X.c_str()[X.size()]);
+                        }
+                        else if (5 != cfg) {
+                            ASSERTV(ti, tj, cfg, INIT == X);
+                        }
+                        else {
+                            // Characters are appended one at a time until
+                            // the string is full.
+
+                            ASSERTV(ti, tj, cfg, exp.substr(0, 8).c_str()
+                                                                        == X);
+                        }
+                    }
+
+                    if (0 == strlen(SUFF)) {
+                        continue;
+                    }
+
+                    Obj mX(INIT);  const Obj& X = mX;
+
+                    bool caught = false;
+#ifdef BDE_BUILD_TARGET_EXC
+                    try {
+#endif
+                        mX.append(strlen(SUFF), SUFF[0]);
+#ifdef BDE_BUILD_TARGET_EXC
+                    }
+                    catch (const std::length_error&) {
+                        caught = true;
+                    }
+#endif
+                    ASSERTV(ti, tj, caught == !FITS);
+                    bsl::string exp2(INIT, &sa);
+                    exp2.append(strlen(SUFF), SUFF[0]);
+                    ASSERTV(ti, tj, (FITS ? exp2.c_str() : INIT) == X);
+                }
+            }
+        }
+
+        if (verbose) printf("\tTesting 'resize' and 'pop_back'.\n");
+        {
+            Obj mX("abc");  const Obj& X = mX;
+
+            mX.resize(5, 'z');
+            ASSERT("abczz" == X);
+
+            mX.resize(2);
+            ASSERT("ab" == X);
+
+            mX.resize(4);
+            ASSERT(4    == X.size());
+            ASSERT('\0' == X[3]);
+            ASSERT(0    == memcmp("ab\0\0", X.data(), 5));
+
+            mX.resize(8, 'x');
+            ASSERT(8 == X.size());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.resize(9);
+            }
+            catch (const std::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(8 == X.size());
+#endif
+
+            mX.pop_back();
+            ASSERT(7   == X.size());
+            ASSERT('x' == X.back());
+            ASSERT('\0' == X.c_str()[7]);
+        }
+
+        if (verbose) printf("\tTesting 'erase'.\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_init;
+                size_t      d_position;
+                size_t      d_numChars;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  INIT        POS  NUM        EXP
+                //----  ----        ---  ---        ---
+                { L_,   "",         0,   0,         ""        },
+                { L_,   "",         0,   Obj::npos, ""        },
+                { L_,   "abcd",     0,   Obj::npos, ""        },
+                { L_,   "abcd",     0,   1,         "bcd"     },
+                { L_,   "abcd",     1,   2,         "ad"      },
+                { L_,   "abcd",     2,   9,         "ab"      },
+                { L_,   "abcd",     4,   1,         "abcd"    },
+                { L_,   "abcdefgh", 7,   1,         "abcdefg" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                Obj mX(DATA[ti].d_init);  const Obj& X = mX;
+
+                Obj& result = mX.erase(DATA[ti].d_position,
+                                       DATA[ti].d_numChars);
+                ASSERTV(LINE, &result == &X);
+                ASSERTV(LINE, X.c_str(), DATA[ti].d_expected == X);
+            }
+
+            Obj mX("abcd");  const Obj& X = mX;
+            mX.erase();
+            ASSERT(X.empty());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            mX = "abcd";
+            bool caught = false;
+            try {
+                mX.erase(5);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT("abcd" == X);
+#endif
+        }
+
+        if (verbose) printf("\tTesting aliasing.\n");
+        {
+            Obj mX("abcd");  const Obj& X = mX;
+
+            mX.append(X);
+            ASSERT("abcdabcd" == X);
+
+            mX.assign(X.data() + 2, 3);
+            ASSERT("cda" == X);
+
+            mX.append(X.data(), 2);
+            ASSERT("cdacd" == X);
+
+            mX = X;
+            ASSERT("cdacd" == X);
+
+            mX += X.c_str() + 3;
+            ASSERT("cdacdcd" == X);
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ASSIGNMENT, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor and each overload of 'assign' and 'operator='
+        //:   creates the expected value, keeping the string null-terminated.
+        //:
+        //: 2 Values of length 'CAPACITY' are accepted, and longer values
+        //:   cause 'std::length_error' to be thrown, leaving an assigned-to
+        //:   string unchanged.
+        //:
+        //: 3 'size', 'length', 'capacity', 'max_size', and 'empty' report
+        //:   the expected values.
+        //:
+        //: 4 The copy constructor and copy-assignment operator copy only the
+        //:   characters of the original (and a null character).
+        //:
+        //: 5 The class template can be instantiated for 'wchar_t'.
+        //:
+        //: 6 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Using a table of values of increasing length, create and assign
+        //:   strings using each constructor and each overload of 'assign',
+        //:   and verify their values and length, including for values longer
+        //:   than 'CAPACITY'.  (C-1..3)
+        //:
+        //: 2 Copy a string into a buffer filled with a sentinel value, and
+        //:   verify that the bytes beyond the null character are unchanged.
+        //:   (C-4)
+        //:
+        //: 3 Repeat some of the above for a 'wchar_t' string.  (C-5)
+        //:
+        //: 4 Verify that the default allocator is unused.  (C-6)
+        //
+        // Testing:
+        //   basic_inplace_string();
+        //   basic_inplace_string(const basic_inplace_string& original);
+        //   basic_inplace_string(const CHAR_TYPE *characterString);
+        //   basic_inplace_string(const CHAR_TYPE *s, size_type n);
+        //   basic_inplace_string(size_type numChars, CHAR_TYPE character);
+        //   basic_inplace_string(const basic_string<C, T, A>& original);
+        //   basic_inplace_string(const StringRefImp<CHAR_TYPE>& strRef);
+        //   basic_inplace_string& operator=(const basic_inplace_string& rhs);
+        //   basic_inplace_string& operator=(const CHAR_TYPE *rhs);
+        //   basic_inplace_string& operator=(CHAR_TYPE character);
+        //   basic_inplace_string& assign(const CHAR_TYPE *characterString);
+        //   basic_inplace_string& assign(const CHAR_TYPE *s, size_type n);
+        //   basic_inplace_string& assign(size_type n, CHAR_TYPE c);
+        //   basic_inplace_string& assign(const basic_string<C, T, A>& str);
+        //   basic_inplace_string& assign(const StringRefImp<CHAR_TYPE>& ref);
+        //   void push_back(CHAR_TYPE character);
+        //   void clear();
+        //   const_reference operator[](size_type position) const;
+        //   const CHAR_TYPE *c_str() const;
+        //   const CHAR_TYPE *data() const;
+        //   size_type size() const;
+        //   size_type length() const;
+        //   size_type max_size() const;
+        //   size_type capacity() const;
+        //   bool empty() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, ASSIGNMENT, AND BASIC ACCESSORS"
+                            "\n=========================================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting default constructor.\n");
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(0    == X.size());
+            ASSERT(0    == X.length());
+            ASSERT(8    == X.capacity());
+            ASSERT(8    == X.max_size());
+            ASSERT('\0' == *X.c_str());
+            ASSERT(X.c_str() == X.data());
+        }
+
+        if (verbose) printf("\tTesting value constructors and 'assign'.\n");
+        {
+            for (size_t len = 0; len <= 9; ++len) {
+                const bool FITS = len <= 8;
+
+                const bsl::string       STR(LONG, len, &sa);
+                const bslstl::StringRef REF(STR);
+
+                for (int cfg = 0; cfg < 12; ++cfg) {
+                    Obj        mX("XY");
+                    const Obj& X = mX;
+
+                    bool caught = false;
+#ifdef BDE_BUILD_TARGET_EXC
+                    try {
+#else
+                    if (!FITS) {
+                        continue;
+                    }
+#endif
+                        switch (cfg) {
+                          case  0: mX = Obj(STR.c_str());               break;
+                          case  1: mX = Obj(LONG, len);                 break;
+                          case  2: mX = Obj(STR);                       break;
+                          case  3: mX = Obj(REF);                       break;
+                          case  4: mX.assign(STR.c_str());              break;
+                          case  5: mX.assign(LONG, len);                break;
+                          case  6: mX.assign(STR);                      break;
+                          case  7: mX.assign(REF);                      break;
+                          case  8: mX = STR.c_str();                    break;
+                          case  9: {
+                            const Obj Y(STR.c_str());
+                            mX = Y;
+                          } break;
+                          case 10: {
+                            const Obj Y(STR.c_str());
+                            const Obj Z(Y);
+                            mX = Z;
+                          } break;
+                          case 11: {
+                            mX.clear();
+                            for (size_t i = 0; i < len; ++i) {
+                                mX.push_back(LONG[i]);
+                            }
+                          } break;
+                        }
+#ifdef BDE_BUILD_TARGET_EXC
+                    }
+                    catch (const std::length_error&) {
+                        caught = true;
+                    }
+#endif
+                    ASSERTV(len, cfg, caught == !FITS);
+                    if (FITS) {
+                        ASSERTV(len, cfg, len == X.size());
+                        ASSERTV(len, cfg, len == X.length());
+                        ASSERTV(len, cfg, (0 == len) == X.empty());
+                        ASSERTV(len, cfg, 0 == memcmp(LONG, X.data(), len));
+                        ASSERTV(len, cfg, '\0' == X[len]);
+                        ASSERTV(len, cfg, STR.c_str() == X);
+                    }
+                    else if (cfg != 11) {
+                        ASSERTV(len, cfg, "XY" == X);
+                    }
+                    else {
+                        ASSERTV(len, cfg, 8 == X.size());
+                    }
+                }
+
+                for (int cfg = 0; cfg < 2; ++cfg) {
+                    Obj        mX("XY");
+                    const Obj& X = mX;
+
+                    bool caught = false;
+#ifdef BDE_BUILD_TARGET_EXC
+                    try {
+#else
+                    if (!FITS) {
+                        continue;
+                    }
+#endif
+                        if (cfg) {
+                            mX.assign(len, 'q');
+                        }
+                        else {
+                            mX = Obj(len, 'q');
+                        }
+#ifdef BDE_BUILD_TARGET_EXC
+                    }
+                    catch (const std::length_error&) {
+                        caught = true;
+                    }
+#endif
+                    ASSERTV(len, cfg, caught == !FITS);
+                    ASSERTV(len, cfg,
+                            (FITS ? bsl::string(len, 'q', &sa)
+                                  : bsl::string("XY", &sa)).c_str() == X);
+                }
+            }
+
+            Obj mX("abc");  const Obj& X = mX;
+            mX = 'z';
+            ASSERT("z" == X);
+        }
+
+        if (verbose) printf("\tTesting that copies copy only the value.\n");
+        {
+            bsls::ObjectBuffer<Obj> buffer;
+
+            memset(buffer.buffer(), 0x5a, sizeof(Obj));
+
+            const Obj X("abc");
+            Obj *mY = new (buffer.buffer()) Obj(X);
+            ASSERT("abc" == *mY);
+            ASSERT(0x5a  == mY->data()[4]);
+
+            const Obj Z("de");
+            *mY = Z;
+            ASSERT("de" == *mY);
+            ASSERT(0x5a == mY->data()[4]);
+        }
+
+        if (verbose) printf("\tTesting 'wchar_t' strings.\n");
+        {
+            typedef bsl::basic_inplace_string<wchar_t, 4> WObj;
+
+            WObj mX(L"abcd");  const WObj& X = mX;
+            ASSERT(4       == X.size());
+            ASSERT(L"abcd" == X);
+
+            mX.pop_back();
+            mX += L'z';
+            ASSERT(L"abcz" == X);
+
+            const bsl::wstring S(L"xy", &sa);
+            mX.assign(S);
+            ASSERT(L"xy" == X);
+
+            WObj mY(S);
+            ASSERT(X == mY);
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a string, grow it up to its capacity, and copy and
+        //:   compare it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(8 == X.capacity());
+
+        mX = "abc";
+        ASSERT(3 == X.size());
+        ASSERT(0 == strcmp("abc", X.c_str()));
+
+        mX.append("defgh");
+        ASSERT(8 == X.size());
+        ASSERT("abcdefgh" == X);
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bool caught = false;
+        try {
+            mX.push_back('i');
+        }
+        catch (const std::length_error&) {
+            caught = true;
+        }
+        ASSERT(caught);
+        ASSERT("abcdefgh" == X);
+#endif
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.pop_back();
+        ASSERT(X != Y);
+        ASSERT(X >  Y);
+
+        mY.clear();
+        ASSERT(Y.empty());
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARED WITH 'bsl::string'
+        //   Compare the time taken, and the number of allocations made, to
+        //   copy many strings of lengths cycling through '[16 .. 64]' into an
+        //   array of strings, for 'bsl::basic_inplace_string<char, 64>' and
+        //   'bsl::string'.  Optionally specify the number of copies as the
+        //   second argument (1M by default).
+        //
+        // Testing:
+        //   PERFORMANCE COMPARED WITH 'bsl::string'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE COMPARED WITH 'bsl::string'"
+               "\n=======================================\n");
+
+        typedef bsls::Types::Uint64                   Uint64;
+        typedef bsl::basic_inplace_string<char, 64>   InplaceString;
+
+        enum { k_NUM_SOURCES = 49, k_NUM_TARGETS = 256 };
+
+        const int numCopies = argc > 2 && atoi(argv[2]) > 0
+                            ? atoi(argv[2])
+                            : 1 << 20;
+
+        bslma::TestAllocator ia("inplace", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("string",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&ia);
+
+        const char   *const CHARS = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                    "abcdefghijklmnopqrstuvwxyz";
+
+        InplaceString inplaceSources[k_NUM_SOURCES];
+        bsl::string  *sources = static_cast<bsl::string *>(
+                          sa.allocate(k_NUM_SOURCES * sizeof(bsl::string)));
+        for (int i = 0; i < k_NUM_SOURCES; ++i) {
+            inplaceSources[i].assign(CHARS + i % 8, 16 + i);
+            new (sources + i) bsl::string(CHARS + i % 8, 16 + i, &sa);
+        }
+
+        InplaceString inplaceTargets[k_NUM_TARGETS];
+        bsl::string  *targets = static_cast<bsl::string *>(
+                          sa.allocate(k_NUM_TARGETS * sizeof(bsl::string)));
+        for (int i = 0; i < k_NUM_TARGETS; ++i) {
+            new (targets + i) bsl::string(&sa);
+        }
+
+        const Uint64 inplaceBase = ia.numBlocksTotal();
+        const Uint64 stringBase  = sa.numBlocksTotal();
+
+        bsls::Stopwatch timer;
+        Uint64          inplaceSum = 0;
+        Uint64          sum        = 0;
+
+        // Each round copy-constructs a string and assigns it into the target
+        // array, so both the construction and the assignment of a copy are
+        // measured.
+
+        timer.start();
+        for (int i = 0; i < numCopies; ++i) {
+            const InplaceString copy(inplaceSources[i % k_NUM_SOURCES]);
+            inplaceTargets[i % k_NUM_TARGETS] = copy;
+            inplaceSum += inplaceTargets[i % k_NUM_TARGETS].size();
+        }
+        timer.stop();
+        const double inplaceTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < numCopies; ++i) {
+            const bsl::string copy(sources[i % k_NUM_SOURCES], &sa);
+            targets[i % k_NUM_TARGETS] = copy;
+            sum += targets[i % k_NUM_TARGETS].size();
+        }
+        timer.stop();
+        const double time = timer.elapsedTime();
+
+        ASSERTV(inplaceSum, sum, inplaceSum == sum);
+
+        printf("%d copies\n", numCopies);
+        printf("inplace_string: %8.4fs  %10lld allocations\n",
+               inplaceTime,
+               ia.numBlocksTotal() - inplaceBase);
+        printf("string:         %8.4fs  %10lld allocations\n",
+               time,
+               sa.numBlocksTotal() - stringBase);
+
+        for (int i = 0; i < k_NUM_TARGETS; ++i) {
+            targets[i].~basic_string();
+        }
+        for (int i = 0; i < k_NUM_SOURCES; ++i) {
+            sources[i].~basic_string();
+        }
+        sa.deallocate(targets);
+        sa.deallocate(sources);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,52 @@
+// bslstl_smallvector.cpp                                             -*-C++-*-
+#include <bslstl_smallvector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+
+namespace bsl {
+
+                          // -----------------------
+                          // struct SmallVector_Util
+                          // -----------------------
+
+std::size_t SmallVector_Util::computeNewCapacity(std::size_t newLength,
+                                                 std::size_t capacity,
+                                                 std::size_t maxSize)
+{
+    BSLS_ASSERT_SAFE(newLength > capacity);
+    BSLS_ASSERT_SAFE(newLength <= maxSize);
+
+    capacity += !capacity;
+    while (capacity < newLength) {
+        std::size_t oldCapacity = capacity;
+        capacity *= 2;
+        if (capacity < oldCapacity) {
+            // We overflowed, e.g., on a 32-bit platform; 'newCapacity' is
+            // larger than 2^31.  Terminate the loop.
+
+            return maxSize;                                           // RETURN
+        }
+    }
+    return capacity > maxSize ? maxSize : capacity;
+}
+
+}  // close namespace bsl
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,2016 @@
+// bslstl_smallvector.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#define INCLUDED_BSLSTL_SMALLVECTOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector storing a small number of elements in place.
+//
+//@CLASSES:
+//   bsl::small_vector: vector template with an in-place element buffer
+//
+//@SEE_ALSO: bslstl_vector, bslalg_arrayprimitives
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::small_vector', implementing a contiguous, dynamically sized sequence
+// of elements having an interface similar to that of 'bsl::vector', but
+// additionally holding, within the footprint of the object itself, an
+// uninitialized buffer large enough for 'INPLACE_CAPACITY' elements (the
+// second template parameter).  As long as the number of elements does not
+// exceed 'INPLACE_CAPACITY', no memory is allocated; the elements are spilled
+// to a buffer obtained from the allocator only once the in-place buffer
+// becomes too small, and are moved back into the in-place buffer by
+// 'shrink_to_fit' when they fit again.
+//
+// An instantiation of 'small_vector' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of elements) and the
+// sequence of element values the 'small_vector' contains.  Its capacity, and
+// whether its elements are held in place (see 'is_inplace'), are *not*
+// salient attributes.  If 'small_vector' is instantiated with a value type
+// that is not itself value-semantic, then it will not retain all of its
+// value-semantic qualities.
+//
+// Compared with 'bsl::vector', a 'small_vector':
+//
+//: o Performs no allocation while 'size() <= INPLACE_CAPACITY', and never has
+//:   a capacity lower than 'INPLACE_CAPACITY'.
+//:
+//: o Has a footprint larger by (roughly) 'INPLACE_CAPACITY' elements.
+//:
+//: o Invalidates all iterators, pointers, and references on 'swap', as well
+//:   as whenever the elements are moved between the in-place buffer and an
+//:   allocated buffer.
+//:
+//: o Is *not* bitwise moveable, as it may hold a pointer into itself.
+//
+// Element construction, relocation, and destruction are delegated to
+// 'bslalg::ArrayPrimitives' and 'bslalg::ArrayDestructionPrimitives', so
+// bitwise-moveable and bitwise-copyable element types benefit from the same
+// 'memcpy'-based fast paths as they do in 'bsl::vector'.
+//
+// A 'small_vector' is also recognized as an array type by the 'bdlat'
+// framework (see 'bdlat_arrayfunctions'), so it can be used in place of
+// 'bsl::vector' as the target of the BER, JSON, and XML decoders.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'small_vector's 'ALLOCATOR' template parameter
+// determines how memory will be allocated once the in-place buffer is
+// exhausted.  The 'small_vector' template supports allocators meeting the
+// requirements of the C++03 standard; in addition it supports
+// scoped-allocators derived from the 'bslma::Allocator' memory allocation
+// protocol.  Clients intending to use 'bslma' style allocators should use the
+// template's default 'ALLOCATOR' type: The default type for the 'ALLOCATOR'
+// template parameter, 'bsl::allocator', provides a C++11 standard-compatible
+// adapter for a 'bslma::Allocator' object.
+//
+///Exceptional Behavior
+///--------------------
+// Operations that allocate a new buffer provide the strong exception-safety
+// guarantee: if an exception is thrown, the 'small_vector' is left unchanged.
+// Insertions that do not require a new buffer provide the same guarantee as
+// the corresponding 'bsl::vector' operations (see
+// 'bslalg::ArrayPrimitives::insert').
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Holding a Short, Variable-Length Field
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are decoding market data messages, each of which carries a short
+// list of price levels.  The vast majority of messages carry four levels or
+// fewer, but the format allows an arbitrary number.  Using a 'bsl::vector' to
+// hold the levels would allocate memory for (nearly) every message decoded;
+// a 'small_vector' having an in-place capacity of four avoids that cost in
+// the common case.
+//
+// First, we define the message type:
+//..
+//  struct QuoteMessage {
+//      // This 'struct' describes a quote carrying a variable number of
+//      // price levels.
+//
+//      bsl::small_vector<double, 4> d_levels;  // price levels
+//
+//      explicit QuoteMessage(bslma::Allocator *basicAllocator = 0)
+//      : d_levels(basicAllocator)
+//      {
+//      }
+//  };
+//..
+// Then, we create a test allocator and a message using it:
+//..
+//  bslma::TestAllocator ta("quote", veryVeryVeryVerbose);
+//  QuoteMessage         message(&ta);
+//..
+// Next, we append four price levels, and observe that no memory was
+// allocated:
+//..
+//  message.d_levels.push_back(100.25);
+//  message.d_levels.push_back(100.50);
+//  message.d_levels.push_back(100.75);
+//  message.d_levels.push_back(101.00);
+//
+//  assert(4    == message.d_levels.size());
+//  assert(true == message.d_levels.is_inplace());
+//  assert(0    == ta.numAllocations());
+//..
+// Now, we append a fifth level, which no longer fits in the in-place buffer,
+// so the elements are moved into an allocated buffer:
+//..
+//  message.d_levels.push_back(101.25);
+//
+//  assert(5      == message.d_levels.size());
+//  assert(false  == message.d_levels.is_inplace());
+//  assert(1      == ta.numAllocations());
+//  assert(101.25 == message.d_levels.back());
+//..
+// Finally, we remove the extra level and release the allocated memory, which
+// moves the elements back into the in-place buffer:
+//..
+//  message.d_levels.pop_back();
+//  message.d_levels.shrink_to_fit();
+//
+//  assert(4    == message.d_levels.size());
+//  assert(true == message.d_levels.is_inplace());
+//  assert(0    == ta.numBytesInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYDESTRUCTIONPRIMITIVES
+#include <bslalg_arraydestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_CONTAINERBASE
+#include <bslalg_containerbase.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISINTEGRAL
+#include <bslmf_isintegral.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace bsl {
+
+                          // =======================
+                          // struct SmallVector_Util
+                          // =======================
+
+struct SmallVector_Util {
+    // This 'struct' provides a namespace for the growth policy of
+    // 'small_vector', which does not depend on any of its template
+    // parameters.
+
+    // CLASS METHODS
+    static std::size_t computeNewCapacity(std::size_t newLength,
+                                          std::size_t capacity,
+                                          std::size_t maxSize);
+        // Return a capacity at least the specified 'newLength' and at least
+        // the minimum of twice the specified 'capacity' and the specified
+        // 'maxSize'.  The behavior is undefined unless 'capacity < newLength'
+        // and 'newLength <= maxSize'.  Note that the returned value is always
+        // at most 'maxSize'.
+};
+
+                            // ==================
+                            // class small_vector
+                            // ==================
+
+template <class VALUE_TYPE,
+          std::size_t INPLACE_CAPACITY,
+          class ALLOCATOR = allocator<VALUE_TYPE> >
+class small_vector
+    : private BloombergLP::bslalg::ContainerBase<ALLOCATOR> {
+    // This class template implements a value-semantic container type holding
+    // a contiguous sequence of elements of the (template parameter) type
+    // 'VALUE_TYPE', the first 'INPLACE_CAPACITY' of which are stored within
+    // the footprint of the object, and spilling to memory supplied by the
+    // (template parameter) type 'ALLOCATOR' otherwise.
+
+    BSLMF_ASSERT(0 < INPLACE_CAPACITY);
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::ContainerBase<ALLOCATOR>  ContainerBase;
+    typedef BloombergLP::bslalg::ArrayPrimitives           ArrayPrimitives;
+    typedef BloombergLP::bslalg::ArrayDestructionPrimitives
+                                                    ArrayDestructionPrimitives;
+    typedef BloombergLP::bslalg::ScalarPrimitives          ScalarPrimitives;
+    typedef bsl::allocator_traits<ALLOCATOR>               AllocatorTraits;
+
+    typedef BloombergLP::bsls::AlignedBuffer<
+                  static_cast<int>(sizeof(VALUE_TYPE) * INPLACE_CAPACITY),
+                  BloombergLP::bsls::AlignmentFromType<VALUE_TYPE>::VALUE>
+                                                               InplaceBuffer;
+
+    class Guard {
+        // This class provides a proctor deallocating an allocated (but not
+        // yet adopted) element buffer, unless 'release' is called before the
+        // proctor is destroyed.
+
+        // DATA
+        VALUE_TYPE    *d_data_p;       // guarded buffer
+        std::size_t    d_capacity;     // capacity of the guarded buffer
+        ContainerBase *d_container_p;  // owner of the allocator
+
+      private:
+        // NOT IMPLEMENTED
+        Guard(const Guard&);
+        Guard& operator=(const Guard&);
+
+      public:
+        // CREATORS
+        Guard(VALUE_TYPE    *data,
+              std::size_t    capacity,
+              ContainerBase *container)
+        : d_data_p(data)
+        , d_capacity(capacity)
+        , d_container_p(container)
+        {
+        }
+
+        ~Guard()
+        {
+            if (d_data_p) {
+                d_container_p->deallocateN(d_data_p, d_capacity);
+            }
+        }
+
+        // MANIPULATORS
+        void release()
+        {
+            d_data_p = 0;
+        }
+    };
+
+    class Proctor {
+        // This class provides a proctor releasing the elements and the
+        // allocated buffer (if any) of a 'small_vector' under construction,
+        // unless 'release' is called before the proctor is destroyed.
+
+        // DATA
+        small_vector *d_vector_p;  // guarded object
+
+      private:
+        // NOT IMPLEMENTED
+        Proctor(const Proctor&);
+        Proctor& operator=(const Proctor&);
+
+      public:
+        // CREATORS
+        explicit Proctor(small_vector *vector)
+        : d_vector_p(vector)
+        {
+        }
+
+        ~Proctor()
+        {
+            if (d_vector_p) {
+                d_vector_p->clear();
+                d_vector_p->shrink_to_fit();
+            }
+        }
+
+        // MANIPULATORS
+        void release()
+        {
+            d_vector_p = 0;
+        }
+    };
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE_TYPE                                 value_type;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef VALUE_TYPE&                                reference;
+    typedef const VALUE_TYPE&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef VALUE_TYPE                                *iterator;
+    typedef const VALUE_TYPE                          *const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // DATA
+    VALUE_TYPE    *d_dataBegin_p;    // first element (in place or allocated)
+    VALUE_TYPE    *d_dataEnd_p;      // one past the last element
+    size_type      d_capacity;       // capacity of the current buffer
+    InplaceBuffer  d_inplaceBuffer;  // storage for 'INPLACE_CAPACITY'
+                                     // elements
+
+    // PRIVATE MANIPULATORS
+    VALUE_TYPE *inplaceBuffer();
+        // Return the address of the in-place buffer of this object.
+
+    void adoptBuffer(VALUE_TYPE *data, size_type size, size_type capacity);
+        // Release the current buffer of this object if it was allocated, and
+        // make the specified 'data' buffer, holding the specified 'size'
+        // elements and having the specified 'capacity', the buffer of this
+        // object.  The behavior is undefined unless the elements of the
+        // current buffer have already been destroyed or moved from.
+
+    void privateReallocate(size_type newCapacity);
+        // Move the elements of this object into a newly allocated buffer
+        // having the specified 'newCapacity'.  The behavior is undefined
+        // unless 'size() <= newCapacity' and 'INPLACE_CAPACITY < newCapacity'.
+
+    void privateInsertWithGrowth(iterator          position,
+                                 const VALUE_TYPE& value,
+                                 size_type         numElements);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // before the specified 'position', moving the elements of this object
+        // into a newly allocated buffer.  The behavior is undefined unless
+        // 'capacity() < size() + numElements <= max_size()'.
+
+    template <class INPUT_ITER>
+    void privateAssignDispatch(INPUT_ITER first,
+                               INPUT_ITER last,
+                               bsl::true_type);
+    template <class INPUT_ITER>
+    void privateAssignDispatch(INPUT_ITER first,
+                               INPUT_ITER last,
+                               bsl::false_type);
+        // Assign to this object the values in the range starting at the
+        // specified 'first' and ending immediately before the specified
+        // 'last', dispatching on whether the (template parameter) type
+        // 'INPUT_ITER' is an integral type (in which case 'first' and 'last'
+        // are a count and a value, respectively).
+
+    template <class INPUT_ITER>
+    void privateAssign(INPUT_ITER first,
+                       INPUT_ITER last,
+                       std::input_iterator_tag);
+    template <class FWD_ITER>
+    void privateAssign(FWD_ITER first,
+                       FWD_ITER last,
+                       std::forward_iterator_tag);
+        // Assign to this object the values in the range starting at the
+        // specified 'first' and ending immediately before the specified
+        // 'last'.
+
+    template <class INPUT_ITER>
+    void privateInsertDispatch(const_iterator position,
+                               INPUT_ITER     first,
+                               INPUT_ITER     last,
+                               bsl::true_type);
+    template <class INPUT_ITER>
+    void privateInsertDispatch(const_iterator position,
+                               INPUT_ITER     first,
+                               INPUT_ITER     last,
+                               bsl::false_type);
+        // Insert the values in the range starting at the specified 'first'
+        // and ending immediately before the specified 'last' before the
+        // specified 'position', dispatching on whether the (template
+        // parameter) type 'INPUT_ITER' is an integral type (in which case
+        // 'first' and 'last' are a count and a value, respectively).
+
+    template <class INPUT_ITER>
+    void privateInsert(const_iterator position,
+                       INPUT_ITER     first,
+                       INPUT_ITER     last,
+                       std::input_iterator_tag);
+    template <class FWD_ITER>
+    void privateInsert(const_iterator position,
+                       FWD_ITER       first,
+                       FWD_ITER       last,
+                       std::forward_iterator_tag);
+        // Insert the values in the range starting at the specified 'first'
+        // and ending immediately before the specified 'last' before the
+        // specified 'position'.
+
+    void privateFillConstruct(size_type         numElements,
+                              const VALUE_TYPE& value);
+        // Create the specified 'numElements' copies of the specified 'value'
+        // in this newly created (and empty) object, allocating a buffer of
+        // exactly 'numElements' elements if they do not fit in place.  Throw
+        // 'bsl::length_error' if 'numElements > max_size()'.
+
+    void privateCopyConstruct(const small_vector& original);
+        // Copy the elements of the specified 'original' object into this
+        // newly created (and empty) object, allocating a buffer of exactly
+        // 'original.size()' elements if they do not fit in place.
+
+    void quickSwap(small_vector& other);
+        // Exchange the value of this object with that of the specified
+        // 'other' object.  The behavior is undefined unless this object and
+        // 'other' have equal allocators.
+
+    // PRIVATE ACCESSORS
+    const VALUE_TYPE *inplaceBuffer() const;
+        // Return the address of the in-place buffer of this object.
+
+  public:
+    // CREATORS
+    small_vector();
+    explicit small_vector(const ALLOCATOR& basicAllocator);
+        // Create an empty small vector.  Optionally specify a
+        // 'basicAllocator' used to supply memory once the in-place buffer is
+        // exhausted.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' argument is of type
+        // 'bsl::allocator' (the default), then 'basicAllocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.  If the 'ALLOCATOR'
+        // argument is of type 'bsl::allocator' and 'basicAllocator' is not
+        // supplied, the currently installed default allocator is used.  Note
+        // that no memory is allocated.
+
+    explicit small_vector(size_type        initialSize,
+                          const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a small vector of the specified 'initialSize' whose every
+        // element is a default-constructed object of the (template parameter)
+        // type 'VALUE_TYPE'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  Throw 'bsl::length_error' if
+        // 'initialSize > max_size()'.
+
+    small_vector(size_type         initialSize,
+                 const VALUE_TYPE& value,
+                 const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create a small vector of the specified 'initialSize' whose every
+        // element is a copy of the specified 'value'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  Throw 'bsl::length_error' if
+        // 'initialSize > max_size()'.
+
+    template <class INPUT_ITER>
+    small_vector(INPUT_ITER       first,
+                 INPUT_ITER       last,
+                 const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a small vector holding, in order, the values in the range
+        // starting at the specified 'first' and ending immediately before the
+        // specified 'last'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If 'INPUT_ITER' is an integral type, this
+        // constructor behaves as the '(initialSize, value, basicAllocator)'
+        // constructor.  The behavior is undefined unless '[first .. last)' is
+        // a valid range.
+
+    small_vector(const small_vector& original);
+    small_vector(const small_vector& original,
+                 const ALLOCATOR&    basicAllocator);
+        // Create a small vector having the same value as the specified
+        // 'original' object.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, the allocator
+        // is selected by
+        // 'allocator_traits<ALLOCATOR>::select_on_container_copy_construction'
+        // from the allocator of 'original'.
+
+    ~small_vector();
+        // Destroy this object, releasing any allocated memory.
+
+    // MANIPULATORS
+    small_vector& operator=(const small_vector& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Assign to this object the value of a sequence of the specified
+        // 'numElements' copies of the specified 'value'.  Throw
+        // 'bsl::length_error' if 'numElements > max_size()'.
+
+    template <class INPUT_ITER>
+    void assign(INPUT_ITER first, INPUT_ITER last);
+        // Assign to this object the sequence of values in the range starting
+        // at the specified 'first' and ending immediately before the
+        // specified 'last'.  The behavior is undefined unless
+        // '[first .. last)' is a valid range not referring to elements of
+        // this object.
+
+                             // *** iterators ***
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first element
+        // of this object, or the past-the-end iterator if this object is
+        // empty.
+
+    iterator end();
+        // Return the past-the-end iterator providing modifiable access to
+        // this object.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // element of this object, or 'rend()' if this object is empty.
+
+    reverse_iterator rend();
+        // Return the past-the-end reverse iterator providing modifiable
+        // access to this object.
+
+                            // *** element access ***
+
+    reference operator[](size_type position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position'.  The behavior is undefined unless
+        // 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'position'.  Throw 'bsl::out_of_range' if
+        // 'position >= size()'.
+
+    reference front();
+        // Return a reference providing modifiable access to the first element
+        // of this object.  The behavior is undefined unless this object is
+        // not empty.
+
+    reference back();
+        // Return a reference providing modifiable access to the last element
+        // of this object.  The behavior is undefined unless this object is
+        // not empty.
+
+    VALUE_TYPE *data();
+        // Return the address of the first element of this object, which is
+        // a valid (but possibly not dereferenceable) address even if this
+        // object is empty.
+
+                               // *** capacity ***
+
+    void resize(size_type newSize);
+        // Change the size of this object to the specified 'newSize'.  If
+        // 'newSize < size()', erase the trailing elements; otherwise append
+        // 'newSize - size()' default-constructed elements.  If a new buffer
+        // is needed, its capacity grows geometrically, so that repeatedly
+        // growing by a single element runs in amortized constant time.  Throw
+        // 'bsl::length_error' if 'newSize > max_size()'.
+
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this object to the specified 'newSize'.  If
+        // 'newSize < size()', erase the trailing elements; otherwise append
+        // 'newSize - size()' copies of the specified 'value'.  Throw
+        // 'bsl::length_error' if 'newSize > max_size()'.
+
+    void reserve(size_type newCapacity);
+        // Change the capacity of this object to the specified 'newCapacity'
+        // if it exceeds the current capacity, moving the elements into a
+        // newly allocated buffer.  Throw 'bsl::length_error' if
+        // 'newCapacity > max_size()'.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this object to its size if the elements are
+        // held in an allocated buffer, moving them back into the in-place
+        // buffer if they fit.  Note that the capacity never falls below
+        // 'INPLACE_CAPACITY'.
+
+                              // *** modifiers ***
+
+    void push_back(const VALUE_TYPE& value);
+        // Append a copy of the specified 'value' to this object.  Throw
+        // 'bsl::length_error' if 'size() == max_size()'.
+
+    void pop_back();
+        // Erase the last element of this object.  The behavior is undefined
+        // unless this object is not empty.
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+        // Insert a copy of the specified 'value' before the specified
+        // 'position', and return an iterator to the inserted element.  Throw
+        // 'bsl::length_error' if 'size() == max_size()'.  The behavior is
+        // undefined unless 'position' is in the range '[cbegin() .. cend()]'.
+
+    iterator insert(const_iterator    position,
+                    size_type         numElements,
+                    const VALUE_TYPE& value);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // before the specified 'position', and return an iterator to the
+        // first inserted element (or 'position' if 'numElements' is 0).
+        // Throw 'bsl::length_error' if 'size() + numElements > max_size()'.
+        // The behavior is undefined unless 'position' is in the range
+        // '[cbegin() .. cend()]'.
+
+    template <class INPUT_ITER>
+    iterator insert(const_iterator position,
+                    INPUT_ITER     first,
+                    INPUT_ITER     last);
+        // Insert the values in the range starting at the specified 'first'
+        // and ending immediately before the specified 'last' before the
+        // specified 'position', and return an iterator to the first inserted
+        // element (or 'position' if the range is empty).  The behavior is
+        // undefined unless 'position' is in the range '[cbegin() .. cend()]'
+        // and '[first .. last)' is a valid range not referring to elements of
+        // this object.
+
+    iterator erase(const_iterator position);
+        // Erase the element at the specified 'position', and return an
+        // iterator to the element following it.  The behavior is undefined
+        // unless 'position' is in the range '[cbegin() .. cend())'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Erase the elements in the range starting at the specified 'first'
+        // and ending immediately before the specified 'last', and return an
+        // iterator to the element following the erased range.  The behavior
+        // is undefined unless '[first .. last)' is a valid range of elements
+        // of this object.
+
+    void swap(small_vector& other);
+        // Exchange the value of this object with that of the specified
+        // 'other' object.  If the allocators of the two objects are equal,
+        // this method throws only if the move or swap of an in-place element
+        // throws; otherwise each object receives a copy of the elements of
+        // the other, using its own allocator.  Note that, unlike
+        // 'bsl::vector::swap', this method invalidates all iterators,
+        // pointers, and references to the elements of either object.
+
+    void clear();
+        // Erase all elements of this object, retaining its buffer.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return a copy of the allocator used by this object.
+
+                             // *** iterators ***
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // element of this object, or the past-the-end iterator if this object
+        // is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // this object.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element of this object, or 'rend()' if this object is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to this object.
+
+                            // *** element access ***
+
+    const_reference operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position'.  The behavior is undefined unless
+        // 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'position'.  Throw 'bsl::out_of_range' if
+        // 'position >= size()'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element of this object.  The behavior is undefined unless this
+        // object is not empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element of this object.  The behavior is undefined unless this
+        // object is not empty.
+
+    const VALUE_TYPE *data() const;
+        // Return the address of the first element of this object, which is
+        // a valid (but possibly not dereferenceable) address even if this
+        // object is empty.
+
+                               // *** capacity ***
+
+    size_type size() const;
+        // Return the number of elements in this object.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the number of elements this
+        // object could hold.
+
+    size_type capacity() const;
+        // Return the number of elements this object can hold without
+        // allocating a new buffer.  Note that the returned value is never
+        // less than 'INPLACE_CAPACITY'.
+
+    bool empty() const;
+        // Return 'true' if this object has no elements, and 'false'
+        // otherwise.
+
+    bool is_inplace() const;
+        // Return 'true' if the elements of this object are held in its
+        // in-place buffer (i.e., this object owns no allocated memory), and
+        // 'false' otherwise.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+bool operator==(
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'small_vector' objects have the same
+    // value if they have the same number of elements, and each element of
+    // one compares equal to the corresponding element of the other.
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+bool operator!=(
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+bool operator<(
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs);
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+bool operator>(
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs);
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+bool operator<=(
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs);
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+bool operator>=(
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs);
+    // Return the result of lexicographically comparing the element sequences
+    // of the specified 'lhs' and 'rhs' objects using 'operator<' on
+    // 'VALUE_TYPE'.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void swap(small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& a,
+          small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  See
+    // 'small_vector::swap'.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class small_vector
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::inplaceBuffer()
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_inplaceBuffer.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::adoptBuffer(
+                                                          VALUE_TYPE *data,
+                                                          size_type   size,
+                                                          size_type   capacity)
+{
+    if (!is_inplace()) {
+        this->deallocateN(d_dataBegin_p, d_capacity);
+    }
+    d_dataBegin_p = data;
+    d_dataEnd_p   = data + size;
+    d_capacity    = capacity;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateReallocate(
+                                                         size_type newCapacity)
+{
+    BSLS_ASSERT_SAFE(size() <= newCapacity);
+    BSLS_ASSERT_SAFE(INPLACE_CAPACITY < newCapacity);
+
+    VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *)0, newCapacity);
+    Guard       guard(newData, newCapacity, this);
+
+    const size_type oldSize = size();
+    ArrayPrimitives::destructiveMove(newData,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     this->bslmaAllocator());
+    guard.release();
+    adoptBuffer(newData, oldSize, newCapacity);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateInsertWithGrowth(
+                                                iterator          position,
+                                                const VALUE_TYPE& value,
+                                                size_type         numElements)
+{
+    const size_type newSize     = size() + numElements;
+    const size_type newCapacity = SmallVector_Util::computeNewCapacity(
+                                                                   newSize,
+                                                                   d_capacity,
+                                                                   max_size());
+
+    VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *)0, newCapacity);
+    Guard       guard(newData, newCapacity, this);
+
+    // 'destructiveMoveAndInsert' copies 'value' before moving the elements,
+    // so 'value' may refer to an element of this object.
+
+    ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                              &d_dataEnd_p,
+                                              d_dataBegin_p,
+                                              position,
+                                              d_dataEnd_p,
+                                              value,
+                                              numElements,
+                                              this->bslmaAllocator());
+    guard.release();
+    adoptBuffer(newData, newSize, newCapacity);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateAssignDispatch(
+                                                      INPUT_ITER first,
+                                                      INPUT_ITER last,
+                                                      bsl::true_type)
+{
+    assign(static_cast<size_type>(first), static_cast<VALUE_TYPE>(last));
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateAssignDispatch(
+                                                      INPUT_ITER first,
+                                                      INPUT_ITER last,
+                                                      bsl::false_type)
+{
+    typedef typename bsl::iterator_traits<INPUT_ITER>::iterator_category Tag;
+
+    privateAssign(first, last, Tag());
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateAssign(
+                                                      INPUT_ITER first,
+                                                      INPUT_ITER last,
+                                                      std::input_iterator_tag)
+{
+    clear();
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class FWD_ITER>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateAssign(
+                                                    FWD_ITER first,
+                                                    FWD_ITER last,
+                                                    std::forward_iterator_tag)
+{
+    const size_type numElements = bsl::distance(first, last);
+
+    if (numElements > d_capacity) {
+        small_vector temp(first, last, this->allocator());
+        quickSwap(temp);
+        return;                                                       // RETURN
+    }
+
+    const size_type oldSize = size();
+    if (numElements <= oldSize) {
+        iterator newEnd = std::copy(first, last, d_dataBegin_p);
+        ArrayDestructionPrimitives::destroy(newEnd, d_dataEnd_p);
+        d_dataEnd_p = newEnd;
+    }
+    else {
+        FWD_ITER middle = first;
+        bsl::advance(middle, oldSize);
+        std::copy(first, middle, d_dataBegin_p);
+        ArrayPrimitives::copyConstruct(d_dataEnd_p,
+                                       middle,
+                                       last,
+                                       this->bslmaAllocator());
+        d_dataEnd_p = d_dataBegin_p + numElements;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateInsertDispatch(
+                                                      const_iterator position,
+                                                      INPUT_ITER     first,
+                                                      INPUT_ITER     last,
+                                                      bsl::true_type)
+{
+    insert(position,
+           static_cast<size_type>(first),
+           static_cast<VALUE_TYPE>(last));
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateInsertDispatch(
+                                                      const_iterator position,
+                                                      INPUT_ITER     first,
+                                                      INPUT_ITER     last,
+                                                      bsl::false_type)
+{
+    typedef typename bsl::iterator_traits<INPUT_ITER>::iterator_category Tag;
+
+    privateInsert(position, first, last, Tag());
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateInsert(
+                                                      const_iterator position,
+                                                      INPUT_ITER     first,
+                                                      INPUT_ITER     last,
+                                                      std::input_iterator_tag)
+{
+    size_type index = position - d_dataBegin_p;
+    for (; first != last; ++first, ++index) {
+        insert(d_dataBegin_p + index, *first);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class FWD_ITER>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateInsert(
+                                                    const_iterator position,
+                                                    FWD_ITER       first,
+                                                    FWD_ITER       last,
+                                                    std::forward_iterator_tag)
+{
+    iterator        pos         = const_cast<iterator>(position);
+    const size_type numElements = bsl::distance(first, last);
+
+    if (0 == numElements) {
+        return;                                                       // RETURN
+    }
+
+    if (numElements > max_size() - size()) {
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                "small_vector<...>::insert(pos,first,last): "
+                                "vector too long");
+    }
+
+    const size_type newSize = size() + numElements;
+    if (newSize <= d_capacity) {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                first,
+                                last,
+                                numElements,
+                                this->bslmaAllocator());
+        d_dataEnd_p += numElements;
+        return;                                                       // RETURN
+    }
+
+    const size_type newCapacity = SmallVector_Util::computeNewCapacity(
+                                                                   newSize,
+                                                                   d_capacity,
+                                                                   max_size());
+
+    VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *)0, newCapacity);
+    Guard       guard(newData, newCapacity, this);
+
+    ArrayPrimitives::destructiveMoveAndInsert(newData,
+                                              &d_dataEnd_p,
+                                              d_dataBegin_p,
+                                              pos,
+                                              d_dataEnd_p,
+                                              first,
+                                              last,
+                                              numElements,
+                                              this->bslmaAllocator());
+    guard.release();
+    adoptBuffer(newData, newSize, newCapacity);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateFillConstruct(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(empty());
+    BSLS_ASSERT_SAFE(is_inplace());
+
+    if (numElements <= INPLACE_CAPACITY) {
+        ArrayPrimitives::uninitializedFillN(d_dataBegin_p,
+                                            numElements,
+                                            value,
+                                            this->bslmaAllocator());
+        d_dataEnd_p = d_dataBegin_p + numElements;
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                      "small_vector<...>::small_vector(n,v): vector too long");
+    }
+
+    VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *)0, numElements);
+    Guard       guard(newData, numElements, this);
+
+    ArrayPrimitives::uninitializedFillN(newData,
+                                        numElements,
+                                        value,
+                                        this->bslmaAllocator());
+    guard.release();
+    d_dataBegin_p = newData;
+    d_dataEnd_p   = newData + numElements;
+    d_capacity    = numElements;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::privateCopyConstruct(
+                                                  const small_vector& original)
+{
+    BSLS_ASSERT_SAFE(empty());
+    BSLS_ASSERT_SAFE(is_inplace());
+
+    const size_type numElements = original.size();
+    if (numElements <= INPLACE_CAPACITY) {
+        ArrayPrimitives::copyConstruct(d_dataBegin_p,
+                                       original.d_dataBegin_p,
+                                       original.d_dataEnd_p,
+                                       this->bslmaAllocator());
+        d_dataEnd_p = d_dataBegin_p + numElements;
+        return;                                                       // RETURN
+    }
+
+    VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *)0, numElements);
+    Guard       guard(newData, numElements, this);
+
+    ArrayPrimitives::copyConstruct(newData,
+                                   original.d_dataBegin_p,
+                                   original.d_dataEnd_p,
+                                   this->bslmaAllocator());
+    guard.release();
+    d_dataBegin_p = newData;
+    d_dataEnd_p   = newData + numElements;
+    d_capacity    = numElements;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::quickSwap(
+                                                           small_vector& other)
+{
+    BSLS_ASSERT_SAFE(this->allocator() == other.allocator());
+
+    const bool thisInplace  = is_inplace();
+    const bool otherInplace = other.is_inplace();
+
+    if (!thisInplace && !otherInplace) {
+        std::swap(d_dataBegin_p, other.d_dataBegin_p);
+        std::swap(d_dataEnd_p,   other.d_dataEnd_p);
+        std::swap(d_capacity,    other.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    if (thisInplace != otherInplace) {
+        // Exactly one object holds its elements in place: move those into
+        // the (unused) in-place buffer of the other object, and hand the
+        // allocated buffer over.
+
+        small_vector& inplace   = thisInplace ? *this : other;
+        small_vector& allocated = thisInplace ? other : *this;
+
+        VALUE_TYPE      *heapData     = allocated.d_dataBegin_p;
+        const size_type  heapSize     = allocated.size();
+        const size_type  heapCapacity = allocated.d_capacity;
+        const size_type  inplaceSize  = inplace.size();
+
+        ArrayPrimitives::destructiveMove(allocated.inplaceBuffer(),
+                                         inplace.d_dataBegin_p,
+                                         inplace.d_dataEnd_p,
+                                         this->bslmaAllocator());
+
+        allocated.d_dataBegin_p = allocated.inplaceBuffer();
+        allocated.d_dataEnd_p   = allocated.d_dataBegin_p + inplaceSize;
+        allocated.d_capacity    = INPLACE_CAPACITY;
+
+        inplace.d_dataBegin_p = heapData;
+        inplace.d_dataEnd_p   = heapData + heapSize;
+        inplace.d_capacity    = heapCapacity;
+        return;                                                       // RETURN
+    }
+
+    // Both objects hold their elements in place: swap the common prefix and
+    // move the remaining elements of the longer object.
+
+    small_vector& shorter = size() < other.size() ? *this : other;
+    small_vector& longer  = size() < other.size() ? other : *this;
+
+    const size_type shortSize = shorter.size();
+    for (size_type i = 0; i < shortSize; ++i) {
+        BloombergLP::bslalg::SwapUtil::swap(shorter.d_dataBegin_p + i,
+                                            longer.d_dataBegin_p + i);
+    }
+
+    VALUE_TYPE *tail = longer.d_dataBegin_p + shortSize;
+    ArrayPrimitives::destructiveMove(shorter.d_dataEnd_p,
+                                     tail,
+                                     longer.d_dataEnd_p,
+                                     this->bslmaAllocator());
+    shorter.d_dataEnd_p += longer.d_dataEnd_p - tail;
+    longer.d_dataEnd_p   = tail;
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+const VALUE_TYPE *
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::inplaceBuffer() const
+{
+    return reinterpret_cast<const VALUE_TYPE *>(d_inplaceBuffer.buffer());
+}
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::small_vector()
+: ContainerBase(ALLOCATOR())
+, d_dataBegin_p(inplaceBuffer())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INPLACE_CAPACITY)
+{
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::small_vector(
+                                               const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inplaceBuffer())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INPLACE_CAPACITY)
+{
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::small_vector(
+                                               size_type        initialSize,
+                                               const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inplaceBuffer())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INPLACE_CAPACITY)
+{
+    resize(initialSize);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::small_vector(
+                                              size_type         initialSize,
+                                              const VALUE_TYPE& value,
+                                              const ALLOCATOR&  basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inplaceBuffer())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INPLACE_CAPACITY)
+{
+    privateFillConstruct(initialSize, value);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::small_vector(
+                                               INPUT_ITER       first,
+                                               INPUT_ITER       last,
+                                               const ALLOCATOR& basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inplaceBuffer())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INPLACE_CAPACITY)
+{
+    // Elements inserted one at a time (from input iterators) before an
+    // exception is thrown must be released here, as the destructor will not
+    // run.
+
+    Proctor proctor(this);
+    insert(d_dataEnd_p, first, last);
+    proctor.release();
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::small_vector(
+                                                 const small_vector& original)
+: ContainerBase(AllocatorTraits::select_on_container_copy_construction(
+                                                     original.get_allocator()))
+, d_dataBegin_p(inplaceBuffer())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INPLACE_CAPACITY)
+{
+    privateCopyConstruct(original);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::small_vector(
+                                           const small_vector& original,
+                                           const ALLOCATOR&    basicAllocator)
+: ContainerBase(basicAllocator)
+, d_dataBegin_p(inplaceBuffer())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INPLACE_CAPACITY)
+{
+    privateCopyConstruct(original);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::~small_vector()
+{
+    ArrayDestructionPrimitives::destroy(d_dataBegin_p, d_dataEnd_p);
+    if (!is_inplace()) {
+        this->deallocateN(d_dataBegin_p, d_capacity);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>&
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::operator=(
+                                                       const small_vector& rhs)
+{
+    if (this != &rhs) {
+        privateAssign(rhs.d_dataBegin_p,
+                      rhs.d_dataEnd_p,
+                      std::random_access_iterator_tag());
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::assign(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    if (numElements > d_capacity) {
+        small_vector temp(numElements, value, this->allocator());
+        quickSwap(temp);
+        return;                                                       // RETURN
+    }
+
+    // 'value' may refer to an element of this object, so the trailing
+    // elements are destroyed only once all copies are made.
+
+    const size_type oldSize = size();
+    if (numElements <= oldSize) {
+        iterator newEnd = d_dataBegin_p + numElements;
+        std::fill(d_dataBegin_p, newEnd, value);
+        ArrayDestructionPrimitives::destroy(newEnd, d_dataEnd_p);
+        d_dataEnd_p = newEnd;
+    }
+    else {
+        std::fill(d_dataBegin_p, d_dataEnd_p, value);
+        ArrayPrimitives::uninitializedFillN(d_dataEnd_p,
+                                            numElements - oldSize,
+                                            value,
+                                            this->bslmaAllocator());
+        d_dataEnd_p = d_dataBegin_p + numElements;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::assign(
+                                                              INPUT_ITER first,
+                                                              INPUT_ITER last)
+{
+    privateAssignDispatch(
+               first,
+               last,
+               bsl::integral_constant<bool,
+                                      bsl::is_integral<INPUT_ITER>::value>());
+}
+
+                             // *** iterators ***
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::begin()
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::end()
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(d_dataEnd_p);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::rend()
+{
+    return reverse_iterator(d_dataBegin_p);
+}
+
+                            // *** element access ***
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::operator[](
+                                                            size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                 "small_vector<...>::at(n): invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::data()
+{
+    return d_dataBegin_p;
+}
+
+                               // *** capacity ***
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::resize(
+                                                             size_type newSize)
+{
+    const size_type oldSize = size();
+    if (newSize <= oldSize) {
+        ArrayDestructionPrimitives::destroy(d_dataBegin_p + newSize,
+                                            d_dataEnd_p);
+        d_dataEnd_p = d_dataBegin_p + newSize;
+        return;                                                       // RETURN
+    }
+
+    if (newSize > d_capacity) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newSize > max_size())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                              "small_vector<...>::resize(n): vector too long");
+        }
+        privateReallocate(SmallVector_Util::computeNewCapacity(newSize,
+                                                               d_capacity,
+                                                               max_size()));
+    }
+    ArrayPrimitives::defaultConstruct(d_dataEnd_p,
+                                      newSize - oldSize,
+                                      this->bslmaAllocator());
+    d_dataEnd_p = d_dataBegin_p + newSize;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::resize(
+                                                     size_type         newSize,
+                                                     const VALUE_TYPE& value)
+{
+    const size_type oldSize = size();
+    if (newSize <= oldSize) {
+        ArrayDestructionPrimitives::destroy(d_dataBegin_p + newSize,
+                                            d_dataEnd_p);
+        d_dataEnd_p = d_dataBegin_p + newSize;
+    }
+    else {
+        insert(d_dataEnd_p, newSize - oldSize, value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::reserve(
+                                                         size_type newCapacity)
+{
+    if (newCapacity <= d_capacity) {
+        return;                                                       // RETURN
+    }
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newCapacity > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                             "small_vector<...>::reserve(n): vector too long");
+    }
+    privateReallocate(newCapacity);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::shrink_to_fit()
+{
+    if (is_inplace() || size() == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    const size_type oldSize = size();
+    if (oldSize > INPLACE_CAPACITY) {
+        privateReallocate(oldSize);
+        return;                                                       // RETURN
+    }
+
+    ArrayPrimitives::destructiveMove(inplaceBuffer(),
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     this->bslmaAllocator());
+    adoptBuffer(inplaceBuffer(), oldSize, INPLACE_CAPACITY);
+}
+
+                              // *** modifiers ***
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::push_back(
+                                                       const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        ScalarPrimitives::copyConstruct(d_dataEnd_p,
+                                        value,
+                                        this->bslmaAllocator());
+        ++d_dataEnd_p;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        insert(d_dataEnd_p, value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_dataEnd_p;
+    ArrayDestructionPrimitives::destroy(d_dataEnd_p, d_dataEnd_p + 1);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::insert(
+                                                   const_iterator    position,
+                                                   const VALUE_TYPE& value)
+{
+    return insert(position, 1, value);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::insert(
+                                                 const_iterator    position,
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin_p <= position);
+    BSLS_ASSERT_SAFE(position <= d_dataEnd_p);
+
+    const size_type index = position - d_dataBegin_p;
+    iterator        pos   = d_dataBegin_p + index;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                         numElements > max_size() - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                     "small_vector<...>::insert(pos,n,v): "
+                                     "vector too long");
+    }
+
+    if (size() + numElements <= d_capacity) {
+        ArrayPrimitives::insert(pos,
+                                d_dataEnd_p,
+                                value,
+                                numElements,
+                                this->bslmaAllocator());
+        d_dataEnd_p += numElements;
+    }
+    else {
+        privateInsertWithGrowth(pos, value, numElements);
+    }
+    return d_dataBegin_p + index;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::insert(
+                                                       const_iterator position,
+                                                       INPUT_ITER     first,
+                                                       INPUT_ITER     last)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin_p <= position);
+    BSLS_ASSERT_SAFE(position <= d_dataEnd_p);
+
+    const size_type index = position - d_dataBegin_p;
+    privateInsertDispatch(
+               position,
+               first,
+               last,
+               bsl::integral_constant<bool,
+                                      bsl::is_integral<INPUT_ITER>::value>());
+    return d_dataBegin_p + index;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin_p <= position);
+    BSLS_ASSERT_SAFE(position < d_dataEnd_p);
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin_p <= first);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= d_dataEnd_p);
+
+    iterator        pos         = const_cast<iterator>(first);
+    const size_type numElements = last - first;
+
+    ArrayPrimitives::erase(pos,
+                           const_cast<iterator>(last),
+                           d_dataEnd_p,
+                           this->bslmaAllocator());
+    d_dataEnd_p -= numElements;
+    return pos;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::swap(
+                                                           small_vector& other)
+{
+    if (this->allocator() == other.allocator()) {
+        quickSwap(other);
+    }
+    else {
+        small_vector thisCopy(*this, other.allocator());
+        small_vector otherCopy(other, this->allocator());
+
+        quickSwap(otherCopy);
+        other.quickSwap(thisCopy);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::clear()
+{
+    ArrayDestructionPrimitives::destroy(d_dataBegin_p, d_dataEnd_p);
+    d_dataEnd_p = d_dataBegin_p;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::allocator_type
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::get_allocator() const
+{
+    return this->allocator();
+}
+
+                             // *** iterators ***
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::begin() const
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::cbegin() const
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::end() const
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::cend() const
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(d_dataEnd_p);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(d_dataEnd_p);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(d_dataBegin_p);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(d_dataBegin_p);
+}
+
+                            // *** element access ***
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::operator[](
+                                                      size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::at(
+                                                      size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                           "const small_vector<...>::at(n): invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+const VALUE_TYPE *
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::data() const
+{
+    return d_dataBegin_p;
+}
+
+                               // *** capacity ***
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::size() const
+{
+    return d_dataEnd_p - d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::max_size() const
+{
+    return AllocatorTraits::max_size(this->allocator());
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::empty() const
+{
+    return d_dataBegin_p == d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>::is_inplace() const
+{
+    return d_dataBegin_p == inplaceBuffer();
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator==(
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator<(
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator>(
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& lhs,
+         const bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+inline
+void bsl::swap(bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& a,
+               bsl::small_vector<VALUE_TYPE, INPLACE_CAPACITY, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'small_vector':
+//: o A 'small_vector' defines STL iterators.
+//: o A 'small_vector' uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+//: o A 'small_vector' is *not* bitwise moveable, since it may hold a pointer
+//:     to its own in-place buffer.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+struct HasStlIterators<bsl::small_vector<VALUE_TYPE,
+                                         INPLACE_CAPACITY,
+                                         ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class VALUE_TYPE, std::size_t INPLACE_CAPACITY, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::small_vector<VALUE_TYPE,
+                                            INPLACE_CAPACITY,
+                                            ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
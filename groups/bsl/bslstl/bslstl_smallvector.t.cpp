@@ -0,0 +1,1599 @@
+// bslstl_smallvector.t.cpp                                           -*-C++-*-
+#include <bslstl_smallvector.h>
+
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_mallocfreeallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsltf_stdtestallocator.h>
+#include <bsltf_templatetestfacility.h>
+#include <bsltf_testvaluesarray.h>
+
+#include <stdexcept>    // 'std::out_of_range'
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a value-semantic container,
+// 'bsl::small_vector', that holds up to 'INPLACE_CAPACITY' elements within its
+// own footprint, and spills to memory supplied by its allocator beyond that.
+// The primary manipulators are the default constructor, 'push_back', and
+// 'clear'; the basic accessors are 'begin', 'end', 'size', 'capacity',
+// 'is_inplace', and 'get_allocator'.  Most test cases are instantiated,
+// through 'RUN_EACH_TYPE', for each of the "regular" test types of
+// 'bsltf_templatetestfacility' with an in-place capacity of 4, and verify the
+// value of each object against a 'bsl::vector' of value indices acting as an
+// oracle.  In addition to verifying the value of each object, we verify,
+// with test allocators, that no memory is allocated while the elements fit in
+// place, that all other memory is supplied by the allocator of the object,
+// and that no memory is leaked when an exception is thrown.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] size_t SmallVector_Util::computeNewCapacity(size_t, size_t, ...);
+//
+// CREATORS
+// [ 2] small_vector();
+// [ 2] small_vector(const A& allocator);
+// [ 5] small_vector(size_type initialSize, const A& allocator);
+// [ 5] small_vector(size_type, const VALUE_TYPE& value, const A& allocator);
+// [ 5] small_vector(ITER first, ITER last, const A& allocator);
+// [ 4] small_vector(const small_vector& original);
+// [ 4] small_vector(const small_vector& original, const A& allocator);
+// [ 2] ~small_vector();
+//
+// MANIPULATORS
+// [ 4] small_vector& operator=(const small_vector& rhs);
+// [ 5] void assign(size_type numElements, const VALUE_TYPE& value);
+// [ 5] void assign(ITER first, ITER last);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 6] reverse_iterator rbegin();
+// [ 6] reverse_iterator rend();
+// [ 6] reference operator[](size_type position);
+// [ 6] reference at(size_type position);
+// [ 6] reference front();
+// [ 6] reference back();
+// [ 6] VALUE_TYPE *data();
+// [ 5] void resize(size_type newSize);
+// [ 5] void resize(size_type newSize, const VALUE_TYPE& value);
+// [ 6] void reserve(size_type newCapacity);
+// [ 6] void shrink_to_fit();
+// [ 2] void push_back(const VALUE_TYPE& value);
+// [ 3] void pop_back();
+// [ 3] iterator insert(const_iterator position, const VALUE_TYPE& value);
+// [ 3] iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+// [ 3] iterator insert(const_iterator position, ITER first, ITER last);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 4] void swap(small_vector& other);
+// [ 2] void clear();
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 6] const_reverse_iterator rbegin() const;
+// [ 6] const_reverse_iterator rend() const;
+// [ 6] const_reference operator[](size_type position) const;
+// [ 6] const_reference at(size_type position) const;
+// [ 6] const_reference front() const;
+// [ 6] const_reference back() const;
+// [ 6] const VALUE_TYPE *data() const;
+// [ 2] size_type size() const;
+// [ 6] size_type max_size() const;
+// [ 2] size_type capacity() const;
+// [ 2] bool empty() const;
+// [ 2] bool is_inplace() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const small_vector& lhs, const small_vector& rhs);
+// [ 4] bool operator!=(const small_vector& lhs, const small_vector& rhs);
+// [ 6] bool operator<(const small_vector& lhs, const small_vector& rhs);
+// [ 6] bool operator>(const small_vector& lhs, const small_vector& rhs);
+// [ 6] bool operator<=(const small_vector& lhs, const small_vector& rhs);
+// [ 6] bool operator>=(const small_vector& lhs, const small_vector& rhs);
+// [ 4] void swap(small_vector& a, small_vector& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] TYPE TRAITS
+// [ 6] ALIASING
+// [ 6] STANDARD-COMPLIANT ALLOCATOR
+// [ 7] EXCEPTION SAFETY
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE COMPARED WITH 'bsl::vector'
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+#define RUN_EACH_TYPE BSLTF_TEMPLATETESTFACILITY_RUN_EACH_TYPE
+
+typedef bsltf::TemplateTestFacility TTF;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+                              // ================
+                              // class TestDriver
+                              // ================
+
+template <class TYPE>
+class TestDriver {
+    // This class template provides a namespace for testing
+    // 'bsl::small_vector' instantiated with the (template parameter) type
+    // 'TYPE' and an in-place capacity of 4.
+
+    // PRIVATE TYPES
+    enum { k_INPLACE = 4 };
+
+    typedef bsl::small_vector<TYPE, k_INPLACE> Obj;
+    typedef typename Obj::iterator             Iter;
+    typedef bsltf::TestValuesArray<TYPE>       TestValues;
+    typedef bsl::vector<int>                   Indices;
+
+    // PRIVATE CLASS METHODS
+    static bool isValue(const Obj&        object,
+                        const Indices&    expected,
+                        const TestValues& values);
+        // Return 'true' if the specified 'object' holds, in order, the
+        // elements of the specified 'values' at the specified 'expected'
+        // indices, and 'false' otherwise.
+
+    static void append(Obj *object, int first, int count);
+        // Append to the specified 'object' the elements of the test values
+        // array having the 'count' consecutive indices starting at the
+        // specified 'first'.
+
+  public:
+    // TEST CASES
+    static void testCase2();
+        // Test default constructor, primary manipulators, and basic
+        // accessors.
+
+    static void testCase3();
+        // Test 'insert', 'erase', and 'pop_back'.
+
+    static void testCase4();
+        // Test copy constructors, copy-assignment, equality, and 'swap'.
+
+    static void testCase5();
+        // Test value constructors, 'assign', and 'resize'.
+};
+
+                              // ----------------
+                              // class TestDriver
+                              // ----------------
+
+template <class TYPE>
+bool TestDriver<TYPE>::isValue(const Obj&        object,
+                               const Indices&    expected,
+                               const TestValues& values)
+{
+    if (object.size() != expected.size()) {
+        return false;                                                 // RETURN
+    }
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (!(values[expected[i]] == object[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::append(Obj *object, int first, int count)
+{
+    static TestValues VALUES;
+
+    for (int i = first; i < first + count; ++i) {
+        object->push_back(VALUES[i]);
+    }
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase2()
+{
+    // ------------------------------------------------------------------------
+    // DEFAULT CTOR, PRIMARY MANIPULATORS, AND BASIC ACCESSORS
+    //
+    // Concerns:
+    //: 1 A default-constructed object is empty, holds its (absent) elements
+    //:   in place, has a capacity of 'INPLACE_CAPACITY', and allocates no
+    //:   memory.
+    //:
+    //: 2 'push_back' appends the value supplied, and does not allocate a
+    //:   buffer until the size exceeds 'INPLACE_CAPACITY'; from then on, the
+    //:   capacity grows geometrically.
+    //:
+    //: 3 'clear' erases all elements but retains the buffer.
+    //:
+    //: 4 The allocator supplied at construction (or the default allocator) is
+    //:   used for all memory, and the destructor releases all memory.
+    //
+    // Plan:
+    //: 1 For each size in '[0 .. 12]', create an object with and without an
+    //:   allocator, append that many values with 'push_back', and verify the
+    //:   value, capacity, and 'is_inplace' after each append, and the use of
+    //:   the allocators.  Clear the object, and verify that it is empty and
+    //:   its capacity unchanged.  (C-1..4)
+    //
+    // Testing:
+    //   small_vector();
+    //   small_vector(const A& allocator);
+    //   ~small_vector();
+    //   void push_back(const VALUE_TYPE& value);
+    //   void clear();
+    //   allocator_type get_allocator() const;
+    //   iterator begin();
+    //   iterator end();
+    //   const_iterator begin() const;
+    //   const_iterator end() const;
+    //   size_type size() const;
+    //   size_type capacity() const;
+    //   bool empty() const;
+    //   bool is_inplace() const;
+    // ------------------------------------------------------------------------
+
+    const TestValues VALUES;
+
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    for (int n = 0; n <= 12; ++n) {
+        for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+            bslma::TestAllocator da("default", veryVeryVeryVerbose);
+            bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            bslma::TestAllocator& xa = 'a' == cfg ? da : oa;
+
+            Obj *objPtr = 'a' == cfg ? new (oa) Obj() : new (oa) Obj(&oa);
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            // The object itself is allocated from 'oa'.
+
+            const bsls::Types::Int64 BASE = oa.numBlocksTotal();
+
+            ASSERTV(n, cfg, &xa == X.get_allocator().mechanism());
+            ASSERTV(n, cfg, X.empty());
+            ASSERTV(n, cfg, X.is_inplace());
+            ASSERTV(n, cfg, k_INPLACE == X.capacity());
+            ASSERTV(n, cfg, X.begin() == X.end());
+
+            Indices exp(&sa);
+            for (int i = 0; i < n; ++i) {
+                mX.push_back(VALUES[i]);
+                exp.push_back(i);
+
+                ASSERTV(n, cfg, i, isValue(X, exp, VALUES));
+                ASSERTV(n, cfg, i, X.size() <= X.capacity());
+                ASSERTV(n, cfg, i, (i < k_INPLACE) == X.is_inplace());
+                ASSERTV(n, cfg, i, X.end() - X.begin() == i + 1);
+                ASSERTV(n, cfg, i, !X.empty());
+
+                if (i < k_INPLACE) {
+                    ASSERTV(n, cfg, i, k_INPLACE == X.capacity());
+                    if (!bslma::UsesBslmaAllocator<TYPE>::value) {
+                        ASSERTV(n, cfg, i, BASE == oa.numBlocksTotal());
+                        ASSERTV(n, cfg, i, 0    == da.numBlocksTotal());
+                    }
+                }
+                else {
+                    // Each power of 2 starting at twice the in-place
+                    // capacity is reached only once.
+
+                    size_t cap = 2 * k_INPLACE;
+                    while (cap <= static_cast<size_t>(i)) {
+                        cap *= 2;
+                    }
+                    ASSERTV(n, cfg, i, X.capacity(), cap == X.capacity());
+                }
+            }
+
+            const size_t CAPACITY = X.capacity();
+
+            mX.clear();
+            ASSERTV(n, cfg, X.empty());
+            ASSERTV(n, cfg, CAPACITY == X.capacity());
+            ASSERTV(n, cfg, (n <= k_INPLACE) == X.is_inplace());
+
+            if (n > k_INPLACE) {
+                ASSERTV(n, cfg, 0 < xa.numBlocksInUse());
+            }
+
+            oa.deleteObject(objPtr);
+
+            ASSERTV(n, cfg, 0 == da.numBlocksInUse());
+            ASSERTV(n, cfg, 0 == oa.numBlocksInUse());
+        }
+    }
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // 'insert', 'erase', AND 'pop_back'
+    //
+    // Concerns:
+    //: 1 Each 'insert' overload inserts the supplied values before the
+    //:   supplied position, whether or not the result fits in place, and
+    //:   returns an iterator to the first inserted element.
+    //:
+    //: 2 The range 'insert' accepts both forward and input iterators.
+    //:
+    //: 3 'erase' removes the supplied elements, and returns an iterator to
+    //:   the element following them.
+    //:
+    //: 4 'pop_back' removes the last element.
+    //:
+    //: 5 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For each initial size in '[0 .. 6]', each position, and each count
+    //:   in '[0 .. 5]', insert that many values with each overload, and
+    //:   verify the result against the same insertion into a 'bsl::vector'
+    //:   of value indices.  (C-1..2)
+    //:
+    //: 2 For each initial size in '[0 .. 8]' and each valid range, erase the
+    //:   range, and verify the result against the oracle; then 'pop_back'
+    //:   all remaining elements.  (C-3..4)
+    //:
+    //: 3 Verify that all memory is released.  (C-5)
+    //
+    // Testing:
+    //   void pop_back();
+    //   iterator insert(const_iterator position, const VALUE_TYPE& value);
+    //   iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+    //   iterator insert(const_iterator position, ITER first, ITER last);
+    //   iterator erase(const_iterator position);
+    //   iterator erase(const_iterator first, const_iterator last);
+    // ------------------------------------------------------------------------
+
+    TestValues VALUES;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    enum { k_INSERTED = 40 };  // index of the first inserted value
+
+    for (int size = 0; size <= 6; ++size) {
+        for (int pos = 0; pos <= size; ++pos) {
+            for (int count = 0; count <= 5; ++count) {
+                Indices init;
+                for (int i = 0; i < size; ++i) {
+                    init.push_back(i);
+                }
+
+                for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+                    Obj mX(&oa);  const Obj& X = mX;
+                    append(&mX, 0, size);
+
+                    Indices exp(init);
+                    Iter    result;
+
+                    switch (cfg) {
+                      case 'a': {
+                        // Single value, 'count' times.
+
+                        for (int i = 0; i < count; ++i) {
+                            result = mX.insert(X.begin() + pos + i,
+                                               VALUES[k_INSERTED + i]);
+                            ASSERTV(size, pos, count, i,
+                                    X.begin() + pos + i == result);
+                        }
+                        for (int i = 0; i < count; ++i) {
+                            exp.insert(exp.begin() + pos + i, k_INSERTED + i);
+                        }
+                        result = mX.begin() + pos;
+                      } break;
+                      case 'b': {
+                        result = mX.insert(X.begin() + pos,
+                                           count,
+                                           VALUES[k_INSERTED]);
+                        exp.insert(exp.begin() + pos, count, k_INSERTED);
+                      } break;
+                      case 'c': {
+                        result = mX.insert(X.begin() + pos,
+                                           VALUES.data() + k_INSERTED,
+                                           VALUES.data() + k_INSERTED
+                                                                     + count);
+                        for (int i = 0; i < count; ++i) {
+                            exp.insert(exp.begin() + pos + i, k_INSERTED + i);
+                        }
+                      } break;
+                      case 'd': {
+                        VALUES.resetIterators();
+                        result = mX.insert(X.begin() + pos,
+                                           VALUES.index(k_INSERTED),
+                                           VALUES.index(k_INSERTED + count));
+                        for (int i = 0; i < count; ++i) {
+                            exp.insert(exp.begin() + pos + i, k_INSERTED + i);
+                        }
+                      } break;
+                    }
+
+                    ASSERTV(size, pos, count, cfg, isValue(X, exp, VALUES));
+                    ASSERTV(size, pos, count, cfg, X.begin() + pos == result);
+                    ASSERTV(size, pos, count, cfg,
+                            (size + count <= k_INPLACE) == X.is_inplace());
+                }
+            }
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+    for (int size = 0; size <= 8; ++size) {
+        for (int first = 0; first <= size; ++first) {
+            for (int last = first; last <= size; ++last) {
+                Obj mX(&oa);  const Obj& X = mX;
+                append(&mX, 0, size);
+
+                Indices exp;
+                for (int i = 0; i < size; ++i) {
+                    exp.push_back(i);
+                }
+
+                Iter result;
+                if (last == first + 1) {
+                    result = mX.erase(X.begin() + first);
+                }
+                else {
+                    result = mX.erase(X.begin() + first, X.begin() + last);
+                }
+                exp.erase(exp.begin() + first, exp.begin() + last);
+
+                ASSERTV(size, first, last, isValue(X, exp, VALUES));
+                ASSERTV(size, first, last, X.begin() + first == result);
+
+                while (!X.empty()) {
+                    mX.pop_back();
+                    exp.pop_back();
+                    ASSERTV(size, first, last, isValue(X, exp, VALUES));
+                }
+            }
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // COPY CONSTRUCTORS, COPY-ASSIGNMENT, EQUALITY, AND 'swap'
+    //
+    // Concerns:
+    //: 1 A copy has the value of the original, whether either is held in
+    //:   place or not, and uses the allocator supplied (or, by default, the
+    //:   default allocator, as 'bsl::allocator' propagates no allocator on
+    //:   copy construction).
+    //:
+    //: 2 Two objects compare equal if and only if they have the same value,
+    //:   regardless of their capacities and allocators.
+    //:
+    //: 3 Assignment gives the target the value of the source, for every
+    //:   combination of sizes in and beyond the in-place capacity, retains
+    //:   the allocator of the target, and supports self-assignment.
+    //:
+    //: 4 'swap' (member and free) exchanges the values of two objects for
+    //:   every combination of sizes in and beyond the in-place capacity, with
+    //:   equal or unequal allocators, and each object retains its allocator.
+    //:
+    //: 5 'swap' of objects having equal allocators allocates no memory.
+    //:
+    //: 6 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For each pair of sizes in a set including 0, the in-place capacity,
+    //:   and sizes beyond it, create objects of those sizes holding distinct
+    //:   values, and verify copy construction, equality, assignment, and
+    //:   'swap', using test allocators to verify the allocator of each object
+    //:   and that no memory is allocated by 'swap' with equal allocators.
+    //:   (C-1..6)
+    //
+    // Testing:
+    //   small_vector(const small_vector& original);
+    //   small_vector(const small_vector& original, const A& allocator);
+    //   small_vector& operator=(const small_vector& rhs);
+    //   void swap(small_vector& other);
+    //   bool operator==(const small_vector& lhs, const small_vector& rhs);
+    //   bool operator!=(const small_vector& lhs, const small_vector& rhs);
+    //   void swap(small_vector& a, small_vector& b);
+    // ------------------------------------------------------------------------
+
+    const TestValues VALUES;
+
+    const int SIZES[]   = { 0, 1, 3, 4, 5, 9 };
+    const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int XSIZE = SIZES[ti];
+
+        Indices xExp;
+        for (int i = 0; i < XSIZE; ++i) {
+            xExp.push_back(i);
+        }
+
+        Obj mX(&oa);  const Obj& X = mX;
+        append(&mX, 0, XSIZE);
+
+        {
+            const Obj Y(X);
+            ASSERTV(XSIZE, isValue(Y, xExp, VALUES));
+            ASSERTV(XSIZE, &da == Y.get_allocator().mechanism());
+            ASSERTV(XSIZE, X == Y);
+            ASSERTV(XSIZE, !(X != Y));
+
+            const Obj Z(X, &za);
+            ASSERTV(XSIZE, isValue(Z, xExp, VALUES));
+            ASSERTV(XSIZE, &za == Z.get_allocator().mechanism());
+            ASSERTV(XSIZE, X == Z);
+            ASSERTV(XSIZE, (XSIZE <= k_INPLACE) == Z.is_inplace());
+        }
+
+        for (int tj = 0; tj < NUM_SIZES; ++tj) {
+            const int YSIZE = SIZES[tj];
+
+            Indices yExp;
+            for (int i = 0; i < YSIZE; ++i) {
+                yExp.push_back(20 + i);
+            }
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            append(&mY, 20, YSIZE);
+
+            ASSERTV(XSIZE, YSIZE, (0 == XSIZE && 0 == YSIZE) == (X == Y));
+            ASSERTV(XSIZE, YSIZE, (0 == XSIZE && 0 == YSIZE) != (X != Y));
+
+            // assignment
+
+            {
+                Obj mZ(Y, &za);  const Obj& Z = mZ;
+
+                Obj *mR = &(mZ = X);
+                ASSERTV(XSIZE, YSIZE, mR == &mZ);
+                ASSERTV(XSIZE, YSIZE, isValue(Z, xExp, VALUES));
+                ASSERTV(XSIZE, YSIZE, &za == Z.get_allocator().mechanism());
+
+                mR = &(mZ = Z);
+                ASSERTV(XSIZE, YSIZE, mR == &mZ);
+                ASSERTV(XSIZE, YSIZE, isValue(Z, xExp, VALUES));
+            }
+
+            // 'swap' with equal allocators
+
+            {
+                Obj mA(X, &oa);  const Obj& A = mA;
+                Obj mB(Y, &oa);  const Obj& B = mB;
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mA.swap(mB);
+
+                ASSERTV(XSIZE, YSIZE, isValue(A, yExp, VALUES));
+                ASSERTV(XSIZE, YSIZE, isValue(B, xExp, VALUES));
+                ASSERTV(XSIZE, YSIZE, bslma::UsesBslmaAllocator<TYPE>::value
+                                   || oam.isTotalSame());
+
+                swap(mA, mB);
+
+                ASSERTV(XSIZE, YSIZE, isValue(A, xExp, VALUES));
+                ASSERTV(XSIZE, YSIZE, isValue(B, yExp, VALUES));
+                ASSERTV(XSIZE, YSIZE, (XSIZE <= k_INPLACE) == A.is_inplace());
+                ASSERTV(XSIZE, YSIZE, (YSIZE <= k_INPLACE) == B.is_inplace());
+            }
+
+            // 'swap' with unequal allocators
+
+            {
+                Obj mA(X, &oa);  const Obj& A = mA;
+                Obj mB(Y, &za);  const Obj& B = mB;
+
+                mA.swap(mB);
+
+                ASSERTV(XSIZE, YSIZE, isValue(A, yExp, VALUES));
+                ASSERTV(XSIZE, YSIZE, isValue(B, xExp, VALUES));
+                ASSERTV(XSIZE, YSIZE, &oa == A.get_allocator().mechanism());
+                ASSERTV(XSIZE, YSIZE, &za == B.get_allocator().mechanism());
+            }
+            ASSERTV(XSIZE, YSIZE, 0 == za.numBlocksInUse());
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+}
+
+template <class TYPE>
+void TestDriver<TYPE>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // VALUE CONSTRUCTORS, 'assign', AND 'resize'
+    //
+    // Concerns:
+    //: 1 The size, size-and-value, and range constructors create an object
+    //:   having the expected value, held in place if and only if it fits.
+    //:
+    //: 2 The range constructor and 'assign' accept forward and input
+    //:   iterators, and treat a pair of integral arguments as a count and a
+    //:   value.
+    //:
+    //: 3 'assign' replaces the value of the object, for every combination of
+    //:   sizes, and retains the capacity if the new value fits.
+    //:
+    //: 4 'resize' grows or shrinks the object, appending copies of the value
+    //:   supplied (or default-constructed values), and growing the capacity
+    //:   geometrically when growing one element at a time.
+    //
+    // Plan:
+    //: 1 For each size in '[0 .. 10]', create objects with each constructor,
+    //:   and verify their values.  (C-1..2)
+    //:
+    //: 2 For each pair of sizes in '[0 .. 10]', assign to an object of the
+    //:   first size a value of the second size with each 'assign' overload,
+    //:   and verify the result.  (C-2..3)
+    //:
+    //: 3 For each pair of sizes in '[0 .. 10]', resize an object of the first
+    //:   size to the second, and verify the result; grow an object one
+    //:   element at a time with 'resize', and verify that the number of
+    //:   allocations is logarithmic.  (C-4)
+    //
+    // Testing:
+    //   small_vector(size_type initialSize, const A& allocator);
+    //   small_vector(size_type, const VALUE_TYPE& value, const A& allocator);
+    //   small_vector(ITER first, ITER last, const A& allocator);
+    //   void assign(size_type numElements, const VALUE_TYPE& value);
+    //   void assign(ITER first, ITER last);
+    //   void resize(size_type newSize);
+    //   void resize(size_type newSize, const VALUE_TYPE& value);
+    // ------------------------------------------------------------------------
+
+    TestValues VALUES;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    const TYPE DFLT = TYPE();
+
+    for (int n = 0; n <= 10; ++n) {
+        Indices exp;
+        for (int i = 0; i < n; ++i) {
+            exp.push_back(i);
+        }
+        const Indices FILL(n, 7);
+
+        {
+            const Obj X(n, &oa);
+            ASSERTV(n, X.size() == static_cast<size_t>(n));
+            ASSERTV(n, (n <= k_INPLACE) == X.is_inplace());
+            for (int i = 0; i < n; ++i) {
+                ASSERTV(n, i, DFLT == X[i]);
+            }
+
+            const Obj Y(n, VALUES[7], &oa);
+            ASSERTV(n, isValue(Y, FILL, VALUES));
+
+            const Obj Z(VALUES.data(), VALUES.data() + n, &oa);
+            ASSERTV(n, isValue(Z, exp, VALUES));
+            ASSERTV(n, (n <= k_INPLACE) == Z.is_inplace());
+
+            VALUES.resetIterators();
+            const Obj W(VALUES.begin(), VALUES.index(n), &oa);
+            ASSERTV(n, isValue(W, exp, VALUES));
+        }
+
+        for (int m = 0; m <= 10; ++m) {
+            for (char cfg = 'a'; cfg <= 'c'; ++cfg) {
+                Obj mX(&oa);  const Obj& X = mX;
+                append(&mX, 20, m);
+
+                const size_t CAPACITY = X.capacity();
+
+                switch (cfg) {
+                  case 'a': {
+                    mX.assign(n, VALUES[7]);
+                    ASSERTV(n, m, isValue(X, FILL, VALUES));
+                  } break;
+                  case 'b': {
+                    mX.assign(VALUES.data(), VALUES.data() + n);
+                    ASSERTV(n, m, isValue(X, exp, VALUES));
+                  } break;
+                  case 'c': {
+                    VALUES.resetIterators();
+                    mX.assign(VALUES.begin(), VALUES.index(n));
+                    ASSERTV(n, m, isValue(X, exp, VALUES));
+                  } break;
+                }
+                if (static_cast<size_t>(n) <= CAPACITY) {
+                    ASSERTV(n, m, cfg, CAPACITY == X.capacity());
+                }
+            }
+
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                append(&mX, 0, m);
+
+                mX.resize(n);
+                ASSERTV(n, m, X.size() == static_cast<size_t>(n));
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, m, i, i < m ? VALUES[i] == X[i]
+                                           : DFLT      == X[i]);
+                }
+
+                Obj mY(&oa);  const Obj& Y = mY;
+                append(&mY, 0, m);
+
+                mY.resize(n, VALUES[7]);
+                ASSERTV(n, m, Y.size() == static_cast<size_t>(n));
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, m, i, VALUES[i < m ? i : 7] == Y[i]);
+                }
+            }
+        }
+    }
+
+    {
+        const int INTS[] = { 3, 7 };
+
+        const bsl::small_vector<int, 4> X(INTS[0], INTS[1]);
+        ASSERTV(X.size(), 3 == X.size());
+        ASSERTV(X[2], 7 == X[2]);
+
+        bsl::small_vector<int, 4> mY(INTS, INTS + 2);
+        mY.assign(5, 1);
+        ASSERTV(mY.size(), 5 == mY.size());
+        ASSERTV(mY[4], 1 == mY[4]);
+    }
+
+    {
+        Obj mX(&oa);  const Obj& X = mX;
+
+        const bsls::Types::Int64 BASE = oa.numBlocksTotal();
+
+        for (int i = 1; i <= 1024; ++i) {
+            mX.resize(i);
+        }
+        ASSERTV(X.size(), 1024 == X.size());
+
+        // With geometric growth starting from the in-place capacity, 8
+        // buffers are allocated to reach 1024 elements (plus allocations by
+        // the elements themselves, if any).
+
+        if (!bslma::UsesBslmaAllocator<TYPE>::value) {
+            ASSERTV(oa.numBlocksTotal(), BASE + 8 == oa.numBlocksTotal());
+        }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Holding a Short, Variable-Length Field
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are decoding market data messages, each of which carries a short
+// list of price levels.  The vast majority of messages carry four levels or
+// fewer, but the format allows an arbitrary number.  Using a 'bsl::vector' to
+// hold the levels would allocate memory for (nearly) every message decoded;
+// a 'small_vector' having an in-place capacity of four avoids that cost in
+// the common case.
+//
+// First, we define the message type:
+//..
+  struct QuoteMessage {
+      // This 'struct' describes a quote carrying a variable number of
+      // price levels.
+
+      bsl::small_vector<double, 4> d_levels;  // price levels
+
+      explicit QuoteMessage(bslma::Allocator *basicAllocator = 0)
+      : d_levels(basicAllocator)
+      {
+      }
+  };
+//..
+// Then, we create a test allocator and a message using it:
+//..
+  bslma::TestAllocator ta("quote", veryVeryVeryVerbose);
+  QuoteMessage         message(&ta);
+//..
+// Next, we append four price levels, and observe that no memory was
+// allocated:
+//..
+  message.d_levels.push_back(100.25);
+  message.d_levels.push_back(100.50);
+  message.d_levels.push_back(100.75);
+  message.d_levels.push_back(101.00);
+
+  ASSERT(4    == message.d_levels.size());
+  ASSERT(true == message.d_levels.is_inplace());
+  ASSERT(0    == ta.numAllocations());
+//..
+// Now, we append a fifth level, which no longer fits in the in-place buffer,
+// so the elements are moved into an allocated buffer:
+//..
+  message.d_levels.push_back(101.25);
+
+  ASSERT(5      == message.d_levels.size());
+  ASSERT(false  == message.d_levels.is_inplace());
+  ASSERT(1      == ta.numAllocations());
+  ASSERT(101.25 == message.d_levels.back());
+//..
+// Finally, we remove the extra level and release the allocated memory, which
+// moves the elements back into the in-place buffer:
+//..
+  message.d_levels.pop_back();
+  message.d_levels.shrink_to_fit();
+
+  ASSERT(4    == message.d_levels.size());
+  ASSERT(true == message.d_levels.is_inplace());
+  ASSERT(0    == ta.numBytesInUse());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an allocation fails while the elements spill from the in-place
+        //:   buffer, or while the object grows, the object is left unchanged,
+        //:   and no memory is leaked.
+        //:
+        //: 2 If an allocation fails during the range constructor (from forward
+        //:   or input iterators) or the copy constructor, no memory is
+        //:   leaked.
+        //:
+        //: 3 If an allocation fails during 'swap' of objects having unequal
+        //:   allocators, both objects are left unchanged.
+        //
+        // Plan:
+        //: 1 Using 'bsl::string' elements long enough to allocate memory,
+        //:   perform each operation in the exception-test loop of
+        //:   'bslma::TestAllocator', and verify the state of the objects on
+        //:   each exception, and that no memory is leaked.  (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+        typedef bsl::small_vector<bsl::string, 4> Obj;
+
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> strings(&sa);
+        for (char c = 'A'; c <= 'L'; ++c) {
+            strings.push_back(bsl::string(40, c, &sa));
+        }
+
+        if (verbose) printf("\tTesting 'push_back' and 'insert'.\n");
+        {
+            for (int n = 0; n <= 9; ++n) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj mX(strings.begin(), strings.begin() + n, &oa);
+                    const Obj& X = mX;
+
+                    try {
+                        mX.push_back(strings[11]);
+                        mX.insert(X.begin(), strings.begin(), strings.end());
+                    }
+                    catch (...) {
+                        const size_t SIZE = X.size();
+                        ASSERTV(n, SIZE, SIZE == static_cast<size_t>(n)
+                                      || SIZE == static_cast<size_t>(n)
+                                                                         + 1);
+                        for (int i = 0; i < n; ++i) {
+                            ASSERTV(n, i, strings[i] == X[i]);
+                        }
+                        throw;
+                    }
+                    ASSERTV(n, X.size(), n + 13 == static_cast<int>(X.size()));
+                    ASSERTV(n, strings[11] == X.back());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting range and copy constructors.\n");
+        {
+            typedef bsl::small_vector<bsltf::AllocTestType, 4> AllocObj;
+
+            bsltf::TestValuesArray<bsltf::AllocTestType> values(&sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj X(strings.begin(), strings.end(), &oa);
+                ASSERTV(X.size(), 12 == X.size());
+
+                const Obj Y(X, &oa);
+                ASSERTV(X == Y);
+
+                values.resetIterators();
+                const AllocObj Z(values.begin(), values.index(10), &oa);
+                ASSERTV(Z.size(), 10 == Z.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting 'swap' with unequal allocators.\n");
+        {
+            const Obj X(strings.begin(), strings.begin() + 3, &sa);
+            const Obj Y(strings.begin() + 3, strings.end(), &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mA(X, &za);  const Obj& A = mA;
+                Obj mB(&oa);     const Obj& B = mB;
+                mB = Y;
+
+                try {
+                    mA.swap(mB);
+                }
+                catch (...) {
+                    ASSERT(X == A);
+                    ASSERT(Y == B);
+                    throw;
+                }
+                ASSERT(Y == A);
+                ASSERT(X == B);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+#endif
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS, CAPACITY, RELATIONAL OPERATORS, AND TRAITS
+        //
+        // Concerns:
+        //: 1 The element accessors and reverse iterators refer to the expected
+        //:   elements, and 'at' throws 'std::out_of_range' for an invalid
+        //:   position.
+        //:
+        //: 2 'reserve' moves the elements into an allocated buffer only if the
+        //:   capacity requested exceeds the current capacity.
+        //:
+        //: 3 'shrink_to_fit' moves the elements back in place if they fit,
+        //:   reduces the capacity of an allocated buffer to the size
+        //:   otherwise, and releases all unused memory.
+        //:
+        //: 4 The relational operators compare objects lexicographically.
+        //:
+        //: 5 Inserting or appending an element of the object itself works,
+        //:   including when the object grows.
+        //:
+        //: 6 'small_vector' has the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits, and is not bitwise moveable.
+        //:
+        //: 7 'small_vector' can be instantiated with a standard-compliant
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 Exercise each accessor and the capacity manipulators on objects
+        //:   held in place and not, and verify the results, and the use of a
+        //:   test allocator.  (C-1..3)
+        //:
+        //: 2 Compare objects of different values with each relational
+        //:   operator.  (C-4)
+        //:
+        //: 3 Append and insert elements of the object itself at and beyond the
+        //:   in-place capacity.  (C-5)
+        //:
+        //: 4 Verify the traits.  (C-6)
+        //:
+        //: 5 Instantiate 'small_vector' with 'bsltf::StdTestAllocator', and
+        //:   exercise growth and 'swap'.  (C-7)
+        //
+        // Testing:
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   reference operator[](size_type position);
+        //   reference at(size_type position);
+        //   reference front();
+        //   reference back();
+        //   VALUE_TYPE *data();
+        //   void reserve(size_type newCapacity);
+        //   void shrink_to_fit();
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reference operator[](size_type position) const;
+        //   const_reference at(size_type position) const;
+        //   const_reference front() const;
+        //   const_reference back() const;
+        //   const VALUE_TYPE *data() const;
+        //   size_type max_size() const;
+        //   bool operator<(const small_vector& lhs, const small_vector& rhs);
+        //   bool operator>(const small_vector& lhs, const small_vector& rhs);
+        //   bool operator<=(const small_vector& lhs, const small_vector& rhs);
+        //   bool operator>=(const small_vector& lhs, const small_vector& rhs);
+        //   TYPE TRAITS
+        //   ALIASING
+        //   STANDARD-COMPLIANT ALLOCATOR
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                 "\nELEMENT ACCESS, CAPACITY, RELATIONAL OPERATORS, AND TRAITS"
+                 "\n=========================================================="
+                  "\n");
+
+        typedef bsl::small_vector<int, 4> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting element access.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 6; ++i) {
+                mX.push_back(i * 10);
+
+                ASSERTV(i, 0      == mX.front());
+                ASSERTV(i, 0      == X.front());
+                ASSERTV(i, i * 10 == mX.back());
+                ASSERTV(i, i * 10 == X.back());
+                ASSERTV(i, i * 10 == mX[i]);
+                ASSERTV(i, i * 10 == X.at(i));
+                ASSERTV(i, &mX[0] == mX.data());
+                ASSERTV(i, &X[0]  == X.data());
+                ASSERTV(i, X.end() - 1 == &*X.rbegin());
+                ASSERTV(i, X.begin() == &*(X.rend() - 1));
+                ASSERTV(i, mX.end() - 1 == &*mX.rbegin());
+                ASSERTV(i, mX.begin() == &*(mX.rend() - 1));
+                ASSERTV(i, X.cbegin() == X.begin());
+                ASSERTV(i, X.cend() == X.end());
+                ASSERTV(i, X.crbegin() == X.rbegin());
+                ASSERTV(i, X.crend() == X.rend());
+
+                mX.at(i) = i * 10;
+            }
+            ASSERT(0 < X.max_size());
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                X.at(6);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                mX.at(6);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting 'reserve' and 'shrink_to_fit'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.push_back(1);
+            mX.push_back(2);
+
+            mX.reserve(3);
+            ASSERT(X.is_inplace());
+            ASSERT(4 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.shrink_to_fit();
+            ASSERT(X.is_inplace());
+            ASSERT(4 == X.capacity());
+
+            mX.reserve(10);
+            ASSERT(!X.is_inplace());
+            ASSERT(10 == X.capacity());
+            ASSERT(1  == oa.numBlocksInUse());
+            ASSERT(1 == X[0] && 2 == X[1] && 2 == X.size());
+
+            for (int i = 3; i <= 6; ++i) {
+                mX.push_back(i);
+            }
+            mX.shrink_to_fit();
+            ASSERT(!X.is_inplace());
+            ASSERT(6 == X.capacity());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.pop_back();
+            mX.pop_back();
+            mX.shrink_to_fit();
+            ASSERT(X.is_inplace());
+            ASSERT(4 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, i + 1 == X[i]);
+            }
+        }
+
+        if (verbose) printf("\tTesting relational operators.\n");
+        {
+            const int DATA[]   = { 1, 2, 3, 4, 5, 6 };
+            const int LESSER[] = { 1, 2, 3, 4, 5, 5, 9 };
+
+            const Obj X(DATA, DATA + 6, &oa);
+            const Obj Y(LESSER, LESSER + 7, &oa);
+            const Obj Z(DATA, DATA + 3, &oa);
+
+            ASSERT(Y < X);  ASSERT(!(X < Y));
+            ASSERT(X > Y);  ASSERT(!(Y > X));
+            ASSERT(Y <= X); ASSERT(X <= X);  ASSERT(!(X <= Y));
+            ASSERT(X >= Y); ASSERT(X >= X);  ASSERT(!(Y >= X));
+            ASSERT(Z < X);  ASSERT(Z < Y);
+        }
+
+        if (verbose) printf("\tTesting aliasing.\n");
+        {
+            bslma::TestAllocator sa("string", veryVeryVeryVerbose);
+
+            typedef bsl::small_vector<bsl::string, 2> StrObj;
+
+            StrObj mX(&sa);  const StrObj& X = mX;
+            mX.push_back(bsl::string(30, 'a'));
+            mX.push_back(bsl::string(30, 'b'));
+
+            mX.push_back(X[0]);
+            ASSERT(3 == X.size());
+            ASSERT(X[0] == X[2]);
+
+            mX.insert(X.begin(), 3, X[1]);
+            ASSERT(6 == X.size());
+            ASSERT(bsl::string(30, 'b') == X[0]);
+            ASSERT(bsl::string(30, 'b') == X[2]);
+            ASSERT(bsl::string(30, 'a') == X[3]);
+
+            mX.assign(2, X[5]);
+            ASSERT(2 == X.size());
+            ASSERT(bsl::string(30, 'a') == X[1]);
+
+            mX.resize(9, X[0]);
+            ASSERT(9 == X.size());
+            ASSERT(bsl::string(30, 'a') == X[8]);
+        }
+
+        if (verbose) printf("\tTesting traits.\n");
+        {
+            ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+            ASSERT((bslalg::HasStlIterators<Obj>::value));
+            ASSERT(!(bslmf::IsBitwiseMoveable<Obj>::value));
+
+            typedef bsl::small_vector<int, 4, bsltf::StdTestAllocator<int> >
+                                                                        StdObj;
+            ASSERT(!(bslma::UsesBslmaAllocator<StdObj>::value));
+        }
+
+        if (verbose) printf("\tTesting standard-compliant allocator.\n");
+        {
+            typedef bsl::small_vector<int, 4, bsltf::StdTestAllocator<int> >
+                                                                        StdObj;
+
+            bsltf::StdTestAllocatorConfigurationGuard sag(&oa);
+
+            StdObj mX;  const StdObj& X = mX;
+            StdObj mY;  const StdObj& Y = mY;
+            for (int i = 0; i < 7; ++i) {
+                mX.push_back(i);
+            }
+            mY.push_back(42);
+            ASSERT(!X.is_inplace());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.swap(mY);
+            ASSERT(1 == X.size() && 42 == X[0]);
+            ASSERT(7 == Y.size() && 6  == Y[6]);
+            ASSERT(X.is_inplace());
+            ASSERT(!Y.is_inplace());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // VALUE CONSTRUCTORS, 'assign', AND 'resize'
+        //
+        // Testing:
+        //   small_vector(size_type initialSize, const A& allocator);
+        //   small_vector(size_type, const VALUE_TYPE& value, const A& alloc);
+        //   small_vector(ITER first, ITER last, const A& allocator);
+        //   void assign(size_type numElements, const VALUE_TYPE& value);
+        //   void assign(ITER first, ITER last);
+        //   void resize(size_type newSize);
+        //   void resize(size_type newSize, const VALUE_TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nVALUE CONSTRUCTORS, 'assign', AND 'resize'"
+                            "\n==========================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase5,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTORS, COPY-ASSIGNMENT, EQUALITY, AND 'swap'
+        //
+        // Testing:
+        //   small_vector(const small_vector& original);
+        //   small_vector(const small_vector& original, const A& allocator);
+        //   small_vector& operator=(const small_vector& rhs);
+        //   void swap(small_vector& other);
+        //   bool operator==(const small_vector& lhs, const small_vector& rhs);
+        //   bool operator!=(const small_vector& lhs, const small_vector& rhs);
+        //   void swap(small_vector& a, small_vector& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nCOPY CONSTRUCTORS, COPY-ASSIGNMENT, EQUALITY, AND"
+                          " 'swap'"
+                          "\n================================================="
+                          "======\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase4,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'insert', 'erase', AND 'pop_back'
+        //
+        // Testing:
+        //   void pop_back();
+        //   iterator insert(const_iterator position, const VALUE_TYPE& value);
+        //   iterator insert(const_iterator, size_type, const VALUE_TYPE&);
+        //   iterator insert(const_iterator position, ITER first, ITER last);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'insert', 'erase', AND 'pop_back'"
+                            "\n=================================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase3,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // DEFAULT CTOR, PRIMARY MANIPULATORS, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 See 'TestDriver::testCase2'.
+        //:
+        //: 2 'SmallVector_Util::computeNewCapacity' doubles the capacity until
+        //:   it reaches the requested length, and never exceeds the maximum.
+        //
+        // Plan:
+        //: 1 Run 'TestDriver::testCase2' for each regular test type.  (C-1)
+        //:
+        //: 2 Using a table of capacities, lengths, and maximums, verify the
+        //:   result of 'computeNewCapacity'.  (C-2)
+        //
+        // Testing:
+        //   size_t SmallVector_Util::computeNewCapacity(size_t, size_t, ...);
+        //   small_vector();
+        //   small_vector(const A& allocator);
+        //   ~small_vector();
+        //   void push_back(const VALUE_TYPE& value);
+        //   void clear();
+        //   allocator_type get_allocator() const;
+        //   iterator begin();
+        //   iterator end();
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   size_type size() const;
+        //   size_type capacity() const;
+        //   bool empty() const;
+        //   bool is_inplace() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                    "\nDEFAULT CTOR, PRIMARY MANIPULATORS, AND BASIC ACCESSORS"
+                    "\n======================================================="
+                     "\n");
+
+        {
+            static const struct {
+                int         d_line;      // source line number
+                size_t d_length;    // requested length
+                size_t d_capacity;  // current capacity
+                size_t d_max;       // maximum capacity
+                size_t d_exp;       // expected result
+            } DATA[] = {
+                //LINE  LENGTH  CAPACITY  MAX    EXP
+                //----  ------  --------  -----  -----
+                { L_,        1,        0,   100,     1 },
+                { L_,        5,        4,   100,     8 },
+                { L_,        9,        4,   100,    16 },
+                { L_,       17,       16,   100,    32 },
+                { L_,       17,       16,    20,    20 },
+                { L_,      100,       64,   100,   100 },
+                { L_,       33,        1,  1000,    64 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const size_t LENGTH   = DATA[ti].d_length;
+                const size_t CAPACITY = DATA[ti].d_capacity;
+                const size_t MAX      = DATA[ti].d_max;
+                const size_t EXP      = DATA[ti].d_exp;
+
+                const size_t RESULT =
+                    bsl::SmallVector_Util::computeNewCapacity(LENGTH,
+                                                              CAPACITY,
+                                                              MAX);
+                ASSERTV(LINE, RESULT, EXP == RESULT);
+            }
+        }
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase2,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a small vector, grow it past its in-place capacity, erase
+        //:   and insert elements, and copy and compare it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bsl::small_vector<int, 3> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(X.is_inplace());
+
+        mX.push_back(1);
+        mX.push_back(2);
+        mX.push_back(3);
+        ASSERT(3 == X.size());
+        ASSERT(X.is_inplace());
+        ASSERT(0 == oa.numBlocksTotal());
+
+        mX.push_back(4);
+        ASSERT(4 == X.size());
+        ASSERT(!X.is_inplace());
+        ASSERT(1 == oa.numBlocksInUse());
+        ASSERT(4 == X.back());
+
+        mX.erase(X.begin());
+        ASSERT(2 == X.front());
+        mX.insert(X.begin() + 1, 9);
+        ASSERT(9 == X[1]);
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.pop_back();
+        ASSERT(X != Y);
+        ASSERT(X >  Y);
+
+        mY.shrink_to_fit();
+        ASSERT(Y.is_inplace());
+
+        mY = X;
+        ASSERT(X == Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE COMPARED WITH 'bsl::vector'
+        //   Compare the time taken, and the number of allocations made, to
+        //   create, fill with 'push_back', and destroy many short sequences of
+        //   'int' (of lengths cycling through '[0 .. 8]'), for
+        //   'bsl::small_vector<int, 8>' and 'bsl::vector'.  Optionally
+        //   specify the number of sequences as the second argument (1M by
+        //   default).
+        //
+        // Testing:
+        //   PERFORMANCE COMPARED WITH 'bsl::vector'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE COMPARED WITH 'bsl::vector'"
+               "\n=======================================\n");
+
+        typedef bsls::Types::Uint64         Uint64;
+        typedef bsl::small_vector<int, 8>   SmallVector;
+        typedef bsl::vector<int>            Vector;
+
+        const int numSequences = argc > 2 && atoi(argv[2]) > 0
+                               ? atoi(argv[2])
+                               : 1 << 20;
+
+        bslma::TestAllocator sva("small_vector", veryVeryVeryVerbose);
+        bslma::TestAllocator va("vector",        veryVeryVeryVerbose);
+
+        bsls::Stopwatch timer;
+        Uint64          smallSum = 0;
+        Uint64          sum      = 0;
+
+        timer.start();
+        for (int i = 0; i < numSequences; ++i) {
+            SmallVector mX(&sva);
+            for (int j = 0; j < i % 9; ++j) {
+                mX.push_back(j);
+            }
+            smallSum += mX.size();
+        }
+        timer.stop();
+        const double smallTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < numSequences; ++i) {
+            Vector mX(&va);
+            for (int j = 0; j < i % 9; ++j) {
+                mX.push_back(j);
+            }
+            sum += mX.size();
+        }
+        timer.stop();
+        const double time = timer.elapsedTime();
+
+        ASSERTV(smallSum, sum, smallSum == sum);
+
+        printf("%d sequences\n", numSequences);
+        printf("small_vector: %8.4fs  %10lld allocations\n",
+               smallTime,
+               sva.numBlocksTotal());
+        printf("vector:       %8.4fs  %10lld allocations\n",
+               time,
+               va.numBlocksTotal());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,122 @@
+// bslstl_sortedrangetag.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SORTEDRANGETAG
+#define INCLUDED_BSLSTL_SORTEDRANGETAG
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide tag types indicating that a range of values is sorted.
+//
+//@CLASSES:
+//  bsl::sorted_unique_t: tag indicating a sorted range of unique values
+//  bsl::sorted_equivalent_t: tag indicating a sorted range of values
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatmap, bslstl_flatmultimap
+//
+//@DESCRIPTION: This component defines two empty classes,
+// 'bsl::sorted_unique_t' and 'bsl::sorted_equivalent_t', used as tags that
+// precede a pair of iterators in the argument list of a constructor or an
+// 'insert' method of a sorted "flat" container (e.g., 'bsl::flat_map') to
+// indicate that the range of values designated by the iterators is already
+// sorted according to the ordering of the container, so that the container
+// need not sort it.  'bsl::sorted_unique_t' additionally indicates that no two
+// values in the range are equivalent (i.e., that the range is *strictly*
+// sorted), and is used with containers of unique keys;
+// 'bsl::sorted_equivalent_t' is used with containers that allow equivalent
+// keys.
+//
+// In addition to the tag types, this component defines two constants,
+// 'bsl::sorted_unique' and 'bsl::sorted_equivalent', of the respective tag
+// types.  These constants are used for passing the tags to a function or
+// constructor.  Note that these names are those of the tags defined by the
+// C++23 standard for the same purpose.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Building a Table from Sorted Data
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a function that builds a lookup table from a range of keys.
+// If the keys are known to be sorted, the table can be built in linear time;
+// otherwise, it must sort them first.  First, we use the tag type to select
+// between two overloads of the function:
+//..
+//  bool buildTable(const int *, const int *)
+//      // Build a table from the keys in the specified range, sorting them
+//      // first, and return 'true' to indicate that the keys were sorted.
+//  {
+//      return true;
+//  }
+//
+//  bool buildTable(bsl::sorted_unique_t, const int *, const int *)
+//      // Build a table from the keys in the specified range, which must be
+//      // strictly sorted, without sorting them, and return 'false' to
+//      // indicate that the keys were not sorted.
+//  {
+//      return false;
+//  }
+//..
+// Then, we call the function with and without the tag:
+//..
+//  const int KEYS[] = { 1, 2, 3, 5, 8 };
+//
+//  assert(true  == buildTable(KEYS, KEYS + 5));
+//  assert(false == buildTable(bsl::sorted_unique, KEYS, KEYS + 5));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+namespace bsl {
+
+                          // ======================
+                          // struct sorted_unique_t
+                          // ======================
+
+struct sorted_unique_t {
+    // Tag type indicating that the next two arguments designate a range of
+    // values that are sorted, without any two values being equivalent,
+    // according to the ordering of the container.
+};
+
+static const sorted_unique_t sorted_unique = { };
+    // Value of type 'sorted_unique_t' used as actual argument to a function
+    // that takes a strictly sorted range of values.
+
+                        // ==========================
+                        // struct sorted_equivalent_t
+                        // ==========================
+
+struct sorted_equivalent_t {
+    // Tag type indicating that the next two arguments designate a range of
+    // values that are sorted, possibly with equivalent values, according to
+    // the ordering of the container.
+};
+
+static const sorted_equivalent_t sorted_equivalent = { };
+    // Value of type 'sorted_equivalent_t' used as actual argument to a
+    // function that takes a sorted range of values.
+
+}  // close namespace bsl
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,233 @@
+// bslstl_sortedrangetag.t.cpp                                        -*-C++-*-
+#include <bslstl_sortedrangetag.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// This component consists of two empty tag types and a constant object of
+// each type.  There is no functionality to test.  Instead, we test that the
+// tags can be used for their intended purpose, which is to disambiguate
+// function calls.
+//-----------------------------------------------------------------------------
+// [ 1] struct bsl::sorted_unique_t
+// [ 1] struct bsl::sorted_equivalent_t
+// [ 1] static const bsl::sorted_unique_t bsl::sorted_unique
+// [ 1] static const bsl::sorted_equivalent_t bsl::sorted_equivalent
+// ----------------------------------------------------------------------------
+// [ 2] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+int overloaded(const int *)
+    // Return 0.
+{
+    return 0;
+}
+
+int overloaded(bsl::sorted_unique_t, const int *)
+    // Return 1.
+{
+    return 1;
+}
+
+int overloaded(bsl::sorted_equivalent_t, const int *)
+    // Return 2.
+{
+    return 2;
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Building a Table from Sorted Data
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a function that builds a lookup table from a range of keys.
+// If the keys are known to be sorted, the table can be built in linear time;
+// otherwise, it must sort them first.  First, we use the tag type to select
+// between two overloads of the function:
+//..
+    bool buildTable(const int *, const int *)
+        // Build a table from the keys in the specified range, sorting them
+        // first, and return 'true' to indicate that the keys were sorted.
+    {
+        return true;
+    }
+
+    bool buildTable(bsl::sorted_unique_t, const int *, const int *)
+        // Build a table from the keys in the specified range, which must be
+        // strictly sorted, without sorting them, and return 'false' to
+        // indicate that the keys were not sorted.
+    {
+        return false;
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    (void)veryVerbose;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we call the function with and without the tag:
+//..
+    const int KEYS[] = { 1, 2, 3, 5, 8 };
+
+    ASSERT(true  == buildTable(KEYS, KEYS + 5));
+    ASSERT(false == buildTable(bsl::sorted_unique, KEYS, KEYS + 5));
+//..
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TAG TYPES
+        //
+        // Concerns:
+        //: 1 The tag constants are of the tag types, and are usable to select
+        //:   an overload of a function.
+        //:
+        //: 2 The two tag types are distinct from each other, and neither is
+        //:   implicitly convertible from a pointer or from the other.
+        //:
+        //: 3 The tag types are empty.
+        //
+        // Plan:
+        //: 1 Call a function overloaded on the tag types with each constant,
+        //:   with default-constructed tags, and without a tag, and verify the
+        //:   overload selected.  (C-1..2)
+        //:
+        //: 2 Verify that the size of each tag type is 1.  (C-3)
+        //
+        // Testing:
+        //   struct bsl::sorted_unique_t
+        //   struct bsl::sorted_equivalent_t
+        //   static const bsl::sorted_unique_t bsl::sorted_unique
+        //   static const bsl::sorted_equivalent_t bsl::sorted_equivalent
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTAG TYPES"
+                            "\n=========\n");
+
+        const int *const NULL_P = 0;
+
+        ASSERT(0 == overloaded(NULL_P));
+        ASSERT(1 == overloaded(bsl::sorted_unique, NULL_P));
+        ASSERT(2 == overloaded(bsl::sorted_equivalent, NULL_P));
+        ASSERT(1 == overloaded(bsl::sorted_unique_t(), NULL_P));
+        ASSERT(2 == overloaded(bsl::sorted_equivalent_t(), NULL_P));
+
+        const bsl::sorted_unique_t&     u = bsl::sorted_unique;
+        const bsl::sorted_equivalent_t& e = bsl::sorted_equivalent;
+        (void)u;
+        (void)e;
+
+        ASSERT(1 == sizeof(bsl::sorted_unique_t));
+        ASSERT(1 == sizeof(bsl::sorted_equivalent_t));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
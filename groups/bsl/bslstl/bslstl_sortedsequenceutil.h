@@ -0,0 +1,474 @@
+// bslstl_sortedsequenceutil.h                                        -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SORTEDSEQUENCEUTIL
+#define INCLUDED_BSLSTL_SORTEDSEQUENCEUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide algorithms to maintain a sorted sequence in a vector.
+//
+//@CLASSES:
+//  bslstl::SortedSequenceUtil: namespace for sorted-sequence algorithms
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatmap, bslstl_flatmultimap
+//
+//@DESCRIPTION: This component provides a namespace, 'SortedSequenceUtil', for
+// algorithms that maintain a sequence of values, held in a vector-like
+// container, sorted according to a comparator.  These algorithms are the
+// building blocks of the sorted "flat" containers (e.g., 'bsl::flat_map'),
+// which store their elements contiguously in a 'bsl::vector' rather than in
+// the nodes of a tree.
+//
+// The central operation, 'sortSuffix', is used to add a range of values to a
+// sorted sequence in bulk: the values are first appended to the vector (in
+// any order), then 'sortSuffix' sorts the appended values and merges them
+// with the values that were already in the vector.  This takes
+// 'O[m * log(m) + n + m]' time for 'm' appended values and 'n' existing
+// values, compared to 'O[m * (n + m)]' for inserting the values one at a time
+// in their sorted positions.  If the appended values are already sorted, they
+// are not sorted again, and if they all follow the existing values, no merge
+// is done, so appending a sorted range of 'm' values that follow the existing
+// values takes 'O[m]' time.  'sortSuffixUnique' additionally removes all but
+// one of each set of equivalent values, for containers of unique keys.
+//
+// The type of the vector is a template parameter, 'VECTOR', which must
+// provide the interface of 'bsl::vector' (random-access 'iterator', 'begin',
+// 'end', 'size', 'erase', 'get_allocator', and a range constructor taking an
+// allocator).  Any temporary storage needed to merge the values is allocated
+// from (a copy of) the allocator of the vector.
+//
+///Exception Safety
+///----------------
+// If an exception is thrown by the comparator, or by the copy constructor or
+// copy-assignment operator of the values, while the appended values are being
+// sorted, the appended values are removed, and the vector holds only the
+// values that it held before they were appended.  If an exception is thrown
+// while the values are being merged, or while equivalent values are being
+// removed, the vector is left empty.  In either case the vector is left
+// sorted, so that a container using it remains in a valid state (the basic
+// exception-safety guarantee).
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Adding Values to a Sorted Vector in Bulk
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a sorted vector of integers, and we receive a batch of
+// new values, in no particular order, to add to it.
+//
+// First, we create the sorted vector:
+//..
+//  bsl::vector<int> values;
+//  values.push_back(10);
+//  values.push_back(20);
+//  values.push_back(30);
+//..
+// Then, we append the new values to the vector, noting the number of values
+// that were in the vector before:
+//..
+//  const bsl::vector<int>::size_type numOldValues = values.size();
+//
+//  values.push_back(25);
+//  values.push_back(5);
+//  values.push_back(20);
+//..
+// Next, we sort the new values and merge them with the old ones, removing
+// duplicates:
+//..
+//  bslstl::SortedSequenceUtil::sortSuffixUnique(&values,
+//                                               numOldValues,
+//                                               std::less<int>());
+//..
+// Finally, we observe that the vector is sorted, and that the duplicate value
+// has been removed:
+//..
+//  assert(5 == values.size());
+//  assert( 5 == values[0]);
+//  assert(10 == values[1]);
+//  assert(20 == values[2]);
+//  assert(25 == values[3]);
+//  assert(30 == values[4]);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                         // =========================
+                         // struct SortedSequenceUtil
+                         // =========================
+
+struct SortedSequenceUtil {
+    // This 'struct' provides a namespace for algorithms that maintain a
+    // sequence of values, held in a vector, sorted according to a comparator.
+    // Each comparator is a binary functor providing a strict weak ordering on
+    // the values, and 'a' and 'b' are said to be "equivalent" if neither
+    // 'comparator(a, b)' nor 'comparator(b, a)' is 'true'.
+
+    // CLASS METHODS
+    template <class FORWARD_ITERATOR, class COMPARATOR>
+    static bool isSorted(FORWARD_ITERATOR  first,
+                         FORWARD_ITERATOR  last,
+                         const COMPARATOR& comparator);
+        // Return 'true' if no value in the specified range '[first .. last)'
+        // is ordered before its predecessor by the specified 'comparator', and
+        // 'false' otherwise.
+
+    template <class FORWARD_ITERATOR, class COMPARATOR>
+    static bool isStrictlySorted(FORWARD_ITERATOR  first,
+                                 FORWARD_ITERATOR  last,
+                                 const COMPARATOR& comparator);
+        // Return 'true' if each value in the specified range '[first .. last)'
+        // is ordered after its predecessor by the specified 'comparator'
+        // (i.e., if the range is sorted and no two values in it are
+        // equivalent), and 'false' otherwise.
+
+    template <class VECTOR, class COMPARATOR>
+    static typename VECTOR::size_type sortSuffix(
+                                  VECTOR                     *sequence,
+                                  typename VECTOR::size_type  position,
+                                  const COMPARATOR&           comparator);
+        // Sort the values of the specified 'sequence' at and after the
+        // specified 'position' according to the specified 'comparator', and
+        // merge them with the values before 'position', such that the whole of
+        // 'sequence' is sorted, and each value that was before 'position'
+        // precedes the values from after 'position' that are equivalent to it.
+        // Return the index of the first value of 'sequence' that may have been
+        // changed by this operation; the values before that index are
+        // unchanged.  Equivalent values that were after 'position' keep their
+        // relative order (i.e., the sort is stable).  The behavior is
+        // undefined unless the values before 'position' are sorted according
+        // to 'comparator', and 'position <= sequence->size()'.  See
+        // {Exception Safety} for the state of 'sequence' if an exception is
+        // thrown.
+
+    template <class VECTOR, class COMPARATOR>
+    static void sortSuffixUnique(VECTOR                     *sequence,
+                                 typename VECTOR::size_type  position,
+                                 const COMPARATOR&           comparator);
+        // Sort the values of the specified 'sequence' at and after the
+        // specified 'position' according to the specified 'comparator', merge
+        // them with the values before 'position', such that the whole of
+        // 'sequence' is sorted, and remove all but the first of each set of
+        // equivalent values.  A value that was before 'position' is never
+        // removed; of a set of equivalent values from after 'position', the
+        // first is retained unless an equivalent value was before 'position'.
+        // The behavior is undefined unless the values before 'position' are
+        // strictly sorted according to 'comparator' (see 'isStrictlySorted'),
+        // and 'position <= sequence->size()'.  See {Exception Safety} for the
+        // state of 'sequence' if an exception is thrown.
+};
+
+                    // ======================================
+                    // class SortedSequenceUtil_EquivalentPred
+                    // ======================================
+
+template <class COMPARATOR>
+class SortedSequenceUtil_EquivalentPred {
+    // This component-private class provides a binary predicate that, for two
+    // adjacent values of a sorted sequence, returns 'true' if they are
+    // equivalent according to the comparator supplied at construction.
+
+    // DATA
+    const COMPARATOR& d_comparator;  // comparator ordering the sequence
+
+  public:
+    // CREATORS
+    explicit SortedSequenceUtil_EquivalentPred(const COMPARATOR& comparator);
+        // Create a predicate using the specified 'comparator'.
+
+    // ACCESSORS
+    template <class VALUE>
+    bool operator()(const VALUE& first, const VALUE& second) const;
+        // Return 'true' if the specified 'first' value is equivalent to the
+        // specified 'second' value, and 'false' otherwise.  The behavior is
+        // undefined unless 'second' is not ordered before 'first'.
+};
+
+                     // =================================
+                     // class SortedSequenceUtil_Proctor
+                     // =================================
+
+template <class VECTOR>
+class SortedSequenceUtil_Proctor {
+    // This component-private class implements a proctor that, unless its
+    // 'release' method has been called, truncates a vector to a specified
+    // length on destruction.
+
+    // DATA
+    VECTOR                     *d_sequence_p;  // proctored vector, or 0
+    typename VECTOR::size_type  d_length;      // length on failure
+
+  private:
+    // NOT IMPLEMENTED
+    SortedSequenceUtil_Proctor(const SortedSequenceUtil_Proctor&);
+    SortedSequenceUtil_Proctor& operator=(const SortedSequenceUtil_Proctor&);
+
+  public:
+    // CREATORS
+    SortedSequenceUtil_Proctor(VECTOR                     *sequence,
+                               typename VECTOR::size_type  length);
+        // Create a proctor that truncates the specified 'sequence' to the
+        // specified 'length' on destruction, unless 'release' is called.
+
+    ~SortedSequenceUtil_Proctor();
+        // Destroy this proctor, truncating the proctored vector (if any) to
+        // the length supplied at construction (or by 'setLength').
+
+    // MANIPULATORS
+    void release();
+        // Release the proctored vector from management by this proctor.
+
+    void setLength(typename VECTOR::size_type length);
+        // Set the length to which the proctored vector is truncated on
+        // destruction to the specified 'length'.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                    // --------------------------------------
+                    // class SortedSequenceUtil_EquivalentPred
+                    // --------------------------------------
+
+// CREATORS
+template <class COMPARATOR>
+inline
+SortedSequenceUtil_EquivalentPred<COMPARATOR>::
+SortedSequenceUtil_EquivalentPred(const COMPARATOR& comparator)
+: d_comparator(comparator)
+{
+}
+
+// ACCESSORS
+template <class COMPARATOR>
+template <class VALUE>
+inline
+bool SortedSequenceUtil_EquivalentPred<COMPARATOR>::operator()(
+                                                    const VALUE& first,
+                                                    const VALUE& second) const
+{
+    return !d_comparator(first, second);
+}
+
+                     // ---------------------------------
+                     // class SortedSequenceUtil_Proctor
+                     // ---------------------------------
+
+// CREATORS
+template <class VECTOR>
+inline
+SortedSequenceUtil_Proctor<VECTOR>::SortedSequenceUtil_Proctor(
+                                    VECTOR                     *sequence,
+                                    typename VECTOR::size_type  length)
+: d_sequence_p(sequence)
+, d_length(length)
+{
+}
+
+template <class VECTOR>
+inline
+SortedSequenceUtil_Proctor<VECTOR>::~SortedSequenceUtil_Proctor()
+{
+    if (d_sequence_p) {
+        d_sequence_p->erase(d_sequence_p->begin() + d_length,
+                            d_sequence_p->end());
+    }
+}
+
+// MANIPULATORS
+template <class VECTOR>
+inline
+void SortedSequenceUtil_Proctor<VECTOR>::release()
+{
+    d_sequence_p = 0;
+}
+
+template <class VECTOR>
+inline
+void SortedSequenceUtil_Proctor<VECTOR>::setLength(
+                                             typename VECTOR::size_type length)
+{
+    d_length = length;
+}
+
+                         // -------------------------
+                         // struct SortedSequenceUtil
+                         // -------------------------
+
+// CLASS METHODS
+template <class FORWARD_ITERATOR, class COMPARATOR>
+bool SortedSequenceUtil::isSorted(FORWARD_ITERATOR  first,
+                                  FORWARD_ITERATOR  last,
+                                  const COMPARATOR& comparator)
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    FORWARD_ITERATOR next = first;
+    while (++next != last) {
+        if (comparator(*next, *first)) {
+            return false;                                             // RETURN
+        }
+        first = next;
+    }
+    return true;
+}
+
+template <class FORWARD_ITERATOR, class COMPARATOR>
+bool SortedSequenceUtil::isStrictlySorted(FORWARD_ITERATOR  first,
+                                          FORWARD_ITERATOR  last,
+                                          const COMPARATOR& comparator)
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    FORWARD_ITERATOR next = first;
+    while (++next != last) {
+        if (!comparator(*first, *next)) {
+            return false;                                             // RETURN
+        }
+        first = next;
+    }
+    return true;
+}
+
+template <class VECTOR, class COMPARATOR>
+typename VECTOR::size_type SortedSequenceUtil::sortSuffix(
+                                   VECTOR                     *sequence,
+                                   typename VECTOR::size_type  position,
+                                   const COMPARATOR&           comparator)
+{
+    BSLS_ASSERT_SAFE(sequence);
+    BSLS_ASSERT_SAFE(position <= sequence->size());
+
+    typedef typename VECTOR::iterator Iterator;
+
+    // Until the values before 'position' are modified, a failure can be
+    // undone by removing the suffix.
+
+    SortedSequenceUtil_Proctor<VECTOR> proctor(sequence, position);
+
+    Iterator middle = sequence->begin() + position;
+    if (!isSorted(middle, sequence->end(), comparator)) {
+        native_std::stable_sort(middle, sequence->end(), comparator);
+    }
+
+    if (middle == sequence->begin()
+     || middle == sequence->end()
+     || !comparator(*middle, *(middle - 1))) {
+        // The suffix is empty, or all of its values follow those of the
+        // prefix: there is nothing to merge.
+
+        proctor.release();
+        return position;                                              // RETURN
+    }
+
+    // Merge the suffix, copied to temporary storage, with the prefix, from
+    // the back, so that no value is overwritten before it has been copied.
+    // The values of the prefix are then modified, so a failure empties the
+    // sequence.
+
+    const VECTOR suffix(middle, sequence->end(), sequence->get_allocator());
+
+    proctor.setLength(0);
+
+    typename VECTOR::const_iterator suffixBegin = suffix.begin();
+    typename VECTOR::const_iterator suffixEnd   = suffix.end();
+
+    Iterator begin     = sequence->begin();
+    Iterator prefixEnd = middle;
+    Iterator out       = sequence->end();
+
+    while (suffixEnd != suffixBegin) {
+        if (prefixEnd != begin && comparator(*(suffixEnd - 1),
+                                             *(prefixEnd - 1))) {
+            *--out = *--prefixEnd;
+        }
+        else {
+            *--out = *--suffixEnd;
+        }
+    }
+
+    proctor.release();
+    return out - begin;
+}
+
+template <class VECTOR, class COMPARATOR>
+void SortedSequenceUtil::sortSuffixUnique(
+                                   VECTOR                     *sequence,
+                                   typename VECTOR::size_type  position,
+                                   const COMPARATOR&           comparator)
+{
+    BSLS_ASSERT_SAFE(sequence);
+    BSLS_ASSERT_SAFE(position <= sequence->size());
+
+    typedef typename VECTOR::iterator Iterator;
+
+    typename VECTOR::size_type firstChanged =
+                                    sortSuffix(sequence, position, comparator);
+
+    if (firstChanged == sequence->size()) {
+        return;                                                       // RETURN
+    }
+
+    // The first changed value may be equivalent to its predecessor.
+
+    if (firstChanged) {
+        --firstChanged;
+    }
+
+    SortedSequenceUtil_Proctor<VECTOR> proctor(sequence, 0);
+
+    Iterator last = native_std::unique(
+                       sequence->begin() + firstChanged,
+                       sequence->end(),
+                       SortedSequenceUtil_EquivalentPred<COMPARATOR>(
+                                                                  comparator));
+    sequence->erase(last, sequence->end());
+
+    proctor.release();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
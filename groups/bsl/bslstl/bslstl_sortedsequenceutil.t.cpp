@@ -0,0 +1,643 @@
+// bslstl_sortedsequenceutil.t.cpp                                    -*-C++-*-
+#include <bslstl_sortedsequenceutil.h>
+
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <functional>   // 'std::less'
+
+#include <stdio.h>      // 'printf'
+#include <stdlib.h>     // 'atoi'
+#include <string.h>     // 'strlen'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a namespace for algorithms on sorted
+// sequences held in vectors.  The algorithms are tested with table-driven
+// techniques on sequences of values having a key, by which they are ordered,
+// and a tag identifying their origin, so that the relative order of
+// equivalent values, and which of them are retained, can be observed.  The
+// exception-safety guarantees are tested with a comparator that throws after
+// a specified number of invocations.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] bool isSorted(FORWARD_ITERATOR, FORWARD_ITERATOR, const COMP&);
+// [ 1] bool isStrictlySorted(FWD_ITERATOR, FWD_ITERATOR, const COMP&);
+// [ 2] size_type sortSuffix(VECTOR *, size_type, const COMPARATOR&);
+// [ 3] void sortSuffixUnique(VECTOR *, size_type, const COMPARATOR&);
+// ----------------------------------------------------------------------------
+// [ 4] CONCERN: The basic exception-safety guarantee is provided.
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct Item {
+    // This 'struct' provides a value having a key, by which values are
+    // ordered, and a tag, that distinguishes equivalent values.
+
+    char d_key;  // key
+    int  d_tag;  // tag; not salient for ordering
+};
+
+typedef bslstl::SortedSequenceUtil Util;
+typedef bsl::vector<Item>          ItemVector;
+
+struct ItemLess {
+    // This 'struct' provides a comparator ordering 'Item' objects by key, that
+    // throws an exception once a specified number of comparisons has been
+    // made (if exceptions are enabled).
+
+    // CLASS DATA
+    static int s_countdown;  // number of comparisons before throwing, or
+                             // negative to never throw
+
+    // ACCESSORS
+    bool operator()(const Item& lhs, const Item& rhs) const
+        // Return 'true' if the key of the specified 'lhs' is less than that of
+        // the specified 'rhs', and 'false' otherwise.
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (0 == s_countdown) {
+            throw s_countdown;
+        }
+#endif
+        if (s_countdown > 0) {
+            --s_countdown;
+        }
+        return lhs.d_key < rhs.d_key;
+    }
+};
+
+int ItemLess::s_countdown = -1;
+
+void appendItems(ItemVector *items, const char *keys, int tag)
+    // Append to the specified 'items' one 'Item' for each character of the
+    // specified 'keys', having the specified 'tag'.
+{
+    for (; *keys; ++keys) {
+        Item item = { *keys, tag };
+        items->push_back(item);
+    }
+}
+
+void appendNumberedItems(ItemVector *items, const char *keys)
+    // Append to the specified 'items' one 'Item' for each character of the
+    // specified 'keys', having as tag the (1-based) position of the character
+    // in 'keys'.
+{
+    for (int tag = 1; keys[tag - 1]; ++tag) {
+        Item item = { keys[tag - 1], tag };
+        items->push_back(item);
+    }
+}
+
+bool isKeysEqual(const ItemVector& items, const char *keys)
+    // Return 'true' if the sequence of keys of the specified 'items' is that
+    // of the characters of the specified 'keys', and 'false' otherwise.
+{
+    if (items.size() != strlen(keys)) {
+        return false;                                                 // RETURN
+    }
+    for (ItemVector::size_type i = 0; i != items.size(); ++i) {
+        if (items[i].d_key != keys[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, NULL);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // CONCERN: No memory is allocated from the default allocator.
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Adding Values to a Sorted Vector in Bulk
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a sorted vector of integers, and we receive a batch of
+// new values, in no particular order, to add to it.
+//
+// First, we create the sorted vector:
+//..
+    bsl::vector<int> values(&oa);
+    values.push_back(10);
+    values.push_back(20);
+    values.push_back(30);
+//..
+// Then, we append the new values to the vector, noting the number of values
+// that were in the vector before:
+//..
+    const bsl::vector<int>::size_type numOldValues = values.size();
+
+    values.push_back(25);
+    values.push_back(5);
+    values.push_back(20);
+//..
+// Next, we sort the new values and merge them with the old ones, removing
+// duplicates:
+//..
+    bslstl::SortedSequenceUtil::sortSuffixUnique(&values,
+                                                 numOldValues,
+                                                 std::less<int>());
+//..
+// Finally, we observe that the vector is sorted, and that the duplicate value
+// has been removed:
+//..
+    ASSERT(5 == values.size());
+    ASSERT( 5 == values[0]);
+    ASSERT(10 == values[1]);
+    ASSERT(20 == values[2]);
+    ASSERT(25 == values[3]);
+    ASSERT(30 == values[4]);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: The basic exception-safety guarantee is provided.
+        //
+        // Concerns:
+        //: 1 If the comparator throws while the suffix is being sorted, the
+        //:   sequence holds the values of the prefix, unchanged.
+        //:
+        //: 2 If the comparator throws while the suffix is being merged, or
+        //:   while equivalent values are being removed, the sequence is empty.
+        //:
+        //: 3 No memory is leaked, and any temporary memory is allocated from
+        //:   the allocator of the sequence.
+        //
+        // Plan:
+        //: 1 For a set of prefixes and suffixes, and for each number of
+        //:   comparisons 'N' that 'sortSuffix' or 'sortSuffixUnique' makes,
+        //:   invoke the function with a comparator that throws on the 'N'th
+        //:   comparison, and verify that the sequence is afterwards either
+        //:   the prefix, or empty.  (C-1..2)
+        //:
+        //: 2 Use a test allocator for the sequence, and verify that the
+        //:   default allocator is not used, and that all memory is returned.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCERN: The basic exception-safety guarantee is provided.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY"
+                            "\n================\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+        static const struct {
+            int         d_line;    // source line number
+            const char *d_prefix;  // keys of the sorted prefix
+            const char *d_suffix;  // keys of the appended suffix
+        } DATA[] = {
+            //LINE  PREFIX     SUFFIX
+            //----  ---------  ---------
+            { L_,   "",        "cab"     },
+            { L_,   "ace",     "fdb"     },
+            { L_,   "ace",     "bdf"     },
+            { L_,   "bdf",     "aceg"    },
+            { L_,   "bdfh",    "hgfa"    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *PREFIX = DATA[ti].d_prefix;
+            const char *SUFFIX = DATA[ti].d_suffix;
+
+            for (int unique = 0; unique < 2; ++unique) {
+                for (int countdown = 0; ; ++countdown) {
+                    ItemVector mX(&oa);  const ItemVector& X = mX;
+                    appendItems(&mX, PREFIX, 0);
+                    appendItems(&mX, SUFFIX, 1);
+
+                    bool caught = false;
+
+                    ItemLess::s_countdown = countdown;
+                    try {
+                        if (unique) {
+                            Util::sortSuffixUnique(&mX,
+                                                   strlen(PREFIX),
+                                                   ItemLess());
+                        }
+                        else {
+                            Util::sortSuffix(&mX,
+                                             strlen(PREFIX),
+                                             ItemLess());
+                        }
+                    }
+                    catch (int) {
+                        caught = true;
+                    }
+                    ItemLess::s_countdown = -1;
+
+                    if (veryVerbose) {
+                        T_ P_(LINE) P_(unique) P_(countdown) P(caught)
+                    }
+
+                    if (!caught) {
+                        ASSERTV(LINE, X.size() >= strlen(PREFIX));
+                        break;
+                    }
+
+                    ASSERTV(LINE, unique, countdown,
+                            isKeysEqual(X, PREFIX) || X.empty());
+                }
+            }
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+#else
+        if (verbose) printf("Exceptions are disabled; skipping test.\n");
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'sortSuffixUnique'
+        //
+        // Concerns:
+        //: 1 The resulting sequence is strictly sorted, and holds one value
+        //:   for each distinct key of the prefix and suffix.
+        //:
+        //: 2 The values of the prefix are retained in preference to
+        //:   equivalent values of the suffix.
+        //:
+        //: 3 Of equivalent values of the suffix, the first is retained.
+        //:
+        //: 4 The function works for empty prefixes and suffixes, and for
+        //:   suffixes that are sorted, unsorted, or have duplicates.
+        //:
+        //: 5 Any memory is allocated from the allocator of the sequence.
+        //
+        // Plan:
+        //: 1 Using a table of prefixes and suffixes, tag each value of the
+        //:   prefix with 0 and each value of the suffix with its position in
+        //:   the suffix, invoke 'sortSuffixUnique', and verify the resulting
+        //:   keys, that each key of the prefix has tag 0, and that each other
+        //:   key has the tag of its first occurrence in the suffix.  (C-1..4)
+        //:
+        //: 2 Verify that the default allocator is not used.  (C-5)
+        //
+        // Testing:
+        //   void sortSuffixUnique(VECTOR *, size_type, const COMPARATOR&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'sortSuffixUnique'"
+                            "\n==================\n");
+
+        static const struct {
+            int         d_line;    // source line number
+            const char *d_prefix;  // keys of the sorted prefix
+            const char *d_suffix;  // keys of the appended suffix
+            const char *d_result;  // expected keys of the result
+        } DATA[] = {
+            //LINE  PREFIX     SUFFIX     RESULT
+            //----  ---------  ---------  -----------
+            { L_,   "",        "",        ""          },
+            { L_,   "abc",     "",        "abc"       },
+            { L_,   "",        "a",       "a"         },
+            { L_,   "",        "aa",      "a"         },
+            { L_,   "",        "cbaabc",  "abc"       },
+            { L_,   "a",       "a",       "a"         },
+            { L_,   "ab",      "cd",      "abcd"      },
+            { L_,   "ab",      "dc",      "abcd"      },
+            { L_,   "ab",      "bcc",     "abc"       },
+            { L_,   "cd",      "ab",      "abcd"      },
+            { L_,   "bd",      "eca",     "abcde"     },
+            { L_,   "bdf",     "fdb",     "bdf"       },
+            { L_,   "bdf",     "gfedcba", "abcdefg"   },
+            { L_,   "aceg",    "hfdbbdfh","abcdefgh"  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *PREFIX = DATA[ti].d_prefix;
+            const char *SUFFIX = DATA[ti].d_suffix;
+            const char *RESULT = DATA[ti].d_result;
+
+            if (veryVerbose) { T_ P_(LINE) P_(PREFIX) P_(SUFFIX) P(RESULT) }
+
+            ItemVector mX(&oa);  const ItemVector& X = mX;
+            appendItems(&mX, PREFIX, 0);
+            appendNumberedItems(&mX, SUFFIX);
+
+            Util::sortSuffixUnique(&mX, strlen(PREFIX), ItemLess());
+
+            ASSERTV(LINE, isKeysEqual(X, RESULT));
+            ASSERTV(LINE, Util::isStrictlySorted(X.begin(),
+                                                 X.end(),
+                                                 ItemLess()));
+
+            for (ItemVector::size_type i = 0; i != X.size(); ++i) {
+                const int EXP_TAG = strchr(PREFIX, X[i].d_key)
+                                  ? 0
+                                  : static_cast<int>(
+                                      strchr(SUFFIX, X[i].d_key) - SUFFIX + 1);
+                ASSERTV(LINE, i, EXP_TAG, X[i].d_tag, EXP_TAG == X[i].d_tag);
+            }
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'sortSuffix'
+        //
+        // Concerns:
+        //: 1 The resulting sequence is sorted, and holds every value of the
+        //:   prefix and of the suffix.
+        //:
+        //: 2 Each value of the prefix precedes the equivalent values of the
+        //:   suffix, and equivalent values of the suffix keep their relative
+        //:   order (i.e., the sort is stable).
+        //:
+        //: 3 The returned index is that of the first value that changed, and
+        //:   is the size of the prefix if the suffix follows the prefix.
+        //:
+        //: 4 The function works for empty prefixes and suffixes, and for
+        //:   suffixes that are sorted, unsorted, or have duplicates.
+        //:
+        //: 5 Any memory is allocated from the allocator of the sequence.
+        //
+        // Plan:
+        //: 1 Using a table of prefixes and suffixes, tag each value of the
+        //:   prefix with 0 and each value of the suffix with its position in
+        //:   the suffix, invoke 'sortSuffix', and verify the resulting keys,
+        //:   the returned index, and that, within each run of equivalent
+        //:   values, the values of the suffix follow those of the prefix in
+        //:   increasing order of tag.  (C-1..4)
+        //:
+        //: 2 Verify that the default allocator is not used.  (C-5)
+        //
+        // Testing:
+        //   size_type sortSuffix(VECTOR *, size_type, const COMPARATOR&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'sortSuffix'"
+                            "\n============\n");
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_prefix;   // keys of the sorted prefix
+            const char *d_suffix;   // keys of the appended suffix
+            const char *d_result;   // expected keys of the result
+            int         d_changed;  // expected index of first changed value
+        } DATA[] = {
+            //LINE  PREFIX    SUFFIX     RESULT        CHANGED
+            //----  --------  ---------  ------------  -------
+            { L_,   "",       "",        "",                 0 },
+            { L_,   "abc",    "",        "abc",              3 },
+            { L_,   "",       "a",       "a",                0 },
+            { L_,   "",       "cbaabc",  "aabbcc",           0 },
+            { L_,   "a",      "a",       "aa",               1 },
+            { L_,   "ab",     "cd",      "abcd",             2 },
+            { L_,   "ab",     "dc",      "abcd",             2 },
+            { L_,   "ab",     "bcc",     "abbcc",            2 },
+            { L_,   "cd",     "ab",      "abcd",             0 },
+            { L_,   "bd",     "eca",     "abcde",            0 },
+            { L_,   "bdf",    "e",       "bdef",             2 },
+            { L_,   "bdf",    "fdb",     "bbddff",           1 },
+            { L_,   "aabb",   "ba",      "aaabbb",           2 },
+            { L_,   "aceg",   "hfdbbdfh","abbcddeffghh",     1 },
+            { L_,   "",       "babababa","aaaabbbb",         0 },
+            { L_,   "b",      "cbcbab",  "abbbbcc",          0 },
+            { L_,   "c",      "cbacbacbacbacbacbacbacbacbacbacbacbacba",
+                                 "aaaaaaaaaaaaabbbbbbbbbbbbbcccccccccccccc",
+                                                                 0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_line;
+            const char *PREFIX  = DATA[ti].d_prefix;
+            const char *SUFFIX  = DATA[ti].d_suffix;
+            const char *RESULT  = DATA[ti].d_result;
+            const int   CHANGED = DATA[ti].d_changed;
+
+            if (veryVerbose) { T_ P_(LINE) P_(PREFIX) P_(SUFFIX) P(RESULT) }
+
+            ItemVector mX(&oa);  const ItemVector& X = mX;
+            appendItems(&mX, PREFIX, 0);
+            appendNumberedItems(&mX, SUFFIX);
+
+            const ItemVector::size_type changed =
+                             Util::sortSuffix(&mX, strlen(PREFIX), ItemLess());
+
+            ASSERTV(LINE, isKeysEqual(X, RESULT));
+            ASSERTV(LINE, CHANGED, changed, CHANGED == (int)changed);
+
+            for (ItemVector::size_type i = 1; i < X.size(); ++i) {
+                if (X[i - 1].d_key == X[i].d_key && 0 != X[i].d_tag) {
+                    ASSERTV(LINE, i, X[i - 1].d_tag < X[i].d_tag);
+                }
+            }
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // 'isSorted' AND 'isStrictlySorted'
+        //
+        // Concerns:
+        //: 1 'isSorted' returns 'true' if and only if no value is ordered
+        //:   before its predecessor.
+        //:
+        //: 2 'isStrictlySorted' returns 'true' if and only if every value is
+        //:   ordered after its predecessor.
+        //:
+        //: 3 Both functions return 'true' for empty and single-value ranges.
+        //
+        // Plan:
+        //: 1 Using a table of key sequences and expected results, invoke both
+        //:   functions and verify the results.  (C-1..3)
+        //
+        // Testing:
+        //   bool isSorted(FORWARD_ITERATOR, FORWARD_ITERATOR, const COMP&);
+        //   bool isStrictlySorted(FWD_ITERATOR, FWD_ITERATOR, const COMP&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'isSorted' AND 'isStrictlySorted'"
+                            "\n=================================\n");
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_keys;      // keys of the sequence
+            bool        d_sorted;    // expected result of 'isSorted'
+            bool        d_strictly;  // expected result of 'isStrictlySorted'
+        } DATA[] = {
+            //LINE  KEYS      SORTED  STRICTLY
+            //----  --------  ------  --------
+            { L_,   "",       true,   true     },
+            { L_,   "a",      true,   true     },
+            { L_,   "ab",     true,   true     },
+            { L_,   "aa",     true,   false    },
+            { L_,   "ba",     false,  false    },
+            { L_,   "abcd",   true,   true     },
+            { L_,   "abbd",   true,   false    },
+            { L_,   "abdc",   false,  false    },
+            { L_,   "bacd",   false,  false    },
+            { L_,   "aaaa",   true,   false    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *KEYS     = DATA[ti].d_keys;
+            const bool  SORTED   = DATA[ti].d_sorted;
+            const bool  STRICTLY = DATA[ti].d_strictly;
+
+            if (veryVerbose) { T_ P_(LINE) P(KEYS) }
+
+            ItemVector mX(&oa);  const ItemVector& X = mX;
+            appendItems(&mX, KEYS, 0);
+
+            ASSERTV(LINE, SORTED   == Util::isSorted(X.begin(),
+                                                         X.end(),
+                                                         ItemLess()));
+            ASSERTV(LINE, STRICTLY == Util::isStrictlySorted(X.begin(),
+                                                             X.end(),
+                                                             ItemLess()));
+
+            // Also verify the functions on a range of pointers to 'char'.
+
+            const char *END = KEYS + strlen(KEYS);
+            ASSERTV(LINE, SORTED   == Util::isSorted(KEYS,
+                                                         END,
+                                                         std::less<char>()));
+            ASSERTV(LINE, STRICTLY == Util::isStrictlySorted(
+                                                           KEYS,
+                                                           END,
+                                                           std::less<char>()));
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -155,6 +155,8 @@ BSLS_IDENT("$Id: $")
 //  'distance(i1,i2)' - the number of elements in the range [i1, i2)
 //  'distance(p1,p2)' - the number of elements in the range [p1, p2)
 //  'z'               - a floating point value representing a load factor
+//  'ka'              - an array of 'q' objects of type 'K'
+//  'ra'              - an array of 'q' iterators, or 'q' counts
 //
 //  +----------------------------------------------------+--------------------+
 //  | Operation                                          | Complexity         |
@@ -237,6 +239,9 @@ BSLS_IDENT("$Id: $")
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
+//  | a.findBatch(ra, ka, q)                             | Average: O[q]      |
+//  | a.countBatch(ra, ka, q)                            | Worst:   O[q * n]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.count(k)                                         | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -279,6 +284,20 @@ BSLS_IDENT("$Id: $")
 // not an iterator referring to any element in the container, so may be
 // invalidated by any non-'const' method.
 //
+///Batch Lookup
+///------------
+// 'findBatch' and 'countBatch' look up an array of keys at once.  Looking up a
+// key in a large unordered map typically incurs two cache misses or more (on
+// the bucket, and on the nodes of the bucket), and successive calls to 'find'
+// incur them one after the other.  The batch methods compute the hash codes of
+// a group of keys, and prefetch their buckets and nodes, before searching any
+// of them, so that the cache misses of the lookups in a group overlap.  Any
+// benefit is limited to unordered maps much larger than the last-level cache,
+// and depends on the platform: a processor that executes out of order may
+// already overlap the independent misses of a simple loop calling 'find', in
+// which case the batch methods perform like that loop (as they do for smaller
+// unordered maps).  Measure before replacing calls to 'find'.
+//
 ///Unordered Map Configuration
 ///---------------------------
 // The unordered map has interfaces that can provide insight into and control
@@ -1221,6 +1240,17 @@ class unordered_map {
         // object in this unordered map having the specified 'key', if such an
         // entry exists, and the past-the-end iterator ('end') otherwise.
 
+    void findBatch(iterator       *results,
+                   const key_type *keys,
+                   size_type       numKeys);
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator providing modifiable access to the
+        // 'value_type' object in this unordered map having the corresponding
+        // element of the specified 'keys' array as its key, if such an entry
+        // exists, and the past-the-end iterator ('end') otherwise (see {Batch
+        // Lookup}).  The behavior is undefined unless 'results' and 'keys'
+        // each refer to arrays of at least 'numKeys' elements.
+
     template <class SOURCE_TYPE>
     pair<iterator, bool> insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this unordered map if the key (the
@@ -1383,6 +1413,17 @@ class unordered_map {
         // unordered map maintains unique keys, the returned value will be
         // either 0 or 1.
 
+    void countBatch(size_type      *results,
+                    const key_type *keys,
+                    size_type       numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array the number of 'value_type' objects contained within
+        // this unordered map having the corresponding element of the
+        // specified 'keys' array as their key (see {Batch Lookup}).  The
+        // behavior is undefined unless 'results' and 'keys' each refer to
+        // arrays of at least 'numKeys' elements.  Note that since an unordered
+        // map maintains unique keys, each loaded value will be either 0 or 1.
+
     bool empty() const;
         // Return 'true' if this unordered map contains no elements, and
         // 'false' otherwise.
@@ -1404,6 +1445,17 @@ class unordered_map {
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    void findBatch(const_iterator *results,
+                   const key_type *keys,
+                   size_type       numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator providing non-modifiable access to the
+        // 'value_type' object in this unordered map having the corresponding
+        // element of the specified 'keys' array as its key, if such an entry
+        // exists, and the past-the-end iterator ('end') otherwise (see {Batch
+        // Lookup}).  The behavior is undefined unless 'results' and 'keys'
+        // each refer to arrays of at least 'numKeys' elements.
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -1695,6 +1747,36 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findBatch(
+                                                     iterator       *results,
+                                                     const key_type *keys,
+                                                     size_type       numKeys)
+{
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    enum { k_CHUNK_SIZE = 64 };
+
+    HashTableLink *links[k_CHUNK_SIZE];
+
+    while (numKeys) {
+        const size_type chunkSize = numKeys < k_CHUNK_SIZE
+                                  ? numKeys
+                                  : static_cast<size_type>(k_CHUNK_SIZE);
+
+        d_impl.findBatch(links, keys, chunkSize);
+
+        for (size_type i = 0; i != chunkSize; ++i) {
+            results[i] = iterator(links[i]);
+        }
+
+        results += chunkSize;
+        keys    += chunkSize;
+        numKeys -= chunkSize;
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 template <class SOURCE_TYPE>
 bsl::pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -1942,6 +2024,36 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::count(
     return d_impl.find(key) != 0;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::countBatch(
+                                               size_type      *results,
+                                               const key_type *keys,
+                                               size_type       numKeys) const
+{
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    enum { k_CHUNK_SIZE = 64 };
+
+    HashTableLink *links[k_CHUNK_SIZE];
+
+    while (numKeys) {
+        const size_type chunkSize = numKeys < k_CHUNK_SIZE
+                                  ? numKeys
+                                  : static_cast<size_type>(k_CHUNK_SIZE);
+
+        d_impl.findBatch(links, keys, chunkSize);
+
+        for (size_type i = 0; i != chunkSize; ++i) {
+            results[i] = 0 != links[i];
+        }
+
+        results += chunkSize;
+        keys    += chunkSize;
+        numKeys -= chunkSize;
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bool
@@ -1982,6 +2094,36 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findBatch(
+                                               const_iterator *results,
+                                               const key_type *keys,
+                                               size_type       numKeys) const
+{
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    enum { k_CHUNK_SIZE = 64 };
+
+    HashTableLink *links[k_CHUNK_SIZE];
+
+    while (numKeys) {
+        const size_type chunkSize = numKeys < k_CHUNK_SIZE
+                                  ? numKeys
+                                  : static_cast<size_type>(k_CHUNK_SIZE);
+
+        d_impl.findBatch(links, keys, chunkSize);
+
+        for (size_type i = 0; i != chunkSize; ++i) {
+            results[i] = const_iterator(links[i]);
+        }
+
+        results += chunkSize;
+        keys    += chunkSize;
+        numKeys -= chunkSize;
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
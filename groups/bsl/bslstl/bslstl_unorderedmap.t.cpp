@@ -1,6 +1,7 @@
 // bslstl_unorderedmap.t.cpp                                          -*-C++-*-
 #include <bslstl_unorderedmap.h>
 
+#include <bslstl_cachehashcode.h>
 #include <bslstl_hash.h>
 #include <bslstl_pair.h>
 #include <bslstl_string.h>
@@ -18,6 +19,7 @@
 
 #include <bslmf_haspointersemantics.h>
 #include <bslmf_issame.h>
+#include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
@@ -25,6 +27,7 @@
 #include <bsls_exceptionutil.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_util.h>
 
 #include <bsltf_stdtestallocator.h>
@@ -55,9 +58,15 @@ using namespace BloombergLP;
 // guarantees.
 //-----------------------------------------------------------------------------
 // [ ]
+// [17] void findBatch(iterator *, const key_type *, size_type);
+// [17] void findBatch(const_iterator *, const key_type *, size_type) const;
+// [17] void countBatch(size_type *, const key_type *, size_type) const;
 //-----------------------------------------------------------------------------
 // [1] BREATHING TEST
-// [2] USAGE EXAMPLE
+// [18] CONCERN: 'bslstl::CacheHashCode' hash functors are invoked once
+// [19] USAGE EXAMPLE
+// [-1] BATCH LOOKUP PERFORMANCE
+// [-2] STORED HASH CODE PERFORMANCE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -5749,6 +5758,53 @@ class TestNonConstHashFunctor {
     }
 };
 
+                          // ========================
+                          // struct CountingStringHash
+                          // ========================
+
+struct CountingStringHash {
+    // This 'struct' provides a hash functor for strings that counts the number
+    // of times it is invoked (by any object of this type).
+
+    // CLASS DATA
+    static int s_numCalls;  // number of invocations of 'operator()'
+
+    // ACCESSORS
+    native_std::size_t operator()(const bsl::string& key) const
+        // Return the hash code of the specified 'key', and increment
+        // 's_numCalls'.
+    {
+        ++s_numCalls;
+        return bsl::hash<bsl::string>()(key);
+    }
+};
+
+int CountingStringHash::s_numCalls = 0;
+
+                       // ===============================
+                       // struct CachedCountingStringHash
+                       // ===============================
+
+struct CachedCountingStringHash : CountingStringHash {
+    // This 'struct' provides a hash functor for strings, with which the
+    // 'bslstl::CacheHashCode' trait is associated, that counts the number of
+    // times it is invoked.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(CachedCountingStringHash,
+                                   bslstl::CacheHashCode);
+};
+
+                       // ======================
+                       // struct CachedStringHash
+                       // ======================
+
+struct CachedStringHash : bsl::hash<bsl::string> {
+    // This 'struct' provides the standard hash functor for strings, with the
+    // 'bslstl::CacheHashCode' trait associated.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(CachedStringHash, bslstl::CacheHashCode);
+};
+
                        // =========================
                        // class CharToPairConverter
                        // =========================
@@ -5978,6 +6034,9 @@ class TestDriver {
   public:
     // TEST CASES
 
+    static void testCase17();
+        // Batch lookup
+
     static void testCase16();
         // Testing Typedefs
 
@@ -6117,6 +6176,149 @@ void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::matchFirstValues(
     delete[] foundValues;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase17()
+{
+    // ------------------------------------------------------------------------
+    // TESTING BATCH LOOKUP
+    //
+    // Concerns:
+    //: 1 Both overloads of 'findBatch' load, for each key, the iterator that
+    //:   the corresponding overload of 'find' returns for that key.
+    //:
+    //: 2 'countBatch' loads, for each key, the value that 'count' returns for
+    //:   that key.
+    //:
+    //: 3 Any number of keys is supported, including 0 and numbers that are
+    //:   not multiples of the sizes of the groups in which keys are looked
+    //:   up, and keys may be repeated.
+    //:
+    //: 4 Only the first 'numKeys' elements of the result array are modified.
+    //:
+    //: 5 No memory is allocated.
+    //:
+    //: 6 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 For each spec in 'DEFAULT_DATA', create an object, and an array of
+    //:   200 keys cycling through the default test values, so that some keys
+    //:   are in the object and others are not.  For each of a set of numbers
+    //:   of keys, call 'findBatch' and 'countBatch' on a prefix of the array,
+    //:   and compare each result against 'find' and 'count'.  Verify that the
+    //:   element following the last result is unchanged.  (C-1..4)
+    //:
+    //: 2 Verify, using test allocators, that no memory is allocated by the
+    //:   calls.  (C-5)
+    //:
+    //: 3 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered for null arrays.  (C-6)
+    //
+    // Testing:
+    //   void findBatch(iterator *, const key_type *, size_type);
+    //   void findBatch(const_iterator *, const key_type *, size_type) const;
+    //   void countBatch(size_type *, const key_type *, size_type) const;
+    // ------------------------------------------------------------------------
+
+    typedef bsltf::TestValuesArray<KEY> TestKeys;
+
+    const size_t NUM_DATA                  = DEFAULT_NUM_DATA;
+    const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+    enum { k_MAX_KEYS = 200 };
+
+    static const SizeType NUM_KEYS[] = { 0, 1, 2, 15, 16, 17, 63, 64, 65,
+                                         k_MAX_KEYS };
+    enum { NUM_NUM_KEYS = sizeof NUM_KEYS / sizeof *NUM_KEYS };
+
+    static const char ALPHABET[] =
+                        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+    char keySpec[k_MAX_KEYS + 1];
+    for (int i = 0; i < k_MAX_KEYS; ++i) {
+        keySpec[i] = ALPHABET[i % (sizeof ALPHABET - 1)];
+    }
+    keySpec[k_MAX_KEYS] = '\0';
+
+    bslma::TestAllocator da("default",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("supplied",  veryVeryVeryVerbose);
+    bslma::TestAllocator ta("scratch",   veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    const TestKeys KEYS(keySpec, &ta);
+
+    for (size_t ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE = DATA[ti].d_line;
+        const char *const SPEC = DATA[ti].d_spec;
+
+        if (veryVerbose) { P_(LINE) P(SPEC) }
+
+        Obj mX(&sa);    const Obj& X = mX;
+        gg(&mX, SPEC);
+
+        for (int tj = 0; tj < NUM_NUM_KEYS; ++tj) {
+            const SizeType N = NUM_KEYS[tj];
+
+            Iter     iterators[k_MAX_KEYS + 1];
+            CIter    constIterators[k_MAX_KEYS + 1];
+            SizeType counts[k_MAX_KEYS + 1];
+
+            for (int i = 0; i <= k_MAX_KEYS; ++i) {
+                iterators[i]      = mX.end();
+                constIterators[i] = X.end();
+                counts[i]         = 99;
+            }
+
+            const bsls::Types::Int64 DA = da.numAllocations();
+            const bsls::Types::Int64 SA = sa.numAllocations();
+
+            mX.findBatch(iterators, KEYS.data(), N);
+            X.findBatch(constIterators, KEYS.data(), N);
+            X.countBatch(counts, KEYS.data(), N);
+
+            ASSERTV(LINE, N, DA == da.numAllocations());
+            ASSERTV(LINE, N, SA == sa.numAllocations());
+
+            for (SizeType i = 0; i < N; ++i) {
+                ASSERTV(LINE, N, i, mX.find(KEYS[i]) == iterators[i]);
+                ASSERTV(LINE, N, i, X.find(KEYS[i])  == constIterators[i]);
+                ASSERTV(LINE, N, i, X.count(KEYS[i]) == counts[i]);
+            }
+            ASSERTV(LINE, N, 99 == counts[N]);
+        }
+    }
+
+    if (verbose) printf("\nNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        Obj mX;    const Obj& X = mX;
+
+        Iter     iterators[1];
+        CIter    constIterators[1];
+        SizeType counts[1];
+
+        ASSERT_SAFE_FAIL(mX.findBatch(static_cast<Iter *>(0),
+                                      KEYS.data(),
+                                      1));
+        ASSERT_SAFE_FAIL(mX.findBatch(iterators, 0, 1));
+        ASSERT_SAFE_PASS(mX.findBatch(static_cast<Iter *>(0), 0, 0));
+        ASSERT_SAFE_PASS(mX.findBatch(iterators, KEYS.data(), 1));
+
+        ASSERT_SAFE_FAIL(X.findBatch(static_cast<CIter *>(0),
+                                     KEYS.data(),
+                                     1));
+        ASSERT_SAFE_FAIL(X.findBatch(constIterators, 0, 1));
+        ASSERT_SAFE_PASS(X.findBatch(static_cast<CIter *>(0), 0, 0));
+        ASSERT_SAFE_PASS(X.findBatch(constIterators, KEYS.data(), 1));
+
+        ASSERT_SAFE_FAIL(X.countBatch(0, KEYS.data(), 1));
+        ASSERT_SAFE_FAIL(X.countBatch(counts, 0, 1));
+        ASSERT_SAFE_PASS(X.countBatch(0, 0, 0));
+        ASSERT_SAFE_PASS(X.countBatch(counts, KEYS.data(), 1));
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOC>
 void TestDriver<KEY, VALUE, HASH, EQUAL, ALLOC>::testCase16()
 {
@@ -9553,7 +9755,7 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:
 #if !defined(BSLSTL_UNORDEREDMAP_DO_NOT_TEST_USAGE)
-        case 17: {
+        case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9574,6 +9776,166 @@ int main(int argc, char *argv[])
         usage();
       } break;
 #endif
+      case 18: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'bslstl::CacheHashCode' hash functors are invoked once
+        //
+        // Concerns:
+        //: 1 A map whose hash functor has the 'bslstl::CacheHashCode' trait
+        //:   has the same value, after the same sequence of operations, as a
+        //:   map whose hash functor does not.
+        //:
+        //: 2 Such a map invokes its hash functor exactly once for each
+        //:   inserted element, and not at all when it grows, is rehashed, is
+        //:   copied, or when an element is erased through an iterator.
+        //:
+        //: 3 Lookups (including batch lookups) in such a map find exactly the
+        //:   keys that were inserted.
+        //
+        // Plan:
+        //: 1 Insert the same sequence of long string keys into a map with
+        //:   a counting hash functor having the trait, and into a map with
+        //:   a counting hash functor lacking it, and compare the number of
+        //:   invocations of each.  (C-2)
+        //:
+        //: 2 Look up every inserted key, and some keys that were not
+        //:   inserted, in both maps, individually and in batches.  (C-3)
+        //:
+        //: 3 Grow, rehash, copy, and erase from the map having the trait,
+        //:   verifying that its hash functor is not invoked, and that its
+        //:   value is that of the other map after the same operations.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: 'bslstl::CacheHashCode' hash functors are invoked once
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: 'bslstl::CacheHashCode' HASHERS"
+                            "\n========================================\n");
+
+        typedef bsl::unordered_map<bsl::string, int, CountingStringHash> Obj;
+        typedef bsl::unordered_map<bsl::string, int, CachedCountingStringHash>
+                                                                     CachedObj;
+
+        BSLMF_ASSERT(!bslstl::CacheHashCode<CountingStringHash>::value);
+        BSLMF_ASSERT( bslstl::CacheHashCode<CachedCountingStringHash>::value);
+
+        enum { k_NUM_KEYS = 1000 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> keys(&oa);
+        for (int i = 0; i < 2 * k_NUM_KEYS; ++i) {
+            char buffer[32];
+            sprintf(buffer, "%d", i);
+            keys.push_back(bsl::string(64, 'k', &oa) + buffer);
+        }
+
+        Obj       mX(&oa);  const Obj&       X = mX;
+        CachedObj mY(&oa);  const CachedObj& Y = mY;
+
+        if (verbose) printf("Testing insertion.\n");
+
+        CountingStringHash::s_numCalls = 0;
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            mX.insert(Obj::value_type(keys[i], i));
+        }
+        const int numUncachedCalls = CountingStringHash::s_numCalls;
+
+        CountingStringHash::s_numCalls = 0;
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            if (i % 2) {
+                mY.insert(CachedObj::value_type(keys[i], i));
+            }
+            else {
+                mY[keys[i]] = i;
+            }
+        }
+        const int numCachedCalls = CountingStringHash::s_numCalls;
+
+        ASSERTV(numCachedCalls, k_NUM_KEYS == numCachedCalls);
+        ASSERTV(numUncachedCalls, numCachedCalls,
+                numUncachedCalls > numCachedCalls);
+        ASSERTV(X.size(), k_NUM_KEYS == X.size());
+        ASSERTV(Y.size(), k_NUM_KEYS == Y.size());
+
+        if (verbose) printf("Testing lookup.\n");
+
+        CountingStringHash::s_numCalls = 0;
+        for (int i = 0; i < 2 * k_NUM_KEYS; ++i) {
+            const bool inserted = i < k_NUM_KEYS;
+
+            CachedObj::const_iterator it = Y.find(keys[i]);
+            ASSERTV(i, inserted == (Y.end() != it));
+            ASSERTV(i, inserted == (X.end() != X.find(keys[i])));
+            if (inserted && Y.end() != it) {
+                ASSERTV(i, it->second, i == it->second);
+            }
+        }
+        ASSERTV(CountingStringHash::s_numCalls,
+                4 * k_NUM_KEYS == CountingStringHash::s_numCalls);
+
+        for (int i = 0; i < 2 * k_NUM_KEYS; i += 50) {
+            CachedObj::const_iterator results[50];
+            mY.findBatch(results, &keys[i], 50);
+            for (int j = 0; j < 50; ++j) {
+                ASSERTV(i, j, Y.find(keys[i + j]) == results[j]);
+            }
+        }
+
+        if (verbose) printf("Testing growth, rehash, and copy.\n");
+
+        CountingStringHash::s_numCalls = 0;
+        mY.rehash(8 * Y.bucket_count());
+        mY.reserve(4 * k_NUM_KEYS);
+        {
+            CachedObj mZ(Y, &oa);  const CachedObj& Z = mZ;
+            ASSERT(Z == Y);
+        }
+        ASSERTV(CountingStringHash::s_numCalls,
+                0 == CountingStringHash::s_numCalls);
+
+        mX.rehash(8 * X.bucket_count());
+        mX.reserve(4 * k_NUM_KEYS);
+
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            ASSERTV(i, Y.end() != Y.find(keys[i]));
+        }
+
+        if (verbose) printf("Testing erasure.\n");
+
+        CountingStringHash::s_numCalls = 0;
+        for (int i = 0; i < k_NUM_KEYS; i += 2) {
+            mY.erase(Y.find(keys[i]));
+        }
+        ASSERTV(CountingStringHash::s_numCalls,
+                k_NUM_KEYS / 2 == CountingStringHash::s_numCalls);
+
+        for (int i = 0; i < k_NUM_KEYS; i += 2) {
+            ASSERTV(i, 1 == mX.erase(keys[i]));
+        }
+
+        ASSERTV(X.size(), Y.size(), X.size() == Y.size());
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+            CachedObj::const_iterator jt = Y.find(it->first);
+            ASSERTV(it->first.c_str(), Y.end() != jt);
+            if (Y.end() != jt) {
+                ASSERTV(it->first.c_str(), it->second == jt->second);
+            }
+        }
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("Testing Batch Lookup\n"
+                            "====================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase17,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // GROWING FUNCTIONS
@@ -9998,6 +10360,193 @@ int main(int argc, char *argv[])
         if (veryVerbose)
             printf("Final message to confim the end of the breathing test.\n");
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BATCH LOOKUP PERFORMANCE
+        //   Compare the time taken to look up keys in a map that is much
+        //   larger than the last-level cache by successive calls to 'find',
+        //   and by calls to 'findBatch' on groups of 64 keys.  Half of the
+        //   keys looked up are in the map.  Optionally specify the number of
+        //   elements in the map as the second argument (4M by default).
+        //
+        // Testing:
+        //   BATCH LOOKUP PERFORMANCE
+        // --------------------------------------------------------------------
+
+        printf("\nBATCH LOOKUP PERFORMANCE"
+               "\n========================\n");
+
+        typedef bsls::Types::Uint64                 Uint64;
+        typedef bsl::unordered_map<Uint64, Uint64>  Map;
+
+        enum { k_GROUP_SIZE = 64, k_NUM_LOOKUPS = 1 << 22 };
+
+        const int numElements = argc > 2 && atoi(argv[2]) > 0
+                              ? atoi(argv[2])
+                              : 1 << 22;
+
+        bslma::Allocator *alloc = &bslma::MallocFreeAllocator::singleton();
+
+        // Multiplying by an odd constant spreads the (otherwise consecutive)
+        // keys over the buckets, since 'bsl::hash<Uint64>' is the identity.
+
+        const Uint64 k_SPREAD = 0x9e3779b97f4a7c15ULL;
+
+        Map map(alloc);
+        map.reserve(numElements);
+        for (int i = 0; i < numElements; ++i) {
+            map[i * k_SPREAD] = i;
+        }
+
+        bsl::vector<Uint64> keys(alloc);
+        keys.reserve(k_NUM_LOOKUPS);
+
+        Uint64 state = 88172645463325252ULL;
+        for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            keys.push_back((state % (2 * static_cast<Uint64>(numElements)))
+                                                                  * k_SPREAD);
+        }
+
+        bsls::Stopwatch timer;
+
+        Uint64 numFound = 0;
+
+        timer.start();
+        for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+            numFound += map.find(keys[i]) != map.end();
+        }
+        timer.stop();
+
+        const double findTime = timer.elapsedTime();
+
+        Uint64 numBatchFound = 0;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_NUM_LOOKUPS; i += k_GROUP_SIZE) {
+            Map::iterator results[k_GROUP_SIZE];
+
+            map.findBatch(results, &keys[i], k_GROUP_SIZE);
+
+            for (int j = 0; j < k_GROUP_SIZE; ++j) {
+                numBatchFound += results[j] != map.end();
+            }
+        }
+        timer.stop();
+
+        const double findBatchTime = timer.elapsedTime();
+
+        ASSERTV(numFound, numBatchFound, numFound == numBatchFound);
+
+        const double scale = 1e9 / k_NUM_LOOKUPS;
+
+        printf("elements: %d, lookups: %d, found: %llu\n",
+               numElements,
+               static_cast<int>(k_NUM_LOOKUPS),
+               static_cast<unsigned long long>(numFound));
+        printf("find:      %8.2f ns/lookup\n", findTime      * scale);
+        printf("findBatch: %8.2f ns/lookup\n", findBatchTime * scale);
+        printf("speedup:   %8.2f\n", findTime / findBatchTime);
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // STORED HASH CODE PERFORMANCE
+        //   Compare the time taken to grow a map keyed by long strings from
+        //   empty (rehashing it repeatedly), and to look up its keys, with a
+        //   hash functor that has the 'bslstl::CacheHashCode' trait and with
+        //   one that does not.  Optionally specify the number of elements as
+        //   the second argument (1M by default), and the length of the keys
+        //   as the third argument (128 by default).
+        //
+        // Testing:
+        //   STORED HASH CODE PERFORMANCE
+        // --------------------------------------------------------------------
+
+        printf("\nSTORED HASH CODE PERFORMANCE"
+               "\n============================\n");
+
+        typedef bsl::unordered_map<bsl::string, int>                   Map;
+        typedef bsl::unordered_map<bsl::string, int, CachedStringHash>
+                                                                     CachedMap;
+
+        const int numElements = argc > 2 && atoi(argv[2]) > 0
+                              ? atoi(argv[2])
+                              : 1 << 20;
+        const int keyLength   = argc > 3 && atoi(argv[3]) > 0
+                              ? atoi(argv[3])
+                              : 128;
+
+        bslma::Allocator *alloc = &bslma::MallocFreeAllocator::singleton();
+
+        bsl::vector<bsl::string> keys(alloc);
+        keys.reserve(numElements);
+        for (int i = 0; i < numElements; ++i) {
+            char buffer[32];
+            sprintf(buffer, "%d", i);
+            keys.push_back(bsl::string(keyLength, 'k', alloc) + buffer);
+        }
+
+        bsls::Stopwatch timer;
+        double          times[2][2];  // [cached][growth/lookup]
+        int             numFound[2] = { 0, 0 };
+
+        {
+            Map map(alloc);
+
+            timer.start();
+            for (int i = 0; i < numElements; ++i) {
+                map.insert(Map::value_type(keys[i], i));
+            }
+            timer.stop();
+            times[0][0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < numElements; ++i) {
+                numFound[0] += map.end() != map.find(keys[i]);
+            }
+            timer.stop();
+            times[0][1] = timer.elapsedTime();
+        }
+        {
+            CachedMap map(alloc);
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < numElements; ++i) {
+                map.insert(CachedMap::value_type(keys[i], i));
+            }
+            timer.stop();
+            times[1][0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < numElements; ++i) {
+                numFound[1] += map.end() != map.find(keys[i]);
+            }
+            timer.stop();
+            times[1][1] = timer.elapsedTime();
+        }
+
+        ASSERTV(numFound[0], numElements == numFound[0]);
+        ASSERTV(numFound[1], numElements == numFound[1]);
+
+        const double scale = 1e9 / numElements;
+
+        printf("elements: %d, key length: %d\n", numElements, keyLength);
+        printf("           %12s %12s %8s\n", "uncached", "cached", "speedup");
+        printf("growth:    %9.2f ns %9.2f ns %8.2f\n",
+               times[0][0] * scale,
+               times[1][0] * scale,
+               times[0][0] / times[1][0]);
+        printf("lookup:    %9.2f ns %9.2f ns %8.2f\n",
+               times[0][1] * scale,
+               times[1][1] * scale,
+               times[0][1] / times[1][1]);
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -144,6 +144,8 @@ BSLS_IDENT("$Id: $")
 //  'p1', 'p2'      - two iterators belonging to 'a'
 //  distance(i1,i2) - the number of elements in the range [i1, i2)
 //  distance(p1,p2) - the number of elements in the range [p1, p2)
+//  'ka'            - an array of 'q' objects of type 'K'
+//  'ra'            - an array of 'q' iterators, or 'q' counts
 //
 //  +----------------------------------------------------+--------------------+
 //  | Operation                                          | Complexity         |
@@ -220,6 +222,9 @@ BSLS_IDENT("$Id: $")
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
+//  | a.findBatch(ra, ka, q)                             | Average: O[q]      |
+//  | a.countBatch(ra, ka, q)                            | Worst:   O[q * n]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.count(k)                                         | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -262,6 +267,14 @@ BSLS_IDENT("$Id: $")
 // not an iterator referring to any element in the container, so may be
 // invalidated by any non-'const' method.
 //
+///Batch Lookup
+///------------
+// 'findBatch' and 'countBatch' look up an array of keys at once, overlapping
+// the cache misses incurred by the lookups.  The syntax and semantics of these
+// methods for 'bslstl_unorderedset' are identical to those of
+// 'bslstl_unorderedmap'.  See the discussion in
+// {'bslstl_unorderedmap'|Batch Lookup}.
+//
 ///Unordered Set Configuration
 ///---------------------------
 // The unordered set has interfaces that can provide insight into and control
@@ -970,6 +983,17 @@ class unordered_set
         // specified 'key'.  Note that since an unordered set maintains unique
         // keys, the returned value will be either 0 or 1.
 
+    void countBatch(size_type      *results,
+                    const key_type *keys,
+                    size_type       numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array the number of 'value_type' objects within this set
+        // having the corresponding element of the specified 'keys' array as
+        // their key (see {Batch Lookup}).  The behavior is undefined unless
+        // 'results' and 'keys' each refer to arrays of at least 'numKeys'
+        // elements.  Note that since an unordered set maintains unique keys,
+        // each loaded value will be either 0 or 1.
+
     bool empty() const;
         // Return 'true' if this set contains no elements, and 'false'
         // otherwise.
@@ -990,6 +1014,17 @@ class unordered_set
         // 'value_type' object in this set having the specified 'key', if such
         // an entry exists, and the past-the-end ('end') iterator otherwise.
 
+    void findBatch(const_iterator *results,
+                   const key_type *keys,
+                   size_type       numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator providing non-modifiable access to the
+        // 'value_type' object in this set having the corresponding element of
+        // the specified 'keys' array as its key, if such an entry exists, and
+        // the past-the-end ('end') iterator otherwise (see {Batch Lookup}).
+        // The behavior is undefined unless 'results' and 'keys' each refer to
+        // arrays of at least 'numKeys' elements.
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // set.
@@ -1429,6 +1464,36 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::count(const key_type& key) const
     return 0 != d_impl.find(key);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::countBatch(
+                                               size_type      *results,
+                                               const key_type *keys,
+                                               size_type       numKeys) const
+{
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    enum { k_CHUNK_SIZE = 64 };
+
+    HashTableLink *links[k_CHUNK_SIZE];
+
+    while (numKeys) {
+        const size_type chunkSize = numKeys < k_CHUNK_SIZE
+                                  ? numKeys
+                                  : static_cast<size_type>(k_CHUNK_SIZE);
+
+        d_impl.findBatch(links, keys, chunkSize);
+
+        for (size_type i = 0; i != chunkSize; ++i) {
+            results[i] = 0 != links[i];
+        }
+
+        results += chunkSize;
+        keys    += chunkSize;
+        numKeys -= chunkSize;
+    }
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bool unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::empty() const
@@ -1444,6 +1509,36 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::findBatch(
+                                               const_iterator *results,
+                                               const key_type *keys,
+                                               size_type       numKeys) const
+{
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    enum { k_CHUNK_SIZE = 64 };
+
+    HashTableLink *links[k_CHUNK_SIZE];
+
+    while (numKeys) {
+        const size_type chunkSize = numKeys < k_CHUNK_SIZE
+                                  ? numKeys
+                                  : static_cast<size_type>(k_CHUNK_SIZE);
+
+        d_impl.findBatch(links, keys, chunkSize);
+
+        for (size_type i = 0; i != chunkSize; ++i) {
+            results[i] = const_iterator(links[i]);
+        }
+
+        results += chunkSize;
+        keys    += chunkSize;
+        numKeys -= chunkSize;
+    }
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator,
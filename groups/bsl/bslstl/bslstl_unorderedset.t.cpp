@@ -168,6 +168,8 @@ using namespace BloombergLP;
 //*[13] size_type count(const key_type& key) const;
 //*[13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 //*[13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [28] void findBatch(const_iterator *, const key_type *, size_type) const;
+// [28] void countBatch(size_type *, const key_type *, size_type) const;
 //
 // bucket interface:
 //*[26] size_type bucket_count() const;
@@ -1214,6 +1216,9 @@ class TestDriver {
   public:
     // TEST CASES
 
+    static void testCase28();
+        // Batch lookup
+
     static void testCase99();
         // Test spread of nodes into different buckets
 
@@ -1415,6 +1420,133 @@ TestDriver<KEY, HASH, EQUAL, ALLOC>::getIterForIndex(const Obj& obj,
     return ret;
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOC>
+void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase28()
+{
+    // ------------------------------------------------------------------------
+    // TESTING BATCH LOOKUP
+    //
+    // Concerns:
+    //: 1 'findBatch' loads, for each key, the iterator that 'find' returns
+    //:   for that key.
+    //:
+    //: 2 'countBatch' loads, for each key, the value that 'count' returns for
+    //:   that key.
+    //:
+    //: 3 Any number of keys is supported, including 0 and numbers that are
+    //:   not multiples of the sizes of the groups in which keys are looked
+    //:   up, and keys may be repeated.
+    //:
+    //: 4 Only the first 'numKeys' elements of the result array are modified.
+    //:
+    //: 5 No memory is allocated.
+    //:
+    //: 6 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 For each spec in 'DEFAULT_DATA', create an object, and an array of
+    //:   200 keys cycling through the values of 'TestValues', so that some
+    //:   keys are in the object and others are not.  For each of a set of
+    //:   numbers of keys, call 'findBatch' and 'countBatch' on a prefix of
+    //:   the array, and compare each result against 'find' and 'count'.
+    //:   Verify that the element following the last result is unchanged.
+    //:   (C-1..4)
+    //:
+    //: 2 Verify, using test allocators, that no memory is allocated by the
+    //:   calls.  (C-5)
+    //:
+    //: 3 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered for null arrays.  (C-6)
+    //
+    // Testing:
+    //   void findBatch(const_iterator *, const key_type *, size_type) const;
+    //   void countBatch(size_type *, const key_type *, size_type) const;
+    // ------------------------------------------------------------------------
+
+    const size_t NUM_DATA                  = DEFAULT_NUM_DATA;
+    const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+    enum { k_MAX_KEYS = 200 };
+
+    static const SizeType NUM_KEYS[] = { 0, 1, 2, 15, 16, 17, 63, 64, 65,
+                                         k_MAX_KEYS };
+    enum { NUM_NUM_KEYS = sizeof NUM_KEYS / sizeof *NUM_KEYS };
+
+    static const char ALPHABET[] =
+                        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+    char keySpec[k_MAX_KEYS + 1];
+    for (int i = 0; i < k_MAX_KEYS; ++i) {
+        keySpec[i] = ALPHABET[i % (sizeof ALPHABET - 1)];
+    }
+    keySpec[k_MAX_KEYS] = '\0';
+
+    bslma::TestAllocator da("default",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("supplied",  veryVeryVeryVerbose);
+    bslma::TestAllocator ta("scratch",   veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    const TestValues KEYS(keySpec, &ta);
+
+    for (size_t ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE = DATA[ti].d_line;
+        const char *const SPEC = DATA[ti].d_spec;
+
+        if (veryVerbose) { P_(LINE) P(SPEC) }
+
+        Obj mX(&sa);    const Obj& X = mX;
+        gg(&mX, SPEC);
+
+        for (int tj = 0; tj < NUM_NUM_KEYS; ++tj) {
+            const SizeType N = NUM_KEYS[tj];
+
+            CIter    iterators[k_MAX_KEYS + 1];
+            SizeType counts[k_MAX_KEYS + 1];
+
+            for (int i = 0; i <= k_MAX_KEYS; ++i) {
+                iterators[i] = X.end();
+                counts[i]    = 99;
+            }
+
+            const bsls::Types::Int64 DA = da.numAllocations();
+            const bsls::Types::Int64 SA = sa.numAllocations();
+
+            X.findBatch(iterators, KEYS.data(), N);
+            X.countBatch(counts, KEYS.data(), N);
+
+            ASSERTV(LINE, N, DA == da.numAllocations());
+            ASSERTV(LINE, N, SA == sa.numAllocations());
+
+            for (SizeType i = 0; i < N; ++i) {
+                ASSERTV(LINE, N, i, X.find(KEYS[i])  == iterators[i]);
+                ASSERTV(LINE, N, i, X.count(KEYS[i]) == counts[i]);
+            }
+            ASSERTV(LINE, N, 99 == counts[N]);
+        }
+    }
+
+    if (verbose) printf("\nNegative Testing.\n");
+    {
+        bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
+
+        Obj mX;    const Obj& X = mX;
+
+        CIter    iterators[1];
+        SizeType counts[1];
+
+        ASSERT_SAFE_FAIL(X.findBatch(0, KEYS.data(), 1));
+        ASSERT_SAFE_FAIL(X.findBatch(iterators, 0, 1));
+        ASSERT_SAFE_PASS(X.findBatch(0, 0, 0));
+        ASSERT_SAFE_PASS(X.findBatch(iterators, KEYS.data(), 1));
+
+        ASSERT_SAFE_FAIL(X.countBatch(0, KEYS.data(), 1));
+        ASSERT_SAFE_FAIL(X.countBatch(counts, 0, 1));
+        ASSERT_SAFE_PASS(X.countBatch(0, 0, 0));
+        ASSERT_SAFE_PASS(X.countBatch(counts, KEYS.data(), 1));
+    }
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOC>
 void TestDriver<KEY, HASH, EQUAL, ALLOC>::testCase99()
 {
@@ -6364,7 +6496,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
-      case 28: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6519,6 +6651,18 @@ if (verbose) {
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING BATCH LOOKUP\n"
+                            "====================\n");
+
+        RUN_EACH_TYPE(TestDriver,
+                      testCase28,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+      } break;
       case 27: {
         // --------------------------------------------------------------------
         // TESTING SPREAD